@@ -36,6 +36,21 @@ bool ReadEnvFlag(const char* name, bool default_value)
 
     return default_value;
 }
+
+std::string ReadEnvString(const char* name, const std::string& default_value)
+{
+    char* value = nullptr;
+    size_t value_length = 0;
+    if (_dupenv_s(&value, &value_length, name) != 0 || !value || value[0] == '\0')
+    {
+        std::free(value);
+        return default_value;
+    }
+
+    std::string result(value);
+    std::free(value);
+    return result;
+}
 }
 
 bool RHIConfigSingleton::InitGraphicsAPI()
@@ -54,4 +69,6 @@ RHIConfigSingleton::RHIConfigSingleton()
     {
         m_enable_api_validation = true;
     }
+    m_enable_pipeline_cache = ReadEnvFlag("GLTF_PIPELINE_CACHE", true);
+    m_pipeline_cache_directory = ReadEnvString("GLTF_PIPELINE_CACHE_DIR", "PipelineCache");
 }
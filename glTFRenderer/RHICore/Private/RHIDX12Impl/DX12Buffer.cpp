@@ -116,16 +116,22 @@ bool DX12Buffer::UploadBufferFromCPU(const void* data, size_t dst_offset, size_t
     assert((dst_offset + size) <= m_buffer_desc.width);
     
     memcpy(m_mapped_gpu_buffer + dst_offset, data, size);
-    
-    m_buffer->Unmap(0, nullptr);
-    m_mapped_gpu_buffer = nullptr;
+
+    // Upload heap buffers stay mapped until release: the heap is write-combined and coherent, so ring chunks and
+    // per-frame constant buffers are written without a map/unmap pair per upload.
+    if (m_buffer_desc.type != RHIBufferType::Upload)
+    {
+        m_buffer->Unmap(0, nullptr);
+        m_mapped_gpu_buffer = nullptr;
+    }
     
     return true;
 }
 
 bool DX12Buffer::DownloadBufferToCPU(void* data, size_t size)
 {
-    if (!m_mapped_gpu_buffer)
+    const bool persistently_mapped = m_mapped_gpu_buffer != nullptr;
+    if (!persistently_mapped)
     {
         D3D12_RANGE readRange = { 0, size };
         THROW_IF_FAILED(m_buffer->Map(0, &m_map_range, reinterpret_cast<void**>(&m_mapped_gpu_buffer)))
@@ -134,8 +140,11 @@ bool DX12Buffer::DownloadBufferToCPU(void* data, size_t size)
     GLTF_CHECK(size <= m_buffer_desc.width);
     memcpy(data, m_mapped_gpu_buffer, size);
 
-    m_buffer->Unmap(0, nullptr);
-    m_mapped_gpu_buffer = nullptr;
+    if (!persistently_mapped)
+    {
+        m_buffer->Unmap(0, nullptr);
+        m_mapped_gpu_buffer = nullptr;
+    }
 
     return true;
 }
@@ -1,11 +1,13 @@
 #include "DX12CommandAllocator.h"
+#include "DX12ConverterUtils.h"
 #include "DX12Device.h"
 #include "DX12Utils.h"
 
 bool DX12CommandAllocator::InitCommandAllocator(IRHIDevice& device, RHICommandAllocatorType type)
 {
+    m_type = type;
     auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
-    THROW_IF_FAILED(dxDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_command_allocator)))
+    THROW_IF_FAILED(dxDevice->CreateCommandAllocator(DX12ConverterUtils::ConvertToCommandListType(type), IID_PPV_ARGS(&m_command_allocator)))
 
     need_release = true;
     
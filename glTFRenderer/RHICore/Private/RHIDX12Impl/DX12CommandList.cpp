@@ -1,5 +1,6 @@
 #include "DX12CommandList.h"
 
+#include "DX12ConverterUtils.h"
 #include "DX12Device.h"
 #include "RHIResourceFactoryImpl.hpp"
 #include "RHIInterface/IRHIFence.h"
@@ -8,7 +9,8 @@ bool DX12CommandList::InitCommandList(IRHIDevice& device, IRHICommandAllocator&
 {
     auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
     auto* dxCommandAllocator = dynamic_cast<DX12CommandAllocator&>(command_allocator).GetCommandAllocator();
-    THROW_IF_FAILED(dxDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, dxCommandAllocator, nullptr, IID_PPV_ARGS(&m_command_list)))
+    const auto command_list_type = DX12ConverterUtils::ConvertToCommandListType(command_allocator.GetType());
+    THROW_IF_FAILED(dxDevice->CreateCommandList(0, command_list_type, dxCommandAllocator, nullptr, IID_PPV_ARGS(&m_command_list)))
 
     // Query DXR command list
     THROW_IF_FAILED(m_command_list->QueryInterface(IID_PPV_ARGS(&m_dxr_command_list)))
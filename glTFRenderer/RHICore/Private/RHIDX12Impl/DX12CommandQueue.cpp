@@ -5,10 +5,13 @@
 #include "RHIResourceFactory.h"
 #include "RHIInterface/IRHIFence.h"
 
-bool DX12CommandQueue::InitCommandQueue(IRHIDevice& device)
+bool DX12CommandQueue::InitCommandQueue(IRHIDevice& device, RHICommandQueueType type)
 {
+    m_type = type;
+    
     // -- Create the Command Queue -- //
     D3D12_COMMAND_QUEUE_DESC cqDesc = {}; // we will be using all the default values
+    cqDesc.Type = type == RHICommandQueueType::COMPUTE ? D3D12_COMMAND_LIST_TYPE_COMPUTE : D3D12_COMMAND_LIST_TYPE_DIRECT;
 
     auto dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
     THROW_IF_FAILED(dxDevice->CreateCommandQueue(&cqDesc, IID_PPV_ARGS(&m_command_queue))) // create the command queue
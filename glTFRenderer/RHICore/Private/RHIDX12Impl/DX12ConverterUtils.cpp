@@ -326,3 +326,23 @@ D3D12_RESOURCE_FLAGS DX12ConverterUtils::ConvertToResourceFlags(RHIResourceUsage
 
     return result;
 }
+
+D3D12_COMMAND_LIST_TYPE DX12ConverterUtils::ConvertToCommandListType(RHICommandAllocatorType type)
+{
+    switch (type)
+    {
+    case RHICommandAllocatorType::DIRECT:
+        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+    case RHICommandAllocatorType::COMPUTE:
+        return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    case RHICommandAllocatorType::COPY:
+        return D3D12_COMMAND_LIST_TYPE_COPY;
+    case RHICommandAllocatorType::BUNDLE:
+        return D3D12_COMMAND_LIST_TYPE_BUNDLE;
+    case RHICommandAllocatorType::UNKNOWN:
+        break;
+    }
+
+    GLTF_CHECK(false);
+    return D3D12_COMMAND_LIST_TYPE_DIRECT;
+}
@@ -24,13 +24,14 @@ bool DX12DescriptorHeap::InitDescriptorHeap(IRHIDevice& device, const RHIDescrip
     
     THROW_IF_FAILED(dxDevice->CreateDescriptorHeap(&dxDesc, IID_PPV_ARGS(&m_descriptorHeap)))
     m_descriptor_increment_size = dxDevice->GetDescriptorHandleIncrementSize(dxDesc.Type);
+    m_index_allocator.Init(desc.max_descriptor_count);
     
     return true;
 }
 
 unsigned DX12DescriptorHeap::GetUsedDescriptorCount() const
 {
-    return m_used_descriptor_count;
+    return m_index_allocator.GetHighWaterMark();
 }
 
 bool DX12DescriptorHeap::ValidateDescriptorOffset(unsigned descriptor_offset, const char* allocation_type) const
@@ -41,18 +42,31 @@ bool DX12DescriptorHeap::ValidateDescriptorOffset(unsigned descriptor_offset, co
     }
 
     LOG_FORMAT_FLUSH(
-        "[DX12DescriptorHeap][Error] Out of descriptor range while allocating %s (heap_type=%d, request_offset=%u, used=%u, capacity=%u).\n",
+        "[DX12DescriptorHeap][Error] Out of descriptor range while allocating %s (heap_type=%d, request_offset=%u, capacity=%u).\n",
         allocation_type,
         static_cast<int>(m_desc.type),
         descriptor_offset,
-        m_used_descriptor_count,
         m_desc.max_descriptor_count);
     return false;
 }
 
-void DX12DescriptorHeap::CommitDescriptorOffset(unsigned descriptor_offset)
+bool DX12DescriptorHeap::AllocateDescriptorOffset(unsigned count, const char* allocation_type, unsigned& out_descriptor_offset)
 {
-    m_used_descriptor_count = (std::max)(m_used_descriptor_count, descriptor_offset + 1u);
+    if (m_index_allocator.Allocate(count, out_descriptor_offset))
+    {
+        return true;
+    }
+
+    LOG_FORMAT_FLUSH(
+        "[DX12DescriptorHeap][Error] Out of descriptors while allocating %u %s (heap_type=%d, allocated=%u, pending_free=%u, largest_free_range=%u, capacity=%u).\n",
+        count,
+        allocation_type,
+        static_cast<int>(m_desc.type),
+        m_index_allocator.GetAllocatedCount(),
+        m_index_allocator.GetPendingFreeCount(),
+        m_index_allocator.GetLargestFreeRange(),
+        m_desc.max_descriptor_count);
+    return false;
 }
 
 bool DX12DescriptorHeap::CreateConstantBufferViewInDescriptorHeap(IRHIDevice& device, unsigned descriptor_offset,
@@ -89,8 +103,6 @@ bool DX12DescriptorHeap::CreateConstantBufferViewInDescriptorHeap(IRHIDevice& de
         });
     
     dynamic_cast<DX12BufferDescriptorAllocation&>(*out_allocation).InitHandle(gpuHandle.ptr, 0);
-
-    CommitDescriptorOffset(descriptor_offset);
     
     return true;
 }
@@ -106,50 +118,38 @@ bool DX12DescriptorHeap::CreateResourceDescriptorInHeap(IRHIDevice& device,
     {
         for (const auto& created_info : find_resource->second)
         {
-            if (created_info.first == desc)
+            if (created_info.desc == desc)
             {
                 out_allocation = RHIResourceFactory::CreateRHIResource<IRHIBufferDescriptorAllocation>();
                 out_allocation->InitFromBuffer(buffer, buffer_desc);
     
-                dynamic_cast<DX12BufferDescriptorAllocation&>(*out_allocation).InitHandle(created_info.second.second, created_info.second.first);
+                dynamic_cast<DX12BufferDescriptorAllocation&>(*out_allocation).InitHandle(created_info.gpu_handle, created_info.cpu_handle);
                 return true;
             }
         }
     }
     
-    bool created = false;
     RHIGPUDescriptorHandle gpu_handle {0};
     RHICPUDescriptorHandle cpu_handle {0};
-    
-    switch (desc.m_view_type)
+    unsigned descriptor_offset = 0;
+    if (!AllocateDescriptorOffset(1, "buffer view", descriptor_offset))
     {
-    case RHIViewType::RVT_CBV:
-        break;
-    case RHIViewType::RVT_SRV:    
-        created = CreateSRVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle, gpu_handle);
-        break;
-    case RHIViewType::RVT_UAV:
-        created = CreateUAVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle, gpu_handle);
-        break;
-    case RHIViewType::RVT_RTV:
-        created = CreateRTVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle);
-        break;
-    case RHIViewType::RVT_DSV:
-        created = CreateDSVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle);
-        break;
+        out_allocation = nullptr;
+        return false;
     }
-
-    if (!created)
+    if (!CreateViewInHeap(device, descriptor_offset, resource, desc, cpu_handle, gpu_handle))
     {
+        m_index_allocator.Free(descriptor_offset, 1, m_frame_index);
         out_allocation = nullptr;
         return false;
     }
+    m_created_descriptors_info[resource].push_back({desc, cpu_handle, gpu_handle, descriptor_offset});
 
     out_allocation = RHIResourceFactory::CreateRHIResource<IRHIBufferDescriptorAllocation>();
     out_allocation->InitFromBuffer(buffer, buffer_desc);
     dynamic_cast<DX12BufferDescriptorAllocation&>(*out_allocation).InitHandle(gpu_handle, cpu_handle);
     
-    return created;
+    return true;
 }
 
 bool DX12DescriptorHeap::CreateResourceDescriptorInHeap(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture,
@@ -162,44 +162,82 @@ bool DX12DescriptorHeap::CreateResourceDescriptorInHeap(IRHIDevice& device, cons
     {
         for (const auto& created_info : find_resource->second)
         {
-            if (created_info.first == desc)
+            if (created_info.desc == desc)
             {
-                out_allocation = std::make_shared<DX12TextureDescriptorAllocation>(created_info.second.second, created_info.second.first, texture, texture_desc);
+                out_allocation = std::make_shared<DX12TextureDescriptorAllocation>(created_info.gpu_handle, created_info.cpu_handle, texture, texture_desc);
                 return true;
             }
         }
     }
     
-    bool created = false;
     RHIGPUDescriptorHandle gpu_handle {0};
     RHICPUDescriptorHandle cpu_handle {0};
-    
-    switch (desc.m_view_type)
+    unsigned descriptor_offset = 0;
+    if (!AllocateDescriptorOffset(1, "texture view", descriptor_offset))
     {
-    case RHIViewType::RVT_CBV:
-        break;
-    case RHIViewType::RVT_SRV:    
-        created = CreateSRVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle, gpu_handle);
-        break;
-    case RHIViewType::RVT_UAV:
-        created = CreateUAVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle, gpu_handle);
-        break;
-    case RHIViewType::RVT_RTV:
-        created = CreateRTVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle);
-        break;
-    case RHIViewType::RVT_DSV:
-        created = CreateDSVInHeap(device, m_used_descriptor_count, resource, desc, cpu_handle);
-        break;
+        out_allocation = nullptr;
+        return false;
     }
-
-    if (!created)
+    if (!CreateViewInHeap(device, descriptor_offset, resource, desc, cpu_handle, gpu_handle))
     {
+        m_index_allocator.Free(descriptor_offset, 1, m_frame_index);
         out_allocation = nullptr;
         return false;
     }
+    m_created_descriptors_info[resource].push_back({desc, cpu_handle, gpu_handle, descriptor_offset});
 
     out_allocation = std::make_shared<DX12TextureDescriptorAllocation>(gpu_handle, cpu_handle, texture, texture_desc);
-    return created;
+    return true;
+}
+
+bool DX12DescriptorHeap::CreateDescriptorTableInHeap(IRHIDevice& device,
+    const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations, unsigned& out_first_index,
+    RHIGPUDescriptorHandle& out_gpu_handle)
+{
+    const unsigned descriptor_count = static_cast<unsigned>(descriptor_allocations.size());
+    if (descriptor_count == 0 || !AllocateDescriptorOffset(descriptor_count, "descriptor table", out_first_index))
+    {
+        return false;
+    }
+
+    for (unsigned descriptor_index = 0; descriptor_index < descriptor_count; ++descriptor_index)
+    {
+        RHIGPUDescriptorHandle gpu_handle {0};
+        if (!CreateTextureDescriptorAt(device, out_first_index + descriptor_index, *descriptor_allocations[descriptor_index], gpu_handle))
+        {
+            m_index_allocator.Free(out_first_index, descriptor_count, m_frame_index);
+            return false;
+        }
+        if (descriptor_index == 0)
+        {
+            out_gpu_handle = gpu_handle;
+        }
+    }
+    return true;
+}
+
+bool DX12DescriptorHeap::AllocateDescriptorRange(unsigned count, unsigned& out_first_index, RHIGPUDescriptorHandle& out_gpu_handle)
+{
+    if (count == 0 || !AllocateDescriptorOffset(count, "descriptor range", out_first_index))
+    {
+        return false;
+    }
+
+    CD3DX12_GPU_DESCRIPTOR_HANDLE gpu_handle(GetGPUHandleForHeapStart());
+    gpu_handle.Offset(static_cast<int>(out_first_index), m_descriptor_increment_size);
+    out_gpu_handle = gpu_handle.ptr;
+    return true;
+}
+
+bool DX12DescriptorHeap::CreateTextureDescriptorAt(IRHIDevice& device, unsigned descriptor_index,
+    const IRHITextureDescriptorAllocation& descriptor_allocation, RHIGPUDescriptorHandle& out_gpu_handle)
+{
+    auto* resource = dynamic_cast<DX12Texture&>(*descriptor_allocation.m_source).GetRawResource();
+    const auto& desc = descriptor_allocation.GetDesc();
+    GLTF_CHECK(desc.m_view_type == RHIViewType::RVT_SRV || desc.m_view_type == RHIViewType::RVT_UAV);
+
+    RHICPUDescriptorHandle cpu_handle {0};
+    return CreateViewInHeap(device, descriptor_index, resource, desc, cpu_handle, out_gpu_handle);
 }
 
 void DX12DescriptorHeap::InvalidateResourceDescriptors(ID3D12Resource* resource)
@@ -209,18 +247,65 @@ void DX12DescriptorHeap::InvalidateResourceDescriptors(ID3D12Resource* resource)
         return;
     }
 
-    m_created_descriptors_info.erase(resource);
+    const auto find_resource = m_created_descriptors_info.find(resource);
+    if (find_resource == m_created_descriptors_info.end())
+    {
+        return;
+    }
+    for (const auto& created_info : find_resource->second)
+    {
+        FreeDescriptors(created_info.descriptor_offset, 1);
+    }
+    m_created_descriptors_info.erase(find_resource);
+}
+
+void DX12DescriptorHeap::FreeDescriptors(unsigned first_index, unsigned count)
+{
+    m_index_allocator.Free(first_index, count, m_frame_index);
+}
+
+void DX12DescriptorHeap::BeginFrame(unsigned long long frame_index, unsigned frame_slot_count)
+{
+    m_frame_index = frame_index;
+    if (frame_index >= frame_slot_count)
+    {
+        m_index_allocator.ReclaimCompletedFrames(frame_index - frame_slot_count);
+    }
+}
+
+unsigned DX12DescriptorHeap::GetDescriptorIndex(RHIGPUDescriptorHandle gpu_handle) const
+{
+    GLTF_CHECK(m_desc.shader_visible && gpu_handle >= GetGPUHandleForHeapStart().ptr);
+    return static_cast<unsigned>((gpu_handle - GetGPUHandleForHeapStart().ptr) / m_descriptor_increment_size);
 }
 
 bool DX12DescriptorHeap::Release(IRHIMemoryManager& memory_manager)
 {
     m_created_descriptors_info.clear();
-    m_used_descriptor_count = 0;
+    m_index_allocator.Reset();
     SAFE_RELEASE(m_descriptorHeap)
     
     return true;
 }
 
+bool DX12DescriptorHeap::CreateViewInHeap(IRHIDevice& device, unsigned descriptor_offset, ID3D12Resource* resource,
+    const RHIDescriptorDesc& desc, RHICPUDescriptorHandle& out_CPU_handle, RHIGPUDescriptorHandle& out_GPU_handle)
+{
+    switch (desc.m_view_type)
+    {
+    case RHIViewType::RVT_SRV:
+        return CreateSRVInHeap(device, descriptor_offset, resource, desc, out_CPU_handle, out_GPU_handle);
+    case RHIViewType::RVT_UAV:
+        return CreateUAVInHeap(device, descriptor_offset, resource, desc, out_CPU_handle, out_GPU_handle);
+    case RHIViewType::RVT_RTV:
+        return CreateRTVInHeap(device, descriptor_offset, resource, desc, out_CPU_handle);
+    case RHIViewType::RVT_DSV:
+        return CreateDSVInHeap(device, descriptor_offset, resource, desc, out_CPU_handle);
+    default:
+        return false;
+    }
+}
+
 D3D12_CPU_DESCRIPTOR_HANDLE DX12DescriptorHeap::GetCPUHandleForHeapStart() const
 {
     return m_descriptorHeap->GetCPUDescriptorHandleForHeapStart();
@@ -285,9 +370,6 @@ bool DX12DescriptorHeap::CreateSRVInHeap(IRHIDevice& device, unsigned descriptor
     gpuHandle.Offset(descriptor_offset, m_descriptor_increment_size);
     out_GPU_handle = gpuHandle.ptr;
     
-    CommitDescriptorOffset(descriptor_offset);
-    m_created_descriptors_info[resource].emplace_back(desc, std::pair{out_CPU_handle, out_GPU_handle} );
-    
     return true;
 }
 
@@ -333,9 +415,6 @@ bool DX12DescriptorHeap::CreateUAVInHeap(IRHIDevice& device, unsigned descriptor
     gpuHandle.Offset(static_cast<int>(descriptor_offset), m_descriptor_increment_size);
     out_GPU_handle = gpuHandle.ptr;
     
-    CommitDescriptorOffset(descriptor_offset);
-    m_created_descriptors_info[resource].emplace_back(desc, std::pair{out_CPU_handle, out_GPU_handle});
-    
     return true;
 }
 
@@ -359,9 +438,6 @@ bool DX12DescriptorHeap::CreateRTVInHeap(IRHIDevice& device, unsigned descriptor
     dx_device->CreateRenderTargetView(resource, &rtv_desc, cpu_handle);
 
     out_CPU_handle = cpu_handle.ptr;
-    
-    CommitDescriptorOffset(descriptor_offset);
-    m_created_descriptors_info[resource].emplace_back(desc, std::pair{out_CPU_handle, 0});
 
     return true;
 }
@@ -386,9 +462,6 @@ bool DX12DescriptorHeap::CreateDSVInHeap(IRHIDevice& device, unsigned descriptor
     dx_device->CreateDepthStencilView(resource, &dsv_desc, cpu_handle);
 
     out_CPU_handle = cpu_handle.ptr;
-    
-    CommitDescriptorOffset(descriptor_offset);
-    m_created_descriptors_info[resource].emplace_back(desc, std::pair{out_CPU_handle, 0});
 
     return true;
 }
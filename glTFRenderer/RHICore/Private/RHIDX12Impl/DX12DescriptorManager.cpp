@@ -3,6 +3,7 @@
 #include "RHIResourceFactoryImpl.hpp"
 #include "DX12DescriptorHeap.h"
 #include "DX12Utils.h"
+#include "RHIInterface/IRHIMemoryManager.h"
 #include <algorithm>
 
 bool DX12BufferDescriptorAllocation::InitHandle(RHIGPUDescriptorHandle gpu_handle, RHICPUDescriptorHandle cpu_handle)
@@ -48,12 +49,36 @@ bool DX12DescriptorTable::Build(IRHIDevice& device, const std::vector<std::share
     for (size_t i = 1; i < descriptor_allocations.size(); ++i)
     {
         auto check_handle = current_handle.Offset(1, descriptor_increment_size).ptr;
-        GLTF_CHECK(dynamic_cast<const DX12TextureDescriptorAllocation&>(*descriptor_allocations[i]).m_gpu_handle == check_handle);
+        if (dynamic_cast<const DX12TextureDescriptorAllocation&>(*descriptor_allocations[i]).m_gpu_handle != check_handle)
+        {
+            m_gpu_handle = UINT64_MAX;
+            return false;
+        }
     }
 
     return true; 
 }
 
+void DX12DescriptorTable::InitOwnedRange(RHIGPUDescriptorHandle gpu_handle, unsigned first_index, unsigned descriptor_count)
+{
+    m_gpu_handle = gpu_handle;
+    m_owned_first_index = first_index;
+    m_owned_descriptor_count = descriptor_count;
+}
+
+bool DX12DescriptorTable::Release(IRHIMemoryManager& memory_manager)
+{
+    if (m_owned_descriptor_count > 0)
+    {
+        dynamic_cast<DX12DescriptorManager&>(memory_manager.GetDescriptorManager())
+            .GetDescriptorHeap(RHIDescriptorHeapType::CBV_SRV_UAV_GPU)
+            .FreeDescriptors(m_owned_first_index, m_owned_descriptor_count);
+        m_owned_descriptor_count = 0;
+    }
+    m_gpu_handle = UINT64_MAX;
+    return true;
+}
+
 template<>
     std::shared_ptr<DX12DescriptorHeap> RHIResourceFactory::CreateRHIResource()
 {
@@ -63,7 +88,7 @@ template<>
 bool DX12DescriptorManager::Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity)
 {
     const unsigned base_cbv_srv_uav_capacity = (std::max)(max_descriptor_capacity.cbv_srv_uav_size, 256u);
-    const unsigned cbv_srv_uav_capacity = base_cbv_srv_uav_capacity * 4u;
+    const unsigned cbv_srv_uav_capacity = base_cbv_srv_uav_capacity * 4u + MAX_BINDLESS_TEXTURE_COUNT;
     const unsigned rtv_capacity = (std::max)(max_descriptor_capacity.rtv_size * 2u, 128u);
     const unsigned dsv_capacity = (std::max)(max_descriptor_capacity.dsv_size * 2u, 128u);
     LOG_FORMAT_FLUSH(
@@ -81,6 +106,14 @@ bool DX12DescriptorManager::Init(IRHIDevice& device, const DescriptorAllocationI
             .shader_visible = true
         });
 
+    // The bindless table covers a fixed range, so a texture's bindless index never depends on where its
+    // own descriptor was allocated.
+    auto bindless_texture_table = std::make_shared<DX12DescriptorTable>();
+    RHIGPUDescriptorHandle bindless_texture_gpu_handle {0};
+    RETURN_IF_FALSE(m_CBV_SRV_UAV_gpu_heap->AllocateDescriptorRange(MAX_BINDLESS_TEXTURE_COUNT, m_bindless_texture_first_index, bindless_texture_gpu_handle))
+    bindless_texture_table->m_gpu_handle = bindless_texture_gpu_handle;
+    InitBindlessTextureTable(bindless_texture_table);
+
     /*
     m_CBV_SRV_UAV_cpu_heap = RHIResourceFactory::CreateRHIResource<DX12DescriptorHeap>();
     m_CBV_SRV_UAV_cpu_heap->InitDescriptorHeap(device,
@@ -161,6 +194,29 @@ bool DX12DescriptorManager::CreateDescriptor(IRHIDevice& device, const std::shar
     return created;
 }
 
+bool DX12DescriptorManager::CreateDescriptorTable(IRHIDevice& device,
+    const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations,
+    std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table)
+{
+    auto descriptor_table = std::make_shared<DX12DescriptorTable>();
+    if (!descriptor_table->Build(device, descriptor_allocations))
+    {
+        // Descriptors of the table were allocated apart, e.g. into slots freed by released resources.
+        unsigned first_index = 0;
+        RHIGPUDescriptorHandle gpu_handle {0};
+        if (!m_CBV_SRV_UAV_gpu_heap->CreateDescriptorTableInHeap(device, descriptor_allocations, first_index, gpu_handle))
+        {
+            LOG_FORMAT_FLUSH("[DX12Descriptor][Error] Descriptor table allocation failed (descriptor_count=%u).\n",
+                static_cast<unsigned>(descriptor_allocations.size()));
+            out_descriptor_table = nullptr;
+            return false;
+        }
+        descriptor_table->InitOwnedRange(gpu_handle, first_index, static_cast<unsigned>(descriptor_allocations.size()));
+    }
+    out_descriptor_table = descriptor_table;
+    return true;
+}
+
 bool DX12DescriptorManager::BindDescriptorContext(IRHICommandList& command_list)
 {
     return DX12Utils::DX12Instance().SetDescriptorHeapArray(command_list, m_CBV_SRV_UAV_gpu_heap.get(), 1);
@@ -176,6 +232,25 @@ bool DX12DescriptorManager::Release(IRHIMemoryManager& memory_manager)
     return true;
 }
 
+void DX12DescriptorManager::BeginFrame(unsigned long long frame_index)
+{
+    IRHIDescriptorManager::BeginFrame(frame_index);
+    for (const auto& heap : {m_CBV_SRV_UAV_gpu_heap, m_RTV_heap, m_DSV_heap})
+    {
+        if (heap)
+        {
+            heap->BeginFrame(frame_index, GetFrameSlotCount());
+        }
+    }
+}
+
+bool DX12DescriptorManager::WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index,
+    const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation)
+{
+    RHIGPUDescriptorHandle gpu_handle {0};
+    return m_CBV_SRV_UAV_gpu_heap->CreateTextureDescriptorAt(device, m_bindless_texture_first_index + bindless_index, *descriptor_allocation, gpu_handle);
+}
+
 void DX12DescriptorManager::InvalidateResourceDescriptors(ID3D12Resource* resource)
 {
     if (!resource)
@@ -61,6 +61,8 @@ bool DX12Device::InitDevice(IRHIFactory& factory)
     // Query DXR device
     THROW_IF_FAILED(m_device->QueryInterface(IID_PPV_ARGS(&m_dxr_device)))
 
+    m_pipeline_cache.Init(m_device.Get(), m_adapter.Get());
+
     need_release = true;
     
     return true;
@@ -68,6 +70,7 @@ bool DX12Device::InitDevice(IRHIFactory& factory)
 
 bool DX12Device::Release(IRHIMemoryManager& memory_manager)
 {
+    m_pipeline_cache.Release();
     SAFE_RELEASE(m_device)
     SAFE_RELEASE(m_adapter)
     SAFE_RELEASE(m_dxr_device)
@@ -1,5 +1,6 @@
 #include "DX12MemoryManager.h"
 #include "d3dx12.h"
+#include "DX12Device.h"
 #include "RHIResourceFactoryImpl.hpp"
 
 
@@ -52,6 +53,68 @@ bool DX12MemoryManager::AllocateTextureMemory(IRHIDevice& device, const RHITextu
     return true;
 }
 
+bool DX12MemoryManager::GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc,
+    unsigned long long& out_size_bytes, unsigned long long& out_alignment)
+{
+    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+    const D3D12_RESOURCE_DESC resource_desc = DX12Texture::GetResourceDesc(texture_desc);
+    const D3D12_RESOURCE_ALLOCATION_INFO allocation_info = dxDevice->GetResourceAllocationInfo(0, 1, &resource_desc);
+    if (allocation_info.SizeInBytes == UINT64_MAX)
+    {
+        return false;
+    }
+    
+    out_size_bytes = allocation_info.SizeInBytes;
+    out_alignment = allocation_info.Alignment;
+    return true;
+}
+
+bool DX12MemoryManager::AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment,
+    std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation)
+{
+    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+
+    D3D12_HEAP_DESC heap_desc = {};
+    heap_desc.SizeInBytes = size_bytes;
+    heap_desc.Properties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
+    heap_desc.Alignment = alignment;
+    // Resource heap tier 1 devices cannot mix buffers and textures in a heap; transient heaps only hold render targets.
+    heap_desc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    
+    auto dx12_heap_allocation = RHIResourceFactory::CreateRHIResource<IRHIHeapAllocation>();
+    THROW_IF_FAILED(dxDevice->CreateHeap(&heap_desc, IID_PPV_ARGS(&dynamic_cast<DX12HeapAllocation&>(*dx12_heap_allocation).m_heap)))
+    dx12_heap_allocation->m_size_bytes = size_bytes;
+    dx12_heap_allocation->m_alignment = alignment;
+    dx12_heap_allocation->SetNeedRelease();
+
+    out_heap_allocation = dx12_heap_allocation;
+    m_heap_allocations.push_back(out_heap_allocation);
+    
+    return true;
+}
+
+bool DX12MemoryManager::AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation,
+    unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation)
+{
+    auto* dx12_heap = dynamic_cast<DX12HeapAllocation&>(*heap_allocation).m_heap.Get();
+    std::shared_ptr<IRHITexture> dx12_texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
+    if (!dynamic_cast<DX12Texture&>(*dx12_texture).CreatePlacedTexture(device, dx12_heap, offset, texture_desc))
+    {
+        assert(false);
+        return false;
+    }
+
+    out_texture_allocation = RHIResourceFactory::CreateRHIResource<IRHITextureAllocation>();
+    out_texture_allocation->m_texture = dx12_texture;
+    out_texture_allocation->m_heap = heap_allocation;
+    out_texture_allocation->m_heap_offset = offset;
+    out_texture_allocation->SetNeedRelease();
+    
+    m_texture_allocations.push_back(out_texture_allocation);
+    
+    return true;
+}
+
 bool DX12MemoryManager::ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation)
 {
     auto* raw_pointer = &memory_allocation;
@@ -82,6 +145,18 @@ bool DX12MemoryManager::ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_all
             }
         }
         break;
+    case IRHIMemoryAllocation::HEAP:
+        {
+            for (auto iter = m_heap_allocations.begin(); iter != m_heap_allocations.end(); ++iter)
+            {
+                if (iter->get() == raw_pointer)
+                {
+                    m_heap_allocations.erase(iter);
+                    break;
+                }
+            }
+        }
+        break;
     }
 
     return true;
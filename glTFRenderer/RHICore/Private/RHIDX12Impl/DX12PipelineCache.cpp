@@ -0,0 +1,153 @@
+#include "DX12PipelineCache.h"
+
+#include <cstring>
+
+#include "RHIConfigSingleton.h"
+
+bool DX12PipelineCache::Init(ID3D12Device* device, IDXGIAdapter1* adapter)
+{
+    Release();
+    if (!RHIConfigSingleton::Instance().IsPipelineCacheEnabled())
+    {
+        return true;
+    }
+
+    ComPtr<ID3D12Device1> library_device;
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(&library_device))))
+    {
+        return true;
+    }
+
+    DXGI_ADAPTER_DESC1 adapter_desc {};
+    adapter->GetDesc1(&adapter_desc);
+    LARGE_INTEGER driver_version {};
+    adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driver_version);
+    
+    m_identity = {};
+    m_identity.graphics_api = static_cast<unsigned>(RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12);
+    m_identity.vendor_id = adapter_desc.VendorId;
+    m_identity.device_id = adapter_desc.DeviceId;
+    m_identity.driver_version = static_cast<unsigned long long>(driver_version.QuadPart);
+    memcpy(m_identity.cache_uuid.data(), &adapter_desc.SubSysId, sizeof(adapter_desc.SubSysId));
+    memcpy(m_identity.cache_uuid.data() + sizeof(adapter_desc.SubSysId), &adapter_desc.Revision, sizeof(adapter_desc.Revision));
+    m_file_path = RHIPipelineCacheFile::GetCacheFilePath("dx12_pipeline_library.bin");
+
+    const RHIPipelineCacheLoadResult load_result = RHIPipelineCacheFile::Load(m_file_path, m_identity, m_library_payload);
+    if (load_result == RHIPipelineCacheLoadResult::LOADED)
+    {
+        // The runtime still rejects blobs of another driver or a damaged library; start over in that case.
+        const HRESULT hr = library_device->CreatePipelineLibrary(m_library_payload.data(), m_library_payload.size(), IID_PPV_ARGS(&m_pipeline_library));
+        if (FAILED(hr))
+        {
+            LOG_FORMAT_FLUSH("[DX12PipelineCache] Discarding pipeline library %s, CreatePipelineLibrary returned 0x%08x.\n",
+                m_file_path.string().c_str(), static_cast<unsigned>(hr));
+            m_pipeline_library.Reset();
+        }
+    }
+    else if (load_result != RHIPipelineCacheLoadResult::MISSING)
+    {
+        LOG_FORMAT_FLUSH("[DX12PipelineCache] Discarding pipeline library %s: %s.\n",
+            m_file_path.string().c_str(), RHIPipelineCacheFile::ToString(load_result));
+    }
+
+    if (!m_pipeline_library)
+    {
+        m_library_payload.clear();
+        const HRESULT hr = library_device->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pipeline_library));
+        if (FAILED(hr))
+        {
+            LOG_FORMAT_FLUSH("[DX12PipelineCache] Pipeline library unsupported (0x%08x), compiling pipelines without cache.\n",
+                static_cast<unsigned>(hr));
+            m_pipeline_library.Reset();
+        }
+    }
+    
+    return true;
+}
+
+bool DX12PipelineCache::Save()
+{
+    if (!m_pipeline_library || !m_dirty)
+    {
+        return true;
+    }
+
+    std::vector<unsigned char> serialized_library(m_pipeline_library->GetSerializedSize());
+    if (FAILED(m_pipeline_library->Serialize(serialized_library.data(), serialized_library.size())))
+    {
+        return false;
+    }
+    
+    if (!RHIPipelineCacheFile::Save(m_file_path, m_identity, serialized_library.data(), serialized_library.size()))
+    {
+        LOG_FORMAT_FLUSH("[DX12PipelineCache] Failed to write pipeline library %s.\n", m_file_path.string().c_str());
+        return false;
+    }
+
+    m_dirty = false;
+    LOG_FORMAT_FLUSH("[DX12PipelineCache] Saved %zu bytes, %u hits and %u misses this run.\n",
+        serialized_library.size(), m_hit_count, m_miss_count);
+    return true;
+}
+
+void DX12PipelineCache::Release()
+{
+    Save();
+    m_pipeline_library.Reset();
+    m_library_payload.clear();
+    m_dirty = false;
+    m_hit_count = 0;
+    m_miss_count = 0;
+}
+
+bool DX12PipelineCache::CreateGraphicsPipelineState(ID3D12Device* device, const std::wstring& name,
+                                                    const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, ComPtr<ID3D12PipelineState>& out_pipeline_state)
+{
+    if (m_pipeline_library)
+    {
+        std::lock_guard lock(m_library_mutex);
+        if (SUCCEEDED(m_pipeline_library->LoadGraphicsPipeline(name.c_str(), &desc, IID_PPV_ARGS(&out_pipeline_state))))
+        {
+            ++m_hit_count;
+            return true;
+        }
+    }
+
+    THROW_IF_FAILED(device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&out_pipeline_state)))
+    StorePipeline(name, out_pipeline_state.Get());
+    return true;
+}
+
+bool DX12PipelineCache::CreateComputePipelineState(ID3D12Device* device, const std::wstring& name,
+                                                   const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, ComPtr<ID3D12PipelineState>& out_pipeline_state)
+{
+    if (m_pipeline_library)
+    {
+        std::lock_guard lock(m_library_mutex);
+        if (SUCCEEDED(m_pipeline_library->LoadComputePipeline(name.c_str(), &desc, IID_PPV_ARGS(&out_pipeline_state))))
+        {
+            ++m_hit_count;
+            return true;
+        }
+    }
+
+    THROW_IF_FAILED(device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&out_pipeline_state)))
+    StorePipeline(name, out_pipeline_state.Get());
+    return true;
+}
+
+void DX12PipelineCache::StorePipeline(const std::wstring& name, ID3D12PipelineState* pipeline_state)
+{
+    if (!m_pipeline_library)
+    {
+        return;
+    }
+
+    std::lock_guard lock(m_library_mutex);
+    ++m_miss_count;
+    // Fails when the name is already taken, e.g. by a stale entry whose description no longer matches.
+    if (SUCCEEDED(m_pipeline_library->StorePipeline(name.c_str(), pipeline_state)))
+    {
+        m_dirty = true;
+    }
+}
@@ -9,6 +9,63 @@
 #include "DX12Utils.h"
 #include "RHIResourceFactoryImpl.hpp"
 
+namespace
+{
+    void AddShaderBytecode(RHIPipelineCacheKeyBuilder& key_builder, const D3D12_SHADER_BYTECODE& bytecode)
+    {
+        key_builder.AddValue(static_cast<unsigned long long>(bytecode.BytecodeLength));
+        key_builder.AddBytes(bytecode.pShaderBytecode, bytecode.BytecodeLength);
+    }
+    
+    // Covers every field InitPipelineStateObject sets. Structs with padding are hashed field by field.
+    std::wstring MakeGraphicsPipelineCacheName(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const DX12RootSignature& root_signature)
+    {
+        RHIPipelineCacheKeyBuilder key_builder;
+        key_builder.AddValue(RHIPipelineType::Graphics);
+        key_builder.AddValue(root_signature.GetSerializedHash());
+        AddShaderBytecode(key_builder, desc.VS);
+        AddShaderBytecode(key_builder, desc.PS);
+        key_builder.AddValue(desc.InputLayout.NumElements);
+        for (unsigned i = 0; i < desc.InputLayout.NumElements; ++i)
+        {
+            const auto& element = desc.InputLayout.pInputElementDescs[i];
+            key_builder.AddString(element.SemanticName);
+            key_builder.AddValue(element.SemanticIndex);
+            key_builder.AddValue(element.Format);
+            key_builder.AddValue(element.InputSlot);
+            key_builder.AddValue(element.AlignedByteOffset);
+            key_builder.AddValue(element.InputSlotClass);
+            key_builder.AddValue(element.InstanceDataStepRate);
+        }
+        key_builder.AddValue(desc.RasterizerState);
+        key_builder.AddValue(desc.DepthStencilState.DepthEnable);
+        key_builder.AddValue(desc.DepthStencilState.DepthWriteMask);
+        key_builder.AddValue(desc.DepthStencilState.DepthFunc);
+        key_builder.AddValue(desc.DepthStencilState.StencilEnable);
+        key_builder.AddValue(desc.SampleMask);
+        key_builder.AddValue(desc.PrimitiveTopologyType);
+        key_builder.AddValue(desc.NumRenderTargets);
+        for (unsigned i = 0; i < desc.NumRenderTargets; ++i)
+        {
+            key_builder.AddValue(desc.RTVFormats[i]);
+        }
+        key_builder.AddValue(desc.DSVFormat);
+        key_builder.AddValue(desc.SampleDesc);
+        key_builder.AddValue(desc.Flags);
+        return key_builder.GetKeyName();
+    }
+
+    std::wstring MakeComputePipelineCacheName(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const DX12RootSignature& root_signature)
+    {
+        RHIPipelineCacheKeyBuilder key_builder;
+        key_builder.AddValue(RHIPipelineType::Compute);
+        key_builder.AddValue(root_signature.GetSerializedHash());
+        AddShaderBytecode(key_builder, desc.CS);
+        key_builder.AddValue(desc.Flags);
+        return key_builder.GetKeyName();
+    }
+}
+
 IDX12PipelineStateObjectCommon::IDX12PipelineStateObjectCommon()
     : m_pipeline_state_object(nullptr)
 {
@@ -39,8 +96,10 @@ bool DX12GraphicsPipelineStateObject::BindRenderTargetFormats(
 bool DX12GraphicsPipelineStateObject::InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature, IRHISwapChain& swap_chain, const std::map<RHIShaderType,
                                                               std::shared_ptr<IRHIShader>>& shaders)
 {
-    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
-    auto* dxRootSignature = dynamic_cast<const DX12RootSignature&>(root_signature).GetRootSignature();
+    auto& dx12_device = dynamic_cast<DX12Device&>(device);
+    auto* dxDevice = dx12_device.GetDevice();
+    const auto& dx12_root_signature = dynamic_cast<const DX12RootSignature&>(root_signature);
+    auto* dxRootSignature = dx12_root_signature.GetRootSignature();
     
     // create input layout
 
@@ -160,7 +219,8 @@ bool DX12GraphicsPipelineStateObject::InitPipelineStateObject(IRHIDevice& device
     } 
     m_graphics_pipeline_state_desc.NumRenderTargets = m_bind_render_target_formats.size();
 
-    THROW_IF_FAILED(dxDevice->CreateGraphicsPipelineState(&m_graphics_pipeline_state_desc, IID_PPV_ARGS(&m_pipeline_state_object)))
+    RETURN_IF_FALSE(dx12_device.GetPipelineCache().CreateGraphicsPipelineState(dxDevice,
+        MakeGraphicsPipelineCacheName(m_graphics_pipeline_state_desc, dx12_root_signature), m_graphics_pipeline_state_desc, m_pipeline_state_object))
     need_release = true;
     
     return true;
@@ -189,8 +249,10 @@ bool DX12ComputePipelineStateObject::InitPipelineStateObject(IRHIDevice& device,
                                                              const IRHIRootSignature& root_signature, IRHISwapChain& swap_chain, const std::map<RHIShaderType, std::shared_ptr<
                                                              IRHIShader>>& shaders)
 {
-    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
-    auto* dxRootSignature = dynamic_cast<const DX12RootSignature&>(root_signature).GetRootSignature();
+    auto& dx12_device = dynamic_cast<DX12Device&>(device);
+    auto* dxDevice = dx12_device.GetDevice();
+    const auto& dx12_root_signature = dynamic_cast<const DX12RootSignature&>(root_signature);
+    auto* dxRootSignature = dx12_root_signature.GetRootSignature();
 
     D3D12_SHADER_BYTECODE compute_shader_bytecode;
     {
@@ -206,7 +268,8 @@ bool DX12ComputePipelineStateObject::InitPipelineStateObject(IRHIDevice& device,
     m_compute_pipeline_state_desc.CachedPSO.pCachedBlob = nullptr;
     m_compute_pipeline_state_desc.CachedPSO.CachedBlobSizeInBytes = 0;
 
-    THROW_IF_FAILED(dxDevice->CreateComputePipelineState(&m_compute_pipeline_state_desc, IID_PPV_ARGS(&m_pipeline_state_object)))
+    RETURN_IF_FALSE(dx12_device.GetPipelineCache().CreateComputePipelineState(dxDevice,
+        MakeComputePipelineCacheName(m_compute_pipeline_state_desc, dx12_root_signature), m_compute_pipeline_state_desc, m_pipeline_state_object))
     need_release = true;
     
     return true;
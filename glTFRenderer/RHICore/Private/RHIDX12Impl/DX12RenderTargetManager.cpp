@@ -37,6 +37,13 @@ std::shared_ptr<IRHITextureDescriptorAllocation> DX12RenderTargetManager::Create
     std::shared_ptr<IRHITextureAllocation> texture_allocation;
     memory_manager.AllocateTextureMemory(device, texture_desc, texture_allocation);
 
+    return CreateRenderTargetFromTexture(device, memory_manager, texture_allocation, format);
+}
+
+std::shared_ptr<IRHITextureDescriptorAllocation> DX12RenderTargetManager::CreateRenderTargetFromTexture(IRHIDevice& device,
+    IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format)
+{
+    const RHITextureDesc& texture_desc = texture_allocation->m_texture->GetTextureDesc();
     format = format == RHIDataFormat::UNKNOWN ? texture_desc.GetDataFormat() : format;
     
     return CreateRenderTargetWithResource(device,
@@ -261,6 +261,7 @@ bool DX12RootSignature::InitRootSignature(IRHIDevice& device, IRHIDescriptorMana
     
     auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
     THROW_IF_FAILED(dxDevice->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&m_root_signature)))
+    m_serialized_hash = RHIPipelineCacheKeyBuilder::Hash(signature->GetBufferPointer(), signature->GetBufferSize());
 
     need_release = true;
     
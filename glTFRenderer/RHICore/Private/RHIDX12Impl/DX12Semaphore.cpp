@@ -0,0 +1,40 @@
+#include "DX12Semaphore.h"
+
+#include "DX12Device.h"
+#include "DX12Utils.h"
+
+bool DX12Semaphore::InitSemaphore(IRHIDevice& device)
+{
+    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+    THROW_IF_FAILED(dxDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)))
+    m_signal_value = 0;
+
+    need_release = true;
+    
+    return true;
+}
+
+bool DX12Semaphore::Release(IRHIMemoryManager& memory_manager)
+{
+    SAFE_RELEASE(m_fence)
+    m_signal_value = 0;
+    
+    return true;
+}
+
+bool DX12Semaphore::SignalOnQueue(ID3D12CommandQueue& command_queue)
+{
+    THROW_IF_FAILED(command_queue.Signal(m_fence.Get(), ++m_signal_value))
+    return true;
+}
+
+bool DX12Semaphore::WaitOnQueue(ID3D12CommandQueue& command_queue) const
+{
+    if (m_signal_value == 0)
+    {
+        return true;
+    }
+    
+    THROW_IF_FAILED(command_queue.Wait(m_fence.Get(), m_signal_value))
+    return true;
+}
@@ -26,50 +26,90 @@ bool DX12Texture::InitFromExternalResource(ID3D12Resource* raw_resource, const R
     return true;
 }
 
-bool DX12Texture::CreateTexture(IRHIDevice& device, const RHITextureDesc& desc)
+namespace
 {
-    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+    unsigned GetMipCount(const RHITextureDesc& desc)
+    {
+        const bool contains_mipmap = desc.GetUsage() & RUF_CONTAINS_MIPMAP;
+        return contains_mipmap ? static_cast<uint32_t>(std::floor(std::log2(std::max(desc.GetTextureWidth(), desc.GetTextureHeight())))) + 1 : 1;
+    }
 
-    m_texture_desc = desc;
-    const bool contains_mipmap = desc.GetUsage() & RUF_CONTAINS_MIPMAP;
-    unsigned mip_count = contains_mipmap ? static_cast<uint32_t>(std::floor(std::log2(std::max(desc.GetTextureWidth(), desc.GetTextureHeight())))) + 1 : 1;
-    auto format = DX12ConverterUtils::ConvertToDXGIFormat(desc.GetDataFormat());
-    
-    const CD3DX12_HEAP_PROPERTIES heap_properties(D3D12_HEAP_TYPE_DEFAULT);
-    CD3DX12_RESOURCE_DESC heap_resource_desc = CD3DX12_RESOURCE_DESC::Tex2D(format, desc.GetTextureWidth(), desc.GetTextureHeight(),  1, mip_count);
-    heap_resource_desc.Flags = DX12ConverterUtils::ConvertToResourceFlags(desc.GetUsage());
-    
-    RHIResourceStateType final_state = RHIResourceStateType::STATE_COMMON;
-    bool need_clear = desc.GetUsage() & RUF_ALLOW_CLEAR;
-    D3D12_CLEAR_VALUE clear_value = {};
-    if (need_clear)
+    // Null when the texture does not allow clears.
+    const D3D12_CLEAR_VALUE* GetOptimizedClearValue(const RHITextureDesc& desc, D3D12_CLEAR_VALUE& out_clear_value)
     {
-        clear_value.Format = DX12ConverterUtils::ConvertToDXGIFormat(desc.GetClearValue().clear_format);
+        if (!(desc.GetUsage() & RUF_ALLOW_CLEAR))
+        {
+            return nullptr;
+        }
+        
+        out_clear_value = {};
+        out_clear_value.Format = DX12ConverterUtils::ConvertToDXGIFormat(desc.GetClearValue().clear_format);
         if (IsDepthStencilFormat(desc.GetClearValue().clear_format))
         {
-            clear_value.DepthStencil.Depth = desc.GetClearValue().clear_depth_stencil.clear_depth;
-            clear_value.DepthStencil.Stencil = desc.GetClearValue().clear_depth_stencil.clear_stencil_value;
+            out_clear_value.DepthStencil.Depth = desc.GetClearValue().clear_depth_stencil.clear_depth;
+            out_clear_value.DepthStencil.Stencil = desc.GetClearValue().clear_depth_stencil.clear_stencil_value;
         }
         else
         {
-            memcpy(clear_value.Color, desc.GetClearValue().clear_color, sizeof(clear_value.Color));
-        }    
+            memcpy(out_clear_value.Color, desc.GetClearValue().clear_color, sizeof(out_clear_value.Color));
+        }
+        return &out_clear_value;
     }
+}
+
+D3D12_RESOURCE_DESC DX12Texture::GetResourceDesc(const RHITextureDesc& desc)
+{
+    auto format = DX12ConverterUtils::ConvertToDXGIFormat(desc.GetDataFormat());
+    CD3DX12_RESOURCE_DESC resource_desc = CD3DX12_RESOURCE_DESC::Tex2D(format, desc.GetTextureWidth(), desc.GetTextureHeight(),  1, GetMipCount(desc));
+    resource_desc.Flags = DX12ConverterUtils::ConvertToResourceFlags(desc.GetUsage());
+    return resource_desc;
+}
+
+bool DX12Texture::CreateTexture(IRHIDevice& device, const RHITextureDesc& desc)
+{
+    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+
+    const CD3DX12_HEAP_PROPERTIES heap_properties(D3D12_HEAP_TYPE_DEFAULT);
+    const D3D12_RESOURCE_DESC heap_resource_desc = GetResourceDesc(desc);
+    D3D12_CLEAR_VALUE clear_value = {};
     
-    const D3D12_RESOURCE_STATES state = DX12ConverterUtils::ConvertToResourceState(final_state);
+    const D3D12_RESOURCE_STATES state = DX12ConverterUtils::ConvertToResourceState(RHIResourceStateType::STATE_COMMON);
     THROW_IF_FAILED(dxDevice->CreateCommittedResource(
             &heap_properties, // this heap will be used to upload the constant buffer data
             D3D12_HEAP_FLAG_NONE, // no flags
             &heap_resource_desc, // size of the resource heap. Must be a multiple of 64KB for single-textures and constant buffers
             state, // will be data that is read from so we keep it in the generic read state
-            need_clear ? &clear_value : nullptr, // we do not have use an optimized clear value for constant buffers
+            GetOptimizedClearValue(desc, clear_value), // we do not have use an optimized clear value for constant buffers
             IID_PPV_ARGS(&m_buffer)))
+
+    return FinishCreateTexture(dxDevice, desc);
+}
+
+bool DX12Texture::CreatePlacedTexture(IRHIDevice& device, ID3D12Heap* heap, unsigned long long offset, const RHITextureDesc& desc)
+{
+    auto* dxDevice = dynamic_cast<DX12Device&>(device).GetDevice();
+
+    const D3D12_RESOURCE_DESC resource_desc = GetResourceDesc(desc);
+    D3D12_CLEAR_VALUE clear_value = {};
+    const D3D12_RESOURCE_STATES state = DX12ConverterUtils::ConvertToResourceState(RHIResourceStateType::STATE_COMMON);
+    THROW_IF_FAILED(dxDevice->CreatePlacedResource(heap, offset, &resource_desc, state,
+        GetOptimizedClearValue(desc, clear_value), IID_PPV_ARGS(&m_buffer)))
+    m_placed_heap = heap;
+
+    return FinishCreateTexture(dxDevice, desc);
+}
+
+bool DX12Texture::FinishCreateTexture(ID3D12Device* device, const RHITextureDesc& desc)
+{
+    m_texture_desc = desc;
     m_buffer->SetName(to_wide_string(desc.GetName()).c_str());
 
+    const D3D12_RESOURCE_DESC resource_desc = m_buffer->GetDesc();
+    const unsigned mip_count = resource_desc.MipLevels;
     m_copy_requirements.row_byte_size.resize(mip_count);
     m_copy_requirements.row_pitch.resize(mip_count);
     std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints; footprints.resize(mip_count); 
-    dxDevice->GetCopyableFootprints(&heap_resource_desc, 0, mip_count, 0, footprints.data(), nullptr, m_copy_requirements.row_byte_size.data(), &m_copy_requirements.total_size);
+    device->GetCopyableFootprints(&resource_desc, 0, mip_count, 0, footprints.data(), nullptr, m_copy_requirements.row_byte_size.data(), &m_copy_requirements.total_size);
     for (uint32_t i = 0; i < footprints.size(); ++i)
     {
         m_copy_requirements.row_pitch[i] = footprints[i].Footprint.RowPitch;
@@ -83,5 +123,6 @@ bool DX12Texture::Release(IRHIMemoryManager& memory_manager)
     dynamic_cast<DX12DescriptorManager&>(memory_manager.GetDescriptorManager()).InvalidateResourceDescriptors(
         m_buffer.Get());
     SAFE_RELEASE(m_buffer);
+    SAFE_RELEASE(m_placed_heap);
     return true;
 }
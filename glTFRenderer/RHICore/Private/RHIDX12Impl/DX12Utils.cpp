@@ -7,6 +7,7 @@
 #include <d3d12shader.h>
 #include <dxcapi.h>
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 
 #include "d3dx12.h"
@@ -22,6 +23,7 @@
 #include "DX12IndexBufferView.h"
 #include "DX12PipelineStateObject.h"
 #include "DX12RootSignature.h"
+#include "DX12Semaphore.h"
 #include "DX12ShaderTable.h"
 #include "DX12SwapChain.h"
 #include "DX12Texture.h"
@@ -255,11 +257,27 @@ bool DX12Utils::ExecuteCommandList(IRHICommandList& command_list, IRHICommandQue
     auto* dx_command_list = dynamic_cast<DX12CommandList&>(command_list).GetCommandList();
     auto* dx_command_queue = dynamic_cast<DX12CommandQueue&>(command_queue).GetCommandQueue();
     auto& fence = dynamic_cast<DX12CommandList&>(command_list).GetFence();
+
+    // Swap chain semaphores are placeholders on DX12 and are skipped.
+    for (const auto& wait_info : context.wait_infos)
+    {
+        if (const auto* semaphore = dynamic_cast<const DX12Semaphore*>(wait_info.m_wait_semaphore))
+        {
+            semaphore->WaitOnQueue(*dx_command_queue);
+        }
+    }
     
     ID3D12CommandList* ppCommandLists[] = { dx_command_list };
     dx_command_queue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
 
     dynamic_cast<DX12Fence&>(fence).SignalWhenCommandQueueFinish(command_queue);
+    for (auto* sign_semaphore : context.sign_semaphores)
+    {
+        if (auto* semaphore = dynamic_cast<DX12Semaphore*>(sign_semaphore))
+        {
+            semaphore->SignalOnQueue(*dx_command_queue);
+        }
+    }
     
     return true;
 }
@@ -580,6 +598,57 @@ bool DX12Utils::AddTextureBarrierToCommandList(IRHICommandList& command_list, IR
     return true;
 }
 
+bool DX12Utils::AddBarriersToCommandList(IRHICommandList& command_list,
+                                         const std::vector<RHITextureBarrierDesc>& texture_barriers,
+                                         const std::vector<RHIBufferBarrierDesc>& buffer_barriers)
+{
+    const auto convert_split_flag = [](RHIBarrierSplitType split_type)
+    {
+        switch (split_type)
+        {
+        case RHIBarrierSplitType::BEGIN_ONLY:
+            return D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+        case RHIBarrierSplitType::END_ONLY:
+            return D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+        case RHIBarrierSplitType::NONE:
+            break;
+        }
+        return D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    };
+
+    std::vector<CD3DX12_RESOURCE_BARRIER> barriers;
+    barriers.reserve(texture_barriers.size() + buffer_barriers.size());
+    for (const auto& texture_barrier : texture_barriers)
+    {
+        GLTF_CHECK(texture_barrier.texture);
+        auto* dx_texture = dynamic_cast<DX12Texture&>(*texture_barrier.texture).GetRawResource();
+        barriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(dx_texture,
+            DX12ConverterUtils::ConvertToResourceState(texture_barrier.before_state),
+            DX12ConverterUtils::ConvertToResourceState(texture_barrier.after_state),
+            D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+            convert_split_flag(texture_barrier.split_type)));
+    }
+    for (const auto& buffer_barrier : buffer_barriers)
+    {
+        GLTF_CHECK(buffer_barrier.buffer);
+        auto* dx_buffer = dynamic_cast<const DX12Buffer&>(*buffer_barrier.buffer).GetRawBuffer();
+        barriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(dx_buffer,
+            DX12ConverterUtils::ConvertToResourceState(buffer_barrier.before_state),
+            DX12ConverterUtils::ConvertToResourceState(buffer_barrier.after_state),
+            D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+            convert_split_flag(buffer_barrier.split_type)));
+    }
+
+    if (barriers.empty())
+    {
+        return true;
+    }
+
+    auto* dxCommandList = dynamic_cast<DX12CommandList&>(command_list).GetCommandList();
+    dxCommandList->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
+    return true;
+}
+
 bool DX12Utils::AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture)
 {
     auto* dxCommandList = dynamic_cast<DX12CommandList&>(command_list).GetCommandList();
@@ -591,6 +660,18 @@ bool DX12Utils::AddUAVBarrier(IRHICommandList& command_list, IRHITexture& textur
     return true;
 }
 
+bool DX12Utils::AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture)
+{
+    auto* dxCommandList = dynamic_cast<DX12CommandList&>(command_list).GetCommandList();
+    auto* before_resource = before_texture ? dynamic_cast<DX12Texture&>(*before_texture).GetRawResource() : nullptr;
+    auto* after_resource = dynamic_cast<DX12Texture&>(after_texture).GetRawResource();
+
+    CD3DX12_RESOURCE_BARRIER aliasing_barrier = CD3DX12_RESOURCE_BARRIER::Aliasing(before_resource, after_resource);
+    dxCommandList->ResourceBarrier(1, &aliasing_barrier);
+
+    return true;
+}
+
 bool DX12Utils::DrawInstanced(IRHICommandList& command_list, unsigned vertex_count_per_instance, unsigned instance_count,
                               unsigned start_vertex_location, unsigned start_instance_location)
 {
@@ -964,6 +1045,35 @@ bool DX12Utils::IsTimestampProfilerSupported() const
     return m_timestamp_profiler_state && m_timestamp_profiler_state->supported;
 }
 
+bool DX12Utils::CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms)
+{
+    auto* dx12_command_queue = dynamic_cast<DX12CommandQueue&>(command_queue).GetCommandQueue();
+    LARGE_INTEGER qpc_frequency{};
+    UINT64 gpu_tick = 0;
+    UINT64 calibration_qpc = 0;
+    if (!dx12_command_queue ||
+        !QueryPerformanceFrequency(&qpc_frequency) ||
+        FAILED(dx12_command_queue->GetClockCalibration(&gpu_tick, &calibration_qpc)))
+    {
+        return false;
+    }
+
+    // The calibration reports the CPU side as a QPC value; carry it over to steady_clock through a QPC
+    // sample taken next to steady_clock::now().
+    LARGE_INTEGER now_qpc{};
+    QueryPerformanceCounter(&now_qpc);
+    const double now_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    const double qpc_delta = static_cast<double>(static_cast<long long>(calibration_qpc) - now_qpc.QuadPart);
+    out_gpu_tick = gpu_tick;
+    out_cpu_time_ms = now_ms + qpc_delta * 1000.0 / static_cast<double>(qpc_frequency.QuadPart);
+    return true;
+}
+
+bool DX12Utils::SupportAsyncCompute(IRHIDevice& device)
+{
+    return true;
+}
+
 unsigned DX12Utils::GetAlignmentSizeForUAVCount(unsigned size)
 {
     const UINT alignment = D3D12_UAV_COUNTER_PLACEMENT_ALIGNMENT;
@@ -0,0 +1,162 @@
+#include "RHIDescriptorIndexAllocator.h"
+
+#include "RendererCommon.h"
+#include <algorithm>
+#include <iterator>
+
+void RHIDescriptorIndexAllocator::Init(unsigned capacity)
+{
+    m_capacity = capacity;
+    Reset();
+}
+
+void RHIDescriptorIndexAllocator::Reset()
+{
+    m_allocated_count = 0;
+    m_pending_free_count = 0;
+    m_high_water_mark = 0;
+    m_free_ranges.clear();
+    m_pending_frees.clear();
+    if (m_capacity > 0)
+    {
+        m_free_ranges.emplace(0u, m_capacity);
+    }
+}
+
+bool RHIDescriptorIndexAllocator::Allocate(unsigned count, unsigned& out_index)
+{
+    out_index = INVALID_INDEX;
+    if (count == 0)
+    {
+        return false;
+    }
+
+    for (auto it = m_free_ranges.begin(); it != m_free_ranges.end(); ++it)
+    {
+        const auto [range_index, range_count] = *it;
+        if (range_count < count)
+        {
+            continue;
+        }
+
+        m_free_ranges.erase(it);
+        if (range_count > count)
+        {
+            m_free_ranges.emplace(range_index + count, range_count - count);
+        }
+        out_index = range_index;
+        m_allocated_count += count;
+        m_high_water_mark = (std::max)(m_high_water_mark, range_index + count);
+        return true;
+    }
+    return false;
+}
+
+bool RHIDescriptorIndexAllocator::Free(unsigned index, unsigned count, unsigned long long frame_index)
+{
+    if (count == 0)
+    {
+        return true;
+    }
+    if (index >= m_capacity || count > m_capacity - index || count > m_allocated_count)
+    {
+        LOG_FORMAT_FLUSH("[RHIDescriptorIndexAllocator][Error] Rejected free of [%u, %u) (capacity=%u, allocated=%u).\n",
+            index, index + count, m_capacity, m_allocated_count);
+        return false;
+    }
+    if (OverlapsFreeRange(index, count) || OverlapsPendingFree(index, count))
+    {
+        LOG_FORMAT_FLUSH("[RHIDescriptorIndexAllocator][Error] Rejected double free of [%u, %u).\n", index, index + count);
+        return false;
+    }
+
+    m_allocated_count -= count;
+    m_pending_free_count += count;
+    m_pending_frees.push_back({index, count, frame_index});
+    return true;
+}
+
+void RHIDescriptorIndexAllocator::ReclaimCompletedFrames(unsigned long long completed_frame_index)
+{
+    // A range freed out of frame order waits for the ones queued before it, which only delays its reuse.
+    while (!m_pending_frees.empty() && m_pending_frees.front().frame_index <= completed_frame_index)
+    {
+        const auto pending_free = m_pending_frees.front();
+        m_pending_frees.pop_front();
+        m_pending_free_count -= pending_free.count;
+        InsertFreeRange(pending_free.index, pending_free.count);
+    }
+}
+
+void RHIDescriptorIndexAllocator::ReclaimAll()
+{
+    for (const auto& pending_free : m_pending_frees)
+    {
+        InsertFreeRange(pending_free.index, pending_free.count);
+    }
+    m_pending_frees.clear();
+    m_pending_free_count = 0;
+}
+
+unsigned RHIDescriptorIndexAllocator::GetLargestFreeRange() const
+{
+    unsigned largest_range = 0;
+    for (const auto& [range_index, range_count] : m_free_ranges)
+    {
+        largest_range = (std::max)(largest_range, range_count);
+    }
+    return largest_range;
+}
+
+bool RHIDescriptorIndexAllocator::OverlapsFreeRange(unsigned index, unsigned count) const
+{
+    const auto next = m_free_ranges.lower_bound(index);
+    if (next != m_free_ranges.end() && next->first < index + count)
+    {
+        return true;
+    }
+    if (next != m_free_ranges.begin())
+    {
+        const auto previous = std::prev(next);
+        return previous->first + previous->second > index;
+    }
+    return false;
+}
+
+bool RHIDescriptorIndexAllocator::OverlapsPendingFree(unsigned index, unsigned count) const
+{
+    return std::any_of(m_pending_frees.begin(), m_pending_frees.end(), [index, count](const PendingFree& pending_free)
+    {
+        return pending_free.index < index + count && index < pending_free.index + pending_free.count;
+    });
+}
+
+bool RHIDescriptorIndexAllocator::InsertFreeRange(unsigned index, unsigned count)
+{
+    if (OverlapsFreeRange(index, count))
+    {
+        // Dropping the range leaks its indices, which is safer than handing them out twice.
+        LOG_FORMAT_FLUSH("[RHIDescriptorIndexAllocator][Error] Rejected free range [%u, %u) overlapping a free range.\n",
+            index, index + count);
+        return false;
+    }
+
+    auto next = m_free_ranges.lower_bound(index);
+    if (next != m_free_ranges.begin())
+    {
+        const auto previous = std::prev(next);
+        if (previous->first + previous->second == index)
+        {
+            index = previous->first;
+            count += previous->second;
+            m_free_ranges.erase(previous);
+        }
+    }
+    if (next != m_free_ranges.end() && index + count == next->first)
+    {
+        count += next->second;
+        m_free_ranges.erase(next);
+    }
+    m_free_ranges.emplace(index, count);
+    return true;
+}
@@ -3,7 +3,7 @@
 
 bool IRHIBuffer::Transition(IRHICommandList& command_list, RHIResourceStateType new_state)
 {
-    if (m_current_state == new_state)
+    if (m_current_state == new_state || command_list.IsExternalResourceStateTracking())
     {
         return true;
     }
@@ -19,6 +19,11 @@ RHIResourceStateType IRHIBuffer::GetState() const
     return m_current_state;
 }
 
+void IRHIBuffer::SetState(RHIResourceStateType state)
+{
+    m_current_state = state;
+}
+
 bool IRHIBuffer::Release(IRHIMemoryManager& memory_manager)
 {
     // release buffer in IRHIBufferAllocation class
@@ -34,3 +34,13 @@ unsigned IRHICommandList::GetFrameSlotIndex() const
 {
     return m_frame_slot_index;
 }
+
+void IRHICommandList::SetExternalResourceStateTracking(bool enable)
+{
+    m_external_resource_state_tracking = enable;
+}
+
+bool IRHICommandList::IsExternalResourceStateTracking() const
+{
+    return m_external_resource_state_tracking;
+}
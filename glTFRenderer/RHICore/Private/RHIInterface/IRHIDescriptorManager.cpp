@@ -20,6 +20,53 @@ bool IRHIDescriptorTable::Release(IRHIMemoryManager& memory_manager)
     return true;
 }
 
+bool IRHIDescriptorManager::RegisterBindlessTexture(IRHIDevice& device,
+    const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation, unsigned& out_bindless_index)
+{
+    out_bindless_index = RHIDescriptorIndexAllocator::INVALID_INDEX;
+    if (!m_bindless_texture_table || !descriptor_allocation || descriptor_allocation->GetDesc().m_view_type != RHIViewType::RVT_SRV)
+    {
+        LOG_FORMAT_FLUSH("[DescriptorManager][Error] Bindless textures take shader resource views only.\n");
+        return false;
+    }
+
+    unsigned bindless_index = 0;
+    if (!m_bindless_texture_indices.Allocate(1, bindless_index))
+    {
+        LOG_FORMAT_FLUSH("[DescriptorManager][Error] Out of bindless texture indices (allocated=%u, pending_free=%u, capacity=%u).\n",
+            m_bindless_texture_indices.GetAllocatedCount(),
+            m_bindless_texture_indices.GetPendingFreeCount(),
+            m_bindless_texture_indices.GetCapacity());
+        return false;
+    }
+    if (!WriteBindlessTexture(device, bindless_index, descriptor_allocation))
+    {
+        m_bindless_texture_indices.Free(bindless_index, 1, m_frame_index);
+        return false;
+    }
+
+    out_bindless_index = bindless_index;
+    return true;
+}
+
+bool IRHIDescriptorManager::UnregisterBindlessTexture(unsigned bindless_index)
+{
+    RETURN_IF_FALSE(m_bindless_texture_indices.Free(bindless_index, 1, m_frame_index))
+    ClearBindlessTexture(bindless_index);
+    return true;
+}
+
+std::shared_ptr<IRHIDescriptorTable> IRHIDescriptorManager::GetBindlessTextureTable() const
+{
+    return m_bindless_texture_table;
+}
+
+void IRHIDescriptorManager::InitBindlessTextureTable(std::shared_ptr<IRHIDescriptorTable> bindless_texture_table)
+{
+    m_bindless_texture_table = std::move(bindless_texture_table);
+    m_bindless_texture_indices.Init(MAX_BINDLESS_TEXTURE_COUNT);
+}
+
 void IRHIDescriptorManager::SetFrameSlotCount(unsigned frame_slot_count)
 {
     m_frame_slot_count = frame_slot_count > 0 ? frame_slot_count : 1u;
@@ -29,3 +76,12 @@ unsigned IRHIDescriptorManager::GetFrameSlotCount() const
 {
     return m_frame_slot_count;
 }
+
+void IRHIDescriptorManager::BeginFrame(unsigned long long frame_index)
+{
+    m_frame_index = frame_index;
+    if (frame_index >= m_frame_slot_count)
+    {
+        m_bindless_texture_indices.ReclaimCompletedFrames(frame_index - m_frame_slot_count);
+    }
+}
@@ -210,7 +210,22 @@ bool IRHIMemoryManager::UploadBufferData(IRHIDevice& device, IRHICommandList& co
                                          const void* data, size_t dst_offset, size_t size)
 {
     bool result = false;
-    if (buffer_allocation.m_buffer->GetBufferDesc().type == RHIBufferType::Default)
+    const auto& dst_buffer_desc = buffer_allocation.m_buffer->GetBufferDesc();
+    if (dst_buffer_desc.type == RHIBufferType::Default &&
+        dst_buffer_desc.resource_type == RHIBufferResourceType::Buffer &&
+        size <= UPLOAD_RING_MAX_ALLOCATION_SIZE)
+    {
+        std::shared_ptr<IRHIBufferAllocation> ring_chunk_buffer = nullptr;
+        size_t ring_offset = 0;
+        bool allocated = AllocateUploadRingMemory(device, command_list, size, ring_chunk_buffer, ring_offset);
+        GLTF_CHECK(allocated);
+
+        result = UploadBufferDataInner(*ring_chunk_buffer, data, ring_offset, size);
+        GLTF_CHECK(result);
+
+        result = RHIUtilInstanceManager::Instance().CopyBuffer(command_list, *buffer_allocation.m_buffer, dst_offset, *ring_chunk_buffer->m_buffer, ring_offset, size);
+    }
+    else if (dst_buffer_desc.type == RHIBufferType::Default)
     {
         const RHIBufferDesc upload_desc = MakeTempUploadBufferDesc(buffer_allocation.m_buffer->GetBufferDesc(), size);
         std::shared_ptr<IRHIBufferAllocation> upload_buffer = nullptr;
@@ -254,8 +269,12 @@ bool IRHIMemoryManager::AllocateTextureMemoryAndUpload(IRHIDevice& device,
 bool IRHIMemoryManager::ReleaseAllResource()
 {
     m_texture_allocations.clear();
+    m_heap_allocations.clear();
     m_buffer_allocations.clear();
     m_temp_buffer_pool.Clear();
+    m_upload_ring.Reset();
+    m_upload_ring_chunks.clear();
+    m_upload_ring_fences.clear();
     return true;
 }
 
@@ -275,6 +294,8 @@ void IRHIMemoryManager::TickFrame()
             expired_temp_buffer->Release(*this);
         }
     }
+
+    TickUploadRing();
 }
 
 void IRHIMemoryManager::TrackTempUploadBufferUsage(IRHICommandList& command_list, const std::shared_ptr<IRHIBufferAllocation>& upload_buffer)
@@ -312,3 +333,95 @@ bool IRHIMemoryManager::AllocateTempUploadBufferMemory(IRHIDevice& device, const
 
     return true;
 }
+
+bool IRHIMemoryManager::AllocateUploadRingMemory(IRHIDevice& device, IRHICommandList& command_list, size_t size,
+    std::shared_ptr<IRHIBufferAllocation>& out_chunk_buffer, size_t& out_offset)
+{
+    RHIUploadRingAllocator::RetireTag retire_tag{};
+    if (const auto fence = command_list.GetFenceSharedPtr())
+    {
+        retire_tag.source = GetUploadRingFenceSource(fence);
+        retire_tag.value = fence->PredictNextSignalValue();
+    }
+
+    RHIUploadRingAllocator::Allocation allocation{};
+    if (!m_upload_ring.Allocate(size, UPLOAD_RING_ALLOCATION_ALIGNMENT, retire_tag, allocation))
+    {
+        ReclaimUploadRing();
+        if (!m_upload_ring.Allocate(size, UPLOAD_RING_ALLOCATION_ALIGNMENT, retire_tag, allocation))
+        {
+            RETURN_IF_FALSE(AddUploadRingChunk(device, size))
+            RETURN_IF_FALSE(m_upload_ring.Allocate(size, UPLOAD_RING_ALLOCATION_ALIGNMENT, retire_tag, allocation))
+        }
+    }
+
+    out_chunk_buffer = m_upload_ring_chunks.at(allocation.chunk_id);
+    out_offset = allocation.offset;
+    return true;
+}
+
+bool IRHIMemoryManager::AddUploadRingChunk(IRHIDevice& device, size_t min_size)
+{
+    // Grow geometrically so a frame that overflows settles on one chunk after a few frames.
+    size_t chunk_size = m_upload_ring.HasActiveChunk() ?
+        m_upload_ring.GetActiveChunkCapacity() * 2 : static_cast<size_t>(UPLOAD_RING_INITIAL_CHUNK_SIZE);
+    chunk_size = (std::max)(chunk_size, min_size);
+
+    RHIBufferDesc chunk_desc{};
+    chunk_desc.name = L"UploadRingChunk";
+    chunk_desc.width = chunk_size;
+    chunk_desc.height = 1;
+    chunk_desc.depth = 1;
+    chunk_desc.type = RHIBufferType::Upload;
+    chunk_desc.resource_type = RHIBufferResourceType::Buffer;
+    chunk_desc.state = RHIResourceStateType::STATE_COPY_SOURCE;
+    chunk_desc.usage = RUF_TRANSFER_SRC;
+    chunk_desc.alignment = 0;
+
+    std::shared_ptr<IRHIBufferAllocation> chunk_buffer = nullptr;
+    RETURN_IF_FALSE(AllocateBufferMemory(device, chunk_desc, chunk_buffer))
+
+    const unsigned chunk_id = m_upload_ring.AddChunk(chunk_size);
+    m_upload_ring_chunks[chunk_id] = chunk_buffer;
+    return true;
+}
+
+void IRHIMemoryManager::ReclaimUploadRing()
+{
+    m_upload_ring.Reclaim([this](const RHIUploadRingAllocator::RetireTag& tag)
+    {
+        return m_upload_ring_fences[tag.source]->IsSignalValueCompleted(tag.value);
+    });
+}
+
+void IRHIMemoryManager::TickUploadRing()
+{
+    ReclaimUploadRing();
+
+    std::vector<unsigned> drained_chunk_ids;
+    m_upload_ring.CollectDrainedChunks(drained_chunk_ids);
+    for (const unsigned chunk_id : drained_chunk_ids)
+    {
+        const auto chunk_it = m_upload_ring_chunks.find(chunk_id);
+        if (chunk_it == m_upload_ring_chunks.end())
+        {
+            continue;
+        }
+        chunk_it->second->Release(*this);
+        m_upload_ring_chunks.erase(chunk_it);
+    }
+}
+
+unsigned IRHIMemoryManager::GetUploadRingFenceSource(const std::shared_ptr<IRHIFence>& fence)
+{
+    for (unsigned source = 0; source < m_upload_ring_fences.size(); ++source)
+    {
+        if (m_upload_ring_fences[source] == fence)
+        {
+            return source;
+        }
+    }
+
+    m_upload_ring_fences.push_back(fence);
+    return static_cast<unsigned>(m_upload_ring_fences.size() - 1);
+}
@@ -15,7 +15,7 @@ RHIDataFormat IRHITexture::GetTextureFormat() const
 
 bool IRHITexture::Transition(IRHICommandList& command_list, RHIResourceStateType new_state)
 {
-    if (m_current_state == new_state)
+    if (m_current_state == new_state || command_list.IsExternalResourceStateTracking())
     {
         return true;
     }
@@ -31,6 +31,11 @@ RHIResourceStateType IRHITexture::GetState() const
     return m_current_state;
 }
 
+void IRHITexture::SetState(RHIResourceStateType state)
+{
+    m_current_state = state;
+}
+
 bool IRHITexture::CanReadBack() const
 {
     return m_texture_desc.HasUsage(RHIResourceUsageFlags::RUF_READBACK);
@@ -29,7 +29,7 @@ void RootSignatureAllocation::AddShaderDefine(RHIShaderPreDefineMacros& out_shad
     }
 
     memset(shader_resource_declaration, 0, sizeof(shader_resource_declaration));
-    if (RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12)
+    if (RHIConfigSingleton::Instance().GetGraphicsAPIType() != RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan)
     {
         (void)snprintf(shader_resource_declaration, sizeof(shader_resource_declaration), "register(%s%d, space%u)", register_name.c_str(), register_begin_index, space);    
     }
@@ -0,0 +1,39 @@
+#include "NullBuffer.h"
+
+#include <cstring>
+
+bool NullBuffer::CreateBuffer(const RHIBufferDesc& desc)
+{
+    m_buffer_desc = desc;
+    if (desc.type != RHIBufferType::Default)
+    {
+        m_host_data.resize(desc.width);
+    }
+    
+    return true;
+}
+
+bool NullBuffer::UploadBufferFromCPU(const void* data, size_t dst_offset, size_t size)
+{
+    GLTF_CHECK(m_buffer_desc.type == RHIBufferType::Upload);
+    if (dst_offset + size > m_host_data.size())
+    {
+        LOG_FORMAT_FLUSH("[NullRHI][Validation] Upload of %zu bytes at offset %zu overflows buffer %s\n", size, dst_offset, GetName().c_str());
+        return false;
+    }
+    
+    memcpy(m_host_data.data() + dst_offset, data, size);
+    return true;
+}
+
+bool NullBuffer::DownloadBufferToCPU(void* data, size_t size) const
+{
+    if (size > m_host_data.size())
+    {
+        LOG_FORMAT_FLUSH("[NullRHI][Validation] Readback of %zu bytes overflows buffer %s\n", size, GetName().c_str());
+        return false;
+    }
+    
+    memcpy(data, m_host_data.data(), size);
+    return true;
+}
@@ -0,0 +1,13 @@
+#include "NullCommandAllocator.h"
+
+bool NullCommandAllocator::InitCommandAllocator(IRHIDevice& device, RHICommandAllocatorType type)
+{
+    m_type = type;
+    need_release = true;
+    return true;
+}
+
+bool NullCommandAllocator::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
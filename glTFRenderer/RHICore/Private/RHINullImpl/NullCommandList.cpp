@@ -0,0 +1,68 @@
+#include "NullCommandList.h"
+
+#include <cstring>
+
+#include "RHIResourceFactoryImpl.hpp"
+#include "RHIInterface/IRHIFence.h"
+
+bool NullCommandList::InitCommandList(IRHIDevice& device, IRHICommandAllocator& command_allocator)
+{
+    m_fence = RHIResourceFactory::CreateRHIResource<IRHIFence>();
+    m_fence->InitFence(device);
+
+    m_finished_semaphore = RHIResourceFactory::CreateRHIResource<IRHISemaphore>();
+    m_finished_semaphore->InitSemaphore(device);
+    
+    need_release = true;
+    
+    return true;
+}
+
+bool NullCommandList::WaitCommandList()
+{
+    m_fence->HostWaitUtilSignaled();
+    m_fence->ResetFence();
+    return true;
+}
+
+bool NullCommandList::BeginRecordCommandList()
+{
+    // Commands of the previous submission stay readable until recording starts again.
+    m_commands.clear();
+    memset(m_command_counts, 0, sizeof(m_command_counts));
+    SetState(RHICommandListState::Recording);
+    
+    return true;
+}
+
+bool NullCommandList::EndRecordCommandList()
+{
+    SetState(RHICommandListState::Closed);
+    
+    return true;
+}
+
+bool NullCommandList::Release(IRHIMemoryManager& memory_manager)
+{
+    m_commands.clear();
+    return true;
+}
+
+bool NullCommandList::RecordCommand(const RHINullCommand& command)
+{
+    if (GetState() != RHICommandListState::Recording)
+    {
+        LOG_FORMAT_FLUSH("[NullRHI][Validation] Command %u recorded into closed command list %s\n",
+            static_cast<unsigned>(command.type), GetName().c_str());
+        return false;
+    }
+
+    m_commands.push_back(command);
+    ++m_command_counts[static_cast<unsigned>(command.type)];
+    return true;
+}
+
+unsigned NullCommandList::GetRecordedCommandCount(RHINullCommandType type) const
+{
+    return m_command_counts[static_cast<unsigned>(type)];
+}
@@ -0,0 +1,19 @@
+#include "NullCommandQueue.h"
+
+bool NullCommandQueue::InitCommandQueue(IRHIDevice& device, RHICommandQueueType type)
+{
+    m_type = type;
+    need_release = true;
+    return true;
+}
+
+bool NullCommandQueue::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
+
+void NullCommandQueue::NotifyCommandListExecuted(size_t command_count)
+{
+    ++m_executed_command_list_count;
+    m_executed_command_count += command_count;
+}
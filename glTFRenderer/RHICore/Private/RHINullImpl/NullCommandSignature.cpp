@@ -0,0 +1,11 @@
+#include "NullCommandSignature.h"
+
+bool NullCommandSignature::InitCommandSignature(IRHIDevice& device, IRHIRootSignature& root_signature)
+{
+    return true;
+}
+
+bool NullCommandSignature::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
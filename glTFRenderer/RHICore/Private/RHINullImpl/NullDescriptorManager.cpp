@@ -0,0 +1,89 @@
+#include "NullDescriptorManager.h"
+
+#include "RHIResourceFactoryImpl.hpp"
+
+bool NullBufferDescriptorAllocation::InitFromBuffer(const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc)
+{
+    m_source = buffer;
+    m_view_desc = desc;
+    return true;
+}
+
+bool NullAccelerationStructureDescriptorAllocation::InitFromAccelerationStructure(uint64_t acceleration_handle)
+{
+    m_acceleration_structure_handle = acceleration_handle;
+    return true;
+}
+
+uint64_t NullAccelerationStructureDescriptorAllocation::GetAccelerationStructureHandle() const
+{
+    return m_acceleration_structure_handle;
+}
+
+bool NullTextureDescriptorAllocation::InitFromTexture(const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc)
+{
+    m_source = texture;
+    m_view_desc = desc;
+    return true;
+}
+
+bool NullDescriptorTable::Build(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations)
+{
+    m_descriptor_count = static_cast<unsigned>(descriptor_allocations.size());
+    return true;
+}
+
+bool NullDescriptorManager::Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity)
+{
+    InitBindlessTextureTable(std::make_shared<NullDescriptorTable>());
+    return true;
+}
+
+bool NullDescriptorManager::CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHIBuffer>& buffer,
+    const RHIBufferDescriptorDesc& desc, std::shared_ptr<IRHIBufferDescriptorAllocation>& out_descriptor_allocation)
+{
+    out_descriptor_allocation = RHIResourceFactory::CreateRHIResource<IRHIBufferDescriptorAllocation>();
+    RETURN_IF_FALSE(out_descriptor_allocation->InitFromBuffer(buffer, desc))
+    ++m_created_descriptor_count;
+    
+    return true;
+}
+
+bool NullDescriptorManager::CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture,
+    const RHITextureDescriptorDesc& desc, std::shared_ptr<IRHITextureDescriptorAllocation>& out_descriptor_allocation)
+{
+    out_descriptor_allocation = RHIResourceFactory::CreateRHIResource<IRHITextureDescriptorAllocation>();
+    RETURN_IF_FALSE(dynamic_cast<NullTextureDescriptorAllocation&>(*out_descriptor_allocation).InitFromTexture(texture, desc))
+    ++m_created_descriptor_count;
+    
+    return true;
+}
+
+bool NullDescriptorManager::CreateDescriptorTable(IRHIDevice& device,
+    const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations,
+    std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table)
+{
+    out_descriptor_table = RHIResourceFactory::CreateRHIResource<IRHIDescriptorTable>();
+    return out_descriptor_table->Build(device, descriptor_allocations);
+}
+
+bool NullDescriptorManager::WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index,
+    const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation)
+{
+    return true;
+}
+
+bool NullDescriptorManager::BindDescriptorContext(IRHICommandList& command_list)
+{
+    return true;
+}
+
+bool NullDescriptorManager::BindGUIDescriptorContext(IRHICommandList& command_list)
+{
+    return true;
+}
+
+bool NullDescriptorManager::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
@@ -0,0 +1,25 @@
+#include "NullDescriptorUpdater.h"
+
+#include "NullCommandList.h"
+
+bool NullDescriptorUpdater::BindDescriptor(IRHICommandList& command_list, RHIPipelineType pipeline,
+    const RootSignatureAllocation& root_signature_allocation, const IRHIDescriptorAllocation& descriptor)
+{
+    return dynamic_cast<NullCommandList&>(command_list).RecordCommand({
+        RHINullCommandType::BIND_DESCRIPTOR, &descriptor,
+        {static_cast<unsigned long long>(pipeline), root_signature_allocation.global_parameter_index, static_cast<unsigned long long>(root_signature_allocation.type)}});
+}
+
+bool NullDescriptorUpdater::BindDescriptor(IRHICommandList& command_list, RHIPipelineType pipeline,
+    const RootSignatureAllocation& root_signature_allocation, const IRHIDescriptorTable& descriptor_table,
+    RHIDescriptorRangeType descriptor_type)
+{
+    return dynamic_cast<NullCommandList&>(command_list).RecordCommand({
+        RHINullCommandType::BIND_DESCRIPTOR_TABLE, &descriptor_table,
+        {static_cast<unsigned long long>(pipeline), root_signature_allocation.global_parameter_index, static_cast<unsigned long long>(descriptor_type)}});
+}
+
+bool NullDescriptorUpdater::FinalizeUpdateDescriptors(IRHIDevice& device, IRHICommandList& command_list, IRHIRootSignature& root_signature)
+{
+    return true;
+}
@@ -0,0 +1,12 @@
+#include "NullDevice.h"
+
+bool NullDevice::InitDevice(IRHIFactory& factory)
+{
+    need_release = true;
+    return true;
+}
+
+bool NullDevice::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
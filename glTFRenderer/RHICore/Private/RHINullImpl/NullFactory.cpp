@@ -0,0 +1,11 @@
+#include "NullFactory.h"
+
+bool NullFactory::InitFactory()
+{
+    return true;
+}
+
+bool NullFactory::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
@@ -0,0 +1,40 @@
+#include "NullFence.h"
+
+bool NullFence::InitFence(IRHIDevice& device)
+{
+    SetCanWait(true);
+    need_release = true;
+    
+    return true;
+}
+
+bool NullFence::HostWaitUtilSignaled()
+{
+    return true;
+}
+
+bool NullFence::ResetFence()
+{
+    return true;
+}
+
+unsigned long long NullFence::PredictNextSignalValue() const
+{
+    return m_last_signal_value + 1ull;
+}
+
+void NullFence::NotifySignalSubmitted(unsigned long long signal_value)
+{
+    m_last_signal_value = signal_value;
+    SetCanWait(true);
+}
+
+bool NullFence::IsSignalValueCompleted(unsigned long long signal_value) const
+{
+    return signal_value <= m_last_signal_value;
+}
+
+bool NullFence::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
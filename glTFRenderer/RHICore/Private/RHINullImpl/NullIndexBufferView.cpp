@@ -0,0 +1,8 @@
+#include "NullIndexBufferView.h"
+
+bool NullIndexBufferView::InitIndexBufferView(IRHIBuffer& buffer, const RHIIndexBufferViewDesc& desc)
+{
+    m_buffer = &buffer;
+    m_desc = desc;
+    return true;
+}
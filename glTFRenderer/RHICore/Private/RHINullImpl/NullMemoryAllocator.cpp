@@ -0,0 +1,11 @@
+#include "NullMemoryAllocator.h"
+
+bool NullMemoryAllocator::InitMemoryAllocator(const IRHIFactory& factory, const IRHIDevice& device)
+{
+    return true;
+}
+
+bool NullMemoryAllocator::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
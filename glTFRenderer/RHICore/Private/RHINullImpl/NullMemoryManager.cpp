@@ -0,0 +1,149 @@
+#include "NullMemoryManager.h"
+#include "RHIResourceFactoryImpl.hpp"
+
+bool NullMemoryManager::AllocateBufferMemory(IRHIDevice& device, const RHIBufferDesc& buffer_desc,
+                                             std::shared_ptr<IRHIBufferAllocation>& out_buffer_allocation)
+{
+    std::shared_ptr<IRHIBuffer> null_buffer = RHIResourceFactory::CreateRHIResource<IRHIBuffer>();
+    RETURN_IF_FALSE(dynamic_cast<NullBuffer&>(*null_buffer).CreateBuffer(buffer_desc))
+
+    out_buffer_allocation = RHIResourceFactory::CreateRHIResource<IRHIBufferAllocation>();
+    out_buffer_allocation->m_buffer = null_buffer;
+    out_buffer_allocation->SetNeedRelease();
+    
+    m_buffer_allocations.push_back(out_buffer_allocation);
+    m_allocated_buffer_size += buffer_desc.width;
+    
+    return true;
+}
+
+bool NullMemoryManager::UploadBufferDataInner(IRHIBufferAllocation& buffer_allocation, const void* data, size_t dst_offset, size_t size)
+{
+    return dynamic_cast<NullBuffer&>(*buffer_allocation.m_buffer).UploadBufferFromCPU(data, dst_offset, size);
+}
+
+bool NullMemoryManager::DownloadBufferData(IRHIBufferAllocation& buffer_allocation, void* data, size_t size)
+{
+    return dynamic_cast<const NullBuffer&>(*buffer_allocation.m_buffer).DownloadBufferToCPU(data, size);
+}
+
+bool NullMemoryManager::AllocateTextureMemory(IRHIDevice& device, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation)
+{
+    std::shared_ptr<IRHITexture> null_texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
+    RETURN_IF_FALSE(dynamic_cast<NullTexture&>(*null_texture).CreateTexture(texture_desc))
+
+    out_texture_allocation = RHIResourceFactory::CreateRHIResource<IRHITextureAllocation>();
+    out_texture_allocation->m_texture = null_texture;
+    out_texture_allocation->SetNeedRelease();
+    
+    m_texture_allocations.push_back(out_texture_allocation);
+    m_allocated_texture_size += null_texture->GetCopyReq().total_size;
+    
+    return true;
+}
+
+bool NullMemoryManager::GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc,
+    unsigned long long& out_size_bytes, unsigned long long& out_alignment)
+{
+    constexpr unsigned long long placement_alignment = 64ull * 1024ull;
+    NullTexture probe_texture;
+    RETURN_IF_FALSE(probe_texture.CreateTexture(texture_desc))
+
+    out_size_bytes = (probe_texture.GetCopyReq().total_size + placement_alignment - 1) / placement_alignment * placement_alignment;
+    out_alignment = placement_alignment;
+    return true;
+}
+
+bool NullMemoryManager::AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment,
+    std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation)
+{
+    out_heap_allocation = RHIResourceFactory::CreateRHIResource<IRHIHeapAllocation>();
+    out_heap_allocation->m_size_bytes = size_bytes;
+    out_heap_allocation->m_alignment = alignment;
+    out_heap_allocation->SetNeedRelease();
+    
+    m_heap_allocations.push_back(out_heap_allocation);
+    m_allocated_heap_size += size_bytes;
+    
+    return true;
+}
+
+bool NullMemoryManager::AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation,
+    unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation)
+{
+    unsigned long long size_bytes = 0;
+    unsigned long long alignment = 0;
+    RETURN_IF_FALSE(GetTexturePlacementRequirements(device, texture_desc, size_bytes, alignment))
+    if (offset % alignment != 0 || offset + size_bytes > heap_allocation->m_size_bytes)
+    {
+        LOG_FORMAT_FLUSH("[NullMemoryManager] Placed texture %s does not fit its heap at offset %llu\n", texture_desc.GetName().c_str(), offset);
+        return false;
+    }
+    
+    std::shared_ptr<IRHITexture> null_texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
+    RETURN_IF_FALSE(dynamic_cast<NullTexture&>(*null_texture).CreateTexture(texture_desc))
+
+    out_texture_allocation = RHIResourceFactory::CreateRHIResource<IRHITextureAllocation>();
+    out_texture_allocation->m_texture = null_texture;
+    out_texture_allocation->m_heap = heap_allocation;
+    out_texture_allocation->m_heap_offset = offset;
+    out_texture_allocation->SetNeedRelease();
+    
+    m_texture_allocations.push_back(out_texture_allocation);
+    
+    return true;
+}
+
+bool NullMemoryManager::ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation)
+{
+    const auto* raw_pointer = &memory_allocation;
+    
+    switch (memory_allocation.GetAllocationType()) {
+    case IRHIMemoryAllocation::BUFFER:
+        for (auto iter = m_buffer_allocations.begin(); iter != m_buffer_allocations.end(); ++iter)
+        {
+            if (iter->get() == raw_pointer)
+            {
+                m_allocated_buffer_size -= (*iter)->m_buffer->GetBufferDesc().width;
+                m_buffer_allocations.erase(iter);
+                break;
+            }
+        }
+        break;
+    case IRHIMemoryAllocation::TEXTURE:
+        for (auto iter = m_texture_allocations.begin(); iter != m_texture_allocations.end(); ++iter)
+        {
+            if (iter->get() == raw_pointer)
+            {
+                if (!(*iter)->m_heap)
+                {
+                    m_allocated_texture_size -= (*iter)->m_texture->GetCopyReq().total_size;
+                }
+                m_texture_allocations.erase(iter);
+                break;
+            }
+        }
+        break;
+    case IRHIMemoryAllocation::HEAP:
+        for (auto iter = m_heap_allocations.begin(); iter != m_heap_allocations.end(); ++iter)
+        {
+            if (iter->get() == raw_pointer)
+            {
+                m_allocated_heap_size -= (*iter)->m_size_bytes;
+                m_heap_allocations.erase(iter);
+                break;
+            }
+        }
+        break;
+    }
+
+    return true;
+}
+
+bool NullMemoryManager::ReleaseAllResource()
+{
+    m_allocated_buffer_size = 0;
+    m_allocated_texture_size = 0;
+    m_allocated_heap_size = 0;
+    return IRHIMemoryManager::ReleaseAllResource();
+}
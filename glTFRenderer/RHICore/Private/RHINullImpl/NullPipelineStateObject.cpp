@@ -0,0 +1,52 @@
+#include "NullPipelineStateObject.h"
+
+bool NullGraphicsPipelineStateObject::BindRenderTargetFormats(const std::vector<RHIDataFormat>& render_target_formats)
+{
+    m_bind_render_target_formats = render_target_formats;
+    return true;
+}
+
+bool NullGraphicsPipelineStateObject::InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature,
+    IRHISwapChain& swap_chain, const std::map<RHIShaderType, std::shared_ptr<IRHIShader>>& shaders)
+{
+    if (!shaders.contains(RHIShaderType::Vertex))
+    {
+        LOG_FORMAT_FLUSH("[NullRHI][Validation] Graphics pipeline %s has no vertex shader\n", GetName().c_str());
+        return false;
+    }
+    
+    return true;
+}
+
+bool NullGraphicsPipelineStateObject::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
+
+bool NullComputePipelineStateObject::InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature,
+    IRHISwapChain& swap_chain, const std::map<RHIShaderType, std::shared_ptr<IRHIShader>>& shaders)
+{
+    if (!shaders.contains(RHIShaderType::Compute))
+    {
+        LOG_FORMAT_FLUSH("[NullRHI][Validation] Compute pipeline %s has no compute shader\n", GetName().c_str());
+        return false;
+    }
+    
+    return true;
+}
+
+bool NullComputePipelineStateObject::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
+
+bool NullRTPipelineStateObject::InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature,
+    IRHISwapChain& swap_chain, const std::map<RHIShaderType, std::shared_ptr<IRHIShader>>& shaders)
+{
+    return true;
+}
+
+bool NullRTPipelineStateObject::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
@@ -0,0 +1,25 @@
+#include "NullRayTracingAS.h"
+
+#include "NullDescriptorManager.h"
+
+NullRayTracingAS::NullRayTracingAS()
+    : m_tlas_descriptor_allocation(std::make_shared<NullAccelerationStructureDescriptorAllocation>())
+{
+}
+
+void NullRayTracingAS::SetRayTracingSceneDesc(const RHIRayTracingSceneDesc& scene_desc)
+{
+    m_scene_desc = scene_desc;
+}
+
+bool NullRayTracingAS::InitRayTracingAS(IRHIDevice& device, IRHICommandList& command_list,
+                                        IRHIMemoryManager& memory_manager)
+{
+    // No structure is built; the handle only has to be non-zero for the descriptor to look initialized.
+    return m_tlas_descriptor_allocation->InitFromAccelerationStructure(m_scene_desc.instances.size() + 1);
+}
+
+const IRHIDescriptorAllocation& NullRayTracingAS::GetTLASDescriptorSRV() const
+{
+    return *m_tlas_descriptor_allocation;
+}
@@ -0,0 +1,11 @@
+#include "NullRenderPass.h"
+
+bool NullRenderPass::InitRenderPass(IRHIDevice& device, const RHIRenderPassInfo& info)
+{
+    return true;
+}
+
+bool NullRenderPass::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
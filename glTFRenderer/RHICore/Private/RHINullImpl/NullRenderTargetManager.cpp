@@ -0,0 +1,72 @@
+#include "NullRenderTargetManager.h"
+
+#include "IRHIMemoryManager.h"
+#include "NullCommandList.h"
+#include "NullSwapChain.h"
+#include "RHIInterface/IRHIDescriptorManager.h"
+
+bool NullRenderTargetManager::InitRenderTargetManager(IRHIDevice& device, size_t max_render_target_count)
+{
+    return true;
+}
+
+std::shared_ptr<IRHITextureDescriptorAllocation> NullRenderTargetManager::CreateRenderTarget(IRHIDevice& device,
+    IRHIMemoryManager& memory_manager, const RHITextureDesc& texture_desc, RHIDataFormat format)
+{
+    std::shared_ptr<IRHITextureAllocation> out_texture_allocation;
+    memory_manager.AllocateTextureMemory(device, texture_desc, out_texture_allocation);
+
+    return CreateRenderTargetFromTexture(device, memory_manager, out_texture_allocation, format);
+}
+
+std::shared_ptr<IRHITextureDescriptorAllocation> NullRenderTargetManager::CreateRenderTargetFromTexture(IRHIDevice& device,
+    IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format)
+{
+    format = format == RHIDataFormat::UNKNOWN ? texture_allocation->m_texture->GetTextureDesc().GetDataFormat() : format;
+    
+    std::shared_ptr<IRHITextureDescriptorAllocation> texture_descriptor_allocation;
+    RHITextureDescriptorDesc render_target(format, RHIResourceDimension::TEXTURE2D,
+        IsDepthStencilFormat(format) ? RHIViewType::RVT_DSV : RHIViewType::RVT_RTV);
+    memory_manager.GetDescriptorManager().CreateDescriptor(device, texture_allocation->m_texture,
+        render_target, texture_descriptor_allocation);
+    
+    return texture_descriptor_allocation;
+}
+
+std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> NullRenderTargetManager::CreateRenderTargetFromSwapChain(
+    IRHIDevice& device, IRHIMemoryManager& memory_manager, IRHISwapChain& swap_chain, RHITextureClearValue clear_value)
+{
+    std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> results;
+
+    NullSwapChain& null_swap_chain = dynamic_cast<NullSwapChain&>(swap_chain);
+    const unsigned back_buffer_count = null_swap_chain.GetBackBufferCount();
+
+    results.resize(back_buffer_count);
+    for (unsigned i = 0; i < back_buffer_count; ++i)
+    {
+        RHITextureDescriptorDesc render_target(null_swap_chain.GetBackBufferFormat(), RHIResourceDimension::TEXTURE2D, RHIViewType::RVT_RTV);
+        memory_manager.GetDescriptorManager().CreateDescriptor(device, null_swap_chain.GetSwapChainTextureByIndex(i),
+                render_target, results[i]);
+    }
+
+    return results;
+}
+
+bool NullRenderTargetManager::ClearRenderTarget(IRHICommandList& command_list,
+                                                const std::vector<IRHIDescriptorAllocation*>& render_targets)
+{
+    auto& null_command_list = dynamic_cast<NullCommandList&>(command_list);
+    for (const auto* render_target : render_targets)
+    {
+        RETURN_IF_FALSE(null_command_list.RecordCommand({RHINullCommandType::CLEAR_RENDER_TARGET, render_target}))
+    }
+    
+    return true;
+}
+
+bool NullRenderTargetManager::BindRenderTarget(IRHICommandList& command_list,
+                                               const std::vector<IRHIDescriptorAllocation*>& render_targets)
+{
+    return dynamic_cast<NullCommandList&>(command_list).RecordCommand(
+        {RHINullCommandType::BIND_RENDER_TARGET, render_targets.empty() ? nullptr : render_targets.front(), {render_targets.size()}});
+}
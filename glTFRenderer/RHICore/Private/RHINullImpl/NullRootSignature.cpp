@@ -0,0 +1,67 @@
+#include "NullRootSignature.h"
+
+bool NullRootParameter::InitAsConstant(unsigned constant_value, REGISTER_INDEX_TYPE register_index, unsigned space)
+{
+    SetType(RHIRootParameterType::Constant);
+    return true;
+}
+
+bool NullRootParameter::InitAsCBV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space)
+{
+    SetType(RHIRootParameterType::CBV);
+    return true;
+}
+
+bool NullRootParameter::InitAsSRV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space)
+{
+    SetType(RHIRootParameterType::SRV);
+    return true;
+}
+
+bool NullRootParameter::InitAsUAV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space)
+{
+    SetType(RHIRootParameterType::UAV);
+    return true;
+}
+
+bool NullRootParameter::InitAsAccelerationStructure(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space)
+{
+    SetType(RHIRootParameterType::AccelerationStructure);
+    return true;
+}
+
+bool NullRootParameter::InitAsDescriptorTableRange(unsigned attribute_index, size_t range_count, const RHIDescriptorRangeDesc* range_desc)
+{
+    SetType(RHIRootParameterType::DescriptorTable);
+    m_bindless = range_desc->descriptor_count == UINT_MAX;
+    return true;
+}
+
+bool NullRootParameter::IsBindless() const
+{
+    return m_bindless;
+}
+
+bool NullStaticSampler::InitStaticSampler(IRHIDevice& device, unsigned space, REGISTER_INDEX_TYPE register_index,
+    RHIStaticSamplerAddressMode address_mode, RHIStaticSamplerFilterMode filter_mode)
+{
+    m_registerIndex = register_index;
+    m_addressMode = address_mode;
+    m_filterMode = filter_mode;
+    return true;
+}
+
+bool NullStaticSampler::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
+
+bool NullRootSignature::InitRootSignature(IRHIDevice& device, IRHIDescriptorManager& descriptor_manager)
+{
+    return true;
+}
+
+bool NullRootSignature::Release(IRHIMemoryManager& memory_manager)
+{
+    return true;
+}
@@ -0,0 +1 @@
+#include "NullShader.h"
@@ -0,0 +1,8 @@
+#include "NullShaderTable.h"
+
+bool NullShaderTable::InitShaderTable(IRHIDevice& device, IRHICommandList& command_list, IRHIMemoryManager& memory_manager,
+                                      IRHIPipelineStateObject& pso, IRHIRayTracingAS& as, const std::vector<RHIShaderBindingTable>& sbts)
+{
+    m_sbt_count = sbts.size();
+    return true;
+}
@@ -0,0 +1,91 @@
+#include "NullSwapChain.h"
+
+#include "NullTexture.h"
+#include "RHIResourceFactoryImpl.hpp"
+
+unsigned NullSwapChain::GetCurrentBackBufferIndex()
+{
+    return m_current_frame_index;
+}
+
+unsigned NullSwapChain::GetBackBufferCount()
+{
+    return m_frame_buffer_count;
+}
+
+bool NullSwapChain::InitSwapChain(IRHIFactory& factory, IRHIDevice& device, IRHICommandQueue& commandQueue,
+                                  const RHITextureDesc& swap_chain_buffer_desc, const RHISwapChainDesc& swap_chain_desc)
+{
+    m_swap_chain_buffer_desc = swap_chain_buffer_desc;
+    m_swap_chain_mode = swap_chain_desc.chain_mode;
+    m_current_frame_index = 0;
+    m_frame_available_semaphore = RHIResourceFactory::CreateRHIResource<IRHISemaphore>();
+
+    return CreateSwapChainTextures();
+}
+
+bool NullSwapChain::AcquireNewFrame(IRHIDevice& device)
+{
+    return true;
+}
+
+IRHISemaphore& NullSwapChain::GetAvailableFrameSemaphore()
+{
+    return *m_frame_available_semaphore;
+}
+
+bool NullSwapChain::Present(IRHICommandQueue& command_queue, IRHICommandList& command_list)
+{
+    ++m_present_count;
+    m_current_frame_index = (m_current_frame_index + 1) % m_frame_buffer_count;
+    return true;
+}
+
+bool NullSwapChain::HostWaitPresentFinished(IRHIDevice& device)
+{
+    return true;
+}
+
+bool NullSwapChain::ResizeSwapChain(unsigned width, unsigned height)
+{
+    if (width == 0 || height == 0)
+    {
+        return false;
+    }
+    
+    m_swap_chain_buffer_desc = RHITextureDesc(
+        m_swap_chain_buffer_desc.GetName(),
+        width,
+        height,
+        m_swap_chain_buffer_desc.GetDataFormat(),
+        m_swap_chain_buffer_desc.GetUsage(),
+        m_swap_chain_buffer_desc.GetClearValue());
+    m_current_frame_index = 0;
+
+    return CreateSwapChainTextures();
+}
+
+bool NullSwapChain::Release(IRHIMemoryManager& memory_manager)
+{
+    m_swap_chain_textures.clear();
+    return true;
+}
+
+std::shared_ptr<IRHITexture> NullSwapChain::GetSwapChainTextureByIndex(unsigned index) const
+{
+    GLTF_CHECK(index < m_swap_chain_textures.size());
+    return m_swap_chain_textures[index];
+}
+
+bool NullSwapChain::CreateSwapChainTextures()
+{
+    m_swap_chain_textures.clear();
+    for (unsigned i = 0; i < m_frame_buffer_count; ++i)
+    {
+        std::shared_ptr<IRHITexture> texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
+        RETURN_IF_FALSE(dynamic_cast<NullTexture&>(*texture).CreateTexture(m_swap_chain_buffer_desc))
+        m_swap_chain_textures.push_back(texture);
+    }
+    
+    return true;
+}
@@ -0,0 +1,38 @@
+#include "NullTexture.h"
+
+#include <algorithm>
+#include <cmath>
+
+bool NullTexture::CreateTexture(const RHITextureDesc& desc)
+{
+    m_texture_desc = desc;
+    const unsigned mip_count = desc.HasUsage(RUF_CONTAINS_MIPMAP) ?
+        static_cast<unsigned>(std::floor(std::log2((std::max)(desc.GetTextureWidth(), desc.GetTextureHeight())))) + 1 : 1;
+
+    constexpr size_t row_alignment = 256;
+    constexpr size_t layer_alignment = 512;
+    const auto align_up = [](size_t value, size_t alignment) -> size_t
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    };
+    
+    RHIMipMapCopyRequirements copy_req {};
+    copy_req.row_byte_size.resize(mip_count);
+    copy_req.row_pitch.resize(mip_count);
+    copy_req.total_size = 0;
+
+    unsigned width = desc.GetTextureWidth();
+    unsigned height = desc.GetTextureHeight();
+    for (unsigned i = 0; i < mip_count; ++i)
+    {
+        copy_req.row_byte_size[i] = static_cast<size_t>(width) * GetBytePerPixelByFormat(desc.GetDataFormat());
+        copy_req.row_pitch[i] = align_up(copy_req.row_byte_size[i], row_alignment);
+        copy_req.total_size += align_up(copy_req.row_pitch[i] * height, layer_alignment);
+
+        width = (std::max)(width >> 1, 1u);
+        height = (std::max)(height >> 1, 1u);
+    }
+    SetCopyReq(copy_req);
+    
+    return true;
+}
@@ -0,0 +1,416 @@
+#include "NullUtils.h"
+#include <imgui/imgui.h>
+
+#include "DX12Utils.h"
+#include "NullBuffer.h"
+#include "NullCommandQueue.h"
+#include "NullTexture.h"
+#include "RHIInterface/IRHIFence.h"
+#include "RHIInterface/IRHIDescriptorManager.h"
+
+NullUtils::NullUtils()
+    : m_shader_reflection_utils(std::make_unique<DX12Utils>())
+{
+}
+
+NullUtils::~NullUtils() = default;
+
+bool NullUtils::InitGraphicsAPI()
+{
+    return true;
+}
+
+bool NullUtils::InitGUIContext(IRHIDevice& device, IRHICommandQueue& graphics_queue, IRHIDescriptorManager& descriptor_manager, unsigned back_buffer_count)
+{
+    return true;
+}
+
+bool NullUtils::NewGUIFrame()
+{
+    // ImGui::NewFrame asserts on an unbuilt font atlas, which the GPU backends build when creating the font texture.
+    ImGuiIO& io = ImGui::GetIO();
+    if (!io.Fonts->IsBuilt())
+    {
+        unsigned char* pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        io.Fonts->SetTexID(ImTextureID{});
+    }
+    
+    return true;
+}
+
+bool NullUtils::RenderGUIFrame(IRHICommandList& command_list)
+{
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    return RecordCommand(command_list, RHINullCommandType::RENDER_GUI, draw_data, draw_data ? draw_data->TotalVtxCount : 0);
+}
+
+bool NullUtils::ExitGUI()
+{
+    return true;
+}
+
+bool NullUtils::BeginRenderPass(IRHICommandList& command_list, const RHIBeginRenderPassInfo& begin_render_pass_info)
+{
+    return RecordCommand(command_list, RHINullCommandType::BEGIN_RENDER_PASS, begin_render_pass_info.render_pass);
+}
+
+bool NullUtils::EndRenderPass(IRHICommandList& command_list)
+{
+    return RecordCommand(command_list, RHINullCommandType::END_RENDER_PASS, nullptr);
+}
+
+bool NullUtils::BeginRendering(IRHICommandList& command_list, const RHIBeginRenderingInfo& begin_rendering_info)
+{
+    return RecordCommand(command_list, RHINullCommandType::BEGIN_RENDERING, nullptr,
+        begin_rendering_info.m_render_targets.size(), begin_rendering_info.rendering_area_width, begin_rendering_info.rendering_area_height);
+}
+
+bool NullUtils::EndRendering(IRHICommandList& command_list)
+{
+    return RecordCommand(command_list, RHINullCommandType::END_RENDERING, nullptr);
+}
+
+bool NullUtils::ResetCommandList(IRHICommandList& command_list, IRHICommandAllocator& command_allocator,
+                                 IRHIPipelineStateObject* init_pso)
+{
+    return command_list.BeginRecordCommandList();
+}
+
+bool NullUtils::CloseCommandList(IRHICommandList& command_list)
+{
+    return command_list.EndRecordCommandList();
+}
+
+bool NullUtils::ExecuteCommandList(IRHICommandList& command_list, IRHICommandQueue& command_queue,
+                                   const RHIExecuteCommandListContext& context)
+{
+    if (command_list.GetState() != RHICommandListState::Closed)
+    {
+        ReportValidationError("Executing command list that is still recording", command_list.GetName());
+        return false;
+    }
+    
+    const auto& null_command_list = dynamic_cast<NullCommandList&>(command_list);
+    dynamic_cast<NullCommandQueue&>(command_queue).NotifyCommandListExecuted(null_command_list.GetRecordedCommands().size());
+
+    auto& fence = command_list.GetFence();
+    fence.NotifySignalSubmitted(fence.PredictNextSignalValue());
+    
+    return true;
+}
+
+bool NullUtils::ResetCommandAllocator(IRHICommandAllocator& command_allocator)
+{
+    return true;
+}
+
+bool NullUtils::WaitCommandListFinish(IRHICommandList& command_list)
+{
+    return command_list.WaitCommandList();
+}
+
+bool NullUtils::WaitCommandQueueIdle(IRHICommandQueue& command_queue)
+{
+    return true;
+}
+
+bool NullUtils::WaitDeviceIdle(IRHIDevice& device)
+{
+    return true;
+}
+
+bool NullUtils::SetPipelineState(IRHICommandList& command_list, IRHIPipelineStateObject& pipeline_state_object)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_PIPELINE_STATE, &pipeline_state_object);
+}
+
+bool NullUtils::SetRootSignature(IRHICommandList& command_list, IRHIRootSignature& root_signature,
+                                 IRHIPipelineStateObject& pipeline_state_object, RHIPipelineType pipeline_type)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_ROOT_SIGNATURE, &root_signature, static_cast<unsigned long long>(pipeline_type));
+}
+
+bool NullUtils::SetViewport(IRHICommandList& command_list, const RHIViewportDesc& viewport_desc)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_VIEWPORT, nullptr);
+}
+
+bool NullUtils::SetScissorRect(IRHICommandList& command_list, const RHIScissorRectDesc& scissor_rect)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_SCISSOR_RECT, nullptr);
+}
+
+bool NullUtils::SetVertexBufferView(IRHICommandList& command_list, unsigned slot, IRHIVertexBufferView& view)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_VERTEX_BUFFER_VIEW, &view, slot);
+}
+
+bool NullUtils::SetIndexBufferView(IRHICommandList& command_list, IRHIIndexBufferView& view)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_INDEX_BUFFER_VIEW, &view);
+}
+
+bool NullUtils::SetPrimitiveTopology(IRHICommandList& command_list, RHIPrimitiveTopologyType type)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_PRIMITIVE_TOPOLOGY, nullptr, static_cast<unsigned long long>(type));
+}
+
+bool NullUtils::SetConstant32BitToRootParameterSlot(IRHICommandList& command_list, unsigned slot_index, unsigned* data,
+                                                    unsigned count, RHIPipelineType pipeline_type)
+{
+    return RecordCommand(command_list, RHINullCommandType::SET_CONSTANTS, nullptr, slot_index, count, static_cast<unsigned long long>(pipeline_type));
+}
+
+bool NullUtils::AddBufferBarrierToCommandList(IRHICommandList& command_list, const IRHIBuffer& buffer,
+                                              RHIResourceStateType beforeState, RHIResourceStateType afterState)
+{
+    ValidateBarrier(buffer.GetName(), dynamic_cast<const NullBuffer&>(buffer).GetDeviceState(), beforeState, afterState, RHIBarrierSplitType::NONE);
+    return RecordCommand(command_list, RHINullCommandType::BUFFER_BARRIER, &buffer,
+        static_cast<unsigned long long>(beforeState), static_cast<unsigned long long>(afterState));
+}
+
+bool NullUtils::AddTextureBarrierToCommandList(IRHICommandList& command_list, IRHITexture& texture,
+                                               RHIResourceStateType beforeState, RHIResourceStateType afterState)
+{
+    ValidateBarrier(texture.GetName(), dynamic_cast<const NullTexture&>(texture).GetDeviceState(), beforeState, afterState, RHIBarrierSplitType::NONE);
+    return RecordCommand(command_list, RHINullCommandType::TEXTURE_BARRIER, &texture,
+        static_cast<unsigned long long>(beforeState), static_cast<unsigned long long>(afterState));
+}
+
+bool NullUtils::AddBarriersToCommandList(IRHICommandList& command_list,
+                                         const std::vector<RHITextureBarrierDesc>& texture_barriers,
+                                         const std::vector<RHIBufferBarrierDesc>& buffer_barriers)
+{
+    for (const auto& texture_barrier : texture_barriers)
+    {
+        GLTF_CHECK(texture_barrier.texture);
+        ValidateBarrier(texture_barrier.texture->GetName(), dynamic_cast<const NullTexture&>(*texture_barrier.texture).GetDeviceState(),
+            texture_barrier.before_state, texture_barrier.after_state, texture_barrier.split_type);
+        RETURN_IF_FALSE(RecordCommand(command_list, RHINullCommandType::TEXTURE_BARRIER, texture_barrier.texture,
+            static_cast<unsigned long long>(texture_barrier.before_state), static_cast<unsigned long long>(texture_barrier.after_state),
+            static_cast<unsigned long long>(texture_barrier.split_type)))
+    }
+    for (const auto& buffer_barrier : buffer_barriers)
+    {
+        GLTF_CHECK(buffer_barrier.buffer);
+        ValidateBarrier(buffer_barrier.buffer->GetName(), dynamic_cast<const NullBuffer&>(*buffer_barrier.buffer).GetDeviceState(),
+            buffer_barrier.before_state, buffer_barrier.after_state, buffer_barrier.split_type);
+        RETURN_IF_FALSE(RecordCommand(command_list, RHINullCommandType::BUFFER_BARRIER, buffer_barrier.buffer,
+            static_cast<unsigned long long>(buffer_barrier.before_state), static_cast<unsigned long long>(buffer_barrier.after_state),
+            static_cast<unsigned long long>(buffer_barrier.split_type)))
+    }
+    
+    return true;
+}
+
+bool NullUtils::AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture)
+{
+    return RecordCommand(command_list, RHINullCommandType::UAV_BARRIER, &texture);
+}
+
+bool NullUtils::AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture)
+{
+    auto& device_state = dynamic_cast<const NullTexture&>(after_texture).GetDeviceState();
+    if (device_state.split_pending)
+    {
+        ReportValidationError("Aliasing barrier recorded while a split barrier is pending", after_texture.GetName());
+    }
+    // The activated texture starts from undefined contents, so its next barrier may come from any state.
+    device_state = {};
+    return RecordCommand(command_list, RHINullCommandType::ALIASING_BARRIER, &after_texture,
+        reinterpret_cast<unsigned long long>(before_texture));
+}
+
+bool NullUtils::DrawInstanced(IRHICommandList& command_list, unsigned vertex_count_per_instance, unsigned instance_count,
+                              unsigned start_vertex_location, unsigned start_instance_location)
+{
+    return RecordCommand(command_list, RHINullCommandType::DRAW_INSTANCED, nullptr,
+        vertex_count_per_instance, instance_count, start_vertex_location, start_instance_location);
+}
+
+bool NullUtils::DrawIndexInstanced(IRHICommandList& command_list, unsigned index_count_per_instance, unsigned instance_count,
+                                   unsigned start_index_location, unsigned base_vertex_location, unsigned start_instance_location)
+{
+    return RecordCommand(command_list, RHINullCommandType::DRAW_INDEXED_INSTANCED, nullptr,
+        index_count_per_instance, instance_count, start_index_location, base_vertex_location);
+}
+
+bool NullUtils::Dispatch(IRHICommandList& command_list, unsigned X, unsigned Y, unsigned Z)
+{
+    return RecordCommand(command_list, RHINullCommandType::DISPATCH, nullptr, X, Y, Z);
+}
+
+bool NullUtils::TraceRay(IRHICommandList& command_list, IRHIShaderTable& shader_table, unsigned X, unsigned Y, unsigned Z)
+{
+    return RecordCommand(command_list, RHINullCommandType::TRACE_RAY, &shader_table, X, Y, Z);
+}
+
+bool NullUtils::ExecuteIndirect(IRHICommandList& command_list, IRHICommandSignature& command_signature, unsigned max_count,
+                                IRHIBuffer& arguments_buffer, unsigned arguments_buffer_offset, unsigned command_stride)
+{
+    return RecordCommand(command_list, RHINullCommandType::EXECUTE_INDIRECT, &arguments_buffer,
+        max_count, arguments_buffer_offset, command_stride);
+}
+
+bool NullUtils::ExecuteIndirect(IRHICommandList& command_list, IRHICommandSignature& command_signature, unsigned max_count,
+                                IRHIBuffer& arguments_buffer, unsigned arguments_buffer_offset, IRHIBuffer& count_buffer,
+                                unsigned count_buffer_offset, unsigned command_stride)
+{
+    return RecordCommand(command_list, RHINullCommandType::EXECUTE_INDIRECT, &arguments_buffer,
+        max_count, arguments_buffer_offset, command_stride, count_buffer_offset);
+}
+
+bool NullUtils::CopyTexture(IRHICommandList& command_list, IRHITexture& dst, IRHITexture& src, const RHICopyTextureInfo& copy_info)
+{
+    return RecordCommand(command_list, RHINullCommandType::COPY_TEXTURE, &dst, copy_info.src_mip_level, copy_info.dst_mip_level);
+}
+
+bool NullUtils::CopyTexture(IRHICommandList& command_list, IRHITexture& dst, IRHIBuffer& src, const RHICopyTextureInfo& copy_info)
+{
+    return RecordCommand(command_list, RHINullCommandType::COPY_BUFFER_TO_TEXTURE, &dst,
+        copy_info.dst_mip_level, copy_info.copy_width, copy_info.copy_height);
+}
+
+bool NullUtils::CopyBuffer(IRHICommandList& command_list, IRHIBuffer& dst, size_t dst_offset, IRHIBuffer& src,
+                           size_t src_offset, size_t size)
+{
+    // Only upload and readback buffers hold bytes, and they are not copy destinations on the GPU path either.
+    return RecordCommand(command_list, RHINullCommandType::COPY_BUFFER, &dst, dst_offset, src_offset, size);
+}
+
+bool NullUtils::ClearUAVTexture(IRHICommandList& command_list, const IRHITextureDescriptorAllocation& texture_descriptor)
+{
+    GLTF_CHECK(texture_descriptor.m_view_desc->m_view_type == RHIViewType::RVT_UAV);
+    return RecordCommand(command_list, RHINullCommandType::CLEAR_UAV, texture_descriptor.m_source.get());
+}
+
+bool NullUtils::SupportRayTracing(IRHIDevice& device)
+{
+    return false;
+}
+
+bool NullUtils::SupportAsyncCompute(IRHIDevice& device)
+{
+    return true;
+}
+
+unsigned NullUtils::GetAlignmentSizeForUAVCount(unsigned size)
+{
+    return (size + 31) & ~31;
+}
+
+void NullUtils::ReportLiveObjects()
+{
+}
+
+bool NullUtils::ProcessShaderMetaData(IRHIShader& shader)
+{
+    return m_shader_reflection_utils->ProcessShaderMetaData(shader);
+}
+
+bool NullUtils::InitTimestampProfiler(IRHIDevice& device, IRHICommandQueue& command_queue, unsigned back_buffer_count,
+                                      unsigned max_query_count)
+{
+    // Supported stays false, so the renderer keeps the profiler disabled.
+    return true;
+}
+
+void NullUtils::ShutdownTimestampProfiler()
+{
+}
+
+bool NullUtils::BeginTimestampFrame(IRHICommandList& command_list, unsigned frame_slot)
+{
+    return true;
+}
+
+bool NullUtils::WriteTimestamp(IRHICommandList& command_list, unsigned frame_slot, unsigned query_index)
+{
+    return true;
+}
+
+bool NullUtils::EndTimestampFrame(IRHICommandList& command_list, unsigned frame_slot, unsigned query_count)
+{
+    return true;
+}
+
+bool NullUtils::ResolveTimestampFrame(unsigned frame_slot, unsigned query_count, std::vector<uint64_t>& out_timestamps,
+                                      double& out_ticks_per_second)
+{
+    out_timestamps.clear();
+    out_ticks_per_second = 0.0;
+    return false;
+}
+
+bool NullUtils::IsTimestampProfilerSupported() const
+{
+    return false;
+}
+
+bool NullUtils::CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms)
+{
+    out_gpu_tick = 0;
+    out_cpu_time_ms = 0.0;
+    return false;
+}
+
+bool NullUtils::RecordCommand(IRHICommandList& command_list, RHINullCommandType type, const void* object,
+                              unsigned long long arg0, unsigned long long arg1, unsigned long long arg2, unsigned long long arg3)
+{
+    return dynamic_cast<NullCommandList&>(command_list).RecordCommand({type, object, {arg0, arg1, arg2, arg3}});
+}
+
+void NullUtils::ValidateBarrier(const std::string& resource_name, RHINullResourceState& device_state,
+                                RHIResourceStateType before_state, RHIResourceStateType after_state, RHIBarrierSplitType split_type)
+{
+    switch (split_type)
+    {
+    case RHIBarrierSplitType::NONE:
+        if (device_state.split_pending)
+        {
+            ReportValidationError("Barrier recorded while a split barrier is pending", resource_name);
+        }
+        else if (device_state.known && device_state.state != before_state)
+        {
+            ReportValidationError("Barrier before state does not match the recorded state", resource_name);
+        }
+        device_state.known = true;
+        device_state.state = after_state;
+        break;
+        
+    case RHIBarrierSplitType::BEGIN_ONLY:
+        if (device_state.split_pending)
+        {
+            ReportValidationError("Split barrier begun twice", resource_name);
+        }
+        else if (device_state.known && device_state.state != before_state)
+        {
+            ReportValidationError("Split barrier before state does not match the recorded state", resource_name);
+        }
+        device_state.split_pending = true;
+        device_state.split_before_state = before_state;
+        device_state.split_after_state = after_state;
+        break;
+        
+    case RHIBarrierSplitType::END_ONLY:
+        if (!device_state.split_pending ||
+            device_state.split_before_state != before_state ||
+            device_state.split_after_state != after_state)
+        {
+            ReportValidationError("Split barrier end does not match its begin", resource_name);
+        }
+        device_state.split_pending = false;
+        device_state.known = true;
+        device_state.state = after_state;
+        break;
+    }
+}
+
+void NullUtils::ReportValidationError(const char* message, const std::string& resource_name)
+{
+    ++m_validation_error_count;
+    LOG_FORMAT_FLUSH("[NullRHI][Validation] %s: %s\n", message, resource_name.c_str());
+}
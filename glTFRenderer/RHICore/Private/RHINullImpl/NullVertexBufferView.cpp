@@ -0,0 +1,9 @@
+#include "NullVertexBufferView.h"
+
+void NullVertexBufferView::InitVertexBufferView(IRHIBuffer& buffer, size_t offset, size_t vertexStride, size_t vertex_buffer_size)
+{
+    m_buffer = &buffer;
+    m_buffer_offset = offset;
+    m_buffer_stride = vertexStride;
+    m_buffer_size = vertex_buffer_size;
+}
@@ -0,0 +1,215 @@
+#include "RHIPipelineCache.h"
+
+#include <cstring>
+#include <cwchar>
+#include <fstream>
+#include <random>
+
+#include "RHIConfigSingleton.h"
+
+namespace
+{
+    constexpr unsigned long long FNV_PRIME = 1099511628211ull;
+
+    // magic, version, graphics_api, vendor_id, device_id, reserved, driver_version, cache_uuid, payload size and hash.
+    constexpr size_t HEADER_SIZE = 6 * sizeof(unsigned) + sizeof(unsigned long long) + 16 + 2 * sizeof(unsigned long long);
+
+    template <typename T>
+    void Append(std::vector<unsigned char>& bytes, const T& value)
+    {
+        const auto* begin = reinterpret_cast<const unsigned char*>(&value);
+        bytes.insert(bytes.end(), begin, begin + sizeof(T));
+    }
+
+    template <typename T>
+    T Read(const std::vector<unsigned char>& bytes, size_t& offset)
+    {
+        T value {};
+        memcpy(&value, bytes.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+}
+
+RHIPipelineCacheKeyBuilder& RHIPipelineCacheKeyBuilder::AddBytes(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        m_hash ^= bytes[i];
+        m_hash *= FNV_PRIME;
+    }
+    return *this;
+}
+
+RHIPipelineCacheKeyBuilder& RHIPipelineCacheKeyBuilder::AddString(const std::string& value)
+{
+    AddValue(static_cast<unsigned long long>(value.size()));
+    return AddBytes(value.data(), value.size());
+}
+
+std::wstring RHIPipelineCacheKeyBuilder::GetKeyName() const
+{
+    wchar_t name[17] = {};
+    swprintf(name, 17, L"%016llx", m_hash);
+    return name;
+}
+
+unsigned long long RHIPipelineCacheKeyBuilder::Hash(const void* data, size_t size)
+{
+    return RHIPipelineCacheKeyBuilder().AddBytes(data, size).GetKey();
+}
+
+void RHIPipelineCacheFile::Serialize(const RHIPipelineCacheIdentity& identity, const void* payload, size_t payload_size,
+                                     std::vector<unsigned char>& out_bytes)
+{
+    out_bytes.clear();
+    out_bytes.reserve(HEADER_SIZE + payload_size);
+    Append(out_bytes, MAGIC);
+    Append(out_bytes, FORMAT_VERSION);
+    Append(out_bytes, identity.graphics_api);
+    Append(out_bytes, identity.vendor_id);
+    Append(out_bytes, identity.device_id);
+    Append(out_bytes, 0u);
+    Append(out_bytes, identity.driver_version);
+    Append(out_bytes, identity.cache_uuid);
+    Append(out_bytes, static_cast<unsigned long long>(payload_size));
+    Append(out_bytes, RHIPipelineCacheKeyBuilder::Hash(payload, payload_size));
+    GLTF_CHECK(out_bytes.size() == HEADER_SIZE);
+
+    const auto* payload_bytes = static_cast<const unsigned char*>(payload);
+    out_bytes.insert(out_bytes.end(), payload_bytes, payload_bytes + payload_size);
+}
+
+RHIPipelineCacheLoadResult RHIPipelineCacheFile::Deserialize(const std::vector<unsigned char>& bytes,
+                                                            const RHIPipelineCacheIdentity& identity, std::vector<unsigned char>& out_payload)
+{
+    out_payload.clear();
+    if (bytes.size() < HEADER_SIZE)
+    {
+        return RHIPipelineCacheLoadResult::CORRUPTED;
+    }
+
+    size_t offset = 0;
+    if (Read<unsigned>(bytes, offset) != MAGIC)
+    {
+        return RHIPipelineCacheLoadResult::CORRUPTED;
+    }
+    if (Read<unsigned>(bytes, offset) != FORMAT_VERSION)
+    {
+        return RHIPipelineCacheLoadResult::FORMAT_MISMATCH;
+    }
+
+    RHIPipelineCacheIdentity file_identity {};
+    file_identity.graphics_api = Read<unsigned>(bytes, offset);
+    file_identity.vendor_id = Read<unsigned>(bytes, offset);
+    file_identity.device_id = Read<unsigned>(bytes, offset);
+    Read<unsigned>(bytes, offset);
+    file_identity.driver_version = Read<unsigned long long>(bytes, offset);
+    file_identity.cache_uuid = Read<std::array<unsigned char, 16>>(bytes, offset);
+    if (!(file_identity == identity))
+    {
+        return RHIPipelineCacheLoadResult::IDENTITY_MISMATCH;
+    }
+
+    const auto payload_size = Read<unsigned long long>(bytes, offset);
+    const auto payload_hash = Read<unsigned long long>(bytes, offset);
+    if (payload_size != bytes.size() - HEADER_SIZE ||
+        payload_hash != RHIPipelineCacheKeyBuilder::Hash(bytes.data() + HEADER_SIZE, static_cast<size_t>(payload_size)))
+    {
+        return RHIPipelineCacheLoadResult::CORRUPTED;
+    }
+
+    out_payload.assign(bytes.begin() + HEADER_SIZE, bytes.end());
+    return RHIPipelineCacheLoadResult::LOADED;
+}
+
+RHIPipelineCacheLoadResult RHIPipelineCacheFile::Load(const std::filesystem::path& path,
+                                                     const RHIPipelineCacheIdentity& identity, std::vector<unsigned char>& out_payload)
+{
+    out_payload.clear();
+    std::ifstream file_stream(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file_stream.is_open())
+    {
+        return RHIPipelineCacheLoadResult::MISSING;
+    }
+
+    const std::streamoff file_size = file_stream.tellg();
+    if (file_size <= 0)
+    {
+        return RHIPipelineCacheLoadResult::CORRUPTED;
+    }
+
+    std::vector<unsigned char> bytes(static_cast<size_t>(file_size));
+    file_stream.seekg(0, std::ios::beg);
+    if (!file_stream.read(reinterpret_cast<char*>(bytes.data()), file_size))
+    {
+        return RHIPipelineCacheLoadResult::CORRUPTED;
+    }
+
+    return Deserialize(bytes, identity, out_payload);
+}
+
+bool RHIPipelineCacheFile::Save(const std::filesystem::path& path, const RHIPipelineCacheIdentity& identity,
+                                const void* payload, size_t payload_size)
+{
+    std::vector<unsigned char> bytes;
+    Serialize(identity, payload, payload_size, bytes);
+
+    std::error_code error;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), error);
+        if (error)
+        {
+            return false;
+        }
+    }
+
+    // Unique per writer, so two processes saving at once never interleave into the same temporary file.
+    std::filesystem::path temp_path = path;
+    temp_path += ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream file_stream(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file_stream.is_open() ||
+            !file_stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())) ||
+            !file_stream.flush())
+        {
+            file_stream.close();
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp_path, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+
+    return true;
+}
+
+std::filesystem::path RHIPipelineCacheFile::GetCacheFilePath(const char* file_name)
+{
+    return std::filesystem::path(RHIConfigSingleton::Instance().GetPipelineCacheDirectory()) / file_name;
+}
+
+const char* RHIPipelineCacheFile::ToString(RHIPipelineCacheLoadResult result)
+{
+    switch (result)
+    {
+    case RHIPipelineCacheLoadResult::LOADED:
+        return "loaded";
+    case RHIPipelineCacheLoadResult::MISSING:
+        return "missing";
+    case RHIPipelineCacheLoadResult::FORMAT_MISMATCH:
+        return "format mismatch";
+    case RHIPipelineCacheLoadResult::IDENTITY_MISMATCH:
+        return "adapter or driver changed";
+    case RHIPipelineCacheLoadResult::CORRUPTED:
+        return "corrupted";
+    }
+    return "unknown";
+}
@@ -0,0 +1,185 @@
+#include "RHIUploadRingAllocator.h"
+
+#include <cassert>
+
+unsigned RHIUploadRingAllocator::AddChunk(size_t capacity)
+{
+    Chunk chunk{};
+    chunk.id = m_next_chunk_id++;
+    chunk.capacity = capacity;
+    m_chunks.push_back(std::move(chunk));
+    return m_chunks.back().id;
+}
+
+void RHIUploadRingAllocator::Reset()
+{
+    m_chunks.clear();
+}
+
+bool RHIUploadRingAllocator::Allocate(size_t size, size_t alignment, const RetireTag& retire_tag, Allocation& out_allocation)
+{
+    out_allocation = {};
+    if (m_chunks.empty() || size == 0)
+    {
+        return false;
+    }
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    auto& chunk = m_chunks.back();
+    size_t offset = 0;
+    if (!TryAllocate(chunk, size, alignment, offset))
+    {
+        return false;
+    }
+
+    chunk.head = offset + size;
+    auto& ranges = chunk.in_flight_ranges;
+    if (!ranges.empty() && ranges.back().retire_tag == retire_tag && offset >= ranges.back().end)
+    {
+        ranges.back().end = chunk.head;
+    }
+    else
+    {
+        ranges.push_back({offset, chunk.head, retire_tag});
+    }
+
+    out_allocation.chunk_id = chunk.id;
+    out_allocation.offset = offset;
+    return true;
+}
+
+void RHIUploadRingAllocator::Reclaim(const RetireTagCompletedFunc& is_completed)
+{
+    for (auto& chunk : m_chunks)
+    {
+        ReclaimChunk(chunk, is_completed);
+    }
+}
+
+void RHIUploadRingAllocator::ReclaimAll()
+{
+    for (auto& chunk : m_chunks)
+    {
+        chunk.in_flight_ranges.clear();
+        chunk.head = 0;
+    }
+}
+
+void RHIUploadRingAllocator::CollectDrainedChunks(std::vector<unsigned>& out_chunk_ids)
+{
+    if (m_chunks.size() < 2)
+    {
+        return;
+    }
+
+    auto active_chunk = std::move(m_chunks.back());
+    m_chunks.pop_back();
+    for (auto it = m_chunks.begin(); it != m_chunks.end();)
+    {
+        if (it->in_flight_ranges.empty())
+        {
+            out_chunk_ids.push_back(it->id);
+            it = m_chunks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_chunks.push_back(std::move(active_chunk));
+}
+
+size_t RHIUploadRingAllocator::GetActiveChunkCapacity() const
+{
+    return m_chunks.empty() ? 0 : m_chunks.back().capacity;
+}
+
+size_t RHIUploadRingAllocator::GetTotalCapacity() const
+{
+    size_t total_capacity = 0;
+    for (const auto& chunk : m_chunks)
+    {
+        total_capacity += chunk.capacity;
+    }
+    return total_capacity;
+}
+
+size_t RHIUploadRingAllocator::GetInFlightSize() const
+{
+    size_t in_flight_size = 0;
+    for (const auto& chunk : m_chunks)
+    {
+        in_flight_size += GetChunkInFlightSize(chunk);
+    }
+    return in_flight_size;
+}
+
+bool RHIUploadRingAllocator::TryAllocate(Chunk& chunk, size_t size, size_t alignment, size_t& out_offset)
+{
+    const auto align_up = [alignment](size_t value) -> size_t
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    };
+
+    if (chunk.in_flight_ranges.empty())
+    {
+        chunk.head = 0;
+        out_offset = 0;
+        return size <= chunk.capacity;
+    }
+
+    // With ranges in flight the head is past the tail until it wraps, and at or before it afterwards.
+    const size_t tail = chunk.in_flight_ranges.front().begin;
+    const size_t offset = align_up(chunk.head);
+    if (chunk.head > tail)
+    {
+        if (offset + size <= chunk.capacity)
+        {
+            out_offset = offset;
+            return true;
+        }
+        if (size <= tail)
+        {
+            out_offset = 0;
+            return true;
+        }
+        return false;
+    }
+
+    if (offset + size <= tail)
+    {
+        out_offset = offset;
+        return true;
+    }
+    return false;
+}
+
+void RHIUploadRingAllocator::ReclaimChunk(Chunk& chunk, const RetireTagCompletedFunc& is_completed)
+{
+    auto& ranges = chunk.in_flight_ranges;
+    while (!ranges.empty())
+    {
+        const auto& retire_tag = ranges.front().retire_tag;
+        if (retire_tag.value != 0 && !is_completed(retire_tag))
+        {
+            break;
+        }
+        ranges.pop_front();
+    }
+
+    if (ranges.empty())
+    {
+        chunk.head = 0;
+    }
+}
+
+size_t RHIUploadRingAllocator::GetChunkInFlightSize(const Chunk& chunk)
+{
+    if (chunk.in_flight_ranges.empty())
+    {
+        return 0;
+    }
+
+    const size_t tail = chunk.in_flight_ranges.front().begin;
+    return chunk.head > tail ? chunk.head - tail : chunk.capacity - tail + chunk.head;
+}
@@ -12,6 +12,7 @@ bool VKCommandAllocator::InitCommandAllocator(IRHIDevice& device, RHICommandAllo
     create_command_pool_info.queueFamilyIndex = dynamic_cast<VKDevice&>(device).GetGraphicsQueueIndex();
     
     m_device = dynamic_cast<VKDevice&>(device).GetDevice();
+    m_type = type;
     const VkResult result = vkCreateCommandPool(m_device, &create_command_pool_info, nullptr, &m_command_pool);
     GLTF_CHECK(result == VK_SUCCESS);
     
@@ -2,22 +2,28 @@
 
 #include "VKDevice.h"
 
-bool VKCommandQueue::InitCommandQueue(IRHIDevice& device)
+bool VKCommandQueue::InitCommandQueue(IRHIDevice& device, RHICommandQueueType type)
 {
-    logical_device = dynamic_cast<VKDevice&>(device).GetDevice();
-    const unsigned graphics_queue_index = dynamic_cast<VKDevice&>(device).GetGraphicsQueueIndex();
-    
-    // TODO: Create graphics queue now
-    vkGetDeviceQueue(logical_device, graphics_queue_index, 0, &graphics_queue);
+    const auto& vk_device = dynamic_cast<VKDevice&>(device);
+    logical_device = vk_device.GetDevice();
+    const unsigned graphics_queue_index = vk_device.GetGraphicsQueueIndex();
+    m_type = type;
+
+    // Compute queue is the second queue of the graphics family, so command pools stay shareable between both.
+    if (type == RHICommandQueueType::COMPUTE && !vk_device.SupportsAsyncComputeQueue())
+    {
+        return false;
+    }
+    vkGetDeviceQueue(logical_device, graphics_queue_index, type == RHICommandQueueType::COMPUTE ? 1 : 0, &m_queue);
     
     need_release = true;
     
     return true;
 }
 
-VkQueue VKCommandQueue::GetGraphicsQueue() const
+VkQueue VKCommandQueue::GetQueue() const
 {
-    return graphics_queue;
+    return m_queue;
 }
 
 bool VKCommandQueue::Release(IRHIMemoryManager& memory_manager)
@@ -28,7 +34,7 @@ bool VKCommandQueue::Release(IRHIMemoryManager& memory_manager)
     }
 
     need_release = false;
-    vkQueueWaitIdle(graphics_queue);
+    vkQueueWaitIdle(m_queue);
     
     return true;
 }
@@ -54,7 +54,7 @@ bool VKComputePipelineStateObject::InitPipelineStateObject(IRHIDevice& device,
     compute_pipeline_create_info.basePipelineHandle = VK_NULL_HANDLE;
     compute_pipeline_create_info.basePipelineIndex = -1;
 
-    result = vkCreateComputePipelines(m_device, VK_NULL_HANDLE, 1, &compute_pipeline_create_info, nullptr, &m_pipeline);
+    result = vkCreateComputePipelines(m_device, dynamic_cast<VKDevice&>(device).GetPipelineCache(), 1, &compute_pipeline_create_info, nullptr, &m_pipeline);
     GLTF_CHECK(result == VK_SUCCESS);
 
     need_release = true;
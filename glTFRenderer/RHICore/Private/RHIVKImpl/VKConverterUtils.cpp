@@ -268,6 +268,9 @@ VkPipelineStageFlagBits VKConverterUtils::ConvertToPipelineStage(RHIPipelineStag
     case RHIPipelineStage::COLOR_ATTACHMENT_OUTPUT:
         result = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
         break;
+    case RHIPipelineStage::ALL_COMMANDS:
+        result = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        break;
     }
 
     return result;
@@ -72,21 +72,17 @@ bool VKTextureDescriptorAllocation::Release(IRHIMemoryManager& memory_manager)
     return true;
 }
 
-bool VKDescriptorTable::Build(IRHIDevice& device,
-                              const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations)
+namespace
 {
-    GLTF_CHECK(!descriptor_allocations.empty());
-    
-    for (const auto& descriptor : descriptor_allocations)
+    VkDescriptorImageInfo MakeDescriptorImageInfo(const IRHITextureDescriptorAllocation& descriptor)
     {
-        VkImageView view = dynamic_cast<const VKTextureDescriptorAllocation&>(*descriptor).GetRawImageView();
         VkDescriptorImageInfo image_info{};
-        image_info.imageView = view;
+        image_info.imageView = dynamic_cast<const VKTextureDescriptorAllocation&>(descriptor).GetRawImageView();
         const bool is_depth_srv =
-            descriptor->GetDesc().m_view_type == RHIViewType::RVT_SRV &&
-            (IsDepthStencilFormat(descriptor->GetDesc().m_format) ||
-                ((descriptor->m_source->GetTextureDesc().GetUsage() & RUF_ALLOW_DEPTH_STENCIL) != 0));
-        switch (descriptor->GetDesc().m_view_type) {
+            descriptor.GetDesc().m_view_type == RHIViewType::RVT_SRV &&
+            (IsDepthStencilFormat(descriptor.GetDesc().m_format) ||
+                ((descriptor.m_source->GetTextureDesc().GetUsage() & RUF_ALLOW_DEPTH_STENCIL) != 0));
+        switch (descriptor.GetDesc().m_view_type) {
         case RHIViewType::RVT_SRV:
             image_info.imageLayout = is_depth_srv
                 ? VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL
@@ -98,12 +94,41 @@ bool VKDescriptorTable::Build(IRHIDevice& device,
         default:
             GLTF_CHECK(false);
         }
-        m_image_infos.push_back(image_info);
+        return image_info;
+    }
+}
+
+bool VKDescriptorTable::Build(IRHIDevice& device,
+                              const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations)
+{
+    GLTF_CHECK(!descriptor_allocations.empty());
+    
+    for (const auto& descriptor : descriptor_allocations)
+    {
+        m_image_infos.push_back(MakeDescriptorImageInfo(*descriptor));
     }
     
     return true;
 }
 
+void VKDescriptorTable::InitEmpty(unsigned descriptor_count)
+{
+    // Sized once, so the image infos a pending descriptor write points at never move.
+    m_image_infos.assign(descriptor_count, VkDescriptorImageInfo{});
+}
+
+void VKDescriptorTable::SetImageInfo(unsigned index, const IRHITextureDescriptorAllocation& descriptor_allocation)
+{
+    GLTF_CHECK(index < m_image_infos.size());
+    m_image_infos[index] = MakeDescriptorImageInfo(descriptor_allocation);
+}
+
+void VKDescriptorTable::ClearImageInfo(unsigned index)
+{
+    GLTF_CHECK(index < m_image_infos.size());
+    m_image_infos[index] = VkDescriptorImageInfo{};
+}
+
 const std::vector<VkDescriptorImageInfo>& VKDescriptorTable::GetImageInfos() const
 {
     return m_image_infos;
@@ -136,6 +161,12 @@ bool VKDescriptorManager::Init(IRHIDevice& device, const DescriptorAllocationInf
     
     VK_CHECK(vkCreateDescriptorPool(m_device, &descriptor_pool_create_info, nullptr, &m_descriptor_pool));
     need_release = true;
+
+    // Descriptor indexing equivalent of the DX12 bindless range: the table fills the partially bound image
+    // array of the pass layouts, so a bindless index is the array element.
+    auto bindless_texture_table = std::make_shared<VKDescriptorTable>();
+    bindless_texture_table->InitEmpty(MAX_BINDLESS_TEXTURE_COUNT);
+    InitBindlessTextureTable(bindless_texture_table);
     
     return true;
 }
@@ -181,6 +212,33 @@ bool VKDescriptorManager::CreateDescriptor(IRHIDevice& device, const std::shared
     return true;
 }
 
+bool VKDescriptorManager::CreateDescriptorTable(IRHIDevice& device,
+    const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations,
+    std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table)
+{
+    // Tables are written into the pass descriptor sets as image arrays, nothing is allocated up front.
+    auto descriptor_table = std::make_shared<VKDescriptorTable>();
+    if (!descriptor_table->Build(device, descriptor_allocations))
+    {
+        out_descriptor_table = nullptr;
+        return false;
+    }
+    out_descriptor_table = descriptor_table;
+    return true;
+}
+
+bool VKDescriptorManager::WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index,
+    const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation)
+{
+    dynamic_cast<VKDescriptorTable&>(*m_bindless_texture_table).SetImageInfo(bindless_index, *descriptor_allocation);
+    return true;
+}
+
+void VKDescriptorManager::ClearBindlessTexture(unsigned bindless_index)
+{
+    dynamic_cast<VKDescriptorTable&>(*m_bindless_texture_table).ClearImageInfo(bindless_index);
+}
+
 bool VKDescriptorManager::BindDescriptorContext(IRHICommandList& command_list)
 {
     return true;
@@ -121,16 +121,31 @@ bool VKDescriptorUpdater::BindDescriptor(IRHICommandList& command_list, RHIPipel
         break;
     }
     
-    for (size_t i = 0; i < image_infos.size(); ++i)
+    // One write per run of filled slots; empty slots of a bindless table stay unwritten, which the partially
+    // bound layout binding allows.
+    size_t run_begin = 0;
+    while (run_begin < image_infos.size())
     {
+        if (image_infos[run_begin].imageView == VK_NULL_HANDLE)
+        {
+            ++run_begin;
+            continue;
+        }
+        size_t run_end = run_begin + 1;
+        while (run_end < image_infos.size() && image_infos[run_end].imageView != VK_NULL_HANDLE)
+        {
+            ++run_end;
+        }
+
         VkWriteDescriptorSet draw_image_write = {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, .pNext = nullptr};
         draw_image_write.dstBinding = root_signature_allocation.local_space_parameter_index;
-        draw_image_write.descriptorCount = 1;
+        draw_image_write.descriptorCount = static_cast<uint32_t>(run_end - run_begin);
         draw_image_write.dstSet = VK_NULL_HANDLE;
-        draw_image_write.dstArrayElement = i;
+        draw_image_write.dstArrayElement = static_cast<uint32_t>(run_begin);
         draw_image_write.descriptorType = type;
-        draw_image_write.pImageInfo = &image_infos[i];
+        draw_image_write.pImageInfo = &image_infos[run_begin];
         m_cache_descriptor_writers[root_signature_allocation.space].push_back(draw_image_write);
+        run_begin = run_end;
     }
     
     return true;
@@ -6,6 +6,7 @@
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <GLFW/glfw3native.h>
 
+#include <cstring>
 #include <optional>
 #include <set>
 
@@ -181,6 +182,12 @@ bool VKDevice::Release(IRHIMemoryManager& memory_manager)
         {
             LOG_FORMAT_FLUSH("[VKDevice] vkDeviceWaitIdle during release returned %d.\n", static_cast<int>(wait_result));
         }
+        if (m_pipeline_cache != VK_NULL_HANDLE)
+        {
+            SavePipelineCache();
+            vkDestroyPipelineCache(logical_device, m_pipeline_cache, nullptr);
+            m_pipeline_cache = VK_NULL_HANDLE;
+        }
         vkDestroyDevice(logical_device, nullptr);
         logical_device = VK_NULL_HANDLE;
     }
@@ -197,11 +204,76 @@ bool VKDevice::Release(IRHIMemoryManager& memory_manager)
     m_ray_tracing_supported = false;
     m_ray_query_supported = false;
     m_present_wait_supported = false;
+    m_async_compute_queue_supported = false;
     m_rt_pipeline_properties = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR};
     
     return true;
 }
 
+void VKDevice::CreatePipelineCache(const VkPhysicalDeviceProperties& device_properties)
+{
+    if (!RHIConfigSingleton::Instance().IsPipelineCacheEnabled())
+    {
+        return;
+    }
+
+    // The driver validates its own header on load too, this only saves handing it a blob it will ignore.
+    m_pipeline_cache_identity = {};
+    m_pipeline_cache_identity.graphics_api = static_cast<unsigned>(RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan);
+    m_pipeline_cache_identity.vendor_id = device_properties.vendorID;
+    m_pipeline_cache_identity.device_id = device_properties.deviceID;
+    m_pipeline_cache_identity.driver_version = device_properties.driverVersion;
+    memcpy(m_pipeline_cache_identity.cache_uuid.data(), device_properties.pipelineCacheUUID, VK_UUID_SIZE);
+    m_pipeline_cache_file_path = RHIPipelineCacheFile::GetCacheFilePath("vk_pipeline_cache.bin");
+
+    std::vector<unsigned char> initial_data;
+    const RHIPipelineCacheLoadResult load_result = RHIPipelineCacheFile::Load(m_pipeline_cache_file_path, m_pipeline_cache_identity, initial_data);
+    if (load_result != RHIPipelineCacheLoadResult::LOADED && load_result != RHIPipelineCacheLoadResult::MISSING)
+    {
+        LOG_FORMAT_FLUSH("[VKDevice] Discarding pipeline cache %s: %s.\n",
+            m_pipeline_cache_file_path.string().c_str(), RHIPipelineCacheFile::ToString(load_result));
+    }
+
+    VkPipelineCacheCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    create_info.initialDataSize = initial_data.size();
+    create_info.pInitialData = initial_data.empty() ? nullptr : initial_data.data();
+    VkResult result = vkCreatePipelineCache(logical_device, &create_info, nullptr, &m_pipeline_cache);
+    if (result != VK_SUCCESS && !initial_data.empty())
+    {
+        LOG_FORMAT_FLUSH("[VKDevice] vkCreatePipelineCache rejected %s (%d), starting empty.\n",
+            m_pipeline_cache_file_path.string().c_str(), static_cast<int>(result));
+        create_info.initialDataSize = 0;
+        create_info.pInitialData = nullptr;
+        result = vkCreatePipelineCache(logical_device, &create_info, nullptr, &m_pipeline_cache);
+    }
+    if (result != VK_SUCCESS)
+    {
+        LOG_FORMAT_FLUSH("[VKDevice] vkCreatePipelineCache failed (%d), compiling pipelines without cache.\n", static_cast<int>(result));
+        m_pipeline_cache = VK_NULL_HANDLE;
+    }
+}
+
+void VKDevice::SavePipelineCache()
+{
+    size_t data_size = 0;
+    if (vkGetPipelineCacheData(logical_device, m_pipeline_cache, &data_size, nullptr) != VK_SUCCESS || data_size == 0)
+    {
+        return;
+    }
+
+    std::vector<unsigned char> data(data_size);
+    if (vkGetPipelineCacheData(logical_device, m_pipeline_cache, &data_size, data.data()) != VK_SUCCESS)
+    {
+        return;
+    }
+
+    if (RHIPipelineCacheFile::Save(m_pipeline_cache_file_path, m_pipeline_cache_identity, data.data(), data_size))
+    {
+        LOG_FORMAT_FLUSH("[VKDevice] Saved pipeline cache %s (%zu bytes).\n", m_pipeline_cache_file_path.string().c_str(), data_size);
+    }
+}
+
 QueueFamilyIndices VKDevice::FindQueueFamily(VkPhysicalDevice device, VkSurfaceKHR surface)
 {
     unsigned queue_family_count = 0;
@@ -217,6 +289,7 @@ QueueFamilyIndices VKDevice::FindQueueFamily(VkPhysicalDevice device, VkSurfaceK
         if (queue_family_property.queueFlags & VK_QUEUE_GRAPHICS_BIT)
         {
             result.graphics_family = family_index; 
+            result.graphics_family_queue_count = queue_family_property.queueCount;
         }
 
         VkBool32 present_support = false;
@@ -435,6 +508,7 @@ bool VKDevice::InitDevice(IRHIFactory& factory)
     m_ray_tracing_supported = false;
     m_ray_query_supported = false;
     m_present_wait_supported = false;
+    m_async_compute_queue_supported = false;
     m_rt_pipeline_properties = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR};
      
     // Create surface
@@ -510,15 +584,19 @@ bool VKDevice::InitDevice(IRHIFactory& factory)
 
     std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
     std::set<unsigned> unique_queue_families = {queue_family_indices.graphics_family.value(), queue_family_indices.present_family.value()};
-    const float queue_priority = 1.0f;
+    const float queue_priorities[] = {1.0f, 1.0f};
+    // Queue 1 of the graphics family backs the async compute queue when the family exposes it.
+    m_async_compute_queue_supported = queue_family_indices.graphics_family_queue_count >= 2;
 
     for (const auto unique_queue_family : unique_queue_families)
     {
+        const bool create_async_compute_queue =
+            m_async_compute_queue_supported && unique_queue_family == queue_family_indices.graphics_family.value();
         VkDeviceQueueCreateInfo queue_create_info {};
         queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
         queue_create_info.queueFamilyIndex = unique_queue_family;
-        queue_create_info.queueCount = 1;
-        queue_create_info.pQueuePriorities = &queue_priority;
+        queue_create_info.queueCount = create_async_compute_queue ? 2 : 1;
+        queue_create_info.pQueuePriorities = queue_priorities;
         queue_create_infos.push_back(queue_create_info);
     }
 
@@ -651,6 +729,8 @@ bool VKDevice::InitDevice(IRHIFactory& factory)
 
     // TODO: Ensure graphics and present queue are the same now
     GLTF_CHECK(graphics_queue_index == present_queue_index);
+
+    CreatePipelineCache(selected_device_properties);
     
     need_release = true;
     
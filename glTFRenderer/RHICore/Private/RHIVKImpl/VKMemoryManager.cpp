@@ -96,19 +96,60 @@ bool VKMemoryManager::DownloadBufferData(IRHIBufferAllocation& buffer_allocation
 // 对齐函数（与 Vulkan 推荐的 `VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL` 对齐）
 #define ALIGN_UP(value, alignment) (((value) + (alignment) - 1) & ~((alignment) - 1))
 
+namespace
+{
+    uint32_t GetMipLevels(const RHITextureDesc& texture_desc)
+    {
+        return texture_desc.HasUsage(RUF_CONTAINS_MIPMAP) ? static_cast<uint32_t>(std::floor(std::log2(std::max(texture_desc.GetTextureWidth(), texture_desc.GetTextureHeight())))) + 1 : 1;
+    }
+    
+    VkImageCreateInfo GetImageCreateInfo(const RHITextureDesc& texture_desc)
+    {
+        VkImageCreateInfo image_create_info {.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, .pNext = nullptr};
+
+        image_create_info.format = VKConverterUtils::ConvertToFormat(texture_desc.GetDataFormat());
+        image_create_info.extent = {texture_desc.GetTextureWidth(), texture_desc.GetTextureHeight(), 1};
+        image_create_info.mipLevels = GetMipLevels(texture_desc);
+        image_create_info.arrayLayers = 1;
+        image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_create_info.imageType = VK_IMAGE_TYPE_2D;
+        image_create_info.usage = VKConverterUtils::ConvertToImageUsage(texture_desc.GetUsage());
+        return image_create_info;
+    }
+
+    bool InitTexture(IRHIDevice& device, VkImage image, const RHITextureDesc& texture_desc, IRHITextureAllocation& texture_allocation)
+    {
+        texture_allocation.m_texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
+        RETURN_IF_FALSE(dynamic_cast<VKTexture&>(*texture_allocation.m_texture).Init(dynamic_cast<VKDevice&>(device).GetDevice(), image, texture_desc))
+
+        const uint32_t mipLevels = GetMipLevels(texture_desc);
+        RHIMipMapCopyRequirements copy_req {};
+        copy_req.row_byte_size.resize(mipLevels);
+        copy_req.row_pitch.resize(mipLevels);
+
+        constexpr unsigned row_alignment = 256;
+        constexpr unsigned layer_alignment = 512;
+    
+        unsigned width = texture_desc.GetTextureWidth();
+        unsigned height = texture_desc.GetTextureHeight();
+        for (unsigned i = 0; i < mipLevels; i++)
+        {
+            copy_req.row_byte_size[i] = width * GetBytePerPixelByFormat(texture_desc.GetDataFormat());
+            copy_req.row_pitch[i] = ALIGN_UP(copy_req.row_byte_size[i], row_alignment);
+            copy_req.total_size += ALIGN_UP(copy_req.row_pitch[i] * height, layer_alignment);
+
+            width = width >> 1;
+            height = height >> 1;
+        }
+        texture_allocation.m_texture->SetCopyReq(copy_req);
+        return true;
+    }
+}
+
 bool VKMemoryManager::AllocateTextureMemory(IRHIDevice& device, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation)
 {
-    uint32_t mipLevels = texture_desc.HasUsage(RUF_CONTAINS_MIPMAP) ? static_cast<uint32_t>(std::floor(std::log2(std::max(texture_desc.GetTextureWidth(), texture_desc.GetTextureHeight())))) + 1 : 1;
-    VkImageCreateInfo image_create_info {.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, .pNext = nullptr};
-
-    image_create_info.format = VKConverterUtils::ConvertToFormat(texture_desc.GetDataFormat());
-    image_create_info.extent = {texture_desc.GetTextureWidth(), texture_desc.GetTextureHeight(), 1};
-    image_create_info.mipLevels = mipLevels;
-    image_create_info.arrayLayers = 1;
-    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
-    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
-    image_create_info.imageType = VK_IMAGE_TYPE_2D;
-    image_create_info.usage = VKConverterUtils::ConvertToImageUsage(texture_desc.GetUsage());
+    const VkImageCreateInfo image_create_info = GetImageCreateInfo(texture_desc);
     
     VmaAllocationCreateInfo draw_image_allocation_create_info {};
     draw_image_allocation_create_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
@@ -126,34 +167,100 @@ bool VKMemoryManager::AllocateTextureMemory(IRHIDevice& device, const RHITexture
     vk_texture_allocation.m_allocation_info = out_allocation_info;
     out_texture_allocation->SetNeedRelease();
 
-    vk_texture_allocation.m_texture = RHIResourceFactory::CreateRHIResource<IRHITexture>();
-    GLTF_CHECK(dynamic_cast<VKTexture&>(*vk_texture_allocation.m_texture).Init(dynamic_cast<VKDevice&>(device).GetDevice(), out_image, texture_desc));
+    GLTF_CHECK(InitTexture(device, out_image, texture_desc, vk_texture_allocation));
+    
+    m_texture_allocations.push_back(out_texture_allocation);
+    
+    return true;
+}
 
-    RHIMipMapCopyRequirements copy_req {};
-    copy_req.row_byte_size.resize(mipLevels);
-    copy_req.row_pitch.resize(mipLevels);
+bool VKMemoryManager::GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc,
+    unsigned long long& out_size_bytes, unsigned long long& out_alignment)
+{
+    // Requirements depend on the driver's tiling, so they are read from a throwaway image of the same create info.
+    VkDevice vk_device = dynamic_cast<VKDevice&>(device).GetDevice();
+    const VkImageCreateInfo image_create_info = GetImageCreateInfo(texture_desc);
+    VkImage probe_image = VK_NULL_HANDLE;
+    VK_CHECK(vkCreateImage(vk_device, &image_create_info, nullptr, &probe_image))
+    VkMemoryRequirements memory_requirements {};
+    vkGetImageMemoryRequirements(vk_device, probe_image, &memory_requirements);
+    vkDestroyImage(vk_device, probe_image, nullptr);
+
+    const uint32_t memory_type_bits = m_placed_texture_memory_type_bits & memory_requirements.memoryTypeBits;
+    if (!memory_type_bits)
+    {
+        LOG_FORMAT_FLUSH("[VKMemoryManager] Texture %s shares no memory type with other placed textures\n", texture_desc.GetName().c_str());
+        return false;
+    }
+    m_placed_texture_memory_type_bits = memory_type_bits;
+    
+    out_size_bytes = memory_requirements.size;
+    out_alignment = memory_requirements.alignment;
+    return true;
+}
 
-    constexpr unsigned row_alignment = 256;
-    constexpr unsigned layer_alignment = 512;
+bool VKMemoryManager::AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment,
+    std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation)
+{
+    VkMemoryRequirements memory_requirements {};
+    memory_requirements.size = size_bytes;
+    memory_requirements.alignment = alignment;
+    memory_requirements.memoryTypeBits = m_placed_texture_memory_type_bits;
     
-    unsigned width = texture_desc.GetTextureWidth();
-    unsigned height = texture_desc.GetTextureHeight();
-    for (unsigned i = 0; i < mipLevels; i++)
-    {
-        copy_req.row_byte_size[i] = width * GetBytePerPixelByFormat(texture_desc.GetDataFormat());
-        copy_req.row_pitch[i] = ALIGN_UP(copy_req.row_byte_size[i], row_alignment);
-        copy_req.total_size += ALIGN_UP(copy_req.row_pitch[i] * height, layer_alignment);
+    VmaAllocationCreateInfo heap_allocation_create_info {};
+    heap_allocation_create_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+    heap_allocation_create_info.requiredFlags = static_cast<VkMemoryPropertyFlags>(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-        width = width >> 1;
-        height = height >> 1;
-    }
-    vk_texture_allocation.m_texture->SetCopyReq(copy_req);
+    VmaAllocation out_allocation;
+    VK_CHECK(vmaAllocateMemory(GetVmaAllocator(), &memory_requirements, &heap_allocation_create_info, &out_allocation, nullptr))
+
+    out_heap_allocation = std::make_shared<VKHeapAllocation>();
+    dynamic_cast<VKHeapAllocation&>(*out_heap_allocation).m_allocation = out_allocation;
+    out_heap_allocation->m_size_bytes = size_bytes;
+    out_heap_allocation->m_alignment = alignment;
+    out_heap_allocation->SetNeedRelease();
+    
+    m_heap_allocations.push_back(out_heap_allocation);
+    
+    return true;
+}
+
+bool VKMemoryManager::AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation,
+    unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation)
+{
+    VkDevice vk_device = dynamic_cast<VKDevice&>(device).GetDevice();
+    const VkImageCreateInfo image_create_info = GetImageCreateInfo(texture_desc);
+    VkImage out_image = VK_NULL_HANDLE;
+    VK_CHECK(vkCreateImage(vk_device, &image_create_info, nullptr, &out_image))
+    VK_CHECK(vmaBindImageMemory2(GetVmaAllocator(), dynamic_cast<const VKHeapAllocation&>(*heap_allocation).m_allocation, offset, out_image, nullptr))
+
+    out_texture_allocation = std::make_shared<VKTextureAllocation>();
+    out_texture_allocation->m_heap = heap_allocation;
+    out_texture_allocation->m_heap_offset = offset;
+    out_texture_allocation->SetNeedRelease();
+
+    GLTF_CHECK(InitTexture(device, out_image, texture_desc, *out_texture_allocation));
     
     m_texture_allocations.push_back(out_texture_allocation);
     
     return true;
 }
 
+void VKMemoryManager::DestroyTextureAllocation(const VKTextureAllocation& texture_allocation)
+{
+    VkImage vk_image = dynamic_cast<const VKTexture&>(*texture_allocation.m_texture).GetRawImage();
+    if (texture_allocation.m_allocation)
+    {
+        vmaDestroyImage(GetVmaAllocator(), vk_image, texture_allocation.m_allocation);
+        return;
+    }
+
+    // Placed image: the heap owns the memory and is freed on its own.
+    VmaAllocatorInfo allocator_info {};
+    vmaGetAllocatorInfo(GetVmaAllocator(), &allocator_info);
+    vkDestroyImage(allocator_info.device, vk_image, nullptr);
+}
+
 bool VKMemoryManager::ReleaseMemoryAllocation( IRHIMemoryAllocation& memory_allocation)
 {
     const auto* raw_pointer = &memory_allocation;
@@ -182,10 +289,7 @@ bool VKMemoryManager::ReleaseMemoryAllocation( IRHIMemoryAllocation& memory_allo
         break;
     case IRHIMemoryAllocation::TEXTURE:
         {
-            const auto& vk_texture_allocation = dynamic_cast<const VKTextureAllocation&>(memory_allocation);
-            VkImage vk_image = dynamic_cast<const VKTexture&>(*vk_texture_allocation.m_texture).GetRawImage();
-
-            vmaDestroyImage(GetVmaAllocator(), vk_image, vk_texture_allocation.m_allocation);
+            DestroyTextureAllocation(dynamic_cast<const VKTextureAllocation&>(memory_allocation));
 
             bool removed = false;
             for (auto iter = m_texture_allocations.begin(); iter != m_texture_allocations.end(); ++iter)
@@ -201,6 +305,24 @@ bool VKMemoryManager::ReleaseMemoryAllocation( IRHIMemoryAllocation& memory_allo
             GLTF_CHECK(removed);
         }
         break;
+    case IRHIMemoryAllocation::HEAP:
+        {
+            vmaFreeMemory(GetVmaAllocator(), dynamic_cast<const VKHeapAllocation&>(memory_allocation).m_allocation);
+
+            bool removed = false;
+            for (auto iter = m_heap_allocations.begin(); iter != m_heap_allocations.end(); ++iter)
+            {
+                if (iter->get() == raw_pointer)
+                {
+                    m_heap_allocations.erase(iter);
+                    removed = true;
+                    break;
+                }
+            }
+
+            GLTF_CHECK(removed);
+        }
+        break;
     }
 
     return true;
@@ -218,10 +340,12 @@ bool VKMemoryManager::ReleaseAllResource()
 
     for (const auto& texture_allocation : m_texture_allocations)
     {
-        const auto& vk_texture_allocation = dynamic_cast<const VKTextureAllocation&>(*texture_allocation);
-        VkImage vk_image = dynamic_cast<const VKTexture&>(*vk_texture_allocation.m_texture).GetRawImage();
+        DestroyTextureAllocation(dynamic_cast<const VKTextureAllocation&>(*texture_allocation));
+    }
 
-        vmaDestroyImage(GetVmaAllocator(), vk_image, vk_texture_allocation.m_allocation);
+    for (const auto& heap_allocation : m_heap_allocations)
+    {
+        vmaFreeMemory(GetVmaAllocator(), dynamic_cast<const VKHeapAllocation&>(*heap_allocation).m_allocation);
     }
     
     m_allocator->Release(*this);
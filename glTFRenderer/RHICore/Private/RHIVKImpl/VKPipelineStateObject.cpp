@@ -240,7 +240,7 @@ bool VKGraphicsPipelineStateObject::InitPipelineStateObject(IRHIDevice& device,
     create_graphics_pipeline_info.basePipelineIndex = -1;
     create_graphics_pipeline_info.pNext = &pipeline_rendering_create_info;
 
-    result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &create_graphics_pipeline_info, nullptr, &m_pipeline);
+    result = vkCreateGraphicsPipelines(m_device, dynamic_cast<VKDevice&>(device).GetPipelineCache(), 1, &create_graphics_pipeline_info, nullptr, &m_pipeline);
     GLTF_CHECK(result == VK_SUCCESS);
 
     need_release = true;
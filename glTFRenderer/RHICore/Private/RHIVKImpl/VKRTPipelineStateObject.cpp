@@ -160,7 +160,7 @@ bool VKRTPipelineStateObject::InitPipelineStateObject(IRHIDevice& device,
     pipeline_info.maxPipelineRayRecursionDepth = std::max(1u, m_config.max_recursion_count);
     pipeline_info.layout = m_pipeline_layout;
 
-    GLTF_CHECK(vkCreateRayTracingPipelinesKHR(m_device, VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &m_pipeline) == VK_SUCCESS);
+    GLTF_CHECK(vkCreateRayTracingPipelinesKHR(m_device, VK_NULL_HANDLE, dynamic_cast<VKDevice&>(device).GetPipelineCache(), 1, &pipeline_info, nullptr, &m_pipeline) == VK_SUCCESS);
 
     need_release = true;
     return true;
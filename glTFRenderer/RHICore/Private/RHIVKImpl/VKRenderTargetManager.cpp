@@ -16,12 +16,18 @@ std::shared_ptr<IRHITextureDescriptorAllocation> VKRenderTargetManager::CreateRe
     std::shared_ptr<IRHITextureAllocation> out_texture_allocation;
     memory_manager.AllocateTextureMemory(device, texture_desc, out_texture_allocation);
 
-    format = format == RHIDataFormat::UNKNOWN ? texture_desc.GetDataFormat() : format;
+    return CreateRenderTargetFromTexture(device, memory_manager, out_texture_allocation, format);
+}
+
+std::shared_ptr<IRHITextureDescriptorAllocation> VKRenderTargetManager::CreateRenderTargetFromTexture(IRHIDevice& device,
+    IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format)
+{
+    format = format == RHIDataFormat::UNKNOWN ? texture_allocation->m_texture->GetTextureDesc().GetDataFormat() : format;
     
     std::shared_ptr<IRHITextureDescriptorAllocation> texture_descriptor_allocation;
     RHITextureDescriptorDesc render_target(format, RHIResourceDimension::TEXTURE2D,
         IsDepthStencilFormat(format) ? RHIViewType::RVT_DSV : RHIViewType::RVT_RTV);
-    memory_manager.GetDescriptorManager().CreateDescriptor(device, out_texture_allocation->m_texture,
+    memory_manager.GetDescriptorManager().CreateDescriptor(device, texture_allocation->m_texture,
         render_target, texture_descriptor_allocation);
     
     return texture_descriptor_allocation;
@@ -1,5 +1,7 @@
 #include "VKRootParameter.h"
 
+#include "RHIInterface/IRHIDescriptorManager.h"
+
 bool VKRootParameter::InitAsConstant(unsigned constant_value, unsigned register_index, unsigned space)
 {
     SetType(RHIRootParameterType::Constant);
@@ -79,7 +81,7 @@ bool VKRootParameter::InitAsDescriptorTableRange(unsigned local_attribute_index,
     m_binding.descriptorType = range_desc->type == RHIDescriptorRangeType::SRV ?
         range_desc->is_buffer ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE :
         range_desc->is_buffer ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ;
-    m_binding.descriptorCount = m_bindless ? 1024 : range_desc->descriptor_count;
+    m_binding.descriptorCount = m_bindless ? IRHIDescriptorManager::MAX_BINDLESS_TEXTURE_COUNT : range_desc->descriptor_count;
     
     m_binding.stageFlags = VK_SHADER_STAGE_ALL;
     
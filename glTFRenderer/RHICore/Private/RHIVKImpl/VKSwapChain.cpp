@@ -242,7 +242,7 @@ bool VKSwapChain::Present(IRHICommandQueue& command_queue, IRHICommandList& comm
         present_info.pNext = &present_id;
     }
 
-    const VkResult result = vkQueuePresentKHR(vk_command_queue.GetGraphicsQueue(), &present_info);
+    const VkResult result = vkQueuePresentKHR(vk_command_queue.GetQueue(), &present_info);
     if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
     {
         if (!m_frame_available_semaphores.empty())
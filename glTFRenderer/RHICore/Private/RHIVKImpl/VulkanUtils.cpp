@@ -156,7 +156,7 @@ bool VulkanUtils::InitGUIContext(IRHIDevice& device, IRHICommandQueue& graphics_
     vulkan_init_info.PhysicalDevice = vulkan_device.GetPhysicalDevice(); 
     vulkan_init_info.Device = vulkan_device.GetDevice();
     vulkan_init_info.QueueFamily = vulkan_device.GetGraphicsQueueIndex();
-    vulkan_init_info.Queue = vulkan_queue.GetGraphicsQueue();
+    vulkan_init_info.Queue = vulkan_queue.GetQueue();
     vulkan_init_info.PipelineCache = VK_NULL_HANDLE;
     vulkan_init_info.DescriptorPool = vulkan_descriptor_manager.GetDescriptorPool();
     vulkan_init_info.Subpass = 0;
@@ -359,7 +359,7 @@ bool VulkanUtils::ExecuteCommandList(IRHICommandList& command_list, IRHICommandQ
     auto& fence = dynamic_cast<VKFence&>(dynamic_cast<VKCommandList&>(command_list).GetFence());
     const auto vk_fence = fence.GetFence();
     const auto signal_value = fence.PredictNextSignalValue();
-    const auto vk_command_queue= dynamic_cast<VKCommandQueue&>(command_queue).GetGraphicsQueue(); 
+    const auto vk_command_queue= dynamic_cast<VKCommandQueue&>(command_queue).GetQueue(); 
     
     VkSubmitInfo submit_info{};
     submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -411,12 +411,12 @@ bool VulkanUtils::WaitCommandListFinish(IRHICommandList& command_list)
 bool VulkanUtils::WaitCommandQueueIdle(IRHICommandQueue& command_queue)
 {
     VKCommandQueue& vk_command_queue = dynamic_cast<VKCommandQueue&>(command_queue);
-    const VkResult result = vkQueueWaitIdle(vk_command_queue.GetGraphicsQueue());
+    const VkResult result = vkQueueWaitIdle(vk_command_queue.GetQueue());
     if (result != VK_SUCCESS)
     {
         LOG_FORMAT_FLUSH("[VulkanUtils] vkQueueWaitIdle failed. result=%d queue=%p.\n",
             static_cast<int>(result),
-            vk_command_queue.GetGraphicsQueue());
+            vk_command_queue.GetQueue());
         return false;
     }
 
@@ -643,6 +643,82 @@ bool VulkanUtils::AddTextureBarrierToCommandList(IRHICommandList& command_list,
     return true;
 }
 
+bool VulkanUtils::AddBarriersToCommandList(IRHICommandList& command_list,
+                                           const std::vector<RHITextureBarrierDesc>& texture_barriers,
+                                           const std::vector<RHIBufferBarrierDesc>& buffer_barriers)
+{
+    // Split transitions would map to vkCmdSetEvent2/vkCmdWaitEvents2 pairs; until events are pooled per
+    // command list the begin half is dropped and the end half is recorded as a full barrier.
+    std::vector<VkImageMemoryBarrier2> image_barriers;
+    image_barriers.reserve(texture_barriers.size());
+    for (const auto& texture_barrier : texture_barriers)
+    {
+        GLTF_CHECK(texture_barrier.texture);
+        if (texture_barrier.split_type == RHIBarrierSplitType::BEGIN_ONLY)
+        {
+            continue;
+        }
+
+        VkImageMemoryBarrier2 image_barrier {.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2};
+        image_barrier.pNext = nullptr;
+        image_barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        image_barrier.srcAccessMask = GetAccessFlagFromResourceState(texture_barrier.before_state);
+        image_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        image_barrier.dstAccessMask = GetAccessFlagFromResourceState(texture_barrier.after_state);
+        image_barrier.oldLayout = VKConverterUtils::ConvertToImageLayout(texture_barrier.before_state);
+        image_barrier.newLayout = VKConverterUtils::ConvertToImageLayout(texture_barrier.after_state);
+
+        VkImageSubresourceRange sub_image{};
+        sub_image.aspectMask = (texture_barrier.texture->GetTextureDesc().GetUsage() & RUF_ALLOW_DEPTH_STENCIL) ?
+            VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        sub_image.baseMipLevel = 0;
+        sub_image.levelCount = VK_REMAINING_MIP_LEVELS;
+        sub_image.baseArrayLayer = 0;
+        sub_image.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        image_barrier.subresourceRange = sub_image;
+        image_barrier.image = dynamic_cast<const VKTexture&>(*texture_barrier.texture).GetRawImage();
+        image_barriers.push_back(image_barrier);
+    }
+
+    std::vector<VkBufferMemoryBarrier2> vk_buffer_barriers;
+    vk_buffer_barriers.reserve(buffer_barriers.size());
+    for (const auto& buffer_barrier : buffer_barriers)
+    {
+        GLTF_CHECK(buffer_barrier.buffer);
+        if (buffer_barrier.split_type == RHIBarrierSplitType::BEGIN_ONLY)
+        {
+            continue;
+        }
+
+        VkBufferMemoryBarrier2 vk_buffer_barrier {.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2};
+        vk_buffer_barrier.pNext = nullptr;
+        vk_buffer_barrier.buffer = dynamic_cast<const VKBuffer&>(*buffer_barrier.buffer).GetRawBuffer();
+        vk_buffer_barrier.offset = 0;
+        vk_buffer_barrier.size = buffer_barrier.buffer->GetBufferDesc().width;
+        vk_buffer_barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        vk_buffer_barrier.srcAccessMask = GetAccessFlagFromResourceState(buffer_barrier.before_state);
+        vk_buffer_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        vk_buffer_barrier.dstAccessMask = GetAccessFlagFromResourceState(buffer_barrier.after_state);
+        vk_buffer_barriers.push_back(vk_buffer_barrier);
+    }
+
+    if (image_barriers.empty() && vk_buffer_barriers.empty())
+    {
+        return true;
+    }
+
+    VkDependencyInfo dep_info {};
+    dep_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dep_info.pNext = nullptr;
+    dep_info.imageMemoryBarrierCount = static_cast<uint32_t>(image_barriers.size());
+    dep_info.pImageMemoryBarriers = image_barriers.data();
+    dep_info.bufferMemoryBarrierCount = static_cast<uint32_t>(vk_buffer_barriers.size());
+    dep_info.pBufferMemoryBarriers = vk_buffer_barriers.data();
+    vkCmdPipelineBarrier2(dynamic_cast<VKCommandList&>(command_list).GetRawCommandBuffer(), &dep_info);
+    
+    return true;
+}
+
 bool VulkanUtils::AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture)
 {
     // TODO: Fixup logic
@@ -679,6 +755,27 @@ bool VulkanUtils::AddUAVBarrier(IRHICommandList& command_list, IRHITexture& text
     return true;
 }
 
+bool VulkanUtils::AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture)
+{
+    // Vulkan has no per-resource aliasing barrier; a global memory dependency orders every write to the shared
+    // memory before the activated image's first access. The image keeps its layout but not its contents, so it
+    // has to be cleared or fully overwritten before anything reads it.
+    VkMemoryBarrier2 memory_barrier {};
+    memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+    memory_barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    memory_barrier.srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT;
+    memory_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+    VkDependencyInfo dep_info {};
+    dep_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dep_info.memoryBarrierCount = 1;
+    dep_info.pMemoryBarriers = &memory_barrier;
+    vkCmdPipelineBarrier2(dynamic_cast<VKCommandList&>(command_list).GetRawCommandBuffer(), &dep_info);
+    
+    return true;
+}
+
 bool VulkanUtils::DrawInstanced(IRHICommandList& command_list, unsigned vertex_count_per_instance, unsigned instance_count,
                                 unsigned start_vertex_location, unsigned start_instance_location)
 {
@@ -861,6 +958,11 @@ bool VulkanUtils::SupportRayTracing(IRHIDevice& device)
     return dynamic_cast<VKDevice&>(device).IsRayTracingSupported();
 }
 
+bool VulkanUtils::SupportAsyncCompute(IRHIDevice& device)
+{
+    return dynamic_cast<VKDevice&>(device).SupportsAsyncComputeQueue();
+}
+
 bool VulkanUtils::InitTimestampProfiler(IRHIDevice& device, IRHICommandQueue& command_queue, unsigned back_buffer_count, unsigned max_query_count)
 {
     (void)command_queue;
@@ -1026,6 +1128,15 @@ bool VulkanUtils::IsTimestampProfilerSupported() const
     return m_timestamp_profiler_state && m_timestamp_profiler_state->supported;
 }
 
+bool VulkanUtils::CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms)
+{
+    // Needs VK_EXT_calibrated_timestamps, which the device is not created with.
+    (void)command_queue;
+    out_gpu_tick = 0;
+    out_cpu_time_ms = 0.0;
+    return false;
+}
+
 unsigned VulkanUtils::GetAlignmentSizeForUAVCount(unsigned size)
 {
     const UINT alignment = 32;
@@ -16,6 +16,8 @@
 #include "RendererCommon.h"
 
 class IRHITextureDescriptorAllocation;
+class IRHITexture;
+class IRHIBuffer;
 class IRHIFrameBuffer;
 class IRHIRenderPass;
 class IRHISemaphore;
@@ -78,6 +80,38 @@ enum class RHIResourceStateType
     STATE_RAYTRACING_ACCELERATION_STRUCTURE,
 };
 
+// States a compute queue may transition from and to; D3D12 rejects the rest on compute lists.
+inline bool IsComputeQueueResourceState(RHIResourceStateType state)
+{
+    switch (state)
+    {
+    case RHIResourceStateType::STATE_COMMON:
+    case RHIResourceStateType::STATE_COPY_SOURCE:
+    case RHIResourceStateType::STATE_COPY_DEST:
+    case RHIResourceStateType::STATE_VERTEX_AND_CONSTANT_BUFFER:
+    case RHIResourceStateType::STATE_UNORDERED_ACCESS:
+    case RHIResourceStateType::STATE_NON_PIXEL_SHADER_RESOURCE:
+    case RHIResourceStateType::STATE_RAYTRACING_ACCELERATION_STRUCTURE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Narrows a read state a compute pass asks for to the part a compute queue can use.
+inline RHIResourceStateType ConvertToComputeQueueResourceState(RHIResourceStateType state)
+{
+    switch (state)
+    {
+    case RHIResourceStateType::STATE_PIXEL_SHADER_RESOURCE:
+    case RHIResourceStateType::STATE_ALL_SHADER_RESOURCE:
+    case RHIResourceStateType::STATE_DEPTH_READ:
+        return RHIResourceStateType::STATE_NON_PIXEL_SHADER_RESOURCE;
+    default:
+        return state;
+    }
+}
+
 enum class RHIDataFormat
 {
     // Float type
@@ -393,6 +427,7 @@ struct RHICORE_API RHISubPassInfo
 enum class RHIPipelineStage
 {
     COLOR_ATTACHMENT_OUTPUT,
+    ALL_COMMANDS,
 };
 
 enum class RHIAccessFlags
@@ -899,6 +934,12 @@ enum class RHICommandAllocatorType
     UNKNOWN,
 };
 
+enum class RHICommandQueueType
+{
+    GRAPHICS,
+    COMPUTE,
+};
+
 #define THROW_IF_FAILED(x) \
     { \
     HRESULT result = (x); \
@@ -960,14 +1001,14 @@ inline unsigned GetBytePerPixelByFormat(const RHIDataFormat& RHIDataFormat)
 
 struct RHIExecuteCommandListWaitInfo
 {
-    const IRHISemaphore* m_wait_semaphore;
+    IRHISemaphore* m_wait_semaphore;
     RHIPipelineStage wait_stage;
 };
 
 struct RHIExecuteCommandListContext
 {
     std::vector<RHIExecuteCommandListWaitInfo> wait_infos;
-    std::vector<const IRHISemaphore*> sign_semaphores;
+    std::vector<IRHISemaphore*> sign_semaphores;
 };
 
 struct RHIBeginRenderPassInfo
@@ -995,6 +1036,32 @@ struct RHIBeginRenderingInfo
     bool clear_depth_stencil {true};
 };
 
+// Split barriers let the driver start a transition right after the producer and only wait for it at
+// the consumer. A BEGIN_ONLY barrier must be closed by an END_ONLY one with identical states before the
+// resource is used again.
+enum class RHIBarrierSplitType
+{
+    NONE,
+    BEGIN_ONLY,
+    END_ONLY,
+};
+
+struct RHITextureBarrierDesc
+{
+    IRHITexture* texture {nullptr};
+    RHIResourceStateType before_state {RHIResourceStateType::STATE_UNDEFINED};
+    RHIResourceStateType after_state {RHIResourceStateType::STATE_UNDEFINED};
+    RHIBarrierSplitType split_type {RHIBarrierSplitType::NONE};
+};
+
+struct RHIBufferBarrierDesc
+{
+    const IRHIBuffer* buffer {nullptr};
+    RHIResourceStateType before_state {RHIResourceStateType::STATE_COMMON};
+    RHIResourceStateType after_state {RHIResourceStateType::STATE_COMMON};
+    RHIBarrierSplitType split_type {RHIBarrierSplitType::NONE};
+};
+
 struct RHITextureUploadInfo
 {
     std::shared_ptr<unsigned char[]> data;
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <string>
+
 #include "RHICommon.h"
 
 enum class RHIGraphicsAPIType
 {
     RHI_GRAPHICS_API_DX12,
     RHI_GRAPHICS_API_Vulkan,
+    // Records commands on the CPU without a device, for profiling and validating the renderer without a GPU.
+    RHI_GRAPHICS_API_Null,
     RHI_GRAPHICS_API_NUM,
 };
 
@@ -33,6 +37,11 @@ public:
     bool IsDX12SynchronizedQueueValidationEnabled() const { return m_enable_dx12_sync_queue_validation; }
     void SetVulkanOptionalFeatureRequirements(const RHIVulkanOptionalFeatureRequirements& requirements) { m_vulkan_optional_feature_requirements = requirements; }
     const RHIVulkanOptionalFeatureRequirements& GetVulkanOptionalFeatureRequirements() const { return m_vulkan_optional_feature_requirements; }
+    // Read when the device is created and written back when it is released.
+    bool IsPipelineCacheEnabled() const { return m_enable_pipeline_cache; }
+    void SetPipelineCacheEnabled(bool enable) { m_enable_pipeline_cache = enable; }
+    const std::string& GetPipelineCacheDirectory() const { return m_pipeline_cache_directory; }
+    void SetPipelineCacheDirectory(const std::string& directory) { m_pipeline_cache_directory = directory; }
     
 private:
     RHIConfigSingleton();
@@ -42,4 +51,6 @@ private:
     bool m_enable_dx12_gpu_validation{false};
     bool m_enable_dx12_sync_queue_validation{false};
     RHIVulkanOptionalFeatureRequirements m_vulkan_optional_feature_requirements{};
+    bool m_enable_pipeline_cache{true};
+    std::string m_pipeline_cache_directory;
 };
@@ -9,7 +9,7 @@ class RHICORE_API DX12CommandQueue : public IRHICommandQueue
 public:
     IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(DX12CommandQueue)
     
-    virtual bool InitCommandQueue(IRHIDevice& device) override;
+    virtual bool InitCommandQueue(IRHIDevice& device, RHICommandQueueType type) override;
     
     ID3D12CommandQueue* GetCommandQueue() {return m_command_queue.Get(); }
     const ID3D12CommandQueue* GetCommandQueue() const {return m_command_queue.Get(); }
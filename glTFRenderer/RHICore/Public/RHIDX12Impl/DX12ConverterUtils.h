@@ -22,4 +22,5 @@ public:
     static D3D12_INDIRECT_ARGUMENT_TYPE ConvertToIndirectArgumentType(RHIIndirectArgType type);
     static D3D12_INDIRECT_ARGUMENT_DESC ConvertToIndirectArgumentDesc(const RHIIndirectArgumentDesc& desc);
     static D3D12_RESOURCE_FLAGS ConvertToResourceFlags(RHIResourceUsageFlags usage);
+    static D3D12_COMMAND_LIST_TYPE ConvertToCommandListType(RHICommandAllocatorType type);
 };
@@ -2,6 +2,7 @@
 #include "DX12Common.h"
 #include "RHIInterface/IRHIResource.h"
 #include "RHICommon.h"
+#include "RHIDescriptorIndexAllocator.h"
 #include <memory>
 
 class IRHITextureDescriptorAllocation;
@@ -20,7 +21,9 @@ public:
     IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(DX12DescriptorHeap)
     
     virtual bool InitDescriptorHeap(IRHIDevice& device, const RHIDescriptorHeapDesc& desc) ;
+    // One past the highest descriptor index in use so far.
     unsigned GetUsedDescriptorCount() const;
+    const RHIDescriptorIndexAllocator& GetIndexAllocator() const { return m_index_allocator; }
 
     virtual bool CreateConstantBufferViewInDescriptorHeap(IRHIDevice& device, unsigned descriptor_offset, std::shared_ptr<IRHIBuffer> buffer, const RHIConstantBufferViewDesc& desc, /*output*/
                                                           std::shared_ptr<IRHIDescriptorAllocation>& out_allocation) ;
@@ -30,7 +33,25 @@ public:
     virtual bool CreateResourceDescriptorInHeap(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture, const RHIDescriptorDesc& desc,
                                                           /*output*/
                                                           std::shared_ptr<IRHITextureDescriptorAllocation>& out_allocation) ;
+    // Recreates the views of the allocations in one contiguous range owned by the caller, for tables whose
+    // descriptors were not allocated back to back. Only shader resource and unordered access views.
+    bool CreateDescriptorTableInHeap(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations,
+                                     /*output*/ unsigned& out_first_index, RHIGPUDescriptorHandle& out_gpu_handle);
+    // Contiguous range owned by the caller, whose views are written with CreateTextureDescriptorAt.
+    bool AllocateDescriptorRange(unsigned count, /*output*/ unsigned& out_first_index, RHIGPUDescriptorHandle& out_gpu_handle);
+    // Recreates the view of the allocation at descriptor_index. Only shader resource and unordered access views.
+    bool CreateTextureDescriptorAt(IRHIDevice& device, unsigned descriptor_index, const IRHITextureDescriptorAllocation& descriptor_allocation,
+                                   /*output*/ RHIGPUDescriptorHandle& out_gpu_handle);
+    // Frees the descriptors of the resource; their slots are reused once the current frame has completed.
     void InvalidateResourceDescriptors(ID3D12Resource* resource);
+    void FreeDescriptors(unsigned first_index, unsigned count);
+    // Called once the frame slot fence of frame_index has been waited, so that frames older than
+    // frame_slot_count have completed on the GPU.
+    void BeginFrame(unsigned long long frame_index, unsigned frame_slot_count);
+
+    // Index of the descriptor from the start of the heap, stable for its lifetime; what a shader indexing
+    // the heap directly uses.
+    unsigned GetDescriptorIndex(RHIGPUDescriptorHandle gpu_handle) const;
 
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
     
@@ -43,7 +64,9 @@ public:
     
 private:
     bool ValidateDescriptorOffset(unsigned descriptor_offset, const char* allocation_type) const;
-    void CommitDescriptorOffset(unsigned descriptor_offset);
+    bool AllocateDescriptorOffset(unsigned count, const char* allocation_type, unsigned& out_descriptor_offset);
+    bool CreateViewInHeap(IRHIDevice& device, unsigned descriptor_offset, ID3D12Resource* resource, const RHIDescriptorDesc& desc,
+                          /*output*/ RHICPUDescriptorHandle& out_CPU_handle, RHIGPUDescriptorHandle& out_GPU_handle);
 
     bool CreateSRVInHeap(IRHIDevice& device, unsigned descriptor_offset, ID3D12Resource* resource, const RHIDescriptorDesc& desc, RHICPUDescriptorHandle
                          & out_CPU_handle,/*output*/ RHIGPUDescriptorHandle& out_GPU_handle);
@@ -56,7 +79,15 @@ private:
     
     ComPtr<ID3D12DescriptorHeap> m_descriptorHeap {nullptr};
     unsigned m_descriptor_increment_size {0};
-    unsigned m_used_descriptor_count {0};
+    RHIDescriptorIndexAllocator m_index_allocator;
+    unsigned long long m_frame_index {0};
 
-    std::map<ID3D12Resource*, std::vector<std::pair<RHIDescriptorDesc, std::pair<RHICPUDescriptorHandle, RHIGPUDescriptorHandle>>>> m_created_descriptors_info;
+    struct CreatedDescriptorInfo
+    {
+        RHIDescriptorDesc desc;
+        RHICPUDescriptorHandle cpu_handle {0};
+        RHIGPUDescriptorHandle gpu_handle {0};
+        unsigned descriptor_offset {0};
+    };
+    std::map<ID3D12Resource*, std::vector<CreatedDescriptorInfo>> m_created_descriptors_info;
 };
@@ -50,9 +50,17 @@ public:
 class RHICORE_API DX12DescriptorTable : public IRHIDescriptorTable
 {
 public:
+    // Fails when the allocations are not adjacent in the heap.
     virtual bool Build(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations) override;
+    // Takes a heap range holding copies of the descriptors, freed with the table.
+    void InitOwnedRange(RHIGPUDescriptorHandle gpu_handle, unsigned first_index, unsigned descriptor_count);
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
 
     RHIGPUDescriptorHandle m_gpu_handle {UINT64_MAX};
+
+protected:
+    unsigned m_owned_first_index {0};
+    unsigned m_owned_descriptor_count {0};
 };
 
 class DX12DescriptorManager : public IRHIDescriptorManager
@@ -63,10 +71,12 @@ public:
     virtual bool Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity) override;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc, std::shared_ptr<IRHIBufferDescriptorAllocation>& out_descriptor_allocation) override;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc, std::shared_ptr<IRHITextureDescriptorAllocation>& out_descriptor_allocation) override;
+    virtual bool CreateDescriptorTable(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations, std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table) override;
 
     virtual bool BindDescriptorContext(IRHICommandList& command_list) override;
     virtual bool BindGUIDescriptorContext(IRHICommandList& command_list) override;
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
+    virtual void BeginFrame(unsigned long long frame_index) override;
 
     void InvalidateResourceDescriptors(ID3D12Resource* resource);
     
@@ -75,6 +85,10 @@ public:
     DX12DescriptorHeap& GetGUIDescriptorHeap() const;
     
 protected:
+    virtual bool WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index, const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation) override;
+
+    // Heap range the bindless texture table starts at; bindless index i lives at heap index first + i.
+    unsigned m_bindless_texture_first_index {0};
     std::shared_ptr<DX12DescriptorHeap> m_CBV_SRV_UAV_gpu_heap {nullptr};
     std::shared_ptr<DX12DescriptorHeap> m_CBV_SRV_UAV_cpu_heap {nullptr};
     std::shared_ptr<DX12DescriptorHeap> m_RTV_heap {nullptr};
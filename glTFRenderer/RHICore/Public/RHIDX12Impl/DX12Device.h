@@ -4,6 +4,7 @@
 
 #include "RHIInterface/IRHIDevice.h"
 #include "DX12Common.h"
+#include "DX12PipelineCache.h"
 
 class RHICORE_API DX12Device : public IRHIDevice
 {
@@ -21,10 +22,13 @@ public:
     IDXGIAdapter1* GetAdapter() {return m_adapter.Get(); }
     const IDXGIAdapter1* GetAdapter() const {return m_adapter.Get(); }
 
+    DX12PipelineCache& GetPipelineCache() { return m_pipeline_cache; }
+
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
     
 private:
     ComPtr<ID3D12Device> m_device;
     ComPtr<IDXGIAdapter1> m_adapter;
     ComPtr<ID3D12Device5> m_dxr_device;
+    DX12PipelineCache m_pipeline_cache;
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include "DX12Common.h"
 #include "RHIInterface/IRHIMemoryManager.h"
 
 class RHICORE_API DX12BufferAllocation : public IRHIBufferAllocation
@@ -14,6 +15,14 @@ public:
     IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(DX12TextureAllocation)
 };
 
+class RHICORE_API DX12HeapAllocation : public IRHIHeapAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(DX12HeapAllocation)
+
+    ComPtr<ID3D12Heap> m_heap {nullptr};
+};
+
 class RHICORE_API DX12MemoryManager : public IRHIMemoryManager
 {
 public:
@@ -24,6 +33,10 @@ public:
     virtual bool DownloadBufferData(IRHIBufferAllocation& buffer_allocation, void* data, size_t size) override;
     virtual bool AllocateTextureMemory(IRHIDevice& device, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) override;
     virtual bool ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation) override;
+
+    virtual bool GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc, unsigned long long& out_size_bytes, unsigned long long& out_alignment) override;
+    virtual bool AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment, std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation) override;
+    virtual bool AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation, unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) override;
     
 protected:
     virtual bool UploadBufferDataInner(IRHIBufferAllocation& buffer_allocation, const void* data, size_t dst_offset, size_t size) override;
@@ -0,0 +1,40 @@
+#pragma once
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "DX12Common.h"
+#include "RHIPipelineCache.h"
+
+// ID3D12PipelineLibrary persisted with RHIPipelineCacheFile. Pipelines are stored under the name of their
+// RHIPipelineCacheKeyBuilder key; a load that misses compiles the pipeline and stores it for the next launch.
+// Without a library (cache disabled or unsupported by the driver) pipelines are compiled directly.
+class DX12PipelineCache
+{
+public:
+    bool Init(ID3D12Device* device, IDXGIAdapter1* adapter);
+    // Writes the library back to disk when pipelines were stored since it was loaded.
+    bool Save();
+    void Release();
+
+    bool CreateGraphicsPipelineState(ID3D12Device* device, const std::wstring& name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, ComPtr<ID3D12PipelineState>& out_pipeline_state);
+    bool CreateComputePipelineState(ID3D12Device* device, const std::wstring& name, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, ComPtr<ID3D12PipelineState>& out_pipeline_state);
+
+    unsigned GetHitCount() const { return m_hit_count; }
+    unsigned GetMissCount() const { return m_miss_count; }
+    
+private:
+    void StorePipeline(const std::wstring& name, ID3D12PipelineState* pipeline_state);
+    
+    ComPtr<ID3D12PipelineLibrary> m_pipeline_library;
+    // The library reads pipelines from this memory for as long as it lives.
+    std::vector<unsigned char> m_library_payload;
+    RHIPipelineCacheIdentity m_identity {};
+    std::filesystem::path m_file_path;
+    // Loads of the same pipeline from several threads must not overlap.
+    std::mutex m_library_mutex;
+    bool m_dirty {false};
+    unsigned m_hit_count {0};
+    unsigned m_miss_count {0};
+};
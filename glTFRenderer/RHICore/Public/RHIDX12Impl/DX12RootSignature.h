@@ -43,9 +43,12 @@ public:
     
     virtual bool InitRootSignature(IRHIDevice& device, IRHIDescriptorManager& descriptor_manager) override;
     ID3D12RootSignature* GetRootSignature() const;
+    // Hash of the serialized root signature, part of the pipeline cache key of every pipeline using it.
+    unsigned long long GetSerializedHash() const { return m_serialized_hash; }
 
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
     
 private:
     ComPtr<ID3D12RootSignature> m_root_signature;
+    unsigned long long m_serialized_hash {0};
 };
@@ -0,0 +1,21 @@
+#pragma once
+#include "DX12Common.h"
+#include "RHIInterface/IRHISemaphore.h"
+
+// Cross-queue semaphore on top of a fence: every signal bumps the value, waits block on the last signaled one.
+class RHICORE_API DX12Semaphore : public IRHISemaphore
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(DX12Semaphore)
+
+    virtual bool InitSemaphore(IRHIDevice& device) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+
+    bool SignalOnQueue(ID3D12CommandQueue& command_queue);
+    // Returns immediately on the GPU when nothing has been signaled yet.
+    bool WaitOnQueue(ID3D12CommandQueue& command_queue) const;
+
+private:
+    ComPtr<ID3D12Fence> m_fence {nullptr};
+    UINT64 m_signal_value {0};
+};
@@ -11,6 +11,10 @@ public:
 
     bool InitFromExternalResource(ID3D12Resource* raw_resource, const RHITextureDesc& desc);
     bool CreateTexture(IRHIDevice& device, const RHITextureDesc& desc);
+    // Places the texture at offset inside heap, which is kept alive with the texture.
+    bool CreatePlacedTexture(IRHIDevice& device, ID3D12Heap* heap, unsigned long long offset, const RHITextureDesc& desc);
+    
+    static D3D12_RESOURCE_DESC GetResourceDesc(const RHITextureDesc& desc);
     
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
     
@@ -18,5 +22,8 @@ public:
     const ID3D12Resource* GetRawResource() const;
     
 protected:
+    bool FinishCreateTexture(ID3D12Device* device, const RHITextureDesc& desc);
+    
     ComPtr<ID3D12Resource> m_buffer {nullptr};
+    ComPtr<ID3D12Heap> m_placed_heap {nullptr};
 };
@@ -52,7 +52,9 @@ public:
     
     virtual bool AddBufferBarrierToCommandList(IRHICommandList& command_list, const IRHIBuffer& buffer, RHIResourceStateType beforeState, RHIResourceStateType afterState) override;
     virtual bool AddTextureBarrierToCommandList(IRHICommandList& command_list, IRHITexture& buffer, RHIResourceStateType beforeState, RHIResourceStateType afterState) override;
+    virtual bool AddBarriersToCommandList(IRHICommandList& command_list, const std::vector<RHITextureBarrierDesc>& texture_barriers, const std::vector<RHIBufferBarrierDesc>& buffer_barriers) override;
     virtual bool AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture) override;
+    virtual bool AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture) override;
     
     virtual bool DrawInstanced(IRHICommandList& command_list, unsigned vertex_count_per_instance, unsigned instance_count, unsigned start_vertex_location, unsigned start_instance_location) override;
     virtual bool DrawIndexInstanced(IRHICommandList& command_list, unsigned index_count_per_instance, unsigned instance_count, unsigned start_index_location, unsigned base_vertex_location, unsigned start_instance_location) override;
@@ -70,6 +72,7 @@ public:
     virtual bool ClearUAVTexture(IRHICommandList& command_list, const IRHITextureDescriptorAllocation& texture_descriptor) override;
     
     virtual bool SupportRayTracing(IRHIDevice& device) override;
+    virtual bool SupportAsyncCompute(IRHIDevice& device) override;
     virtual unsigned GetAlignmentSizeForUAVCount(unsigned size ) override;
 
     virtual void ReportLiveObjects() override;
@@ -82,6 +85,7 @@ public:
     virtual bool EndTimestampFrame(IRHICommandList& command_list, unsigned frame_slot, unsigned query_count) override;
     virtual bool ResolveTimestampFrame(unsigned frame_slot, unsigned query_count, std::vector<uint64_t>& out_timestamps, double& out_ticks_per_second) override;
     virtual bool IsTimestampProfilerSupported() const override;
+    virtual bool CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms) override;
     
     // DX12 private implementation
     static DX12Utils& DX12Instance();
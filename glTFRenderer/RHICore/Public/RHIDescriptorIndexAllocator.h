@@ -0,0 +1,60 @@
+#pragma once
+
+#include <deque>
+#include <map>
+
+// Index allocator for a fixed-capacity descriptor heap. Free indices are kept as coalesced ranges and
+// handed out first fit from the lowest index, so ranges for descriptor tables stay contiguous and the used
+// region stays compact. Freed ranges are only reused once the GPU can no longer read them: Free records the
+// frame the range was last referenced in, and ReclaimCompletedFrames returns ranges whose frame has
+// completed. The indices are the stable descriptor heap indices shaders can address; DX12DescriptorHeap and
+// the bindless texture table of IRHIDescriptorManager write their descriptors at the indices handed out here.
+class RHIDescriptorIndexAllocator
+{
+public:
+    static constexpr unsigned INVALID_INDEX = 0xffffffffu;
+
+    void Init(unsigned capacity);
+    void Reset();
+
+    // Contiguous range of count indices, or false when no free range is large enough.
+    bool Allocate(unsigned count, unsigned& out_index);
+    // The range becomes allocatable again after ReclaimCompletedFrames has passed frame_index. A range that is
+    // out of bounds or already free is logged and rejected, leaving the allocator unchanged.
+    bool Free(unsigned index, unsigned count, unsigned long long frame_index);
+    // Returns the ranges freed in frames up to and including completed_frame_index.
+    void ReclaimCompletedFrames(unsigned long long completed_frame_index);
+    // Makes every pending range allocatable, for when the device is idle.
+    void ReclaimAll();
+
+    unsigned GetCapacity() const { return m_capacity; }
+    // Indices handed out and not freed yet.
+    unsigned GetAllocatedCount() const { return m_allocated_count; }
+    // Freed indices waiting for their frame to complete.
+    unsigned GetPendingFreeCount() const { return m_pending_free_count; }
+    // One past the highest index ever handed out.
+    unsigned GetHighWaterMark() const { return m_high_water_mark; }
+    unsigned GetLargestFreeRange() const;
+    unsigned GetFreeRangeCount() const { return static_cast<unsigned>(m_free_ranges.size()); }
+
+private:
+    struct PendingFree
+    {
+        unsigned index{0};
+        unsigned count{0};
+        unsigned long long frame_index{0};
+    };
+
+    bool OverlapsFreeRange(unsigned index, unsigned count) const;
+    bool OverlapsPendingFree(unsigned index, unsigned count) const;
+    bool InsertFreeRange(unsigned index, unsigned count);
+
+    unsigned m_capacity{0};
+    unsigned m_allocated_count{0};
+    unsigned m_pending_free_count{0};
+    unsigned m_high_water_mark{0};
+    // First index to range length, non-adjacent.
+    std::map<unsigned, unsigned> m_free_ranges;
+    // In Free order, which is non-decreasing in frame_index.
+    std::deque<PendingFree> m_pending_frees;
+};
@@ -6,4 +6,10 @@ class RHICORE_API IRHICommandAllocator : public IRHIResource
 {
 public:
     virtual bool InitCommandAllocator(IRHIDevice& device, RHICommandAllocatorType type) = 0;
+
+    // Command lists created from this allocator are of the same type.
+    RHICommandAllocatorType GetType() const { return m_type; }
+
+protected:
+    RHICommandAllocatorType m_type {RHICommandAllocatorType::DIRECT};
 };
@@ -28,6 +28,10 @@ public:
     RHICommandListState GetState() const;
     void SetFrameSlotIndex(unsigned frame_slot_index);
     unsigned GetFrameSlotIndex() const;
+    // When set, resource Transition() calls on this list are no-ops: the caller records every barrier
+    // itself and owns the tracked states, e.g. while recording on a worker thread.
+    void SetExternalResourceStateTracking(bool enable);
+    bool IsExternalResourceStateTracking() const;
     
 protected:
     std::shared_ptr<IRHISemaphore> m_finished_semaphore;
@@ -35,4 +39,5 @@ protected:
 
     RHICommandListState m_state {RHICommandListState::Closed};
     unsigned m_frame_slot_index {0};
+    bool m_external_resource_state_tracking {false};
 };
@@ -5,6 +5,10 @@
 class RHICORE_API IRHICommandQueue : public IRHIResource
 {
 public:
-    virtual bool InitCommandQueue(IRHIDevice& device) = 0;
+    virtual bool InitCommandQueue(IRHIDevice& device, RHICommandQueueType type) = 0;
+
+    RHICommandQueueType GetType() const { return m_type; }
+
+protected:
+    RHICommandQueueType m_type {RHICommandQueueType::GRAPHICS};
 };
- 
\ No newline at end of file
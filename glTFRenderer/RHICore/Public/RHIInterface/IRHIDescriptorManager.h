@@ -4,6 +4,7 @@
 
 #include "RHIInterface/IRHIResource.h"
 #include "RHICommon.h"
+#include "RHIDescriptorIndexAllocator.h"
 
 class IRHICommandList;
 class IRHIRenderTarget;
@@ -70,14 +71,42 @@ public:
     virtual bool Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity) = 0;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc, std::shared_ptr<IRHIBufferDescriptorAllocation>& out_descriptor_allocation) = 0;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc, std::shared_ptr<IRHITextureDescriptorAllocation>& out_descriptor_allocation) = 0;
+    // Table over the allocations in order. Heap-based backends copy the descriptors into a range the table
+    // owns when they are not adjacent in the heap.
+    virtual bool CreateDescriptorTable(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations, std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table) = 0;
 
     virtual bool BindDescriptorContext(IRHICommandList& command_list) = 0;
     virtual bool BindGUIDescriptorContext(IRHICommandList& command_list) = 0;
 
+    // Puts the shader resource view into the bindless texture table. The returned index is stable until the
+    // texture is unregistered; shaders use it to index the unbounded texture array the table is bound to.
+    // Only for textures that stay in the shader resource state, so binding the table needs no transitions.
+    bool RegisterBindlessTexture(IRHIDevice& device, const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation, unsigned& out_bindless_index);
+    // The index is handed out again once the frames that could still read it have completed.
+    bool UnregisterBindlessTexture(unsigned bindless_index);
+    // One table over every registered texture, shared by all passes.
+    std::shared_ptr<IRHIDescriptorTable> GetBindlessTextureTable() const;
+    const RHIDescriptorIndexAllocator& GetBindlessTextureIndexAllocator() const { return m_bindless_texture_indices; }
+
     void SetFrameSlotCount(unsigned frame_slot_count);
     unsigned GetFrameSlotCount() const;
+    // Called with the frame about to be recorded once its frame slot fence has been waited, so descriptors
+    // freed GetFrameSlotCount() frames ago can be reused.
+    virtual void BeginFrame(unsigned long long frame_index);
+
+    // Vulkan sizes unbounded descriptor arrays to this count, so the bindless table never holds more.
+    static constexpr unsigned MAX_BINDLESS_TEXTURE_COUNT = 1024;
 
 protected:
+    // Called by the backend Init with the table shaders see the bindless textures through.
+    void InitBindlessTextureTable(std::shared_ptr<IRHIDescriptorTable> bindless_texture_table);
+    virtual bool WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index, const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation) = 0;
+    virtual void ClearBindlessTexture(unsigned bindless_index) {}
+
     // Backends with frame-buffered descriptor state use this to size per-frame storage explicitly.
     unsigned m_frame_slot_count{1};
+    unsigned long long m_frame_index{0};
+
+    std::shared_ptr<IRHIDescriptorTable> m_bindless_texture_table;
+    RHIDescriptorIndexAllocator m_bindless_texture_indices;
 };
@@ -4,6 +4,7 @@
 #include "RHIInterface/IRHIDescriptorManager.h"
 #include "RHIInterface/IRHIMemoryAllocator.h"
 #include "RHIInterface/IRHITexture.h"
+#include "RHIUploadRingAllocator.h"
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -17,6 +18,7 @@ public:
     {
         BUFFER,
         TEXTURE,
+        HEAP,
     };
     
     IRHIMemoryAllocation(AllocationType type)
@@ -36,6 +38,22 @@ protected:
     const AllocationType m_allocation_type;
 };
 
+// Device memory that textures are placed in. Textures placed at overlapping ranges alias each other: only the
+// one activated by the last aliasing barrier over the range holds defined contents.
+class RHICORE_API IRHIHeapAllocation : public IRHIMemoryAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_VDTOR(IRHIHeapAllocation)
+    IRHIHeapAllocation() :
+        IRHIMemoryAllocation(AllocationType::HEAP)
+    {
+        
+    }
+
+    unsigned long long m_size_bytes {0};
+    unsigned long long m_alignment {0};
+};
+
 class RHICORE_API IRHIBufferAllocation : public IRHIMemoryAllocation
 {
 public:
@@ -60,6 +78,9 @@ public:
     }
 
     std::shared_ptr<IRHITexture> m_texture {nullptr};
+    // Set for textures placed in a heap, which must outlive them.
+    std::shared_ptr<IRHIHeapAllocation> m_heap {nullptr};
+    unsigned long long m_heap_offset {0};
 };
 
 struct RHICORE_API DescriptorAllocationInfo
@@ -144,6 +165,12 @@ public:
     virtual bool ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation) = 0;
     virtual bool ReleaseAllResource();
 
+    // Placed textures. The requirements are the size and alignment a texture of the desc takes inside a heap;
+    // heaps only hold render target and depth stencil textures.
+    virtual bool GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc, unsigned long long& out_size_bytes, unsigned long long& out_alignment) = 0;
+    virtual bool AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment, std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation) = 0;
+    virtual bool AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation, unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) = 0;
+
     bool AllocateTextureMemoryAndUpload(IRHIDevice& device, IRHICommandList& command_list, IRHIMemoryManager& memory_manager, const RHITextureDesc& buffer_desc, std::shared_ptr<IRHITextureAllocation>& out_buffer_allocation);
     
     IRHIDescriptorManager& GetDescriptorManager() const;
@@ -152,13 +179,35 @@ public:
     void TrackTempUploadBufferUsage(IRHICommandList& command_list, const std::shared_ptr<IRHIBufferAllocation>& upload_buffer);
     
 protected:
+    enum
+    {
+        UPLOAD_RING_INITIAL_CHUNK_SIZE = 4 * 1024 * 1024,
+        // Larger uploads (meshes, initial buffer contents) keep going through the temp buffer pool.
+        UPLOAD_RING_MAX_ALLOCATION_SIZE = 1024 * 1024,
+        // Constant buffer placement alignment, so a sub-allocation can also back a constant buffer view.
+        UPLOAD_RING_ALLOCATION_ALIGNMENT = 256,
+    };
+    
     static RHIBufferDesc MakeTempUploadBufferDesc(const RHIBufferDesc& dst_buffer_desc, size_t upload_size);
     virtual bool UploadBufferDataInner(IRHIBufferAllocation& buffer_allocation, const void* data, size_t offset, size_t size) = 0;
 
+    // Sub-allocates staging memory from the upload ring, protected by the command list's next fence signal.
+    bool AllocateUploadRingMemory(IRHIDevice& device, IRHICommandList& command_list, size_t size,
+        std::shared_ptr<IRHIBufferAllocation>& out_chunk_buffer, size_t& out_offset);
+    bool AddUploadRingChunk(IRHIDevice& device, size_t min_size);
+    void ReclaimUploadRing();
+    void TickUploadRing();
+    unsigned GetUploadRingFenceSource(const std::shared_ptr<IRHIFence>& fence);
+
     RHITempBufferPool m_temp_buffer_pool;
+    RHIUploadRingAllocator m_upload_ring;
+    std::unordered_map<unsigned, std::shared_ptr<IRHIBufferAllocation>> m_upload_ring_chunks;
+    // Indexed by RHIUploadRingAllocator::RetireTag::source.
+    std::vector<std::shared_ptr<IRHIFence>> m_upload_ring_fences;
     
     std::vector<std::shared_ptr<IRHIBufferAllocation>> m_buffer_allocations;
     std::vector<std::shared_ptr<IRHITextureAllocation>> m_texture_allocations;
+    std::vector<std::shared_ptr<IRHIHeapAllocation>> m_heap_allocations;
     
     std::shared_ptr<IRHIDescriptorManager> m_descriptor_manager;
 };
@@ -14,6 +14,8 @@ public:
      virtual bool InitRenderTargetManager(IRHIDevice& device, size_t max_render_target_count) = 0;
      
      virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTarget(IRHIDevice& device, IRHIMemoryManager& memory_manager, const RHITextureDesc& desc, RHIDataFormat format = RHIDataFormat::UNKNOWN) = 0;
+     // Views a texture the caller allocated, such as one placed in a heap. The caller keeps the allocation.
+     virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTargetFromTexture(IRHIDevice& device, IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format = RHIDataFormat::UNKNOWN) = 0;
      virtual std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> CreateRenderTargetFromSwapChain(IRHIDevice& device, IRHIMemoryManager& memory_manager, IRHISwapChain& swap_chain, RHITextureClearValue clear_value) = 0;
      virtual bool ReleaseSwapchainRenderTargets(IRHIMemoryManager& memory_manager) { return true; }
      virtual bool ClearRenderTarget(IRHICommandList& command_list, const std::vector<IRHIDescriptorAllocation*>& render_targets) = 0;
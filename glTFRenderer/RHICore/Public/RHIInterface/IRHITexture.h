@@ -20,6 +20,8 @@ public:
     
     bool Transition(IRHICommandList& command_list, RHIResourceStateType new_state);
     RHIResourceStateType GetState() const;
+    // Only for barriers recorded outside Transition(), e.g. batched by the render graph.
+    void SetState(RHIResourceStateType state);
     bool CanReadBack() const;
     
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
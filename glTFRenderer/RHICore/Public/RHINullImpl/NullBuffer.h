@@ -0,0 +1,24 @@
+#pragma once
+#include <vector>
+
+#include "NullCommandList.h"
+#include "RHIInterface/IRHIBuffer.h"
+
+// Upload and readback buffers keep their bytes on the CPU so mapped writes and readbacks behave; default
+// buffers only keep their description.
+class RHICORE_API NullBuffer : public IRHIBuffer
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullBuffer)
+    
+    bool CreateBuffer(const RHIBufferDesc& desc);
+    bool UploadBufferFromCPU(const void* data, size_t dst_offset, size_t size);
+    bool DownloadBufferToCPU(void* data, size_t size) const;
+
+    // Barriers are recorded through const buffer references.
+    RHINullResourceState& GetDeviceState() const { return m_device_state; }
+    
+private:
+    std::vector<unsigned char> m_host_data;
+    mutable RHINullResourceState m_device_state;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include "RHIInterface/IRHICommandAllocator.h"
+
+class RHICORE_API NullCommandAllocator : public IRHICommandAllocator
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullCommandAllocator)
+    
+    virtual bool InitCommandAllocator(IRHIDevice& device, RHICommandAllocatorType type) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <vector>
+
+#include "RHIInterface/IRHICommandList.h"
+
+enum class RHINullCommandType
+{
+    BEGIN_RENDER_PASS,
+    END_RENDER_PASS,
+    BEGIN_RENDERING,
+    END_RENDERING,
+    SET_PIPELINE_STATE,
+    SET_ROOT_SIGNATURE,
+    SET_VIEWPORT,
+    SET_SCISSOR_RECT,
+    SET_VERTEX_BUFFER_VIEW,
+    SET_INDEX_BUFFER_VIEW,
+    SET_PRIMITIVE_TOPOLOGY,
+    SET_CONSTANTS,
+    BIND_DESCRIPTOR,
+    BIND_DESCRIPTOR_TABLE,
+    BIND_RENDER_TARGET,
+    CLEAR_RENDER_TARGET,
+    BUFFER_BARRIER,
+    TEXTURE_BARRIER,
+    UAV_BARRIER,
+    ALIASING_BARRIER,
+    DRAW_INSTANCED,
+    DRAW_INDEXED_INSTANCED,
+    DISPATCH,
+    TRACE_RAY,
+    EXECUTE_INDIRECT,
+    COPY_TEXTURE,
+    COPY_BUFFER_TO_TEXTURE,
+    COPY_BUFFER,
+    CLEAR_UAV,
+    RENDER_GUI,
+    COUNT,
+};
+
+// object is the main RHI object the command references; args hold its scalar arguments in call order.
+struct RHINullCommand
+{
+    RHINullCommandType type {RHINullCommandType::COUNT};
+    const void* object {nullptr};
+    unsigned long long args[4] {};
+};
+
+// State the recorded barriers leave a resource in, checked against the before state of its next barrier.
+struct RHINullResourceState
+{
+    bool known {false};
+    RHIResourceStateType state {RHIResourceStateType::STATE_UNDEFINED};
+    // Set between the BEGIN_ONLY and END_ONLY halves of a split barrier.
+    bool split_pending {false};
+    RHIResourceStateType split_before_state {RHIResourceStateType::STATE_UNDEFINED};
+    RHIResourceStateType split_after_state {RHIResourceStateType::STATE_UNDEFINED};
+};
+
+// Records commands into a CPU-side stream that stays inspectable until the list is reset.
+class RHICORE_API NullCommandList : public IRHICommandList
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullCommandList)
+    
+    virtual bool InitCommandList(IRHIDevice& device, IRHICommandAllocator& command_allocator) override;
+    virtual bool WaitCommandList() override;
+    virtual bool BeginRecordCommandList() override;
+    virtual bool EndRecordCommandList() override;
+
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+
+    // False when the list is not recording; the command is dropped.
+    bool RecordCommand(const RHINullCommand& command);
+    const std::vector<RHINullCommand>& GetRecordedCommands() const { return m_commands; }
+    unsigned GetRecordedCommandCount(RHINullCommandType type) const;
+    
+private:
+    std::vector<RHINullCommand> m_commands;
+    unsigned m_command_counts[static_cast<unsigned>(RHINullCommandType::COUNT)] {};
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include "RHIInterface/IRHICommandQueue.h"
+
+class RHICORE_API NullCommandQueue : public IRHICommandQueue
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullCommandQueue)
+    
+    virtual bool InitCommandQueue(IRHIDevice& device, RHICommandQueueType type) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+
+    void NotifyCommandListExecuted(size_t command_count);
+    
+    unsigned long long GetExecutedCommandListCount() const { return m_executed_command_list_count; }
+    unsigned long long GetExecutedCommandCount() const { return m_executed_command_count; }
+    
+private:
+    unsigned long long m_executed_command_list_count {0};
+    unsigned long long m_executed_command_count {0};
+};
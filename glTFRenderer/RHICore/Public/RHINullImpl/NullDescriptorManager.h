@@ -0,0 +1,64 @@
+#pragma once
+#include "RHIInterface/IRHIDescriptorManager.h"
+
+class NullBufferDescriptorAllocation : public IRHIBufferDescriptorAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullBufferDescriptorAllocation)
+    
+    virtual bool InitFromBuffer(const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc) override;
+};
+
+class NullAccelerationStructureDescriptorAllocation : public IRHIAccelerationStructureDescriptorAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullAccelerationStructureDescriptorAllocation)
+
+    bool InitFromAccelerationStructure(uint64_t acceleration_handle) override;
+    uint64_t GetAccelerationStructureHandle() const override;
+
+protected:
+    uint64_t m_acceleration_structure_handle {0};
+};
+
+class NullTextureDescriptorAllocation : public IRHITextureDescriptorAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullTextureDescriptorAllocation)
+
+    bool InitFromTexture(const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc);
+};
+
+class RHICORE_API NullDescriptorTable : public IRHIDescriptorTable
+{
+public:
+    virtual bool Build(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations) override;
+
+    unsigned GetDescriptorCount() const { return m_descriptor_count; }
+    
+protected:
+    unsigned m_descriptor_count {0};
+};
+
+// Descriptors are plain views over the source resource; there is no heap to run out of.
+class RHICORE_API NullDescriptorManager : public IRHIDescriptorManager
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullDescriptorManager)
+
+    virtual bool Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity) override;
+    virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc, std::shared_ptr<IRHIBufferDescriptorAllocation>& out_descriptor_allocation) override;
+    virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc, std::shared_ptr<IRHITextureDescriptorAllocation>& out_descriptor_allocation) override;
+    virtual bool CreateDescriptorTable(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations, std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table) override;
+
+    virtual bool BindDescriptorContext(IRHICommandList& command_list) override;
+    virtual bool BindGUIDescriptorContext(IRHICommandList& command_list) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+
+    unsigned long long GetCreatedDescriptorCount() const { return m_created_descriptor_count; }
+    
+protected:
+    virtual bool WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index, const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation) override;
+
+    unsigned long long m_created_descriptor_count {0};
+};
@@ -0,0 +1,12 @@
+#pragma once
+#include "RHIInterface/IRHIDescriptorUpdater.h"
+
+class RHICORE_API NullDescriptorUpdater : public IRHIDescriptorUpdater
+{
+public:
+    virtual bool BindDescriptor(IRHICommandList& command_list, RHIPipelineType pipeline, const RootSignatureAllocation& root_signature_allocation, const IRHIDescriptorAllocation& descriptor) override;
+    virtual bool BindDescriptor(IRHICommandList& command_list, RHIPipelineType pipeline, const RootSignatureAllocation& root_signature_allocation, const IRHIDescriptorTable& descriptor_table, RHIDescriptorRangeType
+                                            descriptor_type) override;
+
+    virtual bool FinalizeUpdateDescriptors(IRHIDevice& device, IRHICommandList& command_list, IRHIRootSignature& root_signature) override;
+};
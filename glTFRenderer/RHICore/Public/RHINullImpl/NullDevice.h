@@ -0,0 +1,11 @@
+#pragma once
+#include "RHIInterface/IRHIDevice.h"
+
+class RHICORE_API NullDevice : public IRHIDevice
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullDevice)
+
+    virtual bool InitDevice(IRHIFactory& factory) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include "RHIInterface/IRHIFactory.h"
+
+class RHICORE_API NullFactory : public IRHIFactory
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullFactory)
+    
+    virtual bool InitFactory() override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
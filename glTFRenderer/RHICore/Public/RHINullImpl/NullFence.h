@@ -0,0 +1,21 @@
+#pragma once
+#include "RHIInterface/IRHIFence.h"
+
+// Completes every signal as soon as it is submitted, so host waits never block.
+class RHICORE_API NullFence : public IRHIFence
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullFence)
+    
+    virtual bool InitFence(IRHIDevice& device) override;
+    virtual bool HostWaitUtilSignaled() override;
+    virtual bool ResetFence() override;
+    virtual unsigned long long PredictNextSignalValue() const override;
+    virtual void NotifySignalSubmitted(unsigned long long signal_value) override;
+    virtual bool IsSignalValueCompleted(unsigned long long signal_value) const override;
+    
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+    
+private:
+    unsigned long long m_last_signal_value {0};
+};
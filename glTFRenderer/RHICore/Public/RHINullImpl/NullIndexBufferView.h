@@ -0,0 +1,10 @@
+#pragma once
+#include "RHIInterface/IRHIIndexBufferView.h"
+
+class RHICORE_API NullIndexBufferView : public IRHIIndexBufferView
+{
+public:
+    virtual bool InitIndexBufferView(IRHIBuffer& buffer, const RHIIndexBufferViewDesc& desc) override;
+
+    const IRHIBuffer* m_buffer {nullptr};
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include "RHIInterface/IRHIMemoryAllocator.h"
+
+class RHICORE_API NullMemoryAllocator : public IRHIMemoryAllocator
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullMemoryAllocator)
+    
+    virtual bool InitMemoryAllocator(const IRHIFactory& factory, const IRHIDevice& device) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
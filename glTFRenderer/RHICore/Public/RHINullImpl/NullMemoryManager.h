@@ -0,0 +1,51 @@
+#pragma once
+#include <memory>
+#include "RHIInterface/IRHIMemoryManager.h"
+
+class RHICORE_API NullBufferAllocation : public IRHIBufferAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullBufferAllocation)
+};
+
+class RHICORE_API NullTextureAllocation : public IRHITextureAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullTextureAllocation)
+};
+
+class RHICORE_API NullHeapAllocation : public IRHIHeapAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullHeapAllocation)
+};
+
+// Hands out fake buffers and textures and counts the bytes they would occupy on the device.
+class RHICORE_API NullMemoryManager : public IRHIMemoryManager
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullMemoryManager)
+    
+    virtual bool AllocateBufferMemory(IRHIDevice& device, const RHIBufferDesc& buffer_desc, std::shared_ptr<IRHIBufferAllocation>& out_buffer_allocation) override;
+    virtual bool DownloadBufferData(IRHIBufferAllocation& buffer_allocation, void* data, size_t size) override;
+    virtual bool AllocateTextureMemory(IRHIDevice& device, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) override;
+    virtual bool ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation) override;
+    virtual bool ReleaseAllResource() override;
+
+    // Placement uses the texture's copy size rounded up to 64KB, the default DX12 placement alignment.
+    virtual bool GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc, unsigned long long& out_size_bytes, unsigned long long& out_alignment) override;
+    virtual bool AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment, std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation) override;
+    virtual bool AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation, unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) override;
+
+    size_t GetAllocatedBufferSize() const { return m_allocated_buffer_size; }
+    // Committed textures only; placed textures are counted through their heaps.
+    size_t GetAllocatedTextureSize() const { return m_allocated_texture_size; }
+    size_t GetAllocatedHeapSize() const { return m_allocated_heap_size; }
+    
+protected:
+    virtual bool UploadBufferDataInner(IRHIBufferAllocation& buffer_allocation, const void* data, size_t dst_offset, size_t size) override;
+
+    size_t m_allocated_buffer_size {0};
+    size_t m_allocated_texture_size {0};
+    size_t m_allocated_heap_size {0};
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include "RHIInterface/IRHIPipelineStateObject.h"
+
+class RHICORE_API NullGraphicsPipelineStateObject : public IRHIGraphicsPipelineStateObject
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullGraphicsPipelineStateObject)
+    
+    virtual bool BindRenderTargetFormats(const std::vector<RHIDataFormat>& render_target_formats) override;
+    virtual bool InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature, IRHISwapChain& swap_chain, const std::map<RHIShaderType,
+                                         std::shared_ptr<IRHIShader>>& shaders) override;
+
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+
+    const std::vector<RHIDataFormat>& GetRenderTargetFormats() const { return m_bind_render_target_formats; }
+    
+private:
+    std::vector<RHIDataFormat> m_bind_render_target_formats;
+};
+
+class RHICORE_API NullComputePipelineStateObject : public IRHIComputePipelineStateObject
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullComputePipelineStateObject)
+    
+    virtual bool InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature, IRHISwapChain& swap_chain, const std::map<RHIShaderType,
+                                         std::shared_ptr<IRHIShader>>& shaders) override;
+
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
+
+class RHICORE_API NullRTPipelineStateObject : public IRHIRayTracingPipelineStateObject
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullRTPipelineStateObject)
+    
+    virtual bool InitPipelineStateObject(IRHIDevice& device, const IRHIRootSignature& root_signature, IRHISwapChain& swap_chain, const std::map<RHIShaderType,
+                                         std::shared_ptr<IRHIShader>>& shaders) override;
+
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include "RHIInterface/IRHIRayTracingAS.h"
+
+class NullAccelerationStructureDescriptorAllocation;
+
+class RHICORE_API NullRayTracingAS : public IRHIRayTracingAS
+{
+public:
+    NullRayTracingAS();
+    
+    virtual void SetRayTracingSceneDesc(const RHIRayTracingSceneDesc& scene_desc) override;
+    virtual bool InitRayTracingAS(IRHIDevice& device, IRHICommandList& command_list, IRHIMemoryManager& memory_manager) override;
+    virtual const IRHIDescriptorAllocation& GetTLASDescriptorSRV() const override;
+    
+protected:
+    RHIRayTracingSceneDesc m_scene_desc;
+    std::shared_ptr<NullAccelerationStructureDescriptorAllocation> m_tlas_descriptor_allocation;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include "RHIInterface/IRHIRenderPass.h"
+
+class NullRenderPass : public IRHIRenderPass
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullRenderPass)
+    
+    virtual bool InitRenderPass(IRHIDevice& device, const RHIRenderPassInfo& info) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
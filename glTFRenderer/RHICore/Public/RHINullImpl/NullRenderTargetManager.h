@@ -0,0 +1,15 @@
+#pragma once
+#include "RHIInterface/IRHIRenderTargetManager.h"
+
+class RHICORE_API NullRenderTargetManager : public IRHIRenderTargetManager
+{
+public:
+    virtual bool InitRenderTargetManager(IRHIDevice& device, size_t max_render_target_count) override;
+     
+    virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTarget(IRHIDevice& device, IRHIMemoryManager& memory_manager, const
+        RHITextureDesc& texture_desc, RHIDataFormat format) override;
+    virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTargetFromTexture(IRHIDevice& device, IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format) override;
+    virtual std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> CreateRenderTargetFromSwapChain(IRHIDevice& device, IRHIMemoryManager& memory_manager, IRHISwapChain& swap_chain, RHITextureClearValue clear_value) override;
+    virtual bool ClearRenderTarget(IRHICommandList& command_list, const std::vector<IRHIDescriptorAllocation*>& render_targets) override;
+    virtual bool BindRenderTarget(IRHICommandList& command_list, const std::vector<IRHIDescriptorAllocation*>& render_targets) override;
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include "RHIInterface/IRHIRootSignature.h"
+
+class NullRootParameter : public IRHIRootParameter
+{
+public:
+    virtual bool InitAsConstant(unsigned constant_value, REGISTER_INDEX_TYPE register_index, unsigned space) override;
+    virtual bool InitAsCBV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space) override;
+    virtual bool InitAsSRV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space) override;
+    virtual bool InitAsUAV(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space) override;
+    virtual bool InitAsAccelerationStructure(unsigned attribute_index, REGISTER_INDEX_TYPE register_index, unsigned space) override;
+    virtual bool InitAsDescriptorTableRange(unsigned attribute_index, size_t range_count, const RHIDescriptorRangeDesc* range_desc) override;
+
+    virtual bool IsBindless() const override;
+    
+protected:
+    bool m_bindless {false};
+};
+
+class NullStaticSampler : public IRHIStaticSampler
+{
+public:
+    virtual bool InitStaticSampler(IRHIDevice& device, unsigned space, REGISTER_INDEX_TYPE register_index, RHIStaticSamplerAddressMode address_mode, RHIStaticSamplerFilterMode filter_mode) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
+
+class NullRootSignature : public IRHIRootSignature
+{
+public:
+    virtual bool InitRootSignature(IRHIDevice& device, IRHIDescriptorManager& descriptor_manager) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+};
@@ -0,0 +1,6 @@
+#pragma once
+#include "RHIInterface/IRHIShader.h"
+
+class NullShader : public IRHIShader
+{
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "RHIInterface/IRHIShaderTable.h"
+
+class RHICORE_API NullShaderTable : public IRHIShaderTable
+{
+public:
+    virtual bool InitShaderTable(IRHIDevice& device, IRHICommandList& command_list, IRHIMemoryManager& memory_manager, IRHIPipelineStateObject& pso, IRHIRayTracingAS& as, const std::vector<RHIShaderBindingTable>& sbts) override;
+
+    size_t GetShaderBindingTableCount() const { return m_sbt_count; }
+    
+protected:
+    size_t m_sbt_count {0};
+};
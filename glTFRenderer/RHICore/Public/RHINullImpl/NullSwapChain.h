@@ -0,0 +1,38 @@
+#pragma once
+#include "RHIInterface/IRHISemaphore.h"
+#include "RHIInterface/IRHISwapChain.h"
+
+class IRHITexture;
+
+// Back buffers are plain null textures; acquire and present only rotate the back buffer index.
+class RHICORE_API NullSwapChain : public IRHISwapChain
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullSwapChain)
+
+    virtual unsigned GetCurrentBackBufferIndex() override;
+    virtual unsigned GetBackBufferCount() override;
+    
+    virtual bool InitSwapChain(IRHIFactory& factory, IRHIDevice& device, IRHICommandQueue& commandQueue, const RHITextureDesc& swap_chain_buffer_desc, const
+                               RHISwapChainDesc& swap_chain_desc) override;
+    virtual bool AcquireNewFrame(IRHIDevice& device) override;
+    
+    virtual IRHISemaphore& GetAvailableFrameSemaphore() override;
+    virtual bool Present(IRHICommandQueue& command_queue, IRHICommandList& command_list) override;
+    virtual bool HostWaitPresentFinished(IRHIDevice& device) override;
+    virtual bool ResizeSwapChain(unsigned width, unsigned height) override;
+    virtual bool Release(IRHIMemoryManager& memory_manager) override;
+    
+    std::shared_ptr<IRHITexture> GetSwapChainTextureByIndex(unsigned index) const;
+    unsigned long long GetPresentCount() const { return m_present_count; }
+    
+protected:
+    bool CreateSwapChainTextures();
+    
+    unsigned m_frame_buffer_count {3};
+    unsigned m_current_frame_index {0};
+    unsigned long long m_present_count {0};
+    
+    std::vector<std::shared_ptr<IRHITexture>> m_swap_chain_textures;
+    std::shared_ptr<IRHISemaphore> m_frame_available_semaphore;
+};
@@ -0,0 +1,17 @@
+#pragma once
+#include "NullCommandList.h"
+#include "RHIInterface/IRHITexture.h"
+
+class RHICORE_API NullTexture : public IRHITexture
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(NullTexture)
+
+    // Fills the copy requirements with the same 256 byte row pitch alignment as the GPU backends.
+    bool CreateTexture(const RHITextureDesc& desc);
+
+    RHINullResourceState& GetDeviceState() const { return m_device_state; }
+    
+private:
+    mutable RHINullResourceState m_device_state;
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include "NullCommandList.h"
+#include "RHIUtils.h"
+
+class DX12Utils;
+
+// Records every operation into the NullCommandList stream instead of touching a device. Barriers are checked
+// against the state each resource was left in by the previously recorded barriers, so missing or mismatched
+// transitions show up as validation errors without a GPU.
+class NullUtils : public RHIUtils
+{
+    friend class RHIResourceFactory;
+    
+public:
+    NullUtils();
+    virtual ~NullUtils();
+    IMPL_NON_COPYABLE(NullUtils)
+    
+    virtual bool InitGraphicsAPI() override;
+    
+    virtual bool InitGUIContext(IRHIDevice& device, IRHICommandQueue& graphics_queue, IRHIDescriptorManager& descriptor_manager, unsigned back_buffer_count) override;
+    virtual bool NewGUIFrame() override;
+    virtual bool RenderGUIFrame(IRHICommandList& command_list) override;
+    virtual bool ExitGUI() override;
+
+    virtual bool BeginRenderPass(IRHICommandList& command_list, const RHIBeginRenderPassInfo& begin_render_pass_info) override;
+    virtual bool EndRenderPass(IRHICommandList& command_list) override;
+    virtual bool BeginRendering(IRHICommandList& command_list, const RHIBeginRenderingInfo& begin_rendering_info) override;
+    virtual bool EndRendering(IRHICommandList& command_list) override;
+    
+    virtual bool ResetCommandList(IRHICommandList& command_list, IRHICommandAllocator& command_allocator, IRHIPipelineStateObject* init_pso) override;
+    virtual bool CloseCommandList(IRHICommandList& command_list) override;
+    virtual bool ExecuteCommandList(IRHICommandList& command_list, IRHICommandQueue& command_queue, const RHIExecuteCommandListContext& context) override;
+    virtual bool ResetCommandAllocator(IRHICommandAllocator& command_allocator) override;
+    virtual bool WaitCommandListFinish(IRHICommandList& command_list) override;
+    virtual bool WaitCommandQueueIdle(IRHICommandQueue& command_queue) override;
+    virtual bool WaitDeviceIdle(IRHIDevice& device) override;
+
+    virtual bool SetPipelineState(IRHICommandList& command_list, IRHIPipelineStateObject& pipeline_state_object) override;
+    virtual bool SetRootSignature(IRHICommandList& command_list, IRHIRootSignature& root_signature, IRHIPipelineStateObject& pipeline_state_object, RHIPipelineType pipeline_type) override;
+    virtual bool SetViewport(IRHICommandList& command_list, const RHIViewportDesc& viewport_desc) override;
+    virtual bool SetScissorRect(IRHICommandList& command_list, const RHIScissorRectDesc& scissor_rect) override;
+
+    virtual bool SetVertexBufferView(IRHICommandList& command_list, unsigned slot, IRHIVertexBufferView& view) override;
+    virtual bool SetIndexBufferView(IRHICommandList& command_list, IRHIIndexBufferView& view) override;
+    virtual bool SetPrimitiveTopology(IRHICommandList& command_list, RHIPrimitiveTopologyType type) override;
+
+    virtual bool SetConstant32BitToRootParameterSlot(IRHICommandList& command_list, unsigned slot_index, unsigned* data, unsigned count, RHIPipelineType pipeline_type) override;
+    
+    virtual bool AddBufferBarrierToCommandList(IRHICommandList& command_list, const IRHIBuffer& buffer, RHIResourceStateType beforeState, RHIResourceStateType afterState) override;
+    virtual bool AddTextureBarrierToCommandList(IRHICommandList& command_list, IRHITexture& texture, RHIResourceStateType beforeState, RHIResourceStateType afterState) override;
+    virtual bool AddBarriersToCommandList(IRHICommandList& command_list, const std::vector<RHITextureBarrierDesc>& texture_barriers, const std::vector<RHIBufferBarrierDesc>& buffer_barriers) override;
+    virtual bool AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture) override;
+    virtual bool AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture) override;
+    
+    virtual bool DrawInstanced(IRHICommandList& command_list, unsigned vertex_count_per_instance, unsigned instance_count, unsigned start_vertex_location, unsigned start_instance_location) override;
+    virtual bool DrawIndexInstanced(IRHICommandList& command_list, unsigned index_count_per_instance, unsigned instance_count, unsigned start_index_location, unsigned base_vertex_location, unsigned start_instance_location) override;
+    virtual bool Dispatch(IRHICommandList& command_list, unsigned X, unsigned Y, unsigned Z) override;
+    virtual bool TraceRay(IRHICommandList& command_list, IRHIShaderTable& shader_table, unsigned X, unsigned Y, unsigned Z) override;
+
+    virtual bool ExecuteIndirect(IRHICommandList& command_list, IRHICommandSignature& command_signature, unsigned max_count, IRHIBuffer& arguments_buffer, unsigned arguments_buffer_offset, unsigned command_stride) override;
+    virtual bool ExecuteIndirect(IRHICommandList& command_list, IRHICommandSignature& command_signature, unsigned max_count, IRHIBuffer& arguments_buffer, unsigned arguments_buffer_offset, IRHIBuffer& count_buffer, unsigned count_buffer_offset, unsigned
+                                 command_stride) override;
+    
+    virtual bool CopyTexture(IRHICommandList& command_list, IRHITexture& dst, IRHITexture& src, const RHICopyTextureInfo& copy_info) override;
+    virtual bool CopyTexture(IRHICommandList& command_list, IRHITexture& dst, IRHIBuffer& src, const RHICopyTextureInfo& copy_info) override;
+    virtual bool CopyBuffer(IRHICommandList& command_list, IRHIBuffer& dst, size_t dst_offset, IRHIBuffer& src, size_t src_offset, size_t size) override;
+    
+    virtual bool ClearUAVTexture(IRHICommandList& command_list, const IRHITextureDescriptorAllocation& texture_descriptor) override;
+    
+    virtual bool SupportRayTracing(IRHIDevice& device) override;
+    virtual bool SupportAsyncCompute(IRHIDevice& device) override;
+    virtual unsigned GetAlignmentSizeForUAVCount(unsigned size) override;
+
+    virtual void ReportLiveObjects() override;
+    virtual bool ProcessShaderMetaData(IRHIShader& shader) override;
+
+    virtual bool InitTimestampProfiler(IRHIDevice& device, IRHICommandQueue& command_queue, unsigned back_buffer_count, unsigned max_query_count) override;
+    virtual void ShutdownTimestampProfiler() override;
+    virtual bool BeginTimestampFrame(IRHICommandList& command_list, unsigned frame_slot) override;
+    virtual bool WriteTimestamp(IRHICommandList& command_list, unsigned frame_slot, unsigned query_index) override;
+    virtual bool EndTimestampFrame(IRHICommandList& command_list, unsigned frame_slot, unsigned query_count) override;
+    virtual bool ResolveTimestampFrame(unsigned frame_slot, unsigned query_count, std::vector<uint64_t>& out_timestamps, double& out_ticks_per_second) override;
+    virtual bool IsTimestampProfilerSupported() const override;
+    virtual bool CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms) override;
+
+    // Null private implementation
+    unsigned long long GetValidationErrorCount() const { return m_validation_error_count; }
+    
+protected:
+    bool RecordCommand(IRHICommandList& command_list, RHINullCommandType type, const void* object,
+                       unsigned long long arg0 = 0, unsigned long long arg1 = 0, unsigned long long arg2 = 0, unsigned long long arg3 = 0);
+    void ValidateBarrier(const std::string& resource_name, RHINullResourceState& device_state, RHIResourceStateType before_state,
+                         RHIResourceStateType after_state, RHIBarrierSplitType split_type);
+    void ReportValidationError(const char* message, const std::string& resource_name);
+
+    // Shaders are still compiled to DXIL, so their root parameters come from DXC reflection.
+    std::unique_ptr<DX12Utils> m_shader_reflection_utils;
+    unsigned long long m_validation_error_count {0};
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "RHIInterface/IRHIVertexBufferView.h"
+
+class RHICORE_API NullVertexBufferView : public IRHIVertexBufferView
+{
+public:
+    virtual void InitVertexBufferView(IRHIBuffer& buffer, size_t offset, size_t vertexStride, size_t vertex_buffer_size) override;
+
+    const IRHIBuffer* m_buffer {nullptr};
+    size_t m_buffer_offset {0};
+    size_t m_buffer_stride {0};
+    size_t m_buffer_size {0};
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "RHICommon.h"
+
+// 64-bit FNV-1a over every input that changes a compiled pipeline: shader bytecode, root signature and fixed
+// function state. Values are hashed by their bytes, so only add types without padding, field by field for
+// structs that have it. Adapter and driver stay out of the key; RHIPipelineCacheIdentity covers them.
+class RHICORE_API RHIPipelineCacheKeyBuilder
+{
+public:
+    RHIPipelineCacheKeyBuilder& AddBytes(const void* data, size_t size);
+    // Length prefixed, so adjacent strings cannot alias each other.
+    RHIPipelineCacheKeyBuilder& AddString(const std::string& value);
+
+    template <typename T>
+    RHIPipelineCacheKeyBuilder& AddValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return AddBytes(&value, sizeof(T));
+    }
+
+    unsigned long long GetKey() const { return m_hash; }
+    // Fixed width hex, usable as a pipeline name in a driver-side library.
+    std::wstring GetKeyName() const;
+
+    static unsigned long long Hash(const void* data, size_t size);
+
+private:
+    unsigned long long m_hash {14695981039346656037ull};
+};
+
+// Adapter and driver a cache payload was produced with. Payloads of any other adapter or driver are dropped
+// on load instead of being handed to the driver.
+struct RHIPipelineCacheIdentity
+{
+    unsigned graphics_api {0};
+    unsigned vendor_id {0};
+    unsigned device_id {0};
+    unsigned long long driver_version {0};
+    // Driver provided cache UUID where the API has one, adapter revision data otherwise.
+    std::array<unsigned char, 16> cache_uuid {};
+
+    bool operator==(const RHIPipelineCacheIdentity& rhs) const = default;
+};
+
+enum class RHIPipelineCacheLoadResult
+{
+    LOADED,
+    MISSING,
+    FORMAT_MISMATCH,
+    IDENTITY_MISMATCH,
+    CORRUPTED,
+};
+
+// On-disk container for an opaque driver cache payload: a fixed header with magic, format version, identity,
+// payload size and payload hash, followed by the payload. Serialize and Deserialize work on memory only so
+// the format can be checked without a device; Save writes a temporary file and renames it over the target,
+// so a crash mid-write leaves the previous cache intact.
+class RHICORE_API RHIPipelineCacheFile
+{
+public:
+    static constexpr unsigned MAGIC = 0x4F535047u; // "GPSO"
+    // Bump whenever the header layout or the pipeline key derivation changes.
+    static constexpr unsigned FORMAT_VERSION = 1;
+
+    static void Serialize(const RHIPipelineCacheIdentity& identity, const void* payload, size_t payload_size, std::vector<unsigned char>& out_bytes);
+    static RHIPipelineCacheLoadResult Deserialize(const std::vector<unsigned char>& bytes, const RHIPipelineCacheIdentity& identity, std::vector<unsigned char>& out_payload);
+
+    static RHIPipelineCacheLoadResult Load(const std::filesystem::path& path, const RHIPipelineCacheIdentity& identity, std::vector<unsigned char>& out_payload);
+    static bool Save(const std::filesystem::path& path, const RHIPipelineCacheIdentity& identity, const void* payload, size_t payload_size);
+
+    // <pipeline cache directory>/<file_name>.
+    static std::filesystem::path GetCacheFilePath(const char* file_name);
+    static const char* ToString(RHIPipelineCacheLoadResult result);
+};
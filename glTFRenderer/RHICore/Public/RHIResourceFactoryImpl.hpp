@@ -30,6 +30,7 @@
 #include "RHIDX12Impl/DX12Device.h"
 #include "RHIDX12Impl/DX12Factory.h"
 #include "RHIDX12Impl/DX12Fence.h"
+#include "RHIDX12Impl/DX12Semaphore.h"
 #include "RHIDX12Impl/DX12Buffer.h"
 #include "RHIDX12Impl/DX12MemoryManager.h"
 #include "RHIDX12Impl/DX12IndexBufferView.h"
@@ -79,9 +80,35 @@
 #include "RHIVKImpl/VKDescriptorManager.h"
 #include "RHIVKImpl/VKDescriptorUpdater.h"
 
+// Null implements
+#include "RHINullImpl/NullUtils.h"
+#include "RHINullImpl/NullBuffer.h"
+#include "RHINullImpl/NullCommandAllocator.h"
+#include "RHINullImpl/NullCommandList.h"
+#include "RHINullImpl/NullCommandQueue.h"
+#include "RHINullImpl/NullCommandSignature.h"
+#include "RHINullImpl/NullDescriptorManager.h"
+#include "RHINullImpl/NullDescriptorUpdater.h"
+#include "RHINullImpl/NullDevice.h"
+#include "RHINullImpl/NullFactory.h"
+#include "RHINullImpl/NullFence.h"
+#include "RHINullImpl/NullIndexBufferView.h"
+#include "RHINullImpl/NullMemoryAllocator.h"
+#include "RHINullImpl/NullMemoryManager.h"
+#include "RHINullImpl/NullPipelineStateObject.h"
+#include "RHINullImpl/NullRayTracingAS.h"
+#include "RHINullImpl/NullRenderPass.h"
+#include "RHINullImpl/NullRenderTargetManager.h"
+#include "RHINullImpl/NullRootSignature.h"
+#include "RHINullImpl/NullShader.h"
+#include "RHINullImpl/NullShaderTable.h"
+#include "RHINullImpl/NullSwapChain.h"
+#include "RHINullImpl/NullTexture.h"
+#include "RHINullImpl/NullVertexBufferView.h"
+
 inline RHIGraphicsAPIType GetGraphicsAPI() {return RHIConfigSingleton::Instance().GetGraphicsAPIType();}
 
-#define IMPLEMENT_CREATE_RHI_RESOURCE(IRHIResourceType, DX12ResourceType, VKResourceType) \
+#define IMPLEMENT_CREATE_RHI_RESOURCE(IRHIResourceType, DX12ResourceType, VKResourceType, NullResourceType) \
 template <> \
 inline std::shared_ptr<IRHIResourceType> RHIResourceFactory::CreateRHIResource() \
 { \
@@ -94,6 +121,9 @@ break; \
 case RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan: \
 result = std::make_shared<VKResourceType>(); \
 break; \
+case RHIGraphicsAPIType::RHI_GRAPHICS_API_Null: \
+result = std::make_shared<NullResourceType>(); \
+break; \
 } \
 if (auto rhi_resource = dynamic_pointer_cast<IRHIResource>(result))\
 {\
@@ -102,41 +132,42 @@ if (auto rhi_resource = dynamic_pointer_cast<IRHIResource>(result))\
 return result; \
 } \
 
-IMPLEMENT_CREATE_RHI_RESOURCE(RHIUtils, DX12Utils, VulkanUtils)
+IMPLEMENT_CREATE_RHI_RESOURCE(RHIUtils, DX12Utils, VulkanUtils, NullUtils)
 
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIFactory, DX12Factory, VKFactory)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDevice, DX12Device, VKDevice)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandList, DX12CommandList, VKCommandList)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandQueue, DX12CommandQueue, VKCommandQueue)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandAllocator, DX12CommandAllocator, VKCommandAllocator)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHISwapChain, DX12SwapChain, VKSwapChain)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRenderTargetManager, DX12RenderTargetManager, VKRenderTargetManager)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRootParameter, DX12RootParameter, VKRootParameter)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIStaticSampler, DX12StaticSampler, VKStaticSampler)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRootSignature, DX12RootSignature, VKRootSignature)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIGraphicsPipelineStateObject, DX12GraphicsPipelineStateObject, VKGraphicsPipelineStateObject)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIComputePipelineStateObject, DX12ComputePipelineStateObject, VKComputePipelineStateObject)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRayTracingPipelineStateObject, DX12RTPipelineStateObject, VKRTPipelineStateObject)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIShaderTable, DX12ShaderTable, VKShaderTable)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIFence, DX12Fence, VKFence)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBuffer, DX12Buffer, VKBuffer)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIShader, DX12Shader, VKShader)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIVertexBufferView, DX12VertexBufferView, VKVertexBufferView)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIIndexBufferView, DX12IndexBufferView, VKIndexBufferView)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHITexture, DX12Texture, VKTexture)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRayTracingAS, DX12RayTracingAS, VKRayTracingAS)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandSignature, DX12CommandSignature, VKCommandSignature)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHISemaphore, RHISemaphoreNull, VKSemaphore)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRenderPass, DX12RenderPass, VKRenderPass)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorTable, DX12DescriptorTable, VKDescriptorTable)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIFactory, DX12Factory, VKFactory, NullFactory)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDevice, DX12Device, VKDevice, NullDevice)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandList, DX12CommandList, VKCommandList, NullCommandList)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandQueue, DX12CommandQueue, VKCommandQueue, NullCommandQueue)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandAllocator, DX12CommandAllocator, VKCommandAllocator, NullCommandAllocator)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHISwapChain, DX12SwapChain, VKSwapChain, NullSwapChain)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRenderTargetManager, DX12RenderTargetManager, VKRenderTargetManager, NullRenderTargetManager)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRootParameter, DX12RootParameter, VKRootParameter, NullRootParameter)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIStaticSampler, DX12StaticSampler, VKStaticSampler, NullStaticSampler)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRootSignature, DX12RootSignature, VKRootSignature, NullRootSignature)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIGraphicsPipelineStateObject, DX12GraphicsPipelineStateObject, VKGraphicsPipelineStateObject, NullGraphicsPipelineStateObject)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIComputePipelineStateObject, DX12ComputePipelineStateObject, VKComputePipelineStateObject, NullComputePipelineStateObject)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRayTracingPipelineStateObject, DX12RTPipelineStateObject, VKRTPipelineStateObject, NullRTPipelineStateObject)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIShaderTable, DX12ShaderTable, VKShaderTable, NullShaderTable)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIFence, DX12Fence, VKFence, NullFence)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBuffer, DX12Buffer, VKBuffer, NullBuffer)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIShader, DX12Shader, VKShader, NullShader)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIVertexBufferView, DX12VertexBufferView, VKVertexBufferView, NullVertexBufferView)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIIndexBufferView, DX12IndexBufferView, VKIndexBufferView, NullIndexBufferView)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHITexture, DX12Texture, VKTexture, NullTexture)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRayTracingAS, DX12RayTracingAS, VKRayTracingAS, NullRayTracingAS)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHICommandSignature, DX12CommandSignature, VKCommandSignature, NullCommandSignature)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHISemaphore, DX12Semaphore, VKSemaphore, RHISemaphoreNull)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIRenderPass, DX12RenderPass, VKRenderPass, NullRenderPass)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorTable, DX12DescriptorTable, VKDescriptorTable, NullDescriptorTable)
 
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBufferAllocation, DX12BufferAllocation, VKBufferAllocation)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHITextureAllocation, DX12TextureAllocation, VKTextureAllocation)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBufferDescriptorAllocation, DX12BufferDescriptorAllocation, VKBufferDescriptorAllocation)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHITextureDescriptorAllocation, DX12TextureDescriptorAllocation, VKTextureDescriptorAllocation)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIAccelerationStructureDescriptorAllocation, DX12AccelerationStructureDescriptorAllocation, VKAccelerationStructureDescriptorAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBufferAllocation, DX12BufferAllocation, VKBufferAllocation, NullBufferAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHITextureAllocation, DX12TextureAllocation, VKTextureAllocation, NullTextureAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIHeapAllocation, DX12HeapAllocation, VKHeapAllocation, NullHeapAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIBufferDescriptorAllocation, DX12BufferDescriptorAllocation, VKBufferDescriptorAllocation, NullBufferDescriptorAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHITextureDescriptorAllocation, DX12TextureDescriptorAllocation, VKTextureDescriptorAllocation, NullTextureDescriptorAllocation)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIAccelerationStructureDescriptorAllocation, DX12AccelerationStructureDescriptorAllocation, VKAccelerationStructureDescriptorAllocation, NullAccelerationStructureDescriptorAllocation)
 
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorManager, DX12DescriptorManager, VKDescriptorManager)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorUpdater, DX12DescriptorUpdater, VKDescriptorUpdater)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIMemoryManager, DX12MemoryManager, VKMemoryManager)
-IMPLEMENT_CREATE_RHI_RESOURCE(IRHIMemoryAllocator, DX12MemoryAllocator, VKMemoryAllocator)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorManager, DX12DescriptorManager, VKDescriptorManager, NullDescriptorManager)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIDescriptorUpdater, DX12DescriptorUpdater, VKDescriptorUpdater, NullDescriptorUpdater)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIMemoryManager, DX12MemoryManager, VKMemoryManager, NullMemoryManager)
+IMPLEMENT_CREATE_RHI_RESOURCE(IRHIMemoryAllocator, DX12MemoryAllocator, VKMemoryAllocator, NullMemoryAllocator)
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+// Offset allocator for persistently mapped upload chunks used as a ring. Allocations are pointer bumps from the
+// head of the active chunk and wrap to its start once the space behind the oldest in-flight range is free. Each
+// allocation carries a retire tag (fence source and signal value); Reclaim frees in-flight ranges in allocation
+// order once their tag has completed, so the head never overtakes memory the GPU may still read. When the active
+// chunk is full the caller adds a larger one, which becomes the active chunk; older chunks take no new allocations
+// and are returned by CollectDrainedChunks once their ranges retire, leaving a single chunk sized for the peak
+// frame. Only offsets are managed here; IRHIMemoryManager owns the upload buffer behind each chunk.
+class RHIUploadRingAllocator
+{
+public:
+    static constexpr unsigned INVALID_CHUNK_ID = 0xffffffffu;
+
+    struct RetireTag
+    {
+        unsigned source{0};
+        // Zero retires on the next Reclaim.
+        unsigned long long value{0};
+
+        bool operator==(const RetireTag& rhs) const { return source == rhs.source && value == rhs.value; }
+    };
+
+    struct Allocation
+    {
+        unsigned chunk_id{INVALID_CHUNK_ID};
+        size_t offset{0};
+    };
+
+    using RetireTagCompletedFunc = std::function<bool(const RetireTag&)>;
+
+    // Returns the id of the new active chunk.
+    unsigned AddChunk(size_t capacity);
+    void Reset();
+
+    // alignment must be a power of two. False when the active chunk cannot fit the range right now.
+    bool Allocate(size_t size, size_t alignment, const RetireTag& retire_tag, Allocation& out_allocation);
+    // Frees the in-flight ranges of every chunk, oldest first, up to the first one whose tag has not completed.
+    void Reclaim(const RetireTagCompletedFunc& is_completed);
+    // Frees every in-flight range, for when the device is idle.
+    void ReclaimAll();
+    // Removes the chunks that were replaced by a larger one and have no in-flight range left.
+    void CollectDrainedChunks(std::vector<unsigned>& out_chunk_ids);
+
+    bool HasActiveChunk() const { return !m_chunks.empty(); }
+    size_t GetActiveChunkCapacity() const;
+    size_t GetTotalCapacity() const;
+    // Bytes between tail and head over all chunks, including alignment padding and skipped chunk ends.
+    size_t GetInFlightSize() const;
+    unsigned GetChunkCount() const { return static_cast<unsigned>(m_chunks.size()); }
+
+private:
+    struct InFlightRange
+    {
+        size_t begin{0};
+        size_t end{0};
+        RetireTag retire_tag{};
+    };
+
+    struct Chunk
+    {
+        unsigned id{INVALID_CHUNK_ID};
+        size_t capacity{0};
+        size_t head{0};
+        // Oldest first; the first range's begin is the ring tail.
+        std::deque<InFlightRange> in_flight_ranges;
+    };
+
+    static bool TryAllocate(Chunk& chunk, size_t size, size_t alignment, size_t& out_offset);
+    static void ReclaimChunk(Chunk& chunk, const RetireTagCompletedFunc& is_completed);
+    static size_t GetChunkInFlightSize(const Chunk& chunk);
+
+    // The last chunk is the active one.
+    std::vector<Chunk> m_chunks;
+    unsigned m_next_chunk_id{0};
+};
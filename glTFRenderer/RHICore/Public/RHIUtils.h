@@ -68,7 +68,12 @@ public:
     
     virtual bool AddBufferBarrierToCommandList(IRHICommandList& command_list, const IRHIBuffer& buffer, RHIResourceStateType beforeState, RHIResourceStateType afterState) = 0;
     virtual bool AddTextureBarrierToCommandList(IRHICommandList& command_list, IRHITexture& buffer, RHIResourceStateType beforeState, RHIResourceStateType afterState) = 0;
+    // Records all transitions with a single barrier command. Does not touch the tracked resource states.
+    virtual bool AddBarriersToCommandList(IRHICommandList& command_list, const std::vector<RHITextureBarrierDesc>& texture_barriers, const std::vector<RHIBufferBarrierDesc>& buffer_barriers) = 0;
     virtual bool AddUAVBarrier(IRHICommandList& command_list, IRHITexture& texture) = 0;
+    // Activates a placed texture over the heap range it shares with before_texture, or with whatever was placed
+    // there when before_texture is null. The contents of after_texture are undefined until its first write.
+    virtual bool AddAliasingBarrier(IRHICommandList& command_list, IRHITexture* before_texture, IRHITexture& after_texture) = 0;
 
     virtual bool DrawInstanced(IRHICommandList& command_list, unsigned vertexCountPerInstance, unsigned instanceCount, unsigned startVertexLocation, unsigned startInstanceLocation) = 0;
     virtual bool DrawIndexInstanced(IRHICommandList& command_list, unsigned indexCountPerInstance, unsigned instanceCount, unsigned startIndexLocation, unsigned baseVertexLocation, unsigned startInstanceLocation) = 0;
@@ -87,6 +92,9 @@ public:
     virtual bool ClearUAVTexture(IRHICommandList& command_list, const IRHITextureDescriptorAllocation& texture_descriptor) = 0;
     
     virtual bool SupportRayTracing(IRHIDevice& device) = 0;
+    // Whether a COMPUTE command queue runs next to the graphics queue; wait and signal semaphores of
+    // ExecuteCommandList order work between the two.
+    virtual bool SupportAsyncCompute(IRHIDevice& device) = 0;
     virtual unsigned GetAlignmentSizeForUAVCount(unsigned size) = 0;
 
     virtual bool ProcessShaderMetaData(IRHIShader& shader) = 0;
@@ -100,6 +108,9 @@ public:
     virtual bool EndTimestampFrame(IRHICommandList& command_list, unsigned frame_slot, unsigned query_count) = 0;
     virtual bool ResolveTimestampFrame(unsigned frame_slot, unsigned query_count, std::vector<uint64_t>& out_timestamps, double& out_ticks_per_second) = 0;
     virtual bool IsTimestampProfilerSupported() const = 0;
+    // Samples a GPU timestamp of the queue together with the CPU time, in milliseconds on the
+    // std::chrono::steady_clock timeline, so resolved timestamps can be placed on the CPU timeline.
+    virtual bool CalibrateTimestampClock(IRHICommandQueue& command_queue, uint64_t& out_gpu_tick, double& out_cpu_time_ms) = 0;
 
     bool UploadTextureData(IRHICommandList& command_list, IRHIMemoryManager& memory_manager, IRHIDevice& device, IRHITexture& dst, const RHITextureMipUploadInfo& upload_info) ;
     bool Present(IRHISwapChain& swap_chain, IRHICommandQueue& command_queue, IRHICommandList& command_list);
@@ -8,13 +8,13 @@ class RHICORE_API VKCommandQueue : public IRHICommandQueue
 public:
     IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(VKCommandQueue)
     
-    virtual bool InitCommandQueue(IRHIDevice& device) override;
+    virtual bool InitCommandQueue(IRHIDevice& device, RHICommandQueueType type) override;
     
-    VkQueue GetGraphicsQueue() const;
+    VkQueue GetQueue() const;
     
     virtual bool Release(IRHIMemoryManager& memory_manager) override;
     
 protected:
     VkDevice logical_device {VK_NULL_HANDLE};
-    VkQueue graphics_queue {VK_NULL_HANDLE};
+    VkQueue m_queue {VK_NULL_HANDLE};
 };
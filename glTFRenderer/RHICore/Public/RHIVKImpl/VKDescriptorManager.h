@@ -46,6 +46,10 @@ class RHICORE_API VKDescriptorTable : public IRHIDescriptorTable
 {
 public:
     virtual bool Build(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations) override;
+    // Table of descriptor_count empty slots filled with SetImageInfo; empty slots are never written to a set.
+    void InitEmpty(unsigned descriptor_count);
+    void SetImageInfo(unsigned index, const IRHITextureDescriptorAllocation& descriptor_allocation);
+    void ClearImageInfo(unsigned index);
 
     const std::vector<VkDescriptorImageInfo>& GetImageInfos() const;
     
@@ -61,6 +65,7 @@ public:
     virtual bool Init(IRHIDevice& device, const DescriptorAllocationInfo& max_descriptor_capacity) override;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHIBuffer>& buffer, const RHIBufferDescriptorDesc& desc, std::shared_ptr<IRHIBufferDescriptorAllocation>& out_descriptor_allocation) override;
     virtual bool CreateDescriptor(IRHIDevice& device, const std::shared_ptr<IRHITexture>& texture, const RHITextureDescriptorDesc& desc, std::shared_ptr<IRHITextureDescriptorAllocation>& out_descriptor_allocation) override;
+    virtual bool CreateDescriptorTable(IRHIDevice& device, const std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>>& descriptor_allocations, std::shared_ptr<IRHIDescriptorTable>& out_descriptor_table) override;
 
     virtual bool BindDescriptorContext(IRHICommandList& command_list) override;
     virtual bool BindGUIDescriptorContext(IRHICommandList& command_list) override;
@@ -69,6 +74,9 @@ public:
     VkDescriptorPool GetDescriptorPool() const;
     
 protected:
+    virtual bool WriteBindlessTexture(IRHIDevice& device, unsigned bindless_index, const std::shared_ptr<IRHITextureDescriptorAllocation>& descriptor_allocation) override;
+    virtual void ClearBindlessTexture(unsigned bindless_index) override;
+
     VkDevice m_device {VK_NULL_HANDLE};
     VkDescriptorPool m_descriptor_pool {VK_NULL_HANDLE};
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include <optional>
 
+#include "RHIPipelineCache.h"
 #include "RHIInterface/IRHIDevice.h"
 #include "VolkUtils.h"
 
@@ -9,6 +10,7 @@ struct RHICORE_API QueueFamilyIndices
 {
     std::optional<unsigned> graphics_family;
     std::optional<unsigned> present_family;
+    unsigned graphics_family_queue_count {0};
 
     bool IsComplete() const
     {
@@ -34,10 +36,14 @@ public:
     VkSurfaceKHR GetSurface() const {return surface; }
     VkPhysicalDevice GetPhysicalDevice() const {return selected_physical_device; }
     VkDevice GetDevice() const {return logical_device;}
+    // VK_NULL_HANDLE when the pipeline cache is disabled; pipeline creation accepts either.
+    VkPipelineCache GetPipelineCache() const {return m_pipeline_cache;}
 
     bool IsRayTracingSupported() const { return m_ray_tracing_supported; }
     bool SupportsRayQuery() const { return m_ray_query_supported; }
     bool SupportsPresentWait() const { return m_present_wait_supported; }
+    // Async compute runs on a second queue of the graphics family, so it needs a family exposing two queues.
+    bool SupportsAsyncComputeQueue() const { return m_async_compute_queue_supported; }
     const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& GetRayTracingPipelineProperties() const { return m_rt_pipeline_properties; }
     
     unsigned GetGraphicsQueueIndex() const {return graphics_queue_index; }
@@ -51,6 +57,8 @@ protected:
     bool IsSuitableDevice(VkPhysicalDevice device, VkSurfaceKHR surface);
     bool CheckPresentWaitSupport(VkPhysicalDevice device);
     bool CheckRayTracingSupport(VkPhysicalDevice device, uint32_t api_version, bool require_ray_tracing_pipeline, bool require_ray_query);
+    void CreatePipelineCache(const VkPhysicalDeviceProperties& device_properties);
+    void SavePipelineCache();
     
     VkInstance instance {VK_NULL_HANDLE};
     VkSurfaceKHR surface {VK_NULL_HANDLE};
@@ -63,5 +71,10 @@ protected:
     bool m_ray_tracing_supported {false};
     bool m_ray_query_supported {false};
     bool m_present_wait_supported {false};
+    bool m_async_compute_queue_supported {false};
     VkPhysicalDeviceRayTracingPipelinePropertiesKHR m_rt_pipeline_properties {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR};
+
+    VkPipelineCache m_pipeline_cache {VK_NULL_HANDLE};
+    RHIPipelineCacheIdentity m_pipeline_cache_identity {};
+    std::filesystem::path m_pipeline_cache_file_path;
 };
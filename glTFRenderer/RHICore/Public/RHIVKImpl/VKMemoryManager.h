@@ -16,10 +16,19 @@ class RHICORE_API VKTextureAllocation : public IRHITextureAllocation
 public:
     IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(VKTextureAllocation)
 
-    VmaAllocation m_allocation;
+    // Null for textures placed in a heap, which only own their image.
+    VmaAllocation m_allocation {VK_NULL_HANDLE};
     VmaAllocationInfo m_allocation_info;
 };
 
+class RHICORE_API VKHeapAllocation : public IRHIHeapAllocation
+{
+public:
+    IMPL_NON_COPYABLE_AND_DEFAULT_CTOR_VDTOR(VKHeapAllocation)
+
+    VmaAllocation m_allocation {VK_NULL_HANDLE};
+};
+
 class RHICORE_API VKMemoryManager : public IRHIMemoryManager
 {
 public:
@@ -33,9 +42,17 @@ public:
     virtual bool ReleaseMemoryAllocation(IRHIMemoryAllocation& memory_allocation) override;
     virtual bool ReleaseAllResource() override;
 
+    virtual bool GetTexturePlacementRequirements(IRHIDevice& device, const RHITextureDesc& texture_desc, unsigned long long& out_size_bytes, unsigned long long& out_alignment) override;
+    virtual bool AllocateHeapMemory(IRHIDevice& device, unsigned long long size_bytes, unsigned long long alignment, std::shared_ptr<IRHIHeapAllocation>& out_heap_allocation) override;
+    virtual bool AllocatePlacedTextureMemory(IRHIDevice& device, const std::shared_ptr<IRHIHeapAllocation>& heap_allocation, unsigned long long offset, const RHITextureDesc& texture_desc, std::shared_ptr<IRHITextureAllocation>& out_texture_allocation) override;
+
 protected:
     virtual bool UploadBufferDataInner(IRHIBufferAllocation& buffer_allocation, const void* data, size_t offset, size_t size) override;
     VmaAllocator GetVmaAllocator() const;
 
+    void DestroyTextureAllocation(const VKTextureAllocation& texture_allocation);
+
     std::shared_ptr<IRHIMemoryAllocator> m_allocator;
+    // Memory types every texture queried for placement accepts; heaps are allocated from one of them.
+    uint32_t m_placed_texture_memory_type_bits {~0u};
 };
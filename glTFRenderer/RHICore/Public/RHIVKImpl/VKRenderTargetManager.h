@@ -8,6 +8,7 @@ public:
      
     virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTarget(IRHIDevice& device, IRHIMemoryManager& memory_manager, const
         RHITextureDesc& texture_desc, RHIDataFormat format) override;
+    virtual std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTargetFromTexture(IRHIDevice& device, IRHIMemoryManager& memory_manager, const std::shared_ptr<IRHITextureAllocation>& texture_allocation, RHIDataFormat format) override;
     virtual std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> CreateRenderTargetFromSwapChain(IRHIDevice& device, IRHIMemoryManager& memory_manager, IRHISwapChain& swapChain, RHITextureClearValue clearValue) override;
     virtual bool ClearRenderTarget(IRHICommandList& commandList, const std::vector<IRHIDescriptorAllocation*>& render_targets) override;
     virtual bool BindRenderTarget(IRHICommandList& commandList, const std::vector<IRHIDescriptorAllocation*>& render_targets) override;
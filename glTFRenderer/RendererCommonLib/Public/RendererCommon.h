@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <codecvt>
@@ -10,6 +11,7 @@
 #include <string>
 #include <locale>
 
+#include "RendererUniqueObjectID.h"
 #include "SceneFileLoader/glTFImageIOUtil.h"
 
 #ifdef NDEBUG
@@ -92,9 +94,6 @@ struct RHIShaderPreDefineMacros
     std::vector<std::string> macroValue;
 };
 
-typedef unsigned RendererUniqueObjectID;
-#define RendererUniqueObjectIDInvalid UINT_MAX   
-
 #ifdef NDEBUG
 #define GLTF_CHECK(a) if (!(a)) {throw "ASSERT!"; }
 #else
@@ -130,24 +129,6 @@ typedef unsigned RendererUniqueObjectID;
 //#define ALIGN_FOR_CBV_STRUCT __declspec(align(16))
 #define ALIGN_FOR_CBV_STRUCT
 
-template<typename T>
-class RendererUniqueObjectIDBase
-{
-public:
-    RendererUniqueObjectIDBase()
-        : m_uniqueID(_innerUniqueID++) {}
-    virtual ~RendererUniqueObjectIDBase() = default;
-    
-    RendererUniqueObjectID GetID() const { return m_uniqueID; }
-    
-private:
-    RendererUniqueObjectID m_uniqueID;
-    static RendererUniqueObjectID _innerUniqueID;
-};
-
-template<typename T>
-RendererUniqueObjectID RendererUniqueObjectIDBase<T>::_innerUniqueID = 0;
-
 class ITickable
 {
 public:
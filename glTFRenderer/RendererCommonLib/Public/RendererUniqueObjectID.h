@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <climits>
+
+// Kept free of the rest of RendererCommon.h so scripts/RendererUniqueObjectID-StressTest.cpp can build it
+// outside the Windows toolchain, under ThreadSanitizer.
+
+typedef unsigned RendererUniqueObjectID;
+#define RendererUniqueObjectIDInvalid UINT_MAX
+
+// Deterministic mode hands out IDs one at a time from the shared counter, so a run that creates objects in
+// the same order gets the same IDs (regression runs). Otherwise each thread reserves blocks of IDs and IDs are
+// unique but not dense or ordered across threads.
+class RendererUniqueObjectIDAllocation
+{
+public:
+    static void SetDeterministic(bool enable) { s_deterministic.store(enable, std::memory_order_relaxed); }
+    static bool IsDeterministic() { return s_deterministic.load(std::memory_order_relaxed); }
+
+private:
+    inline static std::atomic<bool> s_deterministic{false};
+};
+
+template<typename T>
+class RendererUniqueObjectIDBase
+{
+public:
+    RendererUniqueObjectIDBase()
+        : m_uniqueID(AllocateID()) {}
+    virtual ~RendererUniqueObjectIDBase() = default;
+    
+    RendererUniqueObjectID GetID() const { return m_uniqueID; }
+    
+private:
+    enum
+    {
+        ID_BLOCK_SIZE = 64,
+    };
+
+    struct IDBlock
+    {
+        RendererUniqueObjectID next{0};
+        RendererUniqueObjectID end{0};
+    };
+
+    // Objects are created from loader and recording threads; only a block refill touches the shared counter.
+    static RendererUniqueObjectID AllocateID()
+    {
+        if (RendererUniqueObjectIDAllocation::IsDeterministic())
+        {
+            return _innerUniqueID.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        thread_local IDBlock block{};
+        if (block.next == block.end)
+        {
+            block.next = _innerUniqueID.fetch_add(ID_BLOCK_SIZE, std::memory_order_relaxed);
+            block.end = block.next + ID_BLOCK_SIZE;
+        }
+        return block.next++;
+    }
+
+    RendererUniqueObjectID m_uniqueID;
+    inline static std::atomic<RendererUniqueObjectID> _innerUniqueID{0};
+};
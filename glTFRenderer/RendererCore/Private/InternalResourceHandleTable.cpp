@@ -1,192 +1,151 @@
 #include "InternalResourceHandleTable.h"
 
-static unsigned _internal_handle = 0;
-
 RendererInterface::RenderWindowHandle RendererInterface::InternalResourceHandleTable::RegisterWindow(
     const RenderWindow& window)
 {
-    RenderWindowHandle result{_internal_handle++};
-    m_windows.emplace(result, window);
-    return result;
+    // Aliasing constructor with an empty owner: the entry points at the window without owning it.
+    return m_windows.Register(std::shared_ptr<const RenderWindow>(std::shared_ptr<const RenderWindow>(), &window));
 }
 
 const RendererInterface::RenderWindow& RendererInterface::InternalResourceHandleTable::GetRenderWindow(
     RenderWindowHandle handle) const
 {
-    return m_windows.at(handle);
+    const auto window = m_windows.Get(handle);
+    GLTF_CHECK(window);
+    return *window;
 }
 
 RendererInterface::ShaderHandle RendererInterface::InternalResourceHandleTable::RegisterShader(
     std::shared_ptr<IRHIShader> shader)
 {
-    ShaderHandle result{_internal_handle++};
-    m_shaders.emplace(result, shader);
-    return result;
+    return m_shaders.Register(std::move(shader));
 }
 
 std::shared_ptr<IRHIShader> RendererInterface::InternalResourceHandleTable::GetShader(ShaderHandle handle) const
 {
-    return m_shaders.at(handle);
+    return m_shaders.Get(handle);
 }
 
 RendererInterface::RenderTargetHandle RendererInterface::InternalResourceHandleTable::RegisterRenderTarget(
     std::shared_ptr<IRHITextureDescriptorAllocation> render_target)
 {
-    RenderTargetHandle result{_internal_handle++};
-    m_render_targets.emplace(result, render_target);
-    return result;
+    return m_render_targets.Register(std::move(render_target));
 }
 
 std::shared_ptr<IRHITextureDescriptorAllocation> RendererInterface::InternalResourceHandleTable::GetRenderTarget(
     RenderTargetHandle handle) const
 {
-    return m_render_targets.at(handle);
+    return m_render_targets.Get(handle);
 }
 
 std::shared_ptr<IRHITextureDescriptorAllocation> RendererInterface::InternalResourceHandleTable::RemoveRenderTarget(
     RenderTargetHandle handle)
 {
-    const auto it = m_render_targets.find(handle);
-    if (it == m_render_targets.end())
-    {
-        return nullptr;
-    }
-
-    auto render_target = it->second;
-    m_render_targets.erase(it);
-    return render_target;
+    return m_render_targets.Remove(handle);
 }
 
 bool RendererInterface::InternalResourceHandleTable::UpdateRenderTarget(
     RenderTargetHandle handle, std::shared_ptr<IRHITextureDescriptorAllocation> render_target)
 {
-    if (!m_render_targets.contains(handle))
-    {
-        return false;
-    }
-    m_render_targets[handle] = std::move(render_target);
-    return true;
+    return m_render_targets.Update(handle, std::move(render_target));
 }
 
 RendererInterface::RenderPassHandle RendererInterface::InternalResourceHandleTable::RegisterRenderPass(
     std::shared_ptr<RenderPass> render_pass)
 {
-    RenderPassHandle result{_internal_handle++};
-    m_render_passes.emplace(result, render_pass);
-    return result;
+    return m_render_passes.Register(std::move(render_pass));
 }
 
 std::shared_ptr<RenderPass> RendererInterface::InternalResourceHandleTable::GetRenderPass(RenderPassHandle handle) const
 {
-    return m_render_passes.at(handle);
+    return m_render_passes.Get(handle);
 }
 
 std::shared_ptr<RenderPass> RendererInterface::InternalResourceHandleTable::RemoveRenderPass(RenderPassHandle handle)
 {
-    const auto it = m_render_passes.find(handle);
-    if (it == m_render_passes.end())
-    {
-        return nullptr;
-    }
-
-    auto render_pass = it->second;
-    m_render_passes.erase(it);
-    return render_pass;
+    return m_render_passes.Remove(handle);
 }
 
 RendererInterface::BufferHandle RendererInterface::InternalResourceHandleTable::RegisterBuffer(
     std::shared_ptr<IRHIBufferAllocation> buffer)
 {
-    BufferHandle result{_internal_handle++};
-    m_buffers.emplace(result, buffer);
-    return result;
+    return m_buffers.Register(std::move(buffer));
 }
 
 std::shared_ptr<IRHIBufferAllocation> RendererInterface::InternalResourceHandleTable::GetBuffer(
     BufferHandle handle) const
 {
-    return m_buffers.at(handle);
+    return m_buffers.Get(handle);
 }
 
 std::shared_ptr<IRHIBufferAllocation> RendererInterface::InternalResourceHandleTable::RemoveBuffer(
     BufferHandle handle)
 {
-    const auto it = m_buffers.find(handle);
-    if (it == m_buffers.end())
-    {
-        return nullptr;
-    }
-
-    auto buffer = it->second;
-    m_buffers.erase(it);
-    return buffer;
+    return m_buffers.Remove(handle);
 }
 
 RendererInterface::RenderSceneHandle RendererInterface::InternalResourceHandleTable::RegisterRenderScene(
     std::shared_ptr<RendererSceneGraph> scene_graph)
 {
-    RenderSceneHandle result{_internal_handle++};
-    m_render_scene_graphs.emplace(result, scene_graph);
-    return result;
+    return m_render_scene_graphs.Register(std::move(scene_graph));
 }
 
 std::shared_ptr<RendererSceneGraph> RendererInterface::InternalResourceHandleTable::GetRenderScene(
     RenderSceneHandle handle) const
 {
-    return m_render_scene_graphs.at(handle);
+    return m_render_scene_graphs.Get(handle);
 }
 
 RendererInterface::IndexedBufferHandle RendererInterface::InternalResourceHandleTable::RegisterIndexedBufferAndView(
     std::shared_ptr<IRHIIndexBufferView> buffer_view, std::shared_ptr<RHIIndexBuffer> buffer)
 {
-    IndexedBufferHandle result{_internal_handle++};
-    m_indexed_buffer_views.emplace(result, buffer_view);
-    m_indexed_buffers.emplace(result, buffer);
-    return result;
+    auto entry = std::make_shared<IndexedBufferEntry>();
+    entry->buffer_view = std::move(buffer_view);
+    entry->buffer = std::move(buffer);
+    return m_indexed_buffers.Register(std::move(entry));
 }
 
 std::shared_ptr<RHIIndexBuffer> RendererInterface::InternalResourceHandleTable::GetIndexBuffer(
     IndexedBufferHandle handle) const
 {
-    return m_indexed_buffers.at(handle);
+    const auto entry = m_indexed_buffers.Get(handle);
+    return entry ? entry->buffer : nullptr;
 }
 
 std::shared_ptr<IRHIIndexBufferView> RendererInterface::InternalResourceHandleTable::GetIndexBufferView(
     IndexedBufferHandle handle) const
 {
-    return m_indexed_buffer_views.at(handle);
+    const auto entry = m_indexed_buffers.Get(handle);
+    return entry ? entry->buffer_view : nullptr;
 }
 
 RendererInterface::TextureHandle RendererInterface::InternalResourceHandleTable::RegisterTexture(
     std::shared_ptr<IRHITextureAllocation> texture)
 {
-    TextureHandle result{_internal_handle++};
-    m_textures.emplace(result, texture);
-    return result;
+    return m_textures.Register(std::move(texture));
 }
 
 std::shared_ptr<IRHITextureAllocation> RendererInterface::InternalResourceHandleTable::GetTexture(
     TextureHandle handle) const
 {
-    return m_textures.at(handle);
+    return m_textures.Get(handle);
 }
 
 void RendererInterface::InternalResourceHandleTable::ClearRuntimeResources()
 {
-    m_shaders.clear();
-    m_render_targets.clear();
-    m_render_passes.clear();
-    m_buffers.clear();
-    m_render_scene_graphs.clear();
-    m_indexed_buffer_views.clear();
-    m_indexed_buffers.clear();
-    m_textures.clear();
+    m_shaders.Clear();
+    m_render_targets.Clear();
+    m_render_passes.Clear();
+    m_buffers.Clear();
+    m_render_scene_graphs.Clear();
+    m_indexed_buffers.Clear();
+    m_textures.Clear();
 }
 
 void RendererInterface::InternalResourceHandleTable::ClearAll()
 {
     ClearRuntimeResources();
-    m_windows.clear();
+    m_windows.Clear();
 }
 
 RendererInterface::InternalResourceHandleTable& RendererInterface::InternalResourceHandleTable::Instance()
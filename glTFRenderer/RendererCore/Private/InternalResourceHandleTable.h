@@ -1,5 +1,6 @@
 #pragma once
 #include "Renderer.h"
+#include "RendererHandleSlotMap.h"
 #include "RendererInterface.h"
 
 class IRHITextureAllocation;
@@ -12,6 +13,9 @@ class IRHIShader;
 
 namespace RendererInterface
 {
+    // Handle to object tables shared by the renderer. Lookups are lock-free and may run on recording threads;
+    // a handle whose object was removed or cleared resolves to nullptr rather than to a later object. Register*
+    // returns NULL_HANDLE once a table runs out of slot indices.
     class InternalResourceHandleTable
     {
     public:
@@ -51,14 +55,20 @@ namespace RendererInterface
         static InternalResourceHandleTable& Instance();
         
     protected:
-        std::map<RenderWindowHandle, const RenderWindow&> m_windows;
-        std::map<ShaderHandle, std::shared_ptr<IRHIShader>> m_shaders;
-        std::map<RenderTargetHandle, std::shared_ptr<IRHITextureDescriptorAllocation>> m_render_targets;
-        std::map<RenderPassHandle, std::shared_ptr<RenderPass>> m_render_passes;
-        std::map<BufferHandle, std::shared_ptr<IRHIBufferAllocation>> m_buffers;
-        std::map<RenderSceneHandle, std::shared_ptr<RendererSceneGraph>> m_render_scene_graphs;
-        std::map<IndexedBufferHandle, std::shared_ptr<IRHIIndexBufferView>> m_indexed_buffer_views;
-        std::map<IndexedBufferHandle, std::shared_ptr<RHIIndexBuffer>> m_indexed_buffers;
-        std::map<TextureHandle, std::shared_ptr<IRHITextureAllocation>> m_textures;
+        struct IndexedBufferEntry
+        {
+            std::shared_ptr<IRHIIndexBufferView> buffer_view;
+            std::shared_ptr<RHIIndexBuffer> buffer;
+        };
+        
+        // Windows are owned by the caller; their entries do not extend the window's lifetime.
+        HandleSlotMap<RenderWindowHandle, const RenderWindow> m_windows;
+        HandleSlotMap<ShaderHandle, IRHIShader> m_shaders;
+        HandleSlotMap<RenderTargetHandle, IRHITextureDescriptorAllocation> m_render_targets;
+        HandleSlotMap<RenderPassHandle, RenderPass> m_render_passes;
+        HandleSlotMap<BufferHandle, IRHIBufferAllocation> m_buffers;
+        HandleSlotMap<RenderSceneHandle, RendererSceneGraph> m_render_scene_graphs;
+        HandleSlotMap<IndexedBufferHandle, IndexedBufferEntry> m_indexed_buffers;
+        HandleSlotMap<TextureHandle, IRHITextureAllocation> m_textures;
     };
 }
@@ -0,0 +1,335 @@
+#include "RenderGraphAttachmentOps.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <set>
+
+namespace
+{
+    using namespace RenderGraphAttachmentOps;
+
+    struct ResourceAccess
+    {
+        unsigned step{0};
+        bool read{false};
+        bool write{false};
+    };
+
+    bool ContainsSorted(const std::vector<unsigned long long>& values, unsigned long long value)
+    {
+        return std::binary_search(values.begin(), values.end(), value);
+    }
+
+    bool HasAttachment(const StepDesc& step, unsigned long long resource_id)
+    {
+        for (const auto& attachment : step.attachments)
+        {
+            if (attachment.resource_id == resource_id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasSameAttachments(const StepDesc& lhs, const StepDesc& rhs)
+    {
+        if (lhs.attachments.size() != rhs.attachments.size())
+        {
+            return false;
+        }
+        for (size_t attachment_index = 0; attachment_index < lhs.attachments.size(); ++attachment_index)
+        {
+            if (lhs.attachments[attachment_index].resource_id != rhs.attachments[attachment_index].resource_id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Accesses per resource in execution order; an attachment is written and, when loaded or only partly
+    // covered by the render area, read.
+    std::map<unsigned long long, std::vector<ResourceAccess>> CollectResourceAccesses(const std::vector<StepDesc>& execution_steps)
+    {
+        std::map<unsigned long long, std::vector<ResourceAccess>> accesses;
+        for (unsigned step_index = 0; step_index < execution_steps.size(); ++step_index)
+        {
+            std::map<unsigned long long, ResourceAccess> step_accesses;
+            const auto& step = execution_steps[step_index];
+            for (const auto& attachment : step.attachments)
+            {
+                auto& access = step_accesses[attachment.resource_id];
+                access.read = access.read || attachment.load_op == LoadOp::LOAD || !attachment.full_area;
+                access.write = true;
+            }
+            for (const unsigned long long resource_id : step.reads)
+            {
+                step_accesses[resource_id].read = true;
+            }
+            for (const unsigned long long resource_id : step.writes)
+            {
+                step_accesses[resource_id].write = true;
+            }
+            for (auto& [resource_id, access] : step_accesses)
+            {
+                access.step = step_index;
+                accesses[resource_id].push_back(access);
+            }
+        }
+        return accesses;
+    }
+
+    // Contents survive into the next frame for outputs and for resources read before they are first written.
+    bool OutlivesFrame(const std::vector<ResourceAccess>& accesses, unsigned long long resource_id,
+        const std::vector<unsigned long long>& persistent_resources)
+    {
+        if (ContainsSorted(persistent_resources, resource_id))
+        {
+            return true;
+        }
+        for (const auto& access : accesses)
+        {
+            if (access.read)
+            {
+                return true;
+            }
+            if (access.write)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    StoreOp InferStoreOp(const std::vector<ResourceAccess>& accesses, unsigned step_index, bool outlives_frame)
+    {
+        for (const auto& access : accesses)
+        {
+            if (access.step <= step_index)
+            {
+                continue;
+            }
+            // The next access either observes the contents or replaces them without looking.
+            return access.read ? StoreOp::STORE : StoreOp::DONT_CARE;
+        }
+        return outlives_frame ? StoreOp::STORE : StoreOp::DONT_CARE;
+    }
+
+    // Resources a merge group has touched so far, to keep merged steps free of hazards that need a barrier.
+    struct GroupState
+    {
+        std::map<unsigned long long, unsigned> states;
+        std::set<unsigned long long> accessed;
+        std::set<unsigned long long> written;
+
+        void Add(const StepDesc& step)
+        {
+            for (const auto& [resource_id, state] : step.states)
+            {
+                states.emplace(resource_id, state);
+            }
+            accessed.insert(step.reads.begin(), step.reads.end());
+            accessed.insert(step.writes.begin(), step.writes.end());
+            written.insert(step.writes.begin(), step.writes.end());
+        }
+    };
+
+    bool CanJoinGroup(const GroupState& group, const StepDesc& first_step, const StepDesc& step)
+    {
+        if (!step.raster ||
+            step.render_area_key != first_step.render_area_key ||
+            !HasSameAttachments(first_step, step))
+        {
+            return false;
+        }
+
+        for (const auto& attachment : step.attachments)
+        {
+            // Only a step continuing from the attachment contents can pick them up inside the scope.
+            if (attachment.load_op != LoadOp::LOAD)
+            {
+                return false;
+            }
+        }
+
+        for (const unsigned long long resource_id : step.reads)
+        {
+            if (HasAttachment(first_step, resource_id) || group.written.contains(resource_id))
+            {
+                return false;
+            }
+        }
+        for (const unsigned long long resource_id : step.writes)
+        {
+            if (HasAttachment(first_step, resource_id) || group.accessed.contains(resource_id))
+            {
+                return false;
+            }
+        }
+
+        for (const auto& [resource_id, state] : step.states)
+        {
+            const auto group_state = group.states.find(resource_id);
+            if (group_state != group.states.end() && group_state->second != state)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    char ToLoadOpName(LoadOp load_op)
+    {
+        switch (load_op)
+        {
+        case LoadOp::LOAD:
+            return 'L';
+        case LoadOp::CLEAR:
+            return 'C';
+        case LoadOp::DONT_CARE:
+            return 'D';
+        }
+        return '?';
+    }
+
+    char ToStoreOpName(StoreOp store_op)
+    {
+        return store_op == StoreOp::STORE ? 'S' : 'D';
+    }
+}
+
+RenderGraphAttachmentOps::Plan RenderGraphAttachmentOps::BuildPlan(const std::vector<StepDesc>& execution_steps,
+    const std::vector<unsigned long long>& persistent_resources, const Options& options)
+{
+    Plan plan{};
+    const unsigned step_count = static_cast<unsigned>(execution_steps.size());
+    plan.steps.resize(step_count);
+
+    const auto resource_accesses = CollectResourceAccesses(execution_steps);
+    std::map<unsigned long long, bool> outlives_frame;
+    for (const auto& [resource_id, accesses] : resource_accesses)
+    {
+        outlives_frame[resource_id] = OutlivesFrame(accesses, resource_id, persistent_resources);
+    }
+
+    // Stores each step would need if it ended its own rendering scope.
+    std::vector<std::vector<StoreOp>> step_store_ops(step_count);
+    for (unsigned step_index = 0; step_index < step_count; ++step_index)
+    {
+        const auto& step = execution_steps[step_index];
+        auto& store_ops = step_store_ops[step_index];
+        store_ops.reserve(step.attachments.size());
+        for (const auto& attachment : step.attachments)
+        {
+            StoreOp store_op = attachment.store_op;
+            if (store_op == StoreOp::STORE && options.infer_store_ops)
+            {
+                store_op = InferStoreOp(resource_accesses.at(attachment.resource_id), step_index,
+                    outlives_frame.at(attachment.resource_id));
+            }
+            store_ops.push_back(store_op);
+        }
+    }
+
+    unsigned group_begin = 0;
+    while (group_begin < step_count)
+    {
+        const auto& first_step = execution_steps[group_begin];
+        unsigned group_end = group_begin;
+        if (options.merge_steps && first_step.raster && !first_step.attachments.empty())
+        {
+            GroupState group{};
+            group.Add(first_step);
+            while (group_end + 1 < step_count && CanJoinGroup(group, first_step, execution_steps[group_end + 1]))
+            {
+                ++group_end;
+                group.Add(execution_steps[group_end]);
+            }
+        }
+
+        const auto& last_store_ops = step_store_ops[group_end];
+        for (unsigned step_index = group_begin; step_index <= group_end; ++step_index)
+        {
+            const auto& step = execution_steps[step_index];
+            auto& step_ops = plan.steps[step_index];
+            step_ops.group_begin = group_begin;
+            step_ops.group_end = group_end;
+            if (!step.raster)
+            {
+                continue;
+            }
+
+            step_ops.load_ops.reserve(first_step.attachments.size());
+            for (const auto& attachment : first_step.attachments)
+            {
+                step_ops.load_ops.push_back(attachment.load_op);
+                if (attachment.load_op == LoadOp::CLEAR && attachment.full_area)
+                {
+                    step_ops.cleared_resources.push_back(attachment.resource_id);
+                }
+            }
+            step_ops.store_ops = last_store_ops;
+
+            for (size_t attachment_index = 0; attachment_index < step.attachments.size(); ++attachment_index)
+            {
+                const bool declared_store = step.attachments[attachment_index].store_op == StoreOp::STORE;
+                const bool ends_scope = step_index == group_end;
+                if (declared_store && (!ends_scope || last_store_ops[attachment_index] == StoreOp::DONT_CARE))
+                {
+                    ++plan.elided_store_count;
+                }
+                if (step_index != group_begin)
+                {
+                    ++plan.elided_load_count;
+                }
+            }
+        }
+
+        if (group_end > group_begin)
+        {
+            ++plan.merged_group_count;
+            plan.merged_step_count += group_end - group_begin;
+        }
+        group_begin = group_end + 1;
+    }
+
+    return plan;
+}
+
+std::string RenderGraphAttachmentOps::DumpPlan(const Plan& plan)
+{
+    std::string result;
+    char line[160];
+    std::snprintf(line, sizeof(line), "steps=%u groups=%u merged=%u elided_loads=%u elided_stores=%u\n",
+        static_cast<unsigned>(plan.steps.size()),
+        plan.merged_group_count,
+        plan.merged_step_count,
+        plan.elided_load_count,
+        plan.elided_store_count);
+    result += line;
+
+    for (unsigned step_index = 0; step_index < plan.steps.size(); ++step_index)
+    {
+        const auto& step = plan.steps[step_index];
+        std::snprintf(line, sizeof(line), "pass %u group %u..%u", step_index, step.group_begin, step.group_end);
+        result += line;
+        if (!step.load_ops.empty())
+        {
+            result += " ops=";
+            for (size_t attachment_index = 0; attachment_index < step.load_ops.size(); ++attachment_index)
+            {
+                if (attachment_index > 0)
+                {
+                    result += ',';
+                }
+                result += ToLoadOpName(step.load_ops[attachment_index]);
+                result += ToStoreOpName(step.store_ops[attachment_index]);
+            }
+        }
+        result += '\n';
+    }
+
+    return result;
+}
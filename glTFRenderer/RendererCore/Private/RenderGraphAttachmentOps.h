@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Attachment load/store ops and render pass merging for an execution order. A store is only kept when a
+// later pass or the next frame observes the contents, and consecutive raster passes over the same
+// attachments share one rendering scope, so the attachments are neither stored nor reloaded in between.
+// resource_id is the render graph's encoded render target key; the plan only compares ids for equality and order.
+namespace RenderGraphAttachmentOps
+{
+    enum class LoadOp
+    {
+        LOAD,
+        CLEAR,
+        DONT_CARE,
+    };
+
+    enum class StoreOp
+    {
+        STORE,
+        DONT_CARE,
+    };
+
+    struct Attachment
+    {
+        unsigned long long resource_id{0};
+        LoadOp load_op{LoadOp::LOAD};
+        StoreOp store_op{StoreOp::STORE};
+        // False when the step's render area covers only part of the attachment. The rest keeps its contents
+        // through the step, so a partial clear or write also counts as a read of the attachment.
+        bool full_area{true};
+    };
+
+    struct StepDesc
+    {
+        // Steps that are not raster passes only contribute their accesses.
+        bool raster{false};
+        // Sorted by resource_id.
+        std::vector<Attachment> attachments;
+        // Accesses other than through attachments, sorted and duplicate-free.
+        std::vector<unsigned long long> reads;
+        std::vector<unsigned long long> writes;
+        // States the step needs its resources in; merged steps have to agree on every resource they share.
+        std::vector<std::pair<unsigned long long, unsigned>> states;
+        // Only steps rendering to the same area merge.
+        unsigned long long render_area_key{0};
+    };
+
+    struct StepOps
+    {
+        // Ops of the rendering scope the step records in, parallel to StepDesc::attachments: the loads of the
+        // first step of its group and the stores of the last. Empty for steps that are not raster passes.
+        std::vector<LoadOp> load_ops;
+        std::vector<StoreOp> store_ops;
+        // Sorted attachments the rendering scope clears over their whole extent, so their contents from before
+        // the scope are never observed.
+        std::vector<unsigned long long> cleared_resources;
+        // Inclusive range of execution-order indices sharing the rendering scope.
+        unsigned group_begin{0};
+        unsigned group_end{0};
+    };
+
+    struct Options
+    {
+        bool infer_store_ops{true};
+        bool merge_steps{true};
+    };
+
+    struct Plan
+    {
+        // Parallel to the execution order.
+        std::vector<StepOps> steps;
+        // Groups of more than one step, and the steps recorded inside another step's rendering scope.
+        unsigned merged_group_count{0};
+        unsigned merged_step_count{0};
+        // Loads and stores the declared ops would have done that the plan skips.
+        unsigned elided_load_count{0};
+        unsigned elided_store_count{0};
+    };
+
+    // persistent_resources is sorted and lists resources whose contents outlive the frame, such as outputs.
+    Plan BuildPlan(const std::vector<StepDesc>& execution_steps, const std::vector<unsigned long long>& persistent_resources, const Options& options);
+
+    // One line per step, stable across runs, for golden-file comparisons.
+    std::string DumpPlan(const Plan& plan);
+}
@@ -0,0 +1,156 @@
+#include "RenderGraphBarrierPlanner.h"
+
+#include <cstdio>
+#include <map>
+
+namespace
+{
+    using namespace RenderGraphBarrierPlanner;
+
+    struct ResourceTracker
+    {
+        unsigned last_step{INVALID_INDEX};
+        unsigned last_state{UNKNOWN_STATE};
+    };
+
+    struct StepRequest
+    {
+        unsigned state{0};
+        bool allow_split{true};
+        bool conflicting{false};
+    };
+
+    const char* ToBarrierTypeName(BarrierType type)
+    {
+        switch (type)
+        {
+        case BarrierType::FULL:
+            return "FULL";
+        case BarrierType::SPLIT_BEGIN:
+            return "SPLIT_BEGIN";
+        case BarrierType::SPLIT_END:
+            return "SPLIT_END";
+        }
+        return "UNKNOWN";
+    }
+
+    void AppendBarrierLine(std::string& out, unsigned step_index, const char* slot, const Barrier& barrier)
+    {
+        char before_state[16] = "?";
+        if (barrier.before_state != UNKNOWN_STATE)
+        {
+            std::snprintf(before_state, sizeof(before_state), "%u", barrier.before_state);
+        }
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "pass %u %s %s resource=0x%llx %s->%u",
+            step_index,
+            slot,
+            ToBarrierTypeName(barrier.type),
+            barrier.resource_id,
+            before_state,
+            barrier.after_state);
+        out += line;
+        if (barrier.paired_step != INVALID_INDEX)
+        {
+            std::snprintf(line, sizeof(line), " paired=%u", barrier.paired_step);
+            out += line;
+        }
+        out += '\n';
+    }
+}
+
+RenderGraphBarrierPlanner::Plan RenderGraphBarrierPlanner::BuildPlan(const std::vector<std::vector<StateRequest>>& execution_steps)
+{
+    Plan plan{};
+    plan.passes.resize(execution_steps.size());
+
+    std::map<unsigned long long, ResourceTracker> trackers;
+    for (unsigned step_index = 0; step_index < execution_steps.size(); ++step_index)
+    {
+        // A pass may bind one resource through several slots; merge them and detect mismatching states.
+        std::map<unsigned long long, StepRequest> step_requests;
+        for (const auto& request : execution_steps[step_index])
+        {
+            auto [it, inserted] = step_requests.try_emplace(request.resource_id);
+            auto& step_request = it->second;
+            if (inserted)
+            {
+                step_request.state = request.state;
+            }
+            else if (step_request.state != request.state)
+            {
+                step_request.conflicting = true;
+            }
+            step_request.allow_split = step_request.allow_split && request.allow_split;
+        }
+
+        auto& pass_barriers = plan.passes[step_index];
+        for (const auto& step_request_pair : step_requests)
+        {
+            const unsigned long long resource_id = step_request_pair.first;
+            const auto& step_request = step_request_pair.second;
+            if (step_request.conflicting)
+            {
+                // The pass resolves the order itself; the next pass must not assume a known state.
+                ++plan.conflicting_request_count;
+                trackers.erase(resource_id);
+                continue;
+            }
+
+            auto& tracker = trackers[resource_id];
+            if (tracker.last_step == INVALID_INDEX)
+            {
+                pass_barriers.before_pass.push_back({resource_id, UNKNOWN_STATE, step_request.state, BarrierType::FULL, INVALID_INDEX});
+                ++plan.full_barrier_count;
+            }
+            else if (tracker.last_state != step_request.state)
+            {
+                if (step_request.allow_split && step_index > tracker.last_step + 1)
+                {
+                    plan.passes[tracker.last_step].after_pass.push_back(
+                        {resource_id, tracker.last_state, step_request.state, BarrierType::SPLIT_BEGIN, step_index});
+                    pass_barriers.before_pass.push_back(
+                        {resource_id, tracker.last_state, step_request.state, BarrierType::SPLIT_END, tracker.last_step});
+                    ++plan.split_barrier_count;
+                }
+                else
+                {
+                    pass_barriers.before_pass.push_back({resource_id, tracker.last_state, step_request.state, BarrierType::FULL, INVALID_INDEX});
+                    ++plan.full_barrier_count;
+                }
+            }
+
+            tracker.last_step = step_index;
+            tracker.last_state = step_request.state;
+        }
+    }
+
+    return plan;
+}
+
+std::string RenderGraphBarrierPlanner::DumpPlan(const Plan& plan)
+{
+    std::string result;
+    char header[128];
+    std::snprintf(header, sizeof(header), "passes=%u full=%u split=%u conflicting=%u\n",
+        static_cast<unsigned>(plan.passes.size()),
+        plan.full_barrier_count,
+        plan.split_barrier_count,
+        plan.conflicting_request_count);
+    result += header;
+
+    for (unsigned step_index = 0; step_index < plan.passes.size(); ++step_index)
+    {
+        for (const auto& barrier : plan.passes[step_index].before_pass)
+        {
+            AppendBarrierLine(result, step_index, "before", barrier);
+        }
+        for (const auto& barrier : plan.passes[step_index].after_pass)
+        {
+            AppendBarrierLine(result, step_index, "after", barrier);
+        }
+    }
+
+    return result;
+}
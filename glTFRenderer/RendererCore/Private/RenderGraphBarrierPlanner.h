@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Per-pass resource barrier plan for an execution order. Every transition a pass needs is gathered into
+// one group issued right before it, and a transition whose resource is idle for at least one pass
+// between producer and consumer is split: begun right after the producer, ended before the consumer.
+// The render graph keys resources by their RHI object address and passes RHIResourceStateType values as states.
+namespace RenderGraphBarrierPlanner
+{
+    constexpr unsigned INVALID_INDEX = 0xffffffffu;
+    constexpr unsigned UNKNOWN_STATE = 0xffffffffu;
+
+    struct StateRequest
+    {
+        unsigned long long resource_id{0};
+        unsigned state{0};
+        // Only resources that nothing outside the graph touches mid-frame may stay in a split transition.
+        bool allow_split{false};
+    };
+
+    enum class BarrierType
+    {
+        FULL,
+        SPLIT_BEGIN,
+        SPLIT_END,
+    };
+
+    struct Barrier
+    {
+        unsigned long long resource_id{0};
+        // UNKNOWN_STATE for the first use in the frame; the runtime tracked state is used instead.
+        unsigned before_state{UNKNOWN_STATE};
+        unsigned after_state{0};
+        BarrierType type{BarrierType::FULL};
+        // Step of the other half of a split pair, INVALID_INDEX for full barriers.
+        unsigned paired_step{INVALID_INDEX};
+    };
+
+    struct PassBarriers
+    {
+        // FULL and SPLIT_END barriers, recorded as one batch before the pass.
+        std::vector<Barrier> before_pass;
+        // SPLIT_BEGIN barriers, recorded as one batch after the pass.
+        std::vector<Barrier> after_pass;
+    };
+
+    struct Plan
+    {
+        // Parallel to the execution order.
+        std::vector<PassBarriers> passes;
+        unsigned full_barrier_count{0};
+        unsigned split_barrier_count{0};
+        // Resources a single pass asked for in two different states; left to per-binding transitions.
+        unsigned conflicting_request_count{0};
+    };
+
+    // execution_steps[i] lists the states the i-th pass in execution order needs its resources in.
+    Plan BuildPlan(const std::vector<std::vector<StateRequest>>& execution_steps);
+
+    // One line per barrier, stable across runs, for golden-file comparisons.
+    std::string DumpPlan(const Plan& plan);
+}
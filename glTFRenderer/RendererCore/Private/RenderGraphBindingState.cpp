@@ -0,0 +1,68 @@
+#include "RenderGraphBindingState.h"
+
+namespace RenderGraphBindingState
+{
+    Tracker::Tracker(const Policy& policy)
+        : m_policy(policy)
+    {
+    }
+
+    void Tracker::Reset()
+    {
+        m_states.fill(BoundValue{});
+        m_root_signatures.fill(BoundValue{});
+        for (auto& root_arguments : m_root_arguments)
+        {
+            root_arguments.clear();
+        }
+    }
+
+    bool Tracker::SetState(StateSlot slot, const StateValue& value)
+    {
+        if (slot == StateSlot::PIPELINE_STATE && !m_policy.dynamic_state_survives_pipeline_change)
+        {
+            const auto& bound_pipeline_state = m_states[static_cast<unsigned>(StateSlot::PIPELINE_STATE)];
+            if (!bound_pipeline_state.valid || bound_pipeline_state.value != value)
+            {
+                m_states[static_cast<unsigned>(StateSlot::PRIMITIVE_TOPOLOGY)] = BoundValue{};
+                m_states[static_cast<unsigned>(StateSlot::VIEWPORT)] = BoundValue{};
+                m_states[static_cast<unsigned>(StateSlot::SCISSOR_RECT)] = BoundValue{};
+            }
+        }
+        return Update(true, m_states[static_cast<unsigned>(slot)], value);
+    }
+
+    bool Tracker::SetRootSignature(RootTable table, const StateValue& value)
+    {
+        auto& bound_root_signature = m_root_signatures[static_cast<unsigned>(table)];
+        if (!bound_root_signature.valid || bound_root_signature.value != value)
+        {
+            m_root_arguments[static_cast<unsigned>(table)].clear();
+        }
+        return Update(m_policy.root_arguments_persist, bound_root_signature, value);
+    }
+
+    bool Tracker::SetRootArgument(RootTable table, unsigned root_parameter_index, const StateValue& value)
+    {
+        auto& root_arguments = m_root_arguments[static_cast<unsigned>(table)];
+        if (root_parameter_index >= root_arguments.size())
+        {
+            root_arguments.resize(root_parameter_index + 1u);
+        }
+        return Update(m_policy.root_arguments_persist, root_arguments[root_parameter_index], value);
+    }
+
+    bool Tracker::Update(bool tracked, BoundValue& inout_bound, const StateValue& value)
+    {
+        if (m_policy.skip_redundant_calls && tracked && inout_bound.valid && inout_bound.value == value)
+        {
+            ++m_counters.skipped_count;
+            return false;
+        }
+
+        inout_bound.valid = true;
+        inout_bound.value = value;
+        ++m_counters.issued_count;
+        return true;
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Binding state last recorded into one command list, to drop calls that would set what is already bound.
+// Bound objects and state descriptions are opaque values compared bit for bit, so the tracker has no RHI
+// dependency and can be driven headless by a recording stub.
+namespace RenderGraphBindingState
+{
+    enum class StateSlot
+    {
+        PIPELINE_STATE,
+        PRIMITIVE_TOPOLOGY,
+        VIEWPORT,
+        SCISSOR_RECT,
+        DESCRIPTOR_CONTEXT,
+        INDEX_BUFFER,
+        COUNT,
+    };
+
+    // Graphics and compute pipelines have their own root signature and root arguments.
+    enum class RootTable
+    {
+        GRAPHICS,
+        COMPUTE,
+        COUNT,
+    };
+
+    struct StateValue
+    {
+        std::array<std::uint64_t, 3> words{};
+
+        friend bool operator==(const StateValue& lhs, const StateValue& rhs) { return lhs.words == rhs.words; }
+        friend bool operator!=(const StateValue& lhs, const StateValue& rhs) { return lhs.words != rhs.words; }
+    };
+
+    // Pointers compare by identity, plain descriptions such as viewports by value.
+    template <typename T>
+    StateValue MakeStateValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(StateValue::words));
+        StateValue result{};
+        std::memcpy(result.words.data(), &value, sizeof(T));
+        return result;
+    }
+
+    struct Policy
+    {
+        // Off makes every call issue, which keeps the counters comparable with the skipping enabled.
+        bool skip_redundant_calls{true};
+        // Root arguments stay bound until the root signature changes (DX12). Backends that rebuild and bind
+        // descriptor sets per pass (Vulkan) have to see every root signature and argument call.
+        bool root_arguments_persist{false};
+        // Topology, viewport and scissor survive a pipeline change (DX12). Vulkan only keeps dynamic state
+        // across pipelines that all declare it dynamic, so a new pipeline drops it there.
+        bool dynamic_state_survives_pipeline_change{false};
+    };
+
+    struct Counters
+    {
+        unsigned issued_count{0};
+        unsigned skipped_count{0};
+    };
+
+    class Tracker
+    {
+    public:
+        explicit Tracker(const Policy& policy);
+
+        // Forgets everything bound, for a new command list or after recording it did not go through the tracker.
+        void Reset();
+
+        // Each call returns whether the matching command has to be recorded, and assumes it is when true.
+        bool SetState(StateSlot slot, const StateValue& value);
+        // A different root signature drops the root arguments bound through the table.
+        bool SetRootSignature(RootTable table, const StateValue& value);
+        bool SetRootArgument(RootTable table, unsigned root_parameter_index, const StateValue& value);
+
+        const Counters& GetCounters() const { return m_counters; }
+
+    private:
+        struct BoundValue
+        {
+            bool valid{false};
+            StateValue value{};
+        };
+
+        bool Update(bool tracked, BoundValue& inout_bound, const StateValue& value);
+
+        Policy m_policy;
+        std::array<BoundValue, static_cast<unsigned>(StateSlot::COUNT)> m_states{};
+        std::array<BoundValue, static_cast<unsigned>(RootTable::COUNT)> m_root_signatures{};
+        std::array<std::vector<BoundValue>, static_cast<unsigned>(RootTable::COUNT)> m_root_arguments;
+        Counters m_counters{};
+    };
+}
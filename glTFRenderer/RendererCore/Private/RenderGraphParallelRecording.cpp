@@ -0,0 +1,181 @@
+#include "RenderGraphParallelRecording.h"
+
+#include <algorithm>
+
+std::vector<RenderGraphParallelRecording::Segment> RenderGraphParallelRecording::BuildSegments(
+    const std::vector<float>& pass_costs,
+    unsigned max_segment_count,
+    unsigned min_passes_per_segment)
+{
+    std::vector<Segment> segments;
+    const unsigned pass_count = static_cast<unsigned>(pass_costs.size());
+    if (pass_count == 0)
+    {
+        return segments;
+    }
+
+    const unsigned normalized_min_passes = (std::max)(min_passes_per_segment, 1u);
+    const unsigned segment_count = (std::max)(1u, (std::min)(max_segment_count, pass_count / normalized_min_passes));
+
+    float total_cost = 0.0f;
+    for (const float cost : pass_costs)
+    {
+        total_cost += (std::max)(cost, 0.0f);
+    }
+
+    // Cut whenever the running cost crosses the next equal share, as long as every remaining segment
+    // can still get its minimum pass count.
+    unsigned segment_begin = 0;
+    float running_cost = 0.0f;
+    for (unsigned pass_index = 0; pass_index < pass_count && segments.size() + 1 < segment_count; ++pass_index)
+    {
+        running_cost += (std::max)(pass_costs[pass_index], 0.0f);
+        const unsigned segment_pass_count = pass_index + 1 - segment_begin;
+        const unsigned remaining_pass_count = pass_count - pass_index - 1;
+        const unsigned remaining_segment_count = segment_count - static_cast<unsigned>(segments.size()) - 1;
+        const float cut_cost = total_cost * static_cast<float>(segments.size() + 1) / static_cast<float>(segment_count);
+        if (segment_pass_count >= normalized_min_passes &&
+            remaining_pass_count >= remaining_segment_count * normalized_min_passes &&
+            (running_cost >= cut_cost || remaining_pass_count == remaining_segment_count * normalized_min_passes))
+        {
+            segments.push_back({segment_begin, pass_index + 1});
+            segment_begin = pass_index + 1;
+        }
+    }
+    segments.push_back({segment_begin, pass_count});
+
+    return segments;
+}
+
+RenderGraphParallelRecording::WorkerPool::WorkerPool(unsigned worker_count)
+{
+    m_threads.reserve(worker_count);
+    for (unsigned worker_index = 0; worker_index < worker_count; ++worker_index)
+    {
+        m_threads.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+}
+
+RenderGraphParallelRecording::WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake_condition.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+unsigned RenderGraphParallelRecording::WorkerPool::GetWorkerCount() const
+{
+    return static_cast<unsigned>(m_threads.size());
+}
+
+void RenderGraphParallelRecording::WorkerPool::Run(unsigned task_count, const std::function<void(unsigned)>& task)
+{
+    if (task_count == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_task_count = task_count;
+        m_finished_task_count = 0;
+        m_next_task_index.store(0);
+        ++m_generation;
+    }
+    m_wake_condition.notify_all();
+
+    Drain(task, task_count);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Workers still inside Drain hold a reference to task; wait for them before it goes out of scope.
+    m_done_condition.wait(lock, [this]()
+    {
+        return m_finished_task_count == m_task_count && m_active_worker_count == 0;
+    });
+    m_task = nullptr;
+    if (m_task_exception)
+    {
+        std::exception_ptr task_exception = nullptr;
+        std::swap(task_exception, m_task_exception);
+        lock.unlock();
+        std::rethrow_exception(task_exception);
+    }
+}
+
+void RenderGraphParallelRecording::WorkerPool::WorkerLoop()
+{
+    unsigned long long seen_generation = 0;
+    while (true)
+    {
+        const std::function<void(unsigned)>* task = nullptr;
+        unsigned task_count = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake_condition.wait(lock, [&]()
+            {
+                return m_stop || m_generation != seen_generation;
+            });
+            if (m_stop)
+            {
+                return;
+            }
+
+            seen_generation = m_generation;
+            if (!m_task)
+            {
+                // Woke up after the run already completed.
+                continue;
+            }
+            task = m_task;
+            task_count = m_task_count;
+            ++m_active_worker_count;
+        }
+
+        Drain(*task, task_count);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_active_worker_count;
+        }
+        m_done_condition.notify_all();
+    }
+}
+
+void RenderGraphParallelRecording::WorkerPool::Drain(const std::function<void(unsigned)>& task, unsigned task_count)
+{
+    while (true)
+    {
+        const unsigned task_index = m_next_task_index.fetch_add(1);
+        if (task_index >= task_count)
+        {
+            return;
+        }
+
+        std::exception_ptr task_exception = nullptr;
+        try
+        {
+            task(task_index);
+        }
+        catch (...)
+        {
+            task_exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (task_exception && !m_task_exception)
+            {
+                m_task_exception = task_exception;
+            }
+            ++m_finished_task_count;
+        }
+        m_done_condition.notify_all();
+    }
+}
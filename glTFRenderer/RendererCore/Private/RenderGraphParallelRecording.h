@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Splits an execution order into contiguous segments that are recorded concurrently into separate
+// command lists and submitted in order. Segments never reorder passes, so the submission keeps the
+// semantics of recording everything on one list.
+namespace RenderGraphParallelRecording
+{
+    struct Segment
+    {
+        // Half-open range of execution-order indices.
+        unsigned begin{0};
+        unsigned end{0};
+    };
+
+    // pass_costs[i] estimates the recording cost of the i-th pass. Balances cost across at most
+    // max_segment_count segments with at least min_passes_per_segment passes each.
+    std::vector<Segment> BuildSegments(const std::vector<float>& pass_costs, unsigned max_segment_count, unsigned min_passes_per_segment);
+
+    // Fork-join pool; the calling thread takes tasks too, so a pool without workers runs serially.
+    class WorkerPool
+    {
+    public:
+        explicit WorkerPool(unsigned worker_count);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        unsigned GetWorkerCount() const;
+        // Calls task(i) for every i in [0, task_count) and returns when all calls have finished. The first
+        // exception thrown by a task is rethrown here.
+        void Run(unsigned task_count, const std::function<void(unsigned)>& task);
+
+    private:
+        void WorkerLoop();
+        void Drain(const std::function<void(unsigned)>& task, unsigned task_count);
+
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_wake_condition;
+        std::condition_variable m_done_condition;
+        const std::function<void(unsigned)>* m_task{nullptr};
+        unsigned m_task_count{0};
+        unsigned m_finished_task_count{0};
+        unsigned m_active_worker_count{0};
+        unsigned long long m_generation{0};
+        bool m_stop{false};
+        std::exception_ptr m_task_exception;
+        std::atomic<unsigned> m_next_task_index{0};
+    };
+}
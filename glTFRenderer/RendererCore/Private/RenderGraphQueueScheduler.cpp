@@ -0,0 +1,192 @@
+#include "RenderGraphQueueScheduler.h"
+
+#include <cstdio>
+
+namespace
+{
+    using namespace RenderGraphQueueScheduler;
+
+    unsigned ToQueueIndex(Queue queue)
+    {
+        return queue == Queue::GRAPHICS ? 0u : 1u;
+    }
+
+    const char* ToQueueName(Queue queue)
+    {
+        switch (queue)
+        {
+        case Queue::GRAPHICS:
+            return "GRAPHICS";
+        case Queue::ASYNC_COMPUTE:
+            return "ASYNC_COMPUTE";
+        }
+        return "UNKNOWN";
+    }
+}
+
+RenderGraphQueueScheduler::Schedule RenderGraphQueueScheduler::BuildSchedule(const std::vector<StepDesc>& execution_steps)
+{
+    Schedule schedule{};
+    const unsigned step_count = static_cast<unsigned>(execution_steps.size());
+    schedule.steps.resize(step_count);
+
+    unsigned queue_step_counts[2] = {0, 0};
+    // Latest step of the other queue each queue has waited for; queue order makes earlier ones complete too.
+    unsigned waited_steps[2] = {INVALID_INDEX, INVALID_INDEX};
+    // Graphics step the async queue had waited for when each async step was scheduled.
+    std::vector<unsigned> async_lower_bounds(step_count, INVALID_INDEX);
+    unsigned last_async_step = INVALID_INDEX;
+
+    for (unsigned step_index = 0; step_index < step_count; ++step_index)
+    {
+        const auto& step_desc = execution_steps[step_index];
+        auto& step = schedule.steps[step_index];
+        if (step_desc.request_async_compute && step_desc.compute_only)
+        {
+            step.queue = Queue::ASYNC_COMPUTE;
+            ++schedule.async_step_count;
+            last_async_step = step_index;
+        }
+        else if (step_desc.request_async_compute)
+        {
+            ++schedule.demoted_step_count;
+        }
+
+        const unsigned queue_index = ToQueueIndex(step.queue);
+        step.queue_position = queue_step_counts[queue_index]++;
+
+        unsigned latest_other_queue_dependency = INVALID_INDEX;
+        bool has_other_queue_dependency = false;
+        for (const unsigned dependency : step_desc.dependencies)
+        {
+            if (dependency >= step_index || schedule.steps[dependency].queue == step.queue)
+            {
+                continue;
+            }
+            if (has_other_queue_dependency)
+            {
+                ++schedule.elided_wait_count;
+            }
+            if (!has_other_queue_dependency || dependency > latest_other_queue_dependency)
+            {
+                latest_other_queue_dependency = dependency;
+            }
+            has_other_queue_dependency = true;
+        }
+
+        if (has_other_queue_dependency)
+        {
+            unsigned& waited_step = waited_steps[queue_index];
+            if (waited_step == INVALID_INDEX || latest_other_queue_dependency > waited_step)
+            {
+                const Queue other_queue = step.queue == Queue::GRAPHICS ? Queue::ASYNC_COMPUTE : Queue::GRAPHICS;
+                schedule.sync_points.push_back({other_queue, latest_other_queue_dependency, step.queue, step_index});
+                waited_step = latest_other_queue_dependency;
+            }
+            else
+            {
+                ++schedule.elided_wait_count;
+            }
+        }
+
+        if (step.queue == Queue::ASYNC_COMPUTE)
+        {
+            async_lower_bounds[step_index] = waited_steps[ToQueueIndex(Queue::ASYNC_COMPUTE)];
+        }
+    }
+
+    const unsigned graphics_waited_step = waited_steps[ToQueueIndex(Queue::GRAPHICS)];
+    if (last_async_step != INVALID_INDEX &&
+        (graphics_waited_step == INVALID_INDEX || graphics_waited_step < last_async_step))
+    {
+        schedule.sync_points.push_back({Queue::ASYNC_COMPUTE, last_async_step, Queue::GRAPHICS, INVALID_INDEX});
+    }
+
+    // An async step can start once its last graphics wait is satisfied and must finish before the first
+    // graphics wait on it or on a later async step; graphics steps in between may run concurrently.
+    for (unsigned step_index = 0; step_index < step_count; ++step_index)
+    {
+        auto& step = schedule.steps[step_index];
+        if (step.queue != Queue::ASYNC_COMPUTE)
+        {
+            continue;
+        }
+
+        unsigned upper_bound = step_count;
+        for (const auto& sync_point : schedule.sync_points)
+        {
+            if (sync_point.wait_queue == Queue::GRAPHICS && sync_point.signal_after_step >= step_index)
+            {
+                upper_bound = sync_point.wait_before_step == INVALID_INDEX ? step_count : sync_point.wait_before_step;
+                break;
+            }
+        }
+
+        const unsigned lower_bound = async_lower_bounds[step_index];
+        const unsigned first_candidate = lower_bound == INVALID_INDEX ? 0 : lower_bound + 1;
+        for (unsigned graphics_step = first_candidate; graphics_step < upper_bound; ++graphics_step)
+        {
+            if (schedule.steps[graphics_step].queue != Queue::GRAPHICS)
+            {
+                continue;
+            }
+            if (step.first_overlapping_graphics_step == INVALID_INDEX)
+            {
+                step.first_overlapping_graphics_step = graphics_step;
+            }
+            step.last_overlapping_graphics_step = graphics_step;
+            ++step.overlapping_graphics_step_count;
+        }
+    }
+
+    return schedule;
+}
+
+std::string RenderGraphQueueScheduler::DumpSchedule(const Schedule& schedule)
+{
+    std::string result;
+    char line[160];
+    std::snprintf(line, sizeof(line), "steps=%u async=%u demoted=%u syncs=%u elided=%u\n",
+        static_cast<unsigned>(schedule.steps.size()),
+        schedule.async_step_count,
+        schedule.demoted_step_count,
+        static_cast<unsigned>(schedule.sync_points.size()),
+        schedule.elided_wait_count);
+    result += line;
+
+    for (unsigned step_index = 0; step_index < schedule.steps.size(); ++step_index)
+    {
+        const auto& step = schedule.steps[step_index];
+        std::snprintf(line, sizeof(line), "pass %u %s #%u", step_index, ToQueueName(step.queue), step.queue_position);
+        result += line;
+        if (step.overlapping_graphics_step_count > 0)
+        {
+            std::snprintf(line, sizeof(line), " overlaps=%u..%u (%u)",
+                step.first_overlapping_graphics_step,
+                step.last_overlapping_graphics_step,
+                step.overlapping_graphics_step_count);
+            result += line;
+        }
+        result += '\n';
+    }
+
+    for (const auto& sync_point : schedule.sync_points)
+    {
+        std::snprintf(line, sizeof(line), "sync %s after %u -> %s ",
+            ToQueueName(sync_point.signal_queue),
+            sync_point.signal_after_step,
+            ToQueueName(sync_point.wait_queue));
+        result += line;
+        if (sync_point.wait_before_step == INVALID_INDEX)
+        {
+            result += "frame end\n";
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "before %u\n", sync_point.wait_before_step);
+            result += line;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Splits an execution order across the graphics queue and an async compute queue. Each queue keeps the
+// execution order of its own steps; a cross-queue wait is only inserted where a dependency is not
+// already covered by an earlier wait of the same queue. Steps and sync points refer to positions in the
+// execution order, which the render graph maps back to its nodes when recording.
+namespace RenderGraphQueueScheduler
+{
+    constexpr unsigned INVALID_INDEX = 0xffffffffu;
+
+    enum class Queue
+    {
+        GRAPHICS,
+        ASYNC_COMPUTE,
+    };
+
+    struct StepDesc
+    {
+        bool request_async_compute{false};
+        // Steps that record rasterization or ray tracing work stay on the graphics queue.
+        bool compute_only{false};
+        // Earlier steps whose results this step consumes or whose reads it overwrites.
+        std::vector<unsigned> dependencies;
+    };
+
+    struct SyncPoint
+    {
+        Queue signal_queue{Queue::GRAPHICS};
+        unsigned signal_after_step{INVALID_INDEX};
+        Queue wait_queue{Queue::GRAPHICS};
+        // INVALID_INDEX for the end-of-frame join of trailing async work.
+        unsigned wait_before_step{INVALID_INDEX};
+    };
+
+    struct StepSchedule
+    {
+        Queue queue{Queue::GRAPHICS};
+        // Index among the steps of the same queue.
+        unsigned queue_position{0};
+        // Graphics steps an async step may run concurrently with; INVALID_INDEX and 0 on graphics steps.
+        unsigned first_overlapping_graphics_step{INVALID_INDEX};
+        unsigned last_overlapping_graphics_step{INVALID_INDEX};
+        unsigned overlapping_graphics_step_count{0};
+    };
+
+    struct Schedule
+    {
+        // Parallel to the execution order.
+        std::vector<StepSchedule> steps;
+        // Ordered by wait step, end-of-frame joins last.
+        std::vector<SyncPoint> sync_points;
+        unsigned async_step_count{0};
+        // Steps that asked for async compute but are not compute-only.
+        unsigned demoted_step_count{0};
+        // Cross-queue dependencies covered by another wait of the same queue instead of their own.
+        unsigned elided_wait_count{0};
+    };
+
+    Schedule BuildSchedule(const std::vector<StepDesc>& execution_steps);
+
+    // One line per step and sync point, stable across runs, for golden-file comparisons.
+    std::string DumpSchedule(const Schedule& schedule);
+}
@@ -0,0 +1,93 @@
+#include "RenderGraphTraceExport.h"
+
+#include <algorithm>
+#include <nlohmann_json/single_include/nlohmann/json.hpp>
+
+unsigned RenderGraphTraceExport::FindOrAddTrack(Trace& trace, const Track& track)
+{
+    for (unsigned track_index = 0; track_index < trace.tracks.size(); ++track_index)
+    {
+        const auto& existing_track = trace.tracks[track_index];
+        if (existing_track.process_id == track.process_id && existing_track.thread_id == track.thread_id)
+        {
+            return track_index;
+        }
+    }
+
+    trace.tracks.push_back(track);
+    return static_cast<unsigned>(trace.tracks.size() - 1);
+}
+
+std::string RenderGraphTraceExport::BuildChromeTraceJson(const Trace& trace)
+{
+    double origin_ms = 0.0;
+    for (size_t span_index = 0; span_index < trace.spans.size(); ++span_index)
+    {
+        origin_ms = span_index == 0 ? trace.spans[0].begin_ms : (std::min)(origin_ms, trace.spans[span_index].begin_ms);
+    }
+
+    nlohmann::json events = nlohmann::json::array();
+    std::vector<unsigned> named_processes;
+    for (const auto& track : trace.tracks)
+    {
+        if (std::find(named_processes.begin(), named_processes.end(), track.process_id) == named_processes.end())
+        {
+            named_processes.push_back(track.process_id);
+            events.push_back({
+                {"ph", "M"}, {"name", "process_name"}, {"pid", track.process_id}, {"tid", 0},
+                {"args", {{"name", track.process_name}}}});
+        }
+        events.push_back({
+            {"ph", "M"}, {"name", "thread_name"}, {"pid", track.process_id}, {"tid", track.thread_id},
+            {"args", {{"name", track.thread_name}}}});
+        // Keep the viewer's track order the order tracks were added in.
+        events.push_back({
+            {"ph", "M"}, {"name", "thread_sort_index"}, {"pid", track.process_id}, {"tid", track.thread_id},
+            {"args", {{"sort_index", track.thread_id}}}});
+    }
+
+    std::vector<const Span*> spans;
+    spans.reserve(trace.spans.size());
+    for (const auto& span : trace.spans)
+    {
+        spans.push_back(&span);
+    }
+    // Enclosing spans first on ties, so viewers nest rather than stack them.
+    std::stable_sort(spans.begin(), spans.end(), [](const Span* lhs, const Span* rhs)
+    {
+        if (lhs->track_index != rhs->track_index)
+        {
+            return lhs->track_index < rhs->track_index;
+        }
+        if (lhs->begin_ms != rhs->begin_ms)
+        {
+            return lhs->begin_ms < rhs->begin_ms;
+        }
+        return lhs->end_ms > rhs->end_ms;
+    });
+
+    for (const Span* span : spans)
+    {
+        const auto& track = trace.tracks[span->track_index];
+        nlohmann::json args = {{"frame", span->frame_index}};
+        if (!span->gpu_calibrated)
+        {
+            args["gpu_calibrated"] = false;
+        }
+        events.push_back({
+            {"ph", "X"},
+            {"name", span->name},
+            {"cat", span->category},
+            {"pid", track.process_id},
+            {"tid", track.thread_id},
+            // Trace-event times are microseconds.
+            {"ts", (span->begin_ms - origin_ms) * 1000.0},
+            {"dur", (std::max)(0.0, span->end_ms - span->begin_ms) * 1000.0},
+            {"args", std::move(args)}});
+    }
+
+    nlohmann::json root;
+    root["traceEvents"] = std::move(events);
+    root["displayTimeUnit"] = "ms";
+    return root.dump();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Frame timelines in the Chrome trace-event format, which chrome://tracing and the Perfetto UI both load.
+// Spans carry absolute times in milliseconds on one CPU timeline; GPU spans are expected to have been
+// mapped onto it already. Tracks group spans into processes and threads of the viewer.
+namespace RenderGraphTraceExport
+{
+    struct Track
+    {
+        unsigned process_id{0};
+        unsigned thread_id{0};
+        std::string process_name;
+        std::string thread_name;
+    };
+
+    struct Span
+    {
+        unsigned track_index{0};
+        std::string name;
+        std::string category;
+        double begin_ms{0.0};
+        double end_ms{0.0};
+        unsigned long long frame_index{0};
+        // GPU spans only: false when the GPU clock could not be calibrated and the span was anchored to the
+        // frame's submission instead.
+        bool gpu_calibrated{true};
+    };
+
+    struct Trace
+    {
+        std::vector<Track> tracks;
+        std::vector<Span> spans;
+    };
+
+    // Returns the index of the track, adding it on first use.
+    unsigned FindOrAddTrack(Trace& trace, const Track& track);
+
+    // Timestamps are rebased to the earliest span so the viewer starts at zero. Spans are written ordered by
+    // track and begin time, so the output is stable across runs for the same input.
+    std::string BuildChromeTraceJson(const Trace& trace);
+}
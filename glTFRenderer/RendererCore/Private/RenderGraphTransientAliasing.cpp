@@ -0,0 +1,242 @@
+#include "RenderGraphTransientAliasing.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+namespace
+{
+    using namespace RenderGraphTransientAliasing;
+
+    unsigned long long AlignUp(unsigned long long value, unsigned long long alignment)
+    {
+        const unsigned long long normalized_alignment = (std::max)(alignment, 1ull);
+        return (value + normalized_alignment - 1) / normalized_alignment * normalized_alignment;
+    }
+
+    bool LifetimesOverlap(const ResourceRequest& lhs, const ResourceRequest& rhs)
+    {
+        return lhs.first_use <= rhs.last_use && rhs.first_use <= lhs.last_use;
+    }
+
+    bool RangesOverlap(const Placement& lhs, unsigned long long lhs_size, const Placement& rhs, unsigned long long rhs_size)
+    {
+        return lhs.offset < rhs.offset + rhs_size && rhs.offset < lhs.offset + lhs_size;
+    }
+
+    // Lowest aligned offset in the heap not used by any live request, or heap size when none fits.
+    unsigned long long FindFreeOffset(
+        const std::vector<ResourceRequest>& requests,
+        const Plan& plan,
+        const std::vector<unsigned>& heap_members,
+        unsigned heap_index,
+        unsigned request_index)
+    {
+        const auto& request = requests[request_index];
+        std::vector<std::pair<unsigned long long, unsigned long long>> live_ranges;
+        for (const unsigned member_index : heap_members)
+        {
+            if (LifetimesOverlap(requests[member_index], request))
+            {
+                const auto offset = plan.placements[member_index].offset;
+                live_ranges.emplace_back(offset, offset + requests[member_index].size_bytes);
+            }
+        }
+        std::sort(live_ranges.begin(), live_ranges.end());
+
+        const unsigned long long heap_size = plan.heaps[heap_index].size_bytes;
+        unsigned long long candidate = 0;
+        for (const auto& live_range : live_ranges)
+        {
+            if (candidate + request.size_bytes <= live_range.first)
+            {
+                break;
+            }
+            candidate = (std::max)(candidate, AlignUp(live_range.second, request.alignment));
+        }
+
+        return candidate + request.size_bytes <= heap_size ? candidate : heap_size;
+    }
+}
+
+std::vector<Lifetime> RenderGraphTransientAliasing::ComputeLifetimes(const std::vector<std::vector<ResourceUse>>& execution_steps)
+{
+    std::map<unsigned long long, Lifetime> lifetimes;
+    for (unsigned step_index = 0; step_index < execution_steps.size(); ++step_index)
+    {
+        for (const auto& use : execution_steps[step_index])
+        {
+            if (!use.read && !use.write)
+            {
+                continue;
+            }
+
+            auto [it, inserted] = lifetimes.try_emplace(use.resource_id);
+            auto& lifetime = it->second;
+            if (inserted)
+            {
+                lifetime.resource_id = use.resource_id;
+                lifetime.first_use = step_index;
+                lifetime.first_use_discards = use.write && !use.read;
+            }
+            else if (lifetime.first_use == step_index)
+            {
+                // Same pass touching the resource through several bindings.
+                lifetime.first_use_discards = lifetime.first_use_discards && !use.read;
+            }
+            lifetime.last_use = step_index;
+        }
+    }
+
+    std::vector<Lifetime> result;
+    result.reserve(lifetimes.size());
+    for (const auto& lifetime_pair : lifetimes)
+    {
+        result.push_back(lifetime_pair.second);
+    }
+    return result;
+}
+
+RenderGraphTransientAliasing::Plan RenderGraphTransientAliasing::BuildPlan(const std::vector<ResourceRequest>& requests)
+{
+    Plan plan{};
+    plan.placements.resize(requests.size());
+
+    // Largest first: the first request of a heap sizes it, later ones pack into the gaps left by
+    // lifetime-disjoint members (first-fit interval coloring with sizes).
+    std::vector<unsigned> order(requests.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&](unsigned lhs, unsigned rhs)
+    {
+        const auto& lhs_request = requests[lhs];
+        const auto& rhs_request = requests[rhs];
+        if (lhs_request.size_bytes != rhs_request.size_bytes)
+        {
+            return lhs_request.size_bytes > rhs_request.size_bytes;
+        }
+        if (lhs_request.first_use != rhs_request.first_use)
+        {
+            return lhs_request.first_use < rhs_request.first_use;
+        }
+        return lhs_request.resource_id < rhs_request.resource_id;
+    });
+
+    std::vector<std::vector<unsigned>> heap_members;
+    for (const unsigned request_index : order)
+    {
+        const auto& request = requests[request_index];
+        plan.requested_bytes += request.size_bytes;
+
+        bool placed = false;
+        for (unsigned heap_index = 0; heap_index < plan.heaps.size() && !placed; ++heap_index)
+        {
+            const auto offset = FindFreeOffset(requests, plan, heap_members[heap_index], heap_index, request_index);
+            if (offset + request.size_bytes > plan.heaps[heap_index].size_bytes)
+            {
+                continue;
+            }
+
+            plan.placements[request_index] = {heap_index, offset};
+            plan.heaps[heap_index].alignment = (std::max)(plan.heaps[heap_index].alignment, request.alignment);
+            heap_members[heap_index].push_back(request_index);
+            placed = true;
+        }
+
+        if (!placed)
+        {
+            plan.placements[request_index] = {static_cast<unsigned>(plan.heaps.size()), 0};
+            plan.heaps.push_back({request.size_bytes, (std::max)(request.alignment, 1ull)});
+            heap_members.push_back({request_index});
+        }
+    }
+
+    for (unsigned heap_index = 0; heap_index < plan.heaps.size(); ++heap_index)
+    {
+        plan.heap_bytes += plan.heaps[heap_index].size_bytes;
+
+        const auto& members = heap_members[heap_index];
+        for (const unsigned after_index : members)
+        {
+            const auto& after_placement = plan.placements[after_index];
+            const auto after_size = requests[after_index].size_bytes;
+
+            unsigned previous_index = INVALID_INDEX;
+            unsigned previous_count = 0;
+            bool shares_memory = false;
+            for (const unsigned other_index : members)
+            {
+                if (other_index == after_index ||
+                    !RangesOverlap(after_placement, after_size, plan.placements[other_index], requests[other_index].size_bytes))
+                {
+                    continue;
+                }
+
+                shares_memory = true;
+                if (requests[other_index].last_use < requests[after_index].first_use)
+                {
+                    // Only the most recent occupants matter; older ones were already aliased away.
+                    if (previous_index == INVALID_INDEX || requests[other_index].last_use > requests[previous_index].last_use)
+                    {
+                        previous_index = other_index;
+                        previous_count = 1;
+                    }
+                    else if (requests[other_index].last_use == requests[previous_index].last_use)
+                    {
+                        ++previous_count;
+                    }
+                }
+            }
+
+            if (!shares_memory)
+            {
+                continue;
+            }
+
+            // No previous occupant in this frame: the range still holds whatever aliased it last frame.
+            plan.barriers.push_back({
+                requests[after_index].first_use,
+                previous_count == 1 ? previous_index : INVALID_INDEX,
+                after_index});
+        }
+    }
+
+    std::stable_sort(plan.barriers.begin(), plan.barriers.end(), [](const AliasingBarrier& lhs, const AliasingBarrier& rhs)
+    {
+        return lhs.execution_index < rhs.execution_index;
+    });
+
+    return plan;
+}
+
+bool RenderGraphTransientAliasing::ValidatePlan(const std::vector<ResourceRequest>& requests, const Plan& plan)
+{
+    if (plan.placements.size() != requests.size())
+    {
+        return false;
+    }
+
+    for (unsigned request_index = 0; request_index < requests.size(); ++request_index)
+    {
+        const auto& placement = plan.placements[request_index];
+        const auto& request = requests[request_index];
+        if (placement.heap_index >= plan.heaps.size() ||
+            placement.offset % (std::max)(request.alignment, 1ull) != 0 ||
+            placement.offset + request.size_bytes > plan.heaps[placement.heap_index].size_bytes)
+        {
+            return false;
+        }
+
+        for (unsigned other_index = request_index + 1; other_index < requests.size(); ++other_index)
+        {
+            const auto& other_placement = plan.placements[other_index];
+            if (other_placement.heap_index == placement.heap_index &&
+                LifetimesOverlap(request, requests[other_index]) &&
+                RangesOverlap(placement, request.size_bytes, other_placement, requests[other_index].size_bytes))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
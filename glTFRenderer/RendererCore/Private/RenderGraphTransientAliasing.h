@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+// Memory aliasing plan for transient render graph resources. A resource whose contents do not outlive
+// the frame only needs memory between its first and last use in execution order, so resources with
+// disjoint lifetimes can be placed in the same heap range. Sizes and alignments come from the caller, and
+// ValidatePlan rejects any placement where overlapping ranges also overlap in lifetime.
+namespace RenderGraphTransientAliasing
+{
+    constexpr unsigned INVALID_INDEX = 0xffffffffu;
+
+    struct ResourceUse
+    {
+        unsigned long long resource_id{0};
+        bool read{false};
+        bool write{false};
+    };
+
+    struct Lifetime
+    {
+        unsigned long long resource_id{0};
+        // Inclusive execution-order indices of the first and last pass touching the resource.
+        unsigned first_use{0};
+        unsigned last_use{0};
+        // First pass only writes the resource, so no earlier contents are observed and it may be aliased.
+        bool first_use_discards{false};
+    };
+
+    struct ResourceRequest
+    {
+        unsigned long long resource_id{0};
+        unsigned long long size_bytes{0};
+        unsigned long long alignment{1};
+        unsigned first_use{0};
+        unsigned last_use{0};
+    };
+
+    struct Heap
+    {
+        unsigned long long size_bytes{0};
+        unsigned long long alignment{1};
+    };
+
+    struct Placement
+    {
+        unsigned heap_index{INVALID_INDEX};
+        unsigned long long offset{0};
+    };
+
+    // Issued right before the pass at execution_index. before_request_index is the request whose range
+    // is being taken over, or INVALID_INDEX when several (or, at frame start, unknown) resources did.
+    struct AliasingBarrier
+    {
+        unsigned execution_index{0};
+        unsigned before_request_index{INVALID_INDEX};
+        unsigned after_request_index{INVALID_INDEX};
+    };
+
+    struct Plan
+    {
+        std::vector<Heap> heaps;
+        // Parallel to the request array.
+        std::vector<Placement> placements;
+        // Sorted by execution_index.
+        std::vector<AliasingBarrier> barriers;
+        unsigned long long requested_bytes{0};
+        unsigned long long heap_bytes{0};
+    };
+
+    // execution_steps[i] lists the resources the i-th pass in execution order accesses.
+    std::vector<Lifetime> ComputeLifetimes(const std::vector<std::vector<ResourceUse>>& execution_steps);
+
+    Plan BuildPlan(const std::vector<ResourceRequest>& requests);
+
+    // True when no two requests with overlapping lifetimes share memory and every request fits its heap.
+    bool ValidatePlan(const std::vector<ResourceRequest>& requests, const Plan& plan);
+}
@@ -304,7 +304,12 @@ bool RenderPass::InitRenderPass(ResourceManager& resource_manager)
             }
 
             parameter_variants.push_back(root_parameter_info);
-            m_shader_parameter_mapping[parameter_name].push_back(allocation);
+            const unsigned binding_id = RendererInterface::BindingName(parameter_name).GetId();
+            if (binding_id >= m_shader_parameter_mapping.size())
+            {
+                m_shader_parameter_mapping.resize(binding_id + 1);
+            }
+            m_shader_parameter_mapping[binding_id].push_back(allocation);
         }
 
         shaders[shader->GetType()] = shader;
@@ -407,37 +412,39 @@ RendererInterface::PrimitiveTopology RenderPass::GetPrimitiveTopology() const
     return m_desc.render_state.primitive_topology;
 }
 
-const RootSignatureAllocation& RenderPass::GetRootSignatureAllocation(const std::string& name) const
+const RootSignatureAllocation& RenderPass::GetRootSignatureAllocation(RendererInterface::BindingName name) const
 {
-    GLTF_CHECK(m_shader_parameter_mapping.contains(name));
-    const auto& allocations = m_shader_parameter_mapping.at(name);
-    GLTF_CHECK(!allocations.empty());
-    return allocations.front();
+    const auto* allocations = FindRootSignatureAllocations(name);
+    GLTF_CHECK(allocations);
+    return allocations->front();
 }
 
-const std::vector<RootSignatureAllocation>& RenderPass::GetRootSignatureAllocations(const std::string& name) const
+const std::vector<RootSignatureAllocation>& RenderPass::GetRootSignatureAllocations(RendererInterface::BindingName name) const
 {
-    GLTF_CHECK(m_shader_parameter_mapping.contains(name));
-    return m_shader_parameter_mapping.at(name);
+    const auto* allocations = FindRootSignatureAllocations(name);
+    GLTF_CHECK(allocations);
+    return *allocations;
 }
 
-const RootSignatureAllocation* RenderPass::FindRootSignatureAllocation(const std::string& name) const
+const RootSignatureAllocation* RenderPass::FindRootSignatureAllocation(RendererInterface::BindingName name) const
 {
-    if (!m_shader_parameter_mapping.contains(name))
-    {
-        return nullptr;
-    }
-    const auto& allocations = m_shader_parameter_mapping.at(name);
-    if (allocations.empty())
+    const auto* allocations = FindRootSignatureAllocations(name);
+    return allocations ? &allocations->front() : nullptr;
+}
+
+const std::vector<RootSignatureAllocation>* RenderPass::FindRootSignatureAllocations(RendererInterface::BindingName name) const
+{
+    if (!name.IsValid() || name.GetId() >= m_shader_parameter_mapping.size())
     {
         return nullptr;
     }
-    return &allocations.front();
+    const auto& allocations = m_shader_parameter_mapping[name.GetId()];
+    return allocations.empty() ? nullptr : &allocations;
 }
 
-bool RenderPass::HasRootSignatureAllocation(const std::string& name) const
+bool RenderPass::HasRootSignatureAllocation(RendererInterface::BindingName name) const
 {
-    return m_shader_parameter_mapping.contains(name) && !m_shader_parameter_mapping.at(name).empty();
+    return FindRootSignatureAllocations(name) != nullptr;
 }
 
 RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInterface::RenderPassDrawDesc& draw_desc) const
@@ -535,20 +542,20 @@ RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInte
     {
         if (!buffer.second.buffer_handle.IsValid())
         {
-            push_error("Buffer binding '" + buffer.first + "' has invalid handle.");
+            push_error("Buffer binding '" + buffer.first.GetString() + "' has invalid handle.");
             continue;
         }
 
         const auto* allocation = FindRootSignatureAllocation(buffer.first);
         if (allocation == nullptr)
         {
-            push_warning("Buffer binding '" + buffer.first + "' not found in root signature. Binding will be ignored.");
+            push_warning("Buffer binding '" + buffer.first.GetString() + "' not found in root signature. Binding will be ignored.");
             continue;
         }
 
         if (!IsCompatibleBufferBindingType(*allocation, buffer.second.binding_type))
         {
-            push_warning("Buffer binding '" + buffer.first + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
+            push_warning("Buffer binding '" + buffer.first.GetString() + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
         }
     }
 
@@ -556,7 +563,7 @@ RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInte
     {
         if (texture.second.textures.empty())
         {
-            push_error("Texture binding '" + texture.first + "' has empty texture list.");
+            push_error("Texture binding '" + texture.first.GetString() + "' has empty texture list.");
             continue;
         }
 
@@ -564,20 +571,25 @@ RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInte
         {
             if (!handle.IsValid())
             {
-                push_error("Texture binding '" + texture.first + "' has invalid texture handle.");
+                push_error("Texture binding '" + texture.first.GetString() + "' has invalid texture handle.");
             }
         }
 
+        if (texture.second.bindless_table && texture.second.type != RendererInterface::TextureBindingDesc::SRV)
+        {
+            push_error("Texture binding '" + texture.first.GetString() + "' binds the bindless texture table as UAV.");
+        }
+
         const auto* allocation = FindRootSignatureAllocation(texture.first);
         if (allocation == nullptr)
         {
-            push_warning("Texture binding '" + texture.first + "' not found in root signature. Binding will be ignored.");
+            push_warning("Texture binding '" + texture.first.GetString() + "' not found in root signature. Binding will be ignored.");
             continue;
         }
 
         if (!IsCompatibleTextureBindingType(*allocation, texture.second.type == RendererInterface::TextureBindingDesc::SRV))
         {
-            push_warning("Texture binding '" + texture.first + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
+            push_warning("Texture binding '" + texture.first.GetString() + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
         }
     }
 
@@ -585,7 +597,7 @@ RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInte
     {
         if (render_target_texture.second.render_target_texture.empty())
         {
-            push_error("RenderTarget texture binding '" + render_target_texture.first + "' has empty render target list.");
+            push_error("RenderTarget texture binding '" + render_target_texture.first.GetString() + "' has empty render target list.");
             continue;
         }
 
@@ -593,20 +605,20 @@ RenderPass::DrawValidationResult RenderPass::ValidateDrawDesc(const RendererInte
         {
             if (!handle.IsValid())
             {
-                push_error("RenderTarget texture binding '" + render_target_texture.first + "' has invalid render target handle.");
+                push_error("RenderTarget texture binding '" + render_target_texture.first.GetString() + "' has invalid render target handle.");
             }
         }
 
         const auto* allocation = FindRootSignatureAllocation(render_target_texture.first);
         if (allocation == nullptr)
         {
-            push_warning("RenderTarget texture binding '" + render_target_texture.first + "' not found in root signature. Binding will be ignored.");
+            push_warning("RenderTarget texture binding '" + render_target_texture.first.GetString() + "' not found in root signature. Binding will be ignored.");
             continue;
         }
 
         if (!IsCompatibleTextureBindingType(*allocation, render_target_texture.second.type == RendererInterface::RenderTargetTextureBindingDesc::SRV))
         {
-            push_warning("RenderTarget texture binding '" + render_target_texture.first + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
+            push_warning("RenderTarget texture binding '" + render_target_texture.first.GetString() + "' type mismatch with root signature type " + ToRootParameterTypeName(allocation->type) + ".");
         }
     }
 
@@ -0,0 +1,81 @@
+#include "RendererBindingName.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+    class BindingNameTable
+    {
+    public:
+        static BindingNameTable& Instance()
+        {
+            static BindingNameTable table;
+            return table;
+        }
+
+        unsigned Intern(const std::string& name)
+        {
+            {
+                std::shared_lock lock(m_mutex);
+                const auto it = m_ids.find(name);
+                if (it != m_ids.end())
+                {
+                    return it->second;
+                }
+            }
+
+            std::unique_lock lock(m_mutex);
+            const auto [it, inserted] = m_ids.try_emplace(name, static_cast<unsigned>(m_names.size()));
+            if (inserted)
+            {
+                m_names.push_back(name);
+            }
+            return it->second;
+        }
+
+        // Deque elements never move, so the reference outlives the lock.
+        const std::string& GetName(unsigned id)
+        {
+            std::shared_lock lock(m_mutex);
+            return id < m_names.size() ? m_names[id] : m_empty_name;
+        }
+
+        unsigned GetCount()
+        {
+            std::shared_lock lock(m_mutex);
+            return static_cast<unsigned>(m_names.size());
+        }
+
+    private:
+        std::shared_mutex m_mutex;
+        std::unordered_map<std::string, unsigned> m_ids;
+        std::deque<std::string> m_names;
+        const std::string m_empty_name;
+    };
+}
+
+namespace RendererInterface
+{
+    BindingName::BindingName(const std::string& name)
+        : m_id(BindingNameTable::Instance().Intern(name))
+    {
+    }
+
+    BindingName::BindingName(const char* name)
+        : BindingName(std::string(name ? name : ""))
+    {
+    }
+
+    const std::string& BindingName::GetString() const
+    {
+        return BindingNameTable::Instance().GetName(m_id);
+    }
+
+    unsigned BindingName::GetInternedCount()
+    {
+        return BindingNameTable::Instance().GetCount();
+    }
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace RendererInterface
+{
+    // Generational slot map from a typed Handle to a shared object. The handle value packs a slot index with the
+    // slot's generation, which is bumped on removal, so a handle kept past its Remove resolves to nullptr instead
+    // of whatever object reuses the slot. Freed slots are reused oldest first, so a hot Register/Remove cycle walks
+    // through every free slot before it comes back to one, and a slot whose generation runs out is retired for
+    // good instead of wrapping, so a generation is never handed out twice for the same index. Slots live in
+    // fixed-size pages that never move once published, which lets Get run without locks from any thread. Register
+    // and Remove lock one of SHARD_COUNT shards, each owning the slot indices congruent to it, so registering from
+    // several threads rarely contends.
+    template <typename HandleType, typename T>
+    class HandleSlotMap
+    {
+    public:
+        static constexpr unsigned INDEX_BITS = 20;
+        static constexpr unsigned GENERATION_BITS = 32 - INDEX_BITS;
+        static constexpr unsigned INDEX_MASK = (1u << INDEX_BITS) - 1u;
+        static constexpr unsigned GENERATION_MASK = (1u << GENERATION_BITS) - 1u;
+        // The all-ones index is never handed out, which keeps every packed value distinct from the invalid handle.
+        static constexpr unsigned MAX_SLOT_COUNT = INDEX_MASK;
+        static constexpr unsigned SHARD_COUNT = 8;
+        static constexpr unsigned PAGE_SLOT_COUNT = 1024;
+        static constexpr unsigned PAGE_COUNT = (MAX_SLOT_COUNT + PAGE_SLOT_COUNT - 1) / PAGE_SLOT_COUNT;
+
+        HandleSlotMap() = default;
+        HandleSlotMap(const HandleSlotMap&) = delete;
+        HandleSlotMap& operator=(const HandleSlotMap&) = delete;
+
+        ~HandleSlotMap()
+        {
+            for (auto& page : m_pages)
+            {
+                delete page.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Returns an invalid handle once the registering thread's shard has no slot index left.
+        HandleType Register(std::shared_ptr<T> value)
+        {
+            const unsigned shard_index = static_cast<unsigned>(std::hash<std::thread::id>{}(std::this_thread::get_id()) % SHARD_COUNT);
+            auto& shard = m_shards[shard_index];
+            std::lock_guard lock(shard.mutex);
+
+            unsigned index = 0;
+            if (!shard.free_indices.empty())
+            {
+                index = shard.free_indices.front();
+                shard.free_indices.pop_front();
+            }
+            else
+            {
+                index = shard.next_local_index * SHARD_COUNT + shard_index;
+                if (index >= MAX_SLOT_COUNT)
+                {
+                    return HandleType();
+                }
+                ++shard.next_local_index;
+            }
+
+            Slot& slot = AcquireSlot(index);
+            unsigned generation = slot.generation.load(std::memory_order_relaxed);
+            if (generation == 0)
+            {
+                // First use of the slot; zero marks a slot that was never handed out.
+                generation = 1;
+                slot.generation.store(generation, std::memory_order_relaxed);
+            }
+            slot.value.store(std::move(value), std::memory_order_release);
+            slot.live.store(true, std::memory_order_release);
+            return HandleType(Pack(index, generation));
+        }
+
+        std::shared_ptr<T> Get(HandleType handle) const
+        {
+            const Slot* slot = FindLiveSlot(handle);
+            if (!slot)
+            {
+                return nullptr;
+            }
+
+            auto value = slot->value.load(std::memory_order_acquire);
+            // A Remove racing with the load may have handed back the object it just detached; report it as gone.
+            return FindLiveSlot(handle) ? value : nullptr;
+        }
+
+        bool Contains(HandleType handle) const
+        {
+            return FindLiveSlot(handle) != nullptr;
+        }
+
+        bool Update(HandleType handle, std::shared_ptr<T> value)
+        {
+            if (!handle.IsValid())
+            {
+                return false;
+            }
+
+            auto& shard = m_shards[UnpackIndex(handle.value) % SHARD_COUNT];
+            std::lock_guard lock(shard.mutex);
+            Slot* slot = FindLiveSlot(handle);
+            if (!slot)
+            {
+                return false;
+            }
+            slot->value.store(std::move(value), std::memory_order_release);
+            return true;
+        }
+
+        std::shared_ptr<T> Remove(HandleType handle)
+        {
+            if (!handle.IsValid())
+            {
+                return nullptr;
+            }
+
+            const unsigned index = UnpackIndex(handle.value);
+            auto& shard = m_shards[index % SHARD_COUNT];
+            std::lock_guard lock(shard.mutex);
+            Slot* slot = FindLiveSlot(handle);
+            if (!slot)
+            {
+                return nullptr;
+            }
+
+            if (RetireSlot(*slot))
+            {
+                shard.free_indices.push_back(index);
+            }
+            return slot->value.exchange(nullptr, std::memory_order_acq_rel);
+        }
+
+        // Removes every entry. Outstanding handles become stale; the pages stay so concurrent readers stay valid.
+        void Clear()
+        {
+            for (unsigned shard_index = 0; shard_index < SHARD_COUNT; ++shard_index)
+            {
+                auto& shard = m_shards[shard_index];
+                std::lock_guard lock(shard.mutex);
+                for (unsigned local_index = 0; local_index < shard.next_local_index; ++local_index)
+                {
+                    const unsigned index = local_index * SHARD_COUNT + shard_index;
+                    Slot& slot = GetPublishedSlot(index);
+                    if (!slot.live.load(std::memory_order_relaxed))
+                    {
+                        continue;
+                    }
+                    if (RetireSlot(slot))
+                    {
+                        shard.free_indices.push_back(index);
+                    }
+                    slot.value.store(nullptr, std::memory_order_release);
+                }
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<unsigned> generation{0};
+            std::atomic<bool> live{false};
+            std::atomic<std::shared_ptr<T>> value;
+        };
+
+        struct Page
+        {
+            std::array<Slot, PAGE_SLOT_COUNT> slots;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            // Oldest free slot first.
+            std::deque<unsigned> free_indices;
+            unsigned next_local_index{0};
+        };
+
+        static unsigned Pack(unsigned index, unsigned generation) { return (generation << INDEX_BITS) | index; }
+        static unsigned UnpackIndex(unsigned value) { return value & INDEX_MASK; }
+        static unsigned UnpackGeneration(unsigned value) { return value >> INDEX_BITS; }
+
+        // False once the slot has used its last generation; it then stays dead and must not be reused.
+        static bool RetireSlot(Slot& slot)
+        {
+            slot.live.store(false, std::memory_order_release);
+            const unsigned generation = slot.generation.load(std::memory_order_relaxed);
+            if (generation == GENERATION_MASK)
+            {
+                return false;
+            }
+            slot.generation.store(generation + 1, std::memory_order_release);
+            return true;
+        }
+
+        Slot* FindLiveSlot(HandleType handle) const
+        {
+            if (!handle.IsValid())
+            {
+                return nullptr;
+            }
+
+            const unsigned index = UnpackIndex(handle.value);
+            Page* page = index < MAX_SLOT_COUNT ? m_pages[index / PAGE_SLOT_COUNT].load(std::memory_order_acquire) : nullptr;
+            if (!page)
+            {
+                return nullptr;
+            }
+
+            Slot& slot = page->slots[index % PAGE_SLOT_COUNT];
+            if (slot.generation.load(std::memory_order_acquire) != UnpackGeneration(handle.value) ||
+                !slot.live.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+            return &slot;
+        }
+
+        Slot& GetPublishedSlot(unsigned index)
+        {
+            Page* page = m_pages[index / PAGE_SLOT_COUNT].load(std::memory_order_acquire);
+            assert(page);
+            return page->slots[index % PAGE_SLOT_COUNT];
+        }
+
+        // Shards publish pages concurrently; the loser of the race frees its copy.
+        Slot& AcquireSlot(unsigned index)
+        {
+            auto& page_pointer = m_pages[index / PAGE_SLOT_COUNT];
+            Page* page = page_pointer.load(std::memory_order_acquire);
+            if (!page)
+            {
+                Page* new_page = new Page();
+                if (page_pointer.compare_exchange_strong(page, new_page, std::memory_order_acq_rel))
+                {
+                    page = new_page;
+                }
+                else
+                {
+                    delete new_page;
+                }
+            }
+            return page->slots[index % PAGE_SLOT_COUNT];
+        }
+
+        std::array<std::atomic<Page*>, PAGE_COUNT> m_pages{};
+        std::array<Shard, SHARD_COUNT> m_shards;
+    };
+}
@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iterator>
+#include <unordered_map>
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
@@ -16,7 +17,14 @@
 #include "InternalResourceHandleTable.h"
 #include "RendererSceneCommon.h"
 #include "RenderPass.h"
+#include "RenderGraphAttachmentOps.h"
+#include "RenderGraphBarrierPlanner.h"
+#include "RenderGraphBindingState.h"
 #include "RenderGraphExecutionPolicy.h"
+#include "RenderGraphParallelRecording.h"
+#include "RenderGraphQueueScheduler.h"
+#include "RenderGraphTraceExport.h"
+#include "RenderGraphTransientAliasing.h"
 #include "ResourceManager.h"
 #include "RHIConfigSingleton.h"
 #include "RHIResourceFactoryImpl.hpp"
@@ -40,6 +48,7 @@
 #endif
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_glfw.h>
+#include <nlohmann_json/single_include/nlohmann/json.hpp>
 
 namespace RendererInterface
 {
@@ -59,6 +68,20 @@ namespace RendererInterface
         std::vector<FrameSlot> frame_slots{};
     };
 
+    struct RenderGraph::FrameTraceState
+    {
+        std::string path;
+        unsigned requested_frame_count{0};
+        unsigned long long first_frame_index{0};
+        // Captured frames whose passes reached the trace, with or without GPU timings.
+        unsigned resolved_frame_count{0};
+        bool capturing{false};
+        std::string last_path;
+        bool last_write_succeeded{false};
+        RenderGraphTraceExport::Trace trace{};
+        int ui_frame_count{120};
+    };
+
     struct RenderGraph::RenderDocCaptureState
     {
         struct PendingCapture
@@ -121,6 +144,82 @@ namespace RendererInterface
         CompletedCapture last_result{};
     };
 
+    struct RenderGraph::ParallelRecordingState
+    {
+        std::unique_ptr<RenderGraphParallelRecording::WorkerPool> worker_pool;
+    };
+
+    struct RenderGraph::AsyncComputeState
+    {
+        // Parallel to the live execution order.
+        RenderGraphQueueScheduler::Schedule schedule;
+        // Signaled by the last compute submission of the frame; the next graphics submission waits on it.
+        IRHISemaphore* pending_graphics_wait{nullptr};
+    };
+
+    struct RenderGraph::RenderPassMergeState
+    {
+        // Parallel to the live execution order.
+        RenderGraphAttachmentOps::Plan plan;
+    };
+
+    struct RenderGraph::DrawValidationCache
+    {
+        // Configurations kept by ONCE_PER_CONFIGURATION before the table starts over.
+        static constexpr std::size_t MAX_CONFIGURATION_COUNT = 4096;
+
+        struct NodeEntry
+        {
+            std::size_t key{0};
+            std::shared_ptr<const RenderPass::DrawValidationResult> result;
+        };
+
+        std::map<RenderGraphNodeHandle, NodeEntry> node_entries;
+        std::unordered_map<std::size_t, std::shared_ptr<const RenderPass::DrawValidationResult>> configuration_results;
+        unsigned frame_validation_count{0};
+        unsigned frame_cache_hit_count{0};
+
+        void Clear()
+        {
+            node_entries.clear();
+            configuration_results.clear();
+        }
+    };
+
+    struct RenderGraph::PreparedRenderGraphNode
+    {
+        struct ResourceState
+        {
+            IRHITexture* texture{nullptr};
+            IRHIBuffer* buffer{nullptr};
+            RHIResourceStateType state{};
+        };
+
+        struct DescriptorBinding
+        {
+            // Transitioned right before the descriptor is bound.
+            std::vector<ResourceState> resource_states;
+            const std::vector<RootSignatureAllocation>* root_signature_allocations{nullptr};
+            std::shared_ptr<IRHIDescriptorAllocation> descriptor;
+            std::shared_ptr<IRHIDescriptorTable> descriptor_table;
+            RHIDescriptorRangeType descriptor_table_range_type{RHIDescriptorRangeType::SRV};
+        };
+
+        RenderGraphNodeHandle node_handle{};
+        std::shared_ptr<RenderPass> render_pass;
+        RHIPipelineType pipeline_type{RHIPipelineType::Unknown};
+        RHIViewportDesc viewport{};
+        RHIScissorRectDesc scissor_rect{};
+        RHIBeginRenderingInfo begin_rendering_info{};
+        std::vector<DescriptorBinding> descriptor_bindings;
+        // States BeginRendering moves the attachments into.
+        std::vector<ResourceState> attachment_states;
+        // Set for passes merged with their neighbours: the pass records inside the scope an earlier pass left
+        // open, and leaves its own scope open for the next one.
+        bool continues_rendering_scope{false};
+        bool keeps_rendering_scope_open{false};
+    };
+
     namespace
     {
         bool g_renderdoc_runtime_loaded_by_app = false;
@@ -408,18 +507,34 @@ namespace RendererInterface
                 }
                 return value < other.value;
             }
+
+            bool operator==(const ResourceKey& other) const
+            {
+                return kind == other.kind && value == other.value;
+            }
         };
 
+        // Sorted and duplicate-free.
         struct ResourceAccessSet
         {
-            std::set<ResourceKey> reads;
-            std::set<ResourceKey> writes;
+            std::vector<ResourceKey> reads;
+            std::vector<ResourceKey> writes;
+        };
+
+        struct ResourceAccessEntry
+        {
+            ResourceKey resource;
+            RenderGraphNodeHandle node;
+            bool write{false};
         };
 
         constexpr unsigned char RESOURCE_ACCESS_MASK_READ = 1u << 0;
         constexpr unsigned char RESOURCE_ACCESS_MASK_WRITE = 1u << 1;
         constexpr std::size_t MAX_CROSS_FRAME_HAZARDS_RECORDED = 128u;
         constexpr std::size_t MAX_CROSS_FRAME_PASS_NAMES_RECORDED = 8u;
+        // D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, assumed for snapshots that predate placement_alignment.
+        constexpr unsigned long long TRANSIENT_RESOURCE_PLACEMENT_ALIGNMENT = 64ull * 1024ull;
+        constexpr unsigned EXECUTION_PLANNING_SNAPSHOT_VERSION = 3u;
 
         using ResourceAccessMaskMap = std::map<unsigned long long, unsigned char>;
         using ResourcePassAccessMap = std::map<unsigned long long, std::pair<std::vector<std::string>, std::vector<std::string>>>;
@@ -431,6 +546,40 @@ namespace RendererInterface
             return std::chrono::duration<float, std::milli>(end - begin).count();
         }
 
+        // Absolute time for frame traces; GPU timestamps are calibrated against the same clock.
+        inline double ToTimelineMilliseconds(const std::chrono::steady_clock::time_point& time_point)
+        {
+            return std::chrono::duration<double, std::milli>(time_point.time_since_epoch()).count();
+        }
+
+        std::vector<std::pair<double, double>> MapTimestampsToTimeline(
+            const std::vector<std::pair<uint64_t, uint64_t>>& pass_ticks,
+            double ticks_per_second,
+            uint64_t reference_tick,
+            double reference_ms)
+        {
+            std::vector<std::pair<double, double>> spans_ms(pass_ticks.size(), {0.0, 0.0});
+            for (size_t pass_index = 0; pass_index < pass_ticks.size(); ++pass_index)
+            {
+                const auto [begin_tick, end_tick] = pass_ticks[pass_index];
+                if (end_tick <= begin_tick)
+                {
+                    continue;
+                }
+                const auto to_ms = [&](uint64_t tick)
+                {
+                    return reference_ms + (static_cast<double>(tick) - static_cast<double>(reference_tick)) * 1000.0 / ticks_per_second;
+                };
+                spans_ms[pass_index] = {to_ms(begin_tick), to_ms(end_tick)};
+            }
+            return spans_ms;
+        }
+
+        RenderGraphTraceExport::Track MakeRenderThreadTraceTrack()
+        {
+            return {1, 1, "CPU", "Render thread"};
+        }
+
         struct FrameResourceAccessDiagnosticsData
         {
             ResourceAccessMaskMap access_masks;
@@ -545,7 +694,38 @@ namespace RendererInterface
             return (std::max)(2u, frame_context.frame_slot_count);
         }
 
-        using DependencyEdgeMap = std::map<RenderGraphNodeHandle, std::set<RenderGraphNodeHandle>>;
+        // Flat (from, to) edge list. Normalize() sorts and deduplicates it, after which the edges leaving
+        // a node form one contiguous range.
+        struct DependencyEdgeList
+        {
+            using Edge = std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>;
+            using ConstIterator = std::vector<Edge>::const_iterator;
+
+            std::vector<Edge> edges;
+
+            void Add(RenderGraphNodeHandle from, RenderGraphNodeHandle to)
+            {
+                edges.emplace_back(from, to);
+            }
+
+            void Normalize()
+            {
+                std::sort(edges.begin(), edges.end());
+                edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+            }
+
+            std::pair<ConstIterator, ConstIterator> EdgesFrom(RenderGraphNodeHandle from) const
+            {
+                const auto begin = std::lower_bound(edges.begin(), edges.end(), from,
+                    [](const Edge& edge, RenderGraphNodeHandle handle) { return edge.first < handle; });
+                auto end = begin;
+                while (end != edges.end() && end->first == from)
+                {
+                    ++end;
+                }
+                return {begin, end};
+            }
+        };
         using DependencyEdgeResourceMap = std::map<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>, std::vector<ResourceKey>>;
 
         unsigned long long ResolveRenderTargetResourceIdentity(RenderTargetHandle handle)
@@ -589,7 +769,7 @@ namespace RendererInterface
             pass_names.push_back(pass_name);
         }
 
-        ResourceAccessSet CollectResourceAccess(const RenderGraphNodeDesc& desc)
+        ResourceAccessSet CollectResourceAccess(const RenderGraphNodeDesc& desc, bool include_attachments = true)
         {
             ResourceAccessSet access;
 
@@ -602,11 +782,11 @@ namespace RendererInterface
                 {
                 case BufferBindingDesc::CBV:
                 case BufferBindingDesc::SRV:
-                    access.reads.insert(key);
+                    access.reads.push_back(key);
                     break;
                 case BufferBindingDesc::UAV:
-                    access.reads.insert(key);
-                    access.writes.insert(key);
+                    access.reads.push_back(key);
+                    access.writes.push_back(key);
                     break;
                 }
             }
@@ -619,12 +799,12 @@ namespace RendererInterface
                     ResourceKey key{ResourceKind::Texture, static_cast<unsigned long long>(texture_handle.value)};
                     if (binding.type == TextureBindingDesc::SRV)
                     {
-                        access.reads.insert(key);
+                        access.reads.push_back(key);
                     }
                     else
                     {
-                        access.reads.insert(key);
-                        access.writes.insert(key);
+                        access.reads.push_back(key);
+                        access.writes.push_back(key);
                     }
                 }
             }
@@ -637,27 +817,37 @@ namespace RendererInterface
                     ResourceKey key{ResourceKind::RenderTarget, static_cast<unsigned long long>(render_target_handle.value)};
                     if (binding.type == RenderTargetTextureBindingDesc::SRV)
                     {
-                        access.reads.insert(key);
+                        access.reads.push_back(key);
                     }
                     else
                     {
-                        access.reads.insert(key);
-                        access.writes.insert(key);
+                        access.reads.push_back(key);
+                        access.writes.push_back(key);
                     }
                 }
             }
 
-            for (const auto& render_target_pair : desc.draw_info.render_target_resources)
+            if (include_attachments)
             {
-                const auto& binding = render_target_pair.second;
-                ResourceKey key{ResourceKind::RenderTarget, static_cast<unsigned long long>(render_target_pair.first.value)};
-                access.writes.insert(key);
-                if (binding.load_op == RenderPassAttachmentLoadOp::LOAD)
+                for (const auto& render_target_pair : desc.draw_info.render_target_resources)
                 {
-                    access.reads.insert(key);
+                    const auto& binding = render_target_pair.second;
+                    ResourceKey key{ResourceKind::RenderTarget, static_cast<unsigned long long>(render_target_pair.first.value)};
+                    access.writes.push_back(key);
+                    if (binding.load_op == RenderPassAttachmentLoadOp::LOAD)
+                    {
+                        access.reads.push_back(key);
+                    }
                 }
             }
 
+            const auto normalize = [](std::vector<ResourceKey>& resources)
+            {
+                std::sort(resources.begin(), resources.end());
+                resources.erase(std::unique(resources.begin(), resources.end()), resources.end());
+            };
+            normalize(access.reads);
+            normalize(access.writes);
             return access;
         }
 
@@ -757,14 +947,13 @@ namespace RendererInterface
             return diagnostics_data;
         }
 
-        void CollectResourceReadersAndWriters(
+        // Sorted by resource, then node, so the accesses to one resource form a contiguous range.
+        void CollectResourceAccessEntries(
             const std::vector<RenderGraphNodeHandle>& nodes,
             const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
-            std::map<ResourceKey, std::set<RenderGraphNodeHandle>>& out_readers,
-            std::map<ResourceKey, std::set<RenderGraphNodeHandle>>& out_writers)
+            std::vector<ResourceAccessEntry>& out_entries)
         {
-            out_readers.clear();
-            out_writers.clear();
+            out_entries.clear();
 
             for (auto handle : nodes)
             {
@@ -772,37 +961,54 @@ namespace RendererInterface
                 const auto access = CollectResourceAccess(node_desc);
                 for (const auto& resource : access.reads)
                 {
-                    out_readers[resource].insert(handle);
+                    out_entries.push_back({resource, handle, false});
                 }
                 for (const auto& resource : access.writes)
                 {
-                    out_writers[resource].insert(handle);
+                    out_entries.push_back({resource, handle, true});
                 }
             }
+
+            std::sort(out_entries.begin(), out_entries.end(), [](const ResourceAccessEntry& lhs, const ResourceAccessEntry& rhs)
+            {
+                if (!(lhs.resource == rhs.resource))
+                {
+                    return lhs.resource < rhs.resource;
+                }
+                if (lhs.node != rhs.node)
+                {
+                    return lhs.node < rhs.node;
+                }
+                return lhs.write < rhs.write;
+            });
         }
 
         void BuildResourceInferredEdges(
-            const std::map<ResourceKey, std::set<RenderGraphNodeHandle>>& resource_readers,
-            const std::map<ResourceKey, std::set<RenderGraphNodeHandle>>& resource_writers,
-            DependencyEdgeMap& out_edges,
+            const std::vector<ResourceAccessEntry>& resource_accesses,
+            DependencyEdgeList& out_edges,
             DependencyEdgeResourceMap* out_edge_resources = nullptr)
         {
-            out_edges.clear();
+            out_edges.edges.clear();
             if (out_edge_resources)
             {
                 out_edge_resources->clear();
             }
 
-            for (const auto& writer_pair : resource_writers)
+            std::vector<RenderGraphNodeHandle> readers;
+            std::vector<RenderGraphNodeHandle> writers;
+            std::size_t range_begin = 0;
+            while (range_begin < resource_accesses.size())
             {
-                const auto& resource = writer_pair.first;
-                const auto& writers = writer_pair.second;
-                auto readers_it = resource_readers.find(resource);
-                if (readers_it == resource_readers.end())
+                const auto& resource = resource_accesses[range_begin].resource;
+                std::size_t range_end = range_begin;
+                readers.clear();
+                writers.clear();
+                while (range_end < resource_accesses.size() && resource_accesses[range_end].resource == resource)
                 {
-                    continue;
+                    const auto& entry = resource_accesses[range_end];
+                    (entry.write ? writers : readers).push_back(entry.node);
+                    ++range_end;
                 }
-                const auto& readers = readers_it->second;
 
                 for (const auto writer : writers)
                 {
@@ -813,20 +1019,23 @@ namespace RendererInterface
                             continue;
                         }
 
-                        out_edges[writer].insert(reader);
+                        out_edges.Add(writer, reader);
                         if (out_edge_resources)
                         {
                             (*out_edge_resources)[{writer, reader}].push_back(resource);
                         }
                     }
                 }
+                range_begin = range_end;
             }
+
+            out_edges.Normalize();
         }
 
         std::size_t ComputeExecutionSignature(
             const std::vector<RenderGraphNodeHandle>& nodes,
             const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
-            const DependencyEdgeMap& edges)
+            const DependencyEdgeList& edges)
         {
             std::size_t signature = 1469598103934665603ULL;
             for (auto handle : nodes)
@@ -856,22 +1065,164 @@ namespace RendererInterface
                 }
 
                 HashCombine(signature, 0xD44u);
-                auto edges_it = edges.find(handle);
-                if (edges_it != edges.end())
+                const auto [edges_begin, edges_end] = edges.EdgesFrom(handle);
+                for (auto edge_it = edges_begin; edge_it != edges_end; ++edge_it)
+                {
+                    HashCombine(signature, edge_it->second.value);
+                }
+            }
+
+            return signature;
+        }
+
+        // Key of everything the cached plan derives from the node descs: bound handles with their binding
+        // names and types (the latter pick barrier states), attachments with their ops, viewport rects,
+        // explicit dependencies, render pass and queue affinity. Cheap enough to compute on every plan
+        // request, unlike the plan itself.
+        std::size_t ComputePlanningSignature(
+            const std::vector<RenderGraphNodeHandle>& nodes,
+            const std::vector<RenderGraphNodeDesc>& render_graph_nodes)
+        {
+            std::size_t signature = 1469598103934665603ULL;
+            HashCombine(signature, nodes.size());
+            for (const auto handle : nodes)
+            {
+                HashCombine(signature, handle.value);
+                const auto& node_desc = render_graph_nodes[handle.value];
+                HashCombine(signature, node_desc.render_pass_handle.value);
+                HashCombine(signature, static_cast<std::size_t>(node_desc.queue_affinity));
+
+                const auto& draw_info = node_desc.draw_info;
+                HashCombine(signature, 0xA11u);
+                for (const auto& buffer_pair : draw_info.buffer_resources)
+                {
+                    HashCombine(signature, buffer_pair.first.GetId());
+                    HashCombine(signature, buffer_pair.second.buffer_handle.value);
+                    HashCombine(signature, static_cast<std::size_t>(buffer_pair.second.binding_type));
+                }
+
+                HashCombine(signature, 0xB22u);
+                for (const auto& texture_pair : draw_info.texture_resources)
+                {
+                    HashCombine(signature, texture_pair.first.GetId());
+                    HashCombine(signature, static_cast<std::size_t>(texture_pair.second.type));
+                    for (const auto texture_handle : texture_pair.second.textures)
+                    {
+                        HashCombine(signature, texture_handle.value);
+                    }
+                }
+
+                HashCombine(signature, 0xC33u);
+                for (const auto& render_target_pair : draw_info.render_target_texture_resources)
                 {
-                    for (const auto to : edges_it->second)
+                    HashCombine(signature, render_target_pair.first.GetId());
+                    HashCombine(signature, static_cast<std::size_t>(render_target_pair.second.type));
+                    for (const auto render_target_handle : render_target_pair.second.render_target_texture)
                     {
-                        HashCombine(signature, to.value);
+                        HashCombine(signature, render_target_handle.value);
                     }
                 }
+
+                HashCombine(signature, 0xD44u);
+                for (const auto& render_target_pair : draw_info.render_target_resources)
+                {
+                    HashCombine(signature, render_target_pair.first.value);
+                    HashCombine(signature, static_cast<std::size_t>(render_target_pair.second.usage));
+                    HashCombine(signature, static_cast<std::size_t>(render_target_pair.second.load_op));
+                    HashCombine(signature, static_cast<std::size_t>(render_target_pair.second.store_op));
+                    HashCombine(signature, render_target_pair.second.need_clear ? 1u : 0u);
+                }
+                HashCombine(signature, static_cast<std::size_t>(node_desc.viewport_rect.offset_x));
+                HashCombine(signature, static_cast<std::size_t>(node_desc.viewport_rect.offset_y));
+                HashCombine(signature, static_cast<std::size_t>(node_desc.viewport_rect.width));
+                HashCombine(signature, static_cast<std::size_t>(node_desc.viewport_rect.height));
+
+                HashCombine(signature, 0xE55u);
+                for (const auto dep : node_desc.dependency_render_graph_nodes)
+                {
+                    HashCombine(signature, dep.value);
+                }
             }
 
             return signature;
         }
 
+        // Everything RenderPass::ValidateDrawDesc looks at: the render pass, command types, attachment handles
+        // and usages, and binding names, types, handles and bindless table flags. Checked headless by
+        // RenderGraph::VerifyDrawValidationKeyCoverage.
+        std::size_t ComputeDrawValidationKey(const RenderGraphNodeDesc& node_desc, const void* render_pass)
+        {
+            std::size_t key = 1469598103934665603ULL;
+            HashCombine(key, reinterpret_cast<std::uintptr_t>(render_pass));
+            HashCombine(key, node_desc.render_pass_handle.value);
+
+            const auto& draw_info = node_desc.draw_info;
+            HashCombine(key, draw_info.execute_commands.size());
+            for (const auto& command : draw_info.execute_commands)
+            {
+                HashCombine(key, static_cast<std::size_t>(command.type));
+            }
+
+            HashCombine(key, 0xA11u);
+            for (const auto& render_target_pair : draw_info.render_target_resources)
+            {
+                HashCombine(key, render_target_pair.first.value);
+                HashCombine(key, static_cast<std::size_t>(render_target_pair.second.usage));
+            }
+
+            HashCombine(key, 0xB22u);
+            for (const auto& buffer_pair : draw_info.buffer_resources)
+            {
+                HashCombine(key, buffer_pair.first.GetId());
+                HashCombine(key, buffer_pair.second.buffer_handle.value);
+                HashCombine(key, static_cast<std::size_t>(buffer_pair.second.binding_type));
+            }
+
+            HashCombine(key, 0xC33u);
+            for (const auto& texture_pair : draw_info.texture_resources)
+            {
+                HashCombine(key, texture_pair.first.GetId());
+                HashCombine(key, static_cast<std::size_t>(texture_pair.second.type));
+                HashCombine(key, texture_pair.second.bindless_table ? 1u : 0u);
+                HashCombine(key, texture_pair.second.textures.size());
+                for (const auto texture_handle : texture_pair.second.textures)
+                {
+                    HashCombine(key, texture_handle.value);
+                }
+            }
+
+            HashCombine(key, 0xD44u);
+            for (const auto& render_target_pair : draw_info.render_target_texture_resources)
+            {
+                HashCombine(key, render_target_pair.first.GetId());
+                HashCombine(key, static_cast<std::size_t>(render_target_pair.second.type));
+                HashCombine(key, render_target_pair.second.render_target_texture.size());
+                for (const auto render_target_handle : render_target_pair.second.render_target_texture)
+                {
+                    HashCombine(key, render_target_handle.value);
+                }
+            }
+
+            return key;
+        }
+
+        unsigned ComputeNodeIndexBound(const std::vector<RenderGraphNodeHandle>& nodes, const DependencyEdgeList& edges)
+        {
+            unsigned bound = 0;
+            for (const auto handle : nodes)
+            {
+                bound = (std::max)(bound, handle.value + 1);
+            }
+            for (const auto& edge : edges.edges)
+            {
+                bound = (std::max)(bound, (std::max)(edge.first.value, edge.second.value) + 1);
+            }
+            return bound;
+        }
+
         bool TopologicalSortExecutionNodes(
             const std::vector<RenderGraphNodeHandle>& nodes,
-            const DependencyEdgeMap& edges,
+            const DependencyEdgeList& edges,
             std::vector<RenderGraphNodeHandle>& out_execution_nodes,
             std::vector<RenderGraphNodeHandle>* out_cycle_nodes = nullptr)
         {
@@ -881,58 +1232,59 @@ namespace RendererInterface
                 out_cycle_nodes->clear();
             }
 
-            std::map<RenderGraphNodeHandle, unsigned> indegree;
+            // Indexed by handle value; edges to handles outside nodes are ignored.
+            constexpr unsigned not_in_graph = (std::numeric_limits<unsigned>::max)();
+            std::vector<unsigned> indegree(ComputeNodeIndexBound(nodes, edges), not_in_graph);
             for (auto handle : nodes)
             {
-                indegree[handle] = 0;
+                indegree[handle.value] = 0;
             }
-            for (const auto& edge_pair : edges)
+            for (const auto& edge : edges.edges)
             {
-                for (const auto& to : edge_pair.second)
+                auto& count = indegree[edge.second.value];
+                if (count != not_in_graph)
                 {
-                    auto indegree_it = indegree.find(to);
-                    if (indegree_it != indegree.end())
-                    {
-                        ++indegree_it->second;
-                    }
+                    ++count;
                 }
             }
 
-            std::set<RenderGraphNodeHandle> ready;
-            for (const auto& count : indegree)
+            // Min-heap keeps the order deterministic: the lowest ready handle goes first.
+            std::vector<RenderGraphNodeHandle> ready;
+            const auto ready_compare = [](RenderGraphNodeHandle lhs, RenderGraphNodeHandle rhs) { return rhs < lhs; };
+            for (auto handle : nodes)
             {
-                if (count.second == 0)
+                if (indegree[handle.value] == 0)
                 {
-                    ready.insert(count.first);
+                    ready.push_back(handle);
                 }
             }
+            std::make_heap(ready.begin(), ready.end(), ready_compare);
 
+            out_execution_nodes.reserve(nodes.size());
             while (!ready.empty())
             {
-                const auto node = *ready.begin();
-                ready.erase(ready.begin());
+                std::pop_heap(ready.begin(), ready.end(), ready_compare);
+                const auto node = ready.back();
+                ready.pop_back();
                 out_execution_nodes.push_back(node);
 
-                auto edges_it = edges.find(node);
-                if (edges_it == edges.end())
-                {
-                    continue;
-                }
-                for (const auto& to : edges_it->second)
+                const auto [edges_begin, edges_end] = edges.EdgesFrom(node);
+                for (auto edge_it = edges_begin; edge_it != edges_end; ++edge_it)
                 {
-                    auto indegree_it = indegree.find(to);
-                    if (indegree_it == indegree.end())
+                    const auto to = edge_it->second;
+                    auto& count = indegree[to.value];
+                    if (count == not_in_graph)
                     {
                         continue;
                     }
 
-                    auto& count = indegree_it->second;
                     if (count > 0)
                     {
                         --count;
                         if (count == 0)
                         {
-                            ready.insert(to);
+                            ready.push_back(to);
+                            std::push_heap(ready.begin(), ready.end(), ready_compare);
                         }
                     }
                 }
@@ -941,11 +1293,13 @@ namespace RendererInterface
             const bool sorted = out_execution_nodes.size() == nodes.size();
             if (!sorted && out_cycle_nodes)
             {
-                for (const auto& count : indegree)
+                std::vector<RenderGraphNodeHandle> sorted_nodes = nodes;
+                std::sort(sorted_nodes.begin(), sorted_nodes.end());
+                for (const auto handle : sorted_nodes)
                 {
-                    if (count.second > 0)
+                    if (indegree[handle.value] != not_in_graph && indegree[handle.value] > 0)
                     {
-                        out_cycle_nodes->push_back(count.first);
+                        out_cycle_nodes->push_back(handle);
                     }
                 }
             }
@@ -954,7 +1308,7 @@ namespace RendererInterface
 
         bool ValidateExecutionOrder(
             const std::vector<RenderGraphNodeHandle>& nodes,
-            const DependencyEdgeMap& edges,
+            const DependencyEdgeList& edges,
             const std::vector<RenderGraphNodeHandle>& execution_order)
         {
             if (execution_order.size() != nodes.size())
@@ -962,3247 +1316,6118 @@ namespace RendererInterface
                 return false;
             }
 
-            std::set<RenderGraphNodeHandle> node_set(nodes.begin(), nodes.end());
-            std::map<RenderGraphNodeHandle, std::size_t> order_index;
+            constexpr std::size_t not_in_graph = (std::numeric_limits<std::size_t>::max)();
+            constexpr std::size_t not_ordered = not_in_graph - 1;
+            const unsigned index_bound = ComputeNodeIndexBound(nodes, edges);
+            std::vector<std::size_t> order_index(index_bound, not_in_graph);
+            for (const auto node : nodes)
+            {
+                order_index[node.value] = not_ordered;
+            }
+
             for (std::size_t index = 0; index < execution_order.size(); ++index)
             {
                 const auto node = execution_order[index];
-                if (!node.IsValid() || !node_set.contains(node) || order_index.contains(node))
+                if (!node.IsValid() || node.value >= index_bound || order_index[node.value] != not_ordered)
                 {
+                    // Unknown or repeated node.
                     return false;
                 }
-                order_index[node] = index;
+                order_index[node.value] = index;
             }
 
-            if (order_index.size() != node_set.size())
+            for (const auto& edge : edges.edges)
             {
-                return false;
+                const std::size_t from_index = order_index[edge.first.value];
+                const std::size_t to_index = order_index[edge.second.value];
+                if (from_index == not_in_graph || to_index == not_in_graph)
+                {
+                    continue;
+                }
+                if (from_index >= to_index)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // States each resource of a node must be in while it records, in the order they are requested.
+        std::vector<std::pair<unsigned long long, unsigned>> CollectBarrierStateRequests(const RenderGraphNodeDesc& node_desc)
+        {
+            std::vector<std::pair<unsigned long long, unsigned>> requests;
+            const auto& draw_info = node_desc.draw_info;
+            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
+            if (!render_pass)
+            {
+                return requests;
             }
 
-            for (const auto& edge_pair : edges)
+            // Mirrors the per-binding transitions in PrepareRenderGraphNode, which become no-ops once the
+            // planned batch has been recorded.
+            const auto add_request = [&](ResourceKind kind, unsigned handle_value, RHIResourceStateType state)
+            {
+                requests.emplace_back(EncodeResourceKey({kind, handle_value}), static_cast<unsigned>(state));
+            };
+
+            for (const auto& buffer : draw_info.buffer_resources)
             {
-                const auto from = edge_pair.first;
-                if (!node_set.contains(from))
+                if (!render_pass->HasRootSignatureAllocation(buffer.first))
                 {
                     continue;
                 }
+                add_request(ResourceKind::Buffer, buffer.second.buffer_handle.value,
+                    buffer.second.binding_type == BufferBindingDesc::CBV
+                        ? RHIResourceStateType::STATE_VERTEX_AND_CONSTANT_BUFFER
+                        : RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+            }
 
-                auto from_it = order_index.find(from);
-                if (from_it == order_index.end())
+            for (const auto& texture : draw_info.texture_resources)
+            {
+                if (!render_pass->HasRootSignatureAllocation(texture.first))
                 {
-                    return false;
+                    continue;
                 }
-
-                for (const auto to : edge_pair.second)
+                for (const auto texture_handle : texture.second.textures)
                 {
-                    if (!node_set.contains(to))
-                    {
-                        continue;
-                    }
-
-                    auto to_it = order_index.find(to);
-                    if (to_it == order_index.end())
-                    {
-                        return false;
-                    }
+                    add_request(ResourceKind::Texture, texture_handle.value,
+                        texture.second.type == TextureBindingDesc::SRV
+                            ? RHIResourceStateType::STATE_ALL_SHADER_RESOURCE
+                            : RHIResourceStateType::STATE_UNORDERED_ACCESS);
+                }
+            }
 
-                    if (from_it->second >= to_it->second)
+            for (const auto& render_target_pair : draw_info.render_target_texture_resources)
+            {
+                if (!render_pass->HasRootSignatureAllocation(render_target_pair.first))
+                {
+                    continue;
+                }
+                for (const auto render_target_handle : render_target_pair.second.render_target_texture)
+                {
+                    RHIResourceStateType state = RHIResourceStateType::STATE_UNORDERED_ACCESS;
+                    if (render_target_pair.second.type == RenderTargetTextureBindingDesc::SRV)
                     {
-                        return false;
+                        const auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(render_target_handle);
+                        const bool is_depth_texture = render_target && render_target->m_source &&
+                            (render_target->m_source->GetTextureDesc().GetUsage() & RUF_ALLOW_DEPTH_STENCIL) != 0;
+                        state = is_depth_texture ? RHIResourceStateType::STATE_DEPTH_READ : RHIResourceStateType::STATE_ALL_SHADER_RESOURCE;
                     }
+                    add_request(ResourceKind::RenderTarget, render_target_handle.value, state);
                 }
             }
 
-            return true;
+            // Attachments are only bound through BeginRendering, which graphics passes alone call.
+            if (render_pass->GetRenderPassType() != RenderPassType::GRAPHICS)
+            {
+                return requests;
+            }
+            bool enable_depth_write = false;
+            for (const auto& render_target_info : draw_info.render_target_resources)
+            {
+                enable_depth_write = enable_depth_write || render_target_info.second.usage == RenderPassResourceUsage::DEPTH_STENCIL;
+            }
+            for (const auto& render_target_info : draw_info.render_target_resources)
+            {
+                const auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(render_target_info.first);
+                if (!render_target)
+                {
+                    continue;
+                }
+                const auto view_type = render_target->GetDesc().m_view_type;
+                if (view_type == RHIViewType::RVT_RTV)
+                {
+                    add_request(ResourceKind::RenderTarget, render_target_info.first.value, RHIResourceStateType::STATE_RENDER_TARGET);
+                }
+                else if (view_type == RHIViewType::RVT_DSV)
+                {
+                    add_request(ResourceKind::RenderTarget, render_target_info.first.value,
+                        enable_depth_write ? RHIResourceStateType::STATE_DEPTH_WRITE : RHIResourceStateType::STATE_DEPTH_READ);
+                }
+            }
+            return requests;
         }
 
-        struct ExecutionPlanBuildResult
+        // Resource keys are EncodeResourceKey values of render target handles. Without before_known, several
+        // render targets, or ones of an earlier frame, held the range the after target takes over.
+        struct AliasingBarrierRequest
         {
-            DependencyEdgeMap combined_edges;
-            bool has_invalid_explicit_dependency{false};
-            std::vector<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>> invalid_explicit_dependencies;
-            std::size_t auto_merged_dependency_count{0};
-            std::size_t signature{0};
-            bool execution_cache_key_changed{false};
-            bool cached_execution_order_valid{false};
-            bool graph_just_became_invalid{false};
-            bool need_rebuild_execution_order{false};
+            unsigned long long before_resource_key{0};
+            unsigned long long after_resource_key{0};
+            bool before_known{false};
         };
 
-        struct ResourceAccessPlanResult
+        struct TransientAliasingLayout
         {
-            DependencyEdgeMap inferred_edges;
-            std::size_t auto_merged_dependency_count{0};
+            // Request resource ids are render target handle values.
+            std::vector<RenderGraphTransientAliasing::ResourceRequest> requests;
+            RenderGraphTransientAliasing::Plan plan;
+            // Parallel to the execution order.
+            std::vector<std::vector<AliasingBarrierRequest>> step_barriers;
         };
 
-        ResourceAccessPlanResult CollectResourceAccessPlan(const RenderGraph::ExecutionPlanContext& context)
+        // Aliasing plan for the render targets execution_order touches. A render target is transient when it is
+        // no output, its first rendering scope clears all of it before any pass reads it, and
+        // get_placement_requirements reports its size and alignment in a heap. Everything else keeps its own
+        // memory. render_pass_merge_plan has to belong to the same execution order.
+        RenderGraph::TransientAliasingDiagnostics BuildTransientAliasingDiagnostics(
+            const std::vector<RenderGraphNodeHandle>& execution_order,
+            const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
+            const RenderGraphAttachmentOps::Plan& render_pass_merge_plan,
+            const std::set<unsigned long long>& output_resource_keys,
+            const std::function<bool(RenderTargetHandle, unsigned long long&, unsigned long long&)>& get_placement_requirements,
+            TransientAliasingLayout* out_layout = nullptr)
         {
-            std::map<ResourceKey, std::set<RenderGraphNodeHandle>> resource_readers;
-            std::map<ResourceKey, std::set<RenderGraphNodeHandle>> resource_writers;
-            CollectResourceReadersAndWriters(context.nodes, context.render_graph_nodes, resource_readers, resource_writers);
-
-            ResourceAccessPlanResult result{};
-            BuildResourceInferredEdges(resource_readers, resource_writers, result.inferred_edges, nullptr);
+            RenderGraph::TransientAliasingDiagnostics diagnostics{};
+            if (out_layout)
+            {
+                *out_layout = {};
+            }
+            if (execution_order.empty() || render_pass_merge_plan.steps.size() != execution_order.size())
+            {
+                return diagnostics;
+            }
 
-            for (const auto& edge_pair : result.inferred_edges)
+            std::vector<std::vector<RenderGraphTransientAliasing::ResourceUse>> execution_steps;
+            execution_steps.reserve(execution_order.size());
+            for (const auto node_handle : execution_order)
             {
-                const auto from = edge_pair.first;
-                for (const auto to : edge_pair.second)
+                const auto access = CollectResourceAccess(render_graph_nodes[node_handle.value]);
+                auto& step = execution_steps.emplace_back();
+                std::map<unsigned long long, RenderGraphTransientAliasing::ResourceUse> render_target_uses;
+                for (const auto& resource : access.reads)
                 {
-                    if (!to.IsValid() || to.value >= context.render_graph_nodes.size())
+                    if (resource.kind == ResourceKind::RenderTarget)
                     {
-                        continue;
+                        auto& use = render_target_uses[resource.value];
+                        use.resource_id = resource.value;
+                        use.read = true;
                     }
-
-                    const auto& to_desc = context.render_graph_nodes[to.value];
-                    if (!HasDependency(to_desc, from))
+                }
+                for (const auto& resource : access.writes)
+                {
+                    if (resource.kind == ResourceKind::RenderTarget)
                     {
-                        ++result.auto_merged_dependency_count;
+                        auto& use = render_target_uses[resource.value];
+                        use.resource_id = resource.value;
+                        use.write = true;
                     }
                 }
+                for (const auto& use_pair : render_target_uses)
+                {
+                    step.push_back(use_pair.second);
+                }
             }
 
-            return result;
-        }
-
-        struct DependencyValidationResult
-        {
-            DependencyEdgeMap combined_edges;
-            bool has_invalid_explicit_dependency{false};
-            std::vector<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>> invalid_explicit_dependencies;
-        };
-
-        DependencyValidationResult ValidateDependencyPlan(
-            const RenderGraph::ExecutionPlanContext& context,
-            const DependencyEdgeMap& inferred_edges)
-        {
-            DependencyValidationResult result{};
-            result.combined_edges = inferred_edges;
-
-            for (auto handle : context.nodes)
+            // A placed target starts from undefined contents whenever another one used its memory in between, so
+            // its first pass has to clear it as a whole, and history buffers and outputs can never be placed.
+            TransientAliasingLayout layout{};
+            for (const auto& lifetime : RenderGraphTransientAliasing::ComputeLifetimes(execution_steps))
             {
-                const auto& node_desc = context.render_graph_nodes[handle.value];
-                for (const auto dep : node_desc.dependency_render_graph_nodes)
+                const RenderTargetHandle handle{static_cast<unsigned>(lifetime.resource_id)};
+                unsigned long long size_bytes = 0;
+                unsigned long long alignment = 0;
+                if (!get_placement_requirements(handle, size_bytes, alignment))
                 {
-                    const bool valid_dep = dep.IsValid() &&
-                        dep != handle &&
-                        dep.value < context.render_graph_nodes.size() &&
-                        context.registered_nodes.contains(dep);
-                    if (!valid_dep)
+                    continue;
+                }
+                diagnostics.committed_bytes += size_bytes;
+
+                const auto resource_key = EncodeResourceKey({ResourceKind::RenderTarget, handle.value});
+                const auto& first_step_ops = render_pass_merge_plan.steps[lifetime.first_use];
+                const bool cleared_on_first_use = std::binary_search(
+                    first_step_ops.cleared_resources.begin(), first_step_ops.cleared_resources.end(), resource_key);
+                if (!lifetime.first_use_discards || !cleared_on_first_use || output_resource_keys.contains(resource_key))
+                {
+                    ++diagnostics.persistent_resource_count;
+                    diagnostics.aliased_heap_bytes += size_bytes;
+                    continue;
+                }
+
+                // Barriers cannot be recorded inside a rendering scope, so a target is alive for the whole scope
+                // of its first and last pass.
+                layout.requests.push_back({
+                    lifetime.resource_id,
+                    size_bytes,
+                    (std::max)(alignment, 1ull),
+                    first_step_ops.group_begin,
+                    render_pass_merge_plan.steps[lifetime.last_use].group_end});
+            }
+
+            layout.plan = RenderGraphTransientAliasing::BuildPlan(layout.requests);
+            GLTF_CHECK(RenderGraphTransientAliasing::ValidatePlan(layout.requests, layout.plan));
+            diagnostics.valid = true;
+            diagnostics.transient_resource_count = static_cast<unsigned>(layout.requests.size());
+            diagnostics.heap_count = static_cast<unsigned>(layout.plan.heaps.size());
+            diagnostics.aliasing_barrier_count = static_cast<unsigned>(layout.plan.barriers.size());
+            diagnostics.aliased_heap_bytes += layout.plan.heap_bytes;
+
+            if (out_layout)
+            {
+                layout.step_barriers.resize(execution_order.size());
+                for (const auto& barrier : layout.plan.barriers)
+                {
+                    AliasingBarrierRequest request{};
+                    request.after_resource_key = EncodeResourceKey({ResourceKind::RenderTarget,
+                        static_cast<unsigned>(layout.requests[barrier.after_request_index].resource_id)});
+                    request.before_known = barrier.before_request_index != RenderGraphTransientAliasing::INVALID_INDEX;
+                    if (request.before_known)
                     {
-                        result.has_invalid_explicit_dependency = true;
-                        result.invalid_explicit_dependencies.emplace_back(dep, handle);
-                        continue;
+                        request.before_resource_key = EncodeResourceKey({ResourceKind::RenderTarget,
+                            static_cast<unsigned>(layout.requests[barrier.before_request_index].resource_id)});
                     }
-                    result.combined_edges[dep].insert(handle);
+                    layout.step_barriers[barrier.execution_index].push_back(request);
                 }
+                *out_layout = std::move(layout);
             }
-
-            return result;
+            return diagnostics;
         }
 
-        ExecutionPlanBuildResult BuildExecutionPlan(const RenderGraph::ExecutionPlanContext& context)
+        // Queue schedule of execution_order; pass_types is parallel to it and keeps everything but compute
+        // passes on the graphics queue. state_requests is parallel as well, see CollectBarrierStateRequests.
+        void BuildAsyncComputeSchedule(
+            const std::vector<RenderGraphNodeHandle>& execution_order,
+            const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
+            const std::vector<RenderPassType>& pass_types,
+            const std::vector<std::vector<std::pair<unsigned long long, unsigned>>>& state_requests,
+            RenderGraph::AsyncComputeScheduleDiagnostics& out_diagnostics,
+            std::string& out_dump,
+            RenderGraphQueueScheduler::Schedule* out_schedule = nullptr)
         {
-            const auto access_plan = CollectResourceAccessPlan(context);
-            const auto dependency_validation = ValidateDependencyPlan(context, access_plan.inferred_edges);
-
-            ExecutionPlanBuildResult result{};
-            result.combined_edges = dependency_validation.combined_edges;
-            result.has_invalid_explicit_dependency = dependency_validation.has_invalid_explicit_dependency;
-            result.invalid_explicit_dependencies = dependency_validation.invalid_explicit_dependencies;
-            result.auto_merged_dependency_count = access_plan.auto_merged_dependency_count;
-
-            result.signature = ComputeExecutionSignature(context.nodes, context.render_graph_nodes, result.combined_edges);
-            result.execution_cache_key_changed =
-                result.signature != context.cached_execution_signature || context.cached_execution_node_count != context.nodes.size();
-            result.cached_execution_order_valid = ValidateExecutionOrder(context.nodes, result.combined_edges, context.cached_execution_order);
-            result.graph_just_became_invalid = result.has_invalid_explicit_dependency && context.cached_execution_graph_valid;
-            result.need_rebuild_execution_order =
-                result.execution_cache_key_changed ||
-                result.graph_just_became_invalid ||
-                (context.cached_execution_graph_valid && !result.cached_execution_order_valid);
+            out_diagnostics = {};
+            out_dump.clear();
+            if (out_schedule)
+            {
+                *out_schedule = {};
+            }
+            if (execution_order.empty())
+            {
+                return;
+            }
 
-            return result;
-        }
+            std::map<RenderGraphNodeHandle, unsigned> execution_indices;
+            for (unsigned step_index = 0; step_index < execution_order.size(); ++step_index)
+            {
+                execution_indices[execution_order[step_index]] = step_index;
+            }
 
-        std::vector<RenderGraphNodeHandle> ApplyExecutionPlanResult(
-            const RenderGraph::ExecutionPlanContext& context,
-            const ExecutionPlanBuildResult& plan,
-            RenderGraph::ExecutionPlanCacheState& io_cache_state)
-        {
-            std::vector<RenderGraphNodeHandle> rebuilt_cycle_nodes;
-            if (plan.need_rebuild_execution_order)
+            // Beyond the read-after-write edges of the execution plan, a queue must also not overwrite what the
+            // other queue still reads, so dependencies are rebuilt from the accesses in execution order.
+            struct ResourceHistory
             {
-                if (!plan.execution_cache_key_changed && !plan.graph_just_became_invalid && !plan.cached_execution_order_valid)
+                unsigned last_writer{RenderGraphQueueScheduler::INVALID_INDEX};
+                std::vector<unsigned> readers_since_write;
+            };
+            std::map<ResourceKey, ResourceHistory> resource_histories;
+            // Transitions are recorded on the queue of the step that needs them, so the other queue has to be
+            // done with a resource first: a step requesting another state than the last one counts as a write.
+            // Async candidates request the states a compute queue can transition to.
+            std::map<unsigned long long, unsigned> last_requested_states;
+
+            std::vector<RenderGraphQueueScheduler::StepDesc> execution_steps(execution_order.size());
+            for (unsigned step_index = 0; step_index < execution_order.size(); ++step_index)
+            {
+                const auto& node_desc = render_graph_nodes[execution_order[step_index].value];
+                auto& step = execution_steps[step_index];
+                step.request_async_compute = node_desc.queue_affinity == RenderPassQueueAffinity::ASYNC_COMPUTE;
+                step.compute_only = pass_types[step_index] == RenderPassType::COMPUTE;
+                if (step.request_async_compute)
                 {
-                    LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Cached execution order validation failed. Rebuilding execution order.\n");
+                    ++out_diagnostics.requested_pass_count;
                 }
 
-                io_cache_state.cached_execution_signature = plan.signature;
-                io_cache_state.cached_execution_node_count = context.nodes.size();
-
+                for (const auto dependency : node_desc.dependency_render_graph_nodes)
                 {
-                    static bool s_has_auto_merge_log_state = false;
-                    static std::size_t s_last_auto_merged_dependency_count = 0;
-                    static std::chrono::steady_clock::time_point s_last_auto_merge_log_time{};
-                    if (plan.auto_merged_dependency_count > 0)
+                    const auto it = execution_indices.find(dependency);
+                    if (it != execution_indices.end() && it->second < step_index)
                     {
-                        const auto now = std::chrono::steady_clock::now();
-                        constexpr auto auto_merge_log_min_interval = std::chrono::seconds(5);
-                        const bool count_changed =
-                            !s_has_auto_merge_log_state ||
-                            s_last_auto_merged_dependency_count != plan.auto_merged_dependency_count;
-                        const bool interval_elapsed =
-                            !s_has_auto_merge_log_state ||
-                            (now - s_last_auto_merge_log_time) >= auto_merge_log_min_interval;
-                        if (count_changed || interval_elapsed)
-                        {
-                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Auto-merged %zu inferred dependencies into execution plan.\n",
-                                plan.auto_merged_dependency_count);
-                            s_last_auto_merge_log_time = now;
-                        }
+                        step.dependencies.push_back(it->second);
                     }
-
-                    s_has_auto_merge_log_state = true;
-                    s_last_auto_merged_dependency_count = plan.auto_merged_dependency_count;
                 }
 
-                if (plan.has_invalid_explicit_dependency)
+                auto access = CollectResourceAccess(node_desc);
+                if (step_index < state_requests.size())
                 {
-                    io_cache_state.cached_execution_graph_valid = false;
-                    io_cache_state.cached_execution_order.clear();
-                    LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Invalid explicit dependencies detected (%zu). Skip frame graph execution.\n",
-                        plan.invalid_explicit_dependencies.size());
-                    for (const auto& invalid_dep : plan.invalid_explicit_dependencies)
+                    constexpr unsigned long long kind_shift = 62ull;
+                    constexpr unsigned long long value_mask = (1ull << kind_shift) - 1ull;
+                    const bool compute_queue_states = step.request_async_compute && step.compute_only;
+                    for (const auto& [resource_key, state] : state_requests[step_index])
                     {
-                        const auto from = invalid_dep.first;
-                        const auto to = invalid_dep.second;
-                        if (from.IsValid())
-                        {
-                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   invalid edge: %u -> %u\n", from.value, to.value);
-                        }
-                        else
+                        const unsigned requested_state = compute_queue_states
+                            ? static_cast<unsigned>(ConvertToComputeQueueResourceState(static_cast<RHIResourceStateType>(state)))
+                            : state;
+                        const auto [state_it, first_request] = last_requested_states.try_emplace(resource_key, requested_state);
+                        if (!first_request && state_it->second != requested_state)
                         {
-                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   invalid edge: <INVALID> -> %u\n", to.value);
+                            access.writes.push_back({static_cast<ResourceKind>(resource_key >> kind_shift), resource_key & value_mask});
                         }
+                        state_it->second = requested_state;
                     }
+                    std::sort(access.writes.begin(), access.writes.end());
+                    access.writes.erase(std::unique(access.writes.begin(), access.writes.end()), access.writes.end());
                 }
-                else
+                for (const auto& resource : access.reads)
                 {
-                    std::vector<RenderGraphNodeHandle> execution_nodes;
-                    std::vector<RenderGraphNodeHandle> cycle_nodes;
-                    const bool sorted = TopologicalSortExecutionNodes(context.nodes, plan.combined_edges, execution_nodes, &cycle_nodes);
-                    if (!sorted)
+                    auto& history = resource_histories[resource];
+                    if (history.last_writer != RenderGraphQueueScheduler::INVALID_INDEX)
                     {
-                        io_cache_state.cached_execution_graph_valid = false;
-                        io_cache_state.cached_execution_order.clear();
-                        rebuilt_cycle_nodes = cycle_nodes;
-                        LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Cycle detected in combined dependencies. Skip frame graph execution. Nodes:");
-                        for (const auto cycle_node : cycle_nodes)
-                        {
-                            LOG_FORMAT_FLUSH(" %u", cycle_node.value);
-                        }
-                        LOG_FORMAT_FLUSH("\n");
-                        for (const auto cycle_node : cycle_nodes)
-                        {
-                            const auto& node_desc = context.render_graph_nodes[cycle_node.value];
-                            const char* group_name = node_desc.debug_group.empty() ? "<group-empty>" : node_desc.debug_group.c_str();
-                            const char* pass_name = node_desc.debug_name.empty() ? "<pass-empty>" : node_desc.debug_name.c_str();
-                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   cycle node %u = (%s/%s)\n",
-                                             cycle_node.value,
-                                             group_name,
-                                             pass_name);
-                        }
-
-                        std::set<RenderGraphNodeHandle> cycle_node_set(cycle_nodes.begin(), cycle_nodes.end());
-                        std::map<ResourceKey, std::set<RenderGraphNodeHandle>> resource_readers;
-                        std::map<ResourceKey, std::set<RenderGraphNodeHandle>> resource_writers;
-                        CollectResourceReadersAndWriters(context.nodes, context.render_graph_nodes, resource_readers, resource_writers);
-                        DependencyEdgeMap inferred_edges_for_debug;
-                        DependencyEdgeResourceMap inferred_edge_resources_for_debug;
-                        BuildResourceInferredEdges(
-                            resource_readers,
-                            resource_writers,
-                            inferred_edges_for_debug,
-                            &inferred_edge_resources_for_debug);
-
-                        const auto log_resource_key = [](const ResourceKey& key)
-                        {
-                            LOG_FORMAT_FLUSH(" %s:%llu", ToResourceKindName(key.kind), key.value);
-                        };
-
-                        for (const auto cycle_from : cycle_nodes)
+                        step.dependencies.push_back(history.last_writer);
+                    }
+                }
+                for (const auto& resource : access.writes)
+                {
+                    auto& history = resource_histories[resource];
+                    if (history.last_writer != RenderGraphQueueScheduler::INVALID_INDEX)
+                    {
+                        step.dependencies.push_back(history.last_writer);
+                    }
+                    for (const unsigned reader : history.readers_since_write)
+                    {
+                        if (reader != step_index)
                         {
-                            auto combined_edge_it = plan.combined_edges.find(cycle_from);
-                            if (combined_edge_it == plan.combined_edges.end())
-                            {
-                                continue;
-                            }
-
-                            for (const auto cycle_to : combined_edge_it->second)
-                            {
-                                if (!cycle_node_set.contains(cycle_to))
-                                {
-                                    continue;
-                                }
-
-                                LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   cycle edge %u -> %u", cycle_from.value, cycle_to.value);
-                                const auto resource_it = inferred_edge_resources_for_debug.find({cycle_from, cycle_to});
-                                if (resource_it == inferred_edge_resources_for_debug.end())
-                                {
-                                    LOG_FORMAT_FLUSH(" (explicit)\n");
-                                    continue;
-                                }
-
-                                const auto& resources = resource_it->second;
-                                LOG_FORMAT_FLUSH(" (inferred resources:");
-                                const size_t max_resource_print_count = (std::min)(resources.size(), static_cast<size_t>(8));
-                                for (size_t resource_index = 0; resource_index < max_resource_print_count; ++resource_index)
-                                {
-                                    log_resource_key(resources[resource_index]);
-                                }
-                                if (resources.size() > max_resource_print_count)
-                                {
-                                    LOG_FORMAT_FLUSH(" ...");
-                                }
-                                LOG_FORMAT_FLUSH(")\n");
-                            }
+                            step.dependencies.push_back(reader);
                         }
                     }
-                    else
+                }
+                for (const auto& resource : access.reads)
+                {
+                    if (!std::binary_search(access.writes.begin(), access.writes.end(), resource))
                     {
-                        io_cache_state.cached_execution_graph_valid = true;
-                        io_cache_state.cached_execution_order = std::move(execution_nodes);
-                        rebuilt_cycle_nodes.clear();
+                        resource_histories[resource].readers_since_write.push_back(step_index);
                     }
                 }
+                for (const auto& resource : access.writes)
+                {
+                    auto& history = resource_histories[resource];
+                    history.last_writer = step_index;
+                    history.readers_since_write.clear();
+                }
+
+                std::sort(step.dependencies.begin(), step.dependencies.end());
+                step.dependencies.erase(std::unique(step.dependencies.begin(), step.dependencies.end()), step.dependencies.end());
             }
 
-            if (plan.has_invalid_explicit_dependency || io_cache_state.cached_execution_graph_valid)
+            auto schedule = RenderGraphQueueScheduler::BuildSchedule(execution_steps);
+            out_diagnostics.valid = true;
+            out_diagnostics.async_pass_count = schedule.async_step_count;
+            out_diagnostics.demoted_pass_count = schedule.demoted_step_count;
+            out_diagnostics.sync_point_count = static_cast<unsigned>(schedule.sync_points.size());
+            out_diagnostics.elided_wait_count = schedule.elided_wait_count;
+            for (const auto& step : schedule.steps)
             {
-                return {};
+                out_diagnostics.overlapped_graphics_pass_count += step.overlapping_graphics_step_count;
             }
-            if (plan.need_rebuild_execution_order)
+            out_dump = RenderGraphQueueScheduler::DumpSchedule(schedule);
+            if (out_schedule)
             {
-                return rebuilt_cycle_nodes;
+                *out_schedule = std::move(schedule);
             }
-
-            return {};
         }
 
-        void UpdateDependencyDiagnostics(
-            const RenderGraph::ExecutionPlanContext& context,
-            const ExecutionPlanBuildResult& plan,
-            bool cached_execution_graph_valid,
-            std::size_t cached_execution_signature,
-            std::size_t cached_execution_node_count,
-            std::size_t cached_execution_order_size,
-            std::vector<RenderGraphNodeHandle>&& cycle_nodes,
-            const std::map<RenderGraphNodeHandle, std::tuple<unsigned, unsigned, unsigned>>& auto_pruned_named_binding_counts,
-            const ResourceAccessMaskMap& previous_frame_resource_access_masks,
-            const ResourcePassAccessMap& previous_frame_resource_pass_accesses,
-            bool has_previous_frame_resource_access_masks,
-            unsigned cross_frame_comparison_window_size,
-            unsigned cross_frame_compared_frame_count,
-            const ResourceAccessMaskMap& current_frame_resource_access_masks,
-            const ResourcePassAccessMap& current_frame_resource_pass_accesses,
-            RenderGraph::DependencyDiagnostics& out_diagnostics)
+        // Area a pass renders to as far as the node desc tells: the node viewport rect, else the render pass
+        // viewport size. Negative sizes stand for the size of the attachments.
+        RenderViewportRect ResolveRenderArea(const RenderGraphNodeDesc& node_desc, const RenderPass* render_pass)
         {
-            out_diagnostics.graph_valid = cached_execution_graph_valid;
-            out_diagnostics.has_invalid_explicit_dependencies = plan.has_invalid_explicit_dependency;
-            out_diagnostics.auto_merged_dependency_count = static_cast<unsigned>(plan.auto_merged_dependency_count);
-            out_diagnostics.invalid_explicit_dependencies = plan.invalid_explicit_dependencies;
-            out_diagnostics.execution_signature = cached_execution_signature;
-            out_diagnostics.cached_execution_node_count = cached_execution_node_count;
-            out_diagnostics.cached_execution_order_size = cached_execution_order_size;
-            if (plan.has_invalid_explicit_dependency || cached_execution_graph_valid)
+            RenderViewportRect render_area = node_desc.viewport_rect;
+            if (render_area.width < 0 || render_area.height < 0)
             {
-                out_diagnostics.cycle_nodes.clear();
+                render_area.width = render_pass ? render_pass->GetViewportSize().first : -1;
+                render_area.height = render_pass ? render_pass->GetViewportSize().second : -1;
             }
-            else if (plan.need_rebuild_execution_order)
+            return render_area;
+        }
+
+        RenderGraphAttachmentOps::LoadOp ToAttachmentLoadOp(const RenderTargetBindingDesc& binding)
+        {
+            switch (binding.load_op)
             {
-                out_diagnostics.cycle_nodes = std::move(cycle_nodes);
+            case RenderPassAttachmentLoadOp::LOAD:
+                return binding.need_clear ? RenderGraphAttachmentOps::LoadOp::CLEAR : RenderGraphAttachmentOps::LoadOp::LOAD;
+            case RenderPassAttachmentLoadOp::CLEAR:
+                return RenderGraphAttachmentOps::LoadOp::CLEAR;
+            case RenderPassAttachmentLoadOp::DONT_CARE:
+                return RenderGraphAttachmentOps::LoadOp::DONT_CARE;
             }
+            return RenderGraphAttachmentOps::LoadOp::LOAD;
+        }
 
-            out_diagnostics.auto_pruned_binding_count = 0;
-            out_diagnostics.auto_pruned_node_count = 0;
-            out_diagnostics.auto_pruned_nodes.clear();
-            for (const auto node_handle : context.nodes)
+        RHIAttachmentLoadOp ToRHIAttachmentLoadOp(RenderGraphAttachmentOps::LoadOp load_op)
+        {
+            switch (load_op)
             {
-                const auto pruned_count_it = auto_pruned_named_binding_counts.find(node_handle);
-                if (pruned_count_it == auto_pruned_named_binding_counts.end())
+            case RenderGraphAttachmentOps::LoadOp::LOAD:
+                return RHIAttachmentLoadOp::LOAD_OP_LOAD;
+            case RenderGraphAttachmentOps::LoadOp::CLEAR:
+                return RHIAttachmentLoadOp::LOAD_OP_CLEAR;
+            case RenderGraphAttachmentOps::LoadOp::DONT_CARE:
+                return RHIAttachmentLoadOp::LOAD_OP_DONT_CARE;
+            }
+            return RHIAttachmentLoadOp::LOAD_OP_LOAD;
+        }
+
+        // Attachment ops and rendering scopes of execution_order. pass_types, render_areas and
+        // barrier_state_requests are parallel to it; only graphics passes bind their attachments.
+        // get_render_target_extent reports attachment sizes; an attachment of unknown size counts as only
+        // partly covered unless the render area falls back to the attachment size.
+        RenderGraphAttachmentOps::Plan BuildRenderPassMergePlan(
+            const std::vector<RenderGraphNodeHandle>& execution_order,
+            const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
+            const std::vector<RenderPassType>& pass_types,
+            const std::vector<RenderViewportRect>& render_areas,
+            const std::vector<std::vector<std::pair<unsigned long long, unsigned>>>& barrier_state_requests,
+            const std::set<unsigned long long>& output_resource_keys,
+            const std::function<bool(RenderTargetHandle, unsigned&, unsigned&)>& get_render_target_extent,
+            const RenderGraph::RenderPassMergePolicy& policy)
+        {
+            std::vector<RenderGraphAttachmentOps::StepDesc> execution_steps(execution_order.size());
+            for (unsigned step_index = 0; step_index < execution_order.size(); ++step_index)
+            {
+                const auto& node_desc = render_graph_nodes[execution_order[step_index].value];
+                auto& step = execution_steps[step_index];
+                step.raster = pass_types[step_index] == RenderPassType::GRAPHICS;
+                const auto& render_area = render_areas[step_index];
+
+                // Attachment keys grow with the handle value, so map order keeps them sorted.
+                if (step.raster)
                 {
-                    continue;
+                    for (const auto& render_target_pair : node_desc.draw_info.render_target_resources)
+                    {
+                        RenderGraphAttachmentOps::Attachment attachment{};
+                        attachment.resource_id = EncodeResourceKey({ResourceKind::RenderTarget, render_target_pair.first.value});
+                        attachment.load_op = ToAttachmentLoadOp(render_target_pair.second);
+                        attachment.store_op = render_target_pair.second.store_op == RenderPassAttachmentStoreOp::DONT_CARE
+                            ? RenderGraphAttachmentOps::StoreOp::DONT_CARE
+                            : RenderGraphAttachmentOps::StoreOp::STORE;
+                        if (render_area.offset_x != 0 || render_area.offset_y != 0)
+                        {
+                            attachment.full_area = false;
+                        }
+                        else if (render_area.width >= 0 && render_area.height >= 0)
+                        {
+                            unsigned width = 0;
+                            unsigned height = 0;
+                            attachment.full_area = get_render_target_extent(render_target_pair.first, width, height) &&
+                                static_cast<unsigned>(render_area.width) >= width &&
+                                static_cast<unsigned>(render_area.height) >= height;
+                        }
+                        step.attachments.push_back(attachment);
+                    }
                 }
 
-                const auto [buffer_count, texture_count, render_target_texture_count] = pruned_count_it->second;
-                const unsigned total_count = buffer_count + texture_count + render_target_texture_count;
-                if (total_count == 0)
+                // Normalized accesses stay sorted and unique once encoded.
+                const auto access = CollectResourceAccess(node_desc, !step.raster);
+                for (const auto& resource : access.reads)
                 {
-                    continue;
+                    step.reads.push_back(EncodeResourceKey(resource));
+                }
+                for (const auto& resource : access.writes)
+                {
+                    step.writes.push_back(EncodeResourceKey(resource));
                 }
+                step.states = barrier_state_requests[step_index];
 
-                ++out_diagnostics.auto_pruned_node_count;
-                out_diagnostics.auto_pruned_binding_count += total_count;
+                std::size_t render_area_key = 0;
+                HashCombine(render_area_key, static_cast<std::size_t>(render_area.offset_x));
+                HashCombine(render_area_key, static_cast<std::size_t>(render_area.offset_y));
+                HashCombine(render_area_key, static_cast<std::size_t>(render_area.width));
+                HashCombine(render_area_key, static_cast<std::size_t>(render_area.height));
+                step.render_area_key = render_area_key;
+            }
 
-                RenderGraph::DependencyDiagnostics::AutoPrunedNodeDiagnostics node_diagnostics{};
-                node_diagnostics.node_handle = node_handle;
-                const auto& node_desc = context.render_graph_nodes[node_handle.value];
-                node_diagnostics.group_name = node_desc.debug_group.empty() ? "<group-empty>" : node_desc.debug_group;
-                node_diagnostics.pass_name = node_desc.debug_name.empty() ? "<pass-empty>" : node_desc.debug_name;
-                node_diagnostics.buffer_count = buffer_count;
-                node_diagnostics.texture_count = texture_count;
-                node_diagnostics.render_target_texture_count = render_target_texture_count;
-                out_diagnostics.auto_pruned_nodes.push_back(std::move(node_diagnostics));
+            RenderGraphAttachmentOps::Options options{};
+            options.infer_store_ops = policy.infer_store_ops;
+            options.merge_steps = policy.merge_passes;
+            return RenderGraphAttachmentOps::BuildPlan(
+                execution_steps,
+                std::vector<unsigned long long>(output_resource_keys.begin(), output_resource_keys.end()),
+                options);
+        }
+
+        RenderGraph::RenderPassMergeDiagnostics SummarizeRenderPassMergePlan(const RenderGraphAttachmentOps::Plan& plan)
+        {
+            RenderGraph::RenderPassMergeDiagnostics diagnostics{};
+            diagnostics.valid = true;
+            for (const auto& step : plan.steps)
+            {
+                if (!step.load_ops.empty())
+                {
+                    ++diagnostics.attachment_pass_count;
+                }
             }
+            diagnostics.merged_group_count = plan.merged_group_count;
+            diagnostics.merged_pass_count = plan.merged_step_count;
+            diagnostics.elided_load_count = plan.elided_load_count;
+            diagnostics.elided_store_count = plan.elided_store_count;
+            return diagnostics;
+        }
 
-            out_diagnostics.cross_frame_analysis_ready = has_previous_frame_resource_access_masks;
-            out_diagnostics.cross_frame_comparison_window_size = cross_frame_comparison_window_size;
-            out_diagnostics.cross_frame_compared_frame_count = cross_frame_compared_frame_count;
-            out_diagnostics.cross_frame_hazard_count = 0;
-            out_diagnostics.cross_frame_hazard_overflow_count = 0;
-            out_diagnostics.cross_frame_hazards.clear();
-            if (!has_previous_frame_resource_access_masks)
+        void CloseRenderingScope(IRHICommandList& command_list, bool& rendering_scope_open)
+        {
+            if (rendering_scope_open)
             {
-                return;
+                RHIUtilInstanceManager::Instance().EndRendering(command_list);
+                rendering_scope_open = false;
             }
+        }
 
-            const auto record_hazard = [
-                &out_diagnostics,
-                &previous_frame_resource_pass_accesses,
-                &current_frame_resource_pass_accesses
-            ](
-                unsigned long long encoded_resource_key,
-                RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType hazard_type,
-                bool use_previous_writers,
-                bool use_current_writers)
+        // Nodes of execution_order whose writes reach no output resource through the dependency edges.
+        // Resources read no later than their first write in the frame (loaded attachments, UAVs, history
+        // textures) carry data across frames and count as outputs, as do nodes without tracked writes, whose
+        // effects cannot be followed.
+        std::vector<RenderGraphNodeHandle> CollectDeadNodes(
+            const std::vector<RenderGraphNodeHandle>& execution_order,
+            const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
+            const DependencyEdgeList& edges,
+            const std::set<unsigned long long>& output_resource_keys)
+        {
+            std::vector<RenderGraphNodeHandle> dead_nodes;
+            if (execution_order.empty())
             {
-                ++out_diagnostics.cross_frame_hazard_count;
-                if (out_diagnostics.cross_frame_hazards.size() >= MAX_CROSS_FRAME_HAZARDS_RECORDED)
-                {
-                    ++out_diagnostics.cross_frame_hazard_overflow_count;
-                    return;
-                }
+                return dead_nodes;
+            }
 
-                constexpr unsigned long long kind_shift = 62ull;
-                const auto encoded_kind = static_cast<unsigned>(encoded_resource_key >> kind_shift);
-                const auto resource_kind = static_cast<ResourceKind>(encoded_kind);
-                RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics hazard{};
-                hazard.hazard_type = hazard_type;
-                hazard.resource_kind = ToResourceKindName(resource_kind);
-                hazard.resource_id = static_cast<unsigned>(encoded_resource_key & 0xffffffffULL);
+            struct ResourceUseRange
+            {
+                unsigned first_read{(std::numeric_limits<unsigned>::max)()};
+                unsigned first_write{(std::numeric_limits<unsigned>::max)()};
+            };
 
-                const auto previous_access_it = previous_frame_resource_pass_accesses.find(encoded_resource_key);
-                if (previous_access_it != previous_frame_resource_pass_accesses.end())
+            std::vector<ResourceAccessSet> accesses;
+            accesses.reserve(execution_order.size());
+            std::map<ResourceKey, ResourceUseRange> use_ranges;
+            for (unsigned step_index = 0; step_index < execution_order.size(); ++step_index)
+            {
+                const auto& access = accesses.emplace_back(CollectResourceAccess(render_graph_nodes[execution_order[step_index].value]));
+                for (const auto& resource : access.reads)
                 {
-                    hazard.previous_passes = use_previous_writers
-                        ? previous_access_it->second.second
-                        : previous_access_it->second.first;
+                    auto& range = use_ranges[resource];
+                    range.first_read = (std::min)(range.first_read, step_index);
                 }
-
-                const auto current_access_it = current_frame_resource_pass_accesses.find(encoded_resource_key);
-                if (current_access_it != current_frame_resource_pass_accesses.end())
+                for (const auto& resource : access.writes)
                 {
-                    hazard.current_passes = use_current_writers
-                        ? current_access_it->second.second
-                        : current_access_it->second.first;
+                    auto& range = use_ranges[resource];
+                    range.first_write = (std::min)(range.first_write, step_index);
                 }
+            }
 
-                out_diagnostics.cross_frame_hazards.push_back(std::move(hazard));
-            };
-
-            for (const auto& current_pair : current_frame_resource_access_masks)
+            const auto is_output = [&](const ResourceKey& resource)
             {
-                const auto previous_it = previous_frame_resource_access_masks.find(current_pair.first);
-                if (previous_it == previous_frame_resource_access_masks.end())
+                if (output_resource_keys.contains(EncodeResourceKey(resource)))
                 {
-                    continue;
+                    return true;
                 }
+                const auto& range = use_ranges[resource];
+                return range.first_read <= range.first_write;
+            };
 
-                const unsigned char previous_mask = previous_it->second;
-                const unsigned char current_mask = current_pair.second;
-                if ((previous_mask & RESOURCE_ACCESS_MASK_WRITE) != 0 && (current_mask & RESOURCE_ACCESS_MASK_READ) != 0)
+            const unsigned index_bound = ComputeNodeIndexBound(execution_order, edges);
+            std::vector<unsigned char> live(index_bound, 0u);
+            std::vector<RenderGraphNodeHandle> pending;
+            for (unsigned step_index = 0; step_index < execution_order.size(); ++step_index)
+            {
+                const auto& writes = accesses[step_index].writes;
+                if (writes.empty() || std::any_of(writes.begin(), writes.end(), is_output))
                 {
-                    record_hazard(
-                        current_pair.first,
-                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_WRITE_CURRENT_READ,
-                        true,
-                        false);
+                    live[execution_order[step_index].value] = 1u;
+                    pending.push_back(execution_order[step_index]);
                 }
-                if ((previous_mask & RESOURCE_ACCESS_MASK_WRITE) != 0 && (current_mask & RESOURCE_ACCESS_MASK_WRITE) != 0)
+            }
+
+            // Walk the edges backwards: whatever a live node consumes or explicitly depends on is live too.
+            std::vector<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>> reversed_edges;
+            reversed_edges.reserve(edges.edges.size());
+            for (const auto& edge : edges.edges)
+            {
+                reversed_edges.emplace_back(edge.second, edge.first);
+            }
+            std::sort(reversed_edges.begin(), reversed_edges.end());
+
+            while (!pending.empty())
+            {
+                const auto node = pending.back();
+                pending.pop_back();
+                auto edge_it = std::lower_bound(reversed_edges.begin(), reversed_edges.end(), std::make_pair(node, RenderGraphNodeHandle{0}));
+                for (; edge_it != reversed_edges.end() && edge_it->first == node; ++edge_it)
                 {
-                    record_hazard(
-                        current_pair.first,
-                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_WRITE_CURRENT_WRITE,
-                        true,
-                        true);
+                    const auto producer = edge_it->second;
+                    if (!live[producer.value])
+                    {
+                        live[producer.value] = 1u;
+                        pending.push_back(producer);
+                    }
                 }
-                if ((previous_mask & RESOURCE_ACCESS_MASK_READ) != 0 && (current_mask & RESOURCE_ACCESS_MASK_WRITE) != 0)
+            }
+
+            for (const auto node : execution_order)
+            {
+                if (!live[node.value])
                 {
-                    record_hazard(
-                        current_pair.first,
-                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_READ_CURRENT_WRITE,
-                        false,
-                        true);
+                    dead_nodes.push_back(node);
                 }
             }
+            return dead_nodes;
         }
 
-        unsigned long long ComputeBufferDescriptorCacheKey(const BufferBindingDesc& binding_desc, std::uintptr_t buffer_identity_key)
+        // Planner inputs of one frame as written by RenderGraph::WriteExecutionPlanningSnapshot. Node handles
+        // keep their original values, so the per-node vectors are indexed by handle value.
+        struct ExecutionPlanningSnapshot
         {
-            std::size_t seed = 1469598103934665603ULL;
-            HashCombine(seed, static_cast<std::size_t>(binding_desc.binding_type));
-            HashCombine(seed, static_cast<std::size_t>(buffer_identity_key));
-            HashCombine(seed, static_cast<std::size_t>(binding_desc.stride));
-            HashCombine(seed, static_cast<std::size_t>(binding_desc.count));
-            HashCombine(seed, binding_desc.is_structured_buffer ? 1u : 0u);
-            HashCombine(seed, binding_desc.use_count_buffer ? 1u : 0u);
-            HashCombine(seed, static_cast<std::size_t>(binding_desc.count_buffer_offset));
-            return static_cast<unsigned long long>(seed);
-        }
+            std::vector<RenderGraphNodeHandle> nodes;
+            std::vector<RenderGraphNodeDesc> render_graph_nodes;
+            std::vector<RenderPassType> pass_types;
+            std::vector<std::vector<std::pair<unsigned long long, unsigned>>> barrier_state_requests;
+            // Size and alignment of the render targets that can be placed in a transient heap.
+            std::map<unsigned, std::pair<unsigned long long, unsigned long long>> render_target_placements;
+            std::map<unsigned, std::pair<unsigned, unsigned>> render_target_extents;
+            std::set<unsigned long long> output_resource_keys;
+            bool dead_pass_culling{true};
+            RenderGraph::RenderPassMergePolicy render_pass_merge_policy{};
+        };
 
-        unsigned long long ComputeTextureDescriptorCacheKey(unsigned binding_type, const std::vector<std::uintptr_t>& source_texture_identity_keys)
+        bool ReadExecutionPlanningSnapshot(const std::string& path, ExecutionPlanningSnapshot& out_snapshot, std::string& out_error)
         {
-            std::size_t seed = 1469598103934665603ULL;
-            HashCombine(seed, static_cast<std::size_t>(binding_type));
-            HashCombine(seed, source_texture_identity_keys.size());
-            for (const auto source_texture_identity_key : source_texture_identity_keys)
+            out_snapshot = {};
+            std::ifstream stream(path, std::ios::in | std::ios::binary);
+            if (!stream.is_open())
             {
-                HashCombine(seed, static_cast<std::size_t>(source_texture_identity_key));
+                out_error = "Failed to open planning snapshot: " + path;
+                return false;
             }
-            return static_cast<unsigned long long>(seed);
-        }
 
-        std::vector<std::uintptr_t> BuildTextureSourceIdentityKeys(const TextureBindingDesc& binding_desc)
-        {
-            std::vector<std::uintptr_t> source_texture_identity_keys;
-            source_texture_identity_keys.reserve(binding_desc.textures.size());
-            for (const auto texture_handle : binding_desc.textures)
+            try
             {
-                const auto texture_allocation = InternalResourceHandleTable::Instance().GetTexture(texture_handle);
-                if (texture_allocation && texture_allocation->m_texture)
+                const auto root = nlohmann::json::parse(stream);
+                if (root.at("version").get<unsigned>() != EXECUTION_PLANNING_SNAPSHOT_VERSION)
                 {
-                    source_texture_identity_keys.push_back(reinterpret_cast<std::uintptr_t>(texture_allocation->m_texture.get()));
+                    out_error = "Unsupported planning snapshot version in " + path;
+                    return false;
                 }
-                else
+
+                out_snapshot.dead_pass_culling = root.at("dead_pass_culling").get<bool>();
+                const auto& render_pass_merge_json = root.at("render_pass_merge");
+                out_snapshot.render_pass_merge_policy.infer_store_ops = render_pass_merge_json.at("infer_store_ops").get<bool>();
+                out_snapshot.render_pass_merge_policy.merge_passes = render_pass_merge_json.at("merge_passes").get<bool>();
+                out_snapshot.output_resource_keys = root.at("output_resource_keys").get<std::set<unsigned long long>>();
+                for (const auto& render_target_json : root.at("render_targets"))
                 {
-                    source_texture_identity_keys.push_back(static_cast<std::uintptr_t>(texture_handle.value));
+                    const unsigned render_target_handle = render_target_json.at("handle").get<unsigned>();
+                    const auto extent = render_target_json.at("extent").get<std::vector<unsigned>>();
+                    if (extent.size() != 2)
+                    {
+                        out_error = "Invalid render target extent in planning snapshot " + path;
+                        return false;
+                    }
+                    out_snapshot.render_target_extents[render_target_handle] = {extent[0], extent[1]};
+                    if (render_target_json.contains("placement_bytes"))
+                    {
+                        out_snapshot.render_target_placements[render_target_handle] = {
+                            render_target_json.at("placement_bytes").get<unsigned long long>(),
+                            render_target_json.value("placement_alignment", TRANSIENT_RESOURCE_PLACEMENT_ALIGNMENT)};
+                    }
                 }
-            }
-            return source_texture_identity_keys;
-        }
 
-        std::vector<std::uintptr_t> BuildRenderTargetTextureSourceIdentityKeys(const RenderTargetTextureBindingDesc& binding_desc)
-        {
-            std::vector<std::uintptr_t> source_texture_identity_keys;
-            source_texture_identity_keys.reserve(binding_desc.render_target_texture.size());
-            for (const auto render_target_handle : binding_desc.render_target_texture)
-            {
-                source_texture_identity_keys.push_back(static_cast<std::uintptr_t>(ResolveRenderTargetResourceIdentity(render_target_handle)));
-            }
-            return source_texture_identity_keys;
-        }
+                for (const auto& node_json : root.at("nodes"))
+                {
+                    const RenderGraphNodeHandle node_handle{node_json.at("handle").get<unsigned>()};
+                    if (node_handle.value >= out_snapshot.render_graph_nodes.size())
+                    {
+                        out_snapshot.render_graph_nodes.resize(node_handle.value + 1);
+                        out_snapshot.pass_types.resize(node_handle.value + 1, RenderPassType::GRAPHICS);
+                        out_snapshot.barrier_state_requests.resize(node_handle.value + 1);
+                    }
+                    out_snapshot.nodes.push_back(node_handle);
+
+                    auto& node_desc = out_snapshot.render_graph_nodes[node_handle.value];
+                    node_desc.debug_group = node_json.at("group").get<std::string>();
+                    node_desc.debug_name = node_json.at("name").get<std::string>();
+                    node_desc.render_pass_handle = RenderPassHandle{node_json.at("render_pass").get<unsigned>()};
+                    node_desc.queue_affinity = static_cast<RenderPassQueueAffinity>(node_json.at("queue_affinity").get<unsigned>());
+                    out_snapshot.pass_types[node_handle.value] = static_cast<RenderPassType>(node_json.at("pass_type").get<unsigned>());
+                    const auto render_area = node_json.at("render_area").get<std::vector<int>>();
+                    if (render_area.size() != 4)
+                    {
+                        out_error = "Invalid render area in planning snapshot " + path;
+                        return false;
+                    }
+                    node_desc.viewport_rect = {render_area[0], render_area[1], render_area[2], render_area[3]};
+                    for (const auto& dependency_json : node_json.at("dependencies"))
+                    {
+                        node_desc.dependency_render_graph_nodes.push_back(RenderGraphNodeHandle{dependency_json.get<unsigned>()});
+                    }
 
-        RHIPrimitiveTopologyType ConvertToRHIPrimitiveTopology(PrimitiveTopology topology)
-        {
-            switch (topology)
+                    auto& draw_info = node_desc.draw_info;
+                    for (const auto& buffer_json : node_json.at("buffers"))
+                    {
+                        auto& binding = draw_info.buffer_resources[buffer_json.at("name").get<std::string>()];
+                        binding.buffer_handle = BufferHandle{buffer_json.at("handle").get<unsigned>()};
+                        binding.binding_type = static_cast<BufferBindingDesc::BufferBindingType>(buffer_json.at("type").get<unsigned>());
+                    }
+                    for (const auto& texture_json : node_json.at("textures"))
+                    {
+                        auto& binding = draw_info.texture_resources[texture_json.at("name").get<std::string>()];
+                        for (const auto& handle_json : texture_json.at("handles"))
+                        {
+                            binding.textures.push_back(TextureHandle{handle_json.get<unsigned>()});
+                        }
+                        binding.type = static_cast<TextureBindingDesc::TextureBindingType>(texture_json.at("type").get<unsigned>());
+                    }
+                    for (const auto& render_target_texture_json : node_json.at("render_target_textures"))
+                    {
+                        auto& binding = draw_info.render_target_texture_resources[render_target_texture_json.at("name").get<std::string>()];
+                        binding.name = render_target_texture_json.at("name").get<std::string>();
+                        for (const auto& handle_json : render_target_texture_json.at("handles"))
+                        {
+                            binding.render_target_texture.push_back(RenderTargetHandle{handle_json.get<unsigned>()});
+                        }
+                        binding.type = static_cast<RenderTargetTextureBindingDesc::TextureBindingType>(render_target_texture_json.at("type").get<unsigned>());
+                    }
+                    for (const auto& attachment_json : node_json.at("attachments"))
+                    {
+                        auto& binding = draw_info.render_target_resources[RenderTargetHandle{attachment_json.at("handle").get<unsigned>()}];
+                        binding.usage = static_cast<RenderPassResourceUsage>(attachment_json.at("usage").get<unsigned>());
+                        binding.load_op = static_cast<RenderPassAttachmentLoadOp>(attachment_json.at("load_op").get<unsigned>());
+                        binding.store_op = static_cast<RenderPassAttachmentStoreOp>(attachment_json.at("store_op").get<unsigned>());
+                        binding.need_clear = attachment_json.at("need_clear").get<bool>();
+                    }
+                    out_snapshot.barrier_state_requests[node_handle.value] =
+                        node_json.at("barrier_states").get<std::vector<std::pair<unsigned long long, unsigned>>>();
+                }
+            }
+            catch (const std::exception& exception)
             {
-            case PrimitiveTopology::TRIANGLE_LIST:
-                return RHIPrimitiveTopologyType::TRIANGLELIST;
+                out_error = "Invalid planning snapshot " + path + ": " + exception.what();
+                return false;
             }
 
-            GLTF_CHECK(false);
-            return RHIPrimitiveTopologyType::TRIANGLELIST;
+            return true;
         }
-    }
 
-    RenderWindow::RenderWindow(const RenderWindowDesc& desc)
-        : m_desc(desc)
-        , m_handle(NULL_HANDLE)
-        , m_hwnd(nullptr)
-    {
-        glTFWindow::Get().SetWidth(desc.width);
-        glTFWindow::Get().SetHeight(desc.height);
-        
-        glTFWindow::Get().InitAndShowWindow();
-        m_hwnd = glTFWindow::Get().GetHWND();
-        m_handle = InternalResourceHandleTable::Instance().RegisterWindow(*this);
-        
-        m_input_device = std::make_shared<RendererInputDevice>();
-        glTFWindow::Get().SetInputManager(m_input_device);
+        struct ExecutionPlanBuildResult
+        {
+            DependencyEdgeList combined_edges;
+            bool has_invalid_explicit_dependency{false};
+            std::vector<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>> invalid_explicit_dependencies;
+            std::size_t auto_merged_dependency_count{0};
+            std::size_t signature{0};
+            bool execution_cache_key_changed{false};
+            bool cached_execution_order_valid{false};
+            bool graph_just_became_invalid{false};
+            bool need_rebuild_execution_order{false};
+        };
 
-        // Register window callback
-        GLTF_CHECK(glTFWindow::Get().RegisterCallbackEventNative());
-    }
+        struct ResourceAccessPlanResult
+        {
+            DependencyEdgeList inferred_edges;
+            std::size_t auto_merged_dependency_count{0};
+        };
 
-    RenderWindowHandle RenderWindow::GetHandle() const
-    {
-        return m_handle;
-    }
+        ResourceAccessPlanResult CollectResourceAccessPlan(const RenderGraph::ExecutionPlanContext& context)
+        {
+            std::vector<ResourceAccessEntry> resource_accesses;
+            CollectResourceAccessEntries(context.nodes, context.render_graph_nodes, resource_accesses);
 
-    unsigned RenderWindow::GetWidth() const
-    {
-        return static_cast<unsigned>(glTFWindow::Get().GetWidth());
-    }
+            ResourceAccessPlanResult result{};
+            BuildResourceInferredEdges(resource_accesses, result.inferred_edges, nullptr);
 
-    unsigned RenderWindow::GetHeight() const
-    {
-        return static_cast<unsigned>(glTFWindow::Get().GetHeight());
-    }
+            for (const auto& edge : result.inferred_edges.edges)
+            {
+                const auto from = edge.first;
+                const auto to = edge.second;
+                if (!to.IsValid() || to.value >= context.render_graph_nodes.size())
+                {
+                    continue;
+                }
 
-    HWND RenderWindow::GetHWND() const
-    {
-        return glTFWindow::Get().GetHWND();
-    }
+                const auto& to_desc = context.render_graph_nodes[to.value];
+                if (!HasDependency(to_desc, from))
+                {
+                    ++result.auto_merged_dependency_count;
+                }
+            }
 
-    void RenderWindow::EnterWindowEventLoop()
-    {
-        glTFWindow::Get().UpdateWindow();
-    }
+            return result;
+        }
 
-    RenderWindow::WindowLoopTiming RenderWindow::GetLastLoopTiming() const
+        struct DependencyValidationResult
+        {
+            DependencyEdgeList combined_edges;
+            bool has_invalid_explicit_dependency{false};
+            std::vector<std::pair<RenderGraphNodeHandle, RenderGraphNodeHandle>> invalid_explicit_dependencies;
+        };
+
+        DependencyValidationResult ValidateDependencyPlan(
+            const RenderGraph::ExecutionPlanContext& context,
+            const DependencyEdgeList& inferred_edges)
+        {
+            DependencyValidationResult result{};
+            result.combined_edges = inferred_edges;
+
+            for (auto handle : context.nodes)
+            {
+                const auto& node_desc = context.render_graph_nodes[handle.value];
+                for (const auto dep : node_desc.dependency_render_graph_nodes)
+                {
+                    const bool valid_dep = dep.IsValid() &&
+                        dep != handle &&
+                        dep.value < context.render_graph_nodes.size() &&
+                        context.registered_nodes.contains(dep);
+                    if (!valid_dep)
+                    {
+                        result.has_invalid_explicit_dependency = true;
+                        result.invalid_explicit_dependencies.emplace_back(dep, handle);
+                        continue;
+                    }
+                    result.combined_edges.Add(dep, handle);
+                }
+            }
+            result.combined_edges.Normalize();
+
+            return result;
+        }
+
+        ExecutionPlanBuildResult BuildExecutionPlan(const RenderGraph::ExecutionPlanContext& context)
+        {
+            const auto access_plan = CollectResourceAccessPlan(context);
+            const auto dependency_validation = ValidateDependencyPlan(context, access_plan.inferred_edges);
+
+            ExecutionPlanBuildResult result{};
+            result.combined_edges = dependency_validation.combined_edges;
+            result.has_invalid_explicit_dependency = dependency_validation.has_invalid_explicit_dependency;
+            result.invalid_explicit_dependencies = dependency_validation.invalid_explicit_dependencies;
+            result.auto_merged_dependency_count = access_plan.auto_merged_dependency_count;
+
+            result.signature = ComputeExecutionSignature(context.nodes, context.render_graph_nodes, result.combined_edges);
+            result.execution_cache_key_changed =
+                result.signature != context.cached_execution_signature || context.cached_execution_node_count != context.nodes.size();
+            result.cached_execution_order_valid = ValidateExecutionOrder(context.nodes, result.combined_edges, context.cached_execution_order);
+            result.graph_just_became_invalid = result.has_invalid_explicit_dependency && context.cached_execution_graph_valid;
+            result.need_rebuild_execution_order =
+                result.execution_cache_key_changed ||
+                result.graph_just_became_invalid ||
+                (context.cached_execution_graph_valid && !result.cached_execution_order_valid);
+
+            return result;
+        }
+
+        std::vector<RenderGraphNodeHandle> ApplyExecutionPlanResult(
+            const RenderGraph::ExecutionPlanContext& context,
+            const ExecutionPlanBuildResult& plan,
+            RenderGraph::ExecutionPlanCacheState& io_cache_state)
+        {
+            std::vector<RenderGraphNodeHandle> rebuilt_cycle_nodes;
+            if (plan.need_rebuild_execution_order)
+            {
+                if (!plan.execution_cache_key_changed && !plan.graph_just_became_invalid && !plan.cached_execution_order_valid)
+                {
+                    LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Cached execution order validation failed. Rebuilding execution order.\n");
+                }
+
+                io_cache_state.cached_execution_signature = plan.signature;
+                io_cache_state.cached_execution_node_count = context.nodes.size();
+
+                {
+                    static bool s_has_auto_merge_log_state = false;
+                    static std::size_t s_last_auto_merged_dependency_count = 0;
+                    static std::chrono::steady_clock::time_point s_last_auto_merge_log_time{};
+                    if (plan.auto_merged_dependency_count > 0)
+                    {
+                        const auto now = std::chrono::steady_clock::now();
+                        constexpr auto auto_merge_log_min_interval = std::chrono::seconds(5);
+                        const bool count_changed =
+                            !s_has_auto_merge_log_state ||
+                            s_last_auto_merged_dependency_count != plan.auto_merged_dependency_count;
+                        const bool interval_elapsed =
+                            !s_has_auto_merge_log_state ||
+                            (now - s_last_auto_merge_log_time) >= auto_merge_log_min_interval;
+                        if (count_changed || interval_elapsed)
+                        {
+                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Auto-merged %zu inferred dependencies into execution plan.\n",
+                                plan.auto_merged_dependency_count);
+                            s_last_auto_merge_log_time = now;
+                        }
+                    }
+
+                    s_has_auto_merge_log_state = true;
+                    s_last_auto_merged_dependency_count = plan.auto_merged_dependency_count;
+                }
+
+                if (plan.has_invalid_explicit_dependency)
+                {
+                    io_cache_state.cached_execution_graph_valid = false;
+                    io_cache_state.cached_execution_order.clear();
+                    LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Invalid explicit dependencies detected (%zu). Skip frame graph execution.\n",
+                        plan.invalid_explicit_dependencies.size());
+                    for (const auto& invalid_dep : plan.invalid_explicit_dependencies)
+                    {
+                        const auto from = invalid_dep.first;
+                        const auto to = invalid_dep.second;
+                        if (from.IsValid())
+                        {
+                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   invalid edge: %u -> %u\n", from.value, to.value);
+                        }
+                        else
+                        {
+                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   invalid edge: <INVALID> -> %u\n", to.value);
+                        }
+                    }
+                }
+                else
+                {
+                    std::vector<RenderGraphNodeHandle> execution_nodes;
+                    std::vector<RenderGraphNodeHandle> cycle_nodes;
+                    const bool sorted = TopologicalSortExecutionNodes(context.nodes, plan.combined_edges, execution_nodes, &cycle_nodes);
+                    if (!sorted)
+                    {
+                        io_cache_state.cached_execution_graph_valid = false;
+                        io_cache_state.cached_execution_order.clear();
+                        rebuilt_cycle_nodes = cycle_nodes;
+                        LOG_FORMAT_FLUSH("[RenderGraph][Dependency] Cycle detected in combined dependencies. Skip frame graph execution. Nodes:");
+                        for (const auto cycle_node : cycle_nodes)
+                        {
+                            LOG_FORMAT_FLUSH(" %u", cycle_node.value);
+                        }
+                        LOG_FORMAT_FLUSH("\n");
+                        for (const auto cycle_node : cycle_nodes)
+                        {
+                            const auto& node_desc = context.render_graph_nodes[cycle_node.value];
+                            const char* group_name = node_desc.debug_group.empty() ? "<group-empty>" : node_desc.debug_group.c_str();
+                            const char* pass_name = node_desc.debug_name.empty() ? "<pass-empty>" : node_desc.debug_name.c_str();
+                            LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   cycle node %u = (%s/%s)\n",
+                                             cycle_node.value,
+                                             group_name,
+                                             pass_name);
+                        }
+
+                        std::set<RenderGraphNodeHandle> cycle_node_set(cycle_nodes.begin(), cycle_nodes.end());
+                        std::vector<ResourceAccessEntry> resource_accesses;
+                        CollectResourceAccessEntries(context.nodes, context.render_graph_nodes, resource_accesses);
+                        DependencyEdgeList inferred_edges_for_debug;
+                        DependencyEdgeResourceMap inferred_edge_resources_for_debug;
+                        BuildResourceInferredEdges(
+                            resource_accesses,
+                            inferred_edges_for_debug,
+                            &inferred_edge_resources_for_debug);
+
+                        const auto log_resource_key = [](const ResourceKey& key)
+                        {
+                            LOG_FORMAT_FLUSH(" %s:%llu", ToResourceKindName(key.kind), key.value);
+                        };
+
+                        for (const auto cycle_from : cycle_nodes)
+                        {
+                            const auto [edges_begin, edges_end] = plan.combined_edges.EdgesFrom(cycle_from);
+                            for (auto edge_it = edges_begin; edge_it != edges_end; ++edge_it)
+                            {
+                                const auto cycle_to = edge_it->second;
+                                if (!cycle_node_set.contains(cycle_to))
+                                {
+                                    continue;
+                                }
+
+                                LOG_FORMAT_FLUSH("[RenderGraph][Dependency]   cycle edge %u -> %u", cycle_from.value, cycle_to.value);
+                                const auto resource_it = inferred_edge_resources_for_debug.find({cycle_from, cycle_to});
+                                if (resource_it == inferred_edge_resources_for_debug.end())
+                                {
+                                    LOG_FORMAT_FLUSH(" (explicit)\n");
+                                    continue;
+                                }
+
+                                const auto& resources = resource_it->second;
+                                LOG_FORMAT_FLUSH(" (inferred resources:");
+                                const size_t max_resource_print_count = (std::min)(resources.size(), static_cast<size_t>(8));
+                                for (size_t resource_index = 0; resource_index < max_resource_print_count; ++resource_index)
+                                {
+                                    log_resource_key(resources[resource_index]);
+                                }
+                                if (resources.size() > max_resource_print_count)
+                                {
+                                    LOG_FORMAT_FLUSH(" ...");
+                                }
+                                LOG_FORMAT_FLUSH(")\n");
+                            }
+                        }
+                    }
+                    else
+                    {
+                        io_cache_state.cached_execution_graph_valid = true;
+                        io_cache_state.cached_execution_order = std::move(execution_nodes);
+                        rebuilt_cycle_nodes.clear();
+                    }
+                }
+            }
+
+            if (plan.has_invalid_explicit_dependency || io_cache_state.cached_execution_graph_valid)
+            {
+                return {};
+            }
+            if (plan.need_rebuild_execution_order)
+            {
+                return rebuilt_cycle_nodes;
+            }
+
+            return {};
+        }
+
+        void UpdateDependencyDiagnostics(
+            const RenderGraph::ExecutionPlanContext& context,
+            const ExecutionPlanBuildResult& plan,
+            bool cached_execution_graph_valid,
+            std::size_t cached_execution_signature,
+            std::size_t cached_execution_node_count,
+            std::size_t cached_execution_order_size,
+            std::vector<RenderGraphNodeHandle>&& cycle_nodes,
+            const std::map<RenderGraphNodeHandle, std::tuple<unsigned, unsigned, unsigned>>& auto_pruned_named_binding_counts,
+            const ResourceAccessMaskMap& previous_frame_resource_access_masks,
+            const ResourcePassAccessMap& previous_frame_resource_pass_accesses,
+            bool has_previous_frame_resource_access_masks,
+            unsigned cross_frame_comparison_window_size,
+            unsigned cross_frame_compared_frame_count,
+            const ResourceAccessMaskMap& current_frame_resource_access_masks,
+            const ResourcePassAccessMap& current_frame_resource_pass_accesses,
+            RenderGraph::DependencyDiagnostics& out_diagnostics)
+        {
+            out_diagnostics.graph_valid = cached_execution_graph_valid;
+            out_diagnostics.has_invalid_explicit_dependencies = plan.has_invalid_explicit_dependency;
+            out_diagnostics.auto_merged_dependency_count = static_cast<unsigned>(plan.auto_merged_dependency_count);
+            out_diagnostics.invalid_explicit_dependencies = plan.invalid_explicit_dependencies;
+            out_diagnostics.execution_signature = cached_execution_signature;
+            out_diagnostics.cached_execution_node_count = cached_execution_node_count;
+            out_diagnostics.cached_execution_order_size = cached_execution_order_size;
+            if (plan.has_invalid_explicit_dependency || cached_execution_graph_valid)
+            {
+                out_diagnostics.cycle_nodes.clear();
+            }
+            else if (plan.need_rebuild_execution_order)
+            {
+                out_diagnostics.cycle_nodes = std::move(cycle_nodes);
+            }
+
+            out_diagnostics.auto_pruned_binding_count = 0;
+            out_diagnostics.auto_pruned_node_count = 0;
+            out_diagnostics.auto_pruned_nodes.clear();
+            for (const auto node_handle : context.nodes)
+            {
+                const auto pruned_count_it = auto_pruned_named_binding_counts.find(node_handle);
+                if (pruned_count_it == auto_pruned_named_binding_counts.end())
+                {
+                    continue;
+                }
+
+                const auto [buffer_count, texture_count, render_target_texture_count] = pruned_count_it->second;
+                const unsigned total_count = buffer_count + texture_count + render_target_texture_count;
+                if (total_count == 0)
+                {
+                    continue;
+                }
+
+                ++out_diagnostics.auto_pruned_node_count;
+                out_diagnostics.auto_pruned_binding_count += total_count;
+
+                RenderGraph::DependencyDiagnostics::AutoPrunedNodeDiagnostics node_diagnostics{};
+                node_diagnostics.node_handle = node_handle;
+                const auto& node_desc = context.render_graph_nodes[node_handle.value];
+                node_diagnostics.group_name = node_desc.debug_group.empty() ? "<group-empty>" : node_desc.debug_group;
+                node_diagnostics.pass_name = node_desc.debug_name.empty() ? "<pass-empty>" : node_desc.debug_name;
+                node_diagnostics.buffer_count = buffer_count;
+                node_diagnostics.texture_count = texture_count;
+                node_diagnostics.render_target_texture_count = render_target_texture_count;
+                out_diagnostics.auto_pruned_nodes.push_back(std::move(node_diagnostics));
+            }
+
+            out_diagnostics.cross_frame_analysis_ready = has_previous_frame_resource_access_masks;
+            out_diagnostics.cross_frame_comparison_window_size = cross_frame_comparison_window_size;
+            out_diagnostics.cross_frame_compared_frame_count = cross_frame_compared_frame_count;
+            out_diagnostics.cross_frame_hazard_count = 0;
+            out_diagnostics.cross_frame_hazard_overflow_count = 0;
+            out_diagnostics.cross_frame_hazards.clear();
+            if (!has_previous_frame_resource_access_masks)
+            {
+                return;
+            }
+
+            const auto record_hazard = [
+                &out_diagnostics,
+                &previous_frame_resource_pass_accesses,
+                &current_frame_resource_pass_accesses
+            ](
+                unsigned long long encoded_resource_key,
+                RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType hazard_type,
+                bool use_previous_writers,
+                bool use_current_writers)
+            {
+                ++out_diagnostics.cross_frame_hazard_count;
+                if (out_diagnostics.cross_frame_hazards.size() >= MAX_CROSS_FRAME_HAZARDS_RECORDED)
+                {
+                    ++out_diagnostics.cross_frame_hazard_overflow_count;
+                    return;
+                }
+
+                constexpr unsigned long long kind_shift = 62ull;
+                const auto encoded_kind = static_cast<unsigned>(encoded_resource_key >> kind_shift);
+                const auto resource_kind = static_cast<ResourceKind>(encoded_kind);
+                RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics hazard{};
+                hazard.hazard_type = hazard_type;
+                hazard.resource_kind = ToResourceKindName(resource_kind);
+                hazard.resource_id = static_cast<unsigned>(encoded_resource_key & 0xffffffffULL);
+
+                const auto previous_access_it = previous_frame_resource_pass_accesses.find(encoded_resource_key);
+                if (previous_access_it != previous_frame_resource_pass_accesses.end())
+                {
+                    hazard.previous_passes = use_previous_writers
+                        ? previous_access_it->second.second
+                        : previous_access_it->second.first;
+                }
+
+                const auto current_access_it = current_frame_resource_pass_accesses.find(encoded_resource_key);
+                if (current_access_it != current_frame_resource_pass_accesses.end())
+                {
+                    hazard.current_passes = use_current_writers
+                        ? current_access_it->second.second
+                        : current_access_it->second.first;
+                }
+
+                out_diagnostics.cross_frame_hazards.push_back(std::move(hazard));
+            };
+
+            for (const auto& current_pair : current_frame_resource_access_masks)
+            {
+                const auto previous_it = previous_frame_resource_access_masks.find(current_pair.first);
+                if (previous_it == previous_frame_resource_access_masks.end())
+                {
+                    continue;
+                }
+
+                const unsigned char previous_mask = previous_it->second;
+                const unsigned char current_mask = current_pair.second;
+                if ((previous_mask & RESOURCE_ACCESS_MASK_WRITE) != 0 && (current_mask & RESOURCE_ACCESS_MASK_READ) != 0)
+                {
+                    record_hazard(
+                        current_pair.first,
+                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_WRITE_CURRENT_READ,
+                        true,
+                        false);
+                }
+                if ((previous_mask & RESOURCE_ACCESS_MASK_WRITE) != 0 && (current_mask & RESOURCE_ACCESS_MASK_WRITE) != 0)
+                {
+                    record_hazard(
+                        current_pair.first,
+                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_WRITE_CURRENT_WRITE,
+                        true,
+                        true);
+                }
+                if ((previous_mask & RESOURCE_ACCESS_MASK_READ) != 0 && (current_mask & RESOURCE_ACCESS_MASK_WRITE) != 0)
+                {
+                    record_hazard(
+                        current_pair.first,
+                        RenderGraph::DependencyDiagnostics::CrossFrameResourceHazardDiagnostics::HazardType::PREVIOUS_READ_CURRENT_WRITE,
+                        false,
+                        true);
+                }
+            }
+        }
+
+        unsigned long long ComputeBufferDescriptorCacheKey(const BufferBindingDesc& binding_desc, std::uintptr_t buffer_identity_key)
+        {
+            std::size_t seed = 1469598103934665603ULL;
+            HashCombine(seed, static_cast<std::size_t>(binding_desc.binding_type));
+            HashCombine(seed, static_cast<std::size_t>(buffer_identity_key));
+            HashCombine(seed, static_cast<std::size_t>(binding_desc.stride));
+            HashCombine(seed, static_cast<std::size_t>(binding_desc.count));
+            HashCombine(seed, binding_desc.is_structured_buffer ? 1u : 0u);
+            HashCombine(seed, binding_desc.use_count_buffer ? 1u : 0u);
+            HashCombine(seed, static_cast<std::size_t>(binding_desc.count_buffer_offset));
+            return static_cast<unsigned long long>(seed);
+        }
+
+        unsigned long long ComputeTextureDescriptorCacheKey(unsigned binding_type, const std::vector<std::uintptr_t>& source_texture_identity_keys)
+        {
+            std::size_t seed = 1469598103934665603ULL;
+            HashCombine(seed, static_cast<std::size_t>(binding_type));
+            HashCombine(seed, source_texture_identity_keys.size());
+            for (const auto source_texture_identity_key : source_texture_identity_keys)
+            {
+                HashCombine(seed, static_cast<std::size_t>(source_texture_identity_key));
+            }
+            return static_cast<unsigned long long>(seed);
+        }
+
+        std::vector<std::uintptr_t> BuildTextureSourceIdentityKeys(const TextureBindingDesc& binding_desc)
+        {
+            std::vector<std::uintptr_t> source_texture_identity_keys;
+            source_texture_identity_keys.reserve(binding_desc.textures.size());
+            for (const auto texture_handle : binding_desc.textures)
+            {
+                const auto texture_allocation = InternalResourceHandleTable::Instance().GetTexture(texture_handle);
+                if (texture_allocation && texture_allocation->m_texture)
+                {
+                    source_texture_identity_keys.push_back(reinterpret_cast<std::uintptr_t>(texture_allocation->m_texture.get()));
+                }
+                else
+                {
+                    source_texture_identity_keys.push_back(static_cast<std::uintptr_t>(texture_handle.value));
+                }
+            }
+            return source_texture_identity_keys;
+        }
+
+        std::vector<std::uintptr_t> BuildRenderTargetTextureSourceIdentityKeys(const RenderTargetTextureBindingDesc& binding_desc)
+        {
+            std::vector<std::uintptr_t> source_texture_identity_keys;
+            source_texture_identity_keys.reserve(binding_desc.render_target_texture.size());
+            for (const auto render_target_handle : binding_desc.render_target_texture)
+            {
+                source_texture_identity_keys.push_back(static_cast<std::uintptr_t>(ResolveRenderTargetResourceIdentity(render_target_handle)));
+            }
+            return source_texture_identity_keys;
+        }
+
+        RHIPrimitiveTopologyType ConvertToRHIPrimitiveTopology(PrimitiveTopology topology)
+        {
+            switch (topology)
+            {
+            case PrimitiveTopology::TRIANGLE_LIST:
+                return RHIPrimitiveTopologyType::TRIANGLELIST;
+            }
+
+            GLTF_CHECK(false);
+            return RHIPrimitiveTopologyType::TRIANGLELIST;
+        }
+
+        struct BarrierResource
+        {
+            IRHITexture* texture{nullptr};
+            IRHIBuffer* buffer{nullptr};
+
+            RHIResourceStateType GetState() const
+            {
+                return texture ? texture->GetState() : buffer->GetState();
+            }
+
+            void SetState(RHIResourceStateType state) const
+            {
+                if (texture)
+                {
+                    texture->SetState(state);
+                }
+                else
+                {
+                    buffer->SetState(state);
+                }
+            }
+        };
+
+        BarrierResource ResolveBarrierResource(unsigned long long resource_key)
+        {
+            constexpr unsigned long long kind_shift = 62ull;
+            constexpr unsigned long long value_mask = (1ull << kind_shift) - 1ull;
+            const auto kind = static_cast<ResourceKind>(resource_key >> kind_shift);
+            const unsigned handle_value = static_cast<unsigned>(resource_key & value_mask);
+
+            BarrierResource resource{};
+            switch (kind)
+            {
+            case ResourceKind::Buffer:
+                {
+                    const auto buffer_allocation = InternalResourceHandleTable::Instance().GetBuffer(BufferHandle{handle_value});
+                    resource.buffer = buffer_allocation ? buffer_allocation->m_buffer.get() : nullptr;
+                }
+                break;
+            case ResourceKind::Texture:
+                {
+                    const auto texture_allocation = InternalResourceHandleTable::Instance().GetTexture(TextureHandle{handle_value});
+                    resource.texture = texture_allocation ? texture_allocation->m_texture.get() : nullptr;
+                }
+                break;
+            case ResourceKind::RenderTarget:
+                {
+                    const auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(RenderTargetHandle{handle_value});
+                    resource.texture = render_target ? render_target->m_source.get() : nullptr;
+                }
+                break;
+            }
+            return resource;
+        }
+
+        // Plans against the RHI resources the handles resolve to this frame, so two handles sharing a
+        // resource are tracked as one.
+        RenderGraphBarrierPlanner::Plan BuildFrameBarrierPlan(
+            const std::vector<std::vector<std::pair<unsigned long long, unsigned>>>& state_requests,
+            std::map<unsigned long long, BarrierResource>& out_resources)
+        {
+            std::vector<std::vector<RenderGraphBarrierPlanner::StateRequest>> execution_steps;
+            execution_steps.reserve(state_requests.size());
+            for (const auto& step_requests : state_requests)
+            {
+                auto& step = execution_steps.emplace_back();
+                step.reserve(step_requests.size());
+                for (const auto& state_request : step_requests)
+                {
+                    const auto resource = ResolveBarrierResource(state_request.first);
+                    if (!resource.texture && !resource.buffer)
+                    {
+                        continue;
+                    }
+
+                    const unsigned long long resource_id = resource.texture
+                        ? reinterpret_cast<unsigned long long>(resource.texture)
+                        : reinterpret_cast<unsigned long long>(resource.buffer);
+                    out_resources[resource_id] = resource;
+                    // Buffers and scene textures may be re-uploaded between passes by callbacks; only render
+                    // targets are owned by the graph for the whole frame.
+                    const bool allow_split =
+                        static_cast<ResourceKind>(state_request.first >> 62ull) == ResourceKind::RenderTarget;
+                    step.push_back({resource_id, state_request.second, allow_split});
+                }
+            }
+
+            return RenderGraphBarrierPlanner::BuildPlan(execution_steps);
+        }
+
+        // Resets the diagnostics for a new frame; the plan stays empty while the requests are stale.
+        RenderGraphBarrierPlanner::Plan BuildFrameBarrierPlan(
+            const std::vector<std::vector<std::pair<unsigned long long, unsigned>>>& state_requests,
+            std::size_t execution_step_count,
+            std::map<unsigned long long, BarrierResource>& out_resources,
+            RenderGraph::BarrierPlanDiagnostics& out_diagnostics)
+        {
+            out_diagnostics = {};
+            if (state_requests.size() != execution_step_count)
+            {
+                return {};
+            }
+
+            auto plan = BuildFrameBarrierPlan(state_requests, out_resources);
+            out_diagnostics.valid = true;
+            out_diagnostics.planned_full_barrier_count = plan.full_barrier_count;
+            out_diagnostics.planned_split_barrier_count = plan.split_barrier_count;
+            out_diagnostics.conflicting_request_count = plan.conflicting_request_count;
+            return plan;
+        }
+
+        // before_texture is null when the range held several textures or ones of an earlier frame.
+        struct AliasingBarrierDesc
+        {
+            IRHITexture* before_texture{nullptr};
+            IRHITexture* after_texture{nullptr};
+        };
+
+        // Resolves the handles of step_barriers to the textures they stand for this frame.
+        std::vector<std::vector<AliasingBarrierDesc>> ResolveAliasingBarriers(
+            const std::vector<std::vector<AliasingBarrierRequest>>& step_barriers)
+        {
+            std::vector<std::vector<AliasingBarrierDesc>> result(step_barriers.size());
+            for (size_t step_index = 0; step_index < step_barriers.size(); ++step_index)
+            {
+                for (const auto& request : step_barriers[step_index])
+                {
+                    AliasingBarrierDesc barrier{};
+                    barrier.after_texture = ResolveBarrierResource(request.after_resource_key).texture;
+                    if (!barrier.after_texture)
+                    {
+                        continue;
+                    }
+                    if (request.before_known)
+                    {
+                        barrier.before_texture = ResolveBarrierResource(request.before_resource_key).texture;
+                    }
+                    result[step_index].push_back(barrier);
+                }
+            }
+            return result;
+        }
+
+        struct BarrierBatch
+        {
+            // Recorded ahead of the transitions of the batch.
+            std::vector<AliasingBarrierDesc> aliasing_barriers;
+            std::vector<RHITextureBarrierDesc> texture_barriers;
+            std::vector<RHIBufferBarrierDesc> buffer_barriers;
+        };
+
+        void RecordBarrierBatch(RHIUtils& utils, IRHICommandList& command_list, const BarrierBatch& batch)
+        {
+            for (const auto& aliasing_barrier : batch.aliasing_barriers)
+            {
+                GLTF_CHECK(utils.AddAliasingBarrier(command_list, aliasing_barrier.before_texture, *aliasing_barrier.after_texture));
+            }
+            if (!batch.texture_barriers.empty() || !batch.buffer_barriers.empty())
+            {
+                GLTF_CHECK(utils.AddBarriersToCommandList(command_list, batch.texture_barriers, batch.buffer_barriers));
+            }
+        }
+
+        void RecordBarrierBatches(IRHICommandList& command_list, const std::vector<BarrierBatch>& batches)
+        {
+            for (const auto& batch : batches)
+            {
+                RecordBarrierBatch(RHIUtilInstanceManager::Instance(), command_list, batch);
+            }
+        }
+
+        // The plan skips conflicting requests and may be stale; whatever a prepared pass still needs is
+        // transitioned like Transition() would on a serial list. A resource appears at most once per batch.
+        template <typename PreparedNode>
+        void AppendMissingTransitions(const PreparedNode& prepared_node, std::vector<BarrierBatch>& batches, RenderGraph::BarrierPlanDiagnostics& diagnostics)
+        {
+            BarrierBatch batch{};
+            std::set<const void*> batch_resources;
+            const auto append_transition = [&](const auto& resource_state)
+            {
+                const BarrierResource resource{resource_state.texture, resource_state.buffer};
+                const auto current_state = resource.GetState();
+                if (current_state == resource_state.state)
+                {
+                    return;
+                }
+
+                const void* resource_key = resource.texture
+                    ? static_cast<const void*>(resource.texture)
+                    : static_cast<const void*>(resource.buffer);
+                if (!batch_resources.insert(resource_key).second)
+                {
+                    batches.push_back(std::move(batch));
+                    ++diagnostics.recorded_batch_count;
+                    batch = {};
+                    batch_resources = {resource_key};
+                }
+                if (resource.texture)
+                {
+                    batch.texture_barriers.push_back({resource.texture, current_state, resource_state.state, RHIBarrierSplitType::NONE});
+                }
+                else
+                {
+                    batch.buffer_barriers.push_back({resource.buffer, current_state, resource_state.state, RHIBarrierSplitType::NONE});
+                }
+                resource.SetState(resource_state.state);
+                ++diagnostics.recorded_barrier_count;
+            };
+
+            for (const auto& descriptor_binding : prepared_node.descriptor_bindings)
+            {
+                for (const auto& resource_state : descriptor_binding.resource_states)
+                {
+                    append_transition(resource_state);
+                }
+            }
+            for (const auto& resource_state : prepared_node.attachment_states)
+            {
+                append_transition(resource_state);
+            }
+            if (!batch_resources.empty())
+            {
+                batches.push_back(std::move(batch));
+                ++diagnostics.recorded_batch_count;
+            }
+        }
+
+        // Records a barrier plan against the live resource states: planned transitions the resource already
+        // satisfies are elided, split transitions stay pending until their end half or the frame flush.
+        // While capturing, batches are stored instead of recorded so another thread can replay them later;
+        // tracked states are still updated immediately.
+        class BarrierPlanRecorder
+        {
+        public:
+            BarrierPlanRecorder(
+                IRHICommandList& command_list,
+                const RenderGraphBarrierPlanner::Plan& plan,
+                const std::map<unsigned long long, BarrierResource>& resources,
+                RenderGraph::BarrierPlanDiagnostics& diagnostics)
+                : m_command_list(command_list)
+                , m_plan(plan)
+                , m_resources(resources)
+                , m_diagnostics(diagnostics)
+            {
+            }
+
+            void CaptureInto(std::vector<BarrierBatch>* batches)
+            {
+                m_capture_batches = batches;
+            }
+
+            // Splits whose halves land in different command list segments are recorded as full barriers.
+            void SetStepSegments(const std::vector<unsigned>* step_segments)
+            {
+                m_step_segments = step_segments;
+            }
+
+            // Records through the given utils instead of the ones of the selected graphics API.
+            void SetUtils(RHIUtils* utils)
+            {
+                m_utils = utils;
+            }
+
+            // Per step, the placed textures taking over heap memory right before it; recorded ahead of its
+            // transitions. The activated textures keep their tracked states.
+            void SetAliasingBarriers(const std::vector<std::vector<AliasingBarrierDesc>>* aliasing_barriers)
+            {
+                m_aliasing_barriers = aliasing_barriers;
+            }
+
+            void RecordBeforePass(unsigned step_index)
+            {
+                // Placed textures need their aliasing barriers even when the transition plan is stale.
+                if (m_aliasing_barriers && step_index < m_aliasing_barriers->size())
+                {
+                    for (const auto& aliasing_barrier : (*m_aliasing_barriers)[step_index])
+                    {
+                        m_batch.aliasing_barriers.push_back(aliasing_barrier);
+                        ++m_diagnostics.recorded_aliasing_barrier_count;
+                    }
+                }
+                if (step_index >= m_plan.passes.size())
+                {
+                    Record();
+                    return;
+                }
+                for (const auto& barrier : m_plan.passes[step_index].before_pass)
+                {
+                    const auto& resource = m_resources.at(barrier.resource_id);
+                    const auto after_state = static_cast<RHIResourceStateType>(barrier.after_state);
+                    if (barrier.type == RenderGraphBarrierPlanner::BarrierType::SPLIT_END)
+                    {
+                        const auto pending_it = m_pending_splits.find(barrier.resource_id);
+                        if (pending_it != m_pending_splits.end())
+                        {
+                            AppendEndSplit(pending_it->first, pending_it->second);
+                            m_pending_splits.erase(pending_it);
+                            continue;
+                        }
+                    }
+
+                    const auto current_state = resource.GetState();
+                    if (current_state == after_state)
+                    {
+                        ++m_diagnostics.elided_barrier_count;
+                        continue;
+                    }
+                    Append(resource, current_state, after_state, RHIBarrierSplitType::NONE);
+                    m_state_updates.emplace_back(resource, after_state);
+                }
+                Record();
+            }
+
+            void RecordAfterPass(unsigned step_index)
+            {
+                if (step_index >= m_plan.passes.size())
+                {
+                    return;
+                }
+
+                for (const auto& barrier : m_plan.passes[step_index].after_pass)
+                {
+                    const auto& resource = m_resources.at(barrier.resource_id);
+                    const auto current_state = resource.GetState();
+                    const auto after_state = static_cast<RHIResourceStateType>(barrier.after_state);
+                    if (current_state == after_state)
+                    {
+                        ++m_diagnostics.elided_barrier_count;
+                        continue;
+                    }
+
+                    if (m_step_segments && (*m_step_segments)[step_index] != (*m_step_segments)[barrier.paired_step])
+                    {
+                        Append(resource, current_state, after_state, RHIBarrierSplitType::NONE);
+                        m_state_updates.emplace_back(resource, after_state);
+                        continue;
+                    }
+
+                    // The tracked state keeps the source state until the end half is recorded.
+                    Append(resource, current_state, after_state, RHIBarrierSplitType::BEGIN_ONLY);
+                    m_pending_splits[barrier.resource_id] = {current_state, after_state};
+                    ++m_diagnostics.recorded_split_barrier_count;
+                }
+                Record();
+            }
+
+            void Flush()
+            {
+                for (const auto& pending_split : m_pending_splits)
+                {
+                    AppendEndSplit(pending_split.first, pending_split.second);
+                }
+                m_pending_splits.clear();
+                Record();
+            }
+
+        private:
+            void Append(const BarrierResource& resource, RHIResourceStateType before_state, RHIResourceStateType after_state, RHIBarrierSplitType split_type)
+            {
+                if (resource.texture)
+                {
+                    m_batch.texture_barriers.push_back({resource.texture, before_state, after_state, split_type});
+                }
+                else
+                {
+                    m_batch.buffer_barriers.push_back({resource.buffer, before_state, after_state, split_type});
+                }
+                ++m_diagnostics.recorded_barrier_count;
+            }
+
+            void AppendEndSplit(unsigned long long resource_id, const std::pair<RHIResourceStateType, RHIResourceStateType>& states)
+            {
+                const auto& resource = m_resources.at(resource_id);
+                GLTF_CHECK(resource.GetState() == states.first);
+                Append(resource, states.first, states.second, RHIBarrierSplitType::END_ONLY);
+                m_state_updates.emplace_back(resource, states.second);
+            }
+
+            void Record()
+            {
+                if (m_batch.aliasing_barriers.empty() && m_batch.texture_barriers.empty() && m_batch.buffer_barriers.empty())
+                {
+                    return;
+                }
+
+                if (m_capture_batches)
+                {
+                    m_capture_batches->push_back(m_batch);
+                }
+                else
+                {
+                    RecordBarrierBatch(m_utils ? *m_utils : RHIUtilInstanceManager::Instance(), m_command_list, m_batch);
+                }
+                for (const auto& state_update : m_state_updates)
+                {
+                    state_update.first.SetState(state_update.second);
+                }
+                ++m_diagnostics.recorded_batch_count;
+                m_batch = {};
+                m_state_updates.clear();
+            }
+
+            IRHICommandList& m_command_list;
+            const RenderGraphBarrierPlanner::Plan& m_plan;
+            const std::map<unsigned long long, BarrierResource>& m_resources;
+            RenderGraph::BarrierPlanDiagnostics& m_diagnostics;
+            std::vector<BarrierBatch>* m_capture_batches{nullptr};
+            const std::vector<unsigned>* m_step_segments{nullptr};
+            RHIUtils* m_utils{nullptr};
+            const std::vector<std::vector<AliasingBarrierDesc>>* m_aliasing_barriers{nullptr};
+            std::map<unsigned long long, std::pair<RHIResourceStateType, RHIResourceStateType>> m_pending_splits;
+            BarrierBatch m_batch;
+            std::vector<std::pair<BarrierResource, RHIResourceStateType>> m_state_updates;
+        };
+
+        // Records a replayed barrier plan through BarrierPlanRecorder into a null RHI command list, so a
+        // snapshot runs the frame's recording path and the null backend's state validation without a window,
+        // device or swap chain. Each resource key gets its own null texture or buffer, which aliasing barriers
+        // activate as if it were placed. Nothing here goes through the resource factory or the selected
+        // graphics API, so a running renderer is unaffected.
+        void RecordBarrierPlanOnNullRHI(
+            const RenderGraphBarrierPlanner::Plan& plan,
+            const std::vector<std::vector<RenderGraphBarrierPlanner::StateRequest>>& execution_steps,
+            const std::vector<std::vector<AliasingBarrierRequest>>& aliasing_step_barriers,
+            const std::map<unsigned, std::pair<unsigned, unsigned>>& render_target_extents,
+            RenderGraph::ExecutionPlanningReplayResult& out_result)
+        {
+            constexpr unsigned long long kind_shift = 62ull;
+            constexpr unsigned long long value_mask = (1ull << kind_shift) - 1ull;
+
+            std::vector<std::shared_ptr<NullTexture>> textures;
+            std::vector<std::shared_ptr<NullBuffer>> buffers;
+            std::map<unsigned long long, BarrierResource> resources;
+            for (const auto& step : execution_steps)
+            {
+                for (const auto& state_request : step)
+                {
+                    if (resources.contains(state_request.resource_id))
+                    {
+                        continue;
+                    }
+
+                    const auto kind = static_cast<ResourceKind>(state_request.resource_id >> kind_shift);
+                    const unsigned handle_value = static_cast<unsigned>(state_request.resource_id & value_mask);
+                    BarrierResource resource{};
+                    if (kind == ResourceKind::Buffer)
+                    {
+                        RHIBufferDesc buffer_desc{};
+                        buffer_desc.width = 256;
+                        buffer_desc.height = 1;
+                        buffer_desc.depth = 1;
+                        buffer_desc.type = RHIBufferType::Default;
+                        buffer_desc.resource_type = RHIBufferResourceType::Buffer;
+                        auto& buffer = buffers.emplace_back(std::make_shared<NullBuffer>());
+                        buffer->CreateBuffer(buffer_desc);
+                        buffer->SetName("replay_buffer_" + std::to_string(handle_value));
+                        resource.buffer = buffer.get();
+                    }
+                    else
+                    {
+                        // Only render targets carry an extent in the snapshot; barriers do not depend on it.
+                        unsigned width = 1;
+                        unsigned height = 1;
+                        if (kind == ResourceKind::RenderTarget)
+                        {
+                            const auto extent_it = render_target_extents.find(handle_value);
+                            if (extent_it != render_target_extents.end())
+                            {
+                                width = (std::max)(extent_it->second.first, 1u);
+                                height = (std::max)(extent_it->second.second, 1u);
+                            }
+                        }
+                        const std::string name = std::string(kind == ResourceKind::RenderTarget ? "replay_render_target_" : "replay_texture_") +
+                            std::to_string(handle_value);
+                        RHITextureDesc texture_desc(name, width, height, RHIDataFormat::R8G8B8A8_UNORM,
+                            static_cast<RHIResourceUsageFlags>(RUF_ALLOW_SRV | RUF_ALLOW_UAV | RUF_ALLOW_RENDER_TARGET),
+                            {
+                                .clear_format = RHIDataFormat::R8G8B8A8_UNORM,
+                                .clear_color = {0.0f, 0.0f, 0.0f, 0.0f}
+                            });
+                        auto& texture = textures.emplace_back(std::make_shared<NullTexture>());
+                        texture->CreateTexture(texture_desc);
+                        texture->SetName(name);
+                        resource.texture = texture.get();
+                    }
+                    resources[state_request.resource_id] = resource;
+                }
+            }
+
+            NullUtils null_utils;
+            NullCommandList command_list;
+            command_list.BeginRecordCommandList();
+
+            auto& diagnostics = out_result.null_rhi_barriers;
+            diagnostics = {};
+            diagnostics.valid = true;
+            diagnostics.planned_full_barrier_count = plan.full_barrier_count;
+            diagnostics.planned_split_barrier_count = plan.split_barrier_count;
+            diagnostics.conflicting_request_count = plan.conflicting_request_count;
+
+            std::vector<std::vector<AliasingBarrierDesc>> aliasing_barriers(aliasing_step_barriers.size());
+            for (size_t step_index = 0; step_index < aliasing_step_barriers.size(); ++step_index)
+            {
+                for (const auto& request : aliasing_step_barriers[step_index])
+                {
+                    const auto after_it = resources.find(request.after_resource_key);
+                    if (after_it == resources.end() || !after_it->second.texture)
+                    {
+                        continue;
+                    }
+                    const auto before_it = request.before_known ? resources.find(request.before_resource_key) : resources.end();
+                    aliasing_barriers[step_index].push_back({
+                        before_it != resources.end() ? before_it->second.texture : nullptr,
+                        after_it->second.texture});
+                }
+            }
+
+            BarrierPlanRecorder recorder(command_list, plan, resources, diagnostics);
+            recorder.SetUtils(&null_utils);
+            recorder.SetAliasingBarriers(&aliasing_barriers);
+            for (unsigned step_index = 0; step_index < plan.passes.size(); ++step_index)
+            {
+                recorder.RecordBeforePass(step_index);
+                recorder.RecordAfterPass(step_index);
+            }
+            recorder.Flush();
+            command_list.EndRecordCommandList();
+
+            out_result.null_rhi_recorded = true;
+            out_result.null_rhi_texture_barrier_count = command_list.GetRecordedCommandCount(RHINullCommandType::TEXTURE_BARRIER);
+            out_result.null_rhi_buffer_barrier_count = command_list.GetRecordedCommandCount(RHINullCommandType::BUFFER_BARRIER);
+            out_result.null_rhi_aliasing_barrier_count = command_list.GetRecordedCommandCount(RHINullCommandType::ALIASING_BARRIER);
+            out_result.null_rhi_validation_error_count = null_utils.GetValidationErrorCount();
+        }
+    }
+
+    struct RenderGraph::TransientAliasingState
+    {
+        // Layout the resource allocator has in place; step_barriers is parallel to the live execution order.
+        TransientAliasingLayout layout;
+        std::size_t placed_signature{0};
+        // Layout that failed to place, not retried until the layout changes.
+        std::size_t failed_signature{0};
+        // Textures the placed handles resolved to; a handle resolving elsewhere was recreated since.
+        std::map<RenderTargetHandle, IRHITexture*> placed_textures;
+        bool layout_dirty{true};
+    };
+
+    // Finished plans keyed by ComputePlanningSignature, least recently used evicted first. Keeping more than
+    // one plan lets toggled features flip between known graphs without replanning.
+    struct RenderGraph::ExecutionPlanCache
+    {
+        static constexpr std::size_t MAX_ENTRY_COUNT = 8;
+
+        struct Entry
+        {
+            std::size_t planning_signature{0};
+            unsigned long long last_used_frame{0};
+            ExecutionPlanBuildResult plan{};
+            std::vector<RenderGraphNodeHandle> cycle_nodes;
+            bool execution_graph_valid{true};
+            std::vector<RenderGraphNodeHandle> execution_order;
+            std::size_t execution_signature{0};
+            std::size_t execution_node_count{0};
+            std::vector<RenderGraphNodeHandle> live_execution_order;
+            std::vector<RenderGraphNodeHandle> culled_nodes;
+            std::vector<std::vector<std::pair<unsigned long long, unsigned>>> barrier_state_requests;
+            AsyncComputeScheduleDiagnostics async_compute_schedule_diagnostics{};
+            std::string async_compute_schedule_dump;
+            RenderGraphQueueScheduler::Schedule async_compute_schedule;
+            RenderGraphAttachmentOps::Plan render_pass_merge_plan;
+        };
+
+        std::vector<Entry> entries;
+
+        Entry* Find(std::size_t planning_signature, unsigned long long frame_index)
+        {
+            for (auto& entry : entries)
+            {
+                if (entry.planning_signature == planning_signature)
+                {
+                    entry.last_used_frame = frame_index;
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        Entry& Insert(std::size_t planning_signature, unsigned long long frame_index)
+        {
+            if (entries.size() >= MAX_ENTRY_COUNT)
+            {
+                const auto oldest = std::min_element(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs)
+                {
+                    return lhs.last_used_frame < rhs.last_used_frame;
+                });
+                entries.erase(oldest);
+            }
+
+            auto& entry = entries.emplace_back();
+            entry.planning_signature = planning_signature;
+            entry.last_used_frame = frame_index;
+            return entry;
+        }
+    };
+
+    RenderWindow::RenderWindow(const RenderWindowDesc& desc)
+        : m_desc(desc)
+        , m_handle(NULL_HANDLE)
+        , m_hwnd(nullptr)
+    {
+        glTFWindow::Get().SetWidth(desc.width);
+        glTFWindow::Get().SetHeight(desc.height);
+        
+        glTFWindow::Get().InitAndShowWindow();
+        m_hwnd = glTFWindow::Get().GetHWND();
+        m_handle = InternalResourceHandleTable::Instance().RegisterWindow(*this);
+        
+        m_input_device = std::make_shared<RendererInputDevice>();
+        glTFWindow::Get().SetInputManager(m_input_device);
+
+        // Register window callback
+        GLTF_CHECK(glTFWindow::Get().RegisterCallbackEventNative());
+    }
+
+    RenderWindowHandle RenderWindow::GetHandle() const
+    {
+        return m_handle;
+    }
+
+    unsigned RenderWindow::GetWidth() const
+    {
+        return static_cast<unsigned>(glTFWindow::Get().GetWidth());
+    }
+
+    unsigned RenderWindow::GetHeight() const
+    {
+        return static_cast<unsigned>(glTFWindow::Get().GetHeight());
+    }
+
+    HWND RenderWindow::GetHWND() const
+    {
+        return glTFWindow::Get().GetHWND();
+    }
+
+    void RenderWindow::EnterWindowEventLoop()
+    {
+        glTFWindow::Get().UpdateWindow();
+    }
+
+    RenderWindow::WindowLoopTiming RenderWindow::GetLastLoopTiming() const
+    {
+        const auto loop_timing = glTFWindow::Get().GetLastLoopTiming();
+        WindowLoopTiming timing{};
+        timing.valid = loop_timing.valid;
+        timing.frame_index = loop_timing.frame_index;
+        timing.loop_total_ms = loop_timing.loop_total_ms;
+        timing.loop_thread_cpu_ms = loop_timing.loop_thread_cpu_ms;
+        timing.idle_wait_ms = loop_timing.idle_wait_ms;
+        timing.tick_callback_ms = loop_timing.tick_callback_ms;
+        timing.tick_callback_thread_cpu_ms = loop_timing.tick_callback_thread_cpu_ms;
+        timing.poll_events_ms = loop_timing.poll_events_ms;
+        timing.poll_events_thread_cpu_ms = loop_timing.poll_events_thread_cpu_ms;
+        timing.non_tick_ms = loop_timing.non_tick_ms;
+        return timing;
+    }
+
+    int RenderWindow::GetWindowRefreshRate() const
+    {
+        return glTFWindow::Get().GetWindowRefreshRate();
+    }
+
+    void RenderWindow::RequestClose()
+    {
+        glTFWindow::Get().RequestClose();
+    }
+
+    bool RenderWindow::IsCloseRequested() const
+    {
+        return glTFWindow::Get().IsCloseRequested();
+    }
+
+    void RenderWindow::RegisterTickCallback(const RenderWindowTickCallback& callback)
+    {
+        glTFWindow::Get().SetTickCallback(callback);
+    }
+
+    void RenderWindow::RegisterExitCallback(const RenderWindowExitCallback& callback)
+    {
+        glTFWindow::Get().SetExitCallback(callback);
+    }
+
+    const RendererInputDevice& RenderWindow::GetInputDeviceConst() const
+    {
+        return *m_input_device;
+    }
+
+    RendererInputDevice& RenderWindow::GetInputDevice()
+    {
+        return *m_input_device;
+    }
+
+    RendererSceneResourceManager::RendererSceneResourceManager(ResourceOperator& allocator,const RenderSceneDesc& desc)
+        : m_allocator(allocator)
+    {
+        std::shared_ptr<RendererSceneGraph> scene_graph = std::make_shared<RendererSceneGraph>();
+        m_render_scene_handle = InternalResourceHandleTable::Instance().RegisterRenderScene(scene_graph);
+        
+        glTFLoader loader;
+        bool loaded = loader.LoadFile(desc.scene_file_name);
+        GLTF_CHECK(loaded);
+        
+        bool added = scene_graph->InitializeRootNodeWithSceneFile_glTF(loader);
+        GLTF_CHECK(added);
+
+        struct SceneMeshDataOffsetInfo
+        {
+            unsigned start_face_index;
+            unsigned material_index;
+            unsigned start_vertex_index;
+        };
+
+        struct SceneMeshFaceInfo
+        {
+            unsigned vertex_index[3];
+        };
+
+        struct SceneMeshVertexInfo
+        {
+            float position[4];
+            float normal[4];
+            float tangent[4];
+            float uv[4];
+        };
+
+        struct glTFMeshInstanceRenderResource
+        {
+            glm::mat4 m_instance_transform;
+            unsigned m_mesh_render_resource;
+            unsigned m_instance_material_id;
+            bool m_normal_mapping;
+        };
+
+        std::vector<SceneMeshDataOffsetInfo> start_offset_infos;
+        std::vector<SceneMeshVertexInfo> mesh_vertex_infos;
+        std::vector<SceneMeshFaceInfo> mesh_face_vertex_infos;
+        unsigned start_face_offset = 0;
+
+        const auto& meshes = scene_graph->GetMeshes();
+        for (const auto& mesh_pair : meshes)
+        {
+            const auto& mesh = *mesh_pair.second;
+
+            const unsigned vertex_offset = static_cast<unsigned>(mesh_vertex_infos.size());
+
+            SceneMeshDataOffsetInfo mesh_info =
+            {
+                .start_face_index = start_face_offset,
+                // TODO: Material system 
+                .material_index = 0,
+                .start_vertex_index = vertex_offset,
+            };
+                
+            start_offset_infos.push_back(mesh_info);
+            const size_t face_count = mesh.GetIndexBuffer().index_count / 3;
+            const auto& index_buffer = mesh.GetIndexBuffer();
+            for (size_t i = 0; i < face_count; ++i)
+            {
+                mesh_face_vertex_infos.push_back(
+                {
+                    vertex_offset + index_buffer.GetIndexByOffset(3 * i),
+                    vertex_offset + index_buffer.GetIndexByOffset(3 * i + 1),
+                    vertex_offset + index_buffer.GetIndexByOffset(3 * i + 2),
+                });
+            }
+
+            for (size_t i = 0; i < mesh.GetVertexBuffer().vertex_count; ++i)
+            {
+                SceneMeshVertexInfo vertex_info;
+                size_t out_data_size = 0;
+                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_POSITION, i, &vertex_info.position, out_data_size);
+                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_NORMAL, i, &vertex_info.normal, out_data_size);
+                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TANGENT, i, &vertex_info.tangent, out_data_size);
+                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TEXCOORD0, i, &vertex_info.uv, out_data_size);
+                mesh_vertex_infos.push_back(vertex_info);
+            }
+        
+            start_face_offset += face_count;
+        }
+    }
+
+    bool RendererSceneResourceManager::AccessSceneData(RendererSceneMeshDataAccessorBase& data_accessor)
+    {
+        const auto& scene_graph = InternalResourceHandleTable::Instance().GetRenderScene(m_render_scene_handle);
+        auto scene_node_traverse = [&](RendererSceneNode& node)
+        {
+            if (node.HasMesh())
+            {
+                auto absolute_transform = node.GetAbsoluteTransform();
+                
+                for (const auto& mesh : node.GetMeshes())
+                {
+                    auto mesh_id = mesh->GetID();
+                    
+                    if (!data_accessor.HasMeshData(mesh_id))
+                    {
+                        auto vertex_count = mesh->GetVertexBuffer().vertex_count;
+                        std::vector<float> vertex_positions(vertex_count * 3);
+                        std::vector<float> vertex_normals(vertex_count * 3);
+                        std::vector<float> vertex_tangents(vertex_count * 4);
+                        std::vector<float> vertex_uvs(vertex_count * 2);
+
+                        for (size_t i = 0; i < vertex_count; ++i)
+                        {
+                            size_t out_data_size = 0;
+                            mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_POSITION, i, &vertex_positions[3 * i], out_data_size);
+                            GLTF_CHECK(out_data_size == 3 * sizeof(float));
+                        
+                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_NORMAL, i, &vertex_normals[3 * i], out_data_size))
+                            {
+                                GLTF_CHECK(out_data_size == 3 * sizeof(float));    
+                            }
+                            else
+                            {
+                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no normal vertex data!\n", mesh->GetID());
+                            }
+
+                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TANGENT, i, &vertex_tangents[4 * i], out_data_size))
+                            {
+                                GLTF_CHECK(out_data_size == 4 * sizeof(float));    
+                            }
+                            else
+                            {
+                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no tangent vertex data!\n", mesh->GetID());
+                            }
+                            
+                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TEXCOORD0, i, &vertex_uvs[2 * i], out_data_size))
+                            {
+                                GLTF_CHECK(out_data_size == 2 * sizeof(float));    
+                            }
+                            else
+                            {
+                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no uv vertex data!\n", mesh->GetID());
+                            }
+                        }
+
+                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_POSITION_FLOAT3, mesh_id, vertex_positions.data(), vertex_count);
+                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_NORMAL_FLOAT3, mesh_id, vertex_normals.data(), vertex_count);
+                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_TANGENT_FLOAT4, mesh_id, vertex_tangents.data(), vertex_count);
+                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_TEXCOORD0_FLOAT2, mesh_id, vertex_uvs.data(), vertex_count);
+
+                        auto index = mesh->GetIndexBuffer().data.get();
+                        auto index_count = mesh->GetIndexBuffer().index_count;
+                        data_accessor.AccessMeshData(mesh->GetIndexBuffer().format == RHIDataFormat::R16_UINT ? RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INDEX_HALF : RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INDEX_INT, mesh_id, index, index_count);
+
+                        data_accessor.AccessMaterialData(mesh->GetMaterial(), mesh_id);
+                    }
+                    
+                    data_accessor.AccessInstanceData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INSTANCE_MAT4x4, node.GetID(), mesh_id, &absolute_transform, 1);
+                }
+            }
+            
+            // No stop
+            return false;
+        };
+        
+        scene_graph->GetRootNode().Traverse(scene_node_traverse);
+        
+        return true;
+    }
+
+    RendererSceneAABB RendererSceneResourceManager::GetSceneBounds() const
+    {
+        const auto& scene_graph = InternalResourceHandleTable::Instance().GetRenderScene(m_render_scene_handle);
+        GLTF_CHECK(scene_graph);
+        return scene_graph->GetBounds();
+    }
+
+    ResourceOperator::ResourceOperator(RenderDeviceDesc device)
+    {
+        if (!m_resource_manager)
+        {
+            RHIGraphicsAPIType graphics_api = RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12;
+            switch (device.type)
+            {
+            case DX12:
+                graphics_api = RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12;
+                break;
+            case VULKAN:
+                graphics_api = RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan;
+                break;
+            case NULL_RHI:
+                graphics_api = RHIGraphicsAPIType::RHI_GRAPHICS_API_Null;
+                break;
+            }
+            RHIConfigSingleton::Instance().SetGraphicsAPIType(graphics_api);
+    
+            RHIConfigSingleton::Instance().InitGraphicsAPI();
+            
+            m_resource_manager = std::make_shared<ResourceManager>();
+            m_resource_manager->InitResourceManager(device);
+        }
+    }
+
+    ShaderHandle ResourceOperator::CreateShader(const ShaderDesc& desc)
+    {
+        return m_resource_manager->CreateShader(desc);
+    }
+
+    TextureHandle ResourceOperator::CreateTexture(const TextureDesc& desc)
+    {
+        const RHIDataFormat rhi_format = RendererInterfaceRHIConverter::ConvertToRHIFormat(desc.format);
+        GLTF_CHECK(rhi_format != RHIDataFormat::UNKNOWN);
+        const bool has_base_data = !desc.data.empty();
+        const bool has_explicit_mip_chain = !desc.mip_levels.empty();
+        GLTF_CHECK(!(has_base_data && has_explicit_mip_chain));
+
+        RHITextureClearValue clear_value{};
+        clear_value.clear_format = rhi_format;
+        clear_value.clear_color[0] = 0.0f;
+        clear_value.clear_color[1] = 0.0f;
+        clear_value.clear_color[2] = 0.0f;
+        clear_value.clear_color[3] = 0.0f;
+
+        const bool contains_mipmaps = desc.generate_mipmaps || has_explicit_mip_chain;
+
+        RHITextureDesc texture_desc(
+            "runtime_texture",
+            desc.width,
+            desc.height,
+            rhi_format,
+            static_cast<RHIResourceUsageFlags>(RUF_ALLOW_SRV | RUF_TRANSFER_DST | (contains_mipmaps ? RUF_CONTAINS_MIPMAP : RUF_NONE)),
+            clear_value);
+
+        std::shared_ptr<IRHITextureAllocation> texture_allocation = nullptr;
+        bool created = false;
+        if (has_explicit_mip_chain)
+        {
+            created = m_resource_manager->GetMemoryManager().AllocateTextureMemory(
+                m_resource_manager->GetDevice(),
+                texture_desc,
+                texture_allocation);
+            GLTF_CHECK(created);
+            GLTF_CHECK(texture_allocation && texture_allocation->m_texture);
+            GLTF_CHECK(desc.mip_levels.size() <= texture_allocation->m_texture->GetMipCount());
+
+            const unsigned byte_per_pixel = GetBytePerPixelByFormat(rhi_format);
+            for (std::size_t mip_index = 0; mip_index < desc.mip_levels.size(); ++mip_index)
+            {
+                const auto& mip_desc = desc.mip_levels[mip_index];
+                const unsigned expected_width = (std::max)(1u, desc.width >> static_cast<unsigned>(mip_index));
+                const unsigned expected_height = (std::max)(1u, desc.height >> static_cast<unsigned>(mip_index));
+                GLTF_CHECK(mip_desc.width == expected_width);
+                GLTF_CHECK(mip_desc.height == expected_height);
+
+                const size_t expected_byte_size =
+                    static_cast<size_t>(mip_desc.width) *
+                    static_cast<size_t>(mip_desc.height) *
+                    byte_per_pixel;
+                GLTF_CHECK(mip_desc.data.size() == expected_byte_size);
+
+                std::shared_ptr<unsigned char[]> upload_data(
+                    new unsigned char[expected_byte_size],
+                    std::default_delete<unsigned char[]>());
+                std::memcpy(upload_data.get(), mip_desc.data.data(), expected_byte_size);
+
+                const RHITextureMipUploadInfo upload_info{
+                    upload_data,
+                    expected_byte_size,
+                    0,
+                    0,
+                    mip_desc.width,
+                    mip_desc.height,
+                    static_cast<unsigned>(mip_index)};
+                const bool uploaded = RHIUtilInstanceManager::Instance().UploadTextureData(
+                    m_resource_manager->GetCommandListForRecordPassCommand(),
+                    m_resource_manager->GetMemoryManager(),
+                    m_resource_manager->GetDevice(),
+                    *texture_allocation->m_texture,
+                    upload_info);
+                GLTF_CHECK(uploaded);
+            }
+        }
+        else if (has_base_data)
+        {
+            const bool has_data = texture_desc.SetTextureData(desc.data.data(), desc.data.size());
+            GLTF_CHECK(has_data);
+            created = m_resource_manager->GetMemoryManager().AllocateTextureMemoryAndUpload(
+                m_resource_manager->GetDevice(),
+                m_resource_manager->GetCommandListForRecordPassCommand(),
+                m_resource_manager->GetMemoryManager(),
+                texture_desc,
+                texture_allocation);
+        }
+        else
+        {
+            created = m_resource_manager->GetMemoryManager().AllocateTextureMemory(
+                m_resource_manager->GetDevice(),
+                texture_desc,
+                texture_allocation);
+        }
+        GLTF_CHECK(created);
+
+        texture_allocation->m_texture->Transition(
+            m_resource_manager->GetCommandListForRecordPassCommand(),
+            RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+
+        return InternalResourceHandleTable::Instance().RegisterTexture(texture_allocation);
+    }
+
+    TextureHandle ResourceOperator::CreateTexture(const TextureFileDesc& desc)
+    {
+        const std::wstring convert_path = to_wide_string(desc.uri);
+        ImageLoadResult result;
+        if (!glTFImageIOUtil::Instance().LoadImageByFilename(convert_path.c_str(), result))
+        {
+            GLTF_CHECK(false);
+            return NULL_HANDLE;
+        }
+        RHITextureDesc texture_desc{};
+        texture_desc.InitWithLoadedData(result);
+
+        std::shared_ptr<IRHITextureAllocation> texture_allocation = nullptr;
+        bool created = m_resource_manager->GetMemoryManager().AllocateTextureMemoryAndUpload(m_resource_manager->GetDevice(), m_resource_manager->GetCommandListForRecordPassCommand(), m_resource_manager->GetMemoryManager(), texture_desc, texture_allocation);
+        GLTF_CHECK(created);
+
+        texture_allocation->m_texture->Transition(m_resource_manager->GetCommandListForRecordPassCommand(), RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+
+        return InternalResourceHandleTable::Instance().RegisterTexture(texture_allocation);
+    }
+
+    unsigned ResourceOperator::GetBindlessTextureIndex(TextureHandle handle)
+    {
+        const auto find_texture = m_bindless_textures.find(handle);
+        if (find_texture != m_bindless_textures.end())
+        {
+            return find_texture->second.first;
+        }
+
+        // Created textures stay in the shader resource state, so the shared table never needs transitions.
+        auto texture_allocation = InternalResourceHandleTable::Instance().GetTexture(handle);
+        GLTF_CHECK(texture_allocation && texture_allocation->m_texture);
+        const RHITextureDescriptorDesc texture_descriptor_desc{texture_allocation->m_texture->GetTextureFormat(), RHIResourceDimension::TEXTURE2D, RHIViewType::RVT_SRV};
+        std::shared_ptr<IRHITextureDescriptorAllocation> texture_descriptor = nullptr;
+        const bool created = GetDescriptorManager().CreateDescriptor(GetDevice(), texture_allocation->m_texture, texture_descriptor_desc, texture_descriptor);
+        GLTF_CHECK(created);
+
+        unsigned bindless_index = 0;
+        const bool registered = GetDescriptorManager().RegisterBindlessTexture(GetDevice(), texture_descriptor, bindless_index);
+        GLTF_CHECK(registered);
+        m_bindless_textures.emplace(handle, std::make_pair(bindless_index, texture_descriptor));
+        return bindless_index;
+    }
+
+    BufferHandle ResourceOperator::CreateBuffer(const BufferDesc& desc)
+    {
+        return m_resource_manager->CreateBuffer(desc);
+    }
+
+    bool ResourceOperator::RetireBuffer(BufferHandle handle)
+    {
+        if (!m_resource_manager || !handle.IsValid())
+        {
+            return false;
+        }
+
+        return m_resource_manager->RetireBuffer(handle);
+    }
+
+    IndexedBufferHandle ResourceOperator::CreateIndexedBuffer(const BufferDesc& desc)
+    {
+        return m_resource_manager->CreateIndexedBuffer(desc);   
+    }
+
+    std::vector<BufferHandle> ResourceOperator::CreateFrameBufferedBuffers(const BufferDesc& desc, const std::string& debug_name_prefix)
+    {
+        const auto frame_context = GetFrameContext();
+        const unsigned frame_slot_count = frame_context.frame_slot_count;
+        std::vector<BufferHandle> buffers;
+        buffers.reserve(frame_slot_count);
+
+        std::string base_name = debug_name_prefix;
+        if (base_name.empty())
+        {
+            base_name = desc.name.empty() ? "FrameBufferedBuffer" : desc.name;
+        }
+
+        for (unsigned frame_index = 0; frame_index < frame_slot_count; ++frame_index)
+        {
+            BufferDesc frame_desc = desc;
+            frame_desc.name = base_name + "_frame_" + std::to_string(frame_index);
+            buffers.push_back(CreateBuffer(frame_desc));
+        }
+
+        return buffers;
+    }
+
+    bool ResourceOperator::RetireFrameBufferedBuffers(const std::vector<BufferHandle>& buffers)
+    {
+        bool retired_all = !buffers.empty();
+        std::set<BufferHandle> unique_handles;
+        for (const auto handle : buffers)
+        {
+            if (!handle.IsValid() || !unique_handles.insert(handle).second)
+            {
+                continue;
+            }
+
+            retired_all = RetireBuffer(handle) && retired_all;
+        }
+
+        return retired_all;
+    }
+
+    BufferHandle ResourceOperator::GetFrameBufferedBufferHandle(const std::vector<BufferHandle>& buffers) const
+    {
+        return GetFrameBufferedBufferHandle(buffers, GetFrameContext());
+    }
+
+    BufferHandle ResourceOperator::GetFrameBufferedBufferHandle(const std::vector<BufferHandle>& buffers, const FrameContextSnapshot& frame_context) const
+    {
+        GLTF_CHECK(!buffers.empty());
+        const unsigned frame_slot = frame_context.per_frame_resource_binding_enabled
+            ? (frame_context.frame_slot_index % static_cast<unsigned>(buffers.size()))
+            : 0u;
+        return buffers[frame_slot];
+    }
+
+    void ResourceOperator::UploadFrameBufferedBufferData(const std::vector<BufferHandle>& buffers, const BufferUploadDesc& upload_desc)
+    {
+        if (buffers.empty())
+        {
+            return;
+        }
+        UploadBufferData(GetFrameBufferedBufferHandle(buffers), upload_desc);
+    }
+
+    std::vector<RenderTargetHandle> ResourceOperator::CreateFrameBufferedRenderTargets(const RenderTargetDesc& desc, const std::string& debug_name_prefix)
+    {
+        const auto frame_context = GetFrameContext();
+        const unsigned frame_slot_count = frame_context.frame_slot_count;
+        std::vector<RenderTargetHandle> render_targets;
+        render_targets.reserve(frame_slot_count);
+
+        std::string base_name = debug_name_prefix;
+        if (base_name.empty())
+        {
+            base_name = desc.name.empty() ? "FrameBufferedRenderTarget" : desc.name;
+        }
+
+        for (unsigned frame_index = 0; frame_index < frame_slot_count; ++frame_index)
+        {
+            RenderTargetDesc frame_desc = desc;
+            frame_desc.name = base_name + "_frame_" + std::to_string(frame_index);
+            render_targets.push_back(CreateRenderTarget(frame_desc));
+            m_frame_buffered_render_targets.insert(render_targets.back());
+        }
+
+        return render_targets;
+    }
+
+    RenderTargetHandle ResourceOperator::GetFrameBufferedRenderTargetHandle(const std::vector<RenderTargetHandle>& render_targets) const
+    {
+        return GetFrameBufferedRenderTargetHandle(render_targets, GetFrameContext());
+    }
+
+    RenderTargetHandle ResourceOperator::GetFrameBufferedRenderTargetHandle(const std::vector<RenderTargetHandle>& render_targets, const FrameContextSnapshot& frame_context) const
+    {
+        GLTF_CHECK(!render_targets.empty());
+        const unsigned frame_slot = frame_context.per_frame_resource_binding_enabled
+            ? (frame_context.frame_slot_index % static_cast<unsigned>(render_targets.size()))
+            : 0u;
+        return render_targets[frame_slot];
+    }
+
+    RenderTargetHandle ResourceOperator::CreateFrameBufferedRenderTargetAlias(const RenderTargetDesc& desc, const std::string& debug_name_prefix)
+    {
+        auto render_targets = CreateFrameBufferedRenderTargets(desc, debug_name_prefix);
+        GLTF_CHECK(!render_targets.empty());
+        const auto logical_handle = render_targets.front();
+        m_frame_buffered_render_target_aliases[logical_handle] = std::move(render_targets);
+        return logical_handle;
+    }
+
+    RenderTargetHandle ResourceOperator::CreateRenderTarget(const RenderTargetDesc& desc)
+    {
+        return m_resource_manager->CreateRenderTarget(desc);
+    }
+
+    bool ResourceOperator::RetireRenderTarget(RenderTargetHandle handle)
+    {
+        if (!m_resource_manager || !handle.IsValid())
+        {
+            return false;
+        }
+
+        if (TryRetireTrackedRenderTargetAlias(handle))
+        {
+            return true;
+        }
+
+        return m_resource_manager->RetireRenderTarget(handle);
+    }
+
+    bool ResourceOperator::GetRenderTargetDesc(RenderTargetHandle handle, RenderTargetDesc& out_desc) const
+    {
+        if (!m_resource_manager || !handle.IsValid())
+        {
+            return false;
+        }
+
+        return m_resource_manager->GetRenderTargetDesc(handle, out_desc);
+    }
+
+    bool ResourceOperator::GetRenderTargetPlacementRequirements(RenderTargetHandle handle, unsigned long long& out_size_bytes,
+        unsigned long long& out_alignment) const
     {
-        const auto loop_timing = glTFWindow::Get().GetLastLoopTiming();
-        WindowLoopTiming timing{};
-        timing.valid = loop_timing.valid;
-        timing.frame_index = loop_timing.frame_index;
-        timing.loop_total_ms = loop_timing.loop_total_ms;
-        timing.loop_thread_cpu_ms = loop_timing.loop_thread_cpu_ms;
-        timing.idle_wait_ms = loop_timing.idle_wait_ms;
-        timing.tick_callback_ms = loop_timing.tick_callback_ms;
-        timing.tick_callback_thread_cpu_ms = loop_timing.tick_callback_thread_cpu_ms;
-        timing.poll_events_ms = loop_timing.poll_events_ms;
-        timing.poll_events_thread_cpu_ms = loop_timing.poll_events_thread_cpu_ms;
-        timing.non_tick_ms = loop_timing.non_tick_ms;
-        return timing;
+        if (!m_resource_manager || !handle.IsValid() || m_frame_buffered_render_targets.contains(handle))
+        {
+            return false;
+        }
+
+        return m_resource_manager->GetRenderTargetPlacementRequirements(handle, out_size_bytes, out_alignment);
+    }
+
+    bool ResourceOperator::PlaceTransientRenderTargets(const std::vector<TransientRenderTargetHeapDesc>& heaps,
+        const std::vector<TransientRenderTargetPlacement>& placements)
+    {
+        if (!m_resource_manager)
+        {
+            return false;
+        }
+
+        for (const auto& placement : placements)
+        {
+            if (m_frame_buffered_render_targets.contains(placement.handle))
+            {
+                return false;
+            }
+        }
+
+        return m_resource_manager->PlaceTransientRenderTargets(heaps, placements);
+    }
+
+    bool ResourceOperator::IsRenderTargetPlaced(RenderTargetHandle handle) const
+    {
+        return m_resource_manager && m_resource_manager->IsRenderTargetPlaced(handle);
+    }
+
+    bool ResourceOperator::RetireFrameBufferedRenderTargets(const std::vector<RenderTargetHandle>& render_targets)
+    {
+        if (!m_resource_manager || render_targets.empty())
+        {
+            return false;
+        }
+
+        if (TryRetireTrackedRenderTargetAlias(render_targets.front()))
+        {
+            return true;
+        }
+
+        bool retired_all = true;
+        std::set<RenderTargetHandle> unique_handles;
+        for (const auto handle : render_targets)
+        {
+            if (!handle.IsValid() || !unique_handles.insert(handle).second)
+            {
+                continue;
+            }
+
+            m_frame_buffered_render_targets.erase(handle);
+            retired_all = m_resource_manager->RetireRenderTarget(handle) && retired_all;
+        }
+
+        return retired_all;
+    }
+
+    bool ResourceOperator::RetireFrameBufferedRenderTargetAlias(RenderTargetHandle logical_handle)
+    {
+        if (!m_resource_manager)
+        {
+            return false;
+        }
+
+        return TryRetireTrackedRenderTargetAlias(logical_handle);
+    }
+
+    RenderTargetHandle ResourceOperator::CreateRenderTarget(const std::string& name, unsigned width, unsigned height,
+        PixelFormat format, RenderTargetClearValue clear_value, ResourceUsage usage)
+    {
+        RendererInterface::RenderTargetDesc render_target_desc{};
+        render_target_desc.name = name;
+        render_target_desc.size_mode = RenderTargetSizeMode::FIXED;
+        render_target_desc.width = width;
+        render_target_desc.height = height;
+        render_target_desc.format = format;
+        render_target_desc.clear = clear_value;
+        render_target_desc.usage = usage; 
+        return  m_resource_manager->CreateRenderTarget(render_target_desc);
+    }
+
+    RenderTargetHandle ResourceOperator::CreateFrameBufferedRenderTargetAlias(
+        const std::string& name,
+        unsigned width,
+        unsigned height,
+        PixelFormat format,
+        RenderTargetClearValue clear_value,
+        ResourceUsage usage)
+    {
+        RendererInterface::RenderTargetDesc render_target_desc{};
+        render_target_desc.name = name;
+        render_target_desc.size_mode = RenderTargetSizeMode::FIXED;
+        render_target_desc.width = width;
+        render_target_desc.height = height;
+        render_target_desc.format = format;
+        render_target_desc.clear = clear_value;
+        render_target_desc.usage = usage;
+        return CreateFrameBufferedRenderTargetAlias(render_target_desc, name);
+    }
+
+    RenderTargetHandle ResourceOperator::CreateWindowRelativeRenderTarget(const std::string& name,
+        PixelFormat format, RenderTargetClearValue clear_value, ResourceUsage usage, float width_scale, float height_scale, unsigned min_width, unsigned min_height)
+    {
+        RendererInterface::RenderTargetDesc render_target_desc{};
+        render_target_desc.name = name;
+        render_target_desc.format = format;
+        render_target_desc.clear = clear_value;
+        render_target_desc.usage = usage;
+        render_target_desc.size_mode = RenderTargetSizeMode::WINDOW_RELATIVE;
+        render_target_desc.width_scale = width_scale;
+        render_target_desc.height_scale = height_scale;
+        render_target_desc.min_width = (std::max)(1u, min_width);
+        render_target_desc.min_height = (std::max)(1u, min_height);
+
+        const unsigned current_width = (std::max)(1u, GetCurrentRenderWidth());
+        const unsigned current_height = (std::max)(1u, GetCurrentRenderHeight());
+        render_target_desc.width = ComputeScaledExtent(current_width, render_target_desc.width_scale, render_target_desc.min_width);
+        render_target_desc.height = ComputeScaledExtent(current_height, render_target_desc.height_scale, render_target_desc.min_height);
+        return m_resource_manager->CreateRenderTarget(render_target_desc);
+    }
+
+    RenderTargetHandle ResourceOperator::CreateFrameBufferedWindowRelativeRenderTarget(
+        const std::string& name,
+        PixelFormat format,
+        RenderTargetClearValue clear_value,
+        ResourceUsage usage,
+        float width_scale,
+        float height_scale,
+        unsigned min_width,
+        unsigned min_height)
+    {
+        RendererInterface::RenderTargetDesc render_target_desc{};
+        render_target_desc.name = name;
+        render_target_desc.format = format;
+        render_target_desc.clear = clear_value;
+        render_target_desc.usage = usage;
+        render_target_desc.size_mode = RenderTargetSizeMode::WINDOW_RELATIVE;
+        render_target_desc.width_scale = width_scale;
+        render_target_desc.height_scale = height_scale;
+        render_target_desc.min_width = (std::max)(1u, min_width);
+        render_target_desc.min_height = (std::max)(1u, min_height);
+
+        const unsigned current_width = (std::max)(1u, GetCurrentRenderWidth());
+        const unsigned current_height = (std::max)(1u, GetCurrentRenderHeight());
+        render_target_desc.width = ComputeScaledExtent(current_width, render_target_desc.width_scale, render_target_desc.min_width);
+        render_target_desc.height = ComputeScaledExtent(current_height, render_target_desc.height_scale, render_target_desc.min_height);
+        return CreateFrameBufferedRenderTargetAlias(render_target_desc, name);
+    }
+
+    RenderPassHandle ResourceOperator::CreateRenderPass(const RenderPassDesc& desc)
+    {
+        std::shared_ptr<RenderPass> render_pass = std::make_shared<RenderPass>(desc);
+        if (!render_pass->InitRenderPass(*m_resource_manager))
+        {
+            LOG_FORMAT_FLUSH("[RenderPass][Init][Error] Failed to initialize render pass (type=%d, shader_count=%zu, rt_binding_count=%zu).\n",
+                             static_cast<int>(desc.type),
+                             desc.shaders.size(),
+                             desc.render_target_bindings.size());
+            return NULL_HANDLE;
+        }
+        
+        return InternalResourceHandleTable::Instance().RegisterRenderPass(render_pass);
+    }
+
+    RenderSceneHandle ResourceOperator::CreateRenderScene(const RenderSceneDesc& desc)
+    {
+        std::shared_ptr<RendererSceneGraph> scene_graph = std::make_shared<RendererSceneGraph>();
+        
+        glTFLoader loader;
+        bool loaded = loader.LoadFile(desc.scene_file_name);
+        GLTF_CHECK(loaded);
+        
+        bool added = scene_graph->InitializeRootNodeWithSceneFile_glTF(loader);
+        GLTF_CHECK(added);
+
+        const auto traverse_function = [](const RendererSceneNode& node)
+        {
+            return true;
+        };
+    
+        scene_graph->GetRootNode().Traverse(traverse_function);
+        
+        return InternalResourceHandleTable::Instance().RegisterRenderScene(scene_graph);
+    }
+
+    IRHIDevice& ResourceOperator::GetDevice() const
+    {
+        return m_resource_manager->GetDevice();
+    }
+
+    unsigned ResourceOperator::GetCurrentBackBufferIndex() const
+    {
+        return m_resource_manager->GetCurrentBackBufferIndex();
+    }
+
+    unsigned ResourceOperator::GetCurrentFrameSlotIndex() const
+    {
+        return m_resource_manager->GetCurrentFrameSlotIndex();
+    }
+
+    unsigned ResourceOperator::GetFrameSlotCount() const
+    {
+        return m_resource_manager->GetFrameSlotCount();
+    }
+
+    unsigned ResourceOperator::GetSwapchainImageCount() const
+    {
+        return m_resource_manager->GetSwapchainImageCount();
+    }
+
+    unsigned ResourceOperator::GetBackBufferCount() const
+    {
+        return m_resource_manager->GetBackBufferCount();
+    }
+
+    FrameContextSnapshot ResourceOperator::GetFrameContext() const
+    {
+        FrameContextSnapshot frame_context = m_resource_manager->GetFrameContext();
+        frame_context.per_frame_resource_binding_enabled = m_per_frame_resource_binding_enabled;
+        frame_context.profiler_slot_count = frame_context.frame_slot_count;
+        frame_context.profiler_slot_index = frame_context.frame_slot_index % frame_context.profiler_slot_count;
+        return frame_context;
+    }
+
+    bool ResourceOperator::IsPerFrameResourceBindingEnabled() const
+    {
+        return m_per_frame_resource_binding_enabled;
+    }
+
+    void ResourceOperator::SetPerFrameResourceBindingEnabled(bool enable)
+    {
+        m_per_frame_resource_binding_enabled = enable;
+    }
+
+    void ResourceOperator::ApplyFrameBufferedRenderTargetAliases()
+    {
+        for (const auto& alias_pair : m_frame_buffered_render_target_aliases)
+        {
+            const auto logical_handle = alias_pair.first;
+            const auto& candidates = alias_pair.second;
+            if (candidates.empty())
+            {
+                continue;
+            }
+
+            const auto target_handle = GetFrameBufferedRenderTargetHandle(candidates);
+            auto target_render_target = InternalResourceHandleTable::Instance().GetRenderTarget(target_handle);
+            const bool updated = InternalResourceHandleTable::Instance().UpdateRenderTarget(logical_handle, target_render_target);
+            GLTF_CHECK(updated);
+            m_frame_buffered_render_target_alias_current[logical_handle] = target_handle;
+        }
     }
 
-    int RenderWindow::GetWindowRefreshRate() const
+    bool ResourceOperator::TryRetireTrackedRenderTargetAlias(RenderTargetHandle handle)
     {
-        return glTFWindow::Get().GetWindowRefreshRate();
+        if (!m_resource_manager)
+        {
+            return false;
+        }
+
+        auto alias_it = m_frame_buffered_render_target_aliases.end();
+        for (auto it = m_frame_buffered_render_target_aliases.begin(); it != m_frame_buffered_render_target_aliases.end(); ++it)
+        {
+            if (it->first == handle ||
+                std::find(it->second.begin(), it->second.end(), handle) != it->second.end())
+            {
+                alias_it = it;
+                break;
+            }
+        }
+
+        if (alias_it == m_frame_buffered_render_target_aliases.end())
+        {
+            return false;
+        }
+
+        std::set<RenderTargetHandle> unique_handles(alias_it->second.begin(), alias_it->second.end());
+        m_frame_buffered_render_target_alias_current.erase(alias_it->first);
+        m_frame_buffered_render_target_aliases.erase(alias_it);
+
+        bool retired_all = !unique_handles.empty();
+        for (const auto target_handle : unique_handles)
+        {
+            if (!target_handle.IsValid())
+            {
+                continue;
+            }
+
+            m_frame_buffered_render_targets.erase(target_handle);
+            retired_all = m_resource_manager->RetireRenderTarget(target_handle) && retired_all;
+        }
+
+        return retired_all;
     }
 
-    void RenderWindow::RequestClose()
+    IRHITextureDescriptorAllocation& ResourceOperator::GetCurrentSwapchainRT() const
     {
-        glTFWindow::Get().RequestClose();
+        return m_resource_manager->GetCurrentSwapchainRT();
     }
 
-    bool RenderWindow::IsCloseRequested() const
+    IRHITextureDescriptorAllocation& ResourceOperator::GetCurrentSwapchainRT(const FrameContextSnapshot& frame_context) const
     {
-        return glTFWindow::Get().IsCloseRequested();
+        return m_resource_manager->GetCurrentSwapchainRT(frame_context);
     }
 
-    void RenderWindow::RegisterTickCallback(const RenderWindowTickCallback& callback)
+    bool ResourceOperator::HasCurrentSwapchainRT() const
     {
-        glTFWindow::Get().SetTickCallback(callback);
+        return m_resource_manager->HasCurrentSwapchainRT();
     }
 
-    void RenderWindow::RegisterExitCallback(const RenderWindowExitCallback& callback)
+    void ResourceOperator::UploadBufferData(BufferHandle handle, const BufferUploadDesc& upload_desc)
     {
-        glTFWindow::Get().SetExitCallback(callback);
+        auto buffer = InternalResourceHandleTable::Instance().GetBuffer(handle);
+        m_resource_manager->GetMemoryManager().UploadBufferData(m_resource_manager->GetDevice(), m_resource_manager->GetCommandListForRecordPassCommand(), *buffer, upload_desc.data, 0, upload_desc.size);
     }
 
-    const RendererInputDevice& RenderWindow::GetInputDeviceConst() const
+    void ResourceOperator::BeginFrame()
     {
-        return *m_input_device;
+        return m_resource_manager->BeginFrame();
     }
 
-    RendererInputDevice& RenderWindow::GetInputDevice()
+    void ResourceOperator::WaitFrameRenderFinished()
     {
-        return *m_input_device;
+        return m_resource_manager->WaitFrameRenderFinished();
     }
 
-    RendererSceneResourceManager::RendererSceneResourceManager(ResourceOperator& allocator,const RenderSceneDesc& desc)
-        : m_allocator(allocator)
+    void ResourceOperator::WaitGPUIdle()
     {
-        std::shared_ptr<RendererSceneGraph> scene_graph = std::make_shared<RendererSceneGraph>();
-        m_render_scene_handle = InternalResourceHandleTable::Instance().RegisterRenderScene(scene_graph);
-        
-        glTFLoader loader;
-        bool loaded = loader.LoadFile(desc.scene_file_name);
-        GLTF_CHECK(loaded);
-        
-        bool added = scene_graph->InitializeRootNodeWithSceneFile_glTF(loader);
-        GLTF_CHECK(added);
-
-        struct SceneMeshDataOffsetInfo
-        {
-            unsigned start_face_index;
-            unsigned material_index;
-            unsigned start_vertex_index;
-        };
-
-        struct SceneMeshFaceInfo
-        {
-            unsigned vertex_index[3];
-        };
-
-        struct SceneMeshVertexInfo
-        {
-            float position[4];
-            float normal[4];
-            float tangent[4];
-            float uv[4];
-        };
-
-        struct glTFMeshInstanceRenderResource
-        {
-            glm::mat4 m_instance_transform;
-            unsigned m_mesh_render_resource;
-            unsigned m_instance_material_id;
-            bool m_normal_mapping;
-        };
-
-        std::vector<SceneMeshDataOffsetInfo> start_offset_infos;
-        std::vector<SceneMeshVertexInfo> mesh_vertex_infos;
-        std::vector<SceneMeshFaceInfo> mesh_face_vertex_infos;
-        unsigned start_face_offset = 0;
-
-        const auto& meshes = scene_graph->GetMeshes();
-        for (const auto& mesh_pair : meshes)
-        {
-            const auto& mesh = *mesh_pair.second;
+        return m_resource_manager->WaitGPUIdle();
+    }
 
-            const unsigned vertex_offset = static_cast<unsigned>(mesh_vertex_infos.size());
+    void ResourceOperator::AdvanceFrameSlot()
+    {
+        return m_resource_manager->AdvanceFrameSlot();
+    }
 
-            SceneMeshDataOffsetInfo mesh_info =
-            {
-                .start_face_index = start_face_offset,
-                // TODO: Material system 
-                .material_index = 0,
-                .start_vertex_index = vertex_offset,
-            };
-                
-            start_offset_infos.push_back(mesh_info);
-            const size_t face_count = mesh.GetIndexBuffer().index_count / 3;
-            const auto& index_buffer = mesh.GetIndexBuffer();
-            for (size_t i = 0; i < face_count; ++i)
-            {
-                mesh_face_vertex_infos.push_back(
-                {
-                    vertex_offset + index_buffer.GetIndexByOffset(3 * i),
-                    vertex_offset + index_buffer.GetIndexByOffset(3 * i + 1),
-                    vertex_offset + index_buffer.GetIndexByOffset(3 * i + 2),
-                });
-            }
+    void ResourceOperator::InvalidateSwapchainResizeRequest()
+    {
+        return m_resource_manager->InvalidateSwapchainResizeRequest();
+    }
 
-            for (size_t i = 0; i < mesh.GetVertexBuffer().vertex_count; ++i)
-            {
-                SceneMeshVertexInfo vertex_info;
-                size_t out_data_size = 0;
-                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_POSITION, i, &vertex_info.position, out_data_size);
-                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_NORMAL, i, &vertex_info.normal, out_data_size);
-                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TANGENT, i, &vertex_info.tangent, out_data_size);
-                mesh.GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TEXCOORD0, i, &vertex_info.uv, out_data_size);
-                mesh_vertex_infos.push_back(vertex_info);
-            }
-        
-            start_face_offset += face_count;
-        }
+    WindowSurfaceSyncResult ResourceOperator::SyncWindowSurface(unsigned window_width, unsigned window_height)
+    {
+        return m_resource_manager->SyncWindowSurface(window_width, window_height);
     }
 
-    bool RendererSceneResourceManager::AccessSceneData(RendererSceneMeshDataAccessorBase& data_accessor)
+    void ResourceOperator::NotifySwapchainAcquireFailure()
     {
-        const auto& scene_graph = InternalResourceHandleTable::Instance().GetRenderScene(m_render_scene_handle);
-        auto scene_node_traverse = [&](RendererSceneNode& node)
-        {
-            if (node.HasMesh())
-            {
-                auto absolute_transform = node.GetAbsoluteTransform();
-                
-                for (const auto& mesh : node.GetMeshes())
-                {
-                    auto mesh_id = mesh->GetID();
-                    
-                    if (!data_accessor.HasMeshData(mesh_id))
-                    {
-                        auto vertex_count = mesh->GetVertexBuffer().vertex_count;
-                        std::vector<float> vertex_positions(vertex_count * 3);
-                        std::vector<float> vertex_normals(vertex_count * 3);
-                        std::vector<float> vertex_tangents(vertex_count * 4);
-                        std::vector<float> vertex_uvs(vertex_count * 2);
+        return m_resource_manager->NotifySwapchainAcquireFailure();
+    }
 
-                        for (size_t i = 0; i < vertex_count; ++i)
-                        {
-                            size_t out_data_size = 0;
-                            mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_POSITION, i, &vertex_positions[3 * i], out_data_size);
-                            GLTF_CHECK(out_data_size == 3 * sizeof(float));
-                        
-                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_NORMAL, i, &vertex_normals[3 * i], out_data_size))
-                            {
-                                GLTF_CHECK(out_data_size == 3 * sizeof(float));    
-                            }
-                            else
-                            {
-                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no normal vertex data!\n", mesh->GetID());
-                            }
+    void ResourceOperator::NotifySwapchainPresentFailure()
+    {
+        return m_resource_manager->NotifySwapchainPresentFailure();
+    }
 
-                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TANGENT, i, &vertex_tangents[4 * i], out_data_size))
-                            {
-                                GLTF_CHECK(out_data_size == 4 * sizeof(float));    
-                            }
-                            else
-                            {
-                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no tangent vertex data!\n", mesh->GetID());
-                            }
-                            
-                            if (mesh->GetVertexBuffer().GetVertexAttributeDataByIndex(VertexAttributeType::VERTEX_TEXCOORD0, i, &vertex_uvs[2 * i], out_data_size))
-                            {
-                                GLTF_CHECK(out_data_size == 2 * sizeof(float));    
-                            }
-                            else
-                            {
-                                LOG_FORMAT_FLUSH("[WARN] Mesh %d has no uv vertex data!\n", mesh->GetID());
-                            }
-                        }
+    bool ResourceOperator::ResizeSwapchainIfNeeded(unsigned width, unsigned height)
+    {
+        return m_resource_manager->ResizeSwapchainIfNeeded(width, height);
+    }
 
-                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_POSITION_FLOAT3, mesh_id, vertex_positions.data(), vertex_count);
-                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_NORMAL_FLOAT3, mesh_id, vertex_normals.data(), vertex_count);
-                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_TANGENT_FLOAT4, mesh_id, vertex_tangents.data(), vertex_count);
-                        data_accessor.AccessMeshData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::VERTEX_TEXCOORD0_FLOAT2, mesh_id, vertex_uvs.data(), vertex_count);
+    bool ResourceOperator::ResizeWindowDependentRenderTargets(unsigned width, unsigned height)
+    {
+        return m_resource_manager->ResizeWindowDependentRenderTargets(width, height);
+    }
 
-                        auto index = mesh->GetIndexBuffer().data.get();
-                        auto index_count = mesh->GetIndexBuffer().index_count;
-                        data_accessor.AccessMeshData(mesh->GetIndexBuffer().format == RHIDataFormat::R16_UINT ? RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INDEX_HALF : RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INDEX_INT, mesh_id, index, index_count);
+    SwapchainLifecycleState ResourceOperator::GetSwapchainLifecycleState() const
+    {
+        return m_resource_manager->GetSwapchainLifecycleState();
+    }
 
-                        data_accessor.AccessMaterialData(mesh->GetMaterial(), mesh_id);
-                    }
-                    
-                    data_accessor.AccessInstanceData(RendererSceneMeshDataAccessorBase::MeshDataAccessorType::INSTANCE_MAT4x4, node.GetID(), mesh_id, &absolute_transform, 1);
-                }
-            }
-            
-            // No stop
-            return false;
-        };
-        
-        scene_graph->GetRootNode().Traverse(scene_node_traverse);
-        
-        return true;
+    SwapchainResizePolicy ResourceOperator::GetSwapchainResizePolicy() const
+    {
+        return m_resource_manager->GetSwapchainResizePolicy();
     }
 
-    RendererSceneAABB RendererSceneResourceManager::GetSceneBounds() const
+    void ResourceOperator::SetSwapchainResizePolicy(const SwapchainResizePolicy& policy, bool reset_retry_state)
     {
-        const auto& scene_graph = InternalResourceHandleTable::Instance().GetRenderScene(m_render_scene_handle);
-        GLTF_CHECK(scene_graph);
-        return scene_graph->GetBounds();
+        return m_resource_manager->SetSwapchainResizePolicy(policy, reset_retry_state);
     }
 
-    ResourceOperator::ResourceOperator(RenderDeviceDesc device)
+    SwapchainPresentMode ResourceOperator::GetSwapchainPresentMode() const
     {
-        if (!m_resource_manager)
-        {
-            RHIConfigSingleton::Instance().SetGraphicsAPIType(device.type == VULKAN ?
-            RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan : RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12);
-    
-            RHIConfigSingleton::Instance().InitGraphicsAPI();
-            
-            m_resource_manager = std::make_shared<ResourceManager>();
-            m_resource_manager->InitResourceManager(device);
-        }
+        return m_resource_manager->GetSwapchainPresentMode();
     }
 
-    ShaderHandle ResourceOperator::CreateShader(const ShaderDesc& desc)
+    void ResourceOperator::SetSwapchainPresentMode(SwapchainPresentMode mode)
     {
-        return m_resource_manager->CreateShader(desc);
+        return m_resource_manager->SetSwapchainPresentMode(mode);
     }
 
-    TextureHandle ResourceOperator::CreateTexture(const TextureDesc& desc)
+    FrameLatencyMode ResourceOperator::GetFrameLatencyMode() const
     {
-        const RHIDataFormat rhi_format = RendererInterfaceRHIConverter::ConvertToRHIFormat(desc.format);
-        GLTF_CHECK(rhi_format != RHIDataFormat::UNKNOWN);
-        const bool has_base_data = !desc.data.empty();
-        const bool has_explicit_mip_chain = !desc.mip_levels.empty();
-        GLTF_CHECK(!(has_base_data && has_explicit_mip_chain));
-
-        RHITextureClearValue clear_value{};
-        clear_value.clear_format = rhi_format;
-        clear_value.clear_color[0] = 0.0f;
-        clear_value.clear_color[1] = 0.0f;
-        clear_value.clear_color[2] = 0.0f;
-        clear_value.clear_color[3] = 0.0f;
-
-        const bool contains_mipmaps = desc.generate_mipmaps || has_explicit_mip_chain;
-
-        RHITextureDesc texture_desc(
-            "runtime_texture",
-            desc.width,
-            desc.height,
-            rhi_format,
-            static_cast<RHIResourceUsageFlags>(RUF_ALLOW_SRV | RUF_TRANSFER_DST | (contains_mipmaps ? RUF_CONTAINS_MIPMAP : RUF_NONE)),
-            clear_value);
-
-        std::shared_ptr<IRHITextureAllocation> texture_allocation = nullptr;
-        bool created = false;
-        if (has_explicit_mip_chain)
-        {
-            created = m_resource_manager->GetMemoryManager().AllocateTextureMemory(
-                m_resource_manager->GetDevice(),
-                texture_desc,
-                texture_allocation);
-            GLTF_CHECK(created);
-            GLTF_CHECK(texture_allocation && texture_allocation->m_texture);
-            GLTF_CHECK(desc.mip_levels.size() <= texture_allocation->m_texture->GetMipCount());
+        return m_resource_manager->GetFrameLatencyMode();
+    }
 
-            const unsigned byte_per_pixel = GetBytePerPixelByFormat(rhi_format);
-            for (std::size_t mip_index = 0; mip_index < desc.mip_levels.size(); ++mip_index)
-            {
-                const auto& mip_desc = desc.mip_levels[mip_index];
-                const unsigned expected_width = (std::max)(1u, desc.width >> static_cast<unsigned>(mip_index));
-                const unsigned expected_height = (std::max)(1u, desc.height >> static_cast<unsigned>(mip_index));
-                GLTF_CHECK(mip_desc.width == expected_width);
-                GLTF_CHECK(mip_desc.height == expected_height);
+    void ResourceOperator::SetFrameLatencyMode(FrameLatencyMode mode)
+    {
+        return m_resource_manager->SetFrameLatencyMode(mode);
+    }
 
-                const size_t expected_byte_size =
-                    static_cast<size_t>(mip_desc.width) *
-                    static_cast<size_t>(mip_desc.height) *
-                    byte_per_pixel;
-                GLTF_CHECK(mip_desc.data.size() == expected_byte_size);
+    void ResourceOperator::WaitPreviousFramePresented(const FrameContextSnapshot& frame_context)
+    {
+        return m_resource_manager->WaitPreviousFramePresented(frame_context);
+    }
 
-                std::shared_ptr<unsigned char[]> upload_data(
-                    new unsigned char[expected_byte_size],
-                    std::default_delete<unsigned char[]>());
-                std::memcpy(upload_data.get(), mip_desc.data.data(), expected_byte_size);
+    IRHICommandList& ResourceOperator::GetCommandListForRecordPassCommand(RenderPassHandle pass) const
+    {
+        return m_resource_manager->GetCommandListForRecordPassCommand(pass);
+    }
 
-                const RHITextureMipUploadInfo upload_info{
-                    upload_data,
-                    expected_byte_size,
-                    0,
-                    0,
-                    mip_desc.width,
-                    mip_desc.height,
-                    static_cast<unsigned>(mip_index)};
-                const bool uploaded = RHIUtilInstanceManager::Instance().UploadTextureData(
-                    m_resource_manager->GetCommandListForRecordPassCommand(),
-                    m_resource_manager->GetMemoryManager(),
-                    m_resource_manager->GetDevice(),
-                    *texture_allocation->m_texture,
-                    upload_info);
-                GLTF_CHECK(uploaded);
-            }
-        }
-        else if (has_base_data)
-        {
-            const bool has_data = texture_desc.SetTextureData(desc.data.data(), desc.data.size());
-            GLTF_CHECK(has_data);
-            created = m_resource_manager->GetMemoryManager().AllocateTextureMemoryAndUpload(
-                m_resource_manager->GetDevice(),
-                m_resource_manager->GetCommandListForRecordPassCommand(),
-                m_resource_manager->GetMemoryManager(),
-                texture_desc,
-                texture_allocation);
-        }
-        else
-        {
-            created = m_resource_manager->GetMemoryManager().AllocateTextureMemory(
-                m_resource_manager->GetDevice(),
-                texture_desc,
-                texture_allocation);
-        }
-        GLTF_CHECK(created);
+    IRHICommandList& ResourceOperator::GetCommandListForRecordPassCommand(const FrameContextSnapshot& frame_context, RenderPassHandle pass) const
+    {
+        return m_resource_manager->GetCommandListForRecordPassCommand(frame_context, pass);
+    }
 
-        texture_allocation->m_texture->Transition(
-            m_resource_manager->GetCommandListForRecordPassCommand(),
-            RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+    IRHICommandList& ResourceOperator::AcquireParallelRecordCommandList(const FrameContextSnapshot& frame_context, unsigned index) const
+    {
+        return m_resource_manager->AcquireParallelRecordCommandList(frame_context, index);
+    }
 
-        return InternalResourceHandleTable::Instance().RegisterTexture(texture_allocation);
+    bool ResourceOperator::SupportsAsyncCompute() const
+    {
+        return m_resource_manager->SupportsAsyncCompute();
     }
 
-    TextureHandle ResourceOperator::CreateTexture(const TextureFileDesc& desc)
+    IRHICommandQueue& ResourceOperator::GetAsyncComputeCommandQueue() const
     {
-        const std::wstring convert_path = to_wide_string(desc.uri);
-        ImageLoadResult result;
-        if (!glTFImageIOUtil::Instance().LoadImageByFilename(convert_path.c_str(), result))
-        {
-            GLTF_CHECK(false);
-            return NULL_HANDLE;
-        }
-        RHITextureDesc texture_desc{};
-        texture_desc.InitWithLoadedData(result);
+        return m_resource_manager->GetAsyncComputeCommandQueue();
+    }
 
-        std::shared_ptr<IRHITextureAllocation> texture_allocation = nullptr;
-        bool created = m_resource_manager->GetMemoryManager().AllocateTextureMemoryAndUpload(m_resource_manager->GetDevice(), m_resource_manager->GetCommandListForRecordPassCommand(), m_resource_manager->GetMemoryManager(), texture_desc, texture_allocation);
-        GLTF_CHECK(created);
+    IRHICommandList& ResourceOperator::AcquireAsyncComputeCommandList(const FrameContextSnapshot& frame_context, unsigned index) const
+    {
+        return m_resource_manager->AcquireAsyncComputeCommandList(frame_context, index);
+    }
 
-        texture_allocation->m_texture->Transition(m_resource_manager->GetCommandListForRecordPassCommand(), RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+    IRHISemaphore& ResourceOperator::AcquireQueueSyncSemaphore(const FrameContextSnapshot& frame_context, unsigned index) const
+    {
+        return m_resource_manager->AcquireQueueSyncSemaphore(frame_context, index);
+    }
 
-        return InternalResourceHandleTable::Instance().RegisterTexture(texture_allocation);
+    IRHIDescriptorManager& ResourceOperator::GetDescriptorManager() const
+    {
+        return m_resource_manager->GetMemoryManager().GetDescriptorManager();
     }
 
-    BufferHandle ResourceOperator::CreateBuffer(const BufferDesc& desc)
+    IRHIMemoryManager& ResourceOperator::GetMemoryManager() const
     {
-        return m_resource_manager->CreateBuffer(desc);
+        return m_resource_manager->GetMemoryManager();
     }
 
-    bool ResourceOperator::RetireBuffer(BufferHandle handle)
+    IRHICommandQueue& ResourceOperator::GetCommandQueue() const
     {
-        if (!m_resource_manager || !handle.IsValid())
-        {
-            return false;
-        }
+        return m_resource_manager->GetCommandQueue();
+    }
 
-        return m_resource_manager->RetireBuffer(handle);
+    IRHISwapChain& ResourceOperator::GetCurrentSwapchain() const
+    {
+        return m_resource_manager->GetSwapChain();
     }
 
-    IndexedBufferHandle ResourceOperator::CreateIndexedBuffer(const BufferDesc& desc)
+    unsigned ResourceOperator::GetCurrentRenderWidth() const
     {
-        return m_resource_manager->CreateIndexedBuffer(desc);   
+        return m_resource_manager->GetSwapChain().GetWidth();
     }
 
-    std::vector<BufferHandle> ResourceOperator::CreateFrameBufferedBuffers(const BufferDesc& desc, const std::string& debug_name_prefix)
+    unsigned ResourceOperator::GetCurrentRenderHeight() const
     {
-        const auto frame_context = GetFrameContext();
-        const unsigned frame_slot_count = frame_context.frame_slot_count;
-        std::vector<BufferHandle> buffers;
-        buffers.reserve(frame_slot_count);
+        return m_resource_manager->GetSwapChain().GetHeight();
+    }
 
-        std::string base_name = debug_name_prefix;
-        if (base_name.empty())
+    bool ResourceOperator::CleanupAllResources(bool clear_window_handles)
+    {
+        if (!m_resource_manager)
         {
-            base_name = desc.name.empty() ? "FrameBufferedBuffer" : desc.name;
+            return true;
         }
 
-        for (unsigned frame_index = 0; frame_index < frame_slot_count; ++frame_index)
-        {
-            BufferDesc frame_desc = desc;
-            frame_desc.name = base_name + "_frame_" + std::to_string(frame_index);
-            buffers.push_back(CreateBuffer(frame_desc));
-        }
+        m_resource_manager->WaitFrameRenderFinished();
+        m_resource_manager->WaitGPUIdle();
 
-        return buffers;
-    }
+        // Ensure profiler query pools are released while device/queue are still valid.
+        // RenderGraph may outlive ResourceOperator during runtime-RHI switch.
+        RHIUtilInstanceManager::Instance().ShutdownTimestampProfiler();
 
-    bool ResourceOperator::RetireFrameBufferedBuffers(const std::vector<BufferHandle>& buffers)
-    {
-        bool retired_all = !buffers.empty();
-        std::set<BufferHandle> unique_handles;
-        for (const auto handle : buffers)
-        {
-            if (!handle.IsValid() || !unique_handles.insert(handle).second)
-            {
-                continue;
-            }
+        auto& memory_manager = m_resource_manager->GetMemoryManager();
+        // Release memory-manager-owned allocations first (especially Vulkan VMA allocations),
+        // then release globally tracked RHI objects.
+        const bool released_allocations = memory_manager.ReleaseAllResource();
+        GLTF_CHECK(released_allocations);
+        const bool cleaned_resources = RHIResourceFactory::CleanupResources(memory_manager);
+        GLTF_CHECK(cleaned_resources);
 
-            retired_all = RetireBuffer(handle) && retired_all;
+        if (clear_window_handles)
+        {
+            InternalResourceHandleTable::Instance().ClearAll();
+        }
+        else
+        {
+            InternalResourceHandleTable::Instance().ClearRuntimeResources();
         }
 
-        return retired_all;
-    }
+        m_resource_manager.reset();
+        m_render_passes.clear();
+        m_frame_buffered_render_target_aliases.clear();
+        m_frame_buffered_render_target_alias_current.clear();
+        m_frame_buffered_render_targets.clear();
+        m_bindless_textures.clear();
 
-    BufferHandle ResourceOperator::GetFrameBufferedBufferHandle(const std::vector<BufferHandle>& buffers) const
-    {
-        return GetFrameBufferedBufferHandle(buffers, GetFrameContext());
+        return cleaned_resources && released_allocations;
     }
 
-    BufferHandle ResourceOperator::GetFrameBufferedBufferHandle(const std::vector<BufferHandle>& buffers, const FrameContextSnapshot& frame_context) const
+    void RenderGraph::DeferredReleaseQueue::Enqueue(
+        const std::shared_ptr<IRHIResource>& resource,
+        unsigned long long current_frame,
+        unsigned delay_frame)
     {
-        GLTF_CHECK(!buffers.empty());
-        const unsigned frame_slot = frame_context.per_frame_resource_binding_enabled
-            ? (frame_context.frame_slot_index % static_cast<unsigned>(buffers.size()))
-            : 0u;
-        return buffers[frame_slot];
-    }
+        if (!resource)
+        {
+            return;
+        }
 
-    void ResourceOperator::UploadFrameBufferedBufferData(const std::vector<BufferHandle>& buffers, const BufferUploadDesc& upload_desc)
-    {
-        if (buffers.empty())
+        const unsigned long long retire_frame = current_frame + delay_frame;
+        if (!entries.empty() && entries.back().retire_frame == retire_frame)
         {
+            entries.back().resources.push_back(resource);
             return;
         }
-        UploadBufferData(GetFrameBufferedBufferHandle(buffers), upload_desc);
+
+        DeferredReleaseEntry entry{};
+        entry.retire_frame = retire_frame;
+        entry.resources.push_back(resource);
+        entries.push_back(std::move(entry));
     }
 
-    std::vector<RenderTargetHandle> ResourceOperator::CreateFrameBufferedRenderTargets(const RenderTargetDesc& desc, const std::string& debug_name_prefix)
+    void RenderGraph::DeferredReleaseQueue::EnqueueRetainedObject(
+        std::shared_ptr<void> object,
+        unsigned long long current_frame,
+        unsigned delay_frame)
     {
-        const auto frame_context = GetFrameContext();
-        const unsigned frame_slot_count = frame_context.frame_slot_count;
-        std::vector<RenderTargetHandle> render_targets;
-        render_targets.reserve(frame_slot_count);
-
-        std::string base_name = debug_name_prefix;
-        if (base_name.empty())
+        if (!object)
         {
-            base_name = desc.name.empty() ? "FrameBufferedRenderTarget" : desc.name;
+            return;
         }
 
-        for (unsigned frame_index = 0; frame_index < frame_slot_count; ++frame_index)
+        const unsigned long long retire_frame = current_frame + delay_frame;
+        if (!entries.empty() && entries.back().retire_frame == retire_frame)
         {
-            RenderTargetDesc frame_desc = desc;
-            frame_desc.name = base_name + "_frame_" + std::to_string(frame_index);
-            render_targets.push_back(CreateRenderTarget(frame_desc));
+            entries.back().retained_objects.push_back(std::move(object));
+            return;
         }
 
-        return render_targets;
+        DeferredReleaseEntry entry{};
+        entry.retire_frame = retire_frame;
+        entry.retained_objects.push_back(std::move(object));
+        entries.push_back(std::move(entry));
     }
 
-    RenderTargetHandle ResourceOperator::GetFrameBufferedRenderTargetHandle(const std::vector<RenderTargetHandle>& render_targets) const
+    void RenderGraph::DeferredReleaseQueue::Flush(
+        IRHIMemoryManager& memory_manager,
+        unsigned long long current_frame,
+        bool force_release_all)
     {
-        return GetFrameBufferedRenderTargetHandle(render_targets, GetFrameContext());
+        while (!entries.empty())
+        {
+            if (!force_release_all && entries.front().retire_frame > current_frame)
+            {
+                break;
+            }
+
+            auto entry = std::move(entries.front());
+            entries.pop_front();
+            for (const auto& resource : entry.resources)
+            {
+                const bool released = RHIResourceFactory::ReleaseResource(memory_manager, resource);
+                GLTF_CHECK(released);
+            }
+        }
     }
 
-    RenderTargetHandle ResourceOperator::GetFrameBufferedRenderTargetHandle(const std::vector<RenderTargetHandle>& render_targets, const FrameContextSnapshot& frame_context) const
+    void RenderGraph::DeferredReleaseQueue::Clear()
     {
-        GLTF_CHECK(!render_targets.empty());
-        const unsigned frame_slot = frame_context.per_frame_resource_binding_enabled
-            ? (frame_context.frame_slot_index % static_cast<unsigned>(render_targets.size()))
-            : 0u;
-        return render_targets[frame_slot];
+        entries.clear();
     }
 
-    RenderTargetHandle ResourceOperator::CreateFrameBufferedRenderTargetAlias(const RenderTargetDesc& desc, const std::string& debug_name_prefix)
+    RenderGraph::RenderPassDescriptorResource* RenderGraph::DescriptorResourceStore::Find(RenderGraphNodeHandle node_handle)
     {
-        auto render_targets = CreateFrameBufferedRenderTargets(desc, debug_name_prefix);
-        GLTF_CHECK(!render_targets.empty());
-        const auto logical_handle = render_targets.front();
-        m_frame_buffered_render_target_aliases[logical_handle] = std::move(render_targets);
-        return logical_handle;
+        const auto it = resources.find(node_handle);
+        return it != resources.end() ? &it->second : nullptr;
     }
 
-    RenderTargetHandle ResourceOperator::CreateRenderTarget(const RenderTargetDesc& desc)
+    const RenderGraph::RenderPassDescriptorResource* RenderGraph::DescriptorResourceStore::Find(RenderGraphNodeHandle node_handle) const
     {
-        return m_resource_manager->CreateRenderTarget(desc);
+        const auto it = resources.find(node_handle);
+        return it != resources.end() ? &it->second : nullptr;
     }
 
-    bool ResourceOperator::RetireRenderTarget(RenderTargetHandle handle)
+    RenderGraph::RenderPassDescriptorResource& RenderGraph::DescriptorResourceStore::GetOrCreate(RenderGraphNodeHandle node_handle)
     {
-        if (!m_resource_manager || !handle.IsValid())
-        {
-            return false;
-        }
+        return resources[node_handle];
+    }
 
-        if (TryRetireTrackedRenderTargetAlias(handle))
-        {
-            return true;
-        }
+    void RenderGraph::DescriptorResourceStore::MarkUsed(RenderGraphNodeHandle node_handle, unsigned long long frame_index)
+    {
+        last_used_frames[node_handle] = frame_index;
+    }
 
-        return m_resource_manager->RetireRenderTarget(handle);
+    void RenderGraph::DescriptorResourceStore::Erase(RenderGraphNodeHandle node_handle)
+    {
+        resources.erase(node_handle);
+        last_used_frames.erase(node_handle);
     }
 
-    bool ResourceOperator::RetireFrameBufferedRenderTargets(const std::vector<RenderTargetHandle>& render_targets)
+    std::vector<RenderGraphNodeHandle> RenderGraph::DescriptorResourceStore::CollectExpiredInactiveHandles(
+        const std::set<RenderGraphNodeHandle>& active_node_handles,
+        unsigned long long current_frame,
+        unsigned retention_frame) const
     {
-        if (!m_resource_manager || render_targets.empty())
-        {
-            return false;
-        }
+        std::vector<RenderGraphNodeHandle> expired_handles;
+        expired_handles.reserve(resources.size());
 
-        if (TryRetireTrackedRenderTargetAlias(render_targets.front()))
+        for (const auto& resource_pair : resources)
         {
-            return true;
-        }
+            const auto node_handle = resource_pair.first;
+            if (active_node_handles.contains(node_handle))
+            {
+                continue;
+            }
 
-        bool retired_all = true;
-        std::set<RenderTargetHandle> unique_handles;
-        for (const auto handle : render_targets)
-        {
-            if (!handle.IsValid() || !unique_handles.insert(handle).second)
+            const auto last_used_it = last_used_frames.find(node_handle);
+            const unsigned long long last_used_frame =
+                last_used_it != last_used_frames.end() ? last_used_it->second : 0u;
+            if (current_frame < last_used_frame + retention_frame)
             {
                 continue;
             }
 
-            retired_all = m_resource_manager->RetireRenderTarget(handle) && retired_all;
+            expired_handles.push_back(node_handle);
         }
 
-        return retired_all;
+        return expired_handles;
     }
 
-    bool ResourceOperator::RetireFrameBufferedRenderTargetAlias(RenderTargetHandle logical_handle)
+    void RenderGraph::ExecutionPlanState::MarkDirty()
     {
-        if (!m_resource_manager)
-        {
-            return false;
-        }
-
-        return TryRetireTrackedRenderTargetAlias(logical_handle);
+        plan_dirty = true;
     }
 
-    RenderTargetHandle ResourceOperator::CreateRenderTarget(const std::string& name, unsigned width, unsigned height,
-        PixelFormat format, RenderTargetClearValue clear_value, ResourceUsage usage)
+    void RenderGraph::ExecutionPlanState::ResetCache()
     {
-        RendererInterface::RenderTargetDesc render_target_desc{};
-        render_target_desc.name = name;
-        render_target_desc.size_mode = RenderTargetSizeMode::FIXED;
-        render_target_desc.width = width;
-        render_target_desc.height = height;
-        render_target_desc.format = format;
-        render_target_desc.clear = clear_value;
-        render_target_desc.usage = usage; 
-        return  m_resource_manager->CreateRenderTarget(render_target_desc);
+        cached_execution_signature = 0;
+        cached_execution_node_count = 0;
+        cached_execution_graph_valid = true;
+        cached_execution_order.clear();
+        live_execution_order.clear();
+        culled_nodes.clear();
+        plan_dirty = true;
     }
 
-    RenderTargetHandle ResourceOperator::CreateFrameBufferedRenderTargetAlias(
-        const std::string& name,
-        unsigned width,
-        unsigned height,
-        PixelFormat format,
-        RenderTargetClearValue clear_value,
-        ResourceUsage usage)
+    bool RenderGraph::ExecutionPlanState::UpdateActiveNodeSet(
+        std::size_t active_node_set_signature,
+        std::size_t active_node_set_count)
     {
-        RendererInterface::RenderTargetDesc render_target_desc{};
-        render_target_desc.name = name;
-        render_target_desc.size_mode = RenderTargetSizeMode::FIXED;
-        render_target_desc.width = width;
-        render_target_desc.height = height;
-        render_target_desc.format = format;
-        render_target_desc.clear = clear_value;
-        render_target_desc.usage = usage;
-        return CreateFrameBufferedRenderTargetAlias(render_target_desc, name);
+        const bool changed =
+            active_node_set_signature != last_active_node_set_signature ||
+            active_node_set_count != last_active_node_set_count;
+        if (changed)
+        {
+            last_active_node_set_signature = active_node_set_signature;
+            last_active_node_set_count = active_node_set_count;
+        }
+
+        return changed;
     }
 
-    RenderTargetHandle ResourceOperator::CreateWindowRelativeRenderTarget(const std::string& name,
-        PixelFormat format, RenderTargetClearValue clear_value, ResourceUsage usage, float width_scale, float height_scale, unsigned min_width, unsigned min_height)
+    bool RenderGraph::ExecutionPlanState::CollectActiveNodes(
+        const std::set<RenderGraphNodeHandle>& active_node_handles,
+        std::vector<RenderGraphNodeHandle>& out_nodes)
     {
-        RendererInterface::RenderTargetDesc render_target_desc{};
-        render_target_desc.name = name;
-        render_target_desc.format = format;
-        render_target_desc.clear = clear_value;
-        render_target_desc.usage = usage;
-        render_target_desc.size_mode = RenderTargetSizeMode::WINDOW_RELATIVE;
-        render_target_desc.width_scale = width_scale;
-        render_target_desc.height_scale = height_scale;
-        render_target_desc.min_width = (std::max)(1u, min_width);
-        render_target_desc.min_height = (std::max)(1u, min_height);
+        out_nodes.clear();
+        out_nodes.reserve(active_node_handles.size());
 
-        const unsigned current_width = (std::max)(1u, GetCurrentRenderWidth());
-        const unsigned current_height = (std::max)(1u, GetCurrentRenderHeight());
-        render_target_desc.width = ComputeScaledExtent(current_width, render_target_desc.width_scale, render_target_desc.min_width);
-        render_target_desc.height = ComputeScaledExtent(current_height, render_target_desc.height_scale, render_target_desc.min_height);
-        return m_resource_manager->CreateRenderTarget(render_target_desc);
+        std::size_t active_node_set_signature = 1469598103934665603ULL;
+        for (const auto handle : active_node_handles)
+        {
+            out_nodes.push_back(handle);
+            HashCombine(active_node_set_signature, handle.value);
+        }
+
+        return UpdateActiveNodeSet(active_node_set_signature, out_nodes.size());
     }
 
-    RenderTargetHandle ResourceOperator::CreateFrameBufferedWindowRelativeRenderTarget(
-        const std::string& name,
-        PixelFormat format,
-        RenderTargetClearValue clear_value,
-        ResourceUsage usage,
-        float width_scale,
-        float height_scale,
-        unsigned min_width,
-        unsigned min_height)
+    RenderGraph::ExecutionPlanContext RenderGraph::ExecutionPlanState::BuildContext(
+        const std::vector<RenderGraphNodeHandle>& nodes,
+        const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
+        const std::set<RenderGraphNodeHandle>& registered_nodes) const
     {
-        RendererInterface::RenderTargetDesc render_target_desc{};
-        render_target_desc.name = name;
-        render_target_desc.format = format;
-        render_target_desc.clear = clear_value;
-        render_target_desc.usage = usage;
-        render_target_desc.size_mode = RenderTargetSizeMode::WINDOW_RELATIVE;
-        render_target_desc.width_scale = width_scale;
-        render_target_desc.height_scale = height_scale;
-        render_target_desc.min_width = (std::max)(1u, min_width);
-        render_target_desc.min_height = (std::max)(1u, min_height);
-
-        const unsigned current_width = (std::max)(1u, GetCurrentRenderWidth());
-        const unsigned current_height = (std::max)(1u, GetCurrentRenderHeight());
-        render_target_desc.width = ComputeScaledExtent(current_width, render_target_desc.width_scale, render_target_desc.min_width);
-        render_target_desc.height = ComputeScaledExtent(current_height, render_target_desc.height_scale, render_target_desc.min_height);
-        return CreateFrameBufferedRenderTargetAlias(render_target_desc, name);
+        return ExecutionPlanContext{
+            nodes,
+            render_graph_nodes,
+            registered_nodes,
+            cached_execution_order,
+            cached_execution_graph_valid,
+            cached_execution_signature,
+            cached_execution_node_count
+        };
     }
 
-    RenderPassHandle ResourceOperator::CreateRenderPass(const RenderPassDesc& desc)
+    RenderGraph::ExecutionPlanCacheState RenderGraph::ExecutionPlanState::BuildCacheState()
     {
-        std::shared_ptr<RenderPass> render_pass = std::make_shared<RenderPass>(desc);
-        if (!render_pass->InitRenderPass(*m_resource_manager))
-        {
-            LOG_FORMAT_FLUSH("[RenderPass][Init][Error] Failed to initialize render pass (type=%d, shader_count=%zu, rt_binding_count=%zu).\n",
-                             static_cast<int>(desc.type),
-                             desc.shaders.size(),
-                             desc.render_target_bindings.size());
-            return NULL_HANDLE;
-        }
-        
-        return InternalResourceHandleTable::Instance().RegisterRenderPass(render_pass);
+        return ExecutionPlanCacheState{
+            cached_execution_graph_valid,
+            cached_execution_order,
+            cached_execution_signature,
+            cached_execution_node_count
+        };
     }
 
-    RenderSceneHandle ResourceOperator::CreateRenderScene(const RenderSceneDesc& desc)
+    bool RenderGraph::ExecutionPlanState::IsCachedExecutionOrderMissing() const
     {
-        std::shared_ptr<RendererSceneGraph> scene_graph = std::make_shared<RendererSceneGraph>();
-        
-        glTFLoader loader;
-        bool loaded = loader.LoadFile(desc.scene_file_name);
-        GLTF_CHECK(loaded);
-        
-        bool added = scene_graph->InitializeRootNodeWithSceneFile_glTF(loader);
-        GLTF_CHECK(added);
-
-        const auto traverse_function = [](const RendererSceneNode& node)
-        {
-            return true;
-        };
-    
-        scene_graph->GetRootNode().Traverse(traverse_function);
-        
-        return InternalResourceHandleTable::Instance().RegisterRenderScene(scene_graph);
+        return cached_execution_graph_valid && cached_execution_order.empty();
     }
 
-    IRHIDevice& ResourceOperator::GetDevice() const
+    bool RenderGraph::ExecutionPlanState::ShouldRebuild(
+        bool active_node_set_changed,
+        bool should_update_dependency_diagnostics) const
     {
-        return m_resource_manager->GetDevice();
+        return plan_dirty ||
+            active_node_set_changed ||
+            IsCachedExecutionOrderMissing() ||
+            should_update_dependency_diagnostics;
     }
 
-    unsigned ResourceOperator::GetCurrentBackBufferIndex() const
+    void RenderGraph::ExecutionPlanState::MarkPlanApplied()
     {
-        return m_resource_manager->GetCurrentBackBufferIndex();
+        plan_dirty = false;
     }
 
-    unsigned ResourceOperator::GetCurrentFrameSlotIndex() const
+    void RenderGraph::DependencyDiagnosticsState::Reset()
     {
-        return m_resource_manager->GetCurrentFrameSlotIndex();
+        last_update_frame_index = 0;
+        frame_slot_resource_access_snapshots.clear();
+        frame_slot_resource_access_snapshot_valid.clear();
     }
 
-    unsigned ResourceOperator::GetFrameSlotCount() const
+    bool RenderGraph::DependencyDiagnosticsState::ShouldUpdate(
+        unsigned long long current_frame,
+        unsigned interval_frames) const
     {
-        return m_resource_manager->GetFrameSlotCount();
+        return (last_update_frame_index == 0u) ||
+            (current_frame <= last_update_frame_index) ||
+            ((current_frame - last_update_frame_index) >= static_cast<unsigned long long>(interval_frames));
     }
 
-    unsigned ResourceOperator::GetSwapchainImageCount() const
+    void RenderGraph::DependencyDiagnosticsState::MarkUpdated(unsigned long long current_frame)
     {
-        return m_resource_manager->GetSwapchainImageCount();
+        last_update_frame_index = current_frame;
     }
 
-    unsigned ResourceOperator::GetBackBufferCount() const
+    void RenderGraph::DependencyDiagnosticsState::EnsureCrossFrameHazardSnapshotStorage(unsigned window_size)
     {
-        return m_resource_manager->GetBackBufferCount();
+        if (frame_slot_resource_access_snapshots.size() == static_cast<std::size_t>(window_size) &&
+            frame_slot_resource_access_snapshot_valid.size() == static_cast<std::size_t>(window_size))
+        {
+            return;
+        }
+
+        frame_slot_resource_access_snapshots.clear();
+        frame_slot_resource_access_snapshots.resize(window_size);
+        frame_slot_resource_access_snapshot_valid.assign(window_size, 0u);
     }
 
-    FrameContextSnapshot ResourceOperator::GetFrameContext() const
+    const RenderGraph::FrameResourceAccessSnapshot* RenderGraph::DependencyDiagnosticsState::GetCrossFrameHazardSnapshot(
+        unsigned hazard_slot_index) const
     {
-        FrameContextSnapshot frame_context = m_resource_manager->GetFrameContext();
-        frame_context.per_frame_resource_binding_enabled = m_per_frame_resource_binding_enabled;
-        frame_context.profiler_slot_count = frame_context.frame_slot_count;
-        frame_context.profiler_slot_index = frame_context.frame_slot_index % frame_context.profiler_slot_count;
-        return frame_context;
+        if (hazard_slot_index >= frame_slot_resource_access_snapshot_valid.size() ||
+            hazard_slot_index >= frame_slot_resource_access_snapshots.size() ||
+            frame_slot_resource_access_snapshot_valid[hazard_slot_index] == 0u)
+        {
+            return nullptr;
+        }
+
+        return &frame_slot_resource_access_snapshots[hazard_slot_index];
     }
 
-    bool ResourceOperator::IsPerFrameResourceBindingEnabled() const
+    void RenderGraph::DependencyDiagnosticsState::UpdateCrossFrameHazardSnapshot(
+        unsigned hazard_slot_index,
+        FrameResourceAccessSnapshot snapshot)
     {
-        return m_per_frame_resource_binding_enabled;
+        GLTF_CHECK(hazard_slot_index < frame_slot_resource_access_snapshots.size());
+        GLTF_CHECK(hazard_slot_index < frame_slot_resource_access_snapshot_valid.size());
+        frame_slot_resource_access_snapshots[hazard_slot_index] = std::move(snapshot);
+        frame_slot_resource_access_snapshot_valid[hazard_slot_index] = 1u;
     }
 
-    void ResourceOperator::SetPerFrameResourceBindingEnabled(bool enable)
+    RenderGraph::RenderGraph(ResourceOperator& allocator, RenderWindow& window, bool enable_debug_ui)
+        : m_resource_allocator(allocator)
+        , m_window(window)
     {
-        m_per_frame_resource_binding_enabled = enable;
+        m_debug_ui_enabled = enable_debug_ui;
+        m_parallel_recording_state = std::make_unique<ParallelRecordingState>();
+        m_async_compute_state = std::make_unique<AsyncComputeState>();
+        m_render_pass_merge_state = std::make_unique<RenderPassMergeState>();
+        m_transient_aliasing_state = std::make_unique<TransientAliasingState>();
+        m_draw_validation_cache = std::make_unique<DrawValidationCache>();
+        m_frame_trace_state = std::make_unique<FrameTraceState>();
+        m_execution_plan_cache = std::make_unique<ExecutionPlanCache>();
+        m_validation_policy.log_interval_frames = (std::max)(1u, m_validation_policy.log_interval_frames);
+        m_validation_policy.cross_frame_hazard_check_interval_frames =
+            (std::max)(1u, m_validation_policy.cross_frame_hazard_check_interval_frames);
+        if (m_debug_ui_enabled)
+        {
+            GLTF_CHECK(InitDebugUI());
+        }
+        GLTF_CHECK(InitGPUProfiler());
     }
 
-    void ResourceOperator::ApplyFrameBufferedRenderTargetAliases()
+    RenderGraph::~RenderGraph()
     {
-        for (const auto& alias_pair : m_frame_buffered_render_target_aliases)
-        {
-            const auto logical_handle = alias_pair.first;
-            const auto& candidates = alias_pair.second;
-            if (candidates.empty())
-            {
-                continue;
-            }
+        ShutdownRuntimeServices();
+    }
 
-            const auto target_handle = GetFrameBufferedRenderTargetHandle(candidates);
-            auto target_render_target = InternalResourceHandleTable::Instance().GetRenderTarget(target_handle);
-            const bool updated = InternalResourceHandleTable::Instance().UpdateRenderTarget(logical_handle, target_render_target);
-            GLTF_CHECK(updated);
-            m_frame_buffered_render_target_alias_current[logical_handle] = target_handle;
-        }
+    RenderGraphNodeHandle RenderGraph::CreateRenderGraphNode(const RenderGraphNodeDesc& render_graph_node_desc)
+    {
+        RenderGraphNodeHandle result{static_cast<unsigned>(m_render_graph_nodes.size())};
+        m_render_graph_nodes.push_back(render_graph_node_desc);
+        m_execution_plan_state.MarkDirty();
+        return result;
     }
 
-    bool ResourceOperator::TryRetireTrackedRenderTargetAlias(RenderTargetHandle handle)
+    bool RenderGraph::BuildRenderGraphNodeFromSetup(
+        ResourceOperator& allocator,
+        const RenderPassSetupInfo& setup_info,
+        RenderGraphNodeDesc& out_render_graph_node_desc,
+        std::tuple<unsigned, unsigned, unsigned>& out_pruned_binding_counts)
     {
-        if (!m_resource_manager)
+        RendererInterface::RenderPassDesc render_pass_desc{};
+        render_pass_desc.type = setup_info.render_pass_type;
+        render_pass_desc.render_state = setup_info.render_state;
+
+        if (setup_info.render_pass_type == RendererInterface::RenderPassType::RAY_TRACING &&
+            !RHIUtilInstanceManager::Instance().SupportRayTracing(allocator.GetDevice()))
         {
+            const char* group_name = setup_info.debug_group.empty() ? "<group-empty>" : setup_info.debug_group.c_str();
+            const char* pass_name = setup_info.debug_name.empty() ? "<pass-empty>" : setup_info.debug_name.c_str();
+            LOG_FORMAT_FLUSH(
+                "[RenderGraph][Validation] Pass (%s/%s) requires ray-tracing pipeline support, but the current device was not created with that capability.\n",
+                group_name,
+                pass_name);
             return false;
         }
+    
+        for (const auto& shader_info : setup_info.shader_setup_infos)
+        {
+            RendererInterface::ShaderDesc shader_desc{};
+            shader_desc.shader_type = shader_info.shader_type; 
+            shader_desc.entry_point = shader_info.entry_function;
+            shader_desc.shader_file_name = shader_info.shader_file;
+            auto shader_handle = allocator.CreateShader(shader_desc);
+            
+            render_pass_desc.shaders.emplace(shader_info.shader_type, shader_handle);
+        }
+    
+        RendererInterface::RenderPassDrawDesc render_pass_draw_desc{};
+        for (const auto& module : setup_info.modules)
+        {
+            module->BindDrawCommands(render_pass_draw_desc);
+        }
 
-        auto alias_it = m_frame_buffered_render_target_aliases.end();
-        for (auto it = m_frame_buffered_render_target_aliases.begin(); it != m_frame_buffered_render_target_aliases.end(); ++it)
+        switch (setup_info.render_pass_type)
         {
-            if (it->first == handle ||
-                std::find(it->second.begin(), it->second.end(), handle) != it->second.end())
+        case RendererInterface::RenderPassType::GRAPHICS:
+            for (const auto& render_target : setup_info.render_targets)
             {
-                alias_it = it;
-                break;
+                render_pass_desc.render_target_bindings.push_back(render_target.second);
+                render_pass_draw_desc.render_target_resources.emplace(render_target.first, render_target.second);
             }
+            break;
+        case RendererInterface::RenderPassType::COMPUTE:
+            break;
+        case RendererInterface::RenderPassType::RAY_TRACING:
+            break;
+        }
+    
+        for (const auto& render_target : setup_info.sampled_render_targets)
+        {
+            render_pass_draw_desc.render_target_texture_resources[render_target.name] = render_target;
         }
 
-        if (alias_it == m_frame_buffered_render_target_aliases.end())
+        render_pass_draw_desc.texture_resources.insert(setup_info.texture_resources.begin(), setup_info.texture_resources.end());
+        render_pass_draw_desc.buffer_resources.insert(setup_info.buffer_resources.begin(), setup_info.buffer_resources.end());
+
+        auto exclude_named_bindings = [](auto& resource_map, const std::set<BindingName>& excluded_binding_names)
         {
-            return false;
+            unsigned removed_count = 0;
+            for (const auto& binding_name : excluded_binding_names)
+            {
+                removed_count += static_cast<unsigned>(resource_map.erase(binding_name));
+            }
+            return removed_count;
+        };
+
+        const unsigned excluded_buffer_count =
+            exclude_named_bindings(render_pass_draw_desc.buffer_resources, setup_info.excluded_buffer_bindings);
+        const unsigned excluded_texture_count =
+            exclude_named_bindings(render_pass_draw_desc.texture_resources, setup_info.excluded_texture_bindings);
+        const unsigned excluded_render_target_texture_count =
+            exclude_named_bindings(render_pass_draw_desc.render_target_texture_resources, setup_info.excluded_render_target_texture_bindings);
+        const unsigned total_excluded_binding_count =
+            excluded_buffer_count + excluded_texture_count + excluded_render_target_texture_count;
+        if (total_excluded_binding_count > 0)
+        {
+            const char* group_name = setup_info.debug_group.empty() ? "<group-empty>" : setup_info.debug_group.c_str();
+            const char* pass_name = setup_info.debug_name.empty() ? "<pass-empty>" : setup_info.debug_name.c_str();
+            LOG_FORMAT_FLUSH("[RenderGraph][Setup] Pass (%s/%s) excluded bindings by policy: buffer=%u, texture=%u, render_target_texture=%u.\n",
+                             group_name,
+                             pass_name,
+                             excluded_buffer_count,
+                             excluded_texture_count,
+                             excluded_render_target_texture_count);
+        }
+    
+        if (setup_info.execute_command.has_value())
+        {
+            render_pass_draw_desc.execute_commands.push_back(setup_info.execute_command.value());    
         }
+        render_pass_draw_desc.execute_commands.insert(
+            render_pass_draw_desc.execute_commands.end(),
+            setup_info.execute_commands.begin(),
+            setup_info.execute_commands.end());
 
-        std::set<RenderTargetHandle> unique_handles(alias_it->second.begin(), alias_it->second.end());
-        m_frame_buffered_render_target_alias_current.erase(alias_it->first);
-        m_frame_buffered_render_target_aliases.erase(alias_it);
+        render_pass_desc.viewport_width = setup_info.viewport_width;
+        render_pass_desc.viewport_height = setup_info.viewport_height;
+        
+        auto render_pass_handle = allocator.CreateRenderPass(render_pass_desc);
+        if (!render_pass_handle.IsValid())
+        {
+            return false;
+        }
 
-        bool retired_all = !unique_handles.empty();
-        for (const auto target_handle : unique_handles)
+        unsigned pruned_buffer_count = 0;
+        unsigned pruned_texture_count = 0;
+        unsigned pruned_render_target_texture_count = 0;
+        auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(render_pass_handle);
+        if (render_pass)
         {
-            if (!target_handle.IsValid())
+            auto prune_unmapped_named_resources = [&render_pass](auto& resource_map)
             {
-                continue;
-            }
+                unsigned pruned_count = 0;
+                for (auto it = resource_map.begin(); it != resource_map.end(); )
+                {
+                    if (!render_pass->HasRootSignatureAllocation(it->first))
+                    {
+                        it = resource_map.erase(it);
+                        ++pruned_count;
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                return pruned_count;
+            };
 
-            retired_all = m_resource_manager->RetireRenderTarget(target_handle) && retired_all;
+            pruned_buffer_count = prune_unmapped_named_resources(render_pass_draw_desc.buffer_resources);
+            pruned_texture_count = prune_unmapped_named_resources(render_pass_draw_desc.texture_resources);
+            pruned_render_target_texture_count = prune_unmapped_named_resources(render_pass_draw_desc.render_target_texture_resources);
         }
 
-        return retired_all;
+        out_render_graph_node_desc = RendererInterface::RenderGraphNodeDesc{};
+        out_render_graph_node_desc.draw_info = std::move(render_pass_draw_desc);
+        out_render_graph_node_desc.render_pass_handle = render_pass_handle;
+        out_render_graph_node_desc.render_state = setup_info.render_state;
+        out_render_graph_node_desc.queue_affinity = setup_info.queue_affinity;
+        out_render_graph_node_desc.dependency_render_graph_nodes = setup_info.dependency_render_graph_nodes;
+        out_render_graph_node_desc.pre_render_callback = setup_info.pre_render_callback;
+        out_render_graph_node_desc.debug_group = setup_info.debug_group;
+        out_render_graph_node_desc.debug_name = setup_info.debug_name;
+        out_pruned_binding_counts =
+            std::make_tuple(pruned_buffer_count, pruned_texture_count, pruned_render_target_texture_count);
+        return true;
     }
 
-    IRHITextureDescriptorAllocation& ResourceOperator::GetCurrentSwapchainRT() const
+    void RenderGraph::SyncAutoPrunedNamedBindingCounts(
+        RenderGraphNodeHandle render_graph_node_handle,
+        const RenderGraphNodeDesc& render_graph_node_desc,
+        const std::tuple<unsigned, unsigned, unsigned>& pruned_binding_counts)
     {
-        return m_resource_manager->GetCurrentSwapchainRT();
-    }
+        const auto [pruned_buffer_count, pruned_texture_count, pruned_render_target_texture_count] =
+            pruned_binding_counts;
+        const unsigned total_pruned_bindings =
+            pruned_buffer_count + pruned_texture_count + pruned_render_target_texture_count;
+        if (total_pruned_bindings == 0)
+        {
+            m_auto_pruned_named_binding_counts.erase(render_graph_node_handle);
+            return;
+        }
 
-    IRHITextureDescriptorAllocation& ResourceOperator::GetCurrentSwapchainRT(const FrameContextSnapshot& frame_context) const
-    {
-        return m_resource_manager->GetCurrentSwapchainRT(frame_context);
+        m_auto_pruned_named_binding_counts[render_graph_node_handle] = pruned_binding_counts;
+        const char* group_name = render_graph_node_desc.debug_group.empty() ? "<group-empty>" : render_graph_node_desc.debug_group.c_str();
+        const char* pass_name = render_graph_node_desc.debug_name.empty() ? "<pass-empty>" : render_graph_node_desc.debug_name.c_str();
+        LOG_FORMAT_FLUSH("[RenderGraph][Validation] Node %u (%s/%s) auto-pruned unmapped bindings: buffer=%u, texture=%u, render_target_texture=%u.\n",
+                         render_graph_node_handle.value,
+                         group_name,
+                         pass_name,
+                         pruned_buffer_count,
+                         pruned_texture_count,
+                         pruned_render_target_texture_count);
     }
 
-    bool ResourceOperator::HasCurrentSwapchainRT() const
+    void RenderGraph::RetireRenderGraphNodeResources(
+        RenderGraphNodeHandle render_graph_node_handle,
+        const FrameContextSnapshot& frame_context)
     {
-        return m_resource_manager->HasCurrentSwapchainRT();
-    }
+        auto* descriptor_resource = m_descriptor_resource_store.Find(render_graph_node_handle);
+        if (descriptor_resource)
+        {
+            ReleaseRenderPassDescriptorResource(*descriptor_resource, frame_context);
+            m_descriptor_resource_store.Erase(render_graph_node_handle);
+        }
 
-    void ResourceOperator::UploadBufferData(BufferHandle handle, const BufferUploadDesc& upload_desc)
-    {
-        auto buffer = InternalResourceHandleTable::Instance().GetBuffer(handle);
-        m_resource_manager->GetMemoryManager().UploadBufferData(m_resource_manager->GetDevice(), m_resource_manager->GetCommandListForRecordPassCommand(), *buffer, upload_desc.data, 0, upload_desc.size);
+        const auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        auto retired_render_pass = InternalResourceHandleTable::Instance().RemoveRenderPass(node_desc.render_pass_handle);
+        if (retired_render_pass)
+        {
+            EnqueueRetainedObjectForDeferredRelease(std::move(retired_render_pass), frame_context);
+        }
     }
 
-    void ResourceOperator::BeginFrame()
+    RenderGraphNodeHandle RenderGraph::CreateRenderGraphNode(ResourceOperator& allocator,const RenderPassSetupInfo& setup_info)
     {
-        return m_resource_manager->BeginFrame();
-    }
+        RendererInterface::RenderGraphNodeDesc render_graph_node_desc{};
+        std::tuple<unsigned, unsigned, unsigned> pruned_binding_counts{};
+        if (!BuildRenderGraphNodeFromSetup(allocator, setup_info, render_graph_node_desc, pruned_binding_counts))
+        {
+            return NULL_HANDLE;
+        }
 
-    void ResourceOperator::WaitFrameRenderFinished()
-    {
-        return m_resource_manager->WaitFrameRenderFinished();
+        auto render_graph_node_handle = CreateRenderGraphNode(render_graph_node_desc);
+        SyncAutoPrunedNamedBindingCounts(render_graph_node_handle, render_graph_node_desc, pruned_binding_counts);
+        return render_graph_node_handle;
     }
 
-    void ResourceOperator::WaitGPUIdle()
+    bool RenderGraph::RebuildRenderGraphNode(
+        ResourceOperator& allocator,
+        RenderGraphNodeHandle render_graph_node_handle,
+        const RenderPassSetupInfo& setup_info)
     {
-        return m_resource_manager->WaitGPUIdle();
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
 
-    void ResourceOperator::AdvanceFrameSlot()
-    {
-        return m_resource_manager->AdvanceFrameSlot();
-    }
+        RendererInterface::RenderGraphNodeDesc rebuilt_node_desc{};
+        std::tuple<unsigned, unsigned, unsigned> pruned_binding_counts{};
+        if (!BuildRenderGraphNodeFromSetup(allocator, setup_info, rebuilt_node_desc, pruned_binding_counts))
+        {
+            return false;
+        }
 
-    void ResourceOperator::InvalidateSwapchainResizeRequest()
-    {
-        return m_resource_manager->InvalidateSwapchainResizeRequest();
+        const auto frame_context = m_resource_allocator.GetFrameContext();
+        RetireRenderGraphNodeResources(render_graph_node_handle, frame_context);
+        m_render_graph_nodes[render_graph_node_handle.value] = std::move(rebuilt_node_desc);
+        m_pending_render_state_updates.erase(render_graph_node_handle);
+        m_render_pass_validation_last_log_frame.erase(render_graph_node_handle);
+        m_render_pass_validation_last_message_hash.erase(render_graph_node_handle);
+        // The rebuilt pass may reuse the address of the retired one.
+        m_draw_validation_cache->Clear();
+        SyncAutoPrunedNamedBindingCounts(
+            render_graph_node_handle,
+            m_render_graph_nodes[render_graph_node_handle.value],
+            pruned_binding_counts);
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        m_execution_plan_cache->entries.clear();
+        return true;
     }
 
-    WindowSurfaceSyncResult ResourceOperator::SyncWindowSurface(unsigned window_width, unsigned window_height)
+    bool RenderGraph::RegisterRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle)
     {
-        return m_resource_manager->SyncWindowSurface(window_width, window_height);
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        GLTF_CHECK(!m_render_graph_node_handles.contains(render_graph_node_handle));
+        m_render_graph_node_handles.insert(render_graph_node_handle);
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        return true;
     }
 
-    void ResourceOperator::NotifySwapchainAcquireFailure()
+    bool RenderGraph::RemoveRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle)
     {
-        return m_resource_manager->NotifySwapchainAcquireFailure();
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        const auto frame_context = m_resource_allocator.GetFrameContext();
+        m_render_graph_node_handles.erase(render_graph_node_handle);
+        m_pending_render_state_updates.erase(render_graph_node_handle);
+        RetireRenderGraphNodeResources(render_graph_node_handle, frame_context);
+        m_render_graph_nodes[render_graph_node_handle.value] = RenderGraphNodeDesc{};
 
-    void ResourceOperator::NotifySwapchainPresentFailure()
-    {
-        return m_resource_manager->NotifySwapchainPresentFailure();
-    }
+        m_auto_pruned_named_binding_counts.erase(render_graph_node_handle);
+        m_render_pass_validation_last_log_frame.erase(render_graph_node_handle);
+        m_render_pass_validation_last_message_hash.erase(render_graph_node_handle);
+        m_draw_validation_cache->Clear();
 
-    bool ResourceOperator::ResizeSwapchainIfNeeded(unsigned width, unsigned height)
-    {
-        return m_resource_manager->ResizeSwapchainIfNeeded(width, height);
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.ResetCache();
+        // Handles of removed nodes and their render passes may be handed out again.
+        m_execution_plan_cache->entries.clear();
+        return true;
     }
 
-    bool ResourceOperator::ResizeWindowDependentRenderTargets(unsigned width, unsigned height)
+    bool RenderGraph::UpdateComputeDispatch(RenderGraphNodeHandle render_graph_node_handle, unsigned group_size_x, unsigned group_size_y, unsigned group_size_z)
     {
-        return m_resource_manager->ResizeWindowDependentRenderTargets(width, height);
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
 
-    SwapchainLifecycleState ResourceOperator::GetSwapchainLifecycleState() const
-    {
-        return m_resource_manager->GetSwapchainLifecycleState();
-    }
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        for (auto& command : node_desc.draw_info.execute_commands)
+        {
+            if (command.type != ExecuteCommandType::COMPUTE_DISPATCH_COMMAND)
+            {
+                continue;
+            }
 
-    SwapchainResizePolicy ResourceOperator::GetSwapchainResizePolicy() const
-    {
-        return m_resource_manager->GetSwapchainResizePolicy();
-    }
+            command.parameter.dispatch_parameter.group_size_x = group_size_x;
+            command.parameter.dispatch_parameter.group_size_y = group_size_y;
+            command.parameter.dispatch_parameter.group_size_z = group_size_z;
+            // Like UpdateNodeExecuteCommands: dispatch sizes do not change the plan.
+            return true;
+        }
 
-    void ResourceOperator::SetSwapchainResizePolicy(const SwapchainResizePolicy& policy, bool reset_retry_state)
-    {
-        return m_resource_manager->SetSwapchainResizePolicy(policy, reset_retry_state);
+        return false;
     }
 
-    SwapchainPresentMode ResourceOperator::GetSwapchainPresentMode() const
+    bool RenderGraph::UpdateNodeExecuteCommands(RenderGraphNodeHandle render_graph_node_handle, const std::vector<RenderExecuteCommand>& execute_commands)
     {
-        return m_resource_manager->GetSwapchainPresentMode();
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
 
-    void ResourceOperator::SetSwapchainPresentMode(SwapchainPresentMode mode)
-    {
-        return m_resource_manager->SetSwapchainPresentMode(mode);
+        // Execute commands do not take part in resource access or ordering, so the plan stays valid.
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        node_desc.draw_info.execute_commands = execute_commands;
+        return true;
     }
 
-    IRHICommandList& ResourceOperator::GetCommandListForRecordPassCommand(RenderPassHandle pass) const
+    bool RenderGraph::UpdateNodeViewportRect(RenderGraphNodeHandle render_graph_node_handle, const RenderViewportRect& viewport_rect)
     {
-        return m_resource_manager->GetCommandListForRecordPassCommand(pass);
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        GLTF_CHECK(viewport_rect.offset_x >= 0 && viewport_rect.offset_y >= 0);
 
-    IRHICommandList& ResourceOperator::GetCommandListForRecordPassCommand(const FrameContextSnapshot& frame_context, RenderPassHandle pass) const
-    {
-        return m_resource_manager->GetCommandListForRecordPassCommand(frame_context, pass);
-    }
+        auto& current_rect = m_render_graph_nodes[render_graph_node_handle.value].viewport_rect;
+        if (current_rect.offset_x == viewport_rect.offset_x &&
+            current_rect.offset_y == viewport_rect.offset_y &&
+            current_rect.width == viewport_rect.width &&
+            current_rect.height == viewport_rect.height)
+        {
+            return true;
+        }
 
-    IRHIDescriptorManager& ResourceOperator::GetDescriptorManager() const
-    {
-        return m_resource_manager->GetMemoryManager().GetDescriptorManager();
+        // The rect is part of the planning signature, so a cached plan would replay stale viewports.
+        current_rect = viewport_rect;
+        m_execution_plan_state.MarkDirty();
+        return true;
     }
 
-    IRHIMemoryManager& ResourceOperator::GetMemoryManager() const
+    bool RenderGraph::QueueNodeRenderStateUpdate(RenderGraphNodeHandle render_graph_node_handle, const RenderStateDesc& render_state)
     {
-        return m_resource_manager->GetMemoryManager();
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
 
-    IRHICommandQueue& ResourceOperator::GetCommandQueue() const
-    {
-        return m_resource_manager->GetCommandQueue();
-    }
+        const auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
+        if (!render_pass || render_pass->GetRenderPassType() != RenderPassType::GRAPHICS)
+        {
+            return false;
+        }
+
+        const auto pending_it = m_pending_render_state_updates.find(render_graph_node_handle);
+        if (pending_it != m_pending_render_state_updates.end())
+        {
+            if (IsEquivalentRenderStateDesc(pending_it->second.render_state, render_state))
+            {
+                return true;
+            }
+        }
+        else if (IsEquivalentRenderStateDesc(node_desc.render_state, render_state))
+        {
+            return true;
+        }
 
-    IRHISwapChain& ResourceOperator::GetCurrentSwapchain() const
-    {
-        return m_resource_manager->GetSwapChain();
+        m_pending_render_state_updates[render_graph_node_handle] = PendingRenderStateUpdate{.render_state = render_state};
+        return true;
     }
 
-    unsigned ResourceOperator::GetCurrentRenderWidth() const
+    bool RenderGraph::UpdateNodeDependencies(
+        RenderGraphNodeHandle render_graph_node_handle,
+        const std::vector<RenderGraphNodeHandle>& dependency_render_graph_nodes)
     {
-        return m_resource_manager->GetSwapChain().GetWidth();
-    }
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
 
-    unsigned ResourceOperator::GetCurrentRenderHeight() const
-    {
-        return m_resource_manager->GetSwapChain().GetHeight();
-    }
+        for (const auto dependency_handle : dependency_render_graph_nodes)
+        {
+            GLTF_CHECK(dependency_handle.IsValid());
+            GLTF_CHECK(dependency_handle.value < m_render_graph_nodes.size());
+            if (dependency_handle == render_graph_node_handle)
+            {
+                return false;
+            }
+        }
 
-    bool ResourceOperator::CleanupAllResources(bool clear_window_handles)
-    {
-        if (!m_resource_manager)
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        if (node_desc.dependency_render_graph_nodes == dependency_render_graph_nodes)
         {
             return true;
         }
 
-        m_resource_manager->WaitFrameRenderFinished();
-        m_resource_manager->WaitGPUIdle();
-
-        // Ensure profiler query pools are released while device/queue are still valid.
-        // RenderGraph may outlive ResourceOperator during runtime-RHI switch.
-        RHIUtilInstanceManager::Instance().ShutdownTimestampProfiler();
+        node_desc.dependency_render_graph_nodes = dependency_render_graph_nodes;
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        return true;
+    }
 
-        auto& memory_manager = m_resource_manager->GetMemoryManager();
-        // Release memory-manager-owned allocations first (especially Vulkan VMA allocations),
-        // then release globally tracked RHI objects.
-        const bool released_allocations = memory_manager.ReleaseAllResource();
-        GLTF_CHECK(released_allocations);
-        const bool cleaned_resources = RHIResourceFactory::CleanupResources(memory_manager);
-        GLTF_CHECK(cleaned_resources);
+    bool RenderGraph::UpdateNodeBufferBinding(RenderGraphNodeHandle render_graph_node_handle, BindingName binding_name, BufferHandle buffer_handle)
+    {
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        GLTF_CHECK(buffer_handle != NULL_HANDLE);
 
-        if (clear_window_handles)
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        auto binding_it = node_desc.draw_info.buffer_resources.find(binding_name);
+        if (binding_it == node_desc.draw_info.buffer_resources.end())
         {
-            InternalResourceHandleTable::Instance().ClearAll();
+            return false;
         }
-        else
+
+        if (binding_it->second.buffer_handle == buffer_handle)
         {
-            InternalResourceHandleTable::Instance().ClearRuntimeResources();
+            return true;
         }
 
-        m_resource_manager.reset();
-        m_render_passes.clear();
-        m_frame_buffered_render_target_aliases.clear();
-        m_frame_buffered_render_target_alias_current.clear();
-
-        return cleaned_resources && released_allocations;
+        binding_it->second.buffer_handle = buffer_handle;
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        return true;
     }
 
-    void RenderGraph::DeferredReleaseQueue::Enqueue(
-        const std::shared_ptr<IRHIResource>& resource,
-        unsigned long long current_frame,
-        unsigned delay_frame)
+    bool RenderGraph::UpdateNodeRenderTargetBinding(
+        RenderGraphNodeHandle render_graph_node_handle,
+        RenderTargetHandle old_render_target_handle,
+        RenderTargetHandle new_render_target_handle)
     {
-        if (!resource)
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        GLTF_CHECK(old_render_target_handle != NULL_HANDLE);
+        GLTF_CHECK(new_render_target_handle != NULL_HANDLE);
+
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        auto binding_it = node_desc.draw_info.render_target_resources.find(old_render_target_handle);
+        if (binding_it == node_desc.draw_info.render_target_resources.end())
         {
-            return;
+            return false;
         }
 
-        const unsigned long long retire_frame = current_frame + delay_frame;
-        if (!entries.empty() && entries.back().retire_frame == retire_frame)
+        if (old_render_target_handle == new_render_target_handle)
         {
-            entries.back().resources.push_back(resource);
-            return;
+            return true;
         }
 
-        DeferredReleaseEntry entry{};
-        entry.retire_frame = retire_frame;
-        entry.resources.push_back(resource);
-        entries.push_back(std::move(entry));
+        if (node_desc.draw_info.render_target_resources.contains(new_render_target_handle))
+        {
+            return false;
+        }
+
+        const RenderTargetBindingDesc binding_desc = binding_it->second;
+        node_desc.draw_info.render_target_resources.erase(binding_it);
+        node_desc.draw_info.render_target_resources.emplace(new_render_target_handle, binding_desc);
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        return true;
     }
 
-    void RenderGraph::DeferredReleaseQueue::EnqueueRetainedObject(
-        std::shared_ptr<void> object,
-        unsigned long long current_frame,
-        unsigned delay_frame)
+    bool RenderGraph::UpdateNodeRenderTargetTextureBinding(
+        RenderGraphNodeHandle render_graph_node_handle,
+        BindingName binding_name,
+        const std::vector<RenderTargetHandle>& render_target_handles)
     {
-        if (!object)
+        GLTF_CHECK(render_graph_node_handle.IsValid());
+        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        if (render_target_handles.empty())
         {
-            return;
+            return false;
         }
 
-        const unsigned long long retire_frame = current_frame + delay_frame;
-        if (!entries.empty() && entries.back().retire_frame == retire_frame)
+        for (const auto render_target_handle : render_target_handles)
         {
-            entries.back().retained_objects.push_back(std::move(object));
-            return;
+            GLTF_CHECK(render_target_handle != NULL_HANDLE);
         }
 
-        DeferredReleaseEntry entry{};
-        entry.retire_frame = retire_frame;
-        entry.retained_objects.push_back(std::move(object));
-        entries.push_back(std::move(entry));
+        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
+        auto binding_it = node_desc.draw_info.render_target_texture_resources.find(binding_name);
+        if (binding_it == node_desc.draw_info.render_target_texture_resources.end())
+        {
+            return false;
+        }
+
+        binding_it->second.render_target_texture = render_target_handles;
+        m_dependency_diagnostics_state.Reset();
+        m_execution_plan_state.MarkDirty();
+        return true;
     }
 
-    void RenderGraph::DeferredReleaseQueue::Flush(
-        IRHIMemoryManager& memory_manager,
-        unsigned long long current_frame,
-        bool force_release_all)
+    bool RenderGraph::UpdateNodeRenderTargetTextureBinding(
+        RenderGraphNodeHandle render_graph_node_handle,
+        BindingName binding_name,
+        RenderTargetHandle render_target_handle)
     {
-        while (!entries.empty())
+        return UpdateNodeRenderTargetTextureBinding(
+            render_graph_node_handle,
+            binding_name,
+            std::vector<RenderTargetHandle>{render_target_handle});
+    }
+
+    bool RenderGraph::CompileRenderPassAndExecute()
+    {
+        m_window.RegisterTickCallback([this](unsigned long long interval)
         {
-            if (!force_release_all && entries.front().retire_frame > current_frame)
-            {
-                break;
-            }
+            OnFrameTick(interval);
+        });
 
-            auto entry = std::move(entries.front());
-            entries.pop_front();
-            for (const auto& resource : entry.resources)
-            {
-                const bool released = RHIResourceFactory::ReleaseResource(memory_manager, resource);
-                GLTF_CHECK(released);
-            }
-        }
+        return true;
     }
 
-    void RenderGraph::DeferredReleaseQueue::Clear()
+    void RenderGraph::OnFrameTick(unsigned long long interval)
     {
-        entries.clear();
-    }
+        m_current_frame_timing_breakdown = {};
+        const auto frame_begin = std::chrono::steady_clock::now();
+
+        FramePreparationContext frame_context{};
+        const auto prepare_begin = std::chrono::steady_clock::now();
+        if (!PrepareFrameForRendering(interval, frame_context))
+        {
+            const auto prepare_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.prepare_frame_ms = ToMilliseconds(prepare_begin, prepare_end);
+            const auto frame_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.frame_index = m_frame_index;
+            m_current_frame_timing_breakdown.frame_total_ms = ToMilliseconds(frame_begin, frame_end);
+            m_current_frame_timing_breakdown.non_pass_cpu_ms = m_current_frame_timing_breakdown.frame_total_ms;
+            m_current_frame_timing_breakdown.untracked_ms =
+                (std::max)(0.0f, m_current_frame_timing_breakdown.frame_total_ms - m_current_frame_timing_breakdown.prepare_frame_ms);
+            m_current_frame_timing_breakdown.valid = false;
+            m_last_frame_timing_breakdown = m_current_frame_timing_breakdown;
+            UpdateFrameTrace();
+            return;
+        }
+        const auto prepare_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.prepare_frame_ms = ToMilliseconds(prepare_begin, prepare_end);
+        m_current_frame_timing_breakdown.frame_index = m_frame_index;
+
+        const auto execute_begin = std::chrono::steady_clock::now();
+        ExecuteRenderGraphFrame(frame_context, interval);
+        const auto execute_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.execute_render_graph_ms = ToMilliseconds(execute_begin, execute_end);
+
+        GLTF_CHECK(frame_context.command_list);
+        const bool swapchain_ready = AcquireCurrentFrameSwapchain(frame_context);
+        if (swapchain_ready)
+        {
+            const auto blit_begin = std::chrono::steady_clock::now();
+            BlitFinalOutputToSwapchain(
+                *frame_context.command_list,
+                frame_context.presentation_frame_context,
+                frame_context.window_width,
+                frame_context.window_height);
+            const auto blit_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.blit_to_swapchain_ms = ToMilliseconds(blit_begin, blit_end);
+        }
+
+        const auto finalize_begin = std::chrono::steady_clock::now();
+        FinalizeFrameSubmission(frame_context, swapchain_ready);
+        const auto finalize_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.finalize_submission_ms = ToMilliseconds(finalize_begin, finalize_end);
+
+        const auto frame_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.frame_total_ms = ToMilliseconds(frame_begin, frame_end);
+        m_current_frame_timing_breakdown.non_pass_cpu_ms = (std::max)(
+            0.0f,
+            m_current_frame_timing_breakdown.frame_total_ms - m_current_frame_timing_breakdown.execute_passes_ms);
+        const float tracked_frame_section_ms =
+            m_current_frame_timing_breakdown.prepare_frame_ms +
+            m_current_frame_timing_breakdown.execute_render_graph_ms +
+            m_current_frame_timing_breakdown.blit_to_swapchain_ms +
+            m_current_frame_timing_breakdown.finalize_submission_ms;
+        m_current_frame_timing_breakdown.untracked_ms = (std::max)(
+            0.0f,
+            m_current_frame_timing_breakdown.frame_total_ms - tracked_frame_section_ms);
+        m_current_frame_timing_breakdown.frame_wait_total_ms =
+            m_current_frame_timing_breakdown.wait_previous_frame_ms +
+            m_current_frame_timing_breakdown.acquire_command_list_ms +
+            m_current_frame_timing_breakdown.acquire_swapchain_ms +
+            m_current_frame_timing_breakdown.submit_command_list_ms +
+            m_current_frame_timing_breakdown.wait_previous_present_ms +
+            m_current_frame_timing_breakdown.present_call_ms;
+        m_current_frame_timing_breakdown.valid = true;
+        m_last_frame_timing_breakdown = m_current_frame_timing_breakdown;
 
-    RenderGraph::RenderPassDescriptorResource* RenderGraph::DescriptorResourceStore::Find(RenderGraphNodeHandle node_handle)
-    {
-        const auto it = resources.find(node_handle);
-        return it != resources.end() ? &it->second : nullptr;
+        if (IsCapturingFrameTrace(m_frame_index))
+        {
+            RecordFrameTraceSpan("frame", "Frame", ToTimelineMilliseconds(frame_begin), ToTimelineMilliseconds(frame_end));
+            RecordFrameTraceSpan("frame", "Prepare frame", ToTimelineMilliseconds(prepare_begin), ToTimelineMilliseconds(prepare_end));
+            RecordFrameTraceSpan("frame", "Execute render graph", ToTimelineMilliseconds(execute_begin), ToTimelineMilliseconds(execute_end));
+            RecordFrameTraceSpan("frame", "Finalize submission", ToTimelineMilliseconds(finalize_begin), ToTimelineMilliseconds(finalize_end));
+        }
+        UpdateFrameTrace();
     }
 
-    const RenderGraph::RenderPassDescriptorResource* RenderGraph::DescriptorResourceStore::Find(RenderGraphNodeHandle node_handle) const
+    bool RenderGraph::ResolveFinalColorOutput()
     {
-        const auto it = resources.find(node_handle);
-        return it != resources.end() ? &it->second : nullptr;
-    }
+        m_final_color_output = nullptr;
+        if (m_final_color_output_render_target_handle != NULL_HANDLE)
+        {
+            auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(m_final_color_output_render_target_handle);
+            m_final_color_output = render_target->m_source;
+        }
+        else if (m_final_color_output_texture_handle != NULL_HANDLE)
+        {
+            auto texture = InternalResourceHandleTable::Instance().GetTexture(m_final_color_output_texture_handle);
+            m_final_color_output = texture->m_texture;
+        }
 
-    RenderGraph::RenderPassDescriptorResource& RenderGraph::DescriptorResourceStore::GetOrCreate(RenderGraphNodeHandle node_handle)
-    {
-        return resources[node_handle];
-    }
+        if (!m_final_color_output)
+        {
+            if (!m_missing_final_color_output_logged)
+            {
+                LOG_FORMAT_FLUSH(
+                    "[RenderGraph] Missing final color output. Register a texture/render target via RegisterTextureToColorOutput/RegisterRenderTargetToColorOutput.\n");
+                m_missing_final_color_output_logged = true;
+            }
+            return false;
+        }
 
-    void RenderGraph::DescriptorResourceStore::MarkUsed(RenderGraphNodeHandle node_handle, unsigned long long frame_index)
-    {
-        last_used_frames[node_handle] = frame_index;
+        m_missing_final_color_output_logged = false;
+        return true;
     }
 
-    void RenderGraph::DescriptorResourceStore::Erase(RenderGraphNodeHandle node_handle)
+    void RenderGraph::ExecuteTickAndDebugUI(unsigned long long interval)
     {
-        resources.erase(node_handle);
-        last_used_frames.erase(node_handle);
-    }
+        const auto tick_and_ui_begin = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.tick_callback_ms = 0.0f;
+        m_current_frame_timing_breakdown.tick_other_ms = 0.0f;
+        m_current_frame_timing_breakdown.module_tick_ms = 0.0f;
+        m_current_frame_timing_breakdown.system_tick_ms = 0.0f;
+        m_current_frame_timing_breakdown.debug_ui_build_ms = 0.0f;
 
-    std::vector<RenderGraphNodeHandle> RenderGraph::DescriptorResourceStore::CollectExpiredInactiveHandles(
-        const std::set<RenderGraphNodeHandle>& active_node_handles,
-        unsigned long long current_frame,
-        unsigned retention_frame) const
-    {
-        std::vector<RenderGraphNodeHandle> expired_handles;
-        expired_handles.reserve(resources.size());
+        if (m_tick_callback)
+        {
+            const auto tick_begin = std::chrono::steady_clock::now();
+            m_tick_callback(interval);
+            const auto tick_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.tick_callback_ms = ToMilliseconds(tick_begin, tick_end);
+            RecordFrameTraceSpan("frame", "Tick", ToTimelineMilliseconds(tick_begin), ToTimelineMilliseconds(tick_end));
+        }
 
-        for (const auto& resource_pair : resources)
+        if (m_debug_ui_enabled && m_debug_ui_initialized)
         {
-            const auto node_handle = resource_pair.first;
-            if (active_node_handles.contains(node_handle))
+            const auto debug_ui_build_begin = std::chrono::steady_clock::now();
+            GLTF_CHECK(RHIUtilInstanceManager::Instance().NewGUIFrame());
+            ImGui_ImplGlfw_NewFrame();
+            ImGui::NewFrame();
+
+            if (m_debug_ui_callback)
             {
-                continue;
+                m_debug_ui_callback();
             }
-
-            const auto last_used_it = last_used_frames.find(node_handle);
-            const unsigned long long last_used_frame =
-                last_used_it != last_used_frames.end() ? last_used_it->second : 0u;
-            if (current_frame < last_used_frame + retention_frame)
+            else
             {
-                continue;
+                const bool framework_window_visible = ImGui::Begin("Renderer Framework");
+                if (framework_window_visible)
+                {
+                    DrawFrameworkDebugUI();
+                }
+                ImGui::End();
             }
-
-            expired_handles.push_back(node_handle);
+            const auto debug_ui_build_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.debug_ui_build_ms =
+                ToMilliseconds(debug_ui_build_begin, debug_ui_build_end);
         }
 
-        return expired_handles;
-    }
-
-    void RenderGraph::ExecutionPlanState::MarkDirty()
-    {
-        plan_dirty = true;
+        const auto tick_and_ui_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.tick_and_debug_ui_build_ms =
+            ToMilliseconds(tick_and_ui_begin, tick_and_ui_end);
     }
 
-    void RenderGraph::ExecutionPlanState::ResetCache()
+    bool RenderGraph::SyncWindowSurfaceAndAdvanceFrame(FramePreparationContext& frame_context, unsigned long long interval)
     {
-        cached_execution_signature = 0;
-        cached_execution_node_count = 0;
-        cached_execution_graph_valid = true;
-        cached_execution_order.clear();
-        plan_dirty = true;
-    }
+        (void)interval;
+        m_resource_allocator.BeginFrame();
 
-    bool RenderGraph::ExecutionPlanState::UpdateActiveNodeSet(
-        std::size_t active_node_set_signature,
-        std::size_t active_node_set_count)
-    {
-        const bool changed =
-            active_node_set_signature != last_active_node_set_signature ||
-            active_node_set_count != last_active_node_set_count;
-        if (changed)
+        const auto surface_sync_begin = std::chrono::steady_clock::now();
+        const auto surface_sync_result = m_resource_allocator.SyncWindowSurface(frame_context.window_width, frame_context.window_height);
+        const auto surface_sync_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.sync_window_surface_ms = ToMilliseconds(surface_sync_begin, surface_sync_end);
+        if (surface_sync_result.status == WindowSurfaceSyncStatus::MINIMIZED)
         {
-            last_active_node_set_signature = active_node_set_signature;
-            last_active_node_set_count = active_node_set_count;
+            return false;
         }
-
-        return changed;
-    }
-
-    bool RenderGraph::ExecutionPlanState::CollectActiveNodes(
-        const std::set<RenderGraphNodeHandle>& active_node_handles,
-        std::vector<RenderGraphNodeHandle>& out_nodes)
-    {
-        out_nodes.clear();
-        out_nodes.reserve(active_node_handles.size());
-
-        std::size_t active_node_set_signature = 1469598103934665603ULL;
-        for (const auto handle : active_node_handles)
+        if (surface_sync_result.status == WindowSurfaceSyncStatus::INVALID || !m_resource_allocator.HasCurrentSwapchainRT())
         {
-            out_nodes.push_back(handle);
-            HashCombine(active_node_set_signature, handle.value);
+            m_resource_allocator.InvalidateSwapchainResizeRequest();
+            return false;
+        }
+        if (surface_sync_result.status == WindowSurfaceSyncStatus::RESIZED)
+        {
+            // Whether a render area covers its attachments, and so which stores can be dropped, depends on the
+            // render target sizes.
+            m_execution_plan_state.MarkDirty();
+            m_execution_plan_cache->entries.clear();
         }
 
-        return UpdateActiveNodeSet(active_node_set_signature, out_nodes.size());
-    }
+        m_resource_allocator.AdvanceFrameSlot();
+        frame_context.resource_frame_context = m_resource_allocator.GetFrameContext();
 
-    RenderGraph::ExecutionPlanContext RenderGraph::ExecutionPlanState::BuildContext(
-        const std::vector<RenderGraphNodeHandle>& nodes,
-        const std::vector<RenderGraphNodeDesc>& render_graph_nodes,
-        const std::set<RenderGraphNodeHandle>& registered_nodes) const
-    {
-        return ExecutionPlanContext{
-            nodes,
-            render_graph_nodes,
-            registered_nodes,
-            cached_execution_order,
-            cached_execution_graph_valid,
-            cached_execution_signature,
-            cached_execution_node_count
-        };
-    }
+        frame_context.require_explicit_frame_wait =
+            surface_sync_result.status != WindowSurfaceSyncStatus::RESIZED &&
+            RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12;
+        const auto deferred_release_begin = std::chrono::steady_clock::now();
+        ++m_frame_index;
+        FlushDeferredResourceReleases(false);
+        const auto deferred_release_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.deferred_release_ms = ToMilliseconds(deferred_release_begin, deferred_release_end);
 
-    RenderGraph::ExecutionPlanCacheState RenderGraph::ExecutionPlanState::BuildCacheState()
-    {
-        return ExecutionPlanCacheState{
-            cached_execution_graph_valid,
-            cached_execution_order,
-            cached_execution_signature,
-            cached_execution_node_count
-        };
+        return true;
     }
 
-    bool RenderGraph::ExecutionPlanState::IsCachedExecutionOrderMissing() const
+    bool RenderGraph::AcquireCurrentFrameCommandContext(FramePreparationContext& frame_context)
     {
-        return cached_execution_graph_valid && cached_execution_order.empty();
-    }
+        const auto acquire_context_begin = std::chrono::steady_clock::now();
+        frame_context.profiler_slot_index = frame_context.resource_frame_context.profiler_slot_index;
 
-    bool RenderGraph::ExecutionPlanState::ShouldRebuild(
-        bool active_node_set_changed,
-        bool should_update_dependency_diagnostics) const
-    {
-        return plan_dirty ||
-            active_node_set_changed ||
-            IsCachedExecutionOrderMissing() ||
-            should_update_dependency_diagnostics;
-    }
+        const auto resolve_profiler_begin = std::chrono::steady_clock::now();
+        ResolveGPUProfilerFrame(frame_context.profiler_slot_index);
+        const auto resolve_profiler_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.resolve_gpu_profiler_ms = ToMilliseconds(resolve_profiler_begin, resolve_profiler_end);
 
-    void RenderGraph::ExecutionPlanState::MarkPlanApplied()
-    {
-        plan_dirty = false;
-    }
+        if (!m_resource_allocator.HasCurrentSwapchainRT())
+        {
+            frame_context.command_list = nullptr;
+            m_current_frame_timing_breakdown.acquire_context_ms =
+                ToMilliseconds(acquire_context_begin, std::chrono::steady_clock::now());
+            return false;
+        }
 
-    void RenderGraph::DependencyDiagnosticsState::Reset()
-    {
-        last_update_frame_index = 0;
-        frame_slot_resource_access_snapshots.clear();
-        frame_slot_resource_access_snapshot_valid.clear();
-    }
+        if (frame_context.require_explicit_frame_wait)
+        {
+            const auto wait_begin = std::chrono::steady_clock::now();
+            m_resource_allocator.WaitFrameRenderFinished();
+            const auto wait_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.wait_previous_frame_ms = ToMilliseconds(wait_begin, wait_end);
+            RecordFrameTraceSpan("wait", "Wait frame slot fence", ToTimelineMilliseconds(wait_begin), ToTimelineMilliseconds(wait_end));
+        }
+        // Low latency waits for the previous frame to reach the display before the tick samples input and
+        // advances the simulation, so what this frame shows is as fresh as the present queue allows.
+        if (m_resource_allocator.GetFrameLatencyMode() == FrameLatencyMode::LOW_LATENCY)
+        {
+            const auto wait_present_begin = std::chrono::steady_clock::now();
+            m_resource_allocator.WaitPreviousFramePresented(frame_context.resource_frame_context);
+            const auto wait_present_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.wait_previous_present_ms = ToMilliseconds(wait_present_begin, wait_present_end);
+            RecordFrameTraceSpan("wait", "Wait previous present", ToTimelineMilliseconds(wait_present_begin), ToTimelineMilliseconds(wait_present_end));
+        }
+        // Descriptors freed while this frame slot was last in flight can be handed out again.
+        m_resource_allocator.GetDescriptorManager().BeginFrame(m_frame_index);
 
-    bool RenderGraph::DependencyDiagnosticsState::ShouldUpdate(
-        unsigned long long current_frame,
-        unsigned interval_frames) const
-    {
-        return (last_update_frame_index == 0u) ||
-            (current_frame <= last_update_frame_index) ||
-            ((current_frame - last_update_frame_index) >= static_cast<unsigned long long>(interval_frames));
-    }
+        const auto acquire_command_list_begin = std::chrono::steady_clock::now();
+        frame_context.command_list = &m_resource_allocator.GetCommandListForRecordPassCommand(frame_context.resource_frame_context);
+        const auto acquire_command_list_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.acquire_command_list_ms =
+            ToMilliseconds(acquire_command_list_begin, acquire_command_list_end);
 
-    void RenderGraph::DependencyDiagnosticsState::MarkUpdated(unsigned long long current_frame)
-    {
-        last_update_frame_index = current_frame;
+        m_current_frame_timing_breakdown.acquire_context_ms =
+            ToMilliseconds(acquire_context_begin, std::chrono::steady_clock::now());
+        return true;
     }
 
-    void RenderGraph::DependencyDiagnosticsState::EnsureCrossFrameHazardSnapshotStorage(unsigned window_size)
+    bool RenderGraph::PrepareFrameForRendering(unsigned long long interval, FramePreparationContext& frame_context)
     {
-        if (frame_slot_resource_access_snapshots.size() == static_cast<std::size_t>(window_size) &&
-            frame_slot_resource_access_snapshot_valid.size() == static_cast<std::size_t>(window_size))
+        if (!ResolveFinalColorOutput())
         {
-            return;
+            return false;
         }
 
-        frame_slot_resource_access_snapshots.clear();
-        frame_slot_resource_access_snapshots.resize(window_size);
-        frame_slot_resource_access_snapshot_valid.assign(window_size, 0u);
-    }
+        frame_context.window_width = m_window.GetWidth();
+        frame_context.window_height = m_window.GetHeight();
+        if (frame_context.window_width == 0 || frame_context.window_height == 0)
+        {
+            return false;
+        }
 
-    const RenderGraph::FrameResourceAccessSnapshot* RenderGraph::DependencyDiagnosticsState::GetCrossFrameHazardSnapshot(
-        unsigned hazard_slot_index) const
-    {
-        if (hazard_slot_index >= frame_slot_resource_access_snapshot_valid.size() ||
-            hazard_slot_index >= frame_slot_resource_access_snapshots.size() ||
-            frame_slot_resource_access_snapshot_valid[hazard_slot_index] == 0u)
+        if (!SyncWindowSurfaceAndAdvanceFrame(frame_context, interval))
         {
-            return nullptr;
+            return false;
         }
 
-        return &frame_slot_resource_access_snapshots[hazard_slot_index];
-    }
+        ApplyPendingRenderStateUpdates(frame_context.resource_frame_context);
+        if (!AcquireCurrentFrameCommandContext(frame_context))
+        {
+            return false;
+        }
 
-    void RenderGraph::DependencyDiagnosticsState::UpdateCrossFrameHazardSnapshot(
-        unsigned hazard_slot_index,
-        FrameResourceAccessSnapshot snapshot)
-    {
-        GLTF_CHECK(hazard_slot_index < frame_slot_resource_access_snapshots.size());
-        GLTF_CHECK(hazard_slot_index < frame_slot_resource_access_snapshot_valid.size());
-        frame_slot_resource_access_snapshots[hazard_slot_index] = std::move(snapshot);
-        frame_slot_resource_access_snapshot_valid[hazard_slot_index] = 1u;
+        ExecuteTickAndDebugUI(interval);
+        return true;
     }
 
-    RenderGraph::RenderGraph(ResourceOperator& allocator, RenderWindow& window, bool enable_debug_ui)
-        : m_resource_allocator(allocator)
-        , m_window(window)
+    void RenderGraph::ExecuteRenderGraphFrame(FramePreparationContext& frame_context, unsigned long long interval)
     {
-        m_debug_ui_enabled = enable_debug_ui;
-        m_validation_policy.log_interval_frames = (std::max)(1u, m_validation_policy.log_interval_frames);
-        m_validation_policy.cross_frame_hazard_check_interval_frames =
-            (std::max)(1u, m_validation_policy.cross_frame_hazard_check_interval_frames);
-        if (m_debug_ui_enabled)
+        BeginRenderDocFrameCapture();
+        BeginPIXFrameCapture();
+        const auto planning_begin = std::chrono::steady_clock::now();
+        m_resource_allocator.ApplyFrameBufferedRenderTargetAliases();
+        if (m_final_color_output_render_target_handle != NULL_HANDLE)
         {
-            GLTF_CHECK(InitDebugUI());
+            auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(m_final_color_output_render_target_handle);
+            m_final_color_output = render_target->m_source;
         }
-        GLTF_CHECK(InitGPUProfiler());
-    }
 
-    RenderGraph::~RenderGraph()
-    {
-        ShutdownRuntimeServices();
-    }
+        std::vector<RenderGraphNodeHandle> nodes;
+        const bool active_node_set_changed =
+            m_execution_plan_state.CollectActiveNodes(m_render_graph_node_handles, nodes);
 
-    RenderGraphNodeHandle RenderGraph::CreateRenderGraphNode(const RenderGraphNodeDesc& render_graph_node_desc)
-    {
-        RenderGraphNodeHandle result{static_cast<unsigned>(m_render_graph_nodes.size())};
-        m_render_graph_nodes.push_back(render_graph_node_desc);
-        m_execution_plan_state.MarkDirty();
-        return result;
-    }
+        const ExecutionPlanContext plan_context =
+            m_execution_plan_state.BuildContext(nodes, m_render_graph_nodes, m_render_graph_node_handles);
 
-    bool RenderGraph::BuildRenderGraphNodeFromSetup(
-        ResourceOperator& allocator,
-        const RenderPassSetupInfo& setup_info,
-        RenderGraphNodeDesc& out_render_graph_node_desc,
-        std::tuple<unsigned, unsigned, unsigned>& out_pruned_binding_counts)
-    {
-        RendererInterface::RenderPassDesc render_pass_desc{};
-        render_pass_desc.type = setup_info.render_pass_type;
-        render_pass_desc.render_state = setup_info.render_state;
+        const unsigned hazard_check_interval_frames =
+            (std::max)(1u, m_validation_policy.cross_frame_hazard_check_interval_frames);
+        const bool should_update_dependency_diagnostics =
+            m_dependency_diagnostics_state.ShouldUpdate(m_frame_index, hazard_check_interval_frames);
+        const bool should_rebuild_execution_plan =
+            m_execution_plan_state.ShouldRebuild(active_node_set_changed, should_update_dependency_diagnostics);
 
-        if (setup_info.render_pass_type == RendererInterface::RenderPassType::RAY_TRACING &&
-            !RHIUtilInstanceManager::Instance().SupportRayTracing(allocator.GetDevice()))
-        {
-            const char* group_name = setup_info.debug_group.empty() ? "<group-empty>" : setup_info.debug_group.c_str();
-            const char* pass_name = setup_info.debug_name.empty() ? "<pass-empty>" : setup_info.debug_name.c_str();
-            LOG_FORMAT_FLUSH(
-                "[RenderGraph][Validation] Pass (%s/%s) requires ray-tracing pipeline support, but the current device was not created with that capability.\n",
-                group_name,
-                pass_name);
-            return false;
-        }
-    
-        for (const auto& shader_info : setup_info.shader_setup_infos)
-        {
-            RendererInterface::ShaderDesc shader_desc{};
-            shader_desc.shader_type = shader_info.shader_type; 
-            shader_desc.entry_point = shader_info.entry_function;
-            shader_desc.shader_file_name = shader_info.shader_file;
-            auto shader_handle = allocator.CreateShader(shader_desc);
-            
-            render_pass_desc.shaders.emplace(shader_info.shader_type, shader_handle);
-        }
-    
-        RendererInterface::RenderPassDrawDesc render_pass_draw_desc{};
-        for (const auto& module : setup_info.modules)
+        ExecutionPlanBuildResult plan{};
+        ExecutionPlanCacheState execution_cache_state = m_execution_plan_state.BuildCacheState();
+        std::vector<RenderGraphNodeHandle> diagnostics_cycle_nodes;
+        if (should_rebuild_execution_plan)
         {
-            module->BindDrawCommands(render_pass_draw_desc);
+            const auto output_resource_keys = CollectOutputResourceKeys();
+            std::size_t planning_signature = ComputePlanningSignature(nodes, m_render_graph_nodes);
+            HashCombine(planning_signature, m_dead_pass_culling_policy.enable ? 1u : 0u);
+            HashCombine(planning_signature, m_render_pass_merge_policy.infer_store_ops ? 1u : 0u);
+            HashCombine(planning_signature, m_render_pass_merge_policy.merge_passes ? 1u : 0u);
+            for (const auto output_resource_key : output_resource_keys)
+            {
+                HashCombine(planning_signature, static_cast<std::size_t>(output_resource_key));
+            }
+            if (const auto* cached_plan = m_execution_plan_cache->Find(planning_signature, m_frame_index))
+            {
+                plan = cached_plan->plan;
+                diagnostics_cycle_nodes = cached_plan->cycle_nodes;
+                execution_cache_state.cached_execution_graph_valid = cached_plan->execution_graph_valid;
+                execution_cache_state.cached_execution_order = cached_plan->execution_order;
+                execution_cache_state.cached_execution_signature = cached_plan->execution_signature;
+                execution_cache_state.cached_execution_node_count = cached_plan->execution_node_count;
+                m_execution_plan_state.live_execution_order = cached_plan->live_execution_order;
+                m_execution_plan_state.culled_nodes = cached_plan->culled_nodes;
+                m_barrier_state_requests = cached_plan->barrier_state_requests;
+                m_async_compute_schedule_diagnostics = cached_plan->async_compute_schedule_diagnostics;
+                m_async_compute_schedule_dump = cached_plan->async_compute_schedule_dump;
+                m_async_compute_state->schedule = cached_plan->async_compute_schedule;
+                m_render_pass_merge_state->plan = cached_plan->render_pass_merge_plan;
+                m_render_pass_merge_diagnostics = SummarizeRenderPassMergePlan(m_render_pass_merge_state->plan);
+                ++m_execution_plan_cache_diagnostics.hit_count;
+            }
+            else
+            {
+                const auto build_begin = std::chrono::steady_clock::now();
+                plan = BuildExecutionPlan(plan_context);
+                diagnostics_cycle_nodes = ApplyExecutionPlanResult(plan_context, plan, execution_cache_state);
+
+                auto& live_execution_order = m_execution_plan_state.live_execution_order;
+                auto& culled_nodes = m_execution_plan_state.culled_nodes;
+                culled_nodes.clear();
+                if (m_dead_pass_culling_policy.enable)
+                {
+                    culled_nodes = CollectDeadNodes(
+                        execution_cache_state.cached_execution_order, m_render_graph_nodes, plan.combined_edges, output_resource_keys);
+                }
+                // Culled nodes come in execution order, so one pass splits them off.
+                live_execution_order.clear();
+                auto culled_it = culled_nodes.begin();
+                for (const auto node_handle : execution_cache_state.cached_execution_order)
+                {
+                    if (culled_it != culled_nodes.end() && *culled_it == node_handle)
+                    {
+                        ++culled_it;
+                        continue;
+                    }
+                    live_execution_order.push_back(node_handle);
+                }
+                RebuildBarrierStateRequests(live_execution_order);
+                RebuildAsyncComputeSchedule(live_execution_order);
+                RebuildRenderPassMergePlan(live_execution_order, output_resource_keys);
+
+                auto& cache_entry = m_execution_plan_cache->Insert(planning_signature, m_frame_index);
+                cache_entry.plan = plan;
+                cache_entry.cycle_nodes = diagnostics_cycle_nodes;
+                cache_entry.execution_graph_valid = execution_cache_state.cached_execution_graph_valid;
+                cache_entry.execution_order = execution_cache_state.cached_execution_order;
+                cache_entry.execution_signature = execution_cache_state.cached_execution_signature;
+                cache_entry.execution_node_count = execution_cache_state.cached_execution_node_count;
+                cache_entry.live_execution_order = m_execution_plan_state.live_execution_order;
+                cache_entry.culled_nodes = m_execution_plan_state.culled_nodes;
+                cache_entry.barrier_state_requests = m_barrier_state_requests;
+                cache_entry.async_compute_schedule_diagnostics = m_async_compute_schedule_diagnostics;
+                cache_entry.async_compute_schedule_dump = m_async_compute_schedule_dump;
+                cache_entry.async_compute_schedule = m_async_compute_state->schedule;
+                cache_entry.render_pass_merge_plan = m_render_pass_merge_state->plan;
+                ++m_execution_plan_cache_diagnostics.miss_count;
+                m_execution_plan_cache_diagnostics.last_build_ms = ToMilliseconds(build_begin, std::chrono::steady_clock::now());
+            }
+            m_execution_plan_cache_diagnostics.cached_plan_count = static_cast<unsigned>(m_execution_plan_cache->entries.size());
+            m_execution_plan_state.MarkPlanApplied();
         }
 
-        switch (setup_info.render_pass_type)
+        if (!m_pending_execution_planning_snapshot_path.empty())
         {
-        case RendererInterface::RenderPassType::GRAPHICS:
-            for (const auto& render_target : setup_info.render_targets)
+            if (WriteExecutionPlanningSnapshot(m_pending_execution_planning_snapshot_path, nodes))
             {
-                render_pass_desc.render_target_bindings.push_back(render_target.second);
-                render_pass_draw_desc.render_target_resources.emplace(render_target.first, render_target.second);
+                LOG_FORMAT_FLUSH("[RenderGraph] Wrote planning snapshot of %zu passes to %s\n",
+                    nodes.size(), m_pending_execution_planning_snapshot_path.c_str());
             }
-            break;
-        case RendererInterface::RenderPassType::COMPUTE:
-            break;
-        case RendererInterface::RenderPassType::RAY_TRACING:
-            break;
+            else
+            {
+                LOG_FORMAT_FLUSH("[RenderGraph] Failed to write planning snapshot to %s\n",
+                    m_pending_execution_planning_snapshot_path.c_str());
+            }
+            m_pending_execution_planning_snapshot_path.clear();
         }
-    
-        for (const auto& render_target : setup_info.sampled_render_targets)
+
+        if (should_update_dependency_diagnostics)
         {
-            render_pass_draw_desc.render_target_texture_resources[render_target.name] = render_target;
-        }
+            auto current_frame_resource_access = CollectFrameResourceAccessDiagnostics(nodes, m_render_graph_nodes);
+            const unsigned cross_frame_comparison_window_size =
+                GetCrossFrameComparisonWindowSize(frame_context.resource_frame_context);
+            m_dependency_diagnostics_state.EnsureCrossFrameHazardSnapshotStorage(cross_frame_comparison_window_size);
+            const unsigned hazard_slot_index =
+                GetCrossFrameHazardSlotIndex(frame_context.resource_frame_context, cross_frame_comparison_window_size);
 
-        render_pass_draw_desc.texture_resources.insert(setup_info.texture_resources.begin(), setup_info.texture_resources.end());
-        render_pass_draw_desc.buffer_resources.insert(setup_info.buffer_resources.begin(), setup_info.buffer_resources.end());
+            ResourceAccessMaskMap previous_frame_resource_access_masks;
+            ResourcePassAccessMap previous_frame_resource_pass_accesses;
+            unsigned compared_previous_frame_count = 0u;
+            const auto* previous_snapshot =
+                m_dependency_diagnostics_state.GetCrossFrameHazardSnapshot(hazard_slot_index);
+            const bool has_previous_frame_resource_access_masks = previous_snapshot != nullptr;
+            if (previous_snapshot)
+            {
+                previous_frame_resource_access_masks = previous_snapshot->access_masks;
+                previous_frame_resource_pass_accesses = previous_snapshot->pass_accesses;
+                compared_previous_frame_count = 1u;
+            }
 
-        auto exclude_named_bindings = [](auto& resource_map, const std::set<std::string>& excluded_binding_names)
-        {
-            unsigned removed_count = 0;
-            for (const auto& binding_name : excluded_binding_names)
+            UpdateDependencyDiagnostics(
+                plan_context,
+                plan,
+                execution_cache_state.cached_execution_graph_valid,
+                execution_cache_state.cached_execution_signature,
+                execution_cache_state.cached_execution_node_count,
+                execution_cache_state.cached_execution_order.size(),
+                std::move(diagnostics_cycle_nodes),
+                m_auto_pruned_named_binding_counts,
+                previous_frame_resource_access_masks,
+                previous_frame_resource_pass_accesses,
+                has_previous_frame_resource_access_masks,
+                cross_frame_comparison_window_size,
+                compared_previous_frame_count,
+                current_frame_resource_access.access_masks,
+                current_frame_resource_access.pass_accesses,
+                m_dependency_diagnostics_state.diagnostics);
             {
-                removed_count += static_cast<unsigned>(resource_map.erase(binding_name));
+                FrameResourceAccessSnapshot snapshot{};
+                snapshot.access_masks = std::move(current_frame_resource_access.access_masks);
+                snapshot.pass_accesses = std::move(current_frame_resource_access.pass_accesses);
+                snapshot.frame_index = m_frame_index;
+                m_dependency_diagnostics_state.UpdateCrossFrameHazardSnapshot(hazard_slot_index, std::move(snapshot));
             }
-            return removed_count;
-        };
 
-        const unsigned excluded_buffer_count =
-            exclude_named_bindings(render_pass_draw_desc.buffer_resources, setup_info.excluded_buffer_bindings);
-        const unsigned excluded_texture_count =
-            exclude_named_bindings(render_pass_draw_desc.texture_resources, setup_info.excluded_texture_bindings);
-        const unsigned excluded_render_target_texture_count =
-            exclude_named_bindings(render_pass_draw_desc.render_target_texture_resources, setup_info.excluded_render_target_texture_bindings);
-        const unsigned total_excluded_binding_count =
-            excluded_buffer_count + excluded_texture_count + excluded_render_target_texture_count;
-        if (total_excluded_binding_count > 0)
-        {
-            const char* group_name = setup_info.debug_group.empty() ? "<group-empty>" : setup_info.debug_group.c_str();
-            const char* pass_name = setup_info.debug_name.empty() ? "<pass-empty>" : setup_info.debug_name.c_str();
-            LOG_FORMAT_FLUSH("[RenderGraph][Setup] Pass (%s/%s) excluded bindings by policy: buffer=%u, texture=%u, render_target_texture=%u.\n",
-                             group_name,
-                             pass_name,
-                             excluded_buffer_count,
-                             excluded_texture_count,
-                             excluded_render_target_texture_count);
-        }
-    
-        if (setup_info.execute_command.has_value())
-        {
-            render_pass_draw_desc.execute_commands.push_back(setup_info.execute_command.value());    
+            m_dependency_diagnostics_state.MarkUpdated(m_frame_index);
         }
-        render_pass_draw_desc.execute_commands.insert(
-            render_pass_draw_desc.execute_commands.end(),
-            setup_info.execute_commands.begin(),
-            setup_info.execute_commands.end());
 
-        render_pass_desc.viewport_width = setup_info.viewport_width;
-        render_pass_desc.viewport_height = setup_info.viewport_height;
-        
-        auto render_pass_handle = allocator.CreateRenderPass(render_pass_desc);
-        if (!render_pass_handle.IsValid())
+        UpdateTransientRenderTargetPlacement(should_rebuild_execution_plan);
+
+        const auto planning_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.execution_planning_ms = ToMilliseconds(planning_begin, planning_end);
+        RecordFrameTraceSpan("frame", "Execution planning", ToTimelineMilliseconds(planning_begin), ToTimelineMilliseconds(planning_end));
+
+        GLTF_CHECK(frame_context.command_list);
+        ExecutePlanAndCollectStats(
+            *frame_context.command_list,
+            frame_context.resource_frame_context,
+            frame_context.profiler_slot_index,
+            interval);
+
+        const auto collect_unused_begin = std::chrono::steady_clock::now();
+        CollectUnusedRenderPassDescriptorResources(frame_context.resource_frame_context);
+        const auto collect_unused_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.collect_unused_descriptor_ms =
+            ToMilliseconds(collect_unused_begin, collect_unused_end);
+    }
+
+    void RenderGraph::BlitFinalOutputToSwapchain(
+        IRHICommandList& command_list,
+        const FrameContextSnapshot& frame_context,
+        unsigned window_width,
+        unsigned window_height)
+    {
+        if (!m_render_graph_node_handles.empty())
         {
-            return false;
-        }
+            auto src = m_final_color_output;
+            auto dst = m_resource_allocator.GetCurrentSwapchainRT(frame_context).m_source;
 
-        unsigned pruned_buffer_count = 0;
-        unsigned pruned_texture_count = 0;
-        unsigned pruned_render_target_texture_count = 0;
-        auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(render_pass_handle);
-        if (render_pass)
-        {
-            auto prune_unmapped_named_resources = [&render_pass](auto& resource_map)
+            src->Transition(command_list, RHIResourceStateType::STATE_COPY_SOURCE);
+            dst->Transition(command_list, RHIResourceStateType::STATE_COPY_DEST);
+
+            const auto& src_desc = src->GetTextureDesc();
+            const auto& dst_desc = dst->GetTextureDesc();
+            const unsigned copy_width = (std::min)((std::min)(window_width, src_desc.GetTextureWidth()), dst_desc.GetTextureWidth());
+            const unsigned copy_height = (std::min)((std::min)(window_height, src_desc.GetTextureHeight()), dst_desc.GetTextureHeight());
+            if (copy_width > 0 && copy_height > 0)
             {
-                unsigned pruned_count = 0;
-                for (auto it = resource_map.begin(); it != resource_map.end(); )
-                {
-                    if (!render_pass->HasRootSignatureAllocation(it->first))
-                    {
-                        it = resource_map.erase(it);
-                        ++pruned_count;
-                    }
-                    else
-                    {
-                        ++it;
-                    }
-                }
-                return pruned_count;
-            };
+                RHICopyTextureInfo copy_info{};
+                copy_info.copy_width = copy_width;
+                copy_info.copy_height = copy_height;
+                copy_info.dst_mip_level = 0;
+                copy_info.src_mip_level = 0;
+                copy_info.dst_x = 0;
+                copy_info.dst_y = 0;
+                RHIUtilInstanceManager::Instance().CopyTexture(command_list, *dst, *src, copy_info);
+            }
+        }
+    }
 
-            pruned_buffer_count = prune_unmapped_named_resources(render_pass_draw_desc.buffer_resources);
-            pruned_texture_count = prune_unmapped_named_resources(render_pass_draw_desc.texture_resources);
-            pruned_render_target_texture_count = prune_unmapped_named_resources(render_pass_draw_desc.render_target_texture_resources);
+    bool RenderGraph::AcquireCurrentFrameSwapchain(FramePreparationContext& frame_context)
+    {
+        const auto acquire_frame_begin = std::chrono::steady_clock::now();
+        const bool acquire_succeeded = m_resource_allocator.GetCurrentSwapchain().AcquireNewFrame(m_resource_allocator.GetDevice());
+        const auto acquire_frame_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.acquire_swapchain_ms = ToMilliseconds(acquire_frame_begin, acquire_frame_end);
+        RecordFrameTraceSpan("wait", "Acquire swapchain image", ToTimelineMilliseconds(acquire_frame_begin), ToTimelineMilliseconds(acquire_frame_end));
+        if (!acquire_succeeded)
+        {
+            m_resource_allocator.NotifySwapchainAcquireFailure();
+            frame_context.presentation_frame_context = {};
+            return false;
         }
 
-        out_render_graph_node_desc = RendererInterface::RenderGraphNodeDesc{};
-        out_render_graph_node_desc.draw_info = std::move(render_pass_draw_desc);
-        out_render_graph_node_desc.render_pass_handle = render_pass_handle;
-        out_render_graph_node_desc.render_state = setup_info.render_state;
-        out_render_graph_node_desc.dependency_render_graph_nodes = setup_info.dependency_render_graph_nodes;
-        out_render_graph_node_desc.pre_render_callback = setup_info.pre_render_callback;
-        out_render_graph_node_desc.debug_group = setup_info.debug_group;
-        out_render_graph_node_desc.debug_name = setup_info.debug_name;
-        out_pruned_binding_counts =
-            std::make_tuple(pruned_buffer_count, pruned_texture_count, pruned_render_target_texture_count);
+        frame_context.presentation_frame_context = m_resource_allocator.GetFrameContext();
         return true;
     }
 
-    void RenderGraph::SyncAutoPrunedNamedBindingCounts(
-        RenderGraphNodeHandle render_graph_node_handle,
-        const RenderGraphNodeDesc& render_graph_node_desc,
-        const std::tuple<unsigned, unsigned, unsigned>& pruned_binding_counts)
+    void RenderGraph::FinalizeFrameSubmission(FramePreparationContext& frame_context, bool swapchain_ready)
     {
-        const auto [pruned_buffer_count, pruned_texture_count, pruned_render_target_texture_count] =
-            pruned_binding_counts;
-        const unsigned total_pruned_bindings =
-            pruned_buffer_count + pruned_texture_count + pruned_render_target_texture_count;
-        if (total_pruned_bindings == 0)
+        GLTF_CHECK(frame_context.command_list);
+        auto& command_list = *frame_context.command_list;
+        if (!swapchain_ready)
         {
-            m_auto_pruned_named_binding_counts.erase(render_graph_node_handle);
+            const auto submit_begin = std::chrono::steady_clock::now();
+            CloseCurrentCommandListAndExecute(command_list, {}, false);
+            const auto submit_end = std::chrono::steady_clock::now();
+            m_current_frame_timing_breakdown.submit_command_list_ms = ToMilliseconds(submit_begin, submit_end);
+            FinalizeRenderDocFrameCapture();
+            FinalizePIXFrameCapture();
+
+            // Clear all nodes at end of frame
+            m_render_graph_node_handles.clear();
             return;
         }
 
-        m_auto_pruned_named_binding_counts[render_graph_node_handle] = pruned_binding_counts;
-        const char* group_name = render_graph_node_desc.debug_group.empty() ? "<group-empty>" : render_graph_node_desc.debug_group.c_str();
-        const char* pass_name = render_graph_node_desc.debug_name.empty() ? "<pass-empty>" : render_graph_node_desc.debug_name.c_str();
-        LOG_FORMAT_FLUSH("[RenderGraph][Validation] Node %u (%s/%s) auto-pruned unmapped bindings: buffer=%u, texture=%u, render_target_texture=%u.\n",
-                         render_graph_node_handle.value,
-                         group_name,
-                         pass_name,
-                         pruned_buffer_count,
-                         pruned_texture_count,
-                         pruned_render_target_texture_count);
+        const auto render_debug_ui_begin = std::chrono::steady_clock::now();
+        GLTF_CHECK(RenderDebugUI(command_list, frame_context.presentation_frame_context));
+        const auto render_debug_ui_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.render_debug_ui_ms = ToMilliseconds(render_debug_ui_begin, render_debug_ui_end);
+
+        const auto present_begin = std::chrono::steady_clock::now();
+        Present(command_list, frame_context.presentation_frame_context);
+        const auto present_end = std::chrono::steady_clock::now();
+        m_current_frame_timing_breakdown.present_ms = ToMilliseconds(present_begin, present_end);
+        FinalizeRenderDocFrameCapture();
+        FinalizePIXFrameCapture();
+
+        // Clear all nodes at end of frame
+        m_render_graph_node_handles.clear();
     }
 
-    void RenderGraph::RetireRenderGraphNodeResources(
-        RenderGraphNodeHandle render_graph_node_handle,
-        const FrameContextSnapshot& frame_context)
+    void RenderGraph::RegisterTextureToColorOutput(TextureHandle texture_handle)
     {
-        auto* descriptor_resource = m_descriptor_resource_store.Find(render_graph_node_handle);
-        if (descriptor_resource)
+        if (texture_handle != m_final_color_output_texture_handle ||
+            m_final_color_output_render_target_handle != NULL_HANDLE)
         {
-            ReleaseRenderPassDescriptorResource(*descriptor_resource, frame_context);
-            m_descriptor_resource_store.Erase(render_graph_node_handle);
+            // The color output is what dead-pass culling keeps alive.
+            m_execution_plan_state.MarkDirty();
         }
+        m_final_color_output_texture_handle = texture_handle;
+        m_final_color_output_render_target_handle = NULL_HANDLE;
+        auto texture = InternalResourceHandleTable::Instance().GetTexture(texture_handle);
+        m_final_color_output = texture->m_texture;
+        m_missing_final_color_output_logged = false;
+    }
 
-        const auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        auto retired_render_pass = InternalResourceHandleTable::Instance().RemoveRenderPass(node_desc.render_pass_handle);
-        if (retired_render_pass)
+    void RenderGraph::RegisterRenderTargetToColorOutput(RenderTargetHandle render_target_handle)
+    {
+        if (render_target_handle != m_final_color_output_render_target_handle ||
+            m_final_color_output_texture_handle != NULL_HANDLE)
         {
-            EnqueueRetainedObjectForDeferredRelease(std::move(retired_render_pass), frame_context);
+            m_execution_plan_state.MarkDirty();
         }
+        m_final_color_output_render_target_handle = render_target_handle;
+        m_final_color_output_texture_handle = NULL_HANDLE;
+        auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(render_target_handle);
+        m_final_color_output = render_target->m_source;
+        m_missing_final_color_output_logged = false;
     }
 
-    RenderGraphNodeHandle RenderGraph::CreateRenderGraphNode(ResourceOperator& allocator,const RenderPassSetupInfo& setup_info)
+    void RenderGraph::RegisterOutputSink(BufferHandle buffer_handle)
     {
-        RendererInterface::RenderGraphNodeDesc render_graph_node_desc{};
-        std::tuple<unsigned, unsigned, unsigned> pruned_binding_counts{};
-        if (!BuildRenderGraphNodeFromSetup(allocator, setup_info, render_graph_node_desc, pruned_binding_counts))
+        if (m_output_sink_resource_keys.insert(EncodeResourceKey({ResourceKind::Buffer, buffer_handle.value})).second)
         {
-            return NULL_HANDLE;
+            m_execution_plan_state.MarkDirty();
         }
-
-        auto render_graph_node_handle = CreateRenderGraphNode(render_graph_node_desc);
-        SyncAutoPrunedNamedBindingCounts(render_graph_node_handle, render_graph_node_desc, pruned_binding_counts);
-        return render_graph_node_handle;
     }
 
-    bool RenderGraph::RebuildRenderGraphNode(
-        ResourceOperator& allocator,
-        RenderGraphNodeHandle render_graph_node_handle,
-        const RenderPassSetupInfo& setup_info)
+    void RenderGraph::RegisterOutputSink(TextureHandle texture_handle)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-
-        RendererInterface::RenderGraphNodeDesc rebuilt_node_desc{};
-        std::tuple<unsigned, unsigned, unsigned> pruned_binding_counts{};
-        if (!BuildRenderGraphNodeFromSetup(allocator, setup_info, rebuilt_node_desc, pruned_binding_counts))
+        if (m_output_sink_resource_keys.insert(EncodeResourceKey({ResourceKind::Texture, texture_handle.value})).second)
         {
-            return false;
+            m_execution_plan_state.MarkDirty();
         }
-
-        const auto frame_context = m_resource_allocator.GetFrameContext();
-        RetireRenderGraphNodeResources(render_graph_node_handle, frame_context);
-        m_render_graph_nodes[render_graph_node_handle.value] = std::move(rebuilt_node_desc);
-        m_pending_render_state_updates.erase(render_graph_node_handle);
-        m_render_pass_validation_last_log_frame.erase(render_graph_node_handle);
-        m_render_pass_validation_last_message_hash.erase(render_graph_node_handle);
-        SyncAutoPrunedNamedBindingCounts(
-            render_graph_node_handle,
-            m_render_graph_nodes[render_graph_node_handle.value],
-            pruned_binding_counts);
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
-        return true;
     }
 
-    bool RenderGraph::RegisterRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle)
+    void RenderGraph::RegisterOutputSink(RenderTargetHandle render_target_handle)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-        GLTF_CHECK(!m_render_graph_node_handles.contains(render_graph_node_handle));
-        m_render_graph_node_handles.insert(render_graph_node_handle);
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
-        return true;
+        if (m_output_sink_resource_keys.insert(EncodeResourceKey({ResourceKind::RenderTarget, render_target_handle.value})).second)
+        {
+            m_execution_plan_state.MarkDirty();
+        }
     }
 
-    bool RenderGraph::RemoveRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle)
+    void RenderGraph::UnregisterOutputSink(BufferHandle buffer_handle)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-        const auto frame_context = m_resource_allocator.GetFrameContext();
-        m_render_graph_node_handles.erase(render_graph_node_handle);
-        m_pending_render_state_updates.erase(render_graph_node_handle);
-        RetireRenderGraphNodeResources(render_graph_node_handle, frame_context);
-        m_render_graph_nodes[render_graph_node_handle.value] = RenderGraphNodeDesc{};
-
-        m_auto_pruned_named_binding_counts.erase(render_graph_node_handle);
-        m_render_pass_validation_last_log_frame.erase(render_graph_node_handle);
-        m_render_pass_validation_last_message_hash.erase(render_graph_node_handle);
-
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.ResetCache();
-        return true;
+        if (m_output_sink_resource_keys.erase(EncodeResourceKey({ResourceKind::Buffer, buffer_handle.value})) > 0)
+        {
+            m_execution_plan_state.MarkDirty();
+        }
     }
 
-    bool RenderGraph::UpdateComputeDispatch(RenderGraphNodeHandle render_graph_node_handle, unsigned group_size_x, unsigned group_size_y, unsigned group_size_z)
+    void RenderGraph::UnregisterOutputSink(TextureHandle texture_handle)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-
-        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        for (auto& command : node_desc.draw_info.execute_commands)
+        if (m_output_sink_resource_keys.erase(EncodeResourceKey({ResourceKind::Texture, texture_handle.value})) > 0)
         {
-            if (command.type != ExecuteCommandType::COMPUTE_DISPATCH_COMMAND)
-            {
-                continue;
-            }
+            m_execution_plan_state.MarkDirty();
+        }
+    }
 
-            command.parameter.dispatch_parameter.group_size_x = group_size_x;
-            command.parameter.dispatch_parameter.group_size_y = group_size_y;
-            command.parameter.dispatch_parameter.group_size_z = group_size_z;
+    void RenderGraph::UnregisterOutputSink(RenderTargetHandle render_target_handle)
+    {
+        if (m_output_sink_resource_keys.erase(EncodeResourceKey({ResourceKind::RenderTarget, render_target_handle.value})) > 0)
+        {
             m_execution_plan_state.MarkDirty();
-            return true;
         }
+    }
 
-        return false;
+    std::set<unsigned long long> RenderGraph::CollectOutputResourceKeys() const
+    {
+        std::set<unsigned long long> output_resource_keys = m_output_sink_resource_keys;
+        if (m_final_color_output_render_target_handle != NULL_HANDLE)
+        {
+            output_resource_keys.insert(EncodeResourceKey({ResourceKind::RenderTarget, m_final_color_output_render_target_handle.value}));
+        }
+        if (m_final_color_output_texture_handle != NULL_HANDLE)
+        {
+            output_resource_keys.insert(EncodeResourceKey({ResourceKind::Texture, m_final_color_output_texture_handle.value}));
+        }
+        return output_resource_keys;
     }
 
-    bool RenderGraph::QueueNodeRenderStateUpdate(RenderGraphNodeHandle render_graph_node_handle, const RenderStateDesc& render_state)
+    void RenderGraph::RegisterTickCallback(const RenderGraphTickCallback& callback)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        m_tick_callback = callback;
+    }
 
-        const auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
-        if (!render_pass || render_pass->GetRenderPassType() != RenderPassType::GRAPHICS)
+    void RenderGraph::RegisterDebugUICallback(const RenderGraphDebugUICallback& callback)
+    {
+        m_debug_ui_callback = callback;
+    }
+
+    void RenderGraph::EnableDebugUI(bool enable)
+    {
+        if (enable && !m_debug_ui_initialized)
         {
-            return false;
+            GLTF_CHECK(InitDebugUI());
         }
+        m_debug_ui_enabled = enable;
+    }
 
-        const auto pending_it = m_pending_render_state_updates.find(render_graph_node_handle);
-        if (pending_it != m_pending_render_state_updates.end())
+    bool RenderGraph::ConfigureRenderDocCapture(bool enable, bool require_available, std::string& out_status)
+    {
+        if (!enable)
         {
-            if (IsEquivalentRenderStateDesc(pending_it->second.render_state, render_state))
+            if (m_renderdoc_capture_state)
             {
-                return true;
+                auto& renderdoc_state = *m_renderdoc_capture_state;
+                if (renderdoc_state.api && renderdoc_state.api->MaskOverlayBits && renderdoc_state.overlay_hidden)
+                {
+                    const uint32_t overlay_bits = renderdoc_state.overlay_bits_saved
+                        ? renderdoc_state.saved_overlay_bits
+                        : static_cast<uint32_t>(eRENDERDOC_Overlay_None);
+                    renderdoc_state.api->MaskOverlayBits(0u, overlay_bits);
+                    renderdoc_state.overlay_hidden = false;
+                }
+                renderdoc_state.enabled = false;
+                renderdoc_state.required = false;
+                renderdoc_state.pending = {};
             }
-        }
-        else if (IsEquivalentRenderStateDesc(node_desc.render_state, render_state))
-        {
+            out_status = "RenderDoc capture disabled.";
             return true;
         }
 
-        m_pending_render_state_updates[render_graph_node_handle] = PendingRenderStateUpdate{.render_state = render_state};
-        return true;
-    }
-
-    bool RenderGraph::UpdateNodeDependencies(
-        RenderGraphNodeHandle render_graph_node_handle,
-        const std::vector<RenderGraphNodeHandle>& dependency_render_graph_nodes)
-    {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
+        if (!m_renderdoc_capture_state)
+        {
+            m_renderdoc_capture_state = std::make_unique<RenderDocCaptureState>();
+        }
 
-        for (const auto dependency_handle : dependency_render_graph_nodes)
+        auto& renderdoc_state = *m_renderdoc_capture_state;
+        renderdoc_state.enabled = true;
+        renderdoc_state.required = require_available;
+        if (renderdoc_state.available && renderdoc_state.api)
         {
-            GLTF_CHECK(dependency_handle.IsValid());
-            GLTF_CHECK(dependency_handle.value < m_render_graph_nodes.size());
-            if (dependency_handle == render_graph_node_handle)
+            if (renderdoc_state.api->MaskOverlayBits)
             {
-                return false;
+                if (!renderdoc_state.overlay_bits_saved && renderdoc_state.api->GetOverlayBits)
+                {
+                    renderdoc_state.saved_overlay_bits = renderdoc_state.api->GetOverlayBits();
+                    renderdoc_state.overlay_bits_saved = true;
+                }
+                renderdoc_state.api->MaskOverlayBits(0u, 0u);
+                renderdoc_state.overlay_hidden = true;
             }
+            out_status = renderdoc_state.status.empty() ? "RenderDoc API ready." : renderdoc_state.status;
+            return true;
         }
 
-        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        if (node_desc.dependency_render_graph_nodes == dependency_render_graph_nodes)
+        const bool initialized = InitRenderDocCapture(require_available, out_status);
+        if (!initialized && !require_available)
         {
             return true;
         }
-
-        node_desc.dependency_render_graph_nodes = dependency_render_graph_nodes;
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
-        return true;
+        return initialized;
     }
 
-    bool RenderGraph::UpdateNodeBufferBinding(RenderGraphNodeHandle render_graph_node_handle, const std::string& binding_name, BufferHandle buffer_handle)
+    bool RenderGraph::RequestRenderDocCaptureForCurrentFrame(const std::filesystem::path& capture_path, std::string& out_error)
     {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-        GLTF_CHECK(buffer_handle != NULL_HANDLE);
-
-        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        auto binding_it = node_desc.draw_info.buffer_resources.find(binding_name);
-        if (binding_it == node_desc.draw_info.buffer_resources.end())
+        out_error.clear();
+        if (!m_renderdoc_capture_state || !m_renderdoc_capture_state->enabled)
         {
+            out_error = "RenderDoc capture is not enabled for this run.";
             return false;
         }
 
-        binding_it->second.buffer_handle = buffer_handle;
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
-        return true;
-    }
-
-    bool RenderGraph::UpdateNodeRenderTargetBinding(
-        RenderGraphNodeHandle render_graph_node_handle,
-        RenderTargetHandle old_render_target_handle,
-        RenderTargetHandle new_render_target_handle)
-    {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-        GLTF_CHECK(old_render_target_handle != NULL_HANDLE);
-        GLTF_CHECK(new_render_target_handle != NULL_HANDLE);
-
-        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        auto binding_it = node_desc.draw_info.render_target_resources.find(old_render_target_handle);
-        if (binding_it == node_desc.draw_info.render_target_resources.end())
+        auto& renderdoc_state = *m_renderdoc_capture_state;
+        if (!renderdoc_state.available || !renderdoc_state.api)
         {
+            out_error = !renderdoc_state.status.empty() ? renderdoc_state.status : "RenderDoc API unavailable.";
             return false;
         }
-
-        if (old_render_target_handle == new_render_target_handle)
+        if (m_pix_capture_state && m_pix_capture_state->pending.armed)
         {
-            return true;
+            out_error = "PIX capture is already armed for a frame.";
+            return false;
         }
-
-        if (node_desc.draw_info.render_target_resources.contains(new_render_target_handle))
+        if (m_pix_capture_state && (PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
         {
+            out_error = "PIX is already capturing a frame.";
             return false;
         }
-
-        const RenderTargetBindingDesc binding_desc = binding_it->second;
-        node_desc.draw_info.render_target_resources.erase(binding_it);
-        node_desc.draw_info.render_target_resources.emplace(new_render_target_handle, binding_desc);
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
-        return true;
-    }
-
-    bool RenderGraph::UpdateNodeRenderTargetTextureBinding(
-        RenderGraphNodeHandle render_graph_node_handle,
-        const std::string& binding_name,
-        const std::vector<RenderTargetHandle>& render_target_handles)
-    {
-        GLTF_CHECK(render_graph_node_handle.IsValid());
-        GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
-        if (render_target_handles.empty())
+        if (renderdoc_state.pending.armed)
         {
+            out_error = "RenderDoc capture is already armed for a frame.";
             return false;
         }
-
-        for (const auto render_target_handle : render_target_handles)
+        if (renderdoc_state.api->IsFrameCapturing())
         {
-            GLTF_CHECK(render_target_handle != NULL_HANDLE);
+            out_error = "RenderDoc is already capturing a frame.";
+            return false;
         }
 
-        auto& node_desc = m_render_graph_nodes[render_graph_node_handle.value];
-        auto binding_it = node_desc.draw_info.render_target_texture_resources.find(binding_name);
-        if (binding_it == node_desc.draw_info.render_target_texture_resources.end())
+        std::error_code fs_error;
+        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
+        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
+        const auto parent_path = resolved_path.parent_path();
+        if (!parent_path.empty())
         {
-            return false;
+            std::filesystem::create_directories(parent_path, fs_error);
+            if (fs_error)
+            {
+                out_error = "Failed to create RenderDoc output directory: " + parent_path.string();
+                return false;
+            }
         }
 
-        binding_it->second.render_target_texture = render_target_handles;
-        m_dependency_diagnostics_state.Reset();
-        m_execution_plan_state.MarkDirty();
+        renderdoc_state.pending = {};
+        renderdoc_state.pending.armed = true;
+        renderdoc_state.pending.frame_index = m_frame_index;
+        renderdoc_state.pending.capture_count_before = renderdoc_state.api->GetNumCaptures();
+        renderdoc_state.pending.requested_path = resolved_path;
         return true;
     }
 
-    bool RenderGraph::UpdateNodeRenderTargetTextureBinding(
-        RenderGraphNodeHandle render_graph_node_handle,
-        const std::string& binding_name,
-        RenderTargetHandle render_target_handle)
+    bool RenderGraph::IsRenderDocCaptureEnabled() const
     {
-        return UpdateNodeRenderTargetTextureBinding(
-            render_graph_node_handle,
-            binding_name,
-            std::vector<RenderTargetHandle>{render_target_handle});
+        return m_renderdoc_capture_state && m_renderdoc_capture_state->enabled;
     }
 
-    bool RenderGraph::CompileRenderPassAndExecute()
+    unsigned long long RenderGraph::GetCurrentFrameIndex() const
     {
-        m_window.RegisterTickCallback([this](unsigned long long interval)
-        {
-            OnFrameTick(interval);
-        });
-
-        return true;
+        return m_frame_index;
     }
 
-    void RenderGraph::OnFrameTick(unsigned long long interval)
+    bool RenderGraph::IsRenderDocCaptureAvailable() const
     {
-        m_current_frame_timing_breakdown = {};
-        const auto frame_begin = std::chrono::steady_clock::now();
-
-        FramePreparationContext frame_context{};
-        const auto prepare_begin = std::chrono::steady_clock::now();
-        if (!PrepareFrameForRendering(interval, frame_context))
-        {
-            const auto prepare_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.prepare_frame_ms = ToMilliseconds(prepare_begin, prepare_end);
-            const auto frame_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.frame_index = m_frame_index;
-            m_current_frame_timing_breakdown.frame_total_ms = ToMilliseconds(frame_begin, frame_end);
-            m_current_frame_timing_breakdown.non_pass_cpu_ms = m_current_frame_timing_breakdown.frame_total_ms;
-            m_current_frame_timing_breakdown.untracked_ms =
-                (std::max)(0.0f, m_current_frame_timing_breakdown.frame_total_ms - m_current_frame_timing_breakdown.prepare_frame_ms);
-            m_current_frame_timing_breakdown.valid = false;
-            m_last_frame_timing_breakdown = m_current_frame_timing_breakdown;
-            return;
-        }
-        const auto prepare_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.prepare_frame_ms = ToMilliseconds(prepare_begin, prepare_end);
-        m_current_frame_timing_breakdown.frame_index = m_frame_index;
-
-        const auto execute_begin = std::chrono::steady_clock::now();
-        ExecuteRenderGraphFrame(frame_context, interval);
-        const auto execute_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.execute_render_graph_ms = ToMilliseconds(execute_begin, execute_end);
+        return m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api;
+    }
 
-        GLTF_CHECK(frame_context.command_list);
-        const bool swapchain_ready = AcquireCurrentFrameSwapchain(frame_context);
-        if (swapchain_ready)
-        {
-            const auto blit_begin = std::chrono::steady_clock::now();
-            BlitFinalOutputToSwapchain(
-                *frame_context.command_list,
-                frame_context.presentation_frame_context,
-                frame_context.window_width,
-                frame_context.window_height);
-            const auto blit_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.blit_to_swapchain_ms = ToMilliseconds(blit_begin, blit_end);
-        }
+    bool RenderGraph::WasLastRenderDocCaptureSuccessful() const
+    {
+        return m_renderdoc_capture_state && m_renderdoc_capture_state->last_result.success;
+    }
 
-        const auto finalize_begin = std::chrono::steady_clock::now();
-        FinalizeFrameSubmission(frame_context, swapchain_ready);
-        const auto finalize_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.finalize_submission_ms = ToMilliseconds(finalize_begin, finalize_end);
+    unsigned long long RenderGraph::GetLastRenderDocCaptureFrameIndex() const
+    {
+        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.frame_index : 0ull;
+    }
 
-        const auto frame_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.frame_total_ms = ToMilliseconds(frame_begin, frame_end);
-        m_current_frame_timing_breakdown.non_pass_cpu_ms = (std::max)(
-            0.0f,
-            m_current_frame_timing_breakdown.frame_total_ms - m_current_frame_timing_breakdown.execute_passes_ms);
-        const float tracked_frame_section_ms =
-            m_current_frame_timing_breakdown.prepare_frame_ms +
-            m_current_frame_timing_breakdown.execute_render_graph_ms +
-            m_current_frame_timing_breakdown.blit_to_swapchain_ms +
-            m_current_frame_timing_breakdown.finalize_submission_ms;
-        m_current_frame_timing_breakdown.untracked_ms = (std::max)(
-            0.0f,
-            m_current_frame_timing_breakdown.frame_total_ms - tracked_frame_section_ms);
-        m_current_frame_timing_breakdown.frame_wait_total_ms =
-            m_current_frame_timing_breakdown.wait_previous_frame_ms +
-            m_current_frame_timing_breakdown.acquire_command_list_ms +
-            m_current_frame_timing_breakdown.acquire_swapchain_ms +
-            m_current_frame_timing_breakdown.submit_command_list_ms +
-            m_current_frame_timing_breakdown.present_call_ms;
-        m_current_frame_timing_breakdown.valid = true;
-        m_last_frame_timing_breakdown = m_current_frame_timing_breakdown;
+    std::string RenderGraph::GetLastRenderDocCapturePath() const
+    {
+        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.capture_path : std::string{};
     }
 
-    bool RenderGraph::ResolveFinalColorOutput()
+    std::string RenderGraph::GetLastRenderDocCaptureError() const
     {
-        m_final_color_output = nullptr;
-        if (m_final_color_output_render_target_handle != NULL_HANDLE)
+        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.error : std::string{};
+    }
+
+    bool RenderGraph::OpenRenderDocCaptureInReplayUI(const std::filesystem::path& capture_path, std::string& out_status)
+    {
+        out_status.clear();
+
+        std::error_code fs_error{};
+        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
+        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
+        if (resolved_path.empty())
         {
-            auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(m_final_color_output_render_target_handle);
-            m_final_color_output = render_target->m_source;
+            out_status = "RenderDoc replay launch failed: capture path is empty.";
+            return false;
         }
-        else if (m_final_color_output_texture_handle != NULL_HANDLE)
+
+        const bool capture_exists = std::filesystem::exists(resolved_path, fs_error) && !fs_error;
+        if (!capture_exists)
         {
-            auto texture = InternalResourceHandleTable::Instance().GetTexture(m_final_color_output_texture_handle);
-            m_final_color_output = texture->m_texture;
+            out_status = "RenderDoc replay launch failed: capture file does not exist: " + resolved_path.string();
+            return false;
         }
 
-        if (!m_final_color_output)
+        if (m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api)
         {
-            if (!m_missing_final_color_output_logged)
+            auto& renderdoc_state = *m_renderdoc_capture_state;
+            if (renderdoc_state.api->LaunchReplayUI)
             {
-                LOG_FORMAT_FLUSH(
-                    "[RenderGraph] Missing final color output. Register a texture/render target via RegisterTextureToColorOutput/RegisterRenderTargetToColorOutput.\n");
-                m_missing_final_color_output_logged = true;
+                const std::string command_line = QuoteCommandLineArgument(PathToUtf8String(resolved_path));
+                const uint32_t replay_pid = renderdoc_state.api->LaunchReplayUI(1u, command_line.c_str());
+                if (replay_pid != 0u)
+                {
+                    out_status =
+                        "RenderDoc replay UI launched for capture: " + resolved_path.string() +
+                        " (pid " + std::to_string(replay_pid) + ").";
+                    return true;
+                }
             }
-            return false;
         }
 
-        m_missing_final_color_output_logged = false;
-        return true;
+        const auto shell_result = reinterpret_cast<intptr_t>(
+            ShellExecuteW(nullptr, L"open", resolved_path.c_str(), nullptr, nullptr, SW_SHOWNORMAL));
+        if (shell_result > 32)
+        {
+            out_status = "RenderDoc capture opened via shell association: " + resolved_path.string();
+            return true;
+        }
+
+        if (m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api)
+        {
+            auto& renderdoc_state = *m_renderdoc_capture_state;
+            if (renderdoc_state.api->ShowReplayUI &&
+                renderdoc_state.api->IsTargetControlConnected &&
+                renderdoc_state.api->IsTargetControlConnected() != 0 &&
+                renderdoc_state.api->ShowReplayUI() != 0)
+            {
+                out_status =
+                    "RenderDoc replay UI was shown, but the capture file could not be opened automatically: " +
+                    resolved_path.string();
+                return true;
+            }
+        }
+
+        out_status = "RenderDoc replay launch failed for capture: " + resolved_path.string();
+        return false;
     }
 
-    void RenderGraph::ExecuteTickAndDebugUI(unsigned long long interval)
+    bool RenderGraph::OpenLastRenderDocCaptureInReplayUI(std::string& out_status)
     {
-        const auto tick_and_ui_begin = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.tick_callback_ms = 0.0f;
-        m_current_frame_timing_breakdown.tick_other_ms = 0.0f;
-        m_current_frame_timing_breakdown.module_tick_ms = 0.0f;
-        m_current_frame_timing_breakdown.system_tick_ms = 0.0f;
-        m_current_frame_timing_breakdown.debug_ui_build_ms = 0.0f;
-
-        if (m_tick_callback)
+        const std::string capture_path = GetLastRenderDocCapturePath();
+        if (capture_path.empty())
         {
-            const auto tick_begin = std::chrono::steady_clock::now();
-            m_tick_callback(interval);
-            const auto tick_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.tick_callback_ms = ToMilliseconds(tick_begin, tick_end);
+            out_status = "RenderDoc replay launch failed: there is no completed capture to open.";
+            return false;
         }
+        return OpenRenderDocCaptureInReplayUI(std::filesystem::path(capture_path), out_status);
+    }
 
-        if (m_debug_ui_enabled && m_debug_ui_initialized)
+    bool RenderGraph::ConfigurePIXCapture(bool enable, bool require_available, std::string& out_status)
+    {
+        if (!enable)
         {
-            const auto debug_ui_build_begin = std::chrono::steady_clock::now();
-            GLTF_CHECK(RHIUtilInstanceManager::Instance().NewGUIFrame());
-            ImGui_ImplGlfw_NewFrame();
-            ImGui::NewFrame();
-
-            if (m_debug_ui_callback)
-            {
-                m_debug_ui_callback();
-            }
-            else
+            if (m_pix_capture_state)
             {
-                const bool framework_window_visible = ImGui::Begin("Renderer Framework");
-                if (framework_window_visible)
-                {
-                    DrawFrameworkDebugUI();
-                }
-                ImGui::End();
+                auto& pix_state = *m_pix_capture_state;
+                pix_state.enabled = false;
+                pix_state.required = false;
+                pix_state.pending = {};
             }
-            const auto debug_ui_build_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.debug_ui_build_ms =
-                ToMilliseconds(debug_ui_build_begin, debug_ui_build_end);
+            out_status = "PIX capture disabled.";
+            return true;
         }
 
-        const auto tick_and_ui_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.tick_and_debug_ui_build_ms =
-            ToMilliseconds(tick_and_ui_begin, tick_and_ui_end);
+        if (!m_pix_capture_state)
+        {
+            m_pix_capture_state = std::make_unique<PIXCaptureState>();
+        }
+
+        auto& pix_state = *m_pix_capture_state;
+        pix_state.enabled = true;
+        pix_state.required = require_available;
+        if (pix_state.available)
+        {
+            out_status = pix_state.status.empty() ? "PIX GPU capture ready." : pix_state.status;
+            return true;
+        }
+
+        const bool initialized = InitPIXCapture(require_available, out_status);
+        if (!initialized && !require_available)
+        {
+            return true;
+        }
+        return initialized;
     }
 
-    bool RenderGraph::SyncWindowSurfaceAndAdvanceFrame(FramePreparationContext& frame_context, unsigned long long interval)
+    bool RenderGraph::RequestPIXCaptureForCurrentFrame(const std::filesystem::path& capture_path, std::string& out_error)
     {
-        (void)interval;
-        m_resource_allocator.BeginFrame();
+        out_error.clear();
+        if (!m_pix_capture_state || !m_pix_capture_state->enabled)
+        {
+            out_error = "PIX capture is not enabled for this run.";
+            return false;
+        }
 
-        const auto surface_sync_begin = std::chrono::steady_clock::now();
-        const auto surface_sync_result = m_resource_allocator.SyncWindowSurface(frame_context.window_width, frame_context.window_height);
-        const auto surface_sync_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.sync_window_surface_ms = ToMilliseconds(surface_sync_begin, surface_sync_end);
-        if (surface_sync_result.status == WindowSurfaceSyncStatus::MINIMIZED)
+        auto& pix_state = *m_pix_capture_state;
+        if (!pix_state.available)
         {
+            out_error = !pix_state.status.empty() ? pix_state.status : "PIX capture API unavailable.";
             return false;
         }
-        if (surface_sync_result.status == WindowSurfaceSyncStatus::INVALID || !m_resource_allocator.HasCurrentSwapchainRT())
+        if (m_renderdoc_capture_state && m_renderdoc_capture_state->pending.armed)
         {
-            m_resource_allocator.InvalidateSwapchainResizeRequest();
+            out_error = "RenderDoc capture is already armed for a frame.";
+            return false;
+        }
+        if (m_renderdoc_capture_state &&
+            m_renderdoc_capture_state->available &&
+            m_renderdoc_capture_state->api &&
+            m_renderdoc_capture_state->api->IsFrameCapturing())
+        {
+            out_error = "RenderDoc is already capturing a frame.";
+            return false;
+        }
+        if (pix_state.pending.armed)
+        {
+            out_error = "PIX capture is already armed for a frame.";
+            return false;
+        }
+        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        {
+            out_error = "PIX is already capturing a frame.";
             return false;
         }
 
-        m_resource_allocator.AdvanceFrameSlot();
-        frame_context.resource_frame_context = m_resource_allocator.GetFrameContext();
-
-        frame_context.require_explicit_frame_wait =
-            surface_sync_result.status != WindowSurfaceSyncStatus::RESIZED &&
-            RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12;
-        const auto deferred_release_begin = std::chrono::steady_clock::now();
-        ++m_frame_index;
-        FlushDeferredResourceReleases(false);
-        const auto deferred_release_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.deferred_release_ms = ToMilliseconds(deferred_release_begin, deferred_release_end);
+        std::error_code fs_error;
+        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
+        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
+        const auto parent_path = resolved_path.parent_path();
+        if (!parent_path.empty())
+        {
+            std::filesystem::create_directories(parent_path, fs_error);
+            if (fs_error)
+            {
+                out_error = "Failed to create PIX output directory: " + parent_path.string();
+                return false;
+            }
+        }
 
+        pix_state.pending = {};
+        pix_state.pending.armed = true;
+        pix_state.pending.frame_index = m_frame_index;
+        pix_state.pending.requested_path = resolved_path;
         return true;
     }
 
-    bool RenderGraph::AcquireCurrentFrameCommandContext(FramePreparationContext& frame_context)
+    bool RenderGraph::IsPIXCaptureEnabled() const
     {
-        const auto acquire_context_begin = std::chrono::steady_clock::now();
-        frame_context.profiler_slot_index = frame_context.resource_frame_context.profiler_slot_index;
+        return m_pix_capture_state && m_pix_capture_state->enabled;
+    }
 
-        const auto resolve_profiler_begin = std::chrono::steady_clock::now();
-        ResolveGPUProfilerFrame(frame_context.profiler_slot_index);
-        const auto resolve_profiler_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.resolve_gpu_profiler_ms = ToMilliseconds(resolve_profiler_begin, resolve_profiler_end);
+    bool RenderGraph::IsPIXCaptureAvailable() const
+    {
+        return m_pix_capture_state && m_pix_capture_state->available;
+    }
 
-        if (!m_resource_allocator.HasCurrentSwapchainRT())
-        {
-            frame_context.command_list = nullptr;
-            m_current_frame_timing_breakdown.acquire_context_ms =
-                ToMilliseconds(acquire_context_begin, std::chrono::steady_clock::now());
-            return false;
-        }
+    bool RenderGraph::WasLastPIXCaptureSuccessful() const
+    {
+        return m_pix_capture_state && m_pix_capture_state->last_result.success;
+    }
 
-        if (frame_context.require_explicit_frame_wait)
-        {
-            const auto wait_begin = std::chrono::steady_clock::now();
-            m_resource_allocator.WaitFrameRenderFinished();
-            const auto wait_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.wait_previous_frame_ms = ToMilliseconds(wait_begin, wait_end);
-        }
+    unsigned long long RenderGraph::GetLastPIXCaptureFrameIndex() const
+    {
+        return m_pix_capture_state ? m_pix_capture_state->last_result.frame_index : 0ull;
+    }
 
-        const auto acquire_command_list_begin = std::chrono::steady_clock::now();
-        frame_context.command_list = &m_resource_allocator.GetCommandListForRecordPassCommand(frame_context.resource_frame_context);
-        const auto acquire_command_list_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.acquire_command_list_ms =
-            ToMilliseconds(acquire_command_list_begin, acquire_command_list_end);
+    std::string RenderGraph::GetLastPIXCapturePath() const
+    {
+        return m_pix_capture_state ? m_pix_capture_state->last_result.capture_path : std::string{};
+    }
 
-        m_current_frame_timing_breakdown.acquire_context_ms =
-            ToMilliseconds(acquire_context_begin, std::chrono::steady_clock::now());
-        return true;
+    std::string RenderGraph::GetLastPIXCaptureError() const
+    {
+        return m_pix_capture_state ? m_pix_capture_state->last_result.error : std::string{};
     }
 
-    bool RenderGraph::PrepareFrameForRendering(unsigned long long interval, FramePreparationContext& frame_context)
+    bool RenderGraph::OpenPIXCaptureInUI(const std::filesystem::path& capture_path, std::string& out_status)
     {
-        if (!ResolveFinalColorOutput())
+        std::error_code fs_error;
+        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
+        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
+        if (resolved_path.empty())
         {
+            out_status = "PIX UI launch failed: capture path is empty.";
             return false;
         }
-
-        frame_context.window_width = m_window.GetWidth();
-        frame_context.window_height = m_window.GetHeight();
-        if (frame_context.window_width == 0 || frame_context.window_height == 0)
+        if (!std::filesystem::exists(resolved_path, fs_error))
         {
+            out_status = "PIX UI launch failed: capture file does not exist: " + resolved_path.string();
             return false;
         }
 
-        if (!SyncWindowSurfaceAndAdvanceFrame(frame_context, interval))
+        const auto open_result = reinterpret_cast<intptr_t>(PIXOpenCaptureInUI(resolved_path.c_str()));
+        if (open_result > 32)
         {
-            return false;
+            out_status = "PIX UI launched for capture: " + resolved_path.string();
+            return true;
         }
 
-        ApplyPendingRenderStateUpdates(frame_context.resource_frame_context);
-        if (!AcquireCurrentFrameCommandContext(frame_context))
+        out_status = "PIX UI launch failed for capture: " + resolved_path.string();
+        return false;
+    }
+
+    bool RenderGraph::OpenLastPIXCaptureInUI(std::string& out_status)
+    {
+        const std::string capture_path = GetLastPIXCapturePath();
+        if (capture_path.empty())
         {
+            out_status = "PIX UI launch failed: there is no completed capture to open.";
             return false;
         }
-
-        ExecuteTickAndDebugUI(interval);
-        return true;
+        return OpenPIXCaptureInUI(std::filesystem::path(capture_path), out_status);
     }
 
-    void RenderGraph::ExecuteRenderGraphFrame(FramePreparationContext& frame_context, unsigned long long interval)
+    void RenderGraph::ShutdownRuntimeServices()
     {
-        BeginRenderDocFrameCapture();
-        BeginPIXFrameCapture();
-        const auto planning_begin = std::chrono::steady_clock::now();
-        m_resource_allocator.ApplyFrameBufferedRenderTargetAliases();
-        if (m_final_color_output_render_target_handle != NULL_HANDLE)
+        m_tick_callback = nullptr;
+        m_debug_ui_callback = nullptr;
+        m_final_color_output.reset();
+        m_final_color_output_texture_handle = NULL_HANDLE;
+        m_final_color_output_render_target_handle = NULL_HANDLE;
+        m_missing_final_color_output_logged = false;
+        ShutdownPIXCapture();
+        ShutdownRenderDocCapture();
+        ShutdownGPUProfiler();
+        ShutdownDebugUI();
+        if (m_parallel_recording_state)
         {
-            auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(m_final_color_output_render_target_handle);
-            m_final_color_output = render_target->m_source;
+            m_parallel_recording_state->worker_pool.reset();
         }
+    }
 
-        std::vector<RenderGraphNodeHandle> nodes;
-        const bool active_node_set_changed =
-            m_execution_plan_state.CollectActiveNodes(m_render_graph_node_handles, nodes);
-
-        const ExecutionPlanContext plan_context =
-            m_execution_plan_state.BuildContext(nodes, m_render_graph_nodes, m_render_graph_node_handles);
-
-        const unsigned hazard_check_interval_frames =
+    void RenderGraph::SetValidationPolicy(const ValidationPolicy& policy)
+    {
+        m_validation_policy = policy;
+        m_validation_policy.log_interval_frames = (std::max)(1u, m_validation_policy.log_interval_frames);
+        m_validation_policy.cross_frame_hazard_check_interval_frames =
             (std::max)(1u, m_validation_policy.cross_frame_hazard_check_interval_frames);
-        const bool should_update_dependency_diagnostics =
-            m_dependency_diagnostics_state.ShouldUpdate(m_frame_index, hazard_check_interval_frames);
-        const bool should_rebuild_execution_plan =
-            m_execution_plan_state.ShouldRebuild(active_node_set_changed, should_update_dependency_diagnostics);
+        m_dependency_diagnostics_state.Reset();
+        m_draw_validation_cache->Clear();
+    }
 
-        ExecutionPlanBuildResult plan{};
-        ExecutionPlanCacheState execution_cache_state = m_execution_plan_state.BuildCacheState();
-        std::vector<RenderGraphNodeHandle> diagnostics_cycle_nodes;
-        if (should_rebuild_execution_plan)
+    RenderGraph::ValidationPolicy RenderGraph::GetValidationPolicy() const
+    {
+        return m_validation_policy;
+    }
+
+    void RenderGraph::SetParallelRecordingPolicy(const ParallelRecordingPolicy& policy)
+    {
+        m_parallel_recording_policy = policy;
+        m_parallel_recording_policy.min_passes_per_segment = (std::max)(1u, m_parallel_recording_policy.min_passes_per_segment);
+        auto& worker_pool = m_parallel_recording_state->worker_pool;
+        if (!m_parallel_recording_policy.enable ||
+            (worker_pool && worker_pool->GetWorkerCount() != m_parallel_recording_policy.worker_count))
         {
-            plan = BuildExecutionPlan(plan_context);
-            diagnostics_cycle_nodes = ApplyExecutionPlanResult(plan_context, plan, execution_cache_state);
-            m_execution_plan_state.MarkPlanApplied();
+            worker_pool.reset();
         }
+    }
 
-        if (should_update_dependency_diagnostics)
-        {
-            auto current_frame_resource_access = CollectFrameResourceAccessDiagnostics(nodes, m_render_graph_nodes);
-            const unsigned cross_frame_comparison_window_size =
-                GetCrossFrameComparisonWindowSize(frame_context.resource_frame_context);
-            m_dependency_diagnostics_state.EnsureCrossFrameHazardSnapshotStorage(cross_frame_comparison_window_size);
-            const unsigned hazard_slot_index =
-                GetCrossFrameHazardSlotIndex(frame_context.resource_frame_context, cross_frame_comparison_window_size);
+    RenderGraph::ParallelRecordingPolicy RenderGraph::GetParallelRecordingPolicy() const
+    {
+        return m_parallel_recording_policy;
+    }
 
-            ResourceAccessMaskMap previous_frame_resource_access_masks;
-            ResourcePassAccessMap previous_frame_resource_pass_accesses;
-            unsigned compared_previous_frame_count = 0u;
-            const auto* previous_snapshot =
-                m_dependency_diagnostics_state.GetCrossFrameHazardSnapshot(hazard_slot_index);
-            const bool has_previous_frame_resource_access_masks = previous_snapshot != nullptr;
-            if (previous_snapshot)
-            {
-                previous_frame_resource_access_masks = previous_snapshot->access_masks;
-                previous_frame_resource_pass_accesses = previous_snapshot->pass_accesses;
-                compared_previous_frame_count = 1u;
-            }
+    void RenderGraph::SetAsyncComputePolicy(const AsyncComputePolicy& policy)
+    {
+        m_async_compute_policy = policy;
+        // Async render targets are kept out of shared heaps only while they are submitted async.
+        m_transient_aliasing_state->layout_dirty = true;
+    }
 
-            UpdateDependencyDiagnostics(
-                plan_context,
-                plan,
-                execution_cache_state.cached_execution_graph_valid,
-                execution_cache_state.cached_execution_signature,
-                execution_cache_state.cached_execution_node_count,
-                execution_cache_state.cached_execution_order.size(),
-                std::move(diagnostics_cycle_nodes),
-                m_auto_pruned_named_binding_counts,
-                previous_frame_resource_access_masks,
-                previous_frame_resource_pass_accesses,
-                has_previous_frame_resource_access_masks,
-                cross_frame_comparison_window_size,
-                compared_previous_frame_count,
-                current_frame_resource_access.access_masks,
-                current_frame_resource_access.pass_accesses,
-                m_dependency_diagnostics_state.diagnostics);
-            {
-                FrameResourceAccessSnapshot snapshot{};
-                snapshot.access_masks = std::move(current_frame_resource_access.access_masks);
-                snapshot.pass_accesses = std::move(current_frame_resource_access.pass_accesses);
-                snapshot.frame_index = m_frame_index;
-                m_dependency_diagnostics_state.UpdateCrossFrameHazardSnapshot(hazard_slot_index, std::move(snapshot));
-            }
+    RenderGraph::AsyncComputePolicy RenderGraph::GetAsyncComputePolicy() const
+    {
+        return m_async_compute_policy;
+    }
 
-            m_dependency_diagnostics_state.MarkUpdated(m_frame_index);
-        }
+    void RenderGraph::SetDeadPassCullingPolicy(const DeadPassCullingPolicy& policy)
+    {
+        m_dead_pass_culling_policy = policy;
+        m_execution_plan_state.MarkDirty();
+    }
 
-        const auto planning_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.execution_planning_ms = ToMilliseconds(planning_begin, planning_end);
+    RenderGraph::DeadPassCullingPolicy RenderGraph::GetDeadPassCullingPolicy() const
+    {
+        return m_dead_pass_culling_policy;
+    }
 
-        GLTF_CHECK(frame_context.command_list);
-        ExecutePlanAndCollectStats(
-            *frame_context.command_list,
-            frame_context.resource_frame_context,
-            frame_context.profiler_slot_index,
-            interval);
+    void RenderGraph::SetRenderPassMergePolicy(const RenderPassMergePolicy& policy)
+    {
+        m_render_pass_merge_policy = policy;
+        m_execution_plan_state.MarkDirty();
+    }
 
-        const auto collect_unused_begin = std::chrono::steady_clock::now();
-        CollectUnusedRenderPassDescriptorResources(frame_context.resource_frame_context);
-        const auto collect_unused_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.collect_unused_descriptor_ms =
-            ToMilliseconds(collect_unused_begin, collect_unused_end);
+    RenderGraph::RenderPassMergePolicy RenderGraph::GetRenderPassMergePolicy() const
+    {
+        return m_render_pass_merge_policy;
     }
 
-    void RenderGraph::BlitFinalOutputToSwapchain(
-        IRHICommandList& command_list,
-        const FrameContextSnapshot& frame_context,
-        unsigned window_width,
-        unsigned window_height)
+    void RenderGraph::SetTransientAliasingPolicy(const TransientAliasingPolicy& policy)
     {
-        if (!m_render_graph_node_handles.empty())
-        {
-            auto src = m_final_color_output;
-            auto dst = m_resource_allocator.GetCurrentSwapchainRT(frame_context).m_source;
+        m_transient_aliasing_policy = policy;
+        m_transient_aliasing_state->layout_dirty = true;
+    }
 
-            src->Transition(command_list, RHIResourceStateType::STATE_COPY_SOURCE);
-            dst->Transition(command_list, RHIResourceStateType::STATE_COPY_DEST);
+    RenderGraph::TransientAliasingPolicy RenderGraph::GetTransientAliasingPolicy() const
+    {
+        return m_transient_aliasing_policy;
+    }
 
-            const auto& src_desc = src->GetTextureDesc();
-            const auto& dst_desc = dst->GetTextureDesc();
-            const unsigned copy_width = (std::min)((std::min)(window_width, src_desc.GetTextureWidth()), dst_desc.GetTextureWidth());
-            const unsigned copy_height = (std::min)((std::min)(window_height, src_desc.GetTextureHeight()), dst_desc.GetTextureHeight());
-            if (copy_width > 0 && copy_height > 0)
-            {
-                RHICopyTextureInfo copy_info{};
-                copy_info.copy_width = copy_width;
-                copy_info.copy_height = copy_height;
-                copy_info.dst_mip_level = 0;
-                copy_info.src_mip_level = 0;
-                copy_info.dst_x = 0;
-                copy_info.dst_y = 0;
-                RHIUtilInstanceManager::Instance().CopyTexture(command_list, *dst, *src, copy_info);
-            }
-        }
+    void RenderGraph::SetBindingStatePolicy(const BindingStatePolicy& policy)
+    {
+        m_binding_state_policy = policy;
     }
 
-    bool RenderGraph::AcquireCurrentFrameSwapchain(FramePreparationContext& frame_context)
+    RenderGraph::BindingStatePolicy RenderGraph::GetBindingStatePolicy() const
     {
-        const auto acquire_frame_begin = std::chrono::steady_clock::now();
-        const bool acquire_succeeded = m_resource_allocator.GetCurrentSwapchain().AcquireNewFrame(m_resource_allocator.GetDevice());
-        const auto acquire_frame_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.acquire_swapchain_ms = ToMilliseconds(acquire_frame_begin, acquire_frame_end);
-        if (!acquire_succeeded)
-        {
-            m_resource_allocator.NotifySwapchainAcquireFailure();
-            frame_context.presentation_frame_context = {};
-            return false;
-        }
+        return m_binding_state_policy;
+    }
 
-        frame_context.presentation_frame_context = m_resource_allocator.GetFrameContext();
-        return true;
+    const RenderGraph::FrameStats& RenderGraph::GetLastFrameStats() const
+    {
+        return m_last_frame_stats;
     }
 
-    void RenderGraph::FinalizeFrameSubmission(FramePreparationContext& frame_context, bool swapchain_ready)
+    const RenderGraph::FrameTimingBreakdown& RenderGraph::GetLastFrameTimingBreakdown() const
     {
-        GLTF_CHECK(frame_context.command_list);
-        auto& command_list = *frame_context.command_list;
-        if (!swapchain_ready)
-        {
-            const auto submit_begin = std::chrono::steady_clock::now();
-            CloseCurrentCommandListAndExecute(command_list, {}, false);
-            const auto submit_end = std::chrono::steady_clock::now();
-            m_current_frame_timing_breakdown.submit_command_list_ms = ToMilliseconds(submit_begin, submit_end);
-            FinalizeRenderDocFrameCapture();
-            FinalizePIXFrameCapture();
+        return m_last_frame_timing_breakdown;
+    }
 
-            // Clear all nodes at end of frame
-            m_render_graph_node_handles.clear();
-            return;
-        }
+    void RenderGraph::SetTickCallbackBreakdown(float other_ms, float module_ms, float system_ms)
+    {
+        m_current_frame_timing_breakdown.tick_other_ms = (std::max)(0.0f, other_ms);
+        m_current_frame_timing_breakdown.module_tick_ms = (std::max)(0.0f, module_ms);
+        m_current_frame_timing_breakdown.system_tick_ms = (std::max)(0.0f, system_ms);
+    }
 
-        const auto render_debug_ui_begin = std::chrono::steady_clock::now();
-        GLTF_CHECK(RenderDebugUI(command_list, frame_context.presentation_frame_context));
-        const auto render_debug_ui_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.render_debug_ui_ms = ToMilliseconds(render_debug_ui_begin, render_debug_ui_end);
+    const RenderGraph::DependencyDiagnostics& RenderGraph::GetDependencyDiagnostics() const
+    {
+        return m_dependency_diagnostics_state.diagnostics;
+    }
 
-        const auto present_begin = std::chrono::steady_clock::now();
-        Present(command_list, frame_context.presentation_frame_context);
-        const auto present_end = std::chrono::steady_clock::now();
-        m_current_frame_timing_breakdown.present_ms = ToMilliseconds(present_begin, present_end);
-        FinalizeRenderDocFrameCapture();
-        FinalizePIXFrameCapture();
+    const RenderGraph::TransientAliasingDiagnostics& RenderGraph::GetTransientAliasingDiagnostics() const
+    {
+        return m_transient_aliasing_diagnostics;
+    }
 
-        // Clear all nodes at end of frame
-        m_render_graph_node_handles.clear();
+    const RenderGraph::BarrierPlanDiagnostics& RenderGraph::GetBarrierPlanDiagnostics() const
+    {
+        return m_barrier_plan_diagnostics;
     }
 
-    void RenderGraph::RegisterTextureToColorOutput(TextureHandle texture_handle)
+    std::string RenderGraph::DumpBarrierPlan() const
     {
-        m_final_color_output_texture_handle = texture_handle;
-        m_final_color_output_render_target_handle = NULL_HANDLE;
-        auto texture = InternalResourceHandleTable::Instance().GetTexture(texture_handle);
-        m_final_color_output = texture->m_texture;
-        m_missing_final_color_output_logged = false;
+        std::map<unsigned long long, BarrierResource> resources;
+        return RenderGraphBarrierPlanner::DumpPlan(BuildFrameBarrierPlan(m_barrier_state_requests, resources));
     }
 
-    void RenderGraph::RegisterRenderTargetToColorOutput(RenderTargetHandle render_target_handle)
+    const RenderGraph::AsyncComputeScheduleDiagnostics& RenderGraph::GetAsyncComputeScheduleDiagnostics() const
     {
-        m_final_color_output_render_target_handle = render_target_handle;
-        m_final_color_output_texture_handle = NULL_HANDLE;
-        auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(render_target_handle);
-        m_final_color_output = render_target->m_source;
-        m_missing_final_color_output_logged = false;
+        return m_async_compute_schedule_diagnostics;
     }
 
-    void RenderGraph::RegisterTickCallback(const RenderGraphTickCallback& callback)
+    std::string RenderGraph::DumpAsyncComputeSchedule() const
     {
-        m_tick_callback = callback;
+        return m_async_compute_schedule_dump;
     }
 
-    void RenderGraph::RegisterDebugUICallback(const RenderGraphDebugUICallback& callback)
+    const RenderGraph::RenderPassMergeDiagnostics& RenderGraph::GetRenderPassMergeDiagnostics() const
     {
-        m_debug_ui_callback = callback;
+        return m_render_pass_merge_diagnostics;
     }
 
-    void RenderGraph::EnableDebugUI(bool enable)
+    std::string RenderGraph::DumpRenderPassMergePlan() const
     {
-        if (enable && !m_debug_ui_initialized)
+        return RenderGraphAttachmentOps::DumpPlan(m_render_pass_merge_state->plan);
+    }
+
+    const RenderGraph::ExecutionPlanCacheDiagnostics& RenderGraph::GetExecutionPlanCacheDiagnostics() const
+    {
+        return m_execution_plan_cache_diagnostics;
+    }
+
+    bool RenderGraph::VerifyDrawValidationKeyCoverage(std::vector<std::string>& out_uncovered_fields)
+    {
+        out_uncovered_fields.clear();
+
+        RenderGraphNodeDesc base_desc{};
+        base_desc.render_pass_handle = RenderPassHandle{1};
+        RenderExecuteCommand dispatch_command{};
+        dispatch_command.type = ExecuteCommandType::COMPUTE_DISPATCH_COMMAND;
+        base_desc.draw_info.execute_commands.push_back(dispatch_command);
+        RenderTargetBindingDesc attachment{};
+        attachment.usage = RenderPassResourceUsage::COLOR;
+        base_desc.draw_info.render_target_resources[RenderTargetHandle{1}] = attachment;
+        BufferBindingDesc buffer{};
+        buffer.buffer_handle = BufferHandle{1};
+        buffer.binding_type = BufferBindingDesc::CBV;
+        base_desc.draw_info.buffer_resources["KeyCoverageBuffer"] = buffer;
+        TextureBindingDesc texture{};
+        texture.textures = {TextureHandle{1}};
+        texture.type = TextureBindingDesc::SRV;
+        base_desc.draw_info.texture_resources["KeyCoverageTexture"] = texture;
+        RenderTargetTextureBindingDesc render_target_texture{};
+        render_target_texture.render_target_texture = {RenderTargetHandle{2}};
+        render_target_texture.type = RenderTargetTextureBindingDesc::SRV;
+        base_desc.draw_info.render_target_texture_resources["KeyCoverageRenderTarget"] = render_target_texture;
+
+        const int render_passes[2] = {0, 0};
+        const auto base_key = ComputeDrawValidationKey(base_desc, &render_passes[0]);
+        const auto check_field = [&](const char* field_name, const void* render_pass, const auto& change_field)
         {
-            GLTF_CHECK(InitDebugUI());
-        }
-        m_debug_ui_enabled = enable;
+            auto node_desc = base_desc;
+            change_field(node_desc.draw_info);
+            if (ComputeDrawValidationKey(node_desc, render_pass) == base_key)
+            {
+                out_uncovered_fields.push_back(field_name);
+            }
+        };
+        const auto keep_fields = [](RenderPassDrawDesc&) {};
+        check_field("render pass", &render_passes[1], keep_fields);
+        check_field("execute_commands[].type", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.execute_commands.front().type = ExecuteCommandType::DRAW_VERTEX_COMMAND;
+        });
+        check_field("render_target_resources key", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.render_target_resources = {{RenderTargetHandle{3}, draw_info.render_target_resources.begin()->second}};
+        });
+        check_field("render_target_resources[].usage", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.render_target_resources.begin()->second.usage = RenderPassResourceUsage::DEPTH_STENCIL;
+        });
+        check_field("buffer_resources key", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.buffer_resources = {{"KeyCoverageOtherBuffer", draw_info.buffer_resources.begin()->second}};
+        });
+        check_field("buffer_resources[].buffer_handle", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.buffer_resources.begin()->second.buffer_handle = BufferHandle{};
+        });
+        check_field("buffer_resources[].binding_type", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.buffer_resources.begin()->second.binding_type = BufferBindingDesc::UAV;
+        });
+        check_field("texture_resources key", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.texture_resources = {{"KeyCoverageOtherTexture", draw_info.texture_resources.begin()->second}};
+        });
+        check_field("texture_resources[].textures", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.texture_resources.begin()->second.textures = {TextureHandle{}};
+        });
+        check_field("texture_resources[].type", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.texture_resources.begin()->second.type = TextureBindingDesc::UAV;
+        });
+        check_field("texture_resources[].bindless_table", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.texture_resources.begin()->second.bindless_table = true;
+        });
+        check_field("render_target_texture_resources key", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.render_target_texture_resources = {
+                {"KeyCoverageOtherRenderTarget", draw_info.render_target_texture_resources.begin()->second}};
+        });
+        check_field("render_target_texture_resources[].render_target_texture", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.render_target_texture_resources.begin()->second.render_target_texture = {RenderTargetHandle{}};
+        });
+        check_field("render_target_texture_resources[].type", &render_passes[0], [](RenderPassDrawDesc& draw_info)
+        {
+            draw_info.render_target_texture_resources.begin()->second.type = RenderTargetTextureBindingDesc::UAV;
+        });
+        return out_uncovered_fields.empty();
     }
 
-    bool RenderGraph::ConfigureRenderDocCapture(bool enable, bool require_available, std::string& out_status)
+    RenderGraph::ExecutionPlanningBenchmarkResult RenderGraph::BenchmarkExecutionPlanning(unsigned pass_count, unsigned iteration_count)
     {
-        if (!enable)
+        ExecutionPlanningBenchmarkResult result{};
+        result.pass_count = pass_count;
+        result.iteration_count = (std::max)(1u, iteration_count);
+
+        // Every pass writes its own color target and samples the previous output and one from halfway back.
+        // All passes share a constant buffer and read a structured buffer the first pass writes, the
+        // fan-out of light lists or exposure buffers.
+        std::vector<RenderGraphNodeDesc> render_graph_nodes(pass_count);
+        std::vector<RenderGraphNodeHandle> nodes;
+        std::set<RenderGraphNodeHandle> registered_nodes;
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
         {
-            if (m_renderdoc_capture_state)
+            auto& node_desc = render_graph_nodes[pass_index];
+            auto& draw_info = node_desc.draw_info;
+
+            RenderTargetBindingDesc output{};
+            output.usage = RenderPassResourceUsage::COLOR;
+            output.load_op = RenderPassAttachmentLoadOp::CLEAR;
+            draw_info.render_target_resources[RenderTargetHandle{pass_index}] = output;
+
+            if (pass_index > 0)
             {
-                auto& renderdoc_state = *m_renderdoc_capture_state;
-                if (renderdoc_state.api && renderdoc_state.api->MaskOverlayBits && renderdoc_state.overlay_hidden)
-                {
-                    const uint32_t overlay_bits = renderdoc_state.overlay_bits_saved
-                        ? renderdoc_state.saved_overlay_bits
-                        : static_cast<uint32_t>(eRENDERDOC_Overlay_None);
-                    renderdoc_state.api->MaskOverlayBits(0u, overlay_bits);
-                    renderdoc_state.overlay_hidden = false;
-                }
-                renderdoc_state.enabled = false;
-                renderdoc_state.required = false;
-                renderdoc_state.pending = {};
+                RenderTargetTextureBindingDesc inputs{};
+                inputs.name = "Inputs";
+                inputs.render_target_texture = {RenderTargetHandle{pass_index - 1}, RenderTargetHandle{pass_index / 2}};
+                inputs.type = RenderTargetTextureBindingDesc::SRV;
+                draw_info.render_target_texture_resources[inputs.name] = inputs;
             }
-            out_status = "RenderDoc capture disabled.";
-            return true;
+
+            BufferBindingDesc view_constants{};
+            view_constants.buffer_handle = BufferHandle{0};
+            view_constants.binding_type = BufferBindingDesc::CBV;
+            draw_info.buffer_resources["ViewConstants"] = view_constants;
+
+            BufferBindingDesc shared_buffer{};
+            shared_buffer.buffer_handle = BufferHandle{1};
+            shared_buffer.binding_type = pass_index == 0 ? BufferBindingDesc::UAV : BufferBindingDesc::SRV;
+            draw_info.buffer_resources["SharedBuffer"] = shared_buffer;
+
+            if (pass_index >= 8 && pass_index % 8 == 0)
+            {
+                node_desc.dependency_render_graph_nodes.push_back(RenderGraphNodeHandle{pass_index - 8});
+            }
+
+            nodes.push_back(RenderGraphNodeHandle{pass_index});
+            registered_nodes.insert(RenderGraphNodeHandle{pass_index});
         }
 
-        if (!m_renderdoc_capture_state)
+        const std::vector<RenderGraphNodeHandle> no_cached_execution_order;
+        const ExecutionPlanContext context{nodes, render_graph_nodes, registered_nodes, no_cached_execution_order, true, 0, 0};
+        std::size_t planning_signature = 0;
+        std::vector<RenderGraphNodeHandle> execution_order;
+        const auto full_plan_begin = std::chrono::steady_clock::now();
+        for (unsigned iteration = 0; iteration < result.iteration_count; ++iteration)
         {
-            m_renderdoc_capture_state = std::make_unique<RenderDocCaptureState>();
+            planning_signature = ComputePlanningSignature(nodes, render_graph_nodes);
+            const auto plan = BuildExecutionPlan(context);
+            result.sorted = TopologicalSortExecutionNodes(nodes, plan.combined_edges, execution_order);
+            result.edge_count = static_cast<unsigned>(plan.combined_edges.edges.size());
         }
+        const auto full_plan_end = std::chrono::steady_clock::now();
 
-        auto& renderdoc_state = *m_renderdoc_capture_state;
-        renderdoc_state.enabled = true;
-        renderdoc_state.required = require_available;
-        if (renderdoc_state.available && renderdoc_state.api)
+        ExecutionPlanCache cache{};
+        cache.Insert(planning_signature, 0).execution_order = execution_order;
+        unsigned hit_count = 0;
+        const auto cached_lookup_begin = std::chrono::steady_clock::now();
+        for (unsigned iteration = 0; iteration < result.iteration_count; ++iteration)
         {
-            if (renderdoc_state.api->MaskOverlayBits)
+            if (cache.Find(ComputePlanningSignature(nodes, render_graph_nodes), iteration))
             {
-                if (!renderdoc_state.overlay_bits_saved && renderdoc_state.api->GetOverlayBits)
-                {
-                    renderdoc_state.saved_overlay_bits = renderdoc_state.api->GetOverlayBits();
-                    renderdoc_state.overlay_bits_saved = true;
-                }
-                renderdoc_state.api->MaskOverlayBits(0u, 0u);
-                renderdoc_state.overlay_hidden = true;
+                ++hit_count;
             }
-            out_status = renderdoc_state.status.empty() ? "RenderDoc API ready." : renderdoc_state.status;
-            return true;
         }
+        const auto cached_lookup_end = std::chrono::steady_clock::now();
+        GLTF_CHECK(hit_count == result.iteration_count);
 
-        const bool initialized = InitRenderDocCapture(require_available, out_status);
-        if (!initialized && !require_available)
+        result.full_plan_ms = ToMilliseconds(full_plan_begin, full_plan_end) / static_cast<float>(result.iteration_count);
+        result.cached_lookup_ms = ToMilliseconds(cached_lookup_begin, cached_lookup_end) / static_cast<float>(result.iteration_count);
+        return result;
+    }
+
+    void RenderGraph::RequestExecutionPlanningSnapshot(const std::string& path)
+    {
+        m_pending_execution_planning_snapshot_path = path;
+    }
+
+    void RenderGraph::RequestFrameTrace(const std::string& path, unsigned frame_count)
+    {
+        auto& trace_state = *m_frame_trace_state;
+        trace_state.path = path;
+        trace_state.requested_frame_count = (std::max)(1u, frame_count);
+        trace_state.first_frame_index = m_frame_index + 1;
+        trace_state.resolved_frame_count = 0;
+        trace_state.capturing = true;
+        trace_state.trace = {};
+        RenderGraphTraceExport::FindOrAddTrack(trace_state.trace, MakeRenderThreadTraceTrack());
+    }
+
+    RenderGraph::FrameTraceStatus RenderGraph::GetFrameTraceStatus() const
+    {
+        const auto& trace_state = *m_frame_trace_state;
+        FrameTraceStatus status{};
+        status.capturing = trace_state.capturing;
+        status.requested_frame_count = trace_state.requested_frame_count;
+        status.resolved_frame_count = trace_state.resolved_frame_count;
+        status.last_path = trace_state.last_path;
+        status.last_write_succeeded = trace_state.last_write_succeeded;
+        return status;
+    }
+
+    bool RenderGraph::IsCapturingFrameTrace(unsigned long long frame_index) const
+    {
+        const auto& trace_state = *m_frame_trace_state;
+        return trace_state.capturing &&
+            frame_index >= trace_state.first_frame_index &&
+            frame_index < trace_state.first_frame_index + trace_state.requested_frame_count;
+    }
+
+    void RenderGraph::RecordFrameTraceSpan(const char* category, const char* name, double begin_ms, double end_ms)
+    {
+        if (!IsCapturingFrameTrace(m_frame_index))
         {
-            return true;
+            return;
         }
-        return initialized;
+
+        auto& trace = m_frame_trace_state->trace;
+        RenderGraphTraceExport::Span span{};
+        span.track_index = RenderGraphTraceExport::FindOrAddTrack(trace, MakeRenderThreadTraceTrack());
+        span.name = name;
+        span.category = category;
+        span.begin_ms = begin_ms;
+        span.end_ms = end_ms;
+        span.frame_index = m_frame_index;
+        trace.spans.push_back(std::move(span));
     }
 
-    bool RenderGraph::RequestRenderDocCaptureForCurrentFrame(const std::filesystem::path& capture_path, std::string& out_error)
+    void RenderGraph::AppendFrameTracePasses(
+        const FrameStats& frame_stats,
+        const std::vector<std::pair<double, double>>& gpu_spans_ms,
+        bool gpu_calibrated)
     {
-        out_error.clear();
-        if (!m_renderdoc_capture_state || !m_renderdoc_capture_state->enabled)
+        if (!IsCapturingFrameTrace(frame_stats.frame_index))
         {
-            out_error = "RenderDoc capture is not enabled for this run.";
-            return false;
+            return;
         }
 
-        auto& renderdoc_state = *m_renderdoc_capture_state;
-        if (!renderdoc_state.available || !renderdoc_state.api)
+        auto& trace_state = *m_frame_trace_state;
+        auto& trace = trace_state.trace;
+        // Serially recorded passes nest under the render thread's frame sections; parallel segments get a
+        // track each since they overlap.
+        const bool parallel_recording = frame_stats.recording_segment_count > 1;
+        const unsigned gpu_track = RenderGraphTraceExport::FindOrAddTrack(trace, {2, 1, "GPU", "Graphics queue"});
+        for (size_t pass_index = 0; pass_index < frame_stats.pass_stats.size(); ++pass_index)
         {
-            out_error = !renderdoc_state.status.empty() ? renderdoc_state.status : "RenderDoc API unavailable.";
-            return false;
+            const auto& pass_stats = frame_stats.pass_stats[pass_index];
+            RenderGraphTraceExport::Span span{};
+            span.name = pass_stats.pass_name;
+            span.category = pass_stats.group_name;
+            span.frame_index = frame_stats.frame_index;
+            if (pass_stats.cpu_end_ms > pass_stats.cpu_begin_ms)
+            {
+                span.track_index = parallel_recording
+                    ? RenderGraphTraceExport::FindOrAddTrack(trace, {
+                        1,
+                        2 + pass_stats.recording_segment_index,
+                        "CPU",
+                        "Record segment " + std::to_string(pass_stats.recording_segment_index)})
+                    : RenderGraphTraceExport::FindOrAddTrack(trace, MakeRenderThreadTraceTrack());
+                span.begin_ms = pass_stats.cpu_begin_ms;
+                span.end_ms = pass_stats.cpu_end_ms;
+                trace.spans.push_back(span);
+            }
+            if (pass_index < gpu_spans_ms.size() && gpu_spans_ms[pass_index].second > gpu_spans_ms[pass_index].first)
+            {
+                span.track_index = pass_stats.async_compute
+                    ? RenderGraphTraceExport::FindOrAddTrack(trace, {2, 2, "GPU", "Async compute queue"})
+                    : gpu_track;
+                span.begin_ms = gpu_spans_ms[pass_index].first;
+                span.end_ms = gpu_spans_ms[pass_index].second;
+                span.gpu_calibrated = gpu_calibrated;
+                trace.spans.push_back(std::move(span));
+            }
         }
-        if (m_pix_capture_state && m_pix_capture_state->pending.armed)
+        ++trace_state.resolved_frame_count;
+    }
+
+    void RenderGraph::UpdateFrameTrace()
+    {
+        auto& trace_state = *m_frame_trace_state;
+        if (!trace_state.capturing)
         {
-            out_error = "PIX capture is already armed for a frame.";
-            return false;
+            return;
         }
-        if (m_pix_capture_state && (PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+
+        // Timestamps of a frame are read back when its frame slot comes around again; allow a couple of
+        // frames more before writing without them.
+        const unsigned long long capture_end_frame = trace_state.first_frame_index + trace_state.requested_frame_count;
+        const bool complete = trace_state.resolved_frame_count >= trace_state.requested_frame_count;
+        const bool timed_out = m_frame_index >= capture_end_frame + m_resource_allocator.GetFrameSlotCount() + 2;
+        if (!complete && !timed_out)
         {
-            out_error = "PIX is already capturing a frame.";
-            return false;
+            return;
         }
-        if (renderdoc_state.pending.armed)
+
+        std::ofstream trace_file(trace_state.path, std::ios::binary);
+        trace_file << RenderGraphTraceExport::BuildChromeTraceJson(trace_state.trace);
+        trace_state.last_write_succeeded = static_cast<bool>(trace_file);
+        trace_state.last_path = trace_state.path;
+        if (trace_state.last_write_succeeded)
         {
-            out_error = "RenderDoc capture is already armed for a frame.";
-            return false;
+            LOG_FORMAT_FLUSH("[RenderGraph] Frame trace written: %u/%u frames, %u spans -> %s\n",
+                trace_state.resolved_frame_count,
+                trace_state.requested_frame_count,
+                static_cast<unsigned>(trace_state.trace.spans.size()),
+                trace_state.path.c_str());
         }
-        if (renderdoc_state.api->IsFrameCapturing())
+        else
         {
-            out_error = "RenderDoc is already capturing a frame.";
-            return false;
+            LOG_FORMAT_FLUSH("[RenderGraph] Failed to write frame trace %s\n", trace_state.path.c_str());
         }
+        trace_state.capturing = false;
+        trace_state.trace = {};
+    }
 
-        std::error_code fs_error;
-        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
-        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
-        const auto parent_path = resolved_path.parent_path();
-        if (!parent_path.empty())
+    bool RenderGraph::WriteExecutionPlanningSnapshot(const std::string& path, const std::vector<RenderGraphNodeHandle>& nodes) const
+    {
+        // Everything the planner would otherwise query from the device is resolved here: pass types,
+        // render areas, barrier states and render target sizes.
+        nlohmann::json root;
+        root["version"] = EXECUTION_PLANNING_SNAPSHOT_VERSION;
+        root["frame_index"] = m_frame_index;
+        root["dead_pass_culling"] = m_dead_pass_culling_policy.enable;
+        root["render_pass_merge"] = {
+            {"infer_store_ops", m_render_pass_merge_policy.infer_store_ops},
+            {"merge_passes", m_render_pass_merge_policy.merge_passes}};
+        root["output_resource_keys"] = CollectOutputResourceKeys();
+
+        std::set<unsigned> render_target_handles;
+        auto& nodes_json = root["nodes"];
+        nodes_json = nlohmann::json::array();
+        for (const auto node_handle : nodes)
         {
-            std::filesystem::create_directories(parent_path, fs_error);
-            if (fs_error)
+            const auto& node_desc = m_render_graph_nodes[node_handle.value];
+            const auto& draw_info = node_desc.draw_info;
+            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
+
+            nlohmann::json node_json;
+            node_json["handle"] = node_handle.value;
+            node_json["group"] = node_desc.debug_group;
+            node_json["name"] = node_desc.debug_name;
+            node_json["render_pass"] = node_desc.render_pass_handle.value;
+            node_json["pass_type"] = static_cast<unsigned>(render_pass ? render_pass->GetRenderPassType() : RenderPassType::GRAPHICS);
+            node_json["queue_affinity"] = static_cast<unsigned>(node_desc.queue_affinity);
+            const auto render_area = ResolveRenderArea(node_desc, render_pass.get());
+            node_json["render_area"] = {render_area.offset_x, render_area.offset_y, render_area.width, render_area.height};
+
+            auto& dependencies_json = node_json["dependencies"];
+            dependencies_json = nlohmann::json::array();
+            for (const auto dependency : node_desc.dependency_render_graph_nodes)
             {
-                out_error = "Failed to create RenderDoc output directory: " + parent_path.string();
-                return false;
+                dependencies_json.push_back(dependency.value);
             }
-        }
 
-        renderdoc_state.pending = {};
-        renderdoc_state.pending.armed = true;
-        renderdoc_state.pending.frame_index = m_frame_index;
-        renderdoc_state.pending.capture_count_before = renderdoc_state.api->GetNumCaptures();
-        renderdoc_state.pending.requested_path = resolved_path;
-        return true;
-    }
+            auto& buffers_json = node_json["buffers"];
+            buffers_json = nlohmann::json::array();
+            for (const auto& buffer_pair : draw_info.buffer_resources)
+            {
+                buffers_json.push_back({
+                    {"name", buffer_pair.first.GetString()},
+                    {"handle", buffer_pair.second.buffer_handle.value},
+                    {"type", static_cast<unsigned>(buffer_pair.second.binding_type)}});
+            }
 
-    bool RenderGraph::IsRenderDocCaptureEnabled() const
-    {
-        return m_renderdoc_capture_state && m_renderdoc_capture_state->enabled;
-    }
+            auto& textures_json = node_json["textures"];
+            textures_json = nlohmann::json::array();
+            for (const auto& texture_pair : draw_info.texture_resources)
+            {
+                nlohmann::json handles_json = nlohmann::json::array();
+                for (const auto texture_handle : texture_pair.second.textures)
+                {
+                    handles_json.push_back(texture_handle.value);
+                }
+                textures_json.push_back({
+                    {"name", texture_pair.first.GetString()},
+                    {"handles", handles_json},
+                    {"type", static_cast<unsigned>(texture_pair.second.type)}});
+            }
 
-    unsigned long long RenderGraph::GetCurrentFrameIndex() const
-    {
-        return m_frame_index;
-    }
+            auto& render_target_textures_json = node_json["render_target_textures"];
+            render_target_textures_json = nlohmann::json::array();
+            for (const auto& render_target_pair : draw_info.render_target_texture_resources)
+            {
+                nlohmann::json handles_json = nlohmann::json::array();
+                for (const auto render_target_handle : render_target_pair.second.render_target_texture)
+                {
+                    handles_json.push_back(render_target_handle.value);
+                    render_target_handles.insert(render_target_handle.value);
+                }
+                render_target_textures_json.push_back({
+                    {"name", render_target_pair.first.GetString()},
+                    {"handles", handles_json},
+                    {"type", static_cast<unsigned>(render_target_pair.second.type)}});
+            }
 
-    bool RenderGraph::IsRenderDocCaptureAvailable() const
-    {
-        return m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api;
-    }
+            auto& attachments_json = node_json["attachments"];
+            attachments_json = nlohmann::json::array();
+            for (const auto& render_target_pair : draw_info.render_target_resources)
+            {
+                attachments_json.push_back({
+                    {"handle", render_target_pair.first.value},
+                    {"usage", static_cast<unsigned>(render_target_pair.second.usage)},
+                    {"load_op", static_cast<unsigned>(render_target_pair.second.load_op)},
+                    {"store_op", static_cast<unsigned>(render_target_pair.second.store_op)},
+                    {"need_clear", render_target_pair.second.need_clear}});
+                render_target_handles.insert(render_target_pair.first.value);
+            }
 
-    bool RenderGraph::WasLastRenderDocCaptureSuccessful() const
-    {
-        return m_renderdoc_capture_state && m_renderdoc_capture_state->last_result.success;
-    }
+            node_json["barrier_states"] = CollectBarrierStateRequests(node_desc);
+            nodes_json.push_back(std::move(node_json));
+        }
 
-    unsigned long long RenderGraph::GetLastRenderDocCaptureFrameIndex() const
-    {
-        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.frame_index : 0ull;
-    }
+        auto& render_targets_json = root["render_targets"];
+        render_targets_json = nlohmann::json::array();
+        for (const unsigned render_target_handle : render_target_handles)
+        {
+            RenderTargetDesc render_target_desc{};
+            if (!m_resource_allocator.GetRenderTargetDesc(RenderTargetHandle{render_target_handle}, render_target_desc))
+            {
+                continue;
+            }
 
-    std::string RenderGraph::GetLastRenderDocCapturePath() const
-    {
-        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.capture_path : std::string{};
-    }
+            nlohmann::json render_target_json = {
+                {"handle", render_target_handle},
+                {"extent", {render_target_desc.width, render_target_desc.height}}};
+            unsigned long long placement_bytes = 0;
+            unsigned long long placement_alignment = 0;
+            if (m_resource_allocator.GetRenderTargetPlacementRequirements(RenderTargetHandle{render_target_handle}, placement_bytes, placement_alignment))
+            {
+                render_target_json["placement_bytes"] = placement_bytes;
+                render_target_json["placement_alignment"] = placement_alignment;
+            }
+            render_targets_json.push_back(std::move(render_target_json));
+        }
 
-    std::string RenderGraph::GetLastRenderDocCaptureError() const
-    {
-        return m_renderdoc_capture_state ? m_renderdoc_capture_state->last_result.error : std::string{};
+        std::ofstream output_stream(path, std::ios::out | std::ios::trunc);
+        if (!output_stream.is_open())
+        {
+            return false;
+        }
+        output_stream << root.dump(2) << "\n";
+        return output_stream.good();
     }
 
-    bool RenderGraph::OpenRenderDocCaptureInReplayUI(const std::filesystem::path& capture_path, std::string& out_status)
+    RenderGraph::ExecutionPlanningReplayResult RenderGraph::ReplayExecutionPlanningSnapshot(const std::string& path, unsigned iteration_count)
     {
-        out_status.clear();
+        ExecutionPlanningReplayResult result{};
+        result.iteration_count = (std::max)(1u, iteration_count);
 
-        std::error_code fs_error{};
-        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
-        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
-        if (resolved_path.empty())
+        ExecutionPlanningSnapshot snapshot{};
+        if (!ReadExecutionPlanningSnapshot(path, snapshot, result.report))
         {
-            out_status = "RenderDoc replay launch failed: capture path is empty.";
-            return false;
+            return result;
         }
+        result.loaded = true;
+        result.pass_count = static_cast<unsigned>(snapshot.nodes.size());
 
-        const bool capture_exists = std::filesystem::exists(resolved_path, fs_error) && !fs_error;
-        if (!capture_exists)
+        const auto& nodes = snapshot.nodes;
+        const auto& render_graph_nodes = snapshot.render_graph_nodes;
+        const std::set<RenderGraphNodeHandle> registered_nodes(nodes.begin(), nodes.end());
+        const std::vector<RenderGraphNodeHandle> no_cached_execution_order;
+        const ExecutionPlanContext context{nodes, render_graph_nodes, registered_nodes, no_cached_execution_order, true, 0, 0};
+        const auto get_placement_requirements = [&snapshot](RenderTargetHandle handle, unsigned long long& out_size_bytes, unsigned long long& out_alignment)
         {
-            out_status = "RenderDoc replay launch failed: capture file does not exist: " + resolved_path.string();
-            return false;
-        }
+            const auto it = snapshot.render_target_placements.find(handle.value);
+            if (it == snapshot.render_target_placements.end())
+            {
+                return false;
+            }
+            out_size_bytes = it->second.first;
+            out_alignment = it->second.second;
+            return true;
+        };
+        const auto get_render_target_extent = [&snapshot](RenderTargetHandle handle, unsigned& out_width, unsigned& out_height)
+        {
+            const auto it = snapshot.render_target_extents.find(handle.value);
+            if (it == snapshot.render_target_extents.end())
+            {
+                return false;
+            }
+            out_width = it->second.first;
+            out_height = it->second.second;
+            return true;
+        };
 
-        if (m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api)
+        std::vector<RenderGraphNodeHandle> execution_order;
+        std::vector<RenderGraphNodeHandle> culled_nodes;
+        std::vector<RenderGraphNodeHandle> live_execution_order;
+        std::vector<std::vector<RenderGraphBarrierPlanner::StateRequest>> barrier_steps;
+        RenderGraphBarrierPlanner::Plan barrier_plan{};
+        std::string async_compute_schedule_dump;
+        RenderGraphAttachmentOps::Plan render_pass_merge_plan{};
+        TransientAliasingLayout transient_aliasing_layout{};
+        std::size_t planning_signature = 0;
+        float total_ms[8] = {};
+        for (unsigned iteration = 0; iteration < result.iteration_count; ++iteration)
         {
-            auto& renderdoc_state = *m_renderdoc_capture_state;
-            if (renderdoc_state.api->LaunchReplayUI)
+            const auto signature_begin = std::chrono::steady_clock::now();
+            planning_signature = ComputePlanningSignature(nodes, render_graph_nodes);
+
+            const auto plan_begin = std::chrono::steady_clock::now();
+            const auto plan = BuildExecutionPlan(context);
+
+            const auto sort_begin = std::chrono::steady_clock::now();
+            result.sorted = TopologicalSortExecutionNodes(nodes, plan.combined_edges, execution_order);
+            result.edge_count = static_cast<unsigned>(plan.combined_edges.edges.size());
+
+            const auto cull_begin = std::chrono::steady_clock::now();
+            culled_nodes.clear();
+            if (snapshot.dead_pass_culling)
             {
-                const std::string command_line = QuoteCommandLineArgument(PathToUtf8String(resolved_path));
-                const uint32_t replay_pid = renderdoc_state.api->LaunchReplayUI(1u, command_line.c_str());
-                if (replay_pid != 0u)
+                culled_nodes = CollectDeadNodes(execution_order, render_graph_nodes, plan.combined_edges, snapshot.output_resource_keys);
+            }
+            live_execution_order.clear();
+            auto culled_it = culled_nodes.begin();
+            for (const auto node_handle : execution_order)
+            {
+                if (culled_it != culled_nodes.end() && *culled_it == node_handle)
                 {
-                    out_status =
-                        "RenderDoc replay UI launched for capture: " + resolved_path.string() +
-                        " (pid " + std::to_string(replay_pid) + ").";
-                    return true;
+                    ++culled_it;
+                    continue;
                 }
+                live_execution_order.push_back(node_handle);
             }
-        }
-
-        const auto shell_result = reinterpret_cast<intptr_t>(
-            ShellExecuteW(nullptr, L"open", resolved_path.c_str(), nullptr, nullptr, SW_SHOWNORMAL));
-        if (shell_result > 32)
-        {
-            out_status = "RenderDoc capture opened via shell association: " + resolved_path.string();
-            return true;
-        }
 
-        if (m_renderdoc_capture_state && m_renderdoc_capture_state->available && m_renderdoc_capture_state->api)
-        {
-            auto& renderdoc_state = *m_renderdoc_capture_state;
-            if (renderdoc_state.api->ShowReplayUI &&
-                renderdoc_state.api->IsTargetControlConnected &&
-                renderdoc_state.api->IsTargetControlConnected() != 0 &&
-                renderdoc_state.api->ShowReplayUI() != 0)
+            // Snapshots carry no RHI resources, so every handle plans as its own resource.
+            const auto barrier_plan_begin = std::chrono::steady_clock::now();
+            barrier_steps.clear();
+            barrier_steps.reserve(live_execution_order.size());
+            for (const auto node_handle : live_execution_order)
             {
-                out_status =
-                    "RenderDoc replay UI was shown, but the capture file could not be opened automatically: " +
-                    resolved_path.string();
-                return true;
+                auto& step = barrier_steps.emplace_back();
+                for (const auto& state_request : snapshot.barrier_state_requests[node_handle.value])
+                {
+                    const bool allow_split =
+                        static_cast<ResourceKind>(state_request.first >> 62ull) == ResourceKind::RenderTarget;
+                    step.push_back({state_request.first, state_request.second, allow_split});
+                }
             }
-        }
+            barrier_plan = RenderGraphBarrierPlanner::BuildPlan(barrier_steps);
+
+            const auto queue_schedule_begin = std::chrono::steady_clock::now();
+            std::vector<RenderPassType> pass_types;
+            std::vector<std::vector<std::pair<unsigned long long, unsigned>>> barrier_state_requests;
+            pass_types.reserve(live_execution_order.size());
+            barrier_state_requests.reserve(live_execution_order.size());
+            for (const auto node_handle : live_execution_order)
+            {
+                pass_types.push_back(snapshot.pass_types[node_handle.value]);
+                barrier_state_requests.push_back(snapshot.barrier_state_requests[node_handle.value]);
+            }
+            BuildAsyncComputeSchedule(
+                live_execution_order,
+                render_graph_nodes,
+                pass_types,
+                barrier_state_requests,
+                result.async_compute_schedule,
+                async_compute_schedule_dump);
+
+            const auto render_pass_merge_begin = std::chrono::steady_clock::now();
+            std::vector<RenderViewportRect> render_areas;
+            render_areas.reserve(live_execution_order.size());
+            for (const auto node_handle : live_execution_order)
+            {
+                render_areas.push_back(ResolveRenderArea(render_graph_nodes[node_handle.value], nullptr));
+            }
+            render_pass_merge_plan = BuildRenderPassMergePlan(
+                live_execution_order,
+                render_graph_nodes,
+                pass_types,
+                render_areas,
+                barrier_state_requests,
+                snapshot.output_resource_keys,
+                get_render_target_extent,
+                snapshot.render_pass_merge_policy);
+
+            // Transient targets are chosen by how their rendering scopes load them, so this follows the merge plan.
+            const auto aliasing_plan_begin = std::chrono::steady_clock::now();
+            result.transient_aliasing = BuildTransientAliasingDiagnostics(
+                live_execution_order,
+                render_graph_nodes,
+                render_pass_merge_plan,
+                snapshot.output_resource_keys,
+                get_placement_requirements,
+                &transient_aliasing_layout);
+            const auto aliasing_plan_end = std::chrono::steady_clock::now();
+
+            total_ms[0] += ToMilliseconds(signature_begin, plan_begin);
+            total_ms[1] += ToMilliseconds(plan_begin, sort_begin);
+            total_ms[2] += ToMilliseconds(sort_begin, cull_begin);
+            total_ms[3] += ToMilliseconds(cull_begin, barrier_plan_begin);
+            total_ms[4] += ToMilliseconds(barrier_plan_begin, queue_schedule_begin);
+            total_ms[5] += ToMilliseconds(aliasing_plan_begin, aliasing_plan_end);
+            total_ms[6] += ToMilliseconds(queue_schedule_begin, render_pass_merge_begin);
+            total_ms[7] += ToMilliseconds(render_pass_merge_begin, aliasing_plan_begin);
+        }
+
+        const float iterations = static_cast<float>(result.iteration_count);
+        result.signature_ms = total_ms[0] / iterations;
+        result.plan_ms = total_ms[1] / iterations;
+        result.sort_ms = total_ms[2] / iterations;
+        result.cull_ms = total_ms[3] / iterations;
+        result.barrier_plan_ms = total_ms[4] / iterations;
+        result.aliasing_plan_ms = total_ms[5] / iterations;
+        result.queue_schedule_ms = total_ms[6] / iterations;
+        result.render_pass_merge_ms = total_ms[7] / iterations;
+        result.culled_pass_count = static_cast<unsigned>(culled_nodes.size());
+        result.planned_full_barrier_count = barrier_plan.full_barrier_count;
+        result.planned_split_barrier_count = barrier_plan.split_barrier_count;
+        result.render_pass_merge = SummarizeRenderPassMergePlan(render_pass_merge_plan);
+        RecordBarrierPlanOnNullRHI(barrier_plan, barrier_steps, transient_aliasing_layout.step_barriers, snapshot.render_target_extents, result);
+
+        const auto describe_node = [&snapshot, &render_graph_nodes](RenderGraphNodeHandle node_handle)
+        {
+            const auto& node_desc = render_graph_nodes[node_handle.value];
+            std::string description = node_desc.debug_group.empty() ? "Ungrouped" : node_desc.debug_group;
+            description += "/";
+            description += node_desc.debug_name.empty()
+                ? std::string(ToRenderPassTypeName(snapshot.pass_types[node_handle.value])) + "#" + std::to_string(node_handle.value)
+                : node_desc.debug_name;
+            return description;
+        };
 
-        out_status = "RenderDoc replay launch failed for capture: " + resolved_path.string();
-        return false;
+        std::string& report = result.report;
+        char line[256];
+        std::snprintf(line, sizeof(line), "passes=%u edges=%u sorted=%d culled=%u signature=%016llx\n",
+            result.pass_count, result.edge_count, result.sorted ? 1 : 0, result.culled_pass_count,
+            static_cast<unsigned long long>(planning_signature));
+        report += line;
+        report += "order:\n";
+        for (unsigned step_index = 0; step_index < live_execution_order.size(); ++step_index)
+        {
+            std::snprintf(line, sizeof(line), "  %u node %u %s\n",
+                step_index, live_execution_order[step_index].value, describe_node(live_execution_order[step_index]).c_str());
+            report += line;
+        }
+        report += "culled:\n";
+        for (const auto node_handle : culled_nodes)
+        {
+            std::snprintf(line, sizeof(line), "  node %u %s\n", node_handle.value, describe_node(node_handle).c_str());
+            report += line;
+        }
+        report += "barriers:\n";
+        report += RenderGraphBarrierPlanner::DumpPlan(barrier_plan);
+        std::snprintf(line, sizeof(line),
+            "null rhi: batches=%u recorded=%u split=%u elided=%u texture_barriers=%u buffer_barriers=%u aliasing_barriers=%u validation_errors=%llu\n",
+            result.null_rhi_barriers.recorded_batch_count,
+            result.null_rhi_barriers.recorded_barrier_count,
+            result.null_rhi_barriers.recorded_split_barrier_count,
+            result.null_rhi_barriers.elided_barrier_count,
+            result.null_rhi_texture_barrier_count,
+            result.null_rhi_buffer_barrier_count,
+            result.null_rhi_aliasing_barrier_count,
+            result.null_rhi_validation_error_count);
+        report += line;
+        std::snprintf(line, sizeof(line),
+            "memory: committed=%llu aliased=%llu transient=%u persistent=%u heaps=%u aliasing_barriers=%u\n",
+            result.transient_aliasing.committed_bytes,
+            result.transient_aliasing.aliased_heap_bytes,
+            result.transient_aliasing.transient_resource_count,
+            result.transient_aliasing.persistent_resource_count,
+            result.transient_aliasing.heap_count,
+            result.transient_aliasing.aliasing_barrier_count);
+        report += line;
+        report += "queues:\n";
+        report += async_compute_schedule_dump;
+        report += "render passes:\n";
+        report += RenderGraphAttachmentOps::DumpPlan(render_pass_merge_plan);
+        return result;
     }
 
-    bool RenderGraph::OpenLastRenderDocCaptureInReplayUI(std::string& out_status)
+    void RenderGraph::RebuildAsyncComputeSchedule(const std::vector<RenderGraphNodeHandle>& execution_order)
     {
-        const std::string capture_path = GetLastRenderDocCapturePath();
-        if (capture_path.empty())
+        std::vector<RenderPassType> pass_types;
+        pass_types.reserve(execution_order.size());
+        for (const auto node_handle : execution_order)
         {
-            out_status = "RenderDoc replay launch failed: there is no completed capture to open.";
-            return false;
+            // Unresolved passes are treated like graphics passes and never leave the graphics queue.
+            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(m_render_graph_nodes[node_handle.value].render_pass_handle);
+            pass_types.push_back(render_pass ? render_pass->GetRenderPassType() : RenderPassType::GRAPHICS);
         }
-        return OpenRenderDocCaptureInReplayUI(std::filesystem::path(capture_path), out_status);
+        BuildAsyncComputeSchedule(
+            execution_order,
+            m_render_graph_nodes,
+            pass_types,
+            m_barrier_state_requests,
+            m_async_compute_schedule_diagnostics,
+            m_async_compute_schedule_dump,
+            &m_async_compute_state->schedule);
     }
 
-    bool RenderGraph::ConfigurePIXCapture(bool enable, bool require_available, std::string& out_status)
+    void RenderGraph::RebuildRenderPassMergePlan(
+        const std::vector<RenderGraphNodeHandle>& execution_order,
+        const std::set<unsigned long long>& output_resource_keys)
     {
-        if (!enable)
+        std::vector<RenderPassType> pass_types;
+        std::vector<RenderViewportRect> render_areas;
+        pass_types.reserve(execution_order.size());
+        render_areas.reserve(execution_order.size());
+        for (const auto node_handle : execution_order)
         {
-            if (m_pix_capture_state)
-            {
-                auto& pix_state = *m_pix_capture_state;
-                pix_state.enabled = false;
-                pix_state.required = false;
-                pix_state.pending = {};
-            }
-            out_status = "PIX capture disabled.";
-            return true;
-        }
+            // Unresolved passes are skipped at execution and must not open a rendering scope for others.
+            const auto& node_desc = m_render_graph_nodes[node_handle.value];
+            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
+            pass_types.push_back(render_pass ? render_pass->GetRenderPassType() : RenderPassType::COMPUTE);
+            render_areas.push_back(ResolveRenderArea(node_desc, render_pass.get()));
+        }
+        m_render_pass_merge_state->plan = BuildRenderPassMergePlan(
+            execution_order,
+            m_render_graph_nodes,
+            pass_types,
+            render_areas,
+            m_barrier_state_requests,
+            output_resource_keys,
+            [this](RenderTargetHandle handle, unsigned& out_width, unsigned& out_height)
+            {
+                RenderTargetDesc desc{};
+                if (!m_resource_allocator.GetRenderTargetDesc(handle, desc))
+                {
+                    return false;
+                }
+                out_width = desc.width;
+                out_height = desc.height;
+                return true;
+            },
+            m_render_pass_merge_policy);
+        m_render_pass_merge_diagnostics = SummarizeRenderPassMergePlan(m_render_pass_merge_state->plan);
+    }
 
-        if (!m_pix_capture_state)
+    void RenderGraph::RebuildBarrierStateRequests(const std::vector<RenderGraphNodeHandle>& execution_order)
+    {
+        m_barrier_state_requests.clear();
+        m_barrier_state_requests.reserve(execution_order.size());
+        for (const auto node_handle : execution_order)
         {
-            m_pix_capture_state = std::make_unique<PIXCaptureState>();
+            m_barrier_state_requests.push_back(CollectBarrierStateRequests(m_render_graph_nodes[node_handle.value]));
         }
+    }
 
-        auto& pix_state = *m_pix_capture_state;
-        pix_state.enabled = true;
-        pix_state.required = require_available;
-        if (pix_state.available)
+    void RenderGraph::UpdateTransientRenderTargetPlacement(bool execution_plan_changed)
+    {
+        auto& state = *m_transient_aliasing_state;
+        bool placed_target_recreated = false;
+        for (const auto& [handle, texture] : state.placed_textures)
         {
-            out_status = pix_state.status.empty() ? "PIX GPU capture ready." : pix_state.status;
-            return true;
+            const auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(handle);
+            placed_target_recreated = placed_target_recreated || !render_target || render_target->m_source.get() != texture;
         }
-
-        const bool initialized = InitPIXCapture(require_available, out_status);
-        if (!initialized && !require_available)
+        if (!execution_plan_changed && !placed_target_recreated && !state.layout_dirty)
         {
-            return true;
+            return;
         }
-        return initialized;
-    }
+        state.layout_dirty = false;
 
-    bool RenderGraph::RequestPIXCaptureForCurrentFrame(const std::filesystem::path& capture_path, std::string& out_error)
-    {
-        out_error.clear();
-        if (!m_pix_capture_state || !m_pix_capture_state->enabled)
+        // Lifetimes are disjoint in execution order only; work on the compute queue may overlap the graphics
+        // passes around it, so whatever async passes touch keeps its own memory.
+        auto excluded_resource_keys = CollectOutputResourceKeys();
+        if (ShouldSubmitAsyncCompute())
         {
-            out_error = "PIX capture is not enabled for this run.";
-            return false;
+            const auto& live_execution_order = m_execution_plan_state.live_execution_order;
+            for (size_t step_index = 0; step_index < live_execution_order.size(); ++step_index)
+            {
+                if (m_async_compute_state->schedule.steps[step_index].queue != RenderGraphQueueScheduler::Queue::ASYNC_COMPUTE)
+                {
+                    continue;
+                }
+                const auto access = CollectResourceAccess(m_render_graph_nodes[live_execution_order[step_index].value]);
+                for (const auto* resources : {&access.reads, &access.writes})
+                {
+                    for (const auto& resource : *resources)
+                    {
+                        excluded_resource_keys.insert(EncodeResourceKey(resource));
+                    }
+                }
+            }
         }
 
-        auto& pix_state = *m_pix_capture_state;
-        if (!pix_state.available)
+        TransientAliasingLayout layout{};
+        m_transient_aliasing_diagnostics = BuildTransientAliasingDiagnostics(
+            m_execution_plan_state.live_execution_order,
+            m_render_graph_nodes,
+            m_render_pass_merge_state->plan,
+            excluded_resource_keys,
+            [this](RenderTargetHandle handle, unsigned long long& out_size_bytes, unsigned long long& out_alignment)
+            {
+                return m_resource_allocator.GetRenderTargetPlacementRequirements(handle, out_size_bytes, out_alignment);
+            },
+            &layout);
+        if (!m_transient_aliasing_policy.enable || !m_transient_aliasing_diagnostics.valid)
         {
-            out_error = !pix_state.status.empty() ? pix_state.status : "PIX capture API unavailable.";
-            return false;
+            layout = {};
         }
-        if (m_renderdoc_capture_state && m_renderdoc_capture_state->pending.armed)
+
+        std::size_t signature = layout.requests.size();
+        for (size_t request_index = 0; request_index < layout.requests.size(); ++request_index)
         {
-            out_error = "RenderDoc capture is already armed for a frame.";
-            return false;
+            const auto& request = layout.requests[request_index];
+            HashCombine(signature, static_cast<std::size_t>(request.resource_id));
+            HashCombine(signature, static_cast<std::size_t>(request.size_bytes));
+            HashCombine(signature, layout.plan.placements[request_index].heap_index);
+            HashCombine(signature, static_cast<std::size_t>(layout.plan.placements[request_index].offset));
         }
-        if (m_renderdoc_capture_state &&
-            m_renderdoc_capture_state->available &&
-            m_renderdoc_capture_state->api &&
-            m_renderdoc_capture_state->api->IsFrameCapturing())
+        for (const auto& heap : layout.plan.heaps)
         {
-            out_error = "RenderDoc is already capturing a frame.";
-            return false;
+            HashCombine(signature, static_cast<std::size_t>(heap.size_bytes));
+            HashCombine(signature, static_cast<std::size_t>(heap.alignment));
         }
-        if (pix_state.pending.armed)
+
+        const bool layout_changed = signature != state.placed_signature || placed_target_recreated;
+        if (layout_changed && signature == state.failed_signature)
         {
-            out_error = "PIX capture is already armed for a frame.";
-            return false;
+            // Retrying a layout that failed to place would fail the same way every time the plan is rebuilt.
+            m_transient_aliasing_diagnostics.placed = false;
+            return;
         }
-        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        if (layout_changed)
         {
-            out_error = "PIX is already capturing a frame.";
-            return false;
-        }
+            std::vector<TransientRenderTargetHeapDesc> heaps;
+            heaps.reserve(layout.plan.heaps.size());
+            for (const auto& heap : layout.plan.heaps)
+            {
+                heaps.push_back({heap.size_bytes, heap.alignment});
+            }
+            std::vector<TransientRenderTargetPlacement> placements;
+            placements.reserve(layout.requests.size());
+            for (size_t request_index = 0; request_index < layout.requests.size(); ++request_index)
+            {
+                const auto& placement = layout.plan.placements[request_index];
+                placements.push_back({RenderTargetHandle{static_cast<unsigned>(layout.requests[request_index].resource_id)},
+                    placement.heap_index, placement.offset});
+            }
 
-        std::error_code fs_error;
-        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
-        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
-        const auto parent_path = resolved_path.parent_path();
-        if (!parent_path.empty())
-        {
-            std::filesystem::create_directories(parent_path, fs_error);
-            if (fs_error)
+            if (!m_resource_allocator.PlaceTransientRenderTargets(heaps, placements))
             {
-                out_error = "Failed to create PIX output directory: " + parent_path.string();
-                return false;
+                LOG_FORMAT_FLUSH("[RenderGraph] Failed to place %zu transient render targets into %zu heaps, keeping them committed\n",
+                    placements.size(), heaps.size());
+                state.failed_signature = signature;
+                layout = {};
+                signature = 0;
+                // Without a layout nothing is placed, so this only moves earlier placements back to committed memory.
+                GLTF_CHECK(m_resource_allocator.PlaceTransientRenderTargets({}, {}));
+            }
+            state.placed_signature = signature;
+            state.placed_textures.clear();
+            for (const auto& request : layout.requests)
+            {
+                const RenderTargetHandle handle{static_cast<unsigned>(request.resource_id)};
+                const auto render_target = InternalResourceHandleTable::Instance().GetRenderTarget(handle);
+                state.placed_textures[handle] = render_target ? render_target->m_source.get() : nullptr;
             }
         }
 
-        pix_state.pending = {};
-        pix_state.pending.armed = true;
-        pix_state.pending.frame_index = m_frame_index;
-        pix_state.pending.requested_path = resolved_path;
-        return true;
-    }
-
-    bool RenderGraph::IsPIXCaptureEnabled() const
-    {
-        return m_pix_capture_state && m_pix_capture_state->enabled;
-    }
-
-    bool RenderGraph::IsPIXCaptureAvailable() const
-    {
-        return m_pix_capture_state && m_pix_capture_state->available;
-    }
-
-    bool RenderGraph::WasLastPIXCaptureSuccessful() const
-    {
-        return m_pix_capture_state && m_pix_capture_state->last_result.success;
-    }
-
-    unsigned long long RenderGraph::GetLastPIXCaptureFrameIndex() const
-    {
-        return m_pix_capture_state ? m_pix_capture_state->last_result.frame_index : 0ull;
+        // The aliasing barriers follow the execution order even when the placement itself is unchanged.
+        state.layout = std::move(layout);
+        m_transient_aliasing_diagnostics.placed = !state.layout.requests.empty();
     }
 
-    std::string RenderGraph::GetLastPIXCapturePath() const
-    {
-        return m_pix_capture_state ? m_pix_capture_state->last_result.capture_path : std::string{};
-    }
-
-    std::string RenderGraph::GetLastPIXCaptureError() const
+    void RenderGraph::DrawFrameworkDebugUI()
     {
-        return m_pix_capture_state ? m_pix_capture_state->last_result.error : std::string{};
-    }
+        bool per_frame_resource_binding = m_resource_allocator.IsPerFrameResourceBindingEnabled();
+        ImGui::TextUnformatted("Resource Binding");
+        if (ImGui::Checkbox("Per-frame Resource Binding", &per_frame_resource_binding))
+        {
+            m_resource_allocator.SetPerFrameResourceBindingEnabled(per_frame_resource_binding);
+            m_dependency_diagnostics_state.Reset();
+        }
+        ImGui::TextUnformatted("Affects frame-buffered Buffer/RenderTarget handle selection.");
 
-    bool RenderGraph::OpenPIXCaptureInUI(const std::filesystem::path& capture_path, std::string& out_status)
-    {
-        std::error_code fs_error;
-        const std::filesystem::path absolute_path = std::filesystem::absolute(capture_path, fs_error);
-        const std::filesystem::path resolved_path = fs_error ? capture_path : absolute_path;
-        if (resolved_path.empty())
+        ImGui::Separator();
+        ImGui::TextUnformatted("Transient Render Target Aliasing");
+        auto transient_aliasing_policy = m_transient_aliasing_policy;
+        if (ImGui::Checkbox("Place Transient Render Targets In Shared Heaps", &transient_aliasing_policy.enable))
         {
-            out_status = "PIX UI launch failed: capture path is empty.";
-            return false;
+            SetTransientAliasingPolicy(transient_aliasing_policy);
         }
-        if (!std::filesystem::exists(resolved_path, fs_error))
+        if (m_transient_aliasing_diagnostics.valid)
         {
-            out_status = "PIX UI launch failed: capture file does not exist: " + resolved_path.string();
-            return false;
+            constexpr double bytes_per_mb = 1024.0 * 1024.0;
+            ImGui::Text("Placed: %s", m_transient_aliasing_diagnostics.placed ? "yes" : "no");
+            ImGui::Text("Transient: %u, persistent: %u, heaps: %u, aliasing barriers: %u",
+                m_transient_aliasing_diagnostics.transient_resource_count,
+                m_transient_aliasing_diagnostics.persistent_resource_count,
+                m_transient_aliasing_diagnostics.heap_count,
+                m_transient_aliasing_diagnostics.aliasing_barrier_count);
+            ImGui::Text("Committed: %.1f MB, aliased: %.1f MB",
+                static_cast<double>(m_transient_aliasing_diagnostics.committed_bytes) / bytes_per_mb,
+                static_cast<double>(m_transient_aliasing_diagnostics.aliased_heap_bytes) / bytes_per_mb);
         }
-
-        const auto open_result = reinterpret_cast<intptr_t>(PIXOpenCaptureInUI(resolved_path.c_str()));
-        if (open_result > 32)
+        else
         {
-            out_status = "PIX UI launched for capture: " + resolved_path.string();
-            return true;
+            ImGui::TextUnformatted("-");
         }
 
-        out_status = "PIX UI launch failed for capture: " + resolved_path.string();
-        return false;
-    }
-
-    bool RenderGraph::OpenLastPIXCaptureInUI(std::string& out_status)
-    {
-        const std::string capture_path = GetLastPIXCapturePath();
-        if (capture_path.empty())
+        ImGui::Separator();
+        ImGui::TextUnformatted("Resource Barrier Planning");
+        if (m_barrier_plan_diagnostics.valid)
+        {
+            ImGui::Text("Planned: %u full, %u split, %u conflicting",
+                m_barrier_plan_diagnostics.planned_full_barrier_count,
+                m_barrier_plan_diagnostics.planned_split_barrier_count,
+                m_barrier_plan_diagnostics.conflicting_request_count);
+            ImGui::Text("Recorded: %u barriers in %u batches (%u split, %u aliasing), elided: %u",
+                m_barrier_plan_diagnostics.recorded_barrier_count,
+                m_barrier_plan_diagnostics.recorded_batch_count,
+                m_barrier_plan_diagnostics.recorded_split_barrier_count,
+                m_barrier_plan_diagnostics.recorded_aliasing_barrier_count,
+                m_barrier_plan_diagnostics.elided_barrier_count);
+        }
+        else
         {
-            out_status = "PIX UI launch failed: there is no completed capture to open.";
-            return false;
+            ImGui::TextUnformatted("-");
         }
-        return OpenPIXCaptureInUI(std::filesystem::path(capture_path), out_status);
-    }
 
-    void RenderGraph::ShutdownRuntimeServices()
-    {
-        m_tick_callback = nullptr;
-        m_debug_ui_callback = nullptr;
-        m_final_color_output.reset();
-        m_final_color_output_texture_handle = NULL_HANDLE;
-        m_final_color_output_render_target_handle = NULL_HANDLE;
-        m_missing_final_color_output_logged = false;
-        ShutdownPIXCapture();
-        ShutdownRenderDocCapture();
-        ShutdownGPUProfiler();
-        ShutdownDebugUI();
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Execution Plan Cache");
+        ImGui::Text("Plans: %u, hits: %llu, misses: %llu, last build: %.3f ms",
+            m_execution_plan_cache_diagnostics.cached_plan_count,
+            m_execution_plan_cache_diagnostics.hit_count,
+            m_execution_plan_cache_diagnostics.miss_count,
+            m_execution_plan_cache_diagnostics.last_build_ms);
+        if (ImGui::Button("Save Planning Snapshot"))
+        {
+            // Replay with RendererDemo --replay-render-graph-snapshot <path>.
+            RequestExecutionPlanningSnapshot("RenderGraphPlanningSnapshot.json");
+        }
 
-    void RenderGraph::SetValidationPolicy(const ValidationPolicy& policy)
-    {
-        m_validation_policy = policy;
-        m_validation_policy.log_interval_frames = (std::max)(1u, m_validation_policy.log_interval_frames);
-        m_validation_policy.cross_frame_hazard_check_interval_frames =
-            (std::max)(1u, m_validation_policy.cross_frame_hazard_check_interval_frames);
-        m_dependency_diagnostics_state.Reset();
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Frame Trace");
+        ImGui::SliderInt("Trace frames", &m_frame_trace_state->ui_frame_count, 1, 600);
+        const FrameTraceStatus trace_status = GetFrameTraceStatus();
+        if (trace_status.capturing)
+        {
+            ImGui::Text("Capturing: %u/%u frames resolved", trace_status.resolved_frame_count, trace_status.requested_frame_count);
+        }
+        else if (ImGui::Button("Save Frame Trace"))
+        {
+            // Open in chrome://tracing or ui.perfetto.dev.
+            RequestFrameTrace("RenderGraphFrameTrace.json", static_cast<unsigned>(m_frame_trace_state->ui_frame_count));
+        }
+        if (!trace_status.last_path.empty())
+        {
+            ImGui::Text("Last trace: %s (%s)", trace_status.last_path.c_str(), trace_status.last_write_succeeded ? "written" : "failed");
+        }
 
-    RenderGraph::ValidationPolicy RenderGraph::GetValidationPolicy() const
-    {
-        return m_validation_policy;
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Async Compute Schedule");
+        if (m_async_compute_schedule_diagnostics.valid)
+        {
+            ImGui::Text("Requested: %u, async: %u, demoted: %u",
+                m_async_compute_schedule_diagnostics.requested_pass_count,
+                m_async_compute_schedule_diagnostics.async_pass_count,
+                m_async_compute_schedule_diagnostics.demoted_pass_count);
+            ImGui::Text("Sync points: %u, elided waits: %u, overlapped graphics passes: %u",
+                m_async_compute_schedule_diagnostics.sync_point_count,
+                m_async_compute_schedule_diagnostics.elided_wait_count,
+                m_async_compute_schedule_diagnostics.overlapped_graphics_pass_count);
+        }
+        else
+        {
+            ImGui::TextUnformatted("-");
+        }
+        auto async_compute_policy = m_async_compute_policy;
+        if (ImGui::Checkbox("Submit Async Passes On Compute Queue", &async_compute_policy.enable))
+        {
+            SetAsyncComputePolicy(async_compute_policy);
+        }
+        if (ShouldSubmitAsyncCompute())
+        {
+            ImGui::Text("Submitted async: %u passes, %u queue syncs, %u graphics passes overlapped",
+                m_async_compute_schedule_diagnostics.submitted_async_pass_count,
+                m_async_compute_schedule_diagnostics.submitted_sync_count,
+                m_last_frame_stats.async_overlapped_graphics_pass_count);
+        }
+        else if (async_compute_policy.enable)
+        {
+            ImGui::TextUnformatted("Graphics queue only: DX12 with a compute queue and async passes needed");
+        }
 
-    const RenderGraph::FrameStats& RenderGraph::GetLastFrameStats() const
-    {
-        return m_last_frame_stats;
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Parallel Command Recording");
+        auto parallel_recording_policy = m_parallel_recording_policy;
+        int parallel_worker_count = static_cast<int>(parallel_recording_policy.worker_count);
+        int min_passes_per_segment = static_cast<int>(parallel_recording_policy.min_passes_per_segment);
+        bool parallel_recording_changed = ImGui::Checkbox("Record Segments In Parallel", &parallel_recording_policy.enable);
+        parallel_recording_changed |= ImGui::SliderInt("Recording Workers", &parallel_worker_count, 0, 15);
+        parallel_recording_changed |= ImGui::SliderInt("Min Passes Per Segment", &min_passes_per_segment, 1, 64);
+        if (parallel_recording_changed)
+        {
+            parallel_recording_policy.worker_count = static_cast<unsigned>((std::max)(0, parallel_worker_count));
+            parallel_recording_policy.min_passes_per_segment = static_cast<unsigned>((std::max)(1, min_passes_per_segment));
+            SetParallelRecordingPolicy(parallel_recording_policy);
+        }
+        ImGui::Text("Segments last frame: %u%s",
+            m_last_frame_stats.recording_segment_count,
+            ShouldRecordPassesInParallel() || !parallel_recording_policy.enable ? "" : " (serial: DX12 only, needs enough passes)");
 
-    const RenderGraph::FrameTimingBreakdown& RenderGraph::GetLastFrameTimingBreakdown() const
-    {
-        return m_last_frame_timing_breakdown;
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Dead Pass Culling");
+        auto dead_pass_culling_policy = m_dead_pass_culling_policy;
+        if (ImGui::Checkbox("Cull Passes Without Consumers", &dead_pass_culling_policy.enable))
+        {
+            SetDeadPassCullingPolicy(dead_pass_culling_policy);
+        }
+        ImGui::Text("Culled last frame: %u", m_last_frame_stats.culled_pass_count);
+        for (const auto& culled_pass : m_last_frame_stats.culled_pass_stats)
+        {
+            ImGui::BulletText("%s/%s", culled_pass.group_name.c_str(), culled_pass.pass_name.c_str());
+        }
 
-    void RenderGraph::SetTickCallbackBreakdown(float other_ms, float module_ms, float system_ms)
-    {
-        m_current_frame_timing_breakdown.tick_other_ms = (std::max)(0.0f, other_ms);
-        m_current_frame_timing_breakdown.module_tick_ms = (std::max)(0.0f, module_ms);
-        m_current_frame_timing_breakdown.system_tick_ms = (std::max)(0.0f, system_ms);
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Render Pass Merging");
+        auto render_pass_merge_policy = m_render_pass_merge_policy;
+        bool render_pass_merge_changed = ImGui::Checkbox("Infer Attachment Store Ops", &render_pass_merge_policy.infer_store_ops);
+        render_pass_merge_changed |= ImGui::Checkbox("Merge Passes Sharing Attachments", &render_pass_merge_policy.merge_passes);
+        if (render_pass_merge_changed)
+        {
+            SetRenderPassMergePolicy(render_pass_merge_policy);
+        }
+        if (m_render_pass_merge_diagnostics.valid)
+        {
+            ImGui::Text("Passes with attachments: %u, merged: %u into %u group(s)",
+                m_render_pass_merge_diagnostics.attachment_pass_count,
+                m_render_pass_merge_diagnostics.merged_pass_count,
+                m_render_pass_merge_diagnostics.merged_group_count);
+            ImGui::Text("Elided loads: %u, elided stores: %u",
+                m_render_pass_merge_diagnostics.elided_load_count,
+                m_render_pass_merge_diagnostics.elided_store_count);
+        }
 
-    const RenderGraph::DependencyDiagnostics& RenderGraph::GetDependencyDiagnostics() const
-    {
-        return m_dependency_diagnostics_state.diagnostics;
-    }
+        ImGui::Separator();
+        ImGui::TextUnformatted("Binding State");
+        auto binding_state_policy = m_binding_state_policy;
+        if (ImGui::Checkbox("Skip Redundant Bindings", &binding_state_policy.skip_redundant_bindings))
+        {
+            SetBindingStatePolicy(binding_state_policy);
+        }
+        ImGui::Text("Binding calls last frame: %u, skipped: %u",
+            m_last_frame_stats.binding_call_count,
+            m_last_frame_stats.redundant_binding_skip_count);
 
-    void RenderGraph::DrawFrameworkDebugUI()
-    {
-        bool per_frame_resource_binding = m_resource_allocator.IsPerFrameResourceBindingEnabled();
-        ImGui::TextUnformatted("Resource Binding");
-        if (ImGui::Checkbox("Per-frame Resource Binding", &per_frame_resource_binding))
+        ImGui::Separator();
+        ImGui::TextUnformatted("Draw Validation");
+        const char* draw_validation_cache_modes[] = {"Every frame", "On change", "Once per configuration"};
+        int draw_validation_cache_mode = static_cast<int>(m_validation_policy.draw_validation_cache_mode);
+        if (ImGui::Combo("Validation Cache", &draw_validation_cache_mode, draw_validation_cache_modes, IM_ARRAYSIZE(draw_validation_cache_modes)))
         {
-            m_resource_allocator.SetPerFrameResourceBindingEnabled(per_frame_resource_binding);
-            m_dependency_diagnostics_state.Reset();
+            auto validation_policy = m_validation_policy;
+            validation_policy.draw_validation_cache_mode = static_cast<DrawValidationCacheMode>(draw_validation_cache_mode);
+            SetValidationPolicy(validation_policy);
         }
-        ImGui::TextUnformatted("Affects frame-buffered Buffer/RenderTarget handle selection.");
+        ImGui::Text("Validated last frame: %u, cached: %u",
+            m_last_frame_stats.draw_validation_count,
+            m_last_frame_stats.draw_validation_cache_hit_count);
 
         ImGui::Separator();
         ImGui::TextUnformatted("Cross-frame Hazard Analysis");
@@ -4498,7 +7723,7 @@ namespace RendererInterface
             m_resource_allocator.GetDevice(),
             m_resource_allocator.GetCommandQueue(),
             m_resource_allocator.GetDescriptorManager(),
-            ResolveSwapchainImageCount(m_resource_allocator)));
+            (std::max)(ResolveSwapchainImageCount(m_resource_allocator), m_resource_allocator.GetFrameSlotCount())));
 
         glTFWindow::Get().SetInputHandleCallback([this]()
         {
@@ -4875,428 +8100,1244 @@ namespace RendererInterface
             return false;
         }
 
-        HMODULE module_handle = GetModuleHandleW(L"WinPixGpuCapturer.dll");
-        if (!module_handle)
+        HMODULE module_handle = GetModuleHandleW(L"WinPixGpuCapturer.dll");
+        if (!module_handle)
+        {
+            pix_state.available = false;
+            pix_state.status =
+                "PIX GPU capture is unavailable: WinPixGpuCapturer.dll must be loaded before DX12 device initialization.";
+            out_status = pix_state.status;
+            return false;
+        }
+
+        pix_state.available = true;
+        pix_state.status = g_pix_runtime_loaded_by_app
+            ? "PIX GPU capture ready."
+            : "PIX GPU capturer detected in the current process.";
+        out_status = pix_state.status;
+        return true;
+    }
+
+    void RenderGraph::BeginPIXFrameCapture()
+    {
+        if (!m_pix_capture_state)
+        {
+            return;
+        }
+
+        auto& pix_state = *m_pix_capture_state;
+        if (!pix_state.enabled ||
+            !pix_state.available ||
+            !pix_state.pending.armed ||
+            pix_state.pending.started ||
+            pix_state.pending.frame_index != m_frame_index)
+        {
+            return;
+        }
+
+        pix_state.last_result = {};
+        pix_state.last_result.attempted = true;
+        pix_state.last_result.frame_index = pix_state.pending.frame_index;
+
+        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        {
+            pix_state.last_result.error = "PIX is already capturing a frame.";
+            pix_state.pending = {};
+            return;
+        }
+
+        const std::wstring capture_path = pix_state.pending.requested_path.wstring();
+        if (capture_path.empty())
+        {
+            pix_state.last_result.error = "Failed to build PIX capture file path.";
+            pix_state.pending = {};
+            return;
+        }
+
+        PIXCaptureParameters capture_parameters{};
+        capture_parameters.GpuCaptureParameters.FileName = capture_path.c_str();
+        const HRESULT result = PIXBeginCapture(PIX_CAPTURE_GPU, &capture_parameters);
+        if (FAILED(result))
+        {
+            pix_state.last_result.error =
+                "PIX failed to start frame capture (HRESULT " + FormatHRESULT(result) + ").";
+            pix_state.pending = {};
+            return;
+        }
+
+        pix_state.pending.started = true;
+    }
+
+    void RenderGraph::FinalizePIXFrameCapture()
+    {
+        if (!m_pix_capture_state)
+        {
+            return;
+        }
+
+        auto& pix_state = *m_pix_capture_state;
+        if (!pix_state.pending.armed || pix_state.pending.frame_index != m_frame_index)
+        {
+            return;
+        }
+
+        auto& result = pix_state.last_result;
+        if (!result.attempted)
+        {
+            result = {};
+            result.attempted = true;
+            result.frame_index = pix_state.pending.frame_index;
+        }
+
+        if (!pix_state.pending.started)
+        {
+            result.success = false;
+            if (result.error.empty())
+            {
+                result.error = "PIX capture was armed but did not start on the requested frame.";
+            }
+            pix_state.pending = {};
+            return;
+        }
+
+        const HRESULT end_result = PIXEndCapture(FALSE);
+        if (FAILED(end_result))
+        {
+            result.success = false;
+            result.error = "PIX failed to finalize frame capture (HRESULT " + FormatHRESULT(end_result) + ").";
+            pix_state.pending = {};
+            return;
+        }
+
+        result.capture_path = pix_state.pending.requested_path.string();
+        result.success = !result.capture_path.empty() &&
+            std::filesystem::exists(pix_state.pending.requested_path);
+        if (!result.success)
+        {
+            result.error = "PIX reported success but the capture file was not found: " +
+                pix_state.pending.requested_path.string();
+        }
+        else
+        {
+            result.error.clear();
+        }
+
+        pix_state.pending = {};
+    }
+
+    void RenderGraph::ShutdownPIXCapture()
+    {
+        if (!m_pix_capture_state)
+        {
+            return;
+        }
+
+        auto& pix_state = *m_pix_capture_state;
+        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        {
+            PIXEndCapture(FALSE);
+        }
+
+        pix_state.pending = {};
+        m_pix_capture_state.reset();
+    }
+
+    bool RenderGraph::InitGPUProfiler()
+    {
+        if (m_gpu_profiler_state)
+        {
+            return true;
+        }
+
+        m_gpu_profiler_state = std::make_unique<GPUProfilerState>();
+        auto& profiler_state = *m_gpu_profiler_state;
+        const unsigned profiler_slot_count = ResolveProfilerSlotCount(m_resource_allocator);
+        if (profiler_slot_count == 0)
+        {
+            return true;
+        }
+
+        profiler_state.frame_slots.resize(profiler_slot_count);
+        
+        GLTF_CHECK(RHIUtilInstanceManager::Instance().InitTimestampProfiler(
+            m_resource_allocator.GetDevice(),
+            m_resource_allocator.GetCommandQueue(),
+            profiler_slot_count,
+            profiler_state.max_query_count));
+        profiler_state.supported = RHIUtilInstanceManager::Instance().IsTimestampProfilerSupported();
+        if (profiler_state.supported)
+        {
+            LOG_FORMAT_FLUSH("[RenderGraph][Profiler] GPU timestamp profiler enabled.\n");
+        }
+        else
+        {
+            LOG_FORMAT_FLUSH("[RenderGraph][Profiler] GPU timestamp profiler unavailable, fallback to CPU timings only.\n");
+        }
+
+        return true;
+    }
+
+    void RenderGraph::ShutdownGPUProfiler()
+    {
+        if (!m_gpu_profiler_state)
+        {
+            return;
+        }
+
+        RHIUtilInstanceManager::Instance().ShutdownTimestampProfiler();
+        m_gpu_profiler_state.reset();
+    }
+
+    bool RenderGraph::HasValidGPUProfilerSlot(unsigned slot_index) const
+    {
+        return m_gpu_profiler_state &&
+            m_gpu_profiler_state->supported &&
+            slot_index < m_gpu_profiler_state->frame_slots.size();
+    }
+
+    unsigned RenderGraph::GetGPUProfilerMaxTimestampedPassCount() const
+    {
+        return (m_gpu_profiler_state && m_gpu_profiler_state->supported)
+            ? m_gpu_profiler_state->max_pass_count
+            : 0u;
+    }
+
+    unsigned RenderGraph::GetGPUProfilerMaxQueryCount() const
+    {
+        return m_gpu_profiler_state ? m_gpu_profiler_state->max_query_count : 0u;
+    }
+
+    unsigned RenderGraph::ClampGPUProfilerQueryCount(unsigned query_count) const
+    {
+        const unsigned max_query_count = GetGPUProfilerMaxQueryCount();
+        if (max_query_count == 0u)
         {
-            pix_state.available = false;
-            pix_state.status =
-                "PIX GPU capture is unavailable: WinPixGpuCapturer.dll must be loaded before DX12 device initialization.";
-            out_status = pix_state.status;
-            return false;
+            return 0u;
         }
 
-        pix_state.available = true;
-        pix_state.status = g_pix_runtime_loaded_by_app
-            ? "PIX GPU capture ready."
-            : "PIX GPU capturer detected in the current process.";
-        out_status = pix_state.status;
-        return true;
+        return (std::min)(query_count, max_query_count);
     }
 
-    void RenderGraph::BeginPIXFrameCapture()
+    void RenderGraph::ResolveGPUProfilerFrame(unsigned slot_index)
     {
-        if (!m_pix_capture_state)
+        if (!HasValidGPUProfilerSlot(slot_index))
         {
             return;
         }
 
-        auto& pix_state = *m_pix_capture_state;
-        if (!pix_state.enabled ||
-            !pix_state.available ||
-            !pix_state.pending.armed ||
-            pix_state.pending.started ||
-            pix_state.pending.frame_index != m_frame_index)
+        auto& profiler_state = *m_gpu_profiler_state;
+        auto& frame_slot = profiler_state.frame_slots[slot_index];
+        if (!frame_slot.has_pending_frame_stats || frame_slot.query_count == 0)
         {
             return;
         }
 
-        pix_state.last_result = {};
-        pix_state.last_result.attempted = true;
-        pix_state.last_result.frame_index = pix_state.pending.frame_index;
+        const unsigned query_count = frame_slot.query_count;
+        std::vector<uint64_t> timestamps(query_count, 0);
+        double ticks_per_second = 0.0;
+        const bool readback_ok = RHIUtilInstanceManager::Instance().ResolveTimestampFrame(
+            slot_index,
+            query_count,
+            timestamps,
+            ticks_per_second);
 
-        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        const bool trace_frame = IsCapturingFrameTrace(frame_slot.pending_frame_stats.frame_index);
+        if (!readback_ok)
         {
-            pix_state.last_result.error = "PIX is already capturing a frame.";
-            pix_state.pending = {};
+            if (trace_frame)
+            {
+                AppendFrameTracePasses(frame_slot.pending_frame_stats, {}, false);
+            }
+            frame_slot.has_pending_frame_stats = false;
+            frame_slot.query_count = 0;
             return;
         }
 
-        const std::wstring capture_path = pix_state.pending.requested_path.wstring();
-        if (capture_path.empty())
+        auto resolved_stats = frame_slot.pending_frame_stats;
+        resolved_stats.gpu_time_valid = false;
+        resolved_stats.gpu_total_ms = 0.0f;
+        std::vector<std::pair<uint64_t, uint64_t>> trace_pass_ticks;
+
+        const unsigned timed_pass_count = (std::min)(static_cast<unsigned>(resolved_stats.pass_stats.size()), query_count / 2);
+        for (unsigned i = 0; i < timed_pass_count; ++i)
         {
-            pix_state.last_result.error = "Failed to build PIX capture file path.";
-            pix_state.pending = {};
-            return;
+            const uint64_t begin_tick = timestamps[i * 2];
+            const uint64_t end_tick = timestamps[i * 2 + 1];
+            if (end_tick <= begin_tick)
+            {
+                continue;
+            }
+
+            if (ticks_per_second <= 0.0)
+            {
+                break;
+            }
+
+            const double gpu_time_ms = static_cast<double>(end_tick - begin_tick) * 1000.0 / ticks_per_second;
+            if (trace_frame)
+            {
+                trace_pass_ticks.resize(timed_pass_count, {0, 0});
+                trace_pass_ticks[i] = {begin_tick, end_tick};
+            }
+
+            auto& pass_stats = resolved_stats.pass_stats[i];
+            pass_stats.gpu_time_valid = true;
+            pass_stats.gpu_time_ms = static_cast<float>(gpu_time_ms);
+            resolved_stats.gpu_total_ms += static_cast<float>(gpu_time_ms);
+            resolved_stats.gpu_time_valid = true;
         }
 
-        PIXCaptureParameters capture_parameters{};
-        capture_parameters.GpuCaptureParameters.FileName = capture_path.c_str();
-        const HRESULT result = PIXBeginCapture(PIX_CAPTURE_GPU, &capture_parameters);
-        if (FAILED(result))
+        if (trace_frame)
         {
-            pix_state.last_result.error =
-                "PIX failed to start frame capture (HRESULT " + FormatHRESULT(result) + ").";
-            pix_state.pending = {};
-            return;
+            uint64_t reference_tick = 0;
+            double reference_ms = 0.0;
+            const bool gpu_calibrated = !trace_pass_ticks.empty() &&
+                RHIUtilInstanceManager::Instance().CalibrateTimestampClock(m_resource_allocator.GetCommandQueue(), reference_tick, reference_ms);
+            if (!trace_pass_ticks.empty() && !gpu_calibrated)
+            {
+                // Without a calibration the GPU work is placed right after the last pass was recorded, the
+                // earliest it could have been submitted.
+                reference_tick = (std::numeric_limits<uint64_t>::max)();
+                for (const auto& [begin_tick, end_tick] : trace_pass_ticks)
+                {
+                    if (end_tick > begin_tick)
+                    {
+                        reference_tick = (std::min)(reference_tick, begin_tick);
+                    }
+                }
+                for (const auto& pass_stats : resolved_stats.pass_stats)
+                {
+                    reference_ms = (std::max)(reference_ms, pass_stats.cpu_end_ms);
+                }
+            }
+            AppendFrameTracePasses(
+                resolved_stats,
+                MapTimestampsToTimeline(trace_pass_ticks, ticks_per_second, reference_tick, reference_ms),
+                gpu_calibrated);
         }
 
-        pix_state.pending.started = true;
+        m_last_frame_stats = resolved_stats;
+        frame_slot.has_pending_frame_stats = false;
+        frame_slot.query_count = 0;
     }
 
-    void RenderGraph::FinalizePIXFrameCapture()
+    void RenderGraph::ExecutePlanAndCollectStats(
+        IRHICommandList& command_list,
+        const FrameContextSnapshot& frame_context,
+        unsigned profiler_slot_index,
+        unsigned long long interval)
     {
-        if (!m_pix_capture_state)
+        FrameStats submitted_frame_stats{};
+        submitted_frame_stats.frame_index = m_frame_index;
+        submitted_frame_stats.cpu_total_ms = 0.0f;
+        submitted_frame_stats.cpu_executed_ms = 0.0f;
+        submitted_frame_stats.cpu_skipped_ms = 0.0f;
+        submitted_frame_stats.cpu_skipped_validation_ms = 0.0f;
+        submitted_frame_stats.gpu_time_valid = false;
+        submitted_frame_stats.gpu_total_ms = 0.0f;
+        submitted_frame_stats.total_pass_count = 0;
+        submitted_frame_stats.executed_pass_count = 0;
+        submitted_frame_stats.skipped_pass_count = 0;
+        submitted_frame_stats.skipped_validation_pass_count = 0;
+        submitted_frame_stats.skipped_missing_pass_count = 0;
+        submitted_frame_stats.graphics_pass_count = 0;
+        submitted_frame_stats.compute_pass_count = 0;
+        submitted_frame_stats.ray_tracing_pass_count = 0;
+        submitted_frame_stats.executed_graphics_pass_count = 0;
+        submitted_frame_stats.executed_compute_pass_count = 0;
+        submitted_frame_stats.executed_ray_tracing_pass_count = 0;
+        submitted_frame_stats.recording_segment_count = 1;
+        submitted_frame_stats.culled_pass_count = 0;
+        submitted_frame_stats.async_compute_pass_count = 0;
+        submitted_frame_stats.async_overlapped_graphics_pass_count = 0;
+        submitted_frame_stats.draw_validation_count = m_draw_validation_cache->frame_validation_count;
+        submitted_frame_stats.draw_validation_cache_hit_count = m_draw_validation_cache->frame_cache_hit_count;
+        m_draw_validation_cache->frame_validation_count = 0;
+        m_draw_validation_cache->frame_cache_hit_count = 0;
+        submitted_frame_stats.culled_pass_stats.clear();
+        submitted_frame_stats.pass_stats.clear();
+        submitted_frame_stats.pass_stats.reserve(m_execution_plan_state.live_execution_order.size());
+
+        GLTF_CHECK(BeginGPUProfilerFrame(command_list, profiler_slot_index));
+        const unsigned pass_count = static_cast<unsigned>(m_execution_plan_state.live_execution_order.size());
+        const unsigned max_timestamped_pass_count = GetGPUProfilerMaxTimestampedPassCount();
+        const unsigned timestamped_pass_count = (std::min)(pass_count, max_timestamped_pass_count);
+
+        std::vector<RenderPassExecutionStatus> execution_statuses;
+        std::vector<float> pass_cpu_times_ms;
+        std::vector<std::pair<double, double>> pass_cpu_spans_ms;
+        std::vector<unsigned> segment_indices;
+        RenderGraphBindingState::Counters binding_counters{};
+        const bool submit_async_compute = ShouldSubmitAsyncCompute();
+        const bool record_in_parallel = ShouldRecordPassesInParallel();
+        const auto execute_passes_begin = std::chrono::steady_clock::now();
+        if (submit_async_compute)
+        {
+            RecordPlanWithAsyncCompute(
+                command_list,
+                frame_context,
+                profiler_slot_index,
+                interval,
+                execution_statuses,
+                pass_cpu_times_ms,
+                pass_cpu_spans_ms,
+                segment_indices,
+                binding_counters);
+        }
+        else if (record_in_parallel)
+        {
+            RecordPlanInParallel(
+                command_list,
+                frame_context,
+                profiler_slot_index,
+                interval,
+                execution_statuses,
+                pass_cpu_times_ms,
+                pass_cpu_spans_ms,
+                segment_indices,
+                binding_counters);
+        }
+        else
         {
-            return;
+            execution_statuses.reserve(pass_count);
+            pass_cpu_times_ms.reserve(pass_count);
+            pass_cpu_spans_ms.reserve(pass_count);
+            segment_indices.assign(pass_count, 0u);
+
+            std::map<unsigned long long, BarrierResource> barrier_resources;
+            const auto barrier_plan =
+                BuildFrameBarrierPlan(m_barrier_state_requests, pass_count, barrier_resources, m_barrier_plan_diagnostics);
+            BarrierPlanRecorder barrier_recorder(command_list, barrier_plan, barrier_resources, m_barrier_plan_diagnostics);
+            const auto aliasing_barriers = ResolveAliasingBarriers(m_transient_aliasing_state->layout.step_barriers);
+            barrier_recorder.SetAliasingBarriers(&aliasing_barriers);
+
+            // Barriers cannot be recorded inside a rendering scope, so a merged group is prepared and
+            // transitioned as a whole before its first pass, and its after-pass barriers wait for its last.
+            const auto transition_prepared_node = [&command_list](const PreparedRenderGraphNode& prepared_node)
+            {
+                const auto transition = [&command_list](const PreparedRenderGraphNode::ResourceState& resource_state)
+                {
+                    if (resource_state.texture)
+                    {
+                        resource_state.texture->Transition(command_list, resource_state.state);
+                    }
+                    else
+                    {
+                        resource_state.buffer->Transition(command_list, resource_state.state);
+                    }
+                };
+                for (const auto& descriptor_binding : prepared_node.descriptor_bindings)
+                {
+                    for (const auto& resource_state : descriptor_binding.resource_states)
+                    {
+                        transition(resource_state);
+                    }
+                }
+                for (const auto& resource_state : prepared_node.attachment_states)
+                {
+                    transition(resource_state);
+                }
+            };
+            std::vector<PreparedRenderGraphNode> scope_prepared_nodes;
+            std::vector<RenderPassExecutionStatus> scope_prepare_statuses;
+            bool rendering_scope_open = false;
+            auto binding_state = CreateBindingStateTracker();
+            for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
+            {
+                const bool enable_gpu_timestamp = pass_index < timestamped_pass_count;
+                if (enable_gpu_timestamp)
+                {
+                    const unsigned query_index = static_cast<unsigned>(pass_index * 2);
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(command_list, profiler_slot_index, query_index));
+                }
+
+                const auto pass_begin = std::chrono::steady_clock::now();
+                const auto [scope_begin, scope_end] = GetRenderingScopeRange(pass_index);
+                if (pass_index == scope_begin)
+                {
+                    scope_prepared_nodes.assign(scope_end - scope_begin + 1, PreparedRenderGraphNode{});
+                    scope_prepare_statuses.assign(scope_end - scope_begin + 1, RenderPassExecutionStatus::EXECUTED);
+                    for (unsigned scope_pass_index = scope_begin; scope_pass_index <= scope_end; ++scope_pass_index)
+                    {
+                        barrier_recorder.RecordBeforePass(scope_pass_index);
+                    }
+                    for (unsigned scope_pass_index = scope_begin; scope_pass_index <= scope_end; ++scope_pass_index)
+                    {
+                        auto& prepared_node = scope_prepared_nodes[scope_pass_index - scope_begin];
+                        auto& prepare_status = scope_prepare_statuses[scope_pass_index - scope_begin];
+                        prepare_status = PrepareRenderGraphNode(
+                            frame_context,
+                            m_execution_plan_state.live_execution_order[scope_pass_index],
+                            interval,
+                            prepared_node);
+                        if (prepare_status != RenderPassExecutionStatus::EXECUTED)
+                        {
+                            continue;
+                        }
+                        ApplyRenderPassMergePlan(scope_pass_index, prepared_node);
+                        if (scope_end > scope_begin)
+                        {
+                            transition_prepared_node(prepared_node);
+                        }
+                    }
+                }
+
+                auto execution_status = scope_prepare_statuses[pass_index - scope_begin];
+                if (execution_status == RenderPassExecutionStatus::EXECUTED)
+                {
+                    execution_status = RecordRenderGraphNode(command_list, scope_prepared_nodes[pass_index - scope_begin], rendering_scope_open, binding_state);
+                }
+                execution_statuses.push_back(execution_status);
+                if (pass_index == scope_end)
+                {
+                    CloseRenderingScope(command_list, rendering_scope_open);
+                    for (unsigned scope_pass_index = scope_begin; scope_pass_index <= scope_end; ++scope_pass_index)
+                    {
+                        barrier_recorder.RecordAfterPass(scope_pass_index);
+                    }
+                }
+                const auto pass_end = std::chrono::steady_clock::now();
+                pass_cpu_times_ms.push_back(std::chrono::duration<float, std::milli>(pass_end - pass_begin).count());
+                pass_cpu_spans_ms.emplace_back(ToTimelineMilliseconds(pass_begin), ToTimelineMilliseconds(pass_end));
+
+                if (enable_gpu_timestamp)
+                {
+                    const unsigned query_index = static_cast<unsigned>(pass_index * 2 + 1);
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(command_list, profiler_slot_index, query_index));
+                }
+            }
+
+            barrier_recorder.Flush();
+            binding_counters = binding_state.GetCounters();
         }
+        const auto execute_passes_end = std::chrono::steady_clock::now();
+        submitted_frame_stats.binding_call_count = binding_counters.issued_count;
+        submitted_frame_stats.redundant_binding_skip_count = binding_counters.skipped_count;
 
-        auto& pix_state = *m_pix_capture_state;
-        if (!pix_state.pending.armed || pix_state.pending.frame_index != m_frame_index)
+        const auto make_pass_stats = [this](RenderGraphNodeHandle render_graph_node)
         {
-            return;
-        }
+            const auto& node_desc = m_render_graph_nodes[render_graph_node.value];
+            RenderPassFrameStats pass_stats{};
+            pass_stats.node_handle = render_graph_node;
+            pass_stats.group_name = node_desc.debug_group.empty() ? "Ungrouped" : node_desc.debug_group;
 
-        auto& result = pix_state.last_result;
-        if (!result.attempted)
+            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
+            pass_stats.pass_type = render_pass ? render_pass->GetRenderPassType() : RenderPassType::GRAPHICS;
+            pass_stats.pass_name = node_desc.debug_name;
+            if (pass_stats.pass_name.empty())
+            {
+                std::string type_name = render_pass ? ToRenderPassTypeName(pass_stats.pass_type) : "Unknown";
+                pass_stats.pass_name = type_name + "#" + std::to_string(render_graph_node.value);
+            }
+            return pass_stats;
+        };
+
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
         {
-            result = {};
-            result.attempted = true;
-            result.frame_index = pix_state.pending.frame_index;
+            const auto render_graph_node = m_execution_plan_state.live_execution_order[pass_index];
+            const auto execution_status = execution_statuses[pass_index];
+            const float pass_cpu_ms = pass_cpu_times_ms[pass_index];
+
+            RenderPassFrameStats pass_stats = make_pass_stats(render_graph_node);
+            const RenderPassType pass_type = pass_stats.pass_type;
+            pass_stats.executed = execution_status == RenderPassExecutionStatus::EXECUTED;
+            pass_stats.skipped_due_to_validation = execution_status == RenderPassExecutionStatus::SKIPPED_INVALID_DRAW_DESC;
+            pass_stats.cpu_time_ms = pass_cpu_ms;
+            pass_stats.recording_segment_index = segment_indices[pass_index];
+            pass_stats.cpu_begin_ms = pass_cpu_spans_ms[pass_index].first;
+            pass_stats.cpu_end_ms = pass_cpu_spans_ms[pass_index].second;
+            submitted_frame_stats.pass_stats.push_back(pass_stats);
+            ++submitted_frame_stats.total_pass_count;
+            submitted_frame_stats.cpu_total_ms += pass_cpu_ms;
+            switch (pass_type)
+            {
+            case RenderPassType::GRAPHICS:
+                ++submitted_frame_stats.graphics_pass_count;
+                break;
+            case RenderPassType::COMPUTE:
+                ++submitted_frame_stats.compute_pass_count;
+                break;
+            case RenderPassType::RAY_TRACING:
+                ++submitted_frame_stats.ray_tracing_pass_count;
+                break;
+            }
+            if (pass_stats.executed)
+            {
+                ++submitted_frame_stats.executed_pass_count;
+                submitted_frame_stats.cpu_executed_ms += pass_cpu_ms;
+                switch (pass_type)
+                {
+                case RenderPassType::GRAPHICS:
+                    ++submitted_frame_stats.executed_graphics_pass_count;
+                    break;
+                case RenderPassType::COMPUTE:
+                    ++submitted_frame_stats.executed_compute_pass_count;
+                    break;
+                case RenderPassType::RAY_TRACING:
+                    ++submitted_frame_stats.executed_ray_tracing_pass_count;
+                    break;
+                }
+            }
+            else
+            {
+                ++submitted_frame_stats.skipped_pass_count;
+                submitted_frame_stats.cpu_skipped_ms += pass_cpu_ms;
+                if (pass_stats.skipped_due_to_validation)
+                {
+                    ++submitted_frame_stats.skipped_validation_pass_count;
+                    submitted_frame_stats.cpu_skipped_validation_ms += pass_cpu_ms;
+                }
+                else
+                {
+                    ++submitted_frame_stats.skipped_missing_pass_count;
+                }
+            }
         }
 
-        if (!pix_state.pending.started)
+        if (submit_async_compute)
         {
-            result.success = false;
-            if (result.error.empty())
+            std::vector<unsigned char> overlapped_graphics_passes(pass_count, 0u);
+            for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
             {
-                result.error = "PIX capture was armed but did not start on the requested frame.";
+                const auto& step = m_async_compute_state->schedule.steps[pass_index];
+                if (step.queue != RenderGraphQueueScheduler::Queue::ASYNC_COMPUTE)
+                {
+                    continue;
+                }
+                auto& pass_stats = submitted_frame_stats.pass_stats[pass_index];
+                pass_stats.async_compute = true;
+                ++submitted_frame_stats.async_compute_pass_count;
+                if (step.overlapping_graphics_step_count == 0)
+                {
+                    continue;
+                }
+                pass_stats.first_overlapped_pass_index = step.first_overlapping_graphics_step;
+                pass_stats.last_overlapped_pass_index = step.last_overlapping_graphics_step;
+                pass_stats.overlapped_graphics_pass_count = step.overlapping_graphics_step_count;
+                for (unsigned graphics_step = step.first_overlapping_graphics_step; graphics_step <= step.last_overlapping_graphics_step; ++graphics_step)
+                {
+                    overlapped_graphics_passes[graphics_step] |=
+                        m_async_compute_state->schedule.steps[graphics_step].queue == RenderGraphQueueScheduler::Queue::GRAPHICS ? 1u : 0u;
+                }
             }
-            pix_state.pending = {};
-            return;
+            submitted_frame_stats.async_overlapped_graphics_pass_count =
+                static_cast<unsigned>(std::count(overlapped_graphics_passes.begin(), overlapped_graphics_passes.end(), 1u));
         }
 
-        const HRESULT end_result = PIXEndCapture(FALSE);
-        if (FAILED(end_result))
+        // Culled passes are listed apart so pass_stats keeps lining up with the GPU timestamps.
+        submitted_frame_stats.culled_pass_stats.reserve(m_execution_plan_state.culled_nodes.size());
+        for (const auto culled_node : m_execution_plan_state.culled_nodes)
         {
-            result.success = false;
-            result.error = "PIX failed to finalize frame capture (HRESULT " + FormatHRESULT(end_result) + ").";
-            pix_state.pending = {};
-            return;
+            RenderPassFrameStats pass_stats = make_pass_stats(culled_node);
+            pass_stats.executed = false;
+            pass_stats.culled = true;
+            submitted_frame_stats.culled_pass_stats.push_back(pass_stats);
+            ++submitted_frame_stats.culled_pass_count;
         }
 
-        result.capture_path = pix_state.pending.requested_path.string();
-        result.success = !result.capture_path.empty() &&
-            std::filesystem::exists(pix_state.pending.requested_path);
-        if (!result.success)
+        // Async compute interleaves its command lists with the graphics ones, so the last pass need not be in the last.
+        submitted_frame_stats.recording_segment_count =
+            segment_indices.empty() ? 1u : *std::max_element(segment_indices.begin(), segment_indices.end()) + 1u;
+        // Parallel per-pass times overlap, so their sum overstates the time spent; use wall time instead.
+        m_current_frame_timing_breakdown.execute_passes_ms = record_in_parallel
+            ? ToMilliseconds(execute_passes_begin, execute_passes_end)
+            : submitted_frame_stats.cpu_total_ms;
+        GLTF_CHECK(FinalizeGPUProfilerFrame(command_list, profiler_slot_index, timestamped_pass_count * 2, submitted_frame_stats));
+        RecordFrameTraceSpan("frame", "Execute passes", ToTimelineMilliseconds(execute_passes_begin), ToTimelineMilliseconds(execute_passes_end));
+        // Frames with pending timestamps reach the trace once ResolveGPUProfilerFrame reads them back.
+        if (!HasValidGPUProfilerSlot(profiler_slot_index) || timestamped_pass_count == 0)
         {
-            result.error = "PIX reported success but the capture file was not found: " +
-                pix_state.pending.requested_path.string();
+            AppendFrameTracePasses(submitted_frame_stats, {}, false);
         }
-        else
+        if (!(m_gpu_profiler_state && m_gpu_profiler_state->supported))
         {
-            result.error.clear();
+            m_last_frame_stats = submitted_frame_stats;
+        }
+        else if (timestamped_pass_count == 0)
+        {
+            m_last_frame_stats = submitted_frame_stats;
+        }
+        else if (m_last_frame_stats.pass_stats.empty())
+        {
+            m_last_frame_stats = submitted_frame_stats;
         }
+    }
 
-        pix_state.pending = {};
+    bool RenderGraph::ShouldRecordPassesInParallel() const
+    {
+        // Vulkan descriptor updates and command buffer state are not safe to touch from several threads here.
+        return m_parallel_recording_policy.enable &&
+            RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12 &&
+            m_execution_plan_state.live_execution_order.size() >= 2u * m_parallel_recording_policy.min_passes_per_segment;
     }
 
-    void RenderGraph::ShutdownPIXCapture()
+    bool RenderGraph::ShouldSubmitAsyncCompute() const
     {
-        if (!m_pix_capture_state)
+        // Reopening the frame command list after the async pieces waits for it to finish on Vulkan.
+        return m_async_compute_policy.enable &&
+            RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12 &&
+            m_resource_allocator.SupportsAsyncCompute() &&
+            m_async_compute_state->schedule.async_step_count > 0 &&
+            m_async_compute_state->schedule.steps.size() == m_execution_plan_state.live_execution_order.size();
+    }
+
+    std::vector<RenderGraphParallelRecording::Segment> RenderGraph::BuildParallelRecordingSegments(const std::vector<float>& pass_costs)
+    {
+        auto& worker_pool = m_parallel_recording_state->worker_pool;
+        if (!worker_pool)
         {
-            return;
+            worker_pool = std::make_unique<RenderGraphParallelRecording::WorkerPool>(m_parallel_recording_policy.worker_count);
         }
-
-        auto& pix_state = *m_pix_capture_state;
-        if ((PIXGetCaptureState() & PIX_CAPTURE_GPU) != 0u)
+        // A rendering scope cannot span command lists, so segments are balanced over scopes rather than passes.
+        const unsigned pass_count = static_cast<unsigned>(pass_costs.size());
+        std::vector<unsigned> scope_begins;
+        std::vector<float> scope_costs;
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
         {
-            PIXEndCapture(FALSE);
+            if (GetRenderingScopeRange(pass_index).first == pass_index)
+            {
+                scope_begins.push_back(pass_index);
+                scope_costs.push_back(0.0f);
+            }
+            scope_costs.back() += pass_costs[pass_index];
         }
-
-        pix_state.pending = {};
-        m_pix_capture_state.reset();
+        auto segments = RenderGraphParallelRecording::BuildSegments(
+            scope_costs,
+            worker_pool->GetWorkerCount() + 1,
+            m_parallel_recording_policy.min_passes_per_segment);
+        for (auto& segment : segments)
+        {
+            segment.begin = scope_begins[segment.begin];
+            segment.end = segment.end < scope_begins.size() ? scope_begins[segment.end] : pass_count;
+        }
+        return segments;
     }
 
-    bool RenderGraph::InitGPUProfiler()
+    void RenderGraph::RecordPlanInParallel(
+        IRHICommandList& command_list,
+        const FrameContextSnapshot& frame_context,
+        unsigned profiler_slot_index,
+        unsigned long long interval,
+        std::vector<RenderPassExecutionStatus>& out_execution_statuses,
+        std::vector<float>& out_pass_cpu_ms,
+        std::vector<std::pair<double, double>>& out_pass_cpu_spans_ms,
+        std::vector<unsigned>& out_segment_indices,
+        RenderGraphBindingState::Counters& out_binding_counters)
     {
-        if (m_gpu_profiler_state)
-        {
-            return true;
-        }
+        const auto& execution_order = m_execution_plan_state.live_execution_order;
+        const unsigned pass_count = static_cast<unsigned>(execution_order.size());
+        out_execution_statuses.assign(pass_count, RenderPassExecutionStatus::EXECUTED);
+        out_pass_cpu_ms.assign(pass_count, 0.0f);
+        out_pass_cpu_spans_ms.assign(pass_count, {0.0, 0.0});
+        out_segment_indices.assign(pass_count, 0u);
 
-        m_gpu_profiler_state = std::make_unique<GPUProfilerState>();
-        auto& profiler_state = *m_gpu_profiler_state;
-        const unsigned profiler_slot_count = ResolveProfilerSlotCount(m_resource_allocator);
-        if (profiler_slot_count == 0)
+        // Callbacks, validation and descriptor caches touch shared graph state, so every pass is prepared
+        // on this thread, in execution order, before anything is recorded.
+        std::vector<PreparedRenderGraphNode> prepared_nodes(pass_count);
+        std::vector<float> pass_costs(pass_count, 0.0f);
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
         {
-            return true;
+            const auto prepare_begin = std::chrono::steady_clock::now();
+            out_execution_statuses[pass_index] =
+                PrepareRenderGraphNode(frame_context, execution_order[pass_index], interval, prepared_nodes[pass_index]);
+            if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
+            {
+                ApplyRenderPassMergePlan(pass_index, prepared_nodes[pass_index]);
+            }
+            out_pass_cpu_ms[pass_index] = ToMilliseconds(prepare_begin, std::chrono::steady_clock::now());
+            pass_costs[pass_index] =
+                1.0f + static_cast<float>(m_render_graph_nodes[execution_order[pass_index].value].draw_info.execute_commands.size());
         }
 
-        profiler_state.frame_slots.resize(profiler_slot_count);
-        
-        GLTF_CHECK(RHIUtilInstanceManager::Instance().InitTimestampProfiler(
-            m_resource_allocator.GetDevice(),
-            m_resource_allocator.GetCommandQueue(),
-            profiler_slot_count,
-            profiler_state.max_query_count));
-        profiler_state.supported = RHIUtilInstanceManager::Instance().IsTimestampProfilerSupported();
-        if (profiler_state.supported)
+        const auto segments = BuildParallelRecordingSegments(pass_costs);
+        for (unsigned segment_index = 0; segment_index < segments.size(); ++segment_index)
         {
-            LOG_FORMAT_FLUSH("[RenderGraph][Profiler] GPU timestamp profiler enabled.\n");
+            for (unsigned pass_index = segments[segment_index].begin; pass_index < segments[segment_index].end; ++pass_index)
+            {
+                out_segment_indices[pass_index] = segment_index;
+            }
         }
-        else
+
+        // Barriers are planned and their states tracked here; workers only replay the captured batches.
+        std::map<unsigned long long, BarrierResource> barrier_resources;
+        const auto barrier_plan =
+            BuildFrameBarrierPlan(m_barrier_state_requests, pass_count, barrier_resources, m_barrier_plan_diagnostics);
+        BarrierPlanRecorder barrier_recorder(command_list, barrier_plan, barrier_resources, m_barrier_plan_diagnostics);
+        barrier_recorder.SetStepSegments(&out_segment_indices);
+        const auto aliasing_barriers = ResolveAliasingBarriers(m_transient_aliasing_state->layout.step_barriers);
+        barrier_recorder.SetAliasingBarriers(&aliasing_barriers);
+
+        std::vector<std::vector<BarrierBatch>> before_pass_batches(pass_count);
+        std::vector<std::vector<BarrierBatch>> after_pass_batches(pass_count);
+        // Everything a rendering scope needs is recorded before its first pass and after its last.
+        for (unsigned scope_begin = 0; scope_begin < pass_count;)
         {
-            LOG_FORMAT_FLUSH("[RenderGraph][Profiler] GPU timestamp profiler unavailable, fallback to CPU timings only.\n");
+            const unsigned scope_end = GetRenderingScopeRange(scope_begin).second;
+            barrier_recorder.CaptureInto(&before_pass_batches[scope_begin]);
+            for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
+            {
+                barrier_recorder.RecordBeforePass(pass_index);
+            }
+            for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
+            {
+                if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
+                {
+                    AppendMissingTransitions(prepared_nodes[pass_index], before_pass_batches[scope_begin], m_barrier_plan_diagnostics);
+                }
+            }
+            barrier_recorder.CaptureInto(&after_pass_batches[scope_end]);
+            for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
+            {
+                barrier_recorder.RecordAfterPass(pass_index);
+            }
+            scope_begin = scope_end + 1;
         }
+        barrier_recorder.Flush();
 
-        return true;
-    }
+        // Profiler begin and uploads issued by pre-render callbacks have to reach the queue before any segment.
+        CloseCurrentCommandListAndExecute(command_list, {}, false);
 
-    void RenderGraph::ShutdownGPUProfiler()
-    {
-        if (!m_gpu_profiler_state)
+        std::vector<IRHICommandList*> segment_command_lists(segments.size(), nullptr);
+        for (unsigned segment_index = 0; segment_index < segments.size(); ++segment_index)
         {
-            return;
+            auto& segment_command_list = m_resource_allocator.AcquireParallelRecordCommandList(frame_context, segment_index);
+            segment_command_list.SetExternalResourceStateTracking(true);
+            segment_command_lists[segment_index] = &segment_command_list;
         }
 
-        RHIUtilInstanceManager::Instance().ShutdownTimestampProfiler();
-        m_gpu_profiler_state.reset();
-    }
+        const unsigned max_timestamped_pass_count = GetGPUProfilerMaxTimestampedPassCount();
+        std::vector<RenderGraphBindingState::Counters> segment_binding_counters(segments.size());
+        m_parallel_recording_state->worker_pool->Run(static_cast<unsigned>(segments.size()), [&](unsigned segment_index)
+        {
+            auto& segment_command_list = *segment_command_lists[segment_index];
+            bool rendering_scope_open = false;
+            auto binding_state = CreateBindingStateTracker();
+            for (unsigned pass_index = segments[segment_index].begin; pass_index < segments[segment_index].end; ++pass_index)
+            {
+                const bool enable_gpu_timestamp = pass_index < max_timestamped_pass_count;
+                if (enable_gpu_timestamp)
+                {
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(segment_command_list, profiler_slot_index, pass_index * 2));
+                }
 
-    bool RenderGraph::HasValidGPUProfilerSlot(unsigned slot_index) const
-    {
-        return m_gpu_profiler_state &&
-            m_gpu_profiler_state->supported &&
-            slot_index < m_gpu_profiler_state->frame_slots.size();
-    }
+                const auto record_begin = std::chrono::steady_clock::now();
+                RecordBarrierBatches(segment_command_list, before_pass_batches[pass_index]);
+                if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
+                {
+                    out_execution_statuses[pass_index] = RecordRenderGraphNode(segment_command_list, prepared_nodes[pass_index], rendering_scope_open, binding_state);
+                }
+                if (GetRenderingScopeRange(pass_index).second == pass_index)
+                {
+                    CloseRenderingScope(segment_command_list, rendering_scope_open);
+                }
+                RecordBarrierBatches(segment_command_list, after_pass_batches[pass_index]);
+                const auto record_end = std::chrono::steady_clock::now();
+                out_pass_cpu_ms[pass_index] += ToMilliseconds(record_begin, record_end);
+                out_pass_cpu_spans_ms[pass_index] = {ToTimelineMilliseconds(record_begin), ToTimelineMilliseconds(record_end)};
 
-    unsigned RenderGraph::GetGPUProfilerMaxTimestampedPassCount() const
-    {
-        return (m_gpu_profiler_state && m_gpu_profiler_state->supported)
-            ? m_gpu_profiler_state->max_pass_count
-            : 0u;
-    }
+                if (enable_gpu_timestamp)
+                {
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(segment_command_list, profiler_slot_index, pass_index * 2 + 1));
+                }
+            }
+            segment_binding_counters[segment_index] = binding_state.GetCounters();
+        });
 
-    unsigned RenderGraph::GetGPUProfilerMaxQueryCount() const
-    {
-        return m_gpu_profiler_state ? m_gpu_profiler_state->max_query_count : 0u;
-    }
+        out_binding_counters = {};
+        for (const auto& binding_counters : segment_binding_counters)
+        {
+            out_binding_counters.issued_count += binding_counters.issued_count;
+            out_binding_counters.skipped_count += binding_counters.skipped_count;
+        }
 
-    unsigned RenderGraph::ClampGPUProfilerQueryCount(unsigned query_count) const
-    {
-        const unsigned max_query_count = GetGPUProfilerMaxQueryCount();
-        if (max_query_count == 0u)
+        for (auto* segment_command_list : segment_command_lists)
         {
-            return 0u;
+            CloseCurrentCommandListAndExecute(*segment_command_list, {}, false);
+            segment_command_list->SetExternalResourceStateTracking(false);
         }
 
-        return (std::min)(query_count, max_query_count);
+        // Reopen the frame command list for the profiler resolve, debug UI and present.
+        auto& reopened_command_list = m_resource_allocator.GetCommandListForRecordPassCommand(frame_context);
+        GLTF_CHECK(&reopened_command_list == &command_list);
+        m_resource_allocator.GetDescriptorManager().BindDescriptorContext(command_list);
     }
 
-    void RenderGraph::ResolveGPUProfilerFrame(unsigned slot_index)
-    {
-        if (!HasValidGPUProfilerSlot(slot_index))
+    void RenderGraph::RecordPlanWithAsyncCompute(
+        IRHICommandList& command_list,
+        const FrameContextSnapshot& frame_context,
+        unsigned profiler_slot_index,
+        unsigned long long interval,
+        std::vector<RenderPassExecutionStatus>& out_execution_statuses,
+        std::vector<float>& out_pass_cpu_ms,
+        std::vector<std::pair<double, double>>& out_pass_cpu_spans_ms,
+        std::vector<unsigned>& out_segment_indices,
+        RenderGraphBindingState::Counters& out_binding_counters)
+    {
+        using RenderGraphQueueScheduler::Queue;
+        constexpr unsigned invalid_index = RenderGraphQueueScheduler::INVALID_INDEX;
+
+        const auto& execution_order = m_execution_plan_state.live_execution_order;
+        const auto& schedule = m_async_compute_state->schedule;
+        const unsigned pass_count = static_cast<unsigned>(execution_order.size());
+        out_execution_statuses.assign(pass_count, RenderPassExecutionStatus::EXECUTED);
+        out_pass_cpu_ms.assign(pass_count, 0.0f);
+        out_pass_cpu_spans_ms.assign(pass_count, {0.0, 0.0});
+        out_segment_indices.assign(pass_count, 0u);
+        const auto is_async_step = [&schedule](unsigned step_index)
+        {
+            return schedule.steps[step_index].queue == Queue::ASYNC_COMPUTE;
+        };
+
+        // Prepared up front like the parallel path, since barriers for every list are captured before any list
+        // records. Async passes transition to what a compute queue accepts.
+        std::vector<PreparedRenderGraphNode> prepared_nodes(pass_count);
+        std::vector<float> pass_costs(pass_count, 0.0f);
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
         {
-            return;
+            const auto prepare_begin = std::chrono::steady_clock::now();
+            auto& prepared_node = prepared_nodes[pass_index];
+            out_execution_statuses[pass_index] =
+                PrepareRenderGraphNode(frame_context, execution_order[pass_index], interval, prepared_node);
+            if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
+            {
+                ApplyRenderPassMergePlan(pass_index, prepared_node);
+                if (is_async_step(pass_index))
+                {
+                    for (auto& descriptor_binding : prepared_node.descriptor_bindings)
+                    {
+                        for (auto& resource_state : descriptor_binding.resource_states)
+                        {
+                            resource_state.state = ConvertToComputeQueueResourceState(resource_state.state);
+                        }
+                    }
+                }
+            }
+            out_pass_cpu_ms[pass_index] = ToMilliseconds(prepare_begin, std::chrono::steady_clock::now());
+            pass_costs[pass_index] =
+                1.0f + static_cast<float>(m_render_graph_nodes[execution_order[pass_index].value].draw_info.execute_commands.size());
         }
 
-        auto& profiler_state = *m_gpu_profiler_state;
-        auto& frame_slot = profiler_state.frame_slots[slot_index];
-        if (!frame_slot.has_pending_frame_stats || frame_slot.query_count == 0)
+        // Each queue records into a new command list where it waits or signals. A rendering scope stays in one
+        // list, so graphics waits move to the first pass of their scope and graphics signals to its last.
+        std::vector<unsigned char> begins_command_list(pass_count, 0u);
+        std::vector<unsigned char> ends_command_list(pass_count, 0u);
+        for (const auto& sync_point : schedule.sync_points)
         {
-            return;
+            if (sync_point.wait_before_step != invalid_index)
+            {
+                begins_command_list[sync_point.wait_queue == Queue::GRAPHICS
+                    ? GetRenderingScopeRange(sync_point.wait_before_step).first
+                    : sync_point.wait_before_step] = 1u;
+            }
+            if (sync_point.signal_after_step != invalid_index)
+            {
+                ends_command_list[sync_point.signal_queue == Queue::GRAPHICS
+                    ? GetRenderingScopeRange(sync_point.signal_after_step).second
+                    : sync_point.signal_after_step] = 1u;
+            }
         }
-
-        const unsigned query_count = frame_slot.query_count;
-        std::vector<uint64_t> timestamps(query_count, 0);
-        double ticks_per_second = 0.0;
-        const bool readback_ok = RHIUtilInstanceManager::Instance().ResolveTimestampFrame(
-            slot_index,
-            query_count,
-            timestamps,
-            ticks_per_second);
-
-        if (!readback_ok)
+        // With parallel recording the graphics queue also breaks where the parallel path would start a segment,
+        // and the command lists are recorded by the workers.
+        const bool record_in_parallel = ShouldRecordPassesInParallel();
+        if (record_in_parallel)
         {
-            frame_slot.has_pending_frame_stats = false;
-            frame_slot.query_count = 0;
-            return;
+            for (const auto& segment : BuildParallelRecordingSegments(pass_costs))
+            {
+                if (!is_async_step(segment.begin))
+                {
+                    begins_command_list[segment.begin] = 1u;
+                }
+            }
         }
 
-        auto resolved_stats = frame_slot.pending_frame_stats;
-        resolved_stats.gpu_time_valid = false;
-        resolved_stats.gpu_total_ms = 0.0f;
+        struct QueuePiece
+        {
+            Queue queue{Queue::GRAPHICS};
+            IRHICommandList* command_list{nullptr};
+            std::vector<IRHISemaphore*> wait_semaphores;
+            IRHISemaphore* signal_semaphore{nullptr};
+            // Recorded after the last pass, ahead of the signal.
+            std::vector<BarrierBatch> tail_batches;
+            bool rendering_scope_open{false};
+        };
+        // In order of their first pass, which is also a valid submission order: every signal a piece waits on
+        // comes from a pass before its first one.
+        std::vector<QueuePiece> pieces;
+        unsigned open_pieces[2] = {invalid_index, invalid_index};
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
+        {
+            const Queue queue = schedule.steps[pass_index].queue;
+            auto& open_piece = open_pieces[queue == Queue::ASYNC_COMPUTE ? 1 : 0];
+            if (open_piece == invalid_index || begins_command_list[pass_index])
+            {
+                open_piece = static_cast<unsigned>(pieces.size());
+                pieces.push_back({queue});
+            }
+            out_segment_indices[pass_index] = open_piece;
+            if (ends_command_list[pass_index])
+            {
+                open_piece = invalid_index;
+            }
+        }
 
-        const unsigned timed_pass_count = (std::min)(static_cast<unsigned>(resolved_stats.pass_stats.size()), query_count / 2);
-        for (unsigned i = 0; i < timed_pass_count; ++i)
+        unsigned semaphore_count = 0;
+        const auto acquire_semaphore = [&]() -> IRHISemaphore*
         {
-            const uint64_t begin_tick = timestamps[i * 2];
-            const uint64_t end_tick = timestamps[i * 2 + 1];
-            if (end_tick <= begin_tick)
+            return &m_resource_allocator.AcquireQueueSyncSemaphore(frame_context, semaphore_count++);
+        };
+        for (const auto& sync_point : schedule.sync_points)
+        {
+            // Frame-end joins are covered by the join after the last compute list below.
+            if (sync_point.wait_before_step == invalid_index || sync_point.signal_after_step == invalid_index)
             {
                 continue;
             }
-
-            if (ticks_per_second <= 0.0)
+            auto& signal_piece = pieces[out_segment_indices[sync_point.signal_after_step]];
+            if (!signal_piece.signal_semaphore)
             {
-                break;
+                signal_piece.signal_semaphore = acquire_semaphore();
+            }
+            auto& wait_semaphores = pieces[out_segment_indices[sync_point.wait_before_step]].wait_semaphores;
+            if (std::find(wait_semaphores.begin(), wait_semaphores.end(), signal_piece.signal_semaphore) == wait_semaphores.end())
+            {
+                wait_semaphores.push_back(signal_piece.signal_semaphore);
             }
-
-            const double gpu_time_ms = static_cast<double>(end_tick - begin_tick) * 1000.0 / ticks_per_second;
-
-            auto& pass_stats = resolved_stats.pass_stats[i];
-            pass_stats.gpu_time_valid = true;
-            pass_stats.gpu_time_ms = static_cast<float>(gpu_time_ms);
-            resolved_stats.gpu_total_ms += static_cast<float>(gpu_time_ms);
-            resolved_stats.gpu_time_valid = true;
+        }
+        // The compute queue starts after the frame command list, which carries the uploads of pre-render
+        // callbacks, and the frame command list reopened below ends after the compute queue.
+        IRHISemaphore* head_semaphore = acquire_semaphore();
+        QueuePiece* first_async_piece = nullptr;
+        QueuePiece* last_async_piece = nullptr;
+        for (auto& piece : pieces)
+        {
+            if (piece.queue == Queue::ASYNC_COMPUTE)
+            {
+                first_async_piece = first_async_piece ? first_async_piece : &piece;
+                last_async_piece = &piece;
+            }
+        }
+        GLTF_CHECK(first_async_piece && last_async_piece);
+        first_async_piece->wait_semaphores.push_back(head_semaphore);
+        if (!last_async_piece->signal_semaphore)
+        {
+            last_async_piece->signal_semaphore = acquire_semaphore();
         }
 
-        m_last_frame_stats = resolved_stats;
-        frame_slot.has_pending_frame_stats = false;
-        frame_slot.query_count = 0;
-    }
-
-    void RenderGraph::ExecutePlanAndCollectStats(
-        IRHICommandList& command_list,
-        const FrameContextSnapshot& frame_context,
-        unsigned profiler_slot_index,
-        unsigned long long interval)
-    {
-        FrameStats submitted_frame_stats{};
-        submitted_frame_stats.frame_index = m_frame_index;
-        submitted_frame_stats.cpu_total_ms = 0.0f;
-        submitted_frame_stats.cpu_executed_ms = 0.0f;
-        submitted_frame_stats.cpu_skipped_ms = 0.0f;
-        submitted_frame_stats.cpu_skipped_validation_ms = 0.0f;
-        submitted_frame_stats.gpu_time_valid = false;
-        submitted_frame_stats.gpu_total_ms = 0.0f;
-        submitted_frame_stats.total_pass_count = 0;
-        submitted_frame_stats.executed_pass_count = 0;
-        submitted_frame_stats.skipped_pass_count = 0;
-        submitted_frame_stats.skipped_validation_pass_count = 0;
-        submitted_frame_stats.skipped_missing_pass_count = 0;
-        submitted_frame_stats.graphics_pass_count = 0;
-        submitted_frame_stats.compute_pass_count = 0;
-        submitted_frame_stats.ray_tracing_pass_count = 0;
-        submitted_frame_stats.executed_graphics_pass_count = 0;
-        submitted_frame_stats.executed_compute_pass_count = 0;
-        submitted_frame_stats.executed_ray_tracing_pass_count = 0;
-        submitted_frame_stats.pass_stats.clear();
-        submitted_frame_stats.pass_stats.reserve(m_execution_plan_state.cached_execution_order.size());
-
-        GLTF_CHECK(BeginGPUProfilerFrame(command_list, profiler_slot_index));
-        const unsigned max_timestamped_pass_count = GetGPUProfilerMaxTimestampedPassCount();
-        unsigned timestamped_pass_count = 0;
+        // Async passes plan against the compute queue states they were prepared with.
+        auto state_requests = m_barrier_state_requests;
+        for (unsigned pass_index = 0; pass_index < pass_count && pass_index < state_requests.size(); ++pass_index)
+        {
+            if (!is_async_step(pass_index))
+            {
+                continue;
+            }
+            for (auto& state_request : state_requests[pass_index])
+            {
+                state_request.second = static_cast<unsigned>(
+                    ConvertToComputeQueueResourceState(static_cast<RHIResourceStateType>(state_request.second)));
+            }
+        }
+        std::map<unsigned long long, BarrierResource> barrier_resources;
+        const auto barrier_plan =
+            BuildFrameBarrierPlan(state_requests, pass_count, barrier_resources, m_barrier_plan_diagnostics);
+        BarrierPlanRecorder barrier_recorder(command_list, barrier_plan, barrier_resources, m_barrier_plan_diagnostics);
+        barrier_recorder.SetStepSegments(&out_segment_indices);
+        const auto aliasing_barriers = ResolveAliasingBarriers(m_transient_aliasing_state->layout.step_barriers);
+        barrier_recorder.SetAliasingBarriers(&aliasing_barriers);
 
-        for (unsigned pass_index = 0; pass_index < m_execution_plan_state.cached_execution_order.size(); ++pass_index)
+        // Async passes never begin split barriers, so nothing a graphics list began has to end on a compute list.
+        std::vector<std::vector<BarrierBatch>> before_pass_batches(pass_count);
+        std::vector<std::vector<BarrierBatch>> after_pass_batches(pass_count);
+        for (unsigned scope_begin = 0; scope_begin < pass_count;)
         {
-            auto render_graph_node = m_execution_plan_state.cached_execution_order[pass_index];
-            const bool enable_gpu_timestamp = max_timestamped_pass_count > 0 && pass_index < max_timestamped_pass_count;
-            if (enable_gpu_timestamp)
+            const unsigned scope_end = GetRenderingScopeRange(scope_begin).second;
+            barrier_recorder.CaptureInto(&before_pass_batches[scope_begin]);
+            for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
             {
-                const unsigned query_index = static_cast<unsigned>(pass_index * 2);
-                GLTF_CHECK(WriteGPUProfilerTimestamp(command_list, profiler_slot_index, query_index));
+                barrier_recorder.RecordBeforePass(pass_index);
             }
-
-            const auto pass_begin = std::chrono::steady_clock::now();
-            const auto execution_status =
-                ExecuteRenderGraphNode(command_list, frame_context, render_graph_node, interval);
-            const auto pass_end = std::chrono::steady_clock::now();
-            const float pass_cpu_ms = std::chrono::duration<float, std::milli>(pass_end - pass_begin).count();
-
-            if (enable_gpu_timestamp)
+            for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
             {
-                const unsigned query_index = static_cast<unsigned>(pass_index * 2 + 1);
-                GLTF_CHECK(WriteGPUProfilerTimestamp(command_list, profiler_slot_index, query_index));
-                ++timestamped_pass_count;
+                if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
+                {
+                    AppendMissingTransitions(prepared_nodes[pass_index], before_pass_batches[scope_begin], m_barrier_plan_diagnostics);
+                }
             }
-
-            const auto& node_desc = m_render_graph_nodes[render_graph_node.value];
-            std::string group_name = node_desc.debug_group;
-            if (group_name.empty())
+            if (!is_async_step(scope_begin))
             {
-                group_name = "Ungrouped";
+                barrier_recorder.CaptureInto(&after_pass_batches[scope_end]);
+                for (unsigned pass_index = scope_begin; pass_index <= scope_end; ++pass_index)
+                {
+                    barrier_recorder.RecordAfterPass(pass_index);
+                }
             }
+            scope_begin = scope_end + 1;
+        }
+        std::vector<BarrierBatch> flush_batches;
+        barrier_recorder.CaptureInto(&flush_batches);
+        barrier_recorder.Flush();
 
-            const auto render_pass = InternalResourceHandleTable::Instance().GetRenderPass(node_desc.render_pass_handle);
-            const RenderPassType pass_type = render_pass ? render_pass->GetRenderPassType() : RenderPassType::GRAPHICS;
-            std::string pass_name = node_desc.debug_name;
-            if (pass_name.empty())
+        // A compute list only transitions between compute queue states. Transitions out of anything else, i.e.
+        // out of what graphics passes left behind, move to the end of the graphics list whose signal the async
+        // pass waits on last, or to the frame command list when it waits on none.
+        const auto is_compute_legal = [](const auto& barrier)
+        {
+            return IsComputeQueueResourceState(barrier.before_state) && IsComputeQueueResourceState(barrier.after_state);
+        };
+        const auto move_barriers = [&is_compute_legal](auto& barriers, auto& out_barriers)
+        {
+            const auto legal_end = std::stable_partition(barriers.begin(), barriers.end(), is_compute_legal);
+            out_barriers.insert(out_barriers.end(), legal_end, barriers.end());
+            barriers.erase(legal_end, barriers.end());
+        };
+        std::vector<BarrierBatch> head_batches;
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
+        {
+            if (!is_async_step(pass_index))
             {
-                std::string type_name = render_pass ? ToRenderPassTypeName(pass_type) : "Unknown";
-                pass_name = type_name + "#" + std::to_string(render_graph_node.value);
+                continue;
             }
-
-            RenderPassFrameStats pass_stats{};
-            pass_stats.node_handle = render_graph_node;
-            pass_stats.group_name = group_name;
-            pass_stats.pass_name = pass_name;
-            pass_stats.pass_type = pass_type;
-            pass_stats.executed = execution_status == RenderPassExecutionStatus::EXECUTED;
-            pass_stats.skipped_due_to_validation = execution_status == RenderPassExecutionStatus::SKIPPED_INVALID_DRAW_DESC;
-            pass_stats.cpu_time_ms = pass_cpu_ms;
-            submitted_frame_stats.pass_stats.push_back(pass_stats);
-            ++submitted_frame_stats.total_pass_count;
-            submitted_frame_stats.cpu_total_ms += pass_cpu_ms;
-            switch (pass_type)
+            unsigned graphics_signal_step = invalid_index;
+            for (const auto& sync_point : schedule.sync_points)
             {
-            case RenderPassType::GRAPHICS:
-                ++submitted_frame_stats.graphics_pass_count;
-                break;
-            case RenderPassType::COMPUTE:
-                ++submitted_frame_stats.compute_pass_count;
-                break;
-            case RenderPassType::RAY_TRACING:
-                ++submitted_frame_stats.ray_tracing_pass_count;
-                break;
+                if (sync_point.wait_queue == Queue::ASYNC_COMPUTE &&
+                    sync_point.wait_before_step != invalid_index && sync_point.wait_before_step <= pass_index &&
+                    sync_point.signal_after_step != invalid_index &&
+                    (graphics_signal_step == invalid_index || sync_point.signal_after_step > graphics_signal_step))
+                {
+                    graphics_signal_step = sync_point.signal_after_step;
+                }
             }
-            if (pass_stats.executed)
+            auto& moved_batches = graphics_signal_step == invalid_index
+                ? head_batches
+                : pieces[out_segment_indices[graphics_signal_step]].tail_batches;
+            for (auto& batch : before_pass_batches[pass_index])
             {
-                ++submitted_frame_stats.executed_pass_count;
-                submitted_frame_stats.cpu_executed_ms += pass_cpu_ms;
-                switch (pass_type)
+                BarrierBatch moved_batch{};
+                move_barriers(batch.texture_barriers, moved_batch.texture_barriers);
+                move_barriers(batch.buffer_barriers, moved_batch.buffer_barriers);
+                if (!moved_batch.texture_barriers.empty() || !moved_batch.buffer_barriers.empty())
                 {
-                case RenderPassType::GRAPHICS:
-                    ++submitted_frame_stats.executed_graphics_pass_count;
-                    break;
-                case RenderPassType::COMPUTE:
-                    ++submitted_frame_stats.executed_compute_pass_count;
-                    break;
-                case RenderPassType::RAY_TRACING:
-                    ++submitted_frame_stats.executed_ray_tracing_pass_count;
-                    break;
+                    moved_batches.push_back(std::move(moved_batch));
                 }
             }
-            else
+        }
+
+        // Profiler begin, uploads and the transitions the compute queue cannot record reach the GPU first.
+        RecordBarrierBatches(command_list, head_batches);
+        RHIExecuteCommandListContext head_context{};
+        head_context.sign_semaphores.push_back(head_semaphore);
+        CloseCurrentCommandListAndExecute(command_list, head_context, false);
+
+        unsigned graphics_list_count = 0;
+        unsigned compute_list_count = 0;
+        std::vector<RenderGraphBindingState::Tracker> binding_states;
+        binding_states.reserve(pieces.size());
+        for (auto& piece : pieces)
+        {
+            piece.command_list = piece.queue == Queue::ASYNC_COMPUTE
+                ? &m_resource_allocator.AcquireAsyncComputeCommandList(frame_context, compute_list_count++)
+                : &m_resource_allocator.AcquireParallelRecordCommandList(frame_context, graphics_list_count++);
+            piece.command_list->SetExternalResourceStateTracking(true);
+            binding_states.push_back(CreateBindingStateTracker());
+        }
+
+        std::vector<std::vector<unsigned>> piece_passes(pieces.size());
+        for (unsigned pass_index = 0; pass_index < pass_count; ++pass_index)
+        {
+            piece_passes[out_segment_indices[pass_index]].push_back(pass_index);
+        }
+        const unsigned max_timestamped_pass_count = GetGPUProfilerMaxTimestampedPassCount();
+        const auto record_piece = [&](unsigned piece_index)
+        {
+            auto& piece = pieces[piece_index];
+            auto& piece_command_list = *piece.command_list;
+            for (const unsigned pass_index : piece_passes[piece_index])
             {
-                ++submitted_frame_stats.skipped_pass_count;
-                submitted_frame_stats.cpu_skipped_ms += pass_cpu_ms;
-                if (pass_stats.skipped_due_to_validation)
+                const bool enable_gpu_timestamp = pass_index < max_timestamped_pass_count;
+                if (enable_gpu_timestamp)
                 {
-                    ++submitted_frame_stats.skipped_validation_pass_count;
-                    submitted_frame_stats.cpu_skipped_validation_ms += pass_cpu_ms;
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(piece_command_list, profiler_slot_index, pass_index * 2));
                 }
-                else
+
+                const auto record_begin = std::chrono::steady_clock::now();
+                RecordBarrierBatches(piece_command_list, before_pass_batches[pass_index]);
+                if (out_execution_statuses[pass_index] == RenderPassExecutionStatus::EXECUTED)
                 {
-                    ++submitted_frame_stats.skipped_missing_pass_count;
+                    out_execution_statuses[pass_index] = RecordRenderGraphNode(
+                        piece_command_list, prepared_nodes[pass_index], piece.rendering_scope_open, binding_states[piece_index]);
+                }
+                if (GetRenderingScopeRange(pass_index).second == pass_index)
+                {
+                    CloseRenderingScope(piece_command_list, piece.rendering_scope_open);
+                }
+                RecordBarrierBatches(piece_command_list, after_pass_batches[pass_index]);
+                const auto record_end = std::chrono::steady_clock::now();
+                out_pass_cpu_ms[pass_index] += ToMilliseconds(record_begin, record_end);
+                out_pass_cpu_spans_ms[pass_index] = {ToTimelineMilliseconds(record_begin), ToTimelineMilliseconds(record_end)};
+
+                if (enable_gpu_timestamp)
+                {
+                    GLTF_CHECK(WriteGPUProfilerTimestamp(piece_command_list, profiler_slot_index, pass_index * 2 + 1));
                 }
             }
+        };
+        if (record_in_parallel)
+        {
+            m_parallel_recording_state->worker_pool->Run(static_cast<unsigned>(pieces.size()), record_piece);
         }
-
-        m_current_frame_timing_breakdown.execute_passes_ms = submitted_frame_stats.cpu_total_ms;
-        GLTF_CHECK(FinalizeGPUProfilerFrame(command_list, profiler_slot_index, timestamped_pass_count * 2, submitted_frame_stats));
-        if (!(m_gpu_profiler_state && m_gpu_profiler_state->supported))
+        else
         {
-            m_last_frame_stats = submitted_frame_stats;
+            for (unsigned piece_index = 0; piece_index < pieces.size(); ++piece_index)
+            {
+                record_piece(piece_index);
+            }
         }
-        else if (timestamped_pass_count == 0)
+
+        out_binding_counters = {};
+        for (const auto& binding_state : binding_states)
         {
-            m_last_frame_stats = submitted_frame_stats;
+            const auto binding_counters = binding_state.GetCounters();
+            out_binding_counters.issued_count += binding_counters.issued_count;
+            out_binding_counters.skipped_count += binding_counters.skipped_count;
         }
-        else if (m_last_frame_stats.pass_stats.empty())
+
+        for (auto& piece : pieces)
         {
-            m_last_frame_stats = submitted_frame_stats;
+            RecordBarrierBatches(*piece.command_list, piece.tail_batches);
+            RHIExecuteCommandListContext context{};
+            for (auto* wait_semaphore : piece.wait_semaphores)
+            {
+                context.wait_infos.push_back({wait_semaphore, RHIPipelineStage::ALL_COMMANDS});
+            }
+            if (piece.signal_semaphore)
+            {
+                context.sign_semaphores.push_back(piece.signal_semaphore);
+            }
+
+            if (piece.queue == Queue::GRAPHICS)
+            {
+                CloseCurrentCommandListAndExecute(*piece.command_list, context, false);
+            }
+            else
+            {
+                GLTF_CHECK(RHIUtilInstanceManager::Instance().CloseCommandList(*piece.command_list));
+                const auto submit_begin = std::chrono::steady_clock::now();
+                GLTF_CHECK(RHIUtilInstanceManager::Instance().ExecuteCommandList(
+                    *piece.command_list, m_resource_allocator.GetAsyncComputeCommandQueue(), context));
+                RecordFrameTraceSpan("submit", "Async compute submit", ToTimelineMilliseconds(submit_begin), ToTimelineMilliseconds(std::chrono::steady_clock::now()));
+            }
+            piece.command_list->SetExternalResourceStateTracking(false);
         }
+        m_async_compute_state->pending_graphics_wait = last_async_piece->signal_semaphore;
+        m_async_compute_schedule_diagnostics.submitted_async_pass_count = schedule.async_step_count;
+        m_async_compute_schedule_diagnostics.submitted_sync_count = semaphore_count;
+
+        // Reopen the frame command list for the profiler resolve, debug UI and present.
+        auto& reopened_command_list = m_resource_allocator.GetCommandListForRecordPassCommand(frame_context);
+        GLTF_CHECK(&reopened_command_list == &command_list);
+        m_resource_allocator.GetDescriptorManager().BindDescriptorContext(command_list);
+        RecordBarrierBatches(command_list, flush_batches);
     }
 
     bool RenderGraph::BeginGPUProfilerFrame(IRHICommandList& command_list, unsigned slot_index)
@@ -5402,7 +9443,7 @@ namespace RendererInterface
 
     void RenderGraph::EnqueueBufferDescriptorForDeferredRelease(
         RenderPassDescriptorResource& descriptor_resource,
-        const std::string& binding_name,
+        BindingName binding_name,
         const FrameContextSnapshot& frame_context)
     {
         const auto binding_cache_it = descriptor_resource.m_buffer_descriptor_cache.find(binding_name);
@@ -5420,7 +9461,7 @@ namespace RendererInterface
 
     void RenderGraph::EnqueueTextureDescriptorForDeferredRelease(
         RenderPassDescriptorResource& descriptor_resource,
-        const std::string& binding_name,
+        BindingName binding_name,
         const FrameContextSnapshot& frame_context)
     {
         const auto release_texture_cache_pool =
@@ -5460,7 +9501,7 @@ namespace RendererInterface
         }
 
         const auto release_texture_cache =
-            [this, &frame_context](const std::map<std::string, std::map<unsigned long long, RenderPassDescriptorResource::TextureDescriptorCacheEntry>>& texture_cache_map)
+            [this, &frame_context](const BindingNameMap<std::map<unsigned long long, RenderPassDescriptorResource::TextureDescriptorCacheEntry>>& texture_cache_map)
         {
             for (const auto& binding_cache_pair : texture_cache_map)
             {
@@ -5527,13 +9568,13 @@ namespace RendererInterface
             }
         }
 
-        const auto should_keep_texture_binding = [&draw_info](const std::string& binding_name)
+        const auto should_keep_texture_binding = [&draw_info](BindingName binding_name)
         {
             return draw_info.texture_resources.contains(binding_name) || draw_info.render_target_texture_resources.contains(binding_name);
         };
 
         const auto prune_texture_cache =
-            [this, &frame_context, &should_keep_texture_binding, &should_release_stale_entry](std::map<std::string, std::map<unsigned long long, RenderPassDescriptorResource::TextureDescriptorCacheEntry>>& texture_cache_map)
+            [this, &frame_context, &should_keep_texture_binding, &should_release_stale_entry](BindingNameMap<std::map<unsigned long long, RenderPassDescriptorResource::TextureDescriptorCacheEntry>>& texture_cache_map)
         {
             for (auto binding_it = texture_cache_map.begin(); binding_it != texture_cache_map.end(); )
             {
@@ -5720,11 +9761,11 @@ namespace RendererInterface
         }
     }
 
-    RenderGraph::RenderPassExecutionStatus RenderGraph::ExecuteRenderGraphNode(
-        IRHICommandList& command_list,
+    RenderGraph::RenderPassExecutionStatus RenderGraph::PrepareRenderGraphNode(
         const FrameContextSnapshot& frame_context,
         RenderGraphNodeHandle render_graph_node_handle,
-        unsigned long long interval)
+        unsigned long long interval,
+        PreparedRenderGraphNode& out_prepared_node)
     {
         GLTF_CHECK(render_graph_node_handle.IsValid());
         GLTF_CHECK(render_graph_node_handle.value < m_render_graph_nodes.size());
@@ -5741,7 +9782,55 @@ namespace RendererInterface
                 render_graph_node_handle.value);
             return RenderPassExecutionStatus::SKIPPED_MISSING_RENDER_PASS;
         }
-        const auto validation_result = render_pass->ValidateDrawDesc(render_graph_node_desc.draw_info);
+        std::shared_ptr<const RenderPass::DrawValidationResult> cached_validation_result;
+        const auto cache_mode = m_validation_policy.draw_validation_cache_mode;
+        if (cache_mode == DrawValidationCacheMode::DISABLED)
+        {
+            cached_validation_result =
+                std::make_shared<const RenderPass::DrawValidationResult>(render_pass->ValidateDrawDesc(render_graph_node_desc.draw_info));
+            ++m_draw_validation_cache->frame_validation_count;
+        }
+        else
+        {
+            auto& cache = *m_draw_validation_cache;
+            const std::size_t validation_key = ComputeDrawValidationKey(render_graph_node_desc, render_pass.get());
+            auto& node_entry = cache.node_entries[render_graph_node_handle];
+            if (node_entry.result && node_entry.key == validation_key)
+            {
+                cached_validation_result = node_entry.result;
+            }
+            else if (cache_mode == DrawValidationCacheMode::ONCE_PER_CONFIGURATION)
+            {
+                const auto configuration_it = cache.configuration_results.find(validation_key);
+                if (configuration_it != cache.configuration_results.end())
+                {
+                    cached_validation_result = configuration_it->second;
+                }
+            }
+
+            if (cached_validation_result)
+            {
+                ++cache.frame_cache_hit_count;
+            }
+            else
+            {
+                cached_validation_result =
+                    std::make_shared<const RenderPass::DrawValidationResult>(render_pass->ValidateDrawDesc(render_graph_node_desc.draw_info));
+                ++cache.frame_validation_count;
+                if (cache_mode == DrawValidationCacheMode::ONCE_PER_CONFIGURATION)
+                {
+                    if (cache.configuration_results.size() >= DrawValidationCache::MAX_CONFIGURATION_COUNT)
+                    {
+                        cache.configuration_results.clear();
+                    }
+                    cache.configuration_results[validation_key] = cached_validation_result;
+                }
+            }
+            node_entry.key = validation_key;
+            node_entry.result = cached_validation_result;
+        }
+
+        const auto& validation_result = *cached_validation_result;
         if (!validation_result.errors.empty() || !validation_result.warnings.empty())
         {
             LogRenderPassValidationResult(
@@ -5756,18 +9845,8 @@ namespace RendererInterface
             return RenderPassExecutionStatus::SKIPPED_INVALID_DRAW_DESC;
         }
 
-        if (!RHIUtilInstanceManager::Instance().SetPipelineState(command_list, render_pass->GetPipelineStateObject()))
-        {
-            const char* group_name = render_graph_node_desc.debug_group.empty() ? "<group-empty>" : render_graph_node_desc.debug_group.c_str();
-            const char* pass_name = render_graph_node_desc.debug_name.empty() ? "<pass-empty>" : render_graph_node_desc.debug_name.c_str();
-            LOG_FORMAT_FLUSH("[RenderGraph][Validation] Node %u (%s/%s) failed to bind pipeline state. Skip execution.\n",
-                             render_graph_node_handle.value,
-                             group_name,
-                             pass_name);
-            return RenderPassExecutionStatus::SKIPPED_INVALID_DRAW_DESC;
-        }
-        RHIUtilInstanceManager::Instance().SetRootSignature(command_list, render_pass->GetRootSignature(), render_pass->GetPipelineStateObject(), RendererInterfaceRHIConverter::ConvertToRHIPipelineType(render_pass->GetRenderPassType()));
-        RHIUtilInstanceManager::Instance().SetPrimitiveTopology(command_list, ConvertToRHIPrimitiveTopology(render_pass->GetPrimitiveTopology()));
+        out_prepared_node.node_handle = render_graph_node_handle;
+        out_prepared_node.render_pass = render_pass;
 
         unsigned default_viewport_width = m_window.GetWidth();
         unsigned default_viewport_height = m_window.GetHeight();
@@ -5786,14 +9865,20 @@ namespace RendererInterface
             }
         }
 
+        const auto& viewport_rect = render_graph_node_desc.viewport_rect;
         RHIViewportDesc viewport{};
         viewport.width = render_pass->GetViewportSize().first >= 0 ? render_pass->GetViewportSize().first : default_viewport_width;
         viewport.height = render_pass->GetViewportSize().second >= 0 ? render_pass->GetViewportSize().second : default_viewport_height;
+        if (viewport_rect.width >= 0 && viewport_rect.height >= 0)
+        {
+            viewport.width = viewport_rect.width;
+            viewport.height = viewport_rect.height;
+        }
         viewport.min_depth = 0.f;
         viewport.max_depth = 1.f;
-        viewport.top_left_x = 0.f;
-        viewport.top_left_y = 0.f;
-        RHIUtilInstanceManager::Instance().SetViewport(command_list, viewport);
+        viewport.top_left_x = static_cast<float>(viewport_rect.offset_x);
+        viewport.top_left_y = static_cast<float>(viewport_rect.offset_y);
+        out_prepared_node.viewport = viewport;
 
         const RHIScissorRectDesc scissor_rect =
             {
@@ -5802,9 +9887,9 @@ namespace RendererInterface
             (unsigned)(viewport.top_left_x + viewport.width),
             (unsigned)(viewport.top_left_y + viewport.height)
         }; 
-        RHIUtilInstanceManager::Instance().SetScissorRect(command_list, scissor_rect);
+        out_prepared_node.scissor_rect = scissor_rect;
 
-        RHIBeginRenderingInfo begin_rendering_info{};
+        auto& begin_rendering_info = out_prepared_node.begin_rendering_info;
         
         // render target binding
         bool clear_render_target = false;
@@ -5870,9 +9955,6 @@ namespace RendererInterface
         begin_rendering_info.clear_render_target = clear_render_target;
         begin_rendering_info.clear_depth_stencil = clear_depth_stencil;
 
-        // Bind descriptor heap
-        m_resource_allocator.GetDescriptorManager().BindDescriptorContext(command_list);
-
         // buffer binding
         RHIPipelineType pipeline_type = RHIPipelineType::Unknown;
         switch (render_pass->GetRenderPassType()) {
@@ -5886,6 +9968,7 @@ namespace RendererInterface
             pipeline_type = RHIPipelineType::RayTracing;
             break;
         }
+        out_prepared_node.pipeline_type = pipeline_type;
 
         auto& render_pass_descriptor_resource = m_descriptor_resource_store.GetOrCreate(render_graph_node_handle);
         m_descriptor_resource_store.MarkUsed(render_graph_node_handle, m_frame_index);
@@ -5893,12 +9976,12 @@ namespace RendererInterface
         
         for (const auto& buffer : render_graph_node_desc.draw_info.buffer_resources)
         {
-            if (!render_pass->HasRootSignatureAllocation(buffer.first))
+            const auto* root_signature_allocations = render_pass->FindRootSignatureAllocations(buffer.first);
+            if (!root_signature_allocations)
             {
                 continue;
             }
             GLTF_CHECK(buffer.second.buffer_handle != NULL_HANDLE);
-            const auto& root_signature_allocations = render_pass->GetRootSignatureAllocations(buffer.first);
             auto buffer_handle = buffer.second.buffer_handle;
             auto buffer_allocation = RendererInterface::InternalResourceHandleTable::Instance().GetBuffer(buffer_handle);
             GLTF_CHECK(buffer_allocation && buffer_allocation->m_buffer);
@@ -5948,33 +10031,47 @@ namespace RendererInterface
             auto& buffer_cache_entry = buffer_cache_it->second;
             buffer_cache_entry.last_used_frame = m_frame_index;
 
-            auto buffer_descriptor = buffer_cache_entry.descriptor;
+            auto& descriptor_binding = out_prepared_node.descriptor_bindings.emplace_back();
+            descriptor_binding.root_signature_allocations = root_signature_allocations;
+            descriptor_binding.descriptor = buffer_cache_entry.descriptor;
             switch (buffer.second.binding_type) {
             case BufferBindingDesc::CBV:
-                buffer_allocation->m_buffer->Transition(command_list, RHIResourceStateType::STATE_VERTEX_AND_CONSTANT_BUFFER);
+                descriptor_binding.resource_states.push_back({nullptr, buffer_allocation->m_buffer.get(), RHIResourceStateType::STATE_VERTEX_AND_CONSTANT_BUFFER});
                 break;
             case BufferBindingDesc::SRV:
-                //buffer_allocation->m_buffer->Transition(command_list, RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+                //descriptor_binding.resource_states.push_back({nullptr, buffer_allocation->m_buffer.get(), RHIResourceStateType::STATE_ALL_SHADER_RESOURCE});
                 //break;
             case BufferBindingDesc::UAV:
-                buffer_allocation->m_buffer->Transition(command_list, RHIResourceStateType::STATE_ALL_SHADER_RESOURCE);
+                descriptor_binding.resource_states.push_back({nullptr, buffer_allocation->m_buffer.get(), RHIResourceStateType::STATE_ALL_SHADER_RESOURCE});
                 break;
             }
-            for (const auto& root_signature_allocation : root_signature_allocations)
-            {
-                render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *buffer_descriptor);
-            }
         }
 
         for (const auto& texture  :render_graph_node_desc.draw_info.texture_resources)
         {
-            if (!render_pass->HasRootSignatureAllocation(texture.first))
+            const auto* root_signature_allocations = render_pass->FindRootSignatureAllocations(texture.first);
+            if (!root_signature_allocations)
             {
                 continue;
             }
             GLTF_CHECK(!texture.second.textures.empty());
+            if (texture.second.bindless_table)
+            {
+                // One table shared by every pass; registration only happens the first time a texture is seen.
+                GLTF_CHECK(texture.second.type == TextureBindingDesc::SRV);
+                auto& descriptor_binding = out_prepared_node.descriptor_bindings.emplace_back();
+                descriptor_binding.root_signature_allocations = root_signature_allocations;
+                for (const auto handle : texture.second.textures)
+                {
+                    m_resource_allocator.GetBindlessTextureIndex(handle);
+                    auto texture_allocation = InternalResourceHandleTable::Instance().GetTexture(handle);
+                    descriptor_binding.resource_states.push_back({texture_allocation->m_texture.get(), nullptr, RHIResourceStateType::STATE_ALL_SHADER_RESOURCE});
+                }
+                descriptor_binding.descriptor_table = m_resource_allocator.GetDescriptorManager().GetBindlessTextureTable();
+                descriptor_binding.descriptor_table_range_type = RHIDescriptorRangeType::SRV;
+                continue;
+            }
             const bool is_texture_table = texture.second.textures.size() > 1;
-            const auto& root_signature_allocations = render_pass->GetRootSignatureAllocations(texture.first);
 
             const auto source_texture_identity_keys = BuildTextureSourceIdentityKeys(texture.second);
             const unsigned long long texture_descriptor_cache_key =
@@ -5999,8 +10096,9 @@ namespace RendererInterface
                 cache_entry.source_texture_identity_keys = source_texture_identity_keys;
                 if (is_texture_table)
                 {
-                    std::shared_ptr<IRHIDescriptorTable> descriptor_table = RHIResourceFactory::CreateRHIResource<IRHIDescriptorTable>();
-                    const bool built = descriptor_table->Build(m_resource_allocator.GetDevice(), descriptor_allocations);
+                    std::shared_ptr<IRHIDescriptorTable> descriptor_table = nullptr;
+                    const bool built = m_resource_allocator.GetDescriptorManager().CreateDescriptorTable(
+                        m_resource_allocator.GetDevice(), descriptor_allocations, descriptor_table);
                     GLTF_CHECK(built);
                     cache_entry.descriptor_table = descriptor_table;
                     cache_entry.descriptor_table_source_data = descriptor_allocations;
@@ -6019,31 +10117,24 @@ namespace RendererInterface
             auto& texture_cache_entry = texture_cache_it->second;
             texture_cache_entry.last_used_frame = m_frame_index;
 
+            auto& descriptor_binding = out_prepared_node.descriptor_bindings.emplace_back();
+            descriptor_binding.root_signature_allocations = root_signature_allocations;
+            const RHIResourceStateType texture_state = texture.second.type == TextureBindingDesc::SRV ? RHIResourceStateType::STATE_ALL_SHADER_RESOURCE : RHIResourceStateType::STATE_UNORDERED_ACCESS;
             if (is_texture_table)
             {
-                auto descriptor_table = texture_cache_entry.descriptor_table;
-                auto& table_texture_descriptors = texture_cache_entry.descriptor_table_source_data;
-                GLTF_CHECK(descriptor_table);
-                for (const auto& table_texture : table_texture_descriptors)
-                {
-                    table_texture->m_source->Transition(command_list, texture.second.type == TextureBindingDesc::SRV ? RHIResourceStateType::STATE_ALL_SHADER_RESOURCE : RHIResourceStateType::STATE_UNORDERED_ACCESS);
-                }
-
-                for (const auto& root_signature_allocation : root_signature_allocations)
+                GLTF_CHECK(texture_cache_entry.descriptor_table);
+                for (const auto& table_texture : texture_cache_entry.descriptor_table_source_data)
                 {
-                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor_table, texture.second.type == TextureBindingDesc::SRV? RHIDescriptorRangeType::SRV : RHIDescriptorRangeType::UAV);
+                    descriptor_binding.resource_states.push_back({table_texture->m_source.get(), nullptr, texture_state});
                 }
+                descriptor_binding.descriptor_table = texture_cache_entry.descriptor_table;
+                descriptor_binding.descriptor_table_range_type = texture.second.type == TextureBindingDesc::SRV? RHIDescriptorRangeType::SRV : RHIDescriptorRangeType::UAV;
             }
             else
             {
-                auto descriptor = texture_cache_entry.descriptor;
-                GLTF_CHECK(descriptor);
-                descriptor->m_source->Transition(command_list, texture.second.type == TextureBindingDesc::SRV ? RHIResourceStateType::STATE_ALL_SHADER_RESOURCE : RHIResourceStateType::STATE_UNORDERED_ACCESS);
-
-                for (const auto& root_signature_allocation : root_signature_allocations)
-                {
-                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor);
-                }
+                GLTF_CHECK(texture_cache_entry.descriptor);
+                descriptor_binding.resource_states.push_back({texture_cache_entry.descriptor->m_source.get(), nullptr, texture_state});
+                descriptor_binding.descriptor = texture_cache_entry.descriptor;
             }
         }
 
@@ -6067,7 +10158,8 @@ namespace RendererInterface
 
         for (const auto& render_target_pair  :render_graph_node_desc.draw_info.render_target_texture_resources)
         {
-            if (!render_pass->HasRootSignatureAllocation(render_target_pair.first))
+            const auto* root_signature_allocations = render_pass->FindRootSignatureAllocations(render_target_pair.first);
+            if (!root_signature_allocations)
             {
                 continue;
             }
@@ -6108,8 +10200,9 @@ namespace RendererInterface
                 cache_entry.source_texture_identity_keys = source_texture_identity_keys;
                 if (is_texture_table)
                 {
-                    std::shared_ptr<IRHIDescriptorTable> descriptor_table = RHIResourceFactory::CreateRHIResource<IRHIDescriptorTable>();
-                    const bool built = descriptor_table->Build(m_resource_allocator.GetDevice(), descriptor_allocations);
+                    std::shared_ptr<IRHIDescriptorTable> descriptor_table = nullptr;
+                    const bool built = m_resource_allocator.GetDescriptorManager().CreateDescriptorTable(
+                        m_resource_allocator.GetDevice(), descriptor_allocations, descriptor_table);
                     GLTF_CHECK(built);
                     cache_entry.descriptor_table = descriptor_table;
                     cache_entry.descriptor_table_source_data = descriptor_allocations;
@@ -6128,43 +10221,222 @@ namespace RendererInterface
             auto& texture_cache_entry = texture_cache_it->second;
             texture_cache_entry.last_used_frame = m_frame_index;
 
-            const auto& root_signature_allocations = render_pass->GetRootSignatureAllocations(render_target_pair.first);
+            auto& descriptor_binding = out_prepared_node.descriptor_bindings.emplace_back();
+            descriptor_binding.root_signature_allocations = root_signature_allocations;
             if (is_texture_table)
             {
-                auto descriptor_table = texture_cache_entry.descriptor_table;
-                auto& table_texture_descriptors = texture_cache_entry.descriptor_table_source_data;
-                GLTF_CHECK(descriptor_table);
-                for (const auto& table_texture : table_texture_descriptors)
+                GLTF_CHECK(texture_cache_entry.descriptor_table);
+                for (const auto& table_texture : texture_cache_entry.descriptor_table_source_data)
                 {
-                    table_texture->m_source->Transition(
-                        command_list,
-                        get_render_target_texture_state(table_texture, render_target_pair.second.type));
+                    descriptor_binding.resource_states.push_back({
+                        table_texture->m_source.get(),
+                        nullptr,
+                        get_render_target_texture_state(table_texture, render_target_pair.second.type)});
                 }
+                descriptor_binding.descriptor_table = texture_cache_entry.descriptor_table;
+                descriptor_binding.descriptor_table_range_type = render_target_pair.second.type == RenderTargetTextureBindingDesc::SRV? RHIDescriptorRangeType::SRV : RHIDescriptorRangeType::UAV;
+            }
+            else
+            {
+                GLTF_CHECK(texture_cache_entry.descriptor);
+                descriptor_binding.resource_states.push_back({
+                    texture_cache_entry.descriptor->m_source.get(),
+                    nullptr,
+                    get_render_target_texture_state(texture_cache_entry.descriptor, render_target_pair.second.type)});
+                descriptor_binding.descriptor = texture_cache_entry.descriptor;
+            }
+        }
+
+        // Mirrors the attachment transitions BeginRendering records.
+        for (const auto* render_target : begin_rendering_info.m_render_targets)
+        {
+            const auto view_type = render_target->GetDesc().m_view_type;
+            if (view_type == RHIViewType::RVT_RTV)
+            {
+                out_prepared_node.attachment_states.push_back({render_target->m_source.get(), nullptr, RHIResourceStateType::STATE_RENDER_TARGET});
+            }
+            else if (view_type == RHIViewType::RVT_DSV)
+            {
+                out_prepared_node.attachment_states.push_back({
+                    render_target->m_source.get(),
+                    nullptr,
+                    begin_rendering_info.enable_depth_write ? RHIResourceStateType::STATE_DEPTH_WRITE : RHIResourceStateType::STATE_DEPTH_READ});
+            }
+        }
+
+        return RenderPassExecutionStatus::EXECUTED;
+    }
+
+    void RenderGraph::ApplyRenderPassMergePlan(unsigned pass_index, PreparedRenderGraphNode& prepared_node) const
+    {
+        // The plan is rebuilt with the execution order; should they ever disagree, passes keep their declared ops.
+        const auto& plan = m_render_pass_merge_state->plan;
+        if (plan.steps.size() != m_execution_plan_state.live_execution_order.size() ||
+            prepared_node.pipeline_type != RHIPipelineType::Graphics)
+        {
+            return;
+        }
+
+        const auto& step = plan.steps[pass_index];
+        auto& begin_rendering_info = prepared_node.begin_rendering_info;
+        if (step.load_ops.size() != begin_rendering_info.m_render_targets.size())
+        {
+            return;
+        }
 
-                for (const auto& root_signature_allocation : root_signature_allocations)
+        begin_rendering_info.clear_render_target = false;
+        begin_rendering_info.clear_depth_stencil = false;
+        unsigned attachment_index = 0;
+        for (const auto& render_target_info : m_render_graph_nodes[prepared_node.node_handle.value].draw_info.render_target_resources)
+        {
+            const auto load_op = ToRHIAttachmentLoadOp(step.load_ops[attachment_index]);
+            begin_rendering_info.m_render_target_load_ops[attachment_index] = load_op;
+            begin_rendering_info.m_render_target_store_ops[attachment_index] =
+                step.store_ops[attachment_index] == RenderGraphAttachmentOps::StoreOp::STORE
+                    ? RHIAttachmentStoreOp::STORE_OP_STORE
+                    : RHIAttachmentStoreOp::STORE_OP_DONT_CARE;
+            if (load_op == RHIAttachmentLoadOp::LOAD_OP_CLEAR)
+            {
+                if (render_target_info.second.usage == RenderPassResourceUsage::DEPTH_STENCIL)
+                {
+                    begin_rendering_info.clear_depth_stencil = true;
+                }
+                else
                 {
-                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor_table, render_target_pair.second.type == RenderTargetTextureBindingDesc::SRV? RHIDescriptorRangeType::SRV : RHIDescriptorRangeType::UAV);
+                    begin_rendering_info.clear_render_target = true;
                 }
             }
-            else
+            ++attachment_index;
+        }
+
+        prepared_node.continues_rendering_scope = step.group_begin < pass_index;
+        prepared_node.keeps_rendering_scope_open = pass_index < step.group_end;
+    }
+
+    std::pair<unsigned, unsigned> RenderGraph::GetRenderingScopeRange(unsigned pass_index) const
+    {
+        const auto& plan = m_render_pass_merge_state->plan;
+        if (plan.steps.size() != m_execution_plan_state.live_execution_order.size())
+        {
+            return {pass_index, pass_index};
+        }
+        return {plan.steps[pass_index].group_begin, plan.steps[pass_index].group_end};
+    }
+
+    RenderGraphBindingState::Tracker RenderGraph::CreateBindingStateTracker() const
+    {
+        const bool dx12 = RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_DX12;
+        RenderGraphBindingState::Policy policy{};
+        policy.skip_redundant_calls = m_binding_state_policy.skip_redundant_bindings;
+        policy.root_arguments_persist = dx12;
+        policy.dynamic_state_survives_pipeline_change = dx12;
+        return RenderGraphBindingState::Tracker(policy);
+    }
+
+    RenderGraph::RenderPassExecutionStatus RenderGraph::RecordRenderGraphNode(
+        IRHICommandList& command_list,
+        const PreparedRenderGraphNode& prepared_node,
+        bool& inout_rendering_scope_open,
+        RenderGraphBindingState::Tracker& binding_state)
+    {
+        using RenderGraphBindingState::MakeStateValue;
+        using RenderGraphBindingState::StateSlot;
+
+        const auto& render_graph_node_desc = m_render_graph_nodes[prepared_node.node_handle.value];
+        const auto& render_pass = prepared_node.render_pass;
+        const auto pipeline_type = prepared_node.pipeline_type;
+        // An open scope only carries over to the pass merged with the one that opened it.
+        if (!(pipeline_type == RHIPipelineType::Graphics && prepared_node.continues_rendering_scope))
+        {
+            CloseRenderingScope(command_list, inout_rendering_scope_open);
+        }
+        auto& pipeline_state_object = render_pass->GetPipelineStateObject();
+        if (binding_state.SetState(StateSlot::PIPELINE_STATE, MakeStateValue(&pipeline_state_object)) &&
+            !RHIUtilInstanceManager::Instance().SetPipelineState(command_list, pipeline_state_object))
+        {
+            binding_state.Reset();
+            const char* group_name = render_graph_node_desc.debug_group.empty() ? "<group-empty>" : render_graph_node_desc.debug_group.c_str();
+            const char* pass_name = render_graph_node_desc.debug_name.empty() ? "<pass-empty>" : render_graph_node_desc.debug_name.c_str();
+            LOG_FORMAT_FLUSH("[RenderGraph][Validation] Node %u (%s/%s) failed to bind pipeline state. Skip execution.\n",
+                             prepared_node.node_handle.value,
+                             group_name,
+                             pass_name);
+            return RenderPassExecutionStatus::SKIPPED_INVALID_DRAW_DESC;
+        }
+        // Raytracing passes bind through the compute root signature.
+        const auto root_table = pipeline_type == RHIPipelineType::Graphics
+            ? RenderGraphBindingState::RootTable::GRAPHICS
+            : RenderGraphBindingState::RootTable::COMPUTE;
+        if (binding_state.SetRootSignature(root_table, MakeStateValue(&render_pass->GetRootSignature())))
+        {
+            RHIUtilInstanceManager::Instance().SetRootSignature(command_list, render_pass->GetRootSignature(), pipeline_state_object, RendererInterfaceRHIConverter::ConvertToRHIPipelineType(render_pass->GetRenderPassType()));
+        }
+        // Rasterizer state is only consumed by draws, and compute command lists reject it.
+        if (pipeline_type == RHIPipelineType::Graphics)
+        {
+            const auto primitive_topology = ConvertToRHIPrimitiveTopology(render_pass->GetPrimitiveTopology());
+            if (binding_state.SetState(StateSlot::PRIMITIVE_TOPOLOGY, MakeStateValue(primitive_topology)))
+            {
+                RHIUtilInstanceManager::Instance().SetPrimitiveTopology(command_list, primitive_topology);
+            }
+
+            if (binding_state.SetState(StateSlot::VIEWPORT, MakeStateValue(prepared_node.viewport)))
+            {
+                RHIUtilInstanceManager::Instance().SetViewport(command_list, prepared_node.viewport);
+            }
+            if (binding_state.SetState(StateSlot::SCISSOR_RECT, MakeStateValue(prepared_node.scissor_rect)))
+            {
+                RHIUtilInstanceManager::Instance().SetScissorRect(command_list, prepared_node.scissor_rect);
+            }
+        }
+
+        // Bind descriptor heap
+        auto& descriptor_manager = m_resource_allocator.GetDescriptorManager();
+        if (binding_state.SetState(StateSlot::DESCRIPTOR_CONTEXT, MakeStateValue(&descriptor_manager)))
+        {
+            descriptor_manager.BindDescriptorContext(command_list);
+        }
+
+        for (const auto& descriptor_binding : prepared_node.descriptor_bindings)
+        {
+            for (const auto& resource_state : descriptor_binding.resource_states)
+            {
+                if (resource_state.texture)
+                {
+                    resource_state.texture->Transition(command_list, resource_state.state);
+                }
+                else
+                {
+                    resource_state.buffer->Transition(command_list, resource_state.state);
+                }
+            }
+
+            for (const auto& root_signature_allocation : *descriptor_binding.root_signature_allocations)
             {
-                auto descriptor = texture_cache_entry.descriptor;
-                GLTF_CHECK(descriptor);
-                descriptor->m_source->Transition(
-                    command_list,
-                    get_render_target_texture_state(descriptor, render_target_pair.second.type));
-                for (const auto& root_signature_allocation : root_signature_allocations)
+                const auto descriptor_identity = descriptor_binding.descriptor_table
+                    ? MakeStateValue(static_cast<const void*>(descriptor_binding.descriptor_table.get()))
+                    : MakeStateValue(static_cast<const void*>(descriptor_binding.descriptor.get()));
+                if (!binding_state.SetRootArgument(root_table, root_signature_allocation.global_parameter_index, descriptor_identity))
+                {
+                    continue;
+                }
+                if (descriptor_binding.descriptor_table)
+                {
+                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor_binding.descriptor_table, descriptor_binding.descriptor_table_range_type);
+                }
+                else
                 {
-                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor);
+                    render_pass->GetDescriptorUpdater().BindDescriptor(command_list, pipeline_type, root_signature_allocation, *descriptor_binding.descriptor);
                 }
             }
         }
 
         render_pass->GetDescriptorUpdater().FinalizeUpdateDescriptors(m_resource_allocator.GetDevice(), command_list, render_pass->GetRootSignature());
 
-        if (pipeline_type == RHIPipelineType::Graphics)
+        if (pipeline_type == RHIPipelineType::Graphics && !inout_rendering_scope_open)
         {
-            RHIUtilInstanceManager::Instance().BeginRendering(command_list, begin_rendering_info);    
+            RHIUtilInstanceManager::Instance().BeginRendering(command_list, prepared_node.begin_rendering_info);
+            inout_rendering_scope_open = true;
         }
         
         const auto& draw_info = render_graph_node_desc.draw_info;
@@ -6192,7 +10464,10 @@ namespace RendererInterface
                     auto indexed_buffer_view = InternalResourceHandleTable::Instance().GetIndexBufferView(command.input_buffer.index_buffer_handle);
                     //auto indexed_buffer = InternalResourceHandleTable::Instance().GetIndexBuffer(command.input_buffer.index_buffer_handle);
                     //indexed_buffer->GetBuffer().Transition(command_list, RHIResourceStateType::STATE_INDEX_BUFFER);
-                    RHIUtilInstanceManager::Instance().SetIndexBufferView(command_list, *indexed_buffer_view);
+                    if (binding_state.SetState(StateSlot::INDEX_BUFFER, MakeStateValue(indexed_buffer_view.get())))
+                    {
+                        RHIUtilInstanceManager::Instance().SetIndexBufferView(command_list, *indexed_buffer_view);
+                    }
                     RHIUtilInstanceManager::Instance().DrawIndexInstanced(command_list,
                         command.parameter.draw_indexed_instance_command_parameter.index_count_per_instance,
                         command.parameter.draw_indexed_instance_command_parameter.instance_count,
@@ -6209,9 +10484,9 @@ namespace RendererInterface
             }    
         }
         
-        if (pipeline_type == RHIPipelineType::Graphics)
+        if (!prepared_node.keeps_rendering_scope_open)
         {
-            RHIUtilInstanceManager::Instance().EndRendering(command_list);
+            CloseRenderingScope(command_list, inout_rendering_scope_open);
         }
         return RenderPassExecutionStatus::EXECUTED;
     }
@@ -6223,10 +10498,24 @@ namespace RendererInterface
         
         auto& command_queue = m_resource_allocator.GetCommandQueue();
         
-        GLTF_CHECK(RHIUtilInstanceManager::Instance().ExecuteCommandList(command_list, command_queue, context));
+        const auto submit_begin = std::chrono::steady_clock::now();
+        if (m_async_compute_state->pending_graphics_wait)
+        {
+            auto joined_context = context;
+            joined_context.wait_infos.push_back({m_async_compute_state->pending_graphics_wait, RHIPipelineStage::ALL_COMMANDS});
+            m_async_compute_state->pending_graphics_wait = nullptr;
+            GLTF_CHECK(RHIUtilInstanceManager::Instance().ExecuteCommandList(command_list, command_queue, joined_context));
+        }
+        else
+        {
+            GLTF_CHECK(RHIUtilInstanceManager::Instance().ExecuteCommandList(command_list, command_queue, context));
+        }
+        const auto submit_end = std::chrono::steady_clock::now();
+        RecordFrameTraceSpan("submit", "Queue submit", ToTimelineMilliseconds(submit_begin), ToTimelineMilliseconds(submit_end));
         if (wait)
         {
             RHIUtilInstanceManager::Instance().WaitCommandListFinish(command_list);
+            RecordFrameTraceSpan("wait", "Wait command list fence", ToTimelineMilliseconds(submit_end), ToTimelineMilliseconds(std::chrono::steady_clock::now()));
         }
     }
 
@@ -6237,6 +10526,7 @@ namespace RendererInterface
         RHIExecuteCommandListContext context;
         context.wait_infos.push_back({&m_resource_allocator.GetCurrentSwapchain().GetAvailableFrameSemaphore(), RHIPipelineStage::COLOR_ATTACHMENT_OUTPUT});
         context.sign_semaphores.push_back(&command_list.GetSemaphore());
+
         const auto submit_begin = std::chrono::steady_clock::now();
         CloseCurrentCommandListAndExecute(command_list, context, false);
         const auto submit_end = std::chrono::steady_clock::now();
@@ -6249,6 +10539,7 @@ namespace RendererInterface
             command_list);
         const auto present_call_end = std::chrono::steady_clock::now();
         m_current_frame_timing_breakdown.present_call_ms = ToMilliseconds(present_call_begin, present_call_end);
+        RecordFrameTraceSpan("submit", "Present", ToTimelineMilliseconds(present_call_begin), ToTimelineMilliseconds(present_call_end));
         if (!present_succeeded)
         {
             m_resource_allocator.NotifySwapchainPresentFailure();
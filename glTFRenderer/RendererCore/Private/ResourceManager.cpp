@@ -14,6 +14,7 @@
 #include "RHIInterface/IRHIDescriptorManager.h"
 #include "RHIInterface/IRHIRenderTargetManager.h"
 #include "RHIInterface/IRHIRootSignatureHelper.h"
+#include "RHIInterface/IRHISemaphore.h"
 #include "RHIInterface/IRHISwapChain.h"
 #include "RHIInterface/RHIIndexBuffer.h"
 
@@ -79,6 +80,12 @@ namespace
         }
     }
 
+    unsigned ResolveFramesInFlight(const RendererInterface::RenderDeviceDesc& desc)
+    {
+        const unsigned requested_frames = desc.frames_in_flight > 0 ? desc.frames_in_flight : desc.back_buffer_count;
+        return (std::clamp)(requested_frames, RendererInterface::MIN_FRAMES_IN_FLIGHT, RendererInterface::MAX_FRAMES_IN_FLIGHT);
+    }
+
     const char* ToString(RendererInterface::SwapchainLifecycleState state)
     {
         switch (state)
@@ -149,6 +156,21 @@ namespace
         return usage;
     }
 
+    RHITextureDesc BuildRenderTargetTextureDesc(
+        const RendererInterface::RenderTargetDesc& desc,
+        RendererInterface::RenderDeviceType device_type,
+        RHIDataFormat& out_descriptor_format)
+    {
+        out_descriptor_format = RendererInterfaceRHIConverter::ConvertToRHIFormat(desc.format);
+        GLTF_CHECK(out_descriptor_format != RHIDataFormat::UNKNOWN);
+        const bool is_depth_stencil = IsDepthStencilFormat(out_descriptor_format);
+        const RHITextureClearValue clear_value = BuildRenderTargetClearValue(desc, out_descriptor_format, is_depth_stencil);
+        const RHIResourceUsageFlags usage = BuildRenderTargetUsageFlags(desc, is_depth_stencil);
+        const RHIDataFormat resource_format =
+            (is_depth_stencil && device_type == RendererInterface::DX12) ? RHIDataFormat::R32_TYPELESS : out_descriptor_format;
+        return RHITextureDesc(desc.name, desc.width, desc.height, resource_format, usage, clear_value);
+    }
+
     std::shared_ptr<IRHITextureDescriptorAllocation> CreateRenderTargetAllocation(
         IRHIDevice& device,
         IRHIMemoryManager& memory_manager,
@@ -156,14 +178,8 @@ namespace
         const RendererInterface::RenderTargetDesc& desc,
         RendererInterface::RenderDeviceType device_type)
     {
-        const RHIDataFormat descriptor_format = RendererInterfaceRHIConverter::ConvertToRHIFormat(desc.format);
-        GLTF_CHECK(descriptor_format != RHIDataFormat::UNKNOWN);
-        const bool is_depth_stencil = IsDepthStencilFormat(descriptor_format);
-        const RHITextureClearValue clear_value = BuildRenderTargetClearValue(desc, descriptor_format, is_depth_stencil);
-        const RHIResourceUsageFlags usage = BuildRenderTargetUsageFlags(desc, is_depth_stencil);
-        const RHIDataFormat resource_format =
-            (is_depth_stencil && device_type == RendererInterface::DX12) ? RHIDataFormat::R32_TYPELESS : descriptor_format;
-        RHITextureDesc tex_desc(desc.name, desc.width, desc.height, resource_format, usage, clear_value);
+        RHIDataFormat descriptor_format = RHIDataFormat::UNKNOWN;
+        const RHITextureDesc tex_desc = BuildRenderTargetTextureDesc(desc, device_type, descriptor_format);
         return render_target_manager.CreateRenderTarget(device, memory_manager, tex_desc, descriptor_format);
     }
 
@@ -213,6 +229,7 @@ RHIBufferDesc ConvertToRHIBufferDesc(const RendererInterface::BufferDesc& desc)
 bool ResourceManager::InitResourceManager(const RendererInterface::RenderDeviceDesc& desc)
 {
     m_device_desc = desc;
+    m_device_desc.frames_in_flight = ResolveFramesInFlight(desc);
     RHIConfigSingleton::Instance().SetVulkanOptionalFeatureRequirements({
         .require_ray_tracing_pipeline = desc.vulkan_optional_capabilities.require_ray_tracing_pipeline,
         .require_ray_query = desc.vulkan_optional_capabilities.require_ray_query,
@@ -227,7 +244,17 @@ bool ResourceManager::InitResourceManager(const RendererInterface::RenderDeviceD
     EXIT_WHEN_FALSE(m_device->InitDevice(*m_factory))
     
     m_command_queue = RHIResourceFactory::CreateRHIResource<IRHICommandQueue>();
-    EXIT_WHEN_FALSE(m_command_queue->InitCommandQueue(*m_device))
+    EXIT_WHEN_FALSE(m_command_queue->InitCommandQueue(*m_device, RHICommandQueueType::GRAPHICS))
+
+    m_async_compute_command_queue = nullptr;
+    if (RHIUtilInstanceManager::Instance().SupportAsyncCompute(*m_device))
+    {
+        auto async_compute_command_queue = RHIResourceFactory::CreateRHIResource<IRHICommandQueue>();
+        if (async_compute_command_queue->InitCommandQueue(*m_device, RHICommandQueueType::COMPUTE))
+        {
+            m_async_compute_command_queue = std::move(async_compute_command_queue);
+        }
+    }
 
     const auto& render_window = RendererInterface::InternalResourceHandleTable::Instance().GetRenderWindow(desc.window);
     
@@ -247,6 +274,20 @@ bool ResourceManager::InitResourceManager(const RendererInterface::RenderDeviceD
     swap_chain_desc.full_screen = false;
     EXIT_WHEN_FALSE(m_swap_chain->InitSwapChain(*m_factory, *m_device, *m_command_queue, swap_chain_texture_desc, swap_chain_desc ))
 
+    // Vulkan rotates one acquire semaphore per swapchain image. With more frames in flight than images, an
+    // acquire could re-signal a semaphore whose wait from an earlier frame has not executed yet.
+    if (RHIConfigSingleton::Instance().GetGraphicsAPIType() == RHIGraphicsAPIType::RHI_GRAPHICS_API_Vulkan)
+    {
+        const unsigned swap_chain_image_count = m_swap_chain->GetBackBufferCount();
+        if (swap_chain_image_count > 0 && m_device_desc.frames_in_flight > swap_chain_image_count)
+        {
+            LOG_FORMAT_FLUSH("[ResourceManager] Clamping frames in flight from %u to the %u Vulkan swapchain images.\n",
+                             m_device_desc.frames_in_flight,
+                             swap_chain_image_count);
+            m_device_desc.frames_in_flight = swap_chain_image_count;
+        }
+    }
+
     m_memory_manager = RHIResourceFactory::CreateRHIResource<IRHIMemoryManager>();
     EXIT_WHEN_FALSE(m_memory_manager->InitMemoryManager(*m_device, *m_factory,
             {
@@ -255,10 +296,12 @@ bool ResourceManager::InitResourceManager(const RendererInterface::RenderDeviceD
             256
             }))
     
-    m_command_allocators.resize(desc.back_buffer_count);
-    m_command_lists.resize(desc.back_buffer_count);
+    // Frame slots are independent of the swapchain image count; every per-slot resource follows GetFrameSlotCount().
+    const unsigned frames_in_flight = m_device_desc.frames_in_flight;
+    m_command_allocators.resize(frames_in_flight);
+    m_command_lists.resize(frames_in_flight);
     
-    for (size_t i = 0; i < desc.back_buffer_count; ++i)
+    for (size_t i = 0; i < frames_in_flight; ++i)
     {
         m_command_allocators[i] = RHIResourceFactory::CreateRHIResource<IRHICommandAllocator>();
         m_command_allocators[i]->InitCommandAllocator(*m_device, RHICommandAllocatorType::DIRECT);
@@ -298,7 +341,7 @@ bool ResourceManager::InitResourceManager(const RendererInterface::RenderDeviceD
             RHITextureDesc::MakeDepthTextureDesc(render_window.GetWidth(), render_window.GetHeight()), RHIDataFormat::D32_FLOAT);
     }
 
-    m_current_frame_slot_index = desc.back_buffer_count > 0 ? (desc.back_buffer_count - 1) : 0;
+    m_current_frame_slot_index = frames_in_flight - 1;
     
     //m_frame_resource_managers.resize(desc.back_buffer_count);
 
@@ -310,13 +353,13 @@ RendererInterface::BufferHandle ResourceManager::CreateBuffer(const RendererInte
 {
     if (desc.type == RendererInterface::UPLOAD &&
         desc.usage == RendererInterface::USAGE_CBV &&
-        GetBackBufferCount() > 1)
+        GetFrameSlotCount() > 1)
     {
         LOG_FORMAT_FLUSH(
-            "[ResourceManager][Risk] Buffer '%s' is UPLOAD+CBV with %u back buffers. "
-            "Prefer DEFAULT+UploadBufferData or per-backbuffer buffering to avoid cross-frame overwrite hazards.\n",
+            "[ResourceManager][Risk] Buffer '%s' is UPLOAD+CBV with %u frames in flight. "
+            "Prefer DEFAULT+UploadBufferData or per-frame-slot buffering to avoid cross-frame overwrite hazards.\n",
             desc.name.c_str(),
-            GetBackBufferCount());
+            GetFrameSlotCount());
     }
 
     RHIBufferDesc buffer_desc = ConvertToRHIBufferDesc(desc);
@@ -422,6 +465,151 @@ bool ResourceManager::RetireRenderTarget(RendererInterface::RenderTargetHandle h
     m_render_targets.erase(handle);
     m_render_target_descs.erase(handle);
     EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(render_target));
+    ReleasePlacedRenderTarget(handle);
+    return true;
+}
+
+bool ResourceManager::GetRenderTargetPlacementRequirements(RendererInterface::RenderTargetHandle handle,
+    unsigned long long& out_size_bytes, unsigned long long& out_alignment) const
+{
+    // A placed target is initialized by clearing it, which only reaches the top mip.
+    const auto desc_it = m_render_target_descs.find(handle);
+    if (desc_it == m_render_target_descs.end() || desc_it->second.enable_mipmaps || !m_memory_manager)
+    {
+        return false;
+    }
+
+    RHIDataFormat descriptor_format = RHIDataFormat::UNKNOWN;
+    const RHITextureDesc tex_desc = BuildRenderTargetTextureDesc(desc_it->second, m_device_desc.type, descriptor_format);
+    return m_memory_manager->GetTexturePlacementRequirements(*m_device, tex_desc, out_size_bytes, out_alignment);
+}
+
+bool ResourceManager::PlaceTransientRenderTargets(
+    const std::vector<RendererInterface::TransientRenderTargetHeapDesc>& heaps,
+    const std::vector<RendererInterface::TransientRenderTargetPlacement>& placements)
+{
+    // Everything is created before anything is swapped in, so a failed placement leaves the current targets alone.
+    // Textures in flight keep their memory through the deferred release queue, so no GPU wait is needed.
+    std::vector<std::shared_ptr<IRHIHeapAllocation>> new_heaps;
+    std::map<RendererInterface::RenderTargetHandle, std::shared_ptr<IRHITextureAllocation>> new_placed_render_targets;
+    std::map<RendererInterface::RenderTargetHandle, std::shared_ptr<IRHITextureDescriptorAllocation>> new_render_targets;
+    const auto release_created = [&]()
+    {
+        for (const auto& render_target : new_render_targets)
+        {
+            RHIResourceFactory::ReleaseResource(*m_memory_manager, render_target.second);
+        }
+        for (const auto& placed_render_target : new_placed_render_targets)
+        {
+            RHIResourceFactory::ReleaseResource(*m_memory_manager, placed_render_target.second->m_texture);
+            RHIResourceFactory::ReleaseResource(*m_memory_manager, placed_render_target.second);
+        }
+        for (const auto& heap : new_heaps)
+        {
+            RHIResourceFactory::ReleaseResource(*m_memory_manager, heap);
+        }
+    };
+
+    for (const auto& heap : heaps)
+    {
+        std::shared_ptr<IRHIHeapAllocation> heap_allocation;
+        if (!m_memory_manager->AllocateHeapMemory(*m_device, heap.size_bytes, heap.alignment, heap_allocation))
+        {
+            release_created();
+            return false;
+        }
+        new_heaps.push_back(heap_allocation);
+    }
+
+    for (const auto& placement : placements)
+    {
+        const auto desc_it = m_render_target_descs.find(placement.handle);
+        if (desc_it == m_render_target_descs.end() || placement.heap_index >= new_heaps.size() ||
+            new_placed_render_targets.contains(placement.handle))
+        {
+            release_created();
+            return false;
+        }
+
+        RHIDataFormat descriptor_format = RHIDataFormat::UNKNOWN;
+        const RHITextureDesc tex_desc = BuildRenderTargetTextureDesc(desc_it->second, m_device_desc.type, descriptor_format);
+        std::shared_ptr<IRHITextureAllocation> texture_allocation;
+        if (!m_memory_manager->AllocatePlacedTextureMemory(*m_device, new_heaps[placement.heap_index], placement.offset, tex_desc, texture_allocation))
+        {
+            release_created();
+            return false;
+        }
+        new_placed_render_targets[placement.handle] = texture_allocation;
+        new_render_targets[placement.handle] =
+            m_render_target_manager->CreateRenderTargetFromTexture(*m_device, *m_memory_manager, texture_allocation, descriptor_format);
+    }
+
+    // Targets that drop out of the plan go back to committed memory of their own.
+    for (const auto& placed_render_target : m_placed_render_targets)
+    {
+        const auto handle = placed_render_target.first;
+        if (new_render_targets.contains(handle))
+        {
+            continue;
+        }
+        new_render_targets[handle] = CreateRenderTargetAllocation(
+            *m_device, *m_memory_manager, *m_render_target_manager, m_render_target_descs.at(handle), m_device_desc.type);
+    }
+
+    for (const auto& render_target : new_render_targets)
+    {
+        const auto handle = render_target.first;
+        const auto old_render_target = m_render_targets[handle];
+        m_render_targets[handle] = render_target.second;
+        const bool updated = RendererInterface::InternalResourceHandleTable::Instance().UpdateRenderTarget(handle, render_target.second);
+        GLTF_CHECK(updated);
+        if (old_render_target)
+        {
+            EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(old_render_target));
+        }
+        ReleasePlacedRenderTarget(handle);
+    }
+
+    for (const auto& heap : m_transient_heaps)
+    {
+        EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(heap));
+    }
+    m_transient_heaps = std::move(new_heaps);
+    m_placed_render_targets = std::move(new_placed_render_targets);
+    
+    return true;
+}
+
+bool ResourceManager::IsRenderTargetPlaced(RendererInterface::RenderTargetHandle handle) const
+{
+    return m_placed_render_targets.contains(handle);
+}
+
+void ResourceManager::ReleasePlacedRenderTarget(RendererInterface::RenderTargetHandle handle)
+{
+    const auto placed_it = m_placed_render_targets.find(handle);
+    if (placed_it == m_placed_render_targets.end())
+    {
+        return;
+    }
+
+    // The descriptor is released by the caller; the texture goes before the allocation that backs it. The heap
+    // stays with m_transient_heaps until the next placement retires it.
+    const auto& texture_allocation = placed_it->second;
+    EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(texture_allocation->m_texture));
+    EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(texture_allocation));
+    m_placed_render_targets.erase(placed_it);
+}
+
+bool ResourceManager::GetRenderTargetDesc(RendererInterface::RenderTargetHandle handle, RendererInterface::RenderTargetDesc& out_desc) const
+{
+    const auto desc_it = m_render_target_descs.find(handle);
+    if (desc_it == m_render_target_descs.end())
+    {
+        return false;
+    }
+
+    out_desc = desc_it->second;
     return true;
 }
 
@@ -449,7 +637,7 @@ unsigned ResourceManager::GetFrameSlotCount() const
         return static_cast<unsigned>(frame_slot_count);
     }
 
-    return (std::max)(1u, m_device_desc.back_buffer_count);
+    return (std::max)(1u, m_device_desc.frames_in_flight);
 }
 
 unsigned ResourceManager::GetSwapchainImageCount() const
@@ -537,6 +725,21 @@ void ResourceManager::WaitFrameRenderFinished()
     RHIUtilInstanceManager::Instance().ResetCommandAllocator(command_allocator);
 }
 
+void ResourceManager::WaitPreviousFramePresented(const RendererInterface::FrameContextSnapshot& frame_context)
+{
+    // With a single slot the frame-start wait already covered the previous frame.
+    const unsigned frame_slot_count = GetFrameSlotCount();
+    if (frame_slot_count > 1)
+    {
+        const unsigned previous_frame_slot = (frame_context.frame_slot_index + frame_slot_count - 1) % frame_slot_count;
+        RHIUtilInstanceManager::Instance().WaitCommandListFinish(*m_command_lists[previous_frame_slot]);
+    }
+    if (m_swap_chain && m_device)
+    {
+        m_swap_chain->HostWaitPresentFinished(*m_device);
+    }
+}
+
 void ResourceManager::WaitGPUIdle()
 {
     for (const auto& command_list : m_command_lists)
@@ -550,6 +753,20 @@ void ResourceManager::WaitGPUIdle()
             RHIUtilInstanceManager::Instance().WaitCommandListFinish(*command_list);
         }
     }
+    for (const auto* command_context_pool : {&m_parallel_record_command_contexts, &m_async_compute_command_contexts})
+    {
+        for (const auto& frame_slot_contexts : *command_context_pool)
+        {
+            for (const auto& context : frame_slot_contexts)
+            {
+                if (context.command_list->GetState() == RHICommandListState::Recording)
+                {
+                    RHIUtilInstanceManager::Instance().CloseCommandList(*context.command_list);
+                }
+                RHIUtilInstanceManager::Instance().WaitCommandListFinish(*context.command_list);
+            }
+        }
+    }
     if (m_swap_chain && m_device)
     {
         m_swap_chain->HostWaitPresentFinished(*m_device);
@@ -559,6 +776,11 @@ void ResourceManager::WaitGPUIdle()
         const bool queue_idle = RHIUtilInstanceManager::Instance().WaitCommandQueueIdle(*m_command_queue);
         GLTF_CHECK(queue_idle);
     }
+    if (m_async_compute_command_queue)
+    {
+        const bool queue_idle = RHIUtilInstanceManager::Instance().WaitCommandQueueIdle(*m_async_compute_command_queue);
+        GLTF_CHECK(queue_idle);
+    }
     if (m_device)
     {
         const bool device_idle = RHIUtilInstanceManager::Instance().WaitDeviceIdle(*m_device);
@@ -798,11 +1020,94 @@ IRHICommandList& ResourceManager::GetCommandListForRecordPassCommand(
     return command_list;
 }
 
+IRHICommandList& ResourceManager::AcquireParallelRecordCommandList(
+    const RendererInterface::FrameContextSnapshot& frame_context,
+    unsigned index)
+{
+    return AcquirePooledCommandList(m_parallel_record_command_contexts, frame_context, index, RHICommandAllocatorType::DIRECT);
+}
+
+IRHICommandList& ResourceManager::AcquireAsyncComputeCommandList(
+    const RendererInterface::FrameContextSnapshot& frame_context,
+    unsigned index)
+{
+    GLTF_CHECK(m_async_compute_command_queue);
+    return AcquirePooledCommandList(m_async_compute_command_contexts, frame_context, index, RHICommandAllocatorType::COMPUTE);
+}
+
+IRHISemaphore& ResourceManager::AcquireQueueSyncSemaphore(
+    const RendererInterface::FrameContextSnapshot& frame_context,
+    unsigned index)
+{
+    if (m_queue_sync_semaphores.size() < GetFrameSlotCount())
+    {
+        m_queue_sync_semaphores.resize(GetFrameSlotCount());
+    }
+
+    // Reuse is safe once the frame slot has been waited on: the frame-end join makes the graphics fence cover
+    // every compute submission of the frame.
+    auto& frame_slot_semaphores = m_queue_sync_semaphores[frame_context.frame_slot_index];
+    while (frame_slot_semaphores.size() <= index)
+    {
+        auto semaphore = RHIResourceFactory::CreateRHIResource<IRHISemaphore>();
+        const bool initialized = semaphore->InitSemaphore(*m_device);
+        GLTF_CHECK(initialized);
+        frame_slot_semaphores.push_back(std::move(semaphore));
+    }
+    return *frame_slot_semaphores[index];
+}
+
+IRHICommandList& ResourceManager::AcquirePooledCommandList(
+    std::vector<std::vector<ParallelRecordCommandContext>>& pool,
+    const RendererInterface::FrameContextSnapshot& frame_context,
+    unsigned index,
+    RHICommandAllocatorType type)
+{
+    if (pool.size() < GetFrameSlotCount())
+    {
+        pool.resize(GetFrameSlotCount());
+    }
+
+    auto& frame_slot_contexts = pool[frame_context.frame_slot_index];
+    while (frame_slot_contexts.size() <= index)
+    {
+        ParallelRecordCommandContext context{};
+        context.command_allocator = RHIResourceFactory::CreateRHIResource<IRHICommandAllocator>();
+        context.command_allocator->InitCommandAllocator(*m_device, type);
+        context.command_list = RHIResourceFactory::CreateRHIResource<IRHICommandList>();
+        context.command_list->InitCommandList(*m_device, *context.command_allocator);
+        frame_slot_contexts.push_back(std::move(context));
+    }
+
+    auto& context = frame_slot_contexts[index];
+    auto& command_list = *context.command_list;
+    GLTF_CHECK(command_list.GetState() == RHICommandListState::Closed);
+
+    // Same frame slot as last use, so this normally returns immediately.
+    RHIUtilInstanceManager::Instance().WaitCommandListFinish(command_list);
+    RHIUtilInstanceManager::Instance().ResetCommandAllocator(*context.command_allocator);
+    const bool reset_command_list = RHIUtilInstanceManager::Instance().ResetCommandList(command_list, *context.command_allocator, nullptr);
+    GLTF_CHECK(reset_command_list);
+    command_list.SetFrameSlotIndex(frame_context.frame_slot_index);
+    return command_list;
+}
+
 IRHICommandQueue& ResourceManager::GetCommandQueue()
 {
     return *m_command_queue;
 }
 
+bool ResourceManager::SupportsAsyncCompute() const
+{
+    return m_async_compute_command_queue != nullptr;
+}
+
+IRHICommandQueue& ResourceManager::GetAsyncComputeCommandQueue()
+{
+    GLTF_CHECK(m_async_compute_command_queue);
+    return *m_async_compute_command_queue;
+}
+
 IRHITextureDescriptorAllocation& ResourceManager::GetCurrentSwapchainRT()
 {
     return GetCurrentSwapchainRT(GetFrameContext());
@@ -869,3 +1174,13 @@ void ResourceManager::SetSwapchainPresentMode(RendererInterface::SwapchainPresen
     SetSwapchainLifecycleState(RendererInterface::SwapchainLifecycleState::RESIZE_PENDING, "swapchain present mode changed");
 }
 
+RendererInterface::FrameLatencyMode ResourceManager::GetFrameLatencyMode() const
+{
+    return m_device_desc.frame_latency_mode;
+}
+
+void ResourceManager::SetFrameLatencyMode(RendererInterface::FrameLatencyMode mode)
+{
+    m_device_desc.frame_latency_mode = mode;
+}
+
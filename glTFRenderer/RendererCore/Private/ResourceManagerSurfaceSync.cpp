@@ -392,6 +392,8 @@ bool ResourceManagerSurfaceResourceRebuilder::ResizeWindowDependentRenderTargets
         {
             manager.EnqueueResourceForDeferredRelease(std::static_pointer_cast<IRHIResource>(old_allocation));
         }
+        // A resized transient target leaves its heap; the render graph places it again at the new size.
+        manager.ReleasePlacedRenderTarget(handle);
 
         LOG_FORMAT_FLUSH("[ResourceManager] Resized RT '%s' to %ux%u\n",
             resized_desc.name.c_str(),
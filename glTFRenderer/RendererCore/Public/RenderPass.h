@@ -29,10 +29,13 @@ public:
     RendererInterface::RenderPassType GetRenderPassType() const;
     RendererInterface::PrimitiveTopology GetPrimitiveTopology() const;
 
-    const RootSignatureAllocation& GetRootSignatureAllocation(const std::string& name) const;
-    const std::vector<RootSignatureAllocation>& GetRootSignatureAllocations(const std::string& name) const;
-    const RootSignatureAllocation* FindRootSignatureAllocation(const std::string& name) const;
-    bool HasRootSignatureAllocation(const std::string& name) const;
+    // Names convert implicitly from strings; binding resolution passes the interned keys of the draw desc.
+    const RootSignatureAllocation& GetRootSignatureAllocation(RendererInterface::BindingName name) const;
+    const std::vector<RootSignatureAllocation>& GetRootSignatureAllocations(RendererInterface::BindingName name) const;
+    const RootSignatureAllocation* FindRootSignatureAllocation(RendererInterface::BindingName name) const;
+    // nullptr when the shaders do not declare the name, otherwise a non-empty list.
+    const std::vector<RootSignatureAllocation>* FindRootSignatureAllocations(RendererInterface::BindingName name) const;
+    bool HasRootSignatureAllocation(RendererInterface::BindingName name) const;
     DrawValidationResult ValidateDrawDesc(const RendererInterface::RenderPassDrawDesc& draw_desc) const;
 
     IRHIDescriptorUpdater& GetDescriptorUpdater();
@@ -54,7 +57,8 @@ protected:
     std::shared_ptr<IRHIDescriptorUpdater> m_descriptor_updater;
     std::shared_ptr<IRHIPipelineStateObject> m_pipeline_state_object;
 
-    std::map<std::string, std::vector<RootSignatureAllocation>> m_shader_parameter_mapping;
+    // Indexed by BindingName id; sized to the highest id the shaders declare.
+    std::vector<std::vector<RootSignatureAllocation>> m_shader_parameter_mapping;
 
     int m_viewport_width{-1};
     int m_viewport_height{-1};
@@ -10,6 +10,8 @@
 
 #include <Windows.h>
 
+#include "RendererBindingName.h"
+
 namespace RendererInterface
 {
     struct NullHandle_t
@@ -141,6 +143,20 @@ namespace RendererInterface
         unsigned min_width{1};
         unsigned min_height{1};
     };
+
+    // Device memory shared by transient render targets whose lifetimes do not overlap.
+    struct TransientRenderTargetHeapDesc
+    {
+        unsigned long long size_bytes{0};
+        unsigned long long alignment{0};
+    };
+
+    struct TransientRenderTargetPlacement
+    {
+        RenderTargetHandle handle{NULL_HANDLE};
+        unsigned heap_index{0};
+        unsigned long long offset{0};
+    };
     
     struct TextureMipLevelDesc
     {
@@ -199,6 +215,14 @@ namespace RendererInterface
         RAY_TRACING,
     };
 
+    // Queue a pass would like to run on. ASYNC_COMPUTE is a request: passes that are not compute passes
+    // stay on the graphics queue.
+    enum class RenderPassQueueAffinity
+    {
+        GRAPHICS,
+        ASYNC_COMPUTE,
+    };
+
     enum class RenderPassResourceAccessMode
     {
         READ_ONLY,
@@ -315,6 +339,8 @@ namespace RendererInterface
     {
         DX12,
         VULKAN,
+        // No GPU work is submitted; commands are recorded and validated on the CPU.
+        NULL_RHI,
     };
 
     enum class SwapchainPresentMode
@@ -323,6 +349,19 @@ namespace RendererInterface
         MAILBOX = 1,
     };
 
+    // Frames the CPU may record ahead of the GPU.
+    constexpr unsigned MIN_FRAMES_IN_FLIGHT = 1;
+    constexpr unsigned MAX_FRAMES_IN_FLIGHT = 4;
+
+    enum class FrameLatencyMode
+    {
+        // Record up to frames_in_flight frames ahead of the GPU; favours batch rendering.
+        THROUGHPUT = 0,
+        // Keep at most one frame queued: each frame waits for the previous present before its tick samples
+        // input and simulates, so that input reaches the screen sooner.
+        LOW_LATENCY = 1,
+    };
+
     struct VulkanOptionalCapabilities
     {
         bool require_ray_tracing_pipeline{false};
@@ -359,6 +398,10 @@ namespace RendererInterface
         RenderDeviceType type;
         RenderWindowHandle window;
         unsigned back_buffer_count;
+        // Frame slots for command allocators, frame-buffered resources and deferred release, clamped to
+        // [MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT]; 0 follows back_buffer_count.
+        unsigned frames_in_flight{0};
+        FrameLatencyMode frame_latency_mode{FrameLatencyMode::THROUGHPUT};
         SwapchainResizePolicy swapchain_resize_policy{};
         SwapchainPresentMode swapchain_present_mode{SwapchainPresentMode::VSYNC};
         VulkanOptionalCapabilities vulkan_optional_capabilities{};
@@ -511,6 +554,10 @@ namespace RendererInterface
         std::vector<TextureHandle> textures;
         
         TextureBindingType type;
+
+        // Binds the shared bindless texture table instead of a table over textures, which then only lists
+        // what the pass reads. Shaders index it with ResourceOperator::GetBindlessTextureIndex. SRV only.
+        bool bindless_table {false};
     };
 
     struct RenderTargetTextureBindingDesc
@@ -530,9 +577,19 @@ namespace RendererInterface
     {
         std::vector<RenderExecuteCommand> execute_commands;
         std::map<RenderTargetHandle, RenderTargetBindingDesc> render_target_resources;
-        std::map<std::string, BufferBindingDesc> buffer_resources;
-        std::map<std::string, TextureBindingDesc> texture_resources;
-        std::map<std::string, RenderTargetTextureBindingDesc> render_target_texture_resources;
+        BindingNameMap<BufferBindingDesc> buffer_resources;
+        BindingNameMap<TextureBindingDesc> texture_resources;
+        BindingNameMap<RenderTargetTextureBindingDesc> render_target_texture_resources;
+    };
+
+    // Pixel rect inside the bound render targets, e.g. a tile of a shadow atlas.
+    // Negative width/height fall back to the render pass viewport size.
+    struct RenderViewportRect
+    {
+        int offset_x{0};
+        int offset_y{0};
+        int width{-1};
+        int height{-1};
     };
 
     struct RenderGraphNodeDesc
@@ -540,6 +597,8 @@ namespace RendererInterface
         RenderPassHandle render_pass_handle;
         RenderStateDesc render_state{};
         RenderPassDrawDesc draw_info;
+        RenderViewportRect viewport_rect{};
+        RenderPassQueueAffinity queue_affinity{RenderPassQueueAffinity::GRAPHICS};
 
         std::vector<RenderGraphNodeHandle> dependency_render_graph_nodes;
 
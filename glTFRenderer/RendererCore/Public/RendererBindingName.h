@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace RendererInterface
+{
+    // Shader binding name interned into a process-wide table. Binding maps key on the small integer id and
+    // render passes index their root signature allocations by it, so per-frame binding resolution compares
+    // integers instead of hashing or comparing strings. Implicitly constructible from the name, which keeps
+    // string-keyed call sites such as draw_desc.buffer_resources["ViewConstants"] working; that construction
+    // takes the table lock, so resolve names once at setup rather than per frame where it matters.
+    class BindingName
+    {
+    public:
+        static constexpr unsigned INVALID_ID = 0xffffffffu;
+
+        BindingName() = default;
+        BindingName(const std::string& name);
+        BindingName(const char* name);
+
+        unsigned GetId() const { return m_id; }
+        bool IsValid() const { return m_id != INVALID_ID; }
+        // Empty for the default-constructed name.
+        const std::string& GetString() const;
+
+        // Number of distinct names interned so far; ids are below it.
+        static unsigned GetInternedCount();
+
+        friend bool operator==(BindingName lhs, BindingName rhs) { return lhs.m_id == rhs.m_id; }
+        friend bool operator!=(BindingName lhs, BindingName rhs) { return lhs.m_id != rhs.m_id; }
+        // Interning order, not alphabetical.
+        friend bool operator<(BindingName lhs, BindingName rhs) { return lhs.m_id < rhs.m_id; }
+
+    private:
+        unsigned m_id{INVALID_ID};
+    };
+
+    // Per-node binding table: a flat vector of (name, value) kept sorted by binding id. A pass binds a
+    // handful of names, so a binary search over ids beats walking map nodes, and iteration order matches
+    // std::map<BindingName, T>. Mirrors the std::map subset the renderer uses; inserting or erasing
+    // invalidates iterators and references, unlike std::map.
+    template <typename T>
+    class BindingNameMap
+    {
+    public:
+        using value_type = std::pair<BindingName, T>;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        BindingNameMap() = default;
+        BindingNameMap(std::initializer_list<value_type> entries)
+        {
+            insert(entries.begin(), entries.end());
+        }
+
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+        size_t size() const { return m_entries.size(); }
+        bool empty() const { return m_entries.empty(); }
+        void clear() { m_entries.clear(); }
+
+        iterator find(BindingName name)
+        {
+            const auto it = LowerBound(name);
+            return it != m_entries.end() && it->first == name ? it : m_entries.end();
+        }
+
+        const_iterator find(BindingName name) const
+        {
+            return const_cast<BindingNameMap*>(this)->find(name);
+        }
+
+        bool contains(BindingName name) const { return find(name) != end(); }
+
+        T& operator[](BindingName name)
+        {
+            return insert(value_type{name, T{}}).first->second;
+        }
+
+        // Keeps the existing value when the name is already present, like std::map::insert.
+        std::pair<iterator, bool> insert(const value_type& entry)
+        {
+            const auto it = LowerBound(entry.first);
+            if (it != m_entries.end() && it->first == entry.first)
+            {
+                return {it, false};
+            }
+            return {m_entries.insert(it, entry), true};
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(value_type{first->first, first->second});
+            }
+        }
+
+        iterator erase(const_iterator it) { return m_entries.erase(it); }
+
+        size_t erase(BindingName name)
+        {
+            const auto it = find(name);
+            if (it == m_entries.end())
+            {
+                return 0;
+            }
+            m_entries.erase(it);
+            return 1;
+        }
+
+    private:
+        iterator LowerBound(BindingName name)
+        {
+            return std::lower_bound(m_entries.begin(), m_entries.end(), name,
+                [](const value_type& entry, BindingName key) { return entry.first < key; });
+        }
+
+        std::vector<value_type> m_entries;
+    };
+}
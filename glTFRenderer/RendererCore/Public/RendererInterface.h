@@ -27,10 +27,22 @@ class IRHIMemoryManager;
 class IRHIResource;
 class IRHICommandList;
 class IRHICommandQueue;
+class IRHISemaphore;
 class RenderPass;
 class ResourceManager;
 struct RHIExecuteCommandListContext;
 
+namespace RenderGraphBindingState
+{
+    class Tracker;
+    struct Counters;
+}
+
+namespace RenderGraphParallelRecording
+{
+    struct Segment;
+}
+
 namespace RendererInterface
 {
     class RenderGraph;
@@ -100,6 +112,8 @@ namespace RendererInterface
         ShaderHandle        CreateShader(const ShaderDesc& desc);
         TextureHandle       CreateTexture(const TextureDesc& desc);
         TextureHandle       CreateTexture(const TextureFileDesc& desc);
+        // Stable index of the texture in the bindless texture table, registering it on first use.
+        unsigned            GetBindlessTextureIndex(TextureHandle handle);
         BufferHandle        CreateBuffer(const BufferDesc& desc);
         IndexedBufferHandle CreateIndexedBuffer(const BufferDesc& desc);
         bool                RetireBuffer(BufferHandle handle);
@@ -111,6 +125,12 @@ namespace RendererInterface
         
         RenderTargetHandle  CreateRenderTarget(const RenderTargetDesc& desc);
         bool                RetireRenderTarget(RenderTargetHandle handle);
+        bool                GetRenderTargetDesc(RenderTargetHandle handle, RenderTargetDesc& out_desc) const;
+        // False for render targets that cannot share transient heap memory, including frame-buffered ones,
+        // whose contents outlive the frame that wrote them.
+        bool                GetRenderTargetPlacementRequirements(RenderTargetHandle handle, unsigned long long& out_size_bytes, unsigned long long& out_alignment) const;
+        bool                PlaceTransientRenderTargets(const std::vector<TransientRenderTargetHeapDesc>& heaps, const std::vector<TransientRenderTargetPlacement>& placements);
+        bool                IsRenderTargetPlaced(RenderTargetHandle handle) const;
         std::vector<RenderTargetHandle> CreateFrameBufferedRenderTargets(const RenderTargetDesc& desc, const std::string& debug_name_prefix = "");
         bool                RetireFrameBufferedRenderTargets(const std::vector<RenderTargetHandle>& render_targets);
         RenderTargetHandle  GetFrameBufferedRenderTargetHandle(const std::vector<RenderTargetHandle>& render_targets) const;
@@ -160,6 +180,11 @@ namespace RendererInterface
         unsigned            GetCurrentRenderHeight() const;
         IRHICommandList&    GetCommandListForRecordPassCommand(RenderPassHandle pass = NULL_HANDLE) const;
         IRHICommandList&    GetCommandListForRecordPassCommand(const FrameContextSnapshot& frame_context, RenderPassHandle pass = NULL_HANDLE) const;
+        IRHICommandList&    AcquireParallelRecordCommandList(const FrameContextSnapshot& frame_context, unsigned index) const;
+        bool                SupportsAsyncCompute() const;
+        IRHICommandQueue&   GetAsyncComputeCommandQueue() const;
+        IRHICommandList&    AcquireAsyncComputeCommandList(const FrameContextSnapshot& frame_context, unsigned index) const;
+        IRHISemaphore&      AcquireQueueSyncSemaphore(const FrameContextSnapshot& frame_context, unsigned index) const;
         IRHIDescriptorManager& GetDescriptorManager() const;
         IRHIMemoryManager&  GetMemoryManager() const;
         
@@ -183,6 +208,9 @@ namespace RendererInterface
         void SetSwapchainResizePolicy(const SwapchainResizePolicy& policy, bool reset_retry_state = true);
         SwapchainPresentMode GetSwapchainPresentMode() const;
         void SetSwapchainPresentMode(SwapchainPresentMode mode);
+        FrameLatencyMode GetFrameLatencyMode() const;
+        void SetFrameLatencyMode(FrameLatencyMode mode);
+        void WaitPreviousFramePresented(const FrameContextSnapshot& frame_context);
         void ApplyFrameBufferedRenderTargetAliases();
         bool CleanupAllResources(bool clear_window_handles = false);
         
@@ -192,6 +220,9 @@ namespace RendererInterface
         bool m_per_frame_resource_binding_enabled{true};
         std::map<RenderTargetHandle, std::vector<RenderTargetHandle>> m_frame_buffered_render_target_aliases;
         std::map<RenderTargetHandle, RenderTargetHandle> m_frame_buffered_render_target_alias_current;
+        std::set<RenderTargetHandle> m_frame_buffered_render_targets;
+        // Views kept alive for the bindless texture table, keyed by texture.
+        std::map<TextureHandle, std::pair<unsigned, std::shared_ptr<IRHITextureDescriptorAllocation>>> m_bindless_textures;
 
         bool TryRetireTrackedRenderTargetAlias(RenderTargetHandle handle);
     };
@@ -229,17 +260,18 @@ namespace RendererInterface
             std::vector<ShaderSetupInfo> shader_setup_infos;
             std::map<RenderTargetHandle, RenderTargetBindingDesc> render_targets;
             std::vector<RenderTargetTextureBindingDesc> sampled_render_targets;
-            std::map<std::string, BufferBindingDesc> buffer_resources;
-            std::map<std::string, TextureBindingDesc> texture_resources;
-            std::set<std::string> excluded_buffer_bindings;
-            std::set<std::string> excluded_texture_bindings;
-            std::set<std::string> excluded_render_target_texture_bindings;
+            BindingNameMap<BufferBindingDesc> buffer_resources;
+            BindingNameMap<TextureBindingDesc> texture_resources;
+            std::set<BindingName> excluded_buffer_bindings;
+            std::set<BindingName> excluded_texture_bindings;
+            std::set<BindingName> excluded_render_target_texture_bindings;
             std::vector<std::shared_ptr<RendererModuleBase>> modules;
 
             std::vector<RenderExecuteCommand> execute_commands;
             std::optional<RenderExecuteCommand> execute_command;
 
             RenderStateDesc render_state{};
+            RenderPassQueueAffinity queue_affinity{RenderPassQueueAffinity::GRAPHICS};
             std::vector<RenderGraphNodeHandle> dependency_render_graph_nodes;
             std::function<void(unsigned long long)> pre_render_callback;
             std::string debug_group;
@@ -260,6 +292,20 @@ namespace RendererInterface
             float cpu_time_ms{0.0f};
             bool gpu_time_valid{false};
             float gpu_time_ms{0.0f};
+            // Command list segment the pass was recorded into, 0 when recording serially.
+            unsigned recording_segment_index{0};
+            // Recording span in milliseconds on the std::chrono::steady_clock timeline. With parallel recording
+            // this is the worker part; the pass was prepared on the render thread beforehand.
+            double cpu_begin_ms{0.0};
+            double cpu_end_ms{0.0};
+            // Not recorded because none of its writes reach an output, see DeadPassCullingPolicy.
+            bool culled{false};
+            // Submitted on the async compute queue. The graphics passes it may run concurrently with lie in
+            // pass_stats[first_overlapped_pass_index..last_overlapped_pass_index]; both 0 without overlap.
+            bool async_compute{false};
+            unsigned first_overlapped_pass_index{0};
+            unsigned last_overlapped_pass_index{0};
+            unsigned overlapped_graphics_pass_count{0};
         };
 
         struct FrameStats
@@ -282,7 +328,21 @@ namespace RendererInterface
             unsigned executed_graphics_pass_count{0};
             unsigned executed_compute_pass_count{0};
             unsigned executed_ray_tracing_pass_count{0};
+            unsigned recording_segment_count{1};
+            unsigned culled_pass_count{0};
+            // Passes submitted on the async compute queue, and the graphics passes at least one of them overlaps.
+            unsigned async_compute_pass_count{0};
+            unsigned async_overlapped_graphics_pass_count{0};
+            // Passes whose draw desc was validated this frame, and passes that reused a cached result.
+            unsigned draw_validation_count{0};
+            unsigned draw_validation_cache_hit_count{0};
+            // Pipeline, root signature, root argument, viewport, descriptor heap and index buffer calls
+            // recorded by the passes, and the ones dropped because the command list already had them bound.
+            unsigned binding_call_count{0};
+            unsigned redundant_binding_skip_count{0};
             std::vector<RenderPassFrameStats> pass_stats;
+            // Registered passes left out of the execution order; not part of the counts above.
+            std::vector<RenderPassFrameStats> culled_pass_stats;
         };
 
         struct FrameTimingBreakdown
@@ -313,6 +373,8 @@ namespace RendererInterface
             float render_debug_ui_ms{0.0f};
             float present_ms{0.0f};
             float submit_command_list_ms{0.0f};
+            // Low-latency mode only: blocking on the previous present before submitting this frame.
+            float wait_previous_present_ms{0.0f};
             float present_call_ms{0.0f};
             float frame_wait_total_ms{0.0f};
             float non_pass_cpu_ms{0.0f};
@@ -366,11 +428,203 @@ namespace RendererInterface
             std::size_t cached_execution_order_size{0};
         };
 
+        // Memory of the render targets the execution order touches when those alive only within the frame are
+        // placed into shared heaps by lifetime, see TransientAliasingPolicy.
+        struct TransientAliasingDiagnostics
+        {
+            bool valid{false};
+            // The transient render targets are placed; false while the policy is off or placement failed.
+            bool placed{false};
+            unsigned transient_resource_count{0};
+            unsigned persistent_resource_count{0};
+            unsigned heap_count{0};
+            unsigned aliasing_barrier_count{0};
+            unsigned long long committed_bytes{0};
+            unsigned long long aliased_heap_bytes{0};
+        };
+
+        // Barriers of the last executed frame. Planned counts cover the whole execution order; recorded
+        // counts exclude transitions that were elided because the resource already was in the state.
+        struct BarrierPlanDiagnostics
+        {
+            bool valid{false};
+            unsigned planned_full_barrier_count{0};
+            unsigned planned_split_barrier_count{0};
+            unsigned conflicting_request_count{0};
+            unsigned recorded_batch_count{0};
+            unsigned recorded_barrier_count{0};
+            unsigned recorded_split_barrier_count{0};
+            unsigned recorded_aliasing_barrier_count{0};
+            unsigned elided_barrier_count{0};
+        };
+
+        // Rendering scopes of the current execution order, see RenderGraphAttachmentOps. Passes merged into a
+        // group record inside the BeginRendering/EndRendering scope opened by the first pass of the group.
+        struct RenderPassMergeDiagnostics
+        {
+            bool valid{false};
+            unsigned attachment_pass_count{0};
+            unsigned merged_group_count{0};
+            unsigned merged_pass_count{0};
+            unsigned elided_load_count{0};
+            unsigned elided_store_count{0};
+        };
+
+        struct ExecutionPlanCacheDiagnostics
+        {
+            unsigned cached_plan_count{0};
+            unsigned long long hit_count{0};
+            unsigned long long miss_count{0};
+            float last_build_ms{0.0f};
+        };
+
+        // Timings of BenchmarkExecutionPlanning, averaged over its iterations.
+        struct ExecutionPlanningBenchmarkResult
+        {
+            unsigned pass_count{0};
+            unsigned iteration_count{0};
+            unsigned edge_count{0};
+            bool sorted{false};
+            float full_plan_ms{0.0f};
+            float cached_lookup_ms{0.0f};
+        };
+
+        // Queue schedule for the current execution order, see RenderGraphQueueScheduler. Async passes are only
+        // submitted on a compute queue while AsyncComputePolicy allows it; otherwise the schedule describes the
+        // overlap async compute would allow.
+        struct AsyncComputeScheduleDiagnostics
+        {
+            bool valid{false};
+            unsigned requested_pass_count{0};
+            unsigned async_pass_count{0};
+            unsigned demoted_pass_count{0};
+            unsigned sync_point_count{0};
+            unsigned elided_wait_count{0};
+            // Sum over async passes of the graphics passes each one may overlap.
+            unsigned overlapped_graphics_pass_count{0};
+            // Async passes and queue sync semaphores of the last frame submitted with async compute.
+            unsigned submitted_async_pass_count{0};
+            unsigned submitted_sync_count{0};
+        };
+
+        // Frame trace requested through RequestFrameTrace; the file is written once the GPU timings of the last
+        // captured frame have been resolved.
+        struct FrameTraceStatus
+        {
+            bool capturing{false};
+            unsigned requested_frame_count{0};
+            unsigned resolved_frame_count{0};
+            std::string last_path;
+            bool last_write_succeeded{false};
+        };
+
+        // Planner run over a snapshot written by RequestExecutionPlanningSnapshot. Timings are averaged over
+        // the iterations; report holds the sorted order, barrier plan and queue schedule as text. The final
+        // barrier plan is also recorded once into a null RHI command list, see null_rhi_*.
+        struct ExecutionPlanningReplayResult
+        {
+            bool loaded{false};
+            bool sorted{false};
+            unsigned pass_count{0};
+            unsigned edge_count{0};
+            unsigned culled_pass_count{0};
+            unsigned iteration_count{0};
+            float signature_ms{0.0f};
+            float plan_ms{0.0f};
+            float sort_ms{0.0f};
+            float cull_ms{0.0f};
+            float barrier_plan_ms{0.0f};
+            float aliasing_plan_ms{0.0f};
+            float queue_schedule_ms{0.0f};
+            float render_pass_merge_ms{0.0f};
+            unsigned planned_full_barrier_count{0};
+            unsigned planned_split_barrier_count{0};
+            TransientAliasingDiagnostics transient_aliasing{};
+            AsyncComputeScheduleDiagnostics async_compute_schedule{};
+            RenderPassMergeDiagnostics render_pass_merge{};
+            bool null_rhi_recorded{false};
+            BarrierPlanDiagnostics null_rhi_barriers{};
+            unsigned null_rhi_texture_barrier_count{0};
+            unsigned null_rhi_buffer_barrier_count{0};
+            unsigned null_rhi_aliasing_barrier_count{0};
+            // Barriers whose before state did not match what the null backend last recorded for the resource.
+            unsigned long long null_rhi_validation_error_count{0};
+            std::string report;
+        };
+
+        // How draw desc validation results are reused across frames. Validation only looks at command types,
+        // bound handles, binding names and types and the render pass, so a structural key of those stands in
+        // for the result.
+        enum class DrawValidationCacheMode
+        {
+            // Validate every pass every frame.
+            DISABLED,
+            // Revalidate a pass when its key differs from the one it was last validated with.
+            REVALIDATE_ON_CHANGE,
+            // Keep the result of every key seen, so each unique configuration is validated once even when a pass
+            // alternates between configurations, e.g. ping-ponged history targets.
+            ONCE_PER_CONFIGURATION,
+        };
+
         struct ValidationPolicy
         {
             unsigned log_interval_frames{120};
             unsigned cross_frame_hazard_check_interval_frames{8};
             bool skip_execution_on_warning{false};
+#ifdef NDEBUG
+            DrawValidationCacheMode draw_validation_cache_mode{DrawValidationCacheMode::ONCE_PER_CONFIGURATION};
+#else
+            DrawValidationCacheMode draw_validation_cache_mode{DrawValidationCacheMode::REVALIDATE_ON_CHANGE};
+#endif
+        };
+
+        // Skips passes whose writes cannot reach an output: a registered output sink, the color output, or
+        // a resource read no later than its first write in the frame, whose contents carry across frames.
+        // Passes without tracked writes are always kept.
+        struct DeadPassCullingPolicy
+        {
+            bool enable{true};
+        };
+
+        // Attachment ops of raster passes. Stores that no later pass and no later frame observe become
+        // DONT_CARE, and consecutive passes over the same attachments that continue from their contents are
+        // merged into one rendering scope. Declared CLEAR and DONT_CARE ops are always kept.
+        struct RenderPassMergePolicy
+        {
+            bool infer_store_ops{true};
+            bool merge_passes{true};
+        };
+
+        // Places render targets that no pass reads before clearing them, and that are no output, into shared
+        // heaps so that targets with disjoint lifetimes in the execution order use the same memory. Each target
+        // is activated with an aliasing barrier before its first pass. Frame-buffered targets are never placed.
+        struct TransientAliasingPolicy
+        {
+            bool enable{true};
+        };
+
+        // Skips pass binding calls that would set what the command list already has bound. Root arguments are
+        // only skipped on DX12, where they persist until the root signature changes.
+        struct BindingStatePolicy
+        {
+            bool skip_redundant_bindings{true};
+        };
+
+        // Records contiguous segments of the execution order on worker threads into separate command lists
+        // that are submitted in order. DX12 only; other backends keep recording serially.
+        struct ParallelRecordingPolicy
+        {
+            bool enable{false};
+            unsigned worker_count{3};
+            unsigned min_passes_per_segment{4};
+        };
+
+        // Submits the passes the queue schedule moves to async compute on a compute queue, split into command
+        // lists at the schedule's sync points. DX12 only and takes precedence over parallel recording while the
+        // schedule has async passes. Render targets those passes use are not placed in shared heaps.
+        struct AsyncComputePolicy
+        {
+            bool enable{true};
         };
         
         typedef std::function<void(unsigned long long)> RenderGraphTickCallback;
@@ -405,17 +659,28 @@ namespace RendererInterface
         bool RegisterRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle);
         bool RemoveRenderGraphNode(RenderGraphNodeHandle render_graph_node_handle);
         bool UpdateComputeDispatch(RenderGraphNodeHandle render_graph_node_handle, unsigned group_size_x, unsigned group_size_y, unsigned group_size_z);
+        bool UpdateNodeExecuteCommands(RenderGraphNodeHandle render_graph_node_handle, const std::vector<RenderExecuteCommand>& execute_commands);
+        bool UpdateNodeViewportRect(RenderGraphNodeHandle render_graph_node_handle, const RenderViewportRect& viewport_rect);
         bool QueueNodeRenderStateUpdate(RenderGraphNodeHandle render_graph_node_handle, const RenderStateDesc& render_state);
         bool UpdateNodeDependencies(RenderGraphNodeHandle render_graph_node_handle, const std::vector<RenderGraphNodeHandle>& dependency_render_graph_nodes);
-        bool UpdateNodeBufferBinding(RenderGraphNodeHandle render_graph_node_handle, const std::string& binding_name, BufferHandle buffer_handle);
+        // Binding updates take an interned BindingName; systems that rebind every frame resolve it once at setup.
+        bool UpdateNodeBufferBinding(RenderGraphNodeHandle render_graph_node_handle, BindingName binding_name, BufferHandle buffer_handle);
         bool UpdateNodeRenderTargetBinding(RenderGraphNodeHandle render_graph_node_handle, RenderTargetHandle old_render_target_handle, RenderTargetHandle new_render_target_handle);
-        bool UpdateNodeRenderTargetTextureBinding(RenderGraphNodeHandle render_graph_node_handle, const std::string& binding_name, const std::vector<RenderTargetHandle>& render_target_handles);
-        bool UpdateNodeRenderTargetTextureBinding(RenderGraphNodeHandle render_graph_node_handle, const std::string& binding_name, RenderTargetHandle render_target_handle);
+        bool UpdateNodeRenderTargetTextureBinding(RenderGraphNodeHandle render_graph_node_handle, BindingName binding_name, const std::vector<RenderTargetHandle>& render_target_handles);
+        bool UpdateNodeRenderTargetTextureBinding(RenderGraphNodeHandle render_graph_node_handle, BindingName binding_name, RenderTargetHandle render_target_handle);
         
         bool CompileRenderPassAndExecute();
 
         void RegisterTextureToColorOutput(TextureHandle texture_handle);
         void RegisterRenderTargetToColorOutput(RenderTargetHandle render_target_handle);
+        // Resources consumed outside the graph, e.g. CPU readbacks, or whose contents are cached across frames;
+        // their writers are never culled and their stores are never dropped.
+        void RegisterOutputSink(BufferHandle buffer_handle);
+        void RegisterOutputSink(TextureHandle texture_handle);
+        void RegisterOutputSink(RenderTargetHandle render_target_handle);
+        void UnregisterOutputSink(BufferHandle buffer_handle);
+        void UnregisterOutputSink(TextureHandle texture_handle);
+        void UnregisterOutputSink(RenderTargetHandle render_target_handle);
         void RegisterTickCallback(const RenderGraphTickCallback& callback);
         void RegisterDebugUICallback(const RenderGraphDebugUICallback& callback);
         void EnableDebugUI(bool enable);
@@ -444,9 +709,46 @@ namespace RendererInterface
         void ShutdownRuntimeServices();
         void SetValidationPolicy(const ValidationPolicy& policy);
         ValidationPolicy GetValidationPolicy() const;
+        void SetParallelRecordingPolicy(const ParallelRecordingPolicy& policy);
+        ParallelRecordingPolicy GetParallelRecordingPolicy() const;
+        void SetAsyncComputePolicy(const AsyncComputePolicy& policy);
+        AsyncComputePolicy GetAsyncComputePolicy() const;
+        void SetDeadPassCullingPolicy(const DeadPassCullingPolicy& policy);
+        DeadPassCullingPolicy GetDeadPassCullingPolicy() const;
+        void SetRenderPassMergePolicy(const RenderPassMergePolicy& policy);
+        RenderPassMergePolicy GetRenderPassMergePolicy() const;
+        void SetTransientAliasingPolicy(const TransientAliasingPolicy& policy);
+        TransientAliasingPolicy GetTransientAliasingPolicy() const;
+        void SetBindingStatePolicy(const BindingStatePolicy& policy);
+        BindingStatePolicy GetBindingStatePolicy() const;
         const FrameStats& GetLastFrameStats() const;
         const FrameTimingBreakdown& GetLastFrameTimingBreakdown() const;
         const DependencyDiagnostics& GetDependencyDiagnostics() const;
+        const TransientAliasingDiagnostics& GetTransientAliasingDiagnostics() const;
+        const BarrierPlanDiagnostics& GetBarrierPlanDiagnostics() const;
+        // Text dump of the barrier plan for the current execution order, see RenderGraphBarrierPlanner::DumpPlan.
+        std::string DumpBarrierPlan() const;
+        const AsyncComputeScheduleDiagnostics& GetAsyncComputeScheduleDiagnostics() const;
+        // Text dump of the queue schedule, see RenderGraphQueueScheduler::DumpSchedule.
+        std::string DumpAsyncComputeSchedule() const;
+        const RenderPassMergeDiagnostics& GetRenderPassMergeDiagnostics() const;
+        // Text dump of the rendering scopes and their ops, see RenderGraphAttachmentOps::DumpPlan.
+        std::string DumpRenderPassMergePlan() const;
+        const ExecutionPlanCacheDiagnostics& GetExecutionPlanCacheDiagnostics() const;
+        // Plans a synthetic chain of pass_count passes without a device: the full planner against a plan
+        // cache lookup.
+        static ExecutionPlanningBenchmarkResult BenchmarkExecutionPlanning(unsigned pass_count, unsigned iteration_count);
+        // Changes each draw desc field RenderPass::ValidateDrawDesc reads on its own and lists the ones that leave
+        // the draw validation cache key unchanged, i.e. that could hit a stale cached result. Runs headless.
+        static bool VerifyDrawValidationKeyCoverage(std::vector<std::string>& out_uncovered_fields);
+        // Writes the nodes, resource sizes and outputs the planner sees to a JSON file during the next frame.
+        void RequestExecutionPlanningSnapshot(const std::string& path);
+        // Replays the planner against a snapshot without a window or device.
+        static ExecutionPlanningReplayResult ReplayExecutionPlanningSnapshot(const std::string& path, unsigned iteration_count);
+        // Records the next frame_count frames as a Chrome trace-event JSON file: frame sections, per-pass CPU
+        // recording, GPU pass timestamps, queue submits and fence waits. Replaces a capture in progress.
+        void RequestFrameTrace(const std::string& path, unsigned frame_count);
+        FrameTraceStatus GetFrameTraceStatus() const;
         void SetTickCallbackBreakdown(float other_ms, float module_ms, float system_ms);
 
     protected:
@@ -500,11 +802,11 @@ namespace RendererInterface
             };
 
             // key: binding_name -> cache_key -> descriptor entry
-            std::map<std::string, std::map<unsigned long long, BufferDescriptorCacheEntry>> m_buffer_descriptor_cache;
+            BindingNameMap<std::map<unsigned long long, BufferDescriptorCacheEntry>> m_buffer_descriptor_cache;
             // key: binding_name -> cache_key -> descriptor entry (TextureHandle path)
-            std::map<std::string, std::map<unsigned long long, TextureDescriptorCacheEntry>> m_texture_descriptor_cache;
+            BindingNameMap<std::map<unsigned long long, TextureDescriptorCacheEntry>> m_texture_descriptor_cache;
             // key: binding_name -> cache_key -> descriptor entry (RenderTargetHandle path)
-            std::map<std::string, std::map<unsigned long long, TextureDescriptorCacheEntry>> m_render_target_texture_descriptor_cache;
+            BindingNameMap<std::map<unsigned long long, TextureDescriptorCacheEntry>> m_render_target_texture_descriptor_cache;
         };
 
         struct DescriptorResourceStore
@@ -526,6 +828,9 @@ namespace RendererInterface
         struct ExecutionPlanState
         {
             std::vector<RenderGraphNodeHandle> cached_execution_order;
+            // cached_execution_order without culled passes; what gets recorded.
+            std::vector<RenderGraphNodeHandle> live_execution_order;
+            std::vector<RenderGraphNodeHandle> culled_nodes;
             std::size_t cached_execution_signature{0};
             std::size_t cached_execution_node_count{0};
             std::size_t last_active_node_set_signature{0};
@@ -585,8 +890,8 @@ namespace RendererInterface
         void EnqueueRetainedObjectForDeferredRelease(std::shared_ptr<void> object, const FrameContextSnapshot& frame_context);
         void EnqueueBufferDescriptorEntryForDeferredRelease(const RenderPassDescriptorResource::BufferDescriptorCacheEntry& cache_entry, const FrameContextSnapshot& frame_context);
         void EnqueueTextureDescriptorEntryForDeferredRelease(const RenderPassDescriptorResource::TextureDescriptorCacheEntry& cache_entry, const FrameContextSnapshot& frame_context);
-        void EnqueueBufferDescriptorForDeferredRelease(RenderPassDescriptorResource& descriptor_resource, const std::string& binding_name, const FrameContextSnapshot& frame_context);
-        void EnqueueTextureDescriptorForDeferredRelease(RenderPassDescriptorResource& descriptor_resource, const std::string& binding_name, const FrameContextSnapshot& frame_context);
+        void EnqueueBufferDescriptorForDeferredRelease(RenderPassDescriptorResource& descriptor_resource, BindingName binding_name, const FrameContextSnapshot& frame_context);
+        void EnqueueTextureDescriptorForDeferredRelease(RenderPassDescriptorResource& descriptor_resource, BindingName binding_name, const FrameContextSnapshot& frame_context);
         void ReleaseRenderPassDescriptorResource(RenderPassDescriptorResource& descriptor_resource, const FrameContextSnapshot& frame_context);
         void RetireRenderGraphNodeResources(RenderGraphNodeHandle render_graph_node_handle, const FrameContextSnapshot& frame_context);
         bool BuildRenderGraphNodeFromSetup(
@@ -602,6 +907,17 @@ namespace RendererInterface
         void CollectUnusedRenderPassDescriptorResources(const FrameContextSnapshot& frame_context);
         void FlushDeferredResourceReleases(bool force_release_all);
         void ApplyPendingRenderStateUpdates(const FrameContextSnapshot& frame_context);
+        // Needs the render pass merge plan of the live execution order; relays out the transient render targets
+        // when the plan changed or a placed target was recreated since.
+        void UpdateTransientRenderTargetPlacement(bool execution_plan_changed);
+        void RebuildBarrierStateRequests(const std::vector<RenderGraphNodeHandle>& execution_order);
+        // Needs the barrier state requests of the same execution order.
+        void RebuildAsyncComputeSchedule(const std::vector<RenderGraphNodeHandle>& execution_order);
+        // Needs the barrier state requests of the same execution order.
+        void RebuildRenderPassMergePlan(const std::vector<RenderGraphNodeHandle>& execution_order, const std::set<unsigned long long>& output_resource_keys);
+        // Registered output sinks plus the color output, as EncodeResourceKey values.
+        std::set<unsigned long long> CollectOutputResourceKeys() const;
+        bool WriteExecutionPlanningSnapshot(const std::string& path, const std::vector<RenderGraphNodeHandle>& nodes) const;
         bool InitDebugUI();
         bool RenderDebugUI(IRHICommandList& command_list, const FrameContextSnapshot& frame_context);
         void ShutdownDebugUI();
@@ -614,6 +930,13 @@ namespace RendererInterface
         void ResolveGPUProfilerFrame(unsigned slot_index);
         bool BeginGPUProfilerFrame(IRHICommandList& command_list, unsigned slot_index);
         bool WriteGPUProfilerTimestamp(IRHICommandList& command_list, unsigned slot_index, unsigned query_index);
+        bool IsCapturingFrameTrace(unsigned long long frame_index) const;
+        // Timeline times as produced by ToTimelineMilliseconds; ignored outside a capture window.
+        void RecordFrameTraceSpan(const char* category, const char* name, double begin_ms, double end_ms);
+        // gpu_spans_ms is parallel to frame_stats.pass_stats and may be shorter or empty.
+        void AppendFrameTracePasses(const FrameStats& frame_stats, const std::vector<std::pair<double, double>>& gpu_spans_ms, bool gpu_calibrated);
+        // Writes the trace once every captured frame is complete, or gives up on frames whose GPU timings never arrive.
+        void UpdateFrameTrace();
         bool FinalizeGPUProfilerFrame(IRHICommandList& command_list, unsigned slot_index, unsigned query_count, const FrameStats& frame_stats);
         bool InitRenderDocCapture(bool require_available, std::string& out_status);
         void BeginRenderDocFrameCapture();
@@ -635,12 +958,47 @@ namespace RendererInterface
         void BlitFinalOutputToSwapchain(IRHICommandList& command_list, const FrameContextSnapshot& frame_context, unsigned window_width, unsigned window_height);
         void FinalizeFrameSubmission(FramePreparationContext& frame_context, bool swapchain_ready);
         
-        RenderPassExecutionStatus ExecuteRenderGraphNode(IRHICommandList& command_list, const FrameContextSnapshot& frame_context, RenderGraphNodeHandle render_graph_node_handle, unsigned long long interval);
+        // Execution is split in a serial half that touches graph state (callbacks, validation, descriptor
+        // caches) and a half that only records into the given command list and may run on a worker thread.
+        // Passes merged into one rendering scope are prepared together, so that everything they transition is
+        // in place before the scope opens; inout_rendering_scope_open tracks the scope of one command list, and
+        // binding_state the bindings recorded into it.
+        struct PreparedRenderGraphNode;
+        RenderPassExecutionStatus PrepareRenderGraphNode(const FrameContextSnapshot& frame_context, RenderGraphNodeHandle render_graph_node_handle, unsigned long long interval, PreparedRenderGraphNode& out_prepared_node);
+        void ApplyRenderPassMergePlan(unsigned pass_index, PreparedRenderGraphNode& prepared_node) const;
+        std::pair<unsigned, unsigned> GetRenderingScopeRange(unsigned pass_index) const;
+        RenderPassExecutionStatus RecordRenderGraphNode(IRHICommandList& command_list, const PreparedRenderGraphNode& prepared_node, bool& inout_rendering_scope_open, RenderGraphBindingState::Tracker& binding_state);
+        RenderGraphBindingState::Tracker CreateBindingStateTracker() const;
+        bool ShouldRecordPassesInParallel() const;
+        // Balances rendering scopes of the live execution order over the recording workers.
+        std::vector<RenderGraphParallelRecording::Segment> BuildParallelRecordingSegments(const std::vector<float>& pass_costs);
+        bool ShouldSubmitAsyncCompute() const;
+        void RecordPlanWithAsyncCompute(
+            IRHICommandList& command_list,
+            const FrameContextSnapshot& frame_context,
+            unsigned profiler_slot_index,
+            unsigned long long interval,
+            std::vector<RenderPassExecutionStatus>& out_execution_statuses,
+            std::vector<float>& out_pass_cpu_ms,
+            std::vector<std::pair<double, double>>& out_pass_cpu_spans_ms,
+            std::vector<unsigned>& out_segment_indices,
+            RenderGraphBindingState::Counters& out_binding_counters);
+        void RecordPlanInParallel(
+            IRHICommandList& command_list,
+            const FrameContextSnapshot& frame_context,
+            unsigned profiler_slot_index,
+            unsigned long long interval,
+            std::vector<RenderPassExecutionStatus>& out_execution_statuses,
+            std::vector<float>& out_pass_cpu_ms,
+            std::vector<std::pair<double, double>>& out_pass_cpu_spans_ms,
+            std::vector<unsigned>& out_segment_indices,
+            RenderGraphBindingState::Counters& out_binding_counters);
         void LogRenderPassValidationResult(RenderGraphNodeHandle render_graph_node_handle,
                                            const RenderGraphNodeDesc& render_graph_node_desc,
                                            bool valid,
                                            const std::vector<std::string>& errors,
                                            const std::vector<std::string>& warnings);
+        // Graphics queue submission; the first one after async compute work also waits for that work to finish.
         void CloseCurrentCommandListAndExecute(IRHICommandList& command_list, const RHIExecuteCommandListContext& context, bool wait);
         void Present(IRHICommandList& command_list, const FrameContextSnapshot& frame_context);
         
@@ -653,6 +1011,15 @@ namespace RendererInterface
         DescriptorResourceStore m_descriptor_resource_store;
         ExecutionPlanState m_execution_plan_state;
         DependencyDiagnosticsState m_dependency_diagnostics_state;
+        TransientAliasingDiagnostics m_transient_aliasing_diagnostics{};
+        // Per step of the cached execution order: (EncodeResourceKey of the bound handle, RHIResourceStateType).
+        // Kept on handles since frame-buffered handles resolve to a different RHI resource every frame.
+        std::vector<std::vector<std::pair<unsigned long long, unsigned>>> m_barrier_state_requests;
+        BarrierPlanDiagnostics m_barrier_plan_diagnostics{};
+        AsyncComputeScheduleDiagnostics m_async_compute_schedule_diagnostics{};
+        std::string m_async_compute_schedule_dump;
+        RenderPassMergeDiagnostics m_render_pass_merge_diagnostics{};
+        ExecutionPlanCacheDiagnostics m_execution_plan_cache_diagnostics{};
         std::map<RenderGraphNodeHandle, std::tuple<unsigned, unsigned, unsigned>> m_auto_pruned_named_binding_counts;
         std::map<RenderGraphNodeHandle, unsigned long long> m_render_pass_validation_last_log_frame;
         std::map<RenderGraphNodeHandle, std::size_t> m_render_pass_validation_last_message_hash;
@@ -671,12 +1038,35 @@ namespace RendererInterface
         bool m_debug_ui_enabled{true};
         bool m_debug_ui_initialized{false};
         ValidationPolicy m_validation_policy{};
+        ParallelRecordingPolicy m_parallel_recording_policy{};
+        AsyncComputePolicy m_async_compute_policy{};
+        DeadPassCullingPolicy m_dead_pass_culling_policy{};
+        RenderPassMergePolicy m_render_pass_merge_policy{};
+        TransientAliasingPolicy m_transient_aliasing_policy{};
+        BindingStatePolicy m_binding_state_policy{};
+        // EncodeResourceKey of the registered output sinks.
+        std::set<unsigned long long> m_output_sink_resource_keys;
+        std::string m_pending_execution_planning_snapshot_path;
+        struct ParallelRecordingState;
+        std::unique_ptr<ParallelRecordingState> m_parallel_recording_state;
+        struct AsyncComputeState;
+        std::unique_ptr<AsyncComputeState> m_async_compute_state;
+        struct RenderPassMergeState;
+        std::unique_ptr<RenderPassMergeState> m_render_pass_merge_state;
+        struct TransientAliasingState;
+        std::unique_ptr<TransientAliasingState> m_transient_aliasing_state;
+        struct DrawValidationCache;
+        std::unique_ptr<DrawValidationCache> m_draw_validation_cache;
+        struct ExecutionPlanCache;
+        std::unique_ptr<ExecutionPlanCache> m_execution_plan_cache;
         struct GPUProfilerState;
         std::unique_ptr<GPUProfilerState> m_gpu_profiler_state;
         struct RenderDocCaptureState;
         std::unique_ptr<RenderDocCaptureState> m_renderdoc_capture_state;
         struct PIXCaptureState;
         std::unique_ptr<PIXCaptureState> m_pix_capture_state;
+        struct FrameTraceState;
+        std::unique_ptr<FrameTraceState> m_frame_trace_state;
         FrameStats m_last_frame_stats{};
         FrameTimingBreakdown m_current_frame_timing_breakdown{};
         FrameTimingBreakdown m_last_frame_timing_breakdown{};
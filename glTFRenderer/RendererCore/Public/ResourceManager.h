@@ -5,9 +5,11 @@
 
 enum class RHIPipelineType;
 enum class RHIDataFormat;
+enum class RHICommandAllocatorType;
 class IRHIRenderTarget;
 class IRHIShader;
 class IRHITextureAllocation;
+class IRHIHeapAllocation;
 class IRHITexture;
 class glTFRenderResourceFrameManager;
 class IRHIPipelineStateObject;
@@ -20,6 +22,7 @@ class IRHICommandAllocator;
 class IRHIMemoryManager;
 class IRHISwapChain;
 class IRHICommandQueue;
+class IRHISemaphore;
 class IRHIDevice;
 class IRHIFactory;
 class IRHIResource;
@@ -43,6 +46,14 @@ public:
     RendererInterface::RenderTargetHandle CreateRenderTarget(const RendererInterface::RenderTargetDesc& desc);
     bool RetireBuffer(RendererInterface::BufferHandle handle);
     bool RetireRenderTarget(RendererInterface::RenderTargetHandle handle);
+    bool GetRenderTargetDesc(RendererInterface::RenderTargetHandle handle, RendererInterface::RenderTargetDesc& out_desc) const;
+    // Size and alignment the render target would take placed in a transient heap.
+    bool GetRenderTargetPlacementRequirements(RendererInterface::RenderTargetHandle handle, unsigned long long& out_size_bytes, unsigned long long& out_alignment) const;
+    // Recreates the listed render targets inside freshly allocated heaps, at offsets chosen so that targets sharing
+    // memory are never alive at the same time. Targets placed by an earlier call and missing from placements
+    // return to committed memory. Handles stay valid; only the textures behind them change.
+    bool PlaceTransientRenderTargets(const std::vector<RendererInterface::TransientRenderTargetHeapDesc>& heaps, const std::vector<RendererInterface::TransientRenderTargetPlacement>& placements);
+    bool IsRenderTargetPlaced(RendererInterface::RenderTargetHandle handle) const;
 
     unsigned GetCurrentBackBufferIndex() const;
     unsigned GetCurrentFrameSlotIndex() const;
@@ -71,10 +82,23 @@ public:
     void SetSwapchainResizePolicy(const RendererInterface::SwapchainResizePolicy& policy, bool reset_retry_state = true);
     RendererInterface::SwapchainPresentMode GetSwapchainPresentMode() const;
     void SetSwapchainPresentMode(RendererInterface::SwapchainPresentMode mode);
+    RendererInterface::FrameLatencyMode GetFrameLatencyMode() const;
+    void SetFrameLatencyMode(RendererInterface::FrameLatencyMode mode);
+    // Blocks until the GPU has finished the frame before frame_context and its present has completed.
+    void WaitPreviousFramePresented(const RendererInterface::FrameContextSnapshot& frame_context);
     IRHICommandList& GetCommandListForRecordPassCommand(RendererInterface::RenderPassHandle render_pass_handle = NULL_HANDLE);
     IRHICommandList& GetCommandListForRecordPassCommand(const RendererInterface::FrameContextSnapshot& frame_context, RendererInterface::RenderPassHandle render_pass_handle = NULL_HANDLE);
+    // Pooled per frame slot for recording render graph segments on worker threads. The returned list is
+    // reset and recording; callers close and execute it in the same frame.
+    IRHICommandList& AcquireParallelRecordCommandList(const RendererInterface::FrameContextSnapshot& frame_context, unsigned index);
+    // Same pooling as AcquireParallelRecordCommandList with COMPUTE lists; execute them on GetAsyncComputeCommandQueue().
+    IRHICommandList& AcquireAsyncComputeCommandList(const RendererInterface::FrameContextSnapshot& frame_context, unsigned index);
+    // Pooled per frame slot; orders submissions between the graphics and async compute queues within a frame.
+    IRHISemaphore& AcquireQueueSyncSemaphore(const RendererInterface::FrameContextSnapshot& frame_context, unsigned index);
 
     IRHICommandQueue& GetCommandQueue();
+    bool SupportsAsyncCompute() const;
+    IRHICommandQueue& GetAsyncComputeCommandQueue();
 
     IRHITextureDescriptorAllocation& GetCurrentSwapchainRT();
     IRHITextureDescriptorAllocation& GetCurrentSwapchainRT(const RendererInterface::FrameContextSnapshot& frame_context);
@@ -86,12 +110,26 @@ protected:
     std::shared_ptr<IRHIFactory> m_factory;
     std::shared_ptr<IRHIDevice> m_device;
     std::shared_ptr<IRHICommandQueue> m_command_queue;
+    // Null when the device exposes no compute queue next to the graphics queue.
+    std::shared_ptr<IRHICommandQueue> m_async_compute_command_queue;
     std::shared_ptr<IRHISwapChain> m_swap_chain;
     std::shared_ptr<IRHIMemoryManager> m_memory_manager;
     
     std::vector<std::shared_ptr<IRHICommandAllocator>> m_command_allocators;
     std::vector<std::shared_ptr<IRHICommandList>> m_command_lists;
 
+    struct ParallelRecordCommandContext
+    {
+        std::shared_ptr<IRHICommandAllocator> command_allocator;
+        std::shared_ptr<IRHICommandList> command_list;
+    };
+    std::vector<std::vector<ParallelRecordCommandContext>> m_parallel_record_command_contexts;
+    std::vector<std::vector<ParallelRecordCommandContext>> m_async_compute_command_contexts;
+    std::vector<std::vector<std::shared_ptr<IRHISemaphore>>> m_queue_sync_semaphores;
+
+    IRHICommandList& AcquirePooledCommandList(std::vector<std::vector<ParallelRecordCommandContext>>& pool,
+        const RendererInterface::FrameContextSnapshot& frame_context, unsigned index, RHICommandAllocatorType type);
+
     std::shared_ptr<IRHIRenderTargetManager> m_render_target_manager;
     std::vector<std::shared_ptr<IRHITextureDescriptorAllocation>> m_swapchain_RTs;
 
@@ -135,6 +173,7 @@ private:
     void AdvanceDeferredReleaseFrame();
     void FlushDeferredResourceReleases(bool force_release_all);
     void EnqueueResourceForDeferredRelease(const std::shared_ptr<IRHIResource>& resource);
+    void ReleasePlacedRenderTarget(RendererInterface::RenderTargetHandle handle);
     unsigned GetDeferredReleaseLatencyFrames(const RendererInterface::FrameContextSnapshot& frame_context) const;
     unsigned GetDeferredReleaseLatencyFrames() const;
     unsigned ComputeRetryCooldownFrames(unsigned failure_count) const;
@@ -143,5 +182,7 @@ private:
     bool IsResizeRequestStableEnough(unsigned width, unsigned height, bool pending_retry_for_same_size) const;
 
     std::deque<DeferredReleaseEntry> m_deferred_release_entries;
+    std::vector<std::shared_ptr<IRHIHeapAllocation>> m_transient_heaps;
+    std::map<RendererInterface::RenderTargetHandle, std::shared_ptr<IRHITextureAllocation>> m_placed_render_targets;
     unsigned long long m_deferred_release_frame_index{0};
 };
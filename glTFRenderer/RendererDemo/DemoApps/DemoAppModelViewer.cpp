@@ -34,6 +34,8 @@ namespace
             return "DX12";
         case RendererInterface::VULKAN:
             return "Vulkan";
+        case RendererInterface::NULL_RHI:
+            return "Null";
         }
 
         return "Unknown";
@@ -74,6 +74,8 @@ namespace
             return "DX12";
         case RendererInterface::VULKAN:
             return "Vulkan";
+        case RendererInterface::NULL_RHI:
+            return "Null";
         }
         return "Unknown";
     }
@@ -835,10 +837,12 @@ void DemoAppModelViewerFrostedGlass::AccumulateRegressionPerf(const RendererInte
 {
     m_regression_perf_accumulator.sample_count += 1u;
     m_regression_perf_accumulator.cpu_total_sum_ms += frame_stats.cpu_total_ms;
+    m_regression_perf_accumulator.cpu_total_distribution.AddSample(frame_stats.cpu_total_ms);
     if (frame_stats.gpu_time_valid)
     {
         m_regression_perf_accumulator.gpu_total_valid_count += 1u;
         m_regression_perf_accumulator.gpu_total_sum_ms += frame_stats.gpu_total_ms;
+        m_regression_perf_accumulator.gpu_total_distribution.AddSample(frame_stats.gpu_total_ms);
     }
 
     float frosted_cpu_ms = 0.0f;
@@ -846,6 +850,11 @@ void DemoAppModelViewerFrostedGlass::AccumulateRegressionPerf(const RendererInte
     bool frosted_gpu_valid = false;
     for (const auto& pass_stat : frame_stats.pass_stats)
     {
+        if (pass_stat.gpu_time_valid)
+        {
+            m_regression_perf_accumulator.pass_gpu_distributions[pass_stat.group_name + "/" + pass_stat.pass_name]
+                .AddSample(pass_stat.gpu_time_ms);
+        }
         if (pass_stat.group_name != "Frosted Glass")
         {
             continue;
@@ -872,6 +881,7 @@ void DemoAppModelViewerFrostedGlass::AccumulateRegressionPerf(const RendererInte
         {
             m_regression_perf_accumulator.frame_timing_valid_count += 1u;
             m_regression_perf_accumulator.frame_total_sum_ms += frame_timing.frame_total_ms;
+            m_regression_perf_accumulator.frame_total_distribution.AddSample(frame_timing.frame_total_ms);
             m_regression_perf_accumulator.execute_passes_sum_ms += frame_timing.execute_passes_ms;
             m_regression_perf_accumulator.non_pass_cpu_sum_ms += frame_timing.non_pass_cpu_ms;
             m_regression_perf_accumulator.frame_wait_total_sum_ms += frame_timing.frame_wait_total_ms;
@@ -1181,6 +1191,31 @@ bool DemoAppModelViewerFrostedGlass::WriteRegressionPerfJson(const Regression::C
         summary["finalize_submission_avg_ms"] = nullptr;
     }
 
+    // Flat tail-latency keys for the comparison scripts, plus the full distributions.
+    const auto write_distribution = [&summary](const char* metric, const Regression::PerfDistribution& distribution)
+    {
+        const std::string prefix(metric);
+        const bool has_samples = distribution.GetSampleCount() > 0u;
+        summary[prefix + "_p50_ms"] = has_samples ? nlohmann::json(distribution.GetPercentile(50.0)) : nlohmann::json(nullptr);
+        summary[prefix + "_p90_ms"] = has_samples ? nlohmann::json(distribution.GetPercentile(90.0)) : nlohmann::json(nullptr);
+        summary[prefix + "_p99_ms"] = has_samples ? nlohmann::json(distribution.GetPercentile(99.0)) : nlohmann::json(nullptr);
+        summary[prefix + "_max_ms"] = has_samples ? nlohmann::json(distribution.GetMax()) : nlohmann::json(nullptr);
+        summary[prefix + "_stddev_ms"] = has_samples ? nlohmann::json(distribution.GetStandardDeviation()) : nlohmann::json(nullptr);
+        summary["distributions"][prefix] = distribution.ToJson();
+    };
+    write_distribution("cpu_total", m_regression_perf_accumulator.cpu_total_distribution);
+    write_distribution("gpu_total", m_regression_perf_accumulator.gpu_total_distribution);
+    write_distribution("frame_total", m_regression_perf_accumulator.frame_total_distribution);
+
+    nlohmann::json pass_gpu_distributions = nlohmann::json::array();
+    for (const auto& [pass_key, distribution] : m_regression_perf_accumulator.pass_gpu_distributions)
+    {
+        nlohmann::json pass_item = distribution.ToJson();
+        pass_item["pass"] = pass_key;
+        pass_gpu_distributions.push_back(std::move(pass_item));
+    }
+    summary["pass_gpu_distributions"] = std::move(pass_gpu_distributions);
+
     std::ofstream json_stream(file_path, std::ios::out | std::ios::trunc);
     if (!json_stream.is_open())
     {
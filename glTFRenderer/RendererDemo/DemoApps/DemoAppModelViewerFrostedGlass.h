@@ -1,9 +1,11 @@
 #pragma once
 #include "DemoAppModelViewer.h"
+#include "Regression/RegressionPerfDistribution.h"
 #include "Regression/RegressionSuite.h"
 #include "RendererSystem/RendererSystemFrostedGlass.h"
 #include "RendererSystem/RendererSystemFrostedPanelProducer.h"
 #include <filesystem>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -71,6 +73,12 @@ protected:
         double present_call_sum_ms{0.0};
         double prepare_frame_sum_ms{0.0};
         double finalize_submission_sum_ms{0.0};
+        // Per-frame distributions, so hitches show up in the percentiles rather than vanish in the averages.
+        Regression::PerfDistribution cpu_total_distribution{};
+        Regression::PerfDistribution gpu_total_distribution{};
+        Regression::PerfDistribution frame_total_distribution{};
+        // GPU time of each pass keyed by "group/pass".
+        std::map<std::string, Regression::PerfDistribution> pass_gpu_distributions{};
     };
 
     struct RegressionCaseResult
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
+#include <cstdlib>
 #include <imgui/imgui.h>
 #include <chrono>
 #include <filesystem>
@@ -59,6 +60,8 @@ namespace
             return "DX12";
         case RendererInterface::VULKAN:
             return "Vulkan";
+        case RendererInterface::NULL_RHI:
+            return "Null";
         default:
             return "Unknown";
         }
@@ -138,9 +141,12 @@ namespace
                argument == "-dx12" ||
                argument == "-vk" ||
                argument == "-vulkan" ||
+               argument == "-null-rhi" ||
                argument == "-mailbox" ||
                argument == "-novsync" ||
                argument == "-vsync" ||
+               argument == "-low-latency" ||
+               argument == "-throughput" ||
                argument == "-disable-debug-ui";
     }
 
@@ -540,11 +546,12 @@ void DemoBase::DrawDebugUI()
             ImGui::Text("API: %s", ToString(m_render_device_type));
             ImGui::Text("Present Mode: %s", ToString(m_resource_manager->GetSwapchainPresentMode()));
             {
-                const char* runtime_rhi_options[] = {"DX12", "Vulkan"};
-                int runtime_rhi_selection = m_runtime_rhi_ui_selection == RendererInterface::DX12 ? 0 : 1;
+                // Indexed by RenderDeviceType.
+                const char* runtime_rhi_options[] = {"DX12", "Vulkan", "Null"};
+                int runtime_rhi_selection = static_cast<int>(m_runtime_rhi_ui_selection);
                 if (ImGui::Combo("Runtime RHI", &runtime_rhi_selection, runtime_rhi_options, IM_ARRAYSIZE(runtime_rhi_options)))
                 {
-                    m_runtime_rhi_ui_selection = runtime_rhi_selection == 0 ? RendererInterface::DX12 : RendererInterface::VULKAN;
+                    m_runtime_rhi_ui_selection = static_cast<RendererInterface::RenderDeviceType>(runtime_rhi_selection);
                 }
 
                 if (m_rhi_switch_in_progress)
@@ -589,6 +596,20 @@ void DemoBase::DrawDebugUI()
                 m_resource_manager->SetSwapchainPresentMode(new_mode);
                 m_resource_manager->InvalidateSwapchainResizeRequest();
             }
+            m_frame_latency_mode_ui = m_resource_manager->GetFrameLatencyMode();
+            int latency_mode_selection =
+                m_frame_latency_mode_ui == RendererInterface::FrameLatencyMode::THROUGHPUT ? 0 : 1;
+            const char* latency_mode_options[] = {"Throughput", "Low Latency"};
+            if (ImGui::Combo("Frame Latency Mode", &latency_mode_selection, latency_mode_options, IM_ARRAYSIZE(latency_mode_options)))
+            {
+                m_frame_latency_mode_ui =
+                    latency_mode_selection == 0
+                        ? RendererInterface::FrameLatencyMode::THROUGHPUT
+                        : RendererInterface::FrameLatencyMode::LOW_LATENCY;
+                m_resource_manager->SetFrameLatencyMode(m_frame_latency_mode_ui);
+            }
+            ImGui::Text("Frames In Flight: %u (set with -frames-in-flight=N at launch)",
+                m_resource_manager->GetFrameSlotCount());
             ImGui::Text("Render Extent: %u x %u",
                 m_resource_manager->GetCurrentRenderWidth(),
                 m_resource_manager->GetCurrentRenderHeight());
@@ -859,6 +880,12 @@ void DemoBase::DrawDebugUI()
             frame_stats.executed_compute_pass_count,
             frame_stats.ray_tracing_pass_count,
             frame_stats.executed_ray_tracing_pass_count);
+        if (frame_stats.async_compute_pass_count > 0)
+        {
+            ImGui::Text("Async Compute: %u passes | overlapping %u graphics passes",
+                frame_stats.async_compute_pass_count,
+                frame_stats.async_overlapped_graphics_pass_count);
+        }
         if (m_window)
         {
             const auto window_loop_timing = m_window->GetLastLoopTiming();
@@ -894,12 +921,13 @@ void DemoBase::DrawDebugUI()
                 frame_timing.execute_passes_ms,
                 frame_timing.non_pass_cpu_ms,
                 frame_timing.untracked_ms);
-            ImGui::Text("CPU Wait Estimate: %.3f ms [WaitPrev %.3f | AcquireCmd %.3f | AcquireSwapchain %.3f | Submit %.3f | PresentCall %.3f]",
+            ImGui::Text("CPU Wait Estimate: %.3f ms [WaitPrev %.3f | AcquireCmd %.3f | AcquireSwapchain %.3f | Submit %.3f | WaitPresent %.3f | PresentCall %.3f]",
                 frame_timing.frame_wait_total_ms,
                 frame_timing.wait_previous_frame_ms,
                 frame_timing.acquire_command_list_ms,
                 frame_timing.acquire_swapchain_ms,
                 frame_timing.submit_command_list_ms,
+                frame_timing.wait_previous_present_ms,
                 frame_timing.present_call_ms);
             ImGui::Text("Prepare: %.3f ms [Sync %.3f | Tick/UI %.3f | WaitPrev %.3f | DeferredRelease %.3f | AcquireCtx %.3f (ResolveProfiler %.3f / AcquireCmd %.3f / AcquireSwapchain %.3f)]",
                 frame_timing.prepare_frame_ms,
@@ -1019,7 +1047,7 @@ void DemoBase::DrawDebugUI()
                     ImGuiTableFlags_RowBg |
                     ImGuiTableFlags_SizingStretchProp |
                     ImGuiTableFlags_ScrollY;
-                if (ImGui::BeginTable("RenderPassTimingTable", 6, table_flags, ImVec2(0.0f, 220.0f)))
+                if (ImGui::BeginTable("RenderPassTimingTable", 7, table_flags, ImVec2(0.0f, 220.0f)))
                 {
                     ImGui::TableSetupColumn("System");
                     ImGui::TableSetupColumn("Pass");
@@ -1027,6 +1055,7 @@ void DemoBase::DrawDebugUI()
                     ImGui::TableSetupColumn("State");
                     ImGui::TableSetupColumn("CPU ms");
                     ImGui::TableSetupColumn("GPU ms");
+                    ImGui::TableSetupColumn("Queue");
                     ImGui::TableHeadersRow();
 
                     ImGuiListClipper clipper;
@@ -1067,6 +1096,22 @@ void DemoBase::DrawDebugUI()
                             {
                                 ImGui::TextUnformatted("N/A");
                             }
+                            ImGui::TableSetColumnIndex(6);
+                            if (!pass_stat.async_compute)
+                            {
+                                ImGui::TextUnformatted("Graphics");
+                            }
+                            else if (pass_stat.overlapped_graphics_pass_count == 0)
+                            {
+                                ImGui::TextUnformatted("Async");
+                            }
+                            else
+                            {
+                                ImGui::Text("Async | overlaps %s .. %s (%u)",
+                                    frame_stats.pass_stats[pass_stat.first_overlapped_pass_index].pass_name.c_str(),
+                                    frame_stats.pass_stats[pass_stat.last_overlapped_pass_index].pass_name.c_str(),
+                                    pass_stat.overlapped_graphics_pass_count);
+                            }
                         }
                     }
                     ImGui::EndTable();
@@ -1617,13 +1662,29 @@ std::vector<std::string> DemoBase::BuildLaunchArgumentsForDemo(const std::string
         launch_arguments.push_back(m_launch_arguments[argument_index]);
     }
 
-    launch_arguments.push_back(m_render_device_type == RendererInterface::DX12 ? "-dx12" : "-vulkan");
+    switch (m_render_device_type)
+    {
+    case RendererInterface::DX12:
+        launch_arguments.push_back("-dx12");
+        break;
+    case RendererInterface::VULKAN:
+        launch_arguments.push_back("-vulkan");
+        break;
+    case RendererInterface::NULL_RHI:
+        launch_arguments.push_back("-null-rhi");
+        break;
+    }
 
     const RendererInterface::SwapchainPresentMode present_mode =
         m_resource_manager ? m_resource_manager->GetSwapchainPresentMode() : m_swapchain_present_mode_ui;
     launch_arguments.push_back(
         present_mode == RendererInterface::SwapchainPresentMode::MAILBOX ? "-mailbox" : "-vsync");
 
+    const RendererInterface::FrameLatencyMode latency_mode =
+        m_resource_manager ? m_resource_manager->GetFrameLatencyMode() : m_frame_latency_mode_ui;
+    launch_arguments.push_back(
+        latency_mode == RendererInterface::FrameLatencyMode::LOW_LATENCY ? "-low-latency" : "-throughput");
+
     if (!m_debug_ui_enabled)
     {
         launch_arguments.push_back("-disable-debug-ui");
@@ -1634,8 +1695,10 @@ std::vector<std::string> DemoBase::BuildLaunchArgumentsForDemo(const std::string
 
 bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
 {
-    bool bUseDX = true;
+    RendererInterface::RenderDeviceType render_device_type = RendererInterface::DX12;
     RendererInterface::SwapchainPresentMode swapchain_present_mode = RendererInterface::SwapchainPresentMode::VSYNC;
+    RendererInterface::FrameLatencyMode frame_latency_mode = RendererInterface::FrameLatencyMode::THROUGHPUT;
+    unsigned frames_in_flight = 0;
     bool disable_debug_ui = false;
     bool log_renderdoc_status = false;
     bool log_pix_status = false;
@@ -1644,12 +1707,18 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
     {
         if (argument == "-dx"|| argument == "-dx12")
         {
-            bUseDX = true;
+            render_device_type = RendererInterface::DX12;
         }
 
         if (argument == "-vk" || argument == "-vulkan")
         {
-            bUseDX = false;
+            render_device_type = RendererInterface::VULKAN;
+        }
+
+        // CPU-only run: every RHI call is recorded and validated but nothing reaches a GPU.
+        if (argument == "-null-rhi")
+        {
+            render_device_type = RendererInterface::NULL_RHI;
         }
 
         if (argument == "-mailbox" || argument == "-novsync")
@@ -1662,6 +1731,22 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
             swapchain_present_mode = RendererInterface::SwapchainPresentMode::VSYNC;
         }
 
+        if (argument == "-low-latency")
+        {
+            frame_latency_mode = RendererInterface::FrameLatencyMode::LOW_LATENCY;
+        }
+
+        if (argument == "-throughput")
+        {
+            frame_latency_mode = RendererInterface::FrameLatencyMode::THROUGHPUT;
+        }
+
+        constexpr std::string_view k_frames_in_flight_prefix = "-frames-in-flight=";
+        if (argument.rfind(k_frames_in_flight_prefix, 0) == 0)
+        {
+            frames_in_flight = static_cast<unsigned>(std::strtoul(argument.c_str() + k_frames_in_flight_prefix.size(), nullptr, 10));
+        }
+
         if (argument == "-disable-debug-ui")
         {
             disable_debug_ui = true;
@@ -1673,6 +1758,12 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
             log_renderdoc_status = true;
         }
 
+        if (argument == "-regression")
+        {
+            // Scene object IDs key instance data, so captures only compare across runs when IDs repeat.
+            RendererUniqueObjectIDAllocation::SetDeterministic(true);
+        }
+
         if (argument == "-renderdoc-required")
         {
             m_renderdoc_preload_requested = true;
@@ -1708,8 +1799,6 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
 
     {
         std::string preload_error{};
-        const RendererInterface::RenderDeviceType render_device_type =
-            bUseDX ? RendererInterface::DX12 : RendererInterface::VULKAN;
         if (!PreloadRenderDocForDevice(render_device_type, log_renderdoc_status, preload_error))
         {
             return false;
@@ -1728,8 +1817,10 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
 
     RendererInterface::RenderDeviceDesc device{};
     device.window = m_window->GetHandle();
-    device.type = bUseDX ? RendererInterface::DX12 : RendererInterface::VULKAN;
+    device.type = render_device_type;
     device.back_buffer_count = GetDefaultBackBufferCount(device.type, swapchain_present_mode);
+    device.frames_in_flight = frames_in_flight;
+    device.frame_latency_mode = frame_latency_mode;
     device.swapchain_resize_policy = GetDefaultSwapchainResizePolicy(device.type);
     device.swapchain_present_mode = swapchain_present_mode;
     device.vulkan_optional_capabilities = GetRequestedVulkanOptionalCapabilities();
@@ -1741,6 +1832,7 @@ bool DemoBase::InitRenderContext(const std::vector<std::string>& arguments)
     m_swapchain_resize_policy_ui_initialized = true;
     m_swapchain_present_mode_ui = device.swapchain_present_mode;
     m_swapchain_present_mode_ui_initialized = true;
+    m_frame_latency_mode_ui = device.frame_latency_mode;
 
     return CreateRenderRuntimeContext(device, disable_debug_ui);
 }
@@ -2203,6 +2295,8 @@ bool DemoBase::ExecutePendingRHISwitch()
     const bool previous_per_frame_resource_binding = m_resource_manager->IsPerFrameResourceBindingEnabled();
     const auto previous_swapchain_policy = m_resource_manager->GetSwapchainResizePolicy();
     const auto previous_swapchain_present_mode = m_resource_manager->GetSwapchainPresentMode();
+    const auto previous_frames_in_flight = m_resource_manager->GetFrameSlotCount();
+    const auto previous_frame_latency_mode = m_resource_manager->GetFrameLatencyMode();
     const auto previous_validation_policy = m_render_graph->GetValidationPolicy();
 
     {
@@ -2239,6 +2333,8 @@ bool DemoBase::ExecutePendingRHISwitch()
     device.window = m_window->GetHandle();
     device.type = m_pending_render_device_type;
     device.back_buffer_count = GetDefaultBackBufferCount(device.type, previous_swapchain_present_mode);
+    device.frames_in_flight = previous_frames_in_flight;
+    device.frame_latency_mode = previous_frame_latency_mode;
     device.swapchain_resize_policy = previous_swapchain_policy;
     device.swapchain_present_mode = previous_swapchain_present_mode;
     device.vulkan_optional_capabilities = GetRequestedVulkanOptionalCapabilities();
@@ -169,4 +169,5 @@ protected:
     bool m_swapchain_resize_policy_ui_initialized{false};
     RendererInterface::SwapchainPresentMode m_swapchain_present_mode_ui{RendererInterface::SwapchainPresentMode::VSYNC};
     bool m_swapchain_present_mode_ui_initialized{false};
+    RendererInterface::FrameLatencyMode m_frame_latency_mode_ui{RendererInterface::FrameLatencyMode::THROUGHPUT};
 };
@@ -0,0 +1,190 @@
+#include "LightBVHCheck.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "RendererModule/LightBVH.h"
+#include "RendererModule/RendererModuleLighting.h"
+
+namespace
+{
+    constexpr unsigned TIMING_ITERATION_COUNT = 10;
+    constexpr unsigned HISTOGRAM_LIGHT_COUNT = 256;
+    constexpr unsigned HISTOGRAM_SAMPLE_COUNT = 200000;
+    // Sampling noise alone stays below 0.005 at these counts; a wrong pdf or traversal lands far above.
+    constexpr double MAX_TOTAL_VARIATION_DISTANCE = 0.03;
+    constexpr double MAX_PDF_SUM_ERROR = 1e-3;
+    constexpr float MAX_PDF_RELATIVE_ERROR = 1e-3f;
+
+    float ToMilliseconds(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+    {
+        return std::chrono::duration<float, std::milli>(end - begin).count();
+    }
+
+    // Point lights scattered through a 100 m cube plus two directional lights, so both the tree and the
+    // infinite light path are sampled.
+    std::vector<LightInfo> MakeSyntheticLights(unsigned point_light_count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position_distribution(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> radius_distribution(5.0f, 25.0f);
+        std::uniform_real_distribution<float> intensity_distribution(0.1f, 10.0f);
+
+        std::vector<LightInfo> lights;
+        lights.reserve(point_light_count + 2);
+        for (unsigned index = 0; index < point_light_count; ++index)
+        {
+            LightInfo light{};
+            light.type = Point;
+            light.position = {position_distribution(rng), position_distribution(rng), position_distribution(rng)};
+            light.radius = radius_distribution(rng);
+            const float intensity = intensity_distribution(rng);
+            light.intensity = {intensity, intensity * 0.8f, intensity * 0.6f};
+            lights.push_back(light);
+        }
+
+        for (const glm::fvec3 direction : {glm::fvec3(0.0f, -1.0f, 0.2f), glm::fvec3(0.3f, -1.0f, -0.4f)})
+        {
+            LightInfo light{};
+            light.type = Directional;
+            light.position = glm::normalize(direction);
+            light.intensity = glm::fvec3(0.5f);
+            lights.push_back(light);
+        }
+        return lights;
+    }
+
+    bool RunTiming(unsigned point_light_count, std::mt19937& rng)
+    {
+        auto lights = MakeSyntheticLights(point_light_count, rng);
+        LightBVH bvh;
+
+        const auto build_begin = std::chrono::steady_clock::now();
+        for (unsigned iteration = 0; iteration < TIMING_ITERATION_COUNT; ++iteration)
+        {
+            bvh.Build(lights);
+        }
+        const auto build_end = std::chrono::steady_clock::now();
+
+        std::uniform_real_distribution<float> offset_distribution(-0.5f, 0.5f);
+        for (auto& light : lights)
+        {
+            if (light.type == Point)
+            {
+                light.position += glm::fvec3(offset_distribution(rng), offset_distribution(rng), offset_distribution(rng));
+            }
+        }
+
+        bool refit_succeeded = true;
+        const auto refit_begin = std::chrono::steady_clock::now();
+        for (unsigned iteration = 0; iteration < TIMING_ITERATION_COUNT; ++iteration)
+        {
+            refit_succeeded = bvh.Refit(lights) && refit_succeeded;
+        }
+        const auto refit_end = std::chrono::steady_clock::now();
+
+        const auto& stats = bvh.GetStats();
+        std::printf("[INFO] Light BVH: lights=%u nodes=%u depth=%u build=%.3f ms refit=%.3f ms\n",
+                    static_cast<unsigned>(lights.size()),
+                    stats.node_count,
+                    stats.max_depth,
+                    ToMilliseconds(build_begin, build_end) / TIMING_ITERATION_COUNT,
+                    ToMilliseconds(refit_begin, refit_end) / TIMING_ITERATION_COUNT);
+        if (!refit_succeeded)
+        {
+            std::printf("[ERROR] Light BVH: refit rejected an unchanged light set.\n");
+        }
+        return refit_succeeded;
+    }
+
+    bool CheckHistogram(const LightBVH& bvh, unsigned light_count, const glm::fvec3& position, const glm::fvec3& normal, std::mt19937& rng)
+    {
+        std::vector<double> expected(light_count, 0.0);
+        double pdf_sum = 0.0;
+        for (unsigned light_index = 0; light_index < light_count; ++light_index)
+        {
+            expected[light_index] = bvh.ComputePdf(position, normal, light_index);
+            pdf_sum += expected[light_index];
+        }
+
+        std::uniform_real_distribution<float> u_distribution(0.0f, 1.0f);
+        std::vector<unsigned> histogram(light_count, 0);
+        unsigned sampled_count = 0;
+        unsigned pdf_mismatch_count = 0;
+        for (unsigned sample = 0; sample < HISTOGRAM_SAMPLE_COUNT; ++sample)
+        {
+            LightBVH::SampleResult result{};
+            if (!bvh.Sample(position, normal, u_distribution(rng), result))
+            {
+                continue;
+            }
+
+            ++histogram[result.light_index];
+            ++sampled_count;
+            const float reference_pdf = static_cast<float>(expected[result.light_index]);
+            if (std::abs(result.pdf - reference_pdf) > MAX_PDF_RELATIVE_ERROR * reference_pdf)
+            {
+                ++pdf_mismatch_count;
+            }
+        }
+
+        // Sample may return false when the draw lands on lights that cannot reach the point; pdfs are not
+        // renormalized for that, so failed draws form one more bucket expected at 1 - sum(pdf).
+        const double failed_fraction = static_cast<double>(HISTOGRAM_SAMPLE_COUNT - sampled_count) / HISTOGRAM_SAMPLE_COUNT;
+        double total_variation_distance = std::abs(failed_fraction - (1.0 - pdf_sum));
+        for (unsigned light_index = 0; light_index < light_count; ++light_index)
+        {
+            total_variation_distance += std::abs(static_cast<double>(histogram[light_index]) / HISTOGRAM_SAMPLE_COUNT - expected[light_index]);
+        }
+        total_variation_distance *= 0.5;
+
+        const bool passed = pdf_sum <= 1.0 + MAX_PDF_SUM_ERROR &&
+            pdf_mismatch_count == 0 &&
+            total_variation_distance <= MAX_TOTAL_VARIATION_DISTANCE;
+        std::printf("[%s] Light BVH histogram at (%.1f, %.1f, %.1f): sampled=%u/%u pdf sum=%.6f pdf mismatches=%u total variation=%.4f\n",
+                    passed ? "INFO" : "ERROR",
+                    position.x, position.y, position.z,
+                    sampled_count,
+                    HISTOGRAM_SAMPLE_COUNT,
+                    pdf_sum,
+                    pdf_mismatch_count,
+                    total_variation_distance);
+        return passed;
+    }
+}
+
+namespace Regression
+{
+    int RunLightBVHCheck()
+    {
+        // Fixed seed so a failure reproduces.
+        std::mt19937 rng(0x5eed1u);
+
+        bool passed = true;
+        // Two directional lights join each set, so the larger one fills the lighting module's capacity.
+        for (const unsigned point_light_count : {1022u, static_cast<unsigned>(RendererModuleLighting::MAX_LIGHT_COUNT) - 2u})
+        {
+            passed = RunTiming(point_light_count, rng) && passed;
+        }
+
+        const auto lights = MakeSyntheticLights(HISTOGRAM_LIGHT_COUNT - 2, rng);
+        LightBVH bvh;
+        bvh.Build(lights);
+        const std::pair<glm::fvec3, glm::fvec3> shading_points[] = {
+            {glm::fvec3(0.0f, 0.0f, 0.0f), glm::fvec3(0.0f, 1.0f, 0.0f)},
+            {glm::fvec3(20.0f, -10.0f, 5.0f), glm::normalize(glm::fvec3(1.0f, 1.0f, 0.0f))},
+            {glm::fvec3(-35.0f, 30.0f, -40.0f), glm::fvec3(0.0f, 0.0f, 1.0f)},
+            {glm::fvec3(45.0f, 45.0f, 45.0f), glm::fvec3(-1.0f, 0.0f, 0.0f)},
+        };
+        for (const auto& shading_point : shading_points)
+        {
+            passed = CheckHistogram(bvh, static_cast<unsigned>(lights.size()), shading_point.first, shading_point.second, rng) && passed;
+        }
+
+        std::printf("[INFO] Light BVH check: %s\n", passed ? "ok" : "failed");
+        return passed ? 0 : 1;
+    }
+}
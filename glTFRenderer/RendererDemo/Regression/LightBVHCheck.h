@@ -0,0 +1,10 @@
+#pragma once
+
+// Headless check of the light BVH sampler. Runs on synthetic lights only; no window, device or scene.
+namespace Regression
+{
+    // Times Build and Refit on synthetic light sets, then draws samples at a few shading points and checks
+    // that the selection histogram and the pdf Sample reports both agree with ComputePdf. Returns the
+    // process exit code.
+    int RunLightBVHCheck();
+}
@@ -0,0 +1,116 @@
+#include "RegressionPerfDistribution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Regression
+{
+    namespace
+    {
+        // 1 ns lower bound and 1% bucket width; 10 s lands in bucket ~2300.
+        constexpr double LOWEST_TRACKED_MS = 1.0e-6;
+        constexpr double BUCKET_GROWTH = 1.01;
+        constexpr unsigned MAX_BUCKET_COUNT = 4096u;
+
+        unsigned ToBucketIndex(double value_ms)
+        {
+            const double bucket = std::floor(std::log(value_ms / LOWEST_TRACKED_MS) / std::log(BUCKET_GROWTH));
+            return static_cast<unsigned>((std::clamp)(bucket, 0.0, static_cast<double>(MAX_BUCKET_COUNT - 1u)));
+        }
+
+        // Geometric midpoint of the bucket, the value with the smallest worst-case relative error.
+        double GetBucketValue(unsigned bucket_index)
+        {
+            return LOWEST_TRACKED_MS * std::pow(BUCKET_GROWTH, static_cast<double>(bucket_index) + 0.5);
+        }
+    }
+
+    void PerfDistribution::Reset()
+    {
+        *this = PerfDistribution{};
+    }
+
+    void PerfDistribution::AddSample(double value_ms)
+    {
+        if (!std::isfinite(value_ms))
+        {
+            return;
+        }
+        value_ms = (std::max)(value_ms, 0.0);
+
+        ++m_sample_count;
+        const double delta = value_ms - m_mean;
+        m_mean += delta / static_cast<double>(m_sample_count);
+        m_m2 += delta * (value_ms - m_mean);
+        m_min = m_sample_count == 1u ? value_ms : (std::min)(m_min, value_ms);
+        m_max = m_sample_count == 1u ? value_ms : (std::max)(m_max, value_ms);
+
+        if (value_ms <= LOWEST_TRACKED_MS)
+        {
+            ++m_underflow_count;
+            return;
+        }
+        const unsigned bucket_index = ToBucketIndex(value_ms);
+        if (bucket_index >= m_bucket_counts.size())
+        {
+            m_bucket_counts.resize(bucket_index + 1u, 0u);
+        }
+        ++m_bucket_counts[bucket_index];
+    }
+
+    double PerfDistribution::GetStandardDeviation() const
+    {
+        return m_sample_count > 1u ? std::sqrt(m_m2 / static_cast<double>(m_sample_count - 1u)) : 0.0;
+    }
+
+    double PerfDistribution::GetPercentile(double percentile) const
+    {
+        if (m_sample_count == 0u)
+        {
+            return 0.0;
+        }
+
+        // Nearest-rank: the smallest sample with at least percentile% of the samples at or below it.
+        const double clamped_percentile = (std::clamp)(percentile, 0.0, 100.0);
+        const unsigned rank = (std::max)(1u,
+            static_cast<unsigned>(std::ceil(clamped_percentile / 100.0 * static_cast<double>(m_sample_count))));
+        if (rank >= m_sample_count)
+        {
+            return m_max;
+        }
+
+        unsigned cumulative_count = m_underflow_count;
+        if (cumulative_count >= rank)
+        {
+            return m_min;
+        }
+        for (unsigned bucket_index = 0; bucket_index < m_bucket_counts.size(); ++bucket_index)
+        {
+            cumulative_count += m_bucket_counts[bucket_index];
+            if (cumulative_count >= rank)
+            {
+                return (std::clamp)(GetBucketValue(bucket_index), m_min, m_max);
+            }
+        }
+        return m_max;
+    }
+
+    nlohmann::json PerfDistribution::ToJson() const
+    {
+        if (m_sample_count == 0u)
+        {
+            return nullptr;
+        }
+
+        nlohmann::json result{};
+        result["count"] = m_sample_count;
+        result["avg_ms"] = m_mean;
+        result["stddev_ms"] = GetStandardDeviation();
+        result["min_ms"] = m_min;
+        result["p50_ms"] = GetPercentile(50.0);
+        result["p90_ms"] = GetPercentile(90.0);
+        result["p99_ms"] = GetPercentile(99.0);
+        result["max_ms"] = m_max;
+        return result;
+    }
+}
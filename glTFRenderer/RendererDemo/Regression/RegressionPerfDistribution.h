@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include "nlohmann_json/single_include/nlohmann/json.hpp"
+
+namespace Regression
+{
+    // Streaming distribution of a timing metric in milliseconds. Samples land in logarithmic buckets of
+    // fixed relative width, like an HDR histogram, so memory does not grow with the case length and
+    // percentiles stay within about one percent of the recorded value at any magnitude. Count, mean,
+    // standard deviation, min and max are exact.
+    class PerfDistribution
+    {
+    public:
+        void Reset();
+        void AddSample(double value_ms);
+
+        unsigned GetSampleCount() const { return m_sample_count; }
+        double GetMean() const { return m_mean; }
+        double GetStandardDeviation() const;
+        double GetMin() const { return m_min; }
+        double GetMax() const { return m_max; }
+        // percentile in [0, 100]; 0 when no sample was added.
+        double GetPercentile(double percentile) const;
+
+        // {count, avg_ms, stddev_ms, min_ms, p50_ms, p90_ms, p99_ms, max_ms}, or null without samples.
+        nlohmann::json ToJson() const;
+
+    private:
+        unsigned m_sample_count{0};
+        double m_mean{0.0};
+        // Running sum of squared deviations from the mean (Welford).
+        double m_m2{0.0};
+        double m_min{0.0};
+        double m_max{0.0};
+        // Samples at or below the lowest bucket bound, including zero-length spans.
+        unsigned m_underflow_count{0};
+        // Grown on demand up to the highest bucket a sample reached.
+        std::vector<unsigned> m_bucket_counts;
+    };
+}
@@ -0,0 +1,63 @@
+#include "RenderGraphReplay.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "RendererInterface.h"
+
+namespace Regression
+{
+    int RunRenderGraphPlannerBenchmark()
+    {
+        bool all_sorted = true;
+        for (const unsigned pass_count : {100u, 500u})
+        {
+            const auto result = RendererInterface::RenderGraph::BenchmarkExecutionPlanning(pass_count, 200);
+            std::printf("[INFO] Render graph planner: passes=%u edges=%u sorted=%d full_plan=%.3f ms cached_lookup=%.3f ms\n",
+                        result.pass_count,
+                        result.edge_count,
+                        result.sorted ? 1 : 0,
+                        result.full_plan_ms,
+                        result.cached_lookup_ms);
+            all_sorted = all_sorted && result.sorted;
+        }
+
+        std::vector<std::string> uncovered_fields;
+        const bool key_covered = RendererInterface::RenderGraph::VerifyDrawValidationKeyCoverage(uncovered_fields);
+        for (const auto& field : uncovered_fields)
+        {
+            std::printf("[ERROR] Draw validation cache key ignores %s.\n", field.c_str());
+        }
+        std::printf("[INFO] Draw validation cache key coverage: %s\n", key_covered ? "ok" : "failed");
+        return all_sorted && key_covered ? 0 : 1;
+    }
+
+    int RunRenderGraphSnapshotReplay(const std::string& snapshot_path)
+    {
+        const auto result = RendererInterface::RenderGraph::ReplayExecutionPlanningSnapshot(snapshot_path, 100);
+        if (!result.loaded)
+        {
+            std::printf("[ERROR] %s\n", result.report.c_str());
+            return 1;
+        }
+
+        std::printf("%s", result.report.c_str());
+        std::printf("[INFO] Render graph replay: signature=%.3f ms plan=%.3f ms sort=%.3f ms cull=%.3f ms "
+                    "barriers=%.3f ms aliasing=%.3f ms queues=%.3f ms render passes=%.3f ms\n",
+                    result.signature_ms,
+                    result.plan_ms,
+                    result.sort_ms,
+                    result.cull_ms,
+                    result.barrier_plan_ms,
+                    result.aliasing_plan_ms,
+                    result.queue_schedule_ms,
+                    result.render_pass_merge_ms);
+        if (result.null_rhi_validation_error_count > 0)
+        {
+            std::printf("[ERROR] Render graph replay: %llu null RHI barrier validation error(s).\n",
+                        result.null_rhi_validation_error_count);
+        }
+        return result.sorted && result.null_rhi_recorded && result.null_rhi_validation_error_count == 0 ? 0 : 1;
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+// Headless render graph tooling. Nothing here creates a window, initializes GLFW or selects a graphics API;
+// recording runs on the null RHI, so these entry points can move into a standalone target that links
+// RendererCore alone.
+namespace Regression
+{
+    // Plans synthetic graphs of increasing size and prints the planner timings, then checks that the draw
+    // validation cache key covers every field the validator reads. Returns the process exit code.
+    int RunRenderGraphPlannerBenchmark();
+
+    // Replays a snapshot saved from the render graph debug UI through the planner and the null RHI barrier
+    // recorder. Fails when the snapshot does not load, does not sort or trips null RHI barrier validation.
+    int RunRenderGraphSnapshotReplay(const std::string& snapshot_path);
+}
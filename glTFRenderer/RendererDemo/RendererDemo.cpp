@@ -15,6 +15,8 @@
 #endif
 
 #include "DemoApps/DemoRegistry.h"
+#include "Regression/LightBVHCheck.h"
+#include "Regression/RenderGraphReplay.h"
 #include "RendererInterface.h"
 
 namespace
@@ -87,6 +89,18 @@ namespace
         return false;
     }
 
+    const char* GetArgumentValue(int argc, char* argv[], std::string_view expected)
+    {
+        for (int i = 1; i + 1 < argc; ++i)
+        {
+            if (argv[i] && EqualsIgnoreCase(argv[i], expected))
+            {
+                return argv[i + 1];
+            }
+        }
+        return nullptr;
+    }
+
     bool ShouldUseNonInteractiveAssertMode(int argc, char* argv[])
     {
         return HasArgument(argc, argv, "--no-assert-dialog") ||
@@ -222,6 +236,22 @@ int main(int argc, char* argv[])
         std::printf("[INFO] Non-interactive assert mode enabled.\n");
     }
 
+    // Headless modes run before anything touches the window or a device.
+    if (HasArgument(argc, argv, "--benchmark-render-graph-planner"))
+    {
+        return Regression::RunRenderGraphPlannerBenchmark();
+    }
+
+    if (HasArgument(argc, argv, "--benchmark-light-bvh"))
+    {
+        return Regression::RunLightBVHCheck();
+    }
+
+    if (const char* snapshot_path = GetArgumentValue(argc, argv, "--replay-render-graph-snapshot"))
+    {
+        return Regression::RunRenderGraphSnapshotReplay(snapshot_path);
+    }
+
     if (!SyncShaderResourcesForRuntime())
     {
         std::printf("[WARN] Shader sync skipped or failed.\n");
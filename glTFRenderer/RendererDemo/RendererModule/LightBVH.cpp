@@ -0,0 +1,521 @@
+#include "LightBVH.h"
+#include "RendererModuleLighting.h"
+#include "RendererCommon.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <glm/glm/gtx/norm.hpp>
+
+namespace
+{
+    constexpr float PI = 3.14159265f;
+    constexpr float HALF_PI = 0.5f * PI;
+    constexpr unsigned SPLIT_BIN_COUNT = 12;
+    constexpr float ONE_MINUS_EPSILON = 0.99999994f;
+
+    float ComputeLuminance(const glm::fvec3& color)
+    {
+        return (std::max)(0.2126f * color.x + 0.7152f * color.y + 0.0722f * color.z, 0.0f);
+    }
+
+    float SafeAcos(float value)
+    {
+        return std::acos((std::min)((std::max)(value, -1.0f), 1.0f));
+    }
+
+    float ComputeSurfaceArea(const glm::fvec3& bounds_min, const glm::fvec3& bounds_max)
+    {
+        const glm::fvec3 extent = bounds_max - bounds_min;
+        return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+
+    // Rotate vector around unit axis by angle (Rodrigues).
+    glm::fvec3 Rotate(const glm::fvec3& vector, const glm::fvec3& axis, float angle)
+    {
+        const float cos_angle = std::cos(angle);
+        const float sin_angle = std::sin(angle);
+        return vector * cos_angle + glm::cross(axis, vector) * sin_angle + axis * (glm::dot(axis, vector) * (1.0f - cos_angle));
+    }
+
+    LightBVH::OrientationCone UnionCones(LightBVH::OrientationCone lhs, LightBVH::OrientationCone rhs)
+    {
+        if (rhs.theta_o > lhs.theta_o)
+        {
+            std::swap(lhs, rhs);
+        }
+
+        const float theta_d = SafeAcos(glm::dot(lhs.axis, rhs.axis));
+        const float theta_e = (std::max)(lhs.theta_e, rhs.theta_e);
+        if ((std::min)(theta_d + rhs.theta_o, PI) <= lhs.theta_o)
+        {
+            return {lhs.axis, lhs.theta_o, theta_e};
+        }
+
+        const float theta_o = 0.5f * (lhs.theta_o + theta_d + rhs.theta_o);
+        if (theta_o >= PI)
+        {
+            return {lhs.axis, PI, theta_e};
+        }
+
+        const glm::fvec3 rotation_axis = glm::cross(lhs.axis, rhs.axis);
+        const float rotation_axis_length = glm::length(rotation_axis);
+        if (rotation_axis_length < 1.0e-6f)
+        {
+            return {lhs.axis, PI, theta_e};
+        }
+
+        const glm::fvec3 axis = Rotate(lhs.axis, rotation_axis * (1.0f / rotation_axis_length), theta_o - lhs.theta_o);
+        return {glm::normalize(axis), theta_o, theta_e};
+    }
+
+    // Solid angle measure of a cone of normals widened by the emission falloff (M_Omega in the SAOH).
+    float ComputeOrientationMeasure(const LightBVH::OrientationCone& cone)
+    {
+        const float theta_w = (std::min)(cone.theta_o + cone.theta_e, PI);
+        const float sin_theta_o = std::sin(cone.theta_o);
+        const float cos_theta_o = std::cos(cone.theta_o);
+        return 2.0f * PI * (1.0f - cos_theta_o) +
+            HALF_PI * (2.0f * theta_w * sin_theta_o - std::cos(cone.theta_o - 2.0f * theta_w) - 2.0f * cone.theta_o * sin_theta_o + cos_theta_o);
+    }
+
+    struct NodeBounds
+    {
+        glm::fvec3 bounds_min{FLT_MAX};
+        glm::fvec3 bounds_max{-FLT_MAX};
+        float power{0.0f};
+        LightBVH::OrientationCone cone{};
+        bool has_cone{false};
+        unsigned count{0};
+
+        void Add(const LightBVH::Node& node)
+        {
+            bounds_min = glm::min(bounds_min, node.bounds_min);
+            bounds_max = glm::max(bounds_max, node.bounds_max);
+            power += node.power;
+            cone = has_cone ? UnionCones(cone, node.cone) : node.cone;
+            has_cone = true;
+            ++count;
+        }
+
+        void Add(const NodeBounds& other)
+        {
+            if (other.count == 0)
+            {
+                return;
+            }
+            bounds_min = glm::min(bounds_min, other.bounds_min);
+            bounds_max = glm::max(bounds_max, other.bounds_max);
+            power += other.power;
+            cone = has_cone ? UnionCones(cone, other.cone) : other.cone;
+            has_cone = true;
+            count += other.count;
+        }
+
+        float ComputeCost(float axis_regularization) const
+        {
+            if (count == 0)
+            {
+                return 0.0f;
+            }
+            return axis_regularization * power * ComputeSurfaceArea(bounds_min, bounds_max) * ComputeOrientationMeasure(cone);
+        }
+    };
+}
+
+void LightBVH::Build(const std::vector<LightInfo>& lights)
+{
+    Clear();
+    m_light_to_leaf.assign(lights.size(), INVALID_INDEX);
+
+    std::vector<BuildPrimitive> primitives;
+    primitives.reserve(lights.size());
+    for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+    {
+        const LightInfo& light = lights[light_index];
+        if (light.type == Directional)
+        {
+            m_infinite_lights.push_back(light_index);
+            m_infinite_light_powers.push_back(ComputeLuminance(light.intensity));
+            m_infinite_power += m_infinite_light_powers.back();
+            continue;
+        }
+
+        Node leaf{};
+        leaf.bounds_min = light.position;
+        leaf.bounds_max = light.position;
+        leaf.max_radius = light.radius;
+        leaf.power = ComputeLuminance(light.intensity);
+        leaf.light_index = light_index;
+        primitives.push_back({light_index, leaf});
+    }
+
+    m_stats.local_light_count = static_cast<unsigned>(primitives.size());
+    m_stats.infinite_light_count = static_cast<unsigned>(m_infinite_lights.size());
+    if (primitives.empty())
+    {
+        return;
+    }
+
+    m_nodes.reserve(2 * primitives.size() - 1);
+    m_nodes.emplace_back();
+    BuildNode(0, primitives, 0, static_cast<unsigned>(primitives.size()), 1);
+    m_stats.node_count = static_cast<unsigned>(m_nodes.size());
+}
+
+void LightBVH::BuildNode(unsigned node_index, std::vector<BuildPrimitive>& primitives, unsigned begin, unsigned end, unsigned depth)
+{
+    m_stats.max_depth = (std::max)(m_stats.max_depth, depth);
+
+    if (end - begin == 1)
+    {
+        const unsigned parent_index = m_nodes[node_index].parent_index;
+        m_nodes[node_index] = primitives[begin].leaf;
+        m_nodes[node_index].parent_index = parent_index;
+        m_light_to_leaf[primitives[begin].light_index] = node_index;
+        return;
+    }
+
+    NodeBounds centroid_bounds{};
+    for (unsigned index = begin; index < end; ++index)
+    {
+        centroid_bounds.Add(primitives[index].leaf);
+    }
+    const glm::fvec3 centroid_extent = centroid_bounds.bounds_max - centroid_bounds.bounds_min;
+    const float max_extent = (std::max)(centroid_extent.x, (std::max)(centroid_extent.y, centroid_extent.z));
+
+    // Binned SAOH: cost of a split is sum(power * area * M_Omega) of both sides, with a penalty
+    // for thin axes so splits do not produce long slivers.
+    int best_axis = -1;
+    unsigned best_split_bin = 0;
+    float best_cost = FLT_MAX;
+    for (int axis = 0; axis < 3 && max_extent > 0.0f; ++axis)
+    {
+        if (centroid_extent[axis] <= 0.0f)
+        {
+            continue;
+        }
+
+        NodeBounds bins[SPLIT_BIN_COUNT]{};
+        const float bin_scale = SPLIT_BIN_COUNT / centroid_extent[axis];
+        for (unsigned index = begin; index < end; ++index)
+        {
+            const float offset = primitives[index].leaf.bounds_min[axis] - centroid_bounds.bounds_min[axis];
+            const unsigned bin = (std::min)(static_cast<unsigned>(offset * bin_scale), SPLIT_BIN_COUNT - 1);
+            bins[bin].Add(primitives[index].leaf);
+        }
+
+        NodeBounds suffix_bounds[SPLIT_BIN_COUNT]{};
+        suffix_bounds[SPLIT_BIN_COUNT - 1] = bins[SPLIT_BIN_COUNT - 1];
+        for (int bin = SPLIT_BIN_COUNT - 2; bin >= 0; --bin)
+        {
+            suffix_bounds[bin] = suffix_bounds[bin + 1];
+            suffix_bounds[bin].Add(bins[bin]);
+        }
+
+        const float axis_regularization = max_extent / centroid_extent[axis];
+        NodeBounds prefix_bounds{};
+        for (unsigned split_bin = 0; split_bin + 1 < SPLIT_BIN_COUNT; ++split_bin)
+        {
+            prefix_bounds.Add(bins[split_bin]);
+            if (prefix_bounds.count == 0 || suffix_bounds[split_bin + 1].count == 0)
+            {
+                continue;
+            }
+
+            const float cost = prefix_bounds.ComputeCost(axis_regularization) + suffix_bounds[split_bin + 1].ComputeCost(axis_regularization);
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_axis = axis;
+                best_split_bin = split_bin;
+            }
+        }
+    }
+
+    unsigned middle = begin + (end - begin) / 2;
+    if (best_axis >= 0)
+    {
+        const float bin_scale = SPLIT_BIN_COUNT / centroid_extent[best_axis];
+        const auto split_it = std::partition(primitives.begin() + begin, primitives.begin() + end, [&](const BuildPrimitive& primitive)
+        {
+            const float offset = primitive.leaf.bounds_min[best_axis] - centroid_bounds.bounds_min[best_axis];
+            return (std::min)(static_cast<unsigned>(offset * bin_scale), SPLIT_BIN_COUNT - 1) <= best_split_bin;
+        });
+        middle = static_cast<unsigned>(split_it - primitives.begin());
+    }
+    else
+    {
+        // Coincident lights: any split is as good as another, keep the tree balanced.
+        std::nth_element(primitives.begin() + begin, primitives.begin() + middle, primitives.begin() + end,
+            [](const BuildPrimitive& lhs, const BuildPrimitive& rhs) { return lhs.light_index < rhs.light_index; });
+    }
+    GLTF_CHECK(middle > begin && middle < end);
+
+    // Children are allocated together and after their parent, so a reverse sweep over the node
+    // array visits children before parents during refit.
+    const unsigned child_index = static_cast<unsigned>(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes.emplace_back();
+    m_nodes[node_index].child_index = child_index;
+    m_nodes[node_index].light_index = INVALID_INDEX;
+    m_nodes[child_index].parent_index = node_index;
+    m_nodes[child_index + 1].parent_index = node_index;
+
+    BuildNode(child_index, primitives, begin, middle, depth + 1);
+    BuildNode(child_index + 1, primitives, middle, end, depth + 1);
+    UpdateInteriorNode(node_index);
+}
+
+bool LightBVH::Refit(const std::vector<LightInfo>& lights)
+{
+    if (lights.size() != m_light_to_leaf.size())
+    {
+        return false;
+    }
+
+    unsigned infinite_light_slot = 0;
+    m_infinite_power = 0.0f;
+    for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+    {
+        const LightInfo& light = lights[light_index];
+        const unsigned leaf_index = m_light_to_leaf[light_index];
+        if ((light.type == Directional) != (leaf_index == INVALID_INDEX))
+        {
+            return false;
+        }
+
+        if (leaf_index == INVALID_INDEX)
+        {
+            GLTF_CHECK(m_infinite_lights[infinite_light_slot] == light_index);
+            m_infinite_light_powers[infinite_light_slot] = ComputeLuminance(light.intensity);
+            m_infinite_power += m_infinite_light_powers[infinite_light_slot];
+            ++infinite_light_slot;
+            continue;
+        }
+
+        Node& leaf = m_nodes[leaf_index];
+        leaf.bounds_min = light.position;
+        leaf.bounds_max = light.position;
+        leaf.max_radius = light.radius;
+        leaf.power = ComputeLuminance(light.intensity);
+    }
+
+    for (unsigned node_index = static_cast<unsigned>(m_nodes.size()); node_index-- > 0;)
+    {
+        if (!m_nodes[node_index].IsLeaf())
+        {
+            UpdateInteriorNode(node_index);
+        }
+    }
+
+    return true;
+}
+
+void LightBVH::Clear()
+{
+    m_nodes.clear();
+    m_light_to_leaf.clear();
+    m_infinite_lights.clear();
+    m_infinite_light_powers.clear();
+    m_infinite_power = 0.0f;
+    m_stats = {};
+}
+
+bool LightBVH::Sample(const glm::fvec3& position, const glm::fvec3& normal, float u, SampleResult& out_result) const
+{
+    out_result = {};
+
+    const float infinite_probability = ComputeInfiniteSelectProbability();
+    if (u < infinite_probability)
+    {
+        u = (std::min)(u / infinite_probability, ONE_MINUS_EPSILON);
+        const unsigned infinite_count = static_cast<unsigned>(m_infinite_lights.size());
+        unsigned slot = infinite_count - 1;
+        if (m_infinite_power > 0.0f)
+        {
+            float cumulative = 0.0f;
+            for (unsigned index = 0; index < infinite_count; ++index)
+            {
+                cumulative += m_infinite_light_powers[index] / m_infinite_power;
+                if (u < cumulative)
+                {
+                    slot = index;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            slot = (std::min)(static_cast<unsigned>(u * infinite_count), infinite_count - 1);
+        }
+
+        out_result.light_index = m_infinite_lights[slot];
+        out_result.pdf = ComputeInfinitePdf(out_result.light_index);
+        return out_result.pdf > 0.0f;
+    }
+
+    if (m_nodes.empty() || ComputeNodeImportance(m_nodes[0], position, normal) <= 0.0f)
+    {
+        return false;
+    }
+
+    u = (std::min)((u - infinite_probability) / (1.0f - infinite_probability), ONE_MINUS_EPSILON);
+    float pdf = 1.0f - infinite_probability;
+    unsigned node_index = 0;
+    while (!m_nodes[node_index].IsLeaf())
+    {
+        const unsigned child_index = m_nodes[node_index].child_index;
+        const float left_importance = ComputeNodeImportance(m_nodes[child_index], position, normal);
+        const float right_importance = ComputeNodeImportance(m_nodes[child_index + 1], position, normal);
+        const float importance_sum = left_importance + right_importance;
+        if (importance_sum <= 0.0f)
+        {
+            return false;
+        }
+
+        // Reuse the remaining fraction of u for the next level instead of drawing a new number.
+        const float left_probability = left_importance / importance_sum;
+        if (u < left_probability)
+        {
+            u = (std::min)(u / left_probability, ONE_MINUS_EPSILON);
+            pdf *= left_probability;
+            node_index = child_index;
+        }
+        else
+        {
+            u = (std::min)((u - left_probability) / (1.0f - left_probability), ONE_MINUS_EPSILON);
+            pdf *= 1.0f - left_probability;
+            node_index = child_index + 1;
+        }
+    }
+
+    out_result.light_index = m_nodes[node_index].light_index;
+    out_result.pdf = pdf;
+    return pdf > 0.0f;
+}
+
+float LightBVH::ComputePdf(const glm::fvec3& position, const glm::fvec3& normal, unsigned light_index) const
+{
+    if (light_index >= m_light_to_leaf.size())
+    {
+        return 0.0f;
+    }
+
+    const unsigned leaf_index = m_light_to_leaf[light_index];
+    if (leaf_index == INVALID_INDEX)
+    {
+        return ComputeInfinitePdf(light_index);
+    }
+
+    if (ComputeNodeImportance(m_nodes[0], position, normal) <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    float pdf = 1.0f - ComputeInfiniteSelectProbability();
+    for (unsigned node_index = leaf_index; m_nodes[node_index].parent_index != INVALID_INDEX; node_index = m_nodes[node_index].parent_index)
+    {
+        const unsigned first_child_index = m_nodes[m_nodes[node_index].parent_index].child_index;
+        const unsigned sibling_index = node_index == first_child_index ? first_child_index + 1 : first_child_index;
+        const float importance = ComputeNodeImportance(m_nodes[node_index], position, normal);
+        const float importance_sum = importance + ComputeNodeImportance(m_nodes[sibling_index], position, normal);
+        if (importance <= 0.0f)
+        {
+            return 0.0f;
+        }
+        pdf *= importance / importance_sum;
+    }
+
+    return pdf;
+}
+
+void LightBVH::UpdateInteriorNode(unsigned node_index)
+{
+    Node& node = m_nodes[node_index];
+    const Node& left = m_nodes[node.child_index];
+    const Node& right = m_nodes[node.child_index + 1];
+    node.bounds_min = glm::min(left.bounds_min, right.bounds_min);
+    node.bounds_max = glm::max(left.bounds_max, right.bounds_max);
+    node.max_radius = (std::max)(left.max_radius, right.max_radius);
+    node.power = left.power + right.power;
+    node.cone = UnionCones(left.cone, right.cone);
+}
+
+float LightBVH::ComputeNodeImportance(const Node& node, const glm::fvec3& position, const glm::fvec3& normal) const
+{
+    if (node.power <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // Range cutoff: lights have a hard falloff radius, so the node is irrelevant past its largest radius.
+    const glm::fvec3 closest_point = glm::clamp(position, node.bounds_min, node.bounds_max);
+    if (glm::length2(position - closest_point) > node.max_radius * node.max_radius)
+    {
+        return 0.0f;
+    }
+
+    const glm::fvec3 center = (node.bounds_min + node.bounds_max) * 0.5f;
+    const float half_diagonal_sq = 0.25f * glm::length2(node.bounds_max - node.bounds_min);
+    const glm::fvec3 to_position = position - center;
+    const float distance_sq = glm::length2(to_position);
+    if (distance_sq <= half_diagonal_sq || distance_sq <= 0.0f)
+    {
+        // Shading point inside the bounding sphere: every direction is possible.
+        return node.power / (std::max)(half_diagonal_sq, 1.0e-6f);
+    }
+
+    const float distance = std::sqrt(distance_sq);
+    const glm::fvec3 direction = to_position * (1.0f / distance);
+    // Half angle subtended by the bounding sphere of the node.
+    const float theta_u = std::asin((std::min)(std::sqrt(half_diagonal_sq / distance_sq), 1.0f));
+
+    float cos_emitter = 1.0f;
+    if (node.cone.theta_o < PI)
+    {
+        const float theta = SafeAcos(glm::dot(node.cone.axis, direction));
+        const float theta_prime = (std::max)(theta - node.cone.theta_o - theta_u, 0.0f);
+        if (theta_prime >= node.cone.theta_e)
+        {
+            return 0.0f;
+        }
+        cos_emitter = std::cos(theta_prime);
+    }
+
+    float cos_receiver = 1.0f;
+    if (glm::length2(normal) > 0.0f)
+    {
+        const float theta_i = SafeAcos(-glm::dot(glm::normalize(normal), direction));
+        const float theta_i_prime = (std::max)(theta_i - theta_u, 0.0f);
+        if (theta_i_prime >= HALF_PI)
+        {
+            return 0.0f;
+        }
+        cos_receiver = std::cos(theta_i_prime);
+    }
+
+    return node.power * cos_emitter * cos_receiver / (std::max)(distance_sq, half_diagonal_sq);
+}
+
+float LightBVH::ComputeInfiniteSelectProbability() const
+{
+    if (m_infinite_lights.empty())
+    {
+        return 0.0f;
+    }
+    return m_nodes.empty() ? 1.0f : 0.5f;
+}
+
+float LightBVH::ComputeInfinitePdf(unsigned light_index) const
+{
+    const auto it = std::find(m_infinite_lights.begin(), m_infinite_lights.end(), light_index);
+    if (it == m_infinite_lights.end())
+    {
+        return 0.0f;
+    }
+
+    const float light_probability = m_infinite_power > 0.0f ?
+        m_infinite_light_powers[it - m_infinite_lights.begin()] / m_infinite_power :
+        1.0f / static_cast<float>(m_infinite_lights.size());
+    return ComputeInfiniteSelectProbability() * light_probability;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <vector>
+#include <glm/glm/glm.hpp>
+
+struct LightInfo;
+
+// Light-cone tree over local lights for importance sampled light selection. Every node bounds the
+// position, emission direction and power of its lights; traversal picks a child with probability
+// proportional to its estimated contribution to the shading point, so selecting a light costs
+// O(log n). Unbounded (directional) lights are kept beside the tree and sampled by power.
+class LightBVH
+{
+public:
+    // Emission normals lie within theta_o of axis; emission falls off to zero theta_e beyond the
+    // normals. Angles in radians. Point lights are omnidirectional: theta_o = pi, theta_e = pi / 2.
+    struct OrientationCone
+    {
+        glm::fvec3 axis{0.0f, 0.0f, 1.0f};
+        float theta_o{3.14159265f};
+        float theta_e{1.57079633f};
+    };
+
+    struct Node
+    {
+        glm::fvec3 bounds_min{0.0f};
+        // Largest influence radius of the lights below; points farther than this from the
+        // bounds receive nothing from the node.
+        float max_radius{0.0f};
+        glm::fvec3 bounds_max{0.0f};
+        float power{0.0f};
+        OrientationCone cone{};
+        // Interior: children at child_index and child_index + 1. Leaf: light_index, child_index = INVALID_INDEX.
+        unsigned child_index{INVALID_INDEX};
+        unsigned light_index{INVALID_INDEX};
+        unsigned parent_index{INVALID_INDEX};
+
+        bool IsLeaf() const { return child_index == INVALID_INDEX; }
+    };
+
+    struct Stats
+    {
+        unsigned node_count{0};
+        unsigned local_light_count{0};
+        unsigned infinite_light_count{0};
+        unsigned max_depth{0};
+    };
+
+    struct SampleResult
+    {
+        unsigned light_index{INVALID_INDEX};
+        float pdf{0.0f};
+    };
+
+    static constexpr unsigned INVALID_INDEX = 0xffffffffu;
+
+    // Full rebuild with a binned surface area orientation heuristic; needed when lights are added,
+    // removed or change type.
+    void Build(const std::vector<LightInfo>& lights);
+    // Recomputes node bounds bottom-up for moved or re-tinted lights, keeping the topology.
+    // Returns false if the light set no longer matches the tree and a rebuild is required.
+    bool Refit(const std::vector<LightInfo>& lights);
+    void Clear();
+
+    // Picks one light for a shading point. u is uniform in [0, 1). Returns false when no light can
+    // contribute. pdf is the discrete probability of the selected light.
+    bool Sample(const glm::fvec3& position, const glm::fvec3& normal, float u, SampleResult& out_result) const;
+    // Discrete probability that Sample() returns light_index at this shading point (for MIS).
+    float ComputePdf(const glm::fvec3& position, const glm::fvec3& normal, unsigned light_index) const;
+
+    const std::vector<Node>& GetNodes() const { return m_nodes; }
+    const Stats& GetStats() const { return m_stats; }
+    bool IsEmpty() const { return m_nodes.empty() && m_infinite_lights.empty(); }
+
+private:
+    // Leaf data of one local light, gathered once per build.
+    struct BuildPrimitive
+    {
+        unsigned light_index;
+        Node leaf;
+    };
+
+    void BuildNode(unsigned node_index, std::vector<BuildPrimitive>& primitives, unsigned begin, unsigned end, unsigned depth);
+    void UpdateInteriorNode(unsigned node_index);
+    float ComputeNodeImportance(const Node& node, const glm::fvec3& position, const glm::fvec3& normal) const;
+    float ComputeInfiniteSelectProbability() const;
+    float ComputeInfinitePdf(unsigned light_index) const;
+
+    std::vector<Node> m_nodes;
+    // Leaf node per light index, INVALID_INDEX for lights that are not in the tree.
+    std::vector<unsigned> m_light_to_leaf;
+    std::vector<unsigned> m_infinite_lights;
+    std::vector<float> m_infinite_light_powers;
+    float m_infinite_power{0.0f};
+    Stats m_stats{};
+};
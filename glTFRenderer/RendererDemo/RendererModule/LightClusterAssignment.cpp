@@ -0,0 +1,226 @@
+#include "LightClusterAssignment.h"
+#include "RendererModuleLighting.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    struct ClusterBounds
+    {
+        glm::fvec3 min;
+        glm::fvec3 max;
+    };
+
+    unsigned ClampToTile(float normalized, unsigned tile_count)
+    {
+        const float tile = std::floor(normalized * static_cast<float>(tile_count));
+        if (tile <= 0.0f)
+        {
+            return 0;
+        }
+        return (std::min)(static_cast<unsigned>(tile), tile_count - 1);
+    }
+
+    float SliceDepth(const LightClusterAssignment::ViewDesc& view, unsigned slice, unsigned slice_count)
+    {
+        const float t = static_cast<float>(slice) / static_cast<float>(slice_count);
+        return view.near_z * std::pow(view.far_z / view.near_z, t);
+    }
+
+    ClusterBounds ComputeClusterBounds(
+        const LightClusterAssignment::GridDesc& grid,
+        const LightClusterAssignment::ViewDesc& view,
+        unsigned tile_x,
+        unsigned tile_y,
+        float slice_near,
+        float slice_far)
+    {
+        const float ndc_min_x = 2.0f * static_cast<float>(tile_x) / static_cast<float>(grid.tile_count_x) - 1.0f;
+        const float ndc_max_x = 2.0f * static_cast<float>(tile_x + 1) / static_cast<float>(grid.tile_count_x) - 1.0f;
+        // Tile rows grow downwards on screen while ndc y grows upwards.
+        const float ndc_max_y = 1.0f - 2.0f * static_cast<float>(tile_y) / static_cast<float>(grid.tile_count_y);
+        const float ndc_min_y = 1.0f - 2.0f * static_cast<float>(tile_y + 1) / static_cast<float>(grid.tile_count_y);
+
+        ClusterBounds bounds{};
+        bounds.min = {
+            (std::min)(ndc_min_x * slice_near, ndc_min_x * slice_far) * view.tan_half_fov_x,
+            (std::min)(ndc_min_y * slice_near, ndc_min_y * slice_far) * view.tan_half_fov_y,
+            slice_near};
+        bounds.max = {
+            (std::max)(ndc_max_x * slice_near, ndc_max_x * slice_far) * view.tan_half_fov_x,
+            (std::max)(ndc_max_y * slice_near, ndc_max_y * slice_far) * view.tan_half_fov_y,
+            slice_far};
+        return bounds;
+    }
+
+    bool SphereIntersectsBounds(const glm::fvec3& center, float radius, const ClusterBounds& bounds)
+    {
+        const glm::fvec3 closest = glm::clamp(center, bounds.min, bounds.max);
+        const glm::fvec3 delta = closest - center;
+        return glm::dot(delta, delta) <= radius * radius;
+    }
+}
+
+namespace LightClusterAssignment
+{
+    unsigned ComputeDepthSlice(const GridDesc& grid, const ViewDesc& view, float view_depth)
+    {
+        if (view_depth <= view.near_z || grid.depth_slice_count <= 1)
+        {
+            return 0;
+        }
+
+        const float slice = std::log(view_depth / view.near_z) * static_cast<float>(grid.depth_slice_count) /
+            std::log(view.far_z / view.near_z);
+        return (std::min)(static_cast<unsigned>((std::max)(slice, 0.0f)), grid.depth_slice_count - 1);
+    }
+
+    unsigned ComputeClusterIndex(const GridDesc& grid, unsigned tile_x, unsigned tile_y, unsigned slice)
+    {
+        return (slice * grid.tile_count_y + tile_y) * grid.tile_count_x + tile_x;
+    }
+
+    bool Build(const std::vector<LightInfo>& lights, const ViewDesc& view, const GridDesc& grid, Result& out_result)
+    {
+        const unsigned cluster_count = grid.GetClusterCount();
+        if (cluster_count == 0 || view.near_z <= 0.0f || view.far_z <= view.near_z ||
+            view.tan_half_fov_x <= 0.0f || view.tan_half_fov_y <= 0.0f)
+        {
+            return false;
+        }
+
+        out_result.cluster_ranges.assign(cluster_count, ClusterRange{});
+        out_result.light_indices.clear();
+        out_result.assigned_light_reference_count = 0;
+        out_result.dropped_light_reference_count = 0;
+        out_result.max_cluster_light_count = 0;
+        out_result.culled_light_count = 0;
+
+        const float log_depth_range = std::log(view.far_z / view.near_z);
+        auto& constants = out_result.constants;
+        constants.grid_size[0] = grid.tile_count_x;
+        constants.grid_size[1] = grid.tile_count_y;
+        constants.grid_size[2] = grid.depth_slice_count;
+        constants.viewport_size[0] = (std::max)(1u, view.viewport_width);
+        constants.viewport_size[1] = (std::max)(1u, view.viewport_height);
+        constants.depth_slice_scale = static_cast<float>(grid.depth_slice_count) / log_depth_range;
+        constants.depth_slice_bias = std::log(view.near_z) * constants.depth_slice_scale;
+
+        for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+        {
+            if (lights[light_index].type == LightType::Directional)
+            {
+                out_result.light_indices.push_back(light_index);
+            }
+        }
+        constants.global_light_count = static_cast<unsigned>(out_result.light_indices.size());
+
+        std::vector<float> slice_depths(grid.depth_slice_count + 1);
+        for (unsigned slice = 0; slice <= grid.depth_slice_count; ++slice)
+        {
+            slice_depths[slice] = SliceDepth(view, slice, grid.depth_slice_count);
+        }
+
+        // (cluster, light) pairs in ascending light order; compacted with a counting sort below.
+        std::vector<std::pair<unsigned, unsigned>> cluster_light_pairs;
+        std::vector<unsigned> cluster_counts(cluster_count, 0);
+        for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+        {
+            const auto& light = lights[light_index];
+            if (light.type != LightType::Point)
+            {
+                continue;
+            }
+
+            const glm::fvec3 center = glm::fvec3(view.view_matrix * glm::fvec4(light.position, 1.0f));
+            const float radius = (std::max)(light.radius, 0.0f);
+            if (radius <= 0.0f || center.z + radius < view.near_z || center.z - radius > view.far_z)
+            {
+                ++out_result.culled_light_count;
+                continue;
+            }
+
+            const float depth_min = (std::max)(center.z - radius, view.near_z);
+            const float depth_max = (std::min)(center.z + radius, view.far_z);
+            const unsigned slice_begin = ComputeDepthSlice(grid, view, depth_min);
+            const unsigned slice_end = ComputeDepthSlice(grid, view, depth_max);
+
+            // x/z is extremal at the corners of the [x +- r] x [depth_min, depth_max] rectangle.
+            float ndc_min_x = (std::numeric_limits<float>::max)();
+            float ndc_max_x = (std::numeric_limits<float>::lowest)();
+            float ndc_min_y = (std::numeric_limits<float>::max)();
+            float ndc_max_y = (std::numeric_limits<float>::lowest)();
+            for (const float depth : {depth_min, depth_max})
+            {
+                for (const float sign : {-1.0f, 1.0f})
+                {
+                    const float ndc_x = (center.x + sign * radius) / (depth * view.tan_half_fov_x);
+                    const float ndc_y = (center.y + sign * radius) / (depth * view.tan_half_fov_y);
+                    ndc_min_x = (std::min)(ndc_min_x, ndc_x);
+                    ndc_max_x = (std::max)(ndc_max_x, ndc_x);
+                    ndc_min_y = (std::min)(ndc_min_y, ndc_y);
+                    ndc_max_y = (std::max)(ndc_max_y, ndc_y);
+                }
+            }
+            if (ndc_max_x < -1.0f || ndc_min_x > 1.0f || ndc_max_y < -1.0f || ndc_min_y > 1.0f)
+            {
+                ++out_result.culled_light_count;
+                continue;
+            }
+
+            const unsigned tile_begin_x = ClampToTile(ndc_min_x * 0.5f + 0.5f, grid.tile_count_x);
+            const unsigned tile_end_x = ClampToTile(ndc_max_x * 0.5f + 0.5f, grid.tile_count_x);
+            const unsigned tile_begin_y = ClampToTile(0.5f - 0.5f * ndc_max_y, grid.tile_count_y);
+            const unsigned tile_end_y = ClampToTile(0.5f - 0.5f * ndc_min_y, grid.tile_count_y);
+            for (unsigned slice = slice_begin; slice <= slice_end; ++slice)
+            {
+                for (unsigned tile_y = tile_begin_y; tile_y <= tile_end_y; ++tile_y)
+                {
+                    for (unsigned tile_x = tile_begin_x; tile_x <= tile_end_x; ++tile_x)
+                    {
+                        const ClusterBounds bounds = ComputeClusterBounds(
+                            grid, view, tile_x, tile_y, slice_depths[slice], slice_depths[slice + 1]);
+                        if (!SphereIntersectsBounds(center, radius, bounds))
+                        {
+                            continue;
+                        }
+
+                        const unsigned cluster_index = ComputeClusterIndex(grid, tile_x, tile_y, slice);
+                        cluster_light_pairs.emplace_back(cluster_index, light_index);
+                        ++cluster_counts[cluster_index];
+                    }
+                }
+            }
+        }
+
+        const unsigned index_capacity = (std::max)(grid.max_light_index_count, constants.global_light_count);
+        unsigned next_offset = constants.global_light_count;
+        for (unsigned cluster_index = 0; cluster_index < cluster_count; ++cluster_index)
+        {
+            auto& range = out_result.cluster_ranges[cluster_index];
+            const unsigned available = index_capacity - next_offset;
+            range.offset = next_offset;
+            range.count = (std::min)(cluster_counts[cluster_index], available);
+            out_result.dropped_light_reference_count += cluster_counts[cluster_index] - range.count;
+            out_result.max_cluster_light_count = (std::max)(out_result.max_cluster_light_count, cluster_counts[cluster_index]);
+            next_offset += range.count;
+        }
+
+        out_result.light_indices.resize(next_offset);
+        std::fill(cluster_counts.begin(), cluster_counts.end(), 0u);
+        for (const auto& cluster_light : cluster_light_pairs)
+        {
+            const auto& range = out_result.cluster_ranges[cluster_light.first];
+            unsigned& written = cluster_counts[cluster_light.first];
+            if (written < range.count)
+            {
+                out_result.light_indices[range.offset + written] = cluster_light.second;
+                ++written;
+            }
+        }
+        out_result.assigned_light_reference_count = next_offset - constants.global_light_count;
+
+        return true;
+    }
+}
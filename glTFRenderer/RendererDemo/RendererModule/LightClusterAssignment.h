@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+#include <glm/glm/glm.hpp>
+
+struct LightInfo;
+
+namespace LightClusterAssignment
+{
+    struct GridDesc
+    {
+        unsigned tile_count_x{16};
+        unsigned tile_count_y{9};
+        unsigned depth_slice_count{24};
+        unsigned max_light_index_count{16 * 9 * 24 * 32};
+
+        unsigned GetClusterCount() const { return tile_count_x * tile_count_y * depth_slice_count; }
+    };
+
+    // Left-handed view space, +z forward. tan_half_fov_* matches ViewBuffer::projection_params.xy.
+    struct ViewDesc
+    {
+        glm::fmat4x4 view_matrix{1.0f};
+        float tan_half_fov_x{1.0f};
+        float tan_half_fov_y{1.0f};
+        float near_z{0.1f};
+        float far_z{1000.0f};
+        unsigned viewport_width{1};
+        unsigned viewport_height{1};
+    };
+
+    struct ClusterRange
+    {
+        unsigned offset{0};
+        unsigned count{0};
+    };
+
+    // GPU layout mirrors LightClusterConstantBuffer in RendererModuleLighting.hlsl.
+    struct ClusterConstants
+    {
+        unsigned grid_size[3]{0, 0, 0};
+        unsigned global_light_count{0};
+        unsigned viewport_size[2]{1, 1};
+        float depth_slice_scale{0.0f};
+        float depth_slice_bias{0.0f};
+    };
+    static_assert(sizeof(ClusterConstants) == 32, "ClusterConstants must match HLSL cbuffer layout.");
+
+    // Directional lights are unbounded and stored once at the head of light_indices
+    // ([0, global_light_count)); cluster ranges only reference local (point) lights.
+    struct Result
+    {
+        std::vector<ClusterRange> cluster_ranges;
+        std::vector<unsigned> light_indices;
+        ClusterConstants constants{};
+        unsigned assigned_light_reference_count{0};
+        unsigned dropped_light_reference_count{0};
+        unsigned max_cluster_light_count{0};
+        unsigned culled_light_count{0};
+    };
+
+    unsigned ComputeDepthSlice(const GridDesc& grid, const ViewDesc& view, float view_depth);
+    unsigned ComputeClusterIndex(const GridDesc& grid, unsigned tile_x, unsigned tile_y, unsigned slice);
+
+    // CPU reference implementation. Output is deterministic: per-cluster lists are
+    // ordered by ascending light index.
+    bool Build(const std::vector<LightInfo>& lights, const ViewDesc& view, const GridDesc& grid, Result& out_result);
+}
@@ -273,6 +273,23 @@ bool RendererModuleCamera::GetCameraPose(glm::fvec3& out_position, glm::fvec3& o
     return true;
 }
 
+bool RendererModuleCamera::GetViewFrustumParams(glm::fmat4x4& out_view_matrix, glm::fvec4& out_projection_params) const
+{
+    if (!m_camera)
+    {
+        return false;
+    }
+
+    const auto projection_matrix = m_camera->GetProjectionMatrix();
+    out_view_matrix = m_camera->GetViewMatrix();
+    out_projection_params = glm::fvec4(
+        1.0f / (std::max)(projection_matrix[0][0], 1.0e-6f),
+        1.0f / (std::max)(projection_matrix[1][1], 1.0e-6f),
+        m_camera->GetNearZPlane(),
+        m_camera->GetFarZPlane());
+    return true;
+}
+
 unsigned RendererModuleCamera::GetWidth() const
 {
     return m_camera->GetProjectionWidth();
@@ -34,6 +34,8 @@ public:
     bool SetViewportSize(unsigned width, unsigned height);
     bool SetCameraPose(const glm::fvec3& position, const glm::fvec3& euler_angles, bool reset_temporal_history = true);
     bool GetCameraPose(glm::fvec3& out_position, glm::fvec3& out_euler_angles);
+    // out_projection_params matches ViewBuffer::projection_params (tan half fov x/y, near, far).
+    bool GetViewFrustumParams(glm::fmat4x4& out_view_matrix, glm::fvec4& out_projection_params) const;
     unsigned GetWidth() const;
     unsigned GetHeight() const;
     bool ConsumeTemporalHistoryInvalidation();
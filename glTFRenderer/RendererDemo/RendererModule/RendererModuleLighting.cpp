@@ -1,4 +1,5 @@
 #include "RendererModuleLighting.h"
+#include <chrono>
 #include <cmath>
 #include <glm/glm/gtx/norm.hpp>
 
@@ -31,14 +32,41 @@ RendererModuleLighting::RendererModuleLighting(RendererInterface::ResourceOperat
     light_count_buffer_desc.type = RendererInterface::DEFAULT;
     light_count_buffer_desc.usage = RendererInterface::USAGE_CBV;
     m_light_count_buffer_handles = resource_operator.CreateFrameBufferedBuffers(light_count_buffer_desc, "LightInfoConstantBuffer");
+
+    std::vector<LightClusterAssignment::ClusterRange> empty_cluster_ranges(m_light_cluster_grid.GetClusterCount());
+    RendererInterface::BufferDesc cluster_range_buffer_desc{};
+    cluster_range_buffer_desc.name = "g_light_cluster_ranges";
+    cluster_range_buffer_desc.size = sizeof(LightClusterAssignment::ClusterRange) * empty_cluster_ranges.size();
+    cluster_range_buffer_desc.type = RendererInterface::DEFAULT;
+    cluster_range_buffer_desc.usage = RendererInterface::USAGE_SRV;
+    cluster_range_buffer_desc.data = empty_cluster_ranges.data();
+    m_light_cluster_range_buffer_handles = resource_operator.CreateFrameBufferedBuffers(cluster_range_buffer_desc, "g_light_cluster_ranges");
+
+    RendererInterface::BufferDesc cluster_index_buffer_desc{};
+    cluster_index_buffer_desc.name = "g_light_cluster_indices";
+    cluster_index_buffer_desc.size = sizeof(unsigned) * m_light_cluster_grid.max_light_index_count;
+    cluster_index_buffer_desc.type = RendererInterface::DEFAULT;
+    cluster_index_buffer_desc.usage = RendererInterface::USAGE_SRV;
+    m_light_cluster_index_buffer_handles = resource_operator.CreateFrameBufferedBuffers(cluster_index_buffer_desc, "g_light_cluster_indices");
+
+    LightClusterAssignment::ClusterConstants empty_cluster_constants{};
+    RendererInterface::BufferDesc cluster_constant_buffer_desc{};
+    cluster_constant_buffer_desc.name = "LightClusterConstantBuffer";
+    cluster_constant_buffer_desc.size = sizeof(LightClusterAssignment::ClusterConstants);
+    cluster_constant_buffer_desc.type = RendererInterface::DEFAULT;
+    cluster_constant_buffer_desc.usage = RendererInterface::USAGE_CBV;
+    cluster_constant_buffer_desc.data = &empty_cluster_constants;
+    m_light_cluster_constant_buffer_handles = resource_operator.CreateFrameBufferedBuffers(cluster_constant_buffer_desc, "LightClusterConstantBuffer");
 }
 
 unsigned RendererModuleLighting::AddLightInfo(const LightInfo& info)
 {
+    GLTF_CHECK(m_light_infos.size() < MAX_LIGHT_COUNT);
     unsigned index = m_light_infos.size();
     m_light_infos.push_back(info);
 
     m_need_upload_light_infos = true;
+    m_need_rebuild_light_bvh = true;
 
     return index;
 }
@@ -61,15 +89,48 @@ bool RendererModuleLighting::UpdateLightInfo(unsigned index, const LightInfo& in
         return true;
     }
 
+    // Moving lights keep the tree topology; a type change moves the light in or out of the tree.
+    if (m_light_infos[index].type != info.type)
+    {
+        m_need_rebuild_light_bvh = true;
+    }
     m_light_infos[index] = info;
     
     m_need_upload_light_infos = true;
+    m_need_refit_light_bvh = true;
     
     return true;
 }
 
+bool RendererModuleLighting::UpdateLightClusters(RendererInterface::ResourceOperator& resource_operator,
+    const LightClusterAssignment::ViewDesc& view_desc)
+{
+    RETURN_IF_FALSE(LightClusterAssignment::Build(m_light_infos, view_desc, m_light_cluster_grid, m_light_cluster_result))
+
+    RendererInterface::BufferUploadDesc cluster_range_upload_desc{};
+    cluster_range_upload_desc.data = m_light_cluster_result.cluster_ranges.data();
+    cluster_range_upload_desc.size = m_light_cluster_result.cluster_ranges.size() * sizeof(LightClusterAssignment::ClusterRange);
+    resource_operator.UploadFrameBufferedBufferData(m_light_cluster_range_buffer_handles, cluster_range_upload_desc);
+
+    if (!m_light_cluster_result.light_indices.empty())
+    {
+        RendererInterface::BufferUploadDesc cluster_index_upload_desc{};
+        cluster_index_upload_desc.data = m_light_cluster_result.light_indices.data();
+        cluster_index_upload_desc.size = m_light_cluster_result.light_indices.size() * sizeof(unsigned);
+        resource_operator.UploadFrameBufferedBufferData(m_light_cluster_index_buffer_handles, cluster_index_upload_desc);
+    }
+
+    RendererInterface::BufferUploadDesc cluster_constant_upload_desc{};
+    cluster_constant_upload_desc.data = &m_light_cluster_result.constants;
+    cluster_constant_upload_desc.size = sizeof(LightClusterAssignment::ClusterConstants);
+    resource_operator.UploadFrameBufferedBufferData(m_light_cluster_constant_buffer_handles, cluster_constant_upload_desc);
+
+    return true;
+}
+
 bool RendererModuleLighting::FinalizeModule(RendererInterface::ResourceOperator& resource_operator)
 {
+    UpdateLightBVH();
     UploadAllLightInfos(resource_operator);
     
     return true;
@@ -92,6 +153,31 @@ bool RendererModuleLighting::BindDrawCommands(RendererInterface::RenderPassDrawD
     light_count_binding_desc.binding_type = RendererInterface::BufferBindingDesc::CBV;
     light_count_binding_desc.buffer_handle = m_light_count_buffer_handles.front();
     out_draw_desc.buffer_resources["LightInfoConstantBuffer"] = light_count_binding_desc;
+
+    GLTF_CHECK(!m_light_cluster_range_buffer_handles.empty());
+    GLTF_CHECK(!m_light_cluster_index_buffer_handles.empty());
+    GLTF_CHECK(!m_light_cluster_constant_buffer_handles.empty());
+
+    RendererInterface::BufferBindingDesc cluster_range_binding_desc{};
+    cluster_range_binding_desc.binding_type = RendererInterface::BufferBindingDesc::SRV;
+    cluster_range_binding_desc.buffer_handle = m_light_cluster_range_buffer_handles.front();
+    cluster_range_binding_desc.stride = sizeof(LightClusterAssignment::ClusterRange);
+    cluster_range_binding_desc.is_structured_buffer = true;
+    cluster_range_binding_desc.count = m_light_cluster_grid.GetClusterCount();
+    out_draw_desc.buffer_resources["g_light_cluster_ranges"] = cluster_range_binding_desc;
+
+    RendererInterface::BufferBindingDesc cluster_index_binding_desc{};
+    cluster_index_binding_desc.binding_type = RendererInterface::BufferBindingDesc::SRV;
+    cluster_index_binding_desc.buffer_handle = m_light_cluster_index_buffer_handles.front();
+    cluster_index_binding_desc.stride = sizeof(unsigned);
+    cluster_index_binding_desc.is_structured_buffer = true;
+    cluster_index_binding_desc.count = m_light_cluster_grid.max_light_index_count;
+    out_draw_desc.buffer_resources["g_light_cluster_indices"] = cluster_index_binding_desc;
+
+    RendererInterface::BufferBindingDesc cluster_constant_binding_desc{};
+    cluster_constant_binding_desc.binding_type = RendererInterface::BufferBindingDesc::CBV;
+    cluster_constant_binding_desc.buffer_handle = m_light_cluster_constant_buffer_handles.front();
+    out_draw_desc.buffer_resources["LightClusterConstantBuffer"] = cluster_constant_binding_desc;
     
     return true;
 }
@@ -100,6 +186,7 @@ bool RendererModuleLighting::Tick(RendererInterface::ResourceOperator& resource_
 {
     RETURN_IF_FALSE(RendererModuleBase::Tick(resource_operator, interval))
 
+    UpdateLightBVH();
     UploadAllLightInfos(resource_operator);
     
     return true;
@@ -134,3 +221,21 @@ void RendererModuleLighting::UploadAllLightInfos(RendererInterface::ResourceOper
     
     m_need_upload_light_infos = false;
 }
+
+void RendererModuleLighting::UpdateLightBVH()
+{
+    if (!m_need_rebuild_light_bvh && !m_need_refit_light_bvh)
+    {
+        return;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    if (m_need_rebuild_light_bvh || !m_light_bvh.Refit(m_light_infos))
+    {
+        m_light_bvh.Build(m_light_infos);
+    }
+    m_light_bvh_update_time_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+
+    m_need_rebuild_light_bvh = false;
+    m_need_refit_light_bvh = false;
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include "LightBVH.h"
+#include "LightClusterAssignment.h"
 #include "RendererInterface.h"
 #include <glm/glm/glm.hpp>
 #include <glm/glm/gtx/compatibility.hpp>
@@ -23,7 +25,7 @@ class RendererModuleLighting : public RendererInterface::RendererModuleBase
 public:
     enum
     {
-        MAX_LIGHT_COUNT = 16,
+        MAX_LIGHT_COUNT = 4096,
     };
     
     RendererModuleLighting(RendererInterface::ResourceOperator& resource_operator);
@@ -34,6 +36,15 @@ public:
     bool UpdateLightInfo(unsigned index, const LightInfo& info);
     const std::vector<RendererInterface::BufferHandle>& GetLightBufferHandles() const { return m_light_buffer_handles; }
     const std::vector<RendererInterface::BufferHandle>& GetLightCountBufferHandles() const { return m_light_count_buffer_handles; }
+    const std::vector<RendererInterface::BufferHandle>& GetLightClusterRangeBufferHandles() const { return m_light_cluster_range_buffer_handles; }
+    const std::vector<RendererInterface::BufferHandle>& GetLightClusterIndexBufferHandles() const { return m_light_cluster_index_buffer_handles; }
+    const std::vector<RendererInterface::BufferHandle>& GetLightClusterConstantBufferHandles() const { return m_light_cluster_constant_buffer_handles; }
+    const LightClusterAssignment::Result& GetLightClusterResult() const { return m_light_cluster_result; }
+    // Light-cone tree for stochastic light selection, kept current by Tick().
+    const LightBVH& GetLightBVH() const { return m_light_bvh; }
+    float GetLightBVHUpdateTimeMs() const { return m_light_bvh_update_time_ms; }
+
+    bool UpdateLightClusters(RendererInterface::ResourceOperator& resource_operator, const LightClusterAssignment::ViewDesc& view_desc);
     
     virtual bool FinalizeModule(RendererInterface::ResourceOperator& resource_operator) override;
     virtual bool BindDrawCommands(RendererInterface::RenderPassDrawDesc& out_draw_desc) override;
@@ -41,10 +52,22 @@ public:
     
 protected:
     void UploadAllLightInfos(RendererInterface::ResourceOperator& resource_operator);
+    void UpdateLightBVH();
     
     std::vector<RendererInterface::BufferHandle> m_light_buffer_handles;
     std::vector<RendererInterface::BufferHandle> m_light_count_buffer_handles;
+    std::vector<RendererInterface::BufferHandle> m_light_cluster_range_buffer_handles;
+    std::vector<RendererInterface::BufferHandle> m_light_cluster_index_buffer_handles;
+    std::vector<RendererInterface::BufferHandle> m_light_cluster_constant_buffer_handles;
+    
+    LightClusterAssignment::GridDesc m_light_cluster_grid{};
+    LightClusterAssignment::Result m_light_cluster_result{};
     
     std::vector<LightInfo> m_light_infos;
     bool m_need_upload_light_infos {false};
+
+    LightBVH m_light_bvh;
+    bool m_need_rebuild_light_bvh {false};
+    bool m_need_refit_light_bvh {false};
+    float m_light_bvh_update_time_ms {0.0f};
 };
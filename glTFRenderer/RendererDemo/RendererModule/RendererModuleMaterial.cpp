@@ -64,12 +64,23 @@ bool RendererModuleMaterial::FinalizeModule(RendererInterface::ResourceOperator&
     (void)resource_operator;
     // Upload all texture resource and material shader infos
     m_material_texture_handles.clear();
+    std::vector<unsigned> bindless_texture_indices;
     for (const auto& texture_uri: m_material_texture_uris)
     {
         RendererInterface::TextureFileDesc material_texture_desc{texture_uri};
         m_material_texture_handles.push_back(m_resource_operator.CreateTexture(material_texture_desc));
+        bindless_texture_indices.push_back(m_resource_operator.GetBindlessTextureIndex(m_material_texture_handles.back()));
     }
 
+    // Material infos address textures by their stable bindless index instead of their position in the list.
+    const auto to_bindless_index = [&bindless_texture_indices](unsigned& texture_index)
+    {
+        if (texture_index != MATERIAL_TEXTURE_INVALID_INDEX)
+        {
+            texture_index = bindless_texture_indices[texture_index];
+        }
+    };
+
     unsigned max_material_id = 0;
     for (const auto& [material_id, material_shader_info] : m_material_shader_infos)
     {
@@ -82,7 +93,11 @@ bool RendererModuleMaterial::FinalizeModule(RendererInterface::ResourceOperator&
     for (const auto& [material_id, material_shader_info] : m_material_shader_infos)
     {
         GLTF_CHECK(material_id < material_shader_infos.size());
-        material_shader_infos[material_id] = material_shader_info;
+        auto& bindless_material_shader_info = material_shader_infos[material_id];
+        bindless_material_shader_info = material_shader_info;
+        to_bindless_index(bindless_material_shader_info.albedo_tex_index);
+        to_bindless_index(bindless_material_shader_info.normal_tex_index);
+        to_bindless_index(bindless_material_shader_info.metallic_roughness_tex_index);
     }
     
     m_material_shader_info_buffer_desc.usage = RendererInterface::USAGE_SRV;
@@ -108,6 +123,7 @@ bool RendererModuleMaterial::BindDrawCommands(RendererInterface::RenderPassDrawD
     RendererInterface::TextureBindingDesc texture_binding_desc{};
     texture_binding_desc.type = RendererInterface::TextureBindingDesc::SRV;
     texture_binding_desc.textures = m_material_texture_handles;
+    texture_binding_desc.bindless_table = true;
     out_draw_desc.texture_resources["bindless_material_textures"] = texture_binding_desc;
     
     return true;
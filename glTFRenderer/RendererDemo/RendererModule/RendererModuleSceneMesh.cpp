@@ -36,9 +36,14 @@ void RendererSceneMeshDataAccessor::AccessMeshData(MeshDataAccessorType type, un
     switch (type)
     {
     case MeshDataAccessorType::VERTEX_POSITION_FLOAT3:
-        for (size_t i = 0; i < element_size; i++)
         {
-            memcpy(mesh_vertex_infos[vertex_offset + i].position, float_data + i * 3, 3 * sizeof(float));
+            RendererSceneAABB local_bounds;
+            for (size_t i = 0; i < element_size; i++)
+            {
+                memcpy(mesh_vertex_infos[vertex_offset + i].position, float_data + i * 3, 3 * sizeof(float));
+                local_bounds.extend(glm::vec3(float_data[i * 3], float_data[i * 3 + 1], float_data[i * 3 + 2]));
+            }
+            mesh_local_bounds[mesh_id] = local_bounds;
         }
         break;
     case MeshDataAccessorType::VERTEX_NORMAL_FLOAT3:
@@ -107,9 +112,28 @@ void RendererSceneMeshDataAccessor::AccessInstanceData(MeshDataAccessorType type
     instance_render_resource.m_mesh_id = mesh_id;
     
     float* float_data = static_cast<float*>(data);
-    instance_render_resource.m_instance_transform = glm::transpose(glm::make_mat4(float_data));
+    const glm::mat4 world_transform = glm::make_mat4(float_data);
+    instance_render_resource.m_instance_transform = glm::transpose(world_transform);
 
     instance_render_resources.push_back(instance_render_resource);
+
+    RendererSceneAABB world_bounds;
+    const auto local_bounds_it = mesh_local_bounds.find(mesh_id);
+    if (local_bounds_it != mesh_local_bounds.end() && !local_bounds_it->second.isNull())
+    {
+        const glm::vec3 local_min = local_bounds_it->second.getMin();
+        const glm::vec3 local_max = local_bounds_it->second.getMax();
+        for (unsigned corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec4 local_corner = {
+                (corner & 1) ? local_max.x : local_min.x,
+                (corner & 2) ? local_max.y : local_min.y,
+                (corner & 4) ? local_max.z : local_min.z,
+                1.0f};
+            world_bounds.extend(glm::vec3(world_transform * local_corner));
+        }
+    }
+    execute_command_bounds.push_back(world_bounds);
 }
 
 void RendererSceneMeshDataAccessor::AccessMaterialData(const MaterialBase& material, unsigned mesh_id)
@@ -149,6 +173,8 @@ RendererModuleSceneMesh::RendererModuleSceneMesh(RendererInterface::ResourceOper
     m_mesh_buffer_instance_info_handle = resource_operator.CreateBuffer(instance_render_resources_buffer_desc);
 
     m_draw_commands = m_mesh_data_accessor.execute_commands;
+    m_draw_command_bounds = m_mesh_data_accessor.execute_command_bounds;
+    ++m_draw_command_bounds_revision;
 }
 
 bool RendererModuleSceneMesh::FinalizeModule(RendererInterface::ResourceOperator& resource_operator)
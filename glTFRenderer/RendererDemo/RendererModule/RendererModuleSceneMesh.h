@@ -46,6 +46,7 @@ public:
     
     std::map<unsigned, unsigned> mesh_index_counts;
     std::map<unsigned, RendererInterface::IndexedBufferHandle> mesh_index_buffers;
+    std::map<unsigned, RendererSceneAABB> mesh_local_bounds;
     
     // mesh data
     std::vector<SceneMeshDataOffsetInfo> start_offset_infos;
@@ -56,6 +57,8 @@ public:
 
     // draw data
     std::vector<RendererInterface::RenderExecuteCommand> execute_commands;
+    // world space bounds, parallel to execute_commands
+    std::vector<RendererSceneAABB> execute_command_bounds;
 };
 
 class RendererModuleSceneMesh : public RendererInterface::RendererModuleBase
@@ -66,6 +69,10 @@ public:
     virtual bool BindDrawCommands(RendererInterface::RenderPassDrawDesc& out_draw_desc) override;
     virtual bool Tick(RendererInterface::ResourceOperator&, unsigned long long interval) override;
     RendererSceneAABB GetSceneBounds() const;
+    const std::vector<RendererInterface::RenderExecuteCommand>& GetDrawCommands() const { return m_draw_commands; }
+    const std::vector<RendererSceneAABB>& GetDrawCommandBounds() const { return m_draw_command_bounds; }
+    // Bumped whenever the draw command bounds are replaced.
+    unsigned GetDrawCommandBoundsRevision() const { return m_draw_command_bounds_revision; }
     
 protected:
     std::unique_ptr<RendererInterface::RendererSceneResourceManager> m_resource_manager;
@@ -79,6 +86,8 @@ protected:
     RendererInterface::BufferHandle m_mesh_buffer_instance_info_handle {NULL_HANDLE};
 
     std::vector<RendererInterface::RenderExecuteCommand> m_draw_commands;
+    std::vector<RendererSceneAABB> m_draw_command_bounds;
+    unsigned m_draw_command_bounds_revision{0};
     std::unique_ptr<RendererModuleMaterial> m_module_material;
     RendererSceneMeshDataAccessor m_mesh_data_accessor;
 };
@@ -0,0 +1,161 @@
+// DX use [0, 1] as depth clip range
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "DirectionalShadowCascades.h"
+#include "RendererSceneAABB.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <glm/glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    std::array<glm::fvec3, 8> GetAABBCorners(const RendererSceneAABB& bounds)
+    {
+        const glm::fvec3 bounds_min = bounds.getMin();
+        const glm::fvec3 bounds_max = bounds.getMax();
+        return {
+            glm::fvec3(bounds_min.x, bounds_min.y, bounds_min.z),
+            glm::fvec3(bounds_max.x, bounds_min.y, bounds_min.z),
+            glm::fvec3(bounds_min.x, bounds_max.y, bounds_min.z),
+            glm::fvec3(bounds_max.x, bounds_max.y, bounds_min.z),
+            glm::fvec3(bounds_min.x, bounds_min.y, bounds_max.z),
+            glm::fvec3(bounds_max.x, bounds_min.y, bounds_max.z),
+            glm::fvec3(bounds_min.x, bounds_max.y, bounds_max.z),
+            glm::fvec3(bounds_max.x, bounds_max.y, bounds_max.z)};
+    }
+}
+
+namespace DirectionalShadowCascades
+{
+    unsigned ClampCascadeCount(unsigned cascade_count)
+    {
+        return (std::max)(1u, (std::min)(cascade_count, MAX_CASCADE_COUNT));
+    }
+
+    void ComputeCascadeSplits(
+        float near_z,
+        float far_z,
+        unsigned cascade_count,
+        float split_lambda,
+        std::array<float, MAX_CASCADE_COUNT + 1>& out_splits)
+    {
+        cascade_count = ClampCascadeCount(cascade_count);
+        near_z = (std::max)(near_z, 1.0e-4f);
+        far_z = (std::max)(far_z, near_z + 1.0e-3f);
+        split_lambda = (std::max)(0.0f, (std::min)(split_lambda, 1.0f));
+
+        out_splits.fill(far_z);
+        out_splits[0] = near_z;
+        for (unsigned split_index = 1; split_index < cascade_count; ++split_index)
+        {
+            const float t = static_cast<float>(split_index) / static_cast<float>(cascade_count);
+            const float log_split = near_z * std::pow(far_z / near_z, t);
+            const float uniform_split = near_z + (far_z - near_z) * t;
+            out_splits[split_index] = split_lambda * log_split + (1.0f - split_lambda) * uniform_split;
+        }
+        out_splits[cascade_count] = far_z;
+    }
+
+    std::array<glm::fvec3, 8> ComputeFrustumSliceCorners(
+        const CameraFrustumDesc& camera,
+        float slice_near_z,
+        float slice_far_z)
+    {
+        const glm::fmat4x4 inverse_view_matrix = glm::inverse(camera.view_matrix);
+        std::array<glm::fvec3, 8> corners{};
+        unsigned corner_index = 0;
+        for (const float depth : {slice_near_z, slice_far_z})
+        {
+            const float half_width = depth * camera.tan_half_fov_x;
+            const float half_height = depth * camera.tan_half_fov_y;
+            for (const glm::fvec2 sign : {glm::fvec2(-1.0f, -1.0f), glm::fvec2(1.0f, -1.0f), glm::fvec2(-1.0f, 1.0f), glm::fvec2(1.0f, 1.0f)})
+            {
+                const glm::fvec4 view_corner(sign.x * half_width, sign.y * half_height, depth, 1.0f);
+                corners[corner_index++] = glm::fvec3(inverse_view_matrix * view_corner);
+            }
+        }
+        return corners;
+    }
+
+    bool FitCascade(
+        const glm::fvec3& light_direction,
+        const CameraFrustumDesc& camera,
+        float slice_near_z,
+        float slice_far_z,
+        const RendererSceneAABB& caster_bounds,
+        unsigned shadowmap_size,
+        CascadeFitResult& out_result)
+    {
+        const float light_len_sq = glm::dot(light_direction, light_direction);
+        if (light_len_sq <= 1e-8f || slice_far_z <= slice_near_z || shadowmap_size == 0 || caster_bounds.isNull())
+        {
+            return false;
+        }
+        const glm::fvec3 light_dir = light_direction * (1.0f / std::sqrt(light_len_sq));
+
+        const auto slice_corners = ComputeFrustumSliceCorners(camera, slice_near_z, slice_far_z);
+        glm::fvec3 slice_center{0.0f};
+        for (const auto& corner : slice_corners)
+        {
+            slice_center += corner;
+        }
+        slice_center *= 1.0f / static_cast<float>(slice_corners.size());
+
+        float slice_radius = 0.0f;
+        for (const auto& corner : slice_corners)
+        {
+            slice_radius = (std::max)(slice_radius, glm::length(corner - slice_center));
+        }
+        // Quantize so the texel size stays constant while the camera rotates.
+        slice_radius = std::ceil(slice_radius * 16.0f) / 16.0f;
+        if (slice_radius <= 0.0f)
+        {
+            return false;
+        }
+
+        glm::fvec3 light_up = {0.0f, 1.0f, 0.0f};
+        if (std::abs(glm::dot(light_dir, light_up)) > 0.99f)
+        {
+            light_up = {0.0f, 0.0f, 1.0f};
+        }
+
+        // Light space is anchored at the world origin so texel snapping is translation invariant.
+        const glm::fmat4x4 light_rotation = glm::lookAtLH(glm::fvec3(0.0f), light_dir, light_up);
+        const glm::fvec3 light_space_center = glm::fvec3(light_rotation * glm::fvec4(slice_center, 1.0f));
+        const float texel_size = 2.0f * slice_radius / static_cast<float>(shadowmap_size);
+
+        glm::fvec3 caster_min{(std::numeric_limits<float>::max)()};
+        glm::fvec3 caster_max{(std::numeric_limits<float>::lowest)()};
+        for (const auto& corner : GetAABBCorners(caster_bounds))
+        {
+            const glm::fvec3 light_space_corner = glm::fvec3(light_rotation * glm::fvec4(corner, 1.0f));
+            caster_min = glm::min(caster_min, light_space_corner);
+            caster_max = glm::max(caster_max, light_space_corner);
+        }
+
+        // The xy extent always spans the receiver sphere, so shadowmap_size texels cover exactly texel_size
+        // each; only the origin moves, in whole texels. Clipping it to the casters would change the texel
+        // size from frame to frame.
+        const float min_x = std::floor((light_space_center.x - slice_radius) / texel_size) * texel_size;
+        const float min_y = std::floor((light_space_center.y - slice_radius) / texel_size) * texel_size;
+        const float max_x = min_x + 2.0f * slice_radius;
+        const float max_y = min_y + 2.0f * slice_radius;
+        if (caster_max.x <= min_x || caster_min.x >= max_x || caster_max.y <= min_y || caster_min.y >= max_y)
+        {
+            return false;
+        }
+
+        // Near plane reaches back to the farthest caster toward the light; far plane stops at the
+        // receivers or the last caster, whichever is closer.
+        const float near_z = caster_min.z - 1.0f;
+        const float far_z = (std::max)((std::min)(light_space_center.z + slice_radius, caster_max.z), near_z + 1.0f) + 1.0f;
+
+        out_result.view_matrix = light_rotation;
+        out_result.projection_matrix = glm::orthoLH(min_x, max_x, min_y, max_y, near_z, far_z);
+        out_result.light_eye = glm::fvec3(glm::inverse(light_rotation) *
+            glm::fvec4(0.5f * (min_x + max_x), 0.5f * (min_y + max_y), near_z, 1.0f));
+        out_result.texel_world_size = texel_size;
+        return true;
+    }
+}
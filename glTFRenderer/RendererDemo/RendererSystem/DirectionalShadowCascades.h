@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <glm/glm/glm.hpp>
+
+class RendererSceneAABB;
+
+// CPU-side cascade split and fitting math for directional light shadows. The lighting system
+// uploads each fitted cascade as one ShadowMapInfo entry.
+namespace DirectionalShadowCascades
+{
+    constexpr unsigned MAX_CASCADE_COUNT = 4;
+
+    struct CascadeConfig
+    {
+        unsigned cascade_count{3};
+        // 0 = uniform splits, 1 = logarithmic splits (practical split scheme).
+        float split_lambda{0.75f};
+        float max_shadow_distance{120.0f};
+        // Fraction of each cascade depth range cross-faded into the next cascade. 0 disables blending.
+        float blend_fraction{0.1f};
+    };
+
+    // Left-handed camera view space, +z forward. tan_half_fov_* matches ViewBuffer::projection_params.xy.
+    struct CameraFrustumDesc
+    {
+        glm::fmat4x4 view_matrix{1.0f};
+        float tan_half_fov_x{1.0f};
+        float tan_half_fov_y{1.0f};
+        float near_z{0.1f};
+        float far_z{1000.0f};
+    };
+
+    struct CascadeFitResult
+    {
+        glm::fmat4x4 view_matrix{1.0f};
+        glm::fmat4x4 projection_matrix{1.0f};
+        glm::fvec3 light_eye{0.0f};
+        float texel_world_size{0.0f};
+    };
+
+    unsigned ClampCascadeCount(unsigned cascade_count);
+
+    // Writes cascade_count + 1 view-space depths: [near, split_0, ..., far].
+    void ComputeCascadeSplits(
+        float near_z,
+        float far_z,
+        unsigned cascade_count,
+        float split_lambda,
+        std::array<float, MAX_CASCADE_COUNT + 1>& out_splits);
+
+    std::array<glm::fvec3, 8> ComputeFrustumSliceCorners(
+        const CameraFrustumDesc& camera,
+        float slice_near_z,
+        float slice_far_z);
+
+    // Fits an orthographic light frustum to the camera sub-frustum [slice_near_z, slice_far_z]. The
+    // light-space xy extent is the slice's bounding sphere with its origin snapped to whole texels, so
+    // it does not shimmer when the camera rotates or translates. The caster bounds only set the depth
+    // range, pulled toward the light to keep off-screen casters. False when no caster overlaps the slice.
+    bool FitCascade(
+        const glm::fvec3& light_direction,
+        const CameraFrustumDesc& camera,
+        float slice_near_z,
+        float slice_far_z,
+        const RendererSceneAABB& caster_bounds,
+        unsigned shadowmap_size,
+        CascadeFitResult& out_result);
+}
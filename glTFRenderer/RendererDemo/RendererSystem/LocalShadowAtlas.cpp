@@ -0,0 +1,221 @@
+// DX use [0, 1] as depth clip range
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "LocalShadowAtlas.h"
+#include "RendererCommon.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    bool IsPowerOfTwo(unsigned value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    bool RemoveTile(std::vector<LocalShadowAtlas::Tile>& tiles, const LocalShadowAtlas::Tile& tile)
+    {
+        const auto it = std::find(tiles.begin(), tiles.end(), tile);
+        if (it == tiles.end())
+        {
+            return false;
+        }
+
+        *it = tiles.back();
+        tiles.pop_back();
+        return true;
+    }
+}
+
+namespace LocalShadowAtlas
+{
+    TilePacker::TilePacker(unsigned atlas_size, unsigned min_tile_size)
+        : m_atlas_size(atlas_size)
+        , m_min_tile_size(min_tile_size)
+    {
+        GLTF_CHECK(IsPowerOfTwo(m_atlas_size) && IsPowerOfTwo(m_min_tile_size) && m_min_tile_size <= m_atlas_size);
+        Reset();
+    }
+
+    void TilePacker::Reset()
+    {
+        m_free_tiles.assign(GetLevel(m_min_tile_size) + 1, {});
+        m_free_tiles[0].push_back(Tile{0, 0, m_atlas_size});
+        m_allocated_texel_count = 0;
+    }
+
+    bool TilePacker::Allocate(unsigned tile_size, Tile& out_tile)
+    {
+        if (!IsPowerOfTwo(tile_size) || tile_size < m_min_tile_size || tile_size > m_atlas_size)
+        {
+            return false;
+        }
+
+        // Split the smallest free tile that still fits.
+        const unsigned target_level = GetLevel(tile_size);
+        int source_level = static_cast<int>(target_level);
+        while (source_level >= 0 && m_free_tiles[source_level].empty())
+        {
+            --source_level;
+        }
+        if (source_level < 0)
+        {
+            return false;
+        }
+
+        Tile tile = m_free_tiles[source_level].back();
+        m_free_tiles[source_level].pop_back();
+        for (unsigned level = static_cast<unsigned>(source_level) + 1; level <= target_level; ++level)
+        {
+            const unsigned child_size = GetLevelTileSize(level);
+            m_free_tiles[level].push_back(Tile{tile.x + child_size, tile.y, child_size});
+            m_free_tiles[level].push_back(Tile{tile.x, tile.y + child_size, child_size});
+            m_free_tiles[level].push_back(Tile{tile.x + child_size, tile.y + child_size, child_size});
+            tile.size = child_size;
+        }
+
+        m_allocated_texel_count += tile.size * tile.size;
+        out_tile = tile;
+        return true;
+    }
+
+    void TilePacker::Free(const Tile& tile)
+    {
+        if (!tile.IsValid())
+        {
+            return;
+        }
+
+        GLTF_CHECK(m_allocated_texel_count >= tile.size * tile.size);
+        m_allocated_texel_count -= tile.size * tile.size;
+
+        Tile merged_tile = tile;
+        unsigned level = GetLevel(merged_tile.size);
+        while (level > 0)
+        {
+            const unsigned parent_size = merged_tile.size * 2;
+            const Tile parent = {merged_tile.x & ~(parent_size - 1), merged_tile.y & ~(parent_size - 1), parent_size};
+            const Tile siblings[] = {
+                {parent.x, parent.y, merged_tile.size},
+                {parent.x + merged_tile.size, parent.y, merged_tile.size},
+                {parent.x, parent.y + merged_tile.size, merged_tile.size},
+                {parent.x + merged_tile.size, parent.y + merged_tile.size, merged_tile.size}};
+
+            auto& level_tiles = m_free_tiles[level];
+            const bool all_siblings_free = std::all_of(std::begin(siblings), std::end(siblings), [&](const Tile& sibling)
+            {
+                return sibling == merged_tile || std::find(level_tiles.begin(), level_tiles.end(), sibling) != level_tiles.end();
+            });
+            if (!all_siblings_free)
+            {
+                break;
+            }
+
+            for (const auto& sibling : siblings)
+            {
+                if (!(sibling == merged_tile))
+                {
+                    RemoveTile(level_tiles, sibling);
+                }
+            }
+            merged_tile = parent;
+            --level;
+        }
+
+        m_free_tiles[level].push_back(merged_tile);
+    }
+
+    unsigned TilePacker::GetLevel(unsigned tile_size) const
+    {
+        unsigned level = 0;
+        for (unsigned size = m_atlas_size; size > tile_size; size >>= 1)
+        {
+            ++level;
+        }
+        return level;
+    }
+
+    unsigned TilePacker::GetLevelTileSize(unsigned level) const
+    {
+        return m_atlas_size >> level;
+    }
+
+    float ComputeScreenCoverage(const glm::fvec3& light_position, float light_radius, const CoverageViewDesc& view)
+    {
+        if (light_radius <= 0.0f || view.tan_half_fov_x <= 0.0f || view.tan_half_fov_y <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        const glm::fvec3 view_position = glm::fvec3(view.view_matrix * glm::fvec4(light_position, 1.0f));
+        if (view_position.z + light_radius <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        // Side planes pass through the eye: |x| <= z * tan_half_fov_x, normalized by sqrt(1 + tan^2).
+        const auto outside_side_planes = [&](float lateral, float tan_half_fov)
+        {
+            return std::abs(lateral) - view_position.z * tan_half_fov > light_radius * std::sqrt(1.0f + tan_half_fov * tan_half_fov);
+        };
+        if (outside_side_planes(view_position.x, view.tan_half_fov_x) || outside_side_planes(view_position.y, view.tan_half_fov_y))
+        {
+            return 0.0f;
+        }
+
+        const float viewport_height = static_cast<float>((std::max)(view.viewport_height, 1u));
+        const float distance = glm::length(view_position);
+        if (distance <= light_radius)
+        {
+            // Camera inside the light volume: the light can shadow anything on screen.
+            return viewport_height;
+        }
+
+        // Angular radius of the bounding sphere projected onto the screen.
+        const float tan_angular_radius = light_radius / std::sqrt(distance * distance - light_radius * light_radius);
+        return (std::min)(tan_angular_radius / view.tan_half_fov_y * viewport_height, viewport_height);
+    }
+
+    unsigned ComputeTileSize(float screen_coverage, unsigned min_tile_size, unsigned max_tile_size)
+    {
+        unsigned tile_size = min_tile_size;
+        while (tile_size < max_tile_size && static_cast<float>(tile_size) < screen_coverage)
+        {
+            tile_size <<= 1;
+        }
+        return tile_size;
+    }
+
+    std::array<glm::fmat4x4, CUBE_FACE_COUNT> ComputeCubeFaceViewProjections(
+        const glm::fvec3& light_position,
+        float near_z,
+        float far_z,
+        unsigned tile_size,
+        float filter_border_texels)
+    {
+        static const glm::fvec3 face_forwards[CUBE_FACE_COUNT] = {
+            {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+        static const glm::fvec3 face_ups[CUBE_FACE_COUNT] = {
+            {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+
+        // Grow the face so the 90 degree region ends filter_border_texels inside the tile edge.
+        const float tile_texels = static_cast<float>((std::max)(tile_size, 1u));
+        const float border_texels = (std::min)((std::max)(filter_border_texels, 0.0f), tile_texels * 0.25f);
+        const float tan_half_fov = tile_texels / (tile_texels - 2.0f * border_texels);
+        const glm::fmat4x4 projection_matrix = glm::perspectiveFovLH(
+            2.0f * std::atan(tan_half_fov), 1.0f, 1.0f, near_z, far_z);
+
+        std::array<glm::fmat4x4, CUBE_FACE_COUNT> view_projections{};
+        for (unsigned face = 0; face < CUBE_FACE_COUNT; ++face)
+        {
+            const glm::fmat4x4 view_matrix = glm::lookAtLH(light_position, light_position + face_forwards[face], face_ups[face]);
+            view_projections[face] = projection_matrix * view_matrix;
+        }
+        return view_projections;
+    }
+}
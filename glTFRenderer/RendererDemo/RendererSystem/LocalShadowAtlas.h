@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <glm/glm/glm.hpp>
+
+// CPU-side tile packing and projection math for point light shadows rendered into a shared atlas.
+// Each shadowed light takes six square tiles, one per cube face.
+namespace LocalShadowAtlas
+{
+    constexpr unsigned CUBE_FACE_COUNT = 6;
+
+    struct Tile
+    {
+        unsigned x{0};
+        unsigned y{0};
+        unsigned size{0};
+
+        bool IsValid() const { return size > 0; }
+        bool operator==(const Tile& rhs) const { return x == rhs.x && y == rhs.y && size == rhs.size; }
+    };
+
+    // Quadtree buddy allocator over a square atlas. Tiles are power-of-two sized and aligned, so
+    // freeing a tile merges it back with its three siblings and fragmentation stays bounded.
+    class TilePacker
+    {
+    public:
+        TilePacker(unsigned atlas_size, unsigned min_tile_size);
+
+        void Reset();
+        bool Allocate(unsigned tile_size, Tile& out_tile);
+        void Free(const Tile& tile);
+
+        unsigned GetAtlasSize() const { return m_atlas_size; }
+        unsigned GetMinTileSize() const { return m_min_tile_size; }
+        unsigned GetAllocatedTexelCount() const { return m_allocated_texel_count; }
+
+    private:
+        unsigned GetLevel(unsigned tile_size) const;
+        unsigned GetLevelTileSize(unsigned level) const;
+
+        unsigned m_atlas_size;
+        unsigned m_min_tile_size;
+        unsigned m_allocated_texel_count{0};
+        // Free tiles per level; level 0 is the whole atlas.
+        std::vector<std::vector<Tile>> m_free_tiles;
+    };
+
+    // Left-handed camera view space, +z forward. tan_half_fov_* matches ViewBuffer::projection_params.xy.
+    struct CoverageViewDesc
+    {
+        glm::fmat4x4 view_matrix{1.0f};
+        float tan_half_fov_x{1.0f};
+        float tan_half_fov_y{1.0f};
+        unsigned viewport_height{1};
+    };
+
+    // Projected screen-space diameter of the light's influence sphere in pixels; 0 when it is outside the view.
+    float ComputeScreenCoverage(const glm::fvec3& light_position, float light_radius, const CoverageViewDesc& view);
+
+    // Power-of-two cube face size in [min_tile_size, max_tile_size] matching the screen coverage.
+    unsigned ComputeTileSize(float screen_coverage, unsigned min_tile_size, unsigned max_tile_size);
+
+    // 90 degree face projections, widened so a PCF kernel of filter_border_texels stays inside the face.
+    // Face order: +X, -X, +Y, -Y, +Z, -Z (same as the major axis selection in the lighting shader).
+    std::array<glm::fmat4x4, CUBE_FACE_COUNT> ComputeCubeFaceViewProjections(
+        const glm::fvec3& light_position,
+        float near_z,
+        float far_z,
+        unsigned tile_size,
+        float filter_border_texels);
+}
@@ -399,6 +399,13 @@ namespace RenderFeature
             return *this;
         }
 
+        // ASYNC_COMPUTE lets the render graph overlap a compute pass with graphics work on another queue.
+        PassBuilder& SetQueueAffinity(RendererInterface::RenderPassQueueAffinity queue_affinity)
+        {
+            m_setup_info.queue_affinity = queue_affinity;
+            return *this;
+        }
+
         PassBuilder& SetViewport(int width, int height)
         {
             m_setup_info.viewport_width = width;
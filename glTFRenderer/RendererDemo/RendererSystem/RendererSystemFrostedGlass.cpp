@@ -744,6 +744,7 @@ bool RendererSystemFrostedGlass::CreatePrimaryBlurPyramidPasses(
             dispatch_width,
             dispatch_height,
             dependency_node);
+        builder.SetQueueAffinity(RendererInterface::RenderPassQueueAffinity::ASYNC_COMPUTE);
         if (bind_global_params)
         {
             builder.AddBuffer("FrostedGlassGlobalBuffer", bindings.global_params);
@@ -995,6 +996,7 @@ bool RendererSystemFrostedGlass::CreatePanelPayloadPasses(
         graph,
         panel_payload_passes.compute,
         RenderFeature::PassBuilder::Compute("Frosted Glass", "Frosted Mask/Parameter")
+            .SetQueueAffinity(RendererInterface::RenderPassQueueAffinity::ASYNC_COMPUTE)
             .AddModule(m_scene->GetCameraModule())
             .AddShader(RendererInterface::COMPUTE_SHADER, "MaskParameterMain", "Resources/Shaders/FrostedGlass.hlsl")
             .AddSampledRenderTargetBindings({
@@ -1278,6 +1280,7 @@ bool RendererSystemFrostedGlass::CreateCompositePasses(
             dispatch_width,
             dispatch_height,
             dependency_node);
+        builder.SetQueueAffinity(RendererInterface::RenderPassQueueAffinity::ASYNC_COMPUTE);
         if (bind_global_params)
         {
             builder.AddBuffer("FrostedGlassGlobalBuffer", bindings.global_params);
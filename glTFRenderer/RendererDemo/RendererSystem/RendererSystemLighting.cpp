@@ -29,7 +29,7 @@ namespace
         global_params.environment_texture_params.z = global_params.environment_texture_params.z > 0.5f ? 1.0f : 0.0f;
     }
 
-    std::size_t ComputeLightTopologySignature(const std::vector<LightInfo>& lights)
+    std::size_t ComputeLightTopologySignature(const std::vector<LightInfo>& lights, unsigned cascade_count)
     {
         std::size_t signature = 1469598103934665603ULL;
         auto hash_combine = [&signature](std::size_t value)
@@ -38,6 +38,7 @@ namespace
         };
 
         hash_combine(lights.size());
+        hash_combine(cascade_count);
         for (std::size_t i = 0; i < lights.size(); ++i)
         {
             hash_combine(i);
@@ -46,6 +47,43 @@ namespace
 
         return signature;
     }
+
+    // Names of the bindings rebound every frame, interned once instead of on every update call.
+    struct LightingBindingNames
+    {
+        RendererInterface::BindingName view_buffer{"ViewBuffer"};
+        RendererInterface::BindingName light_infos{"g_lightInfos"};
+        RendererInterface::BindingName light_info_constants{"LightInfoConstantBuffer"};
+        RendererInterface::BindingName shadowmap_infos{"g_shadowmap_infos"};
+        RendererInterface::BindingName ssao_texture{"ssaoTex"};
+        RendererInterface::BindingName local_shadow_infos{"g_local_shadow_infos"};
+        RendererInterface::BindingName local_light_shadow_indices{"g_local_light_shadow_indices"};
+        RendererInterface::BindingName shadowmap_textures{"bindless_shadowmap_textures"};
+        RendererInterface::BindingName light_cluster_ranges{"g_light_cluster_ranges"};
+        RendererInterface::BindingName light_cluster_indices{"g_light_cluster_indices"};
+        RendererInterface::BindingName light_cluster_constants{"LightClusterConstantBuffer"};
+    };
+
+    const LightingBindingNames& GetLightingBindingNames()
+    {
+        static const LightingBindingNames binding_names;
+        return binding_names;
+    }
+}
+
+unsigned RendererSystemLighting::ComputeShadowSlot(unsigned light_index, unsigned cascade_index)
+{
+    return light_index * DirectionalShadowCascades::MAX_CASCADE_COUNT + cascade_index;
+}
+
+unsigned RendererSystemLighting::GetShadowSlotLightIndex(unsigned shadow_slot)
+{
+    return shadow_slot / DirectionalShadowCascades::MAX_CASCADE_COUNT;
+}
+
+unsigned RendererSystemLighting::GetShadowSlotCascadeIndex(unsigned shadow_slot)
+{
+    return shadow_slot % DirectionalShadowCascades::MAX_CASCADE_COUNT;
 }
 
 void RendererSystemLighting::LightingPassRuntimeState::Reset()
@@ -61,6 +99,11 @@ bool RendererSystemLighting::LightingPassRuntimeState::HasInit() const
     return node != NULL_HANDLE;
 }
 
+void RendererSystemLighting::LocalShadowRuntimeState::Reset()
+{
+    *this = LocalShadowRuntimeState{};
+}
+
 void RendererSystemLighting::DirectionalShadowRuntimeState::Reset()
 {
     m_resources.clear();
@@ -102,9 +145,9 @@ void RendererSystemLighting::DirectionalShadowRuntimeState::CreateFallbackShadow
     }
 }
 
-RendererSystemLighting::ShadowPassResource& RendererSystemLighting::DirectionalShadowRuntimeState::GetOrCreate(unsigned light_index)
+RendererSystemLighting::ShadowPassResource& RendererSystemLighting::DirectionalShadowRuntimeState::GetOrCreate(unsigned shadow_slot)
 {
-    return m_resources[light_index];
+    return m_resources[shadow_slot];
 }
 
 std::map<unsigned, RendererSystemLighting::ShadowPassResource>& RendererSystemLighting::DirectionalShadowRuntimeState::GetResources()
@@ -166,18 +209,18 @@ void RendererSystemLighting::DirectionalShadowRuntimeState::CollectLightIndexedS
     std::vector<RendererInterface::RenderTargetHandle>& out_shadow_maps) const
 {
     out_shadow_maps.clear();
-    out_shadow_maps.resize(lights.size(), m_bound_fallback_shadow_map);
-    for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+    out_shadow_maps.resize(lights.size() * DirectionalShadowCascades::MAX_CASCADE_COUNT, m_bound_fallback_shadow_map);
+    for (const auto& shadow_resource_pair : m_resources)
     {
-        if (lights[light_index].type != LightType::Directional)
+        const unsigned light_index = GetShadowSlotLightIndex(shadow_resource_pair.first);
+        if (light_index >= lights.size() || lights[light_index].type != LightType::Directional)
         {
             continue;
         }
 
-        const auto it = m_resources.find(light_index);
-        if (it != m_resources.end() && it->second.m_bound_shadow_map != NULL_HANDLE)
+        if (shadow_resource_pair.second.m_bound_shadow_map != NULL_HANDLE)
         {
-            out_shadow_maps[light_index] = it->second.m_bound_shadow_map;
+            out_shadow_maps[shadow_resource_pair.first] = shadow_resource_pair.second.m_bound_shadow_map;
         }
     }
 }
@@ -187,19 +230,16 @@ void RendererSystemLighting::DirectionalShadowRuntimeState::CollectLightIndexedS
     std::vector<ShadowMapInfo>& out_shadowmap_infos) const
 {
     out_shadowmap_infos.clear();
-    out_shadowmap_infos.resize(lights.size());
-    for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+    out_shadowmap_infos.resize(lights.size() * DirectionalShadowCascades::MAX_CASCADE_COUNT);
+    for (const auto& shadow_resource_pair : m_resources)
     {
-        if (lights[light_index].type != LightType::Directional)
+        const unsigned light_index = GetShadowSlotLightIndex(shadow_resource_pair.first);
+        if (light_index >= lights.size() || lights[light_index].type != LightType::Directional)
         {
             continue;
         }
 
-        const auto it = m_resources.find(light_index);
-        if (it != m_resources.end())
-        {
-            out_shadowmap_infos[light_index] = it->second.m_shadow_map_info;
-        }
+        out_shadowmap_infos[shadow_resource_pair.first] = shadow_resource_pair.second.m_shadow_map_info;
     }
 }
 
@@ -208,7 +248,7 @@ void RendererSystemLighting::DirectionalShadowRuntimeState::CollectFallbackLight
     std::vector<RendererInterface::RenderTargetHandle>& out_shadow_maps) const
 {
     out_shadow_maps.clear();
-    out_shadow_maps.resize(lights.size(), m_bound_fallback_shadow_map);
+    out_shadow_maps.resize(lights.size() * DirectionalShadowCascades::MAX_CASCADE_COUNT, m_bound_fallback_shadow_map);
 }
 
 void RendererSystemLighting::DirectionalShadowRuntimeState::CollectDependencyNodes(
@@ -263,7 +303,7 @@ RendererInterface::RenderTargetHandle RendererSystemLighting::ShadowPassResource
     {
         graph.UpdateNodeBufferBinding(
             m_shadow_pass_node,
-            "ViewBuffer",
+            GetLightingBindingNames().view_buffer,
             resource_operator.GetFrameBufferedBufferHandle(m_shadow_map_buffer_handles));
     }
 
@@ -285,6 +325,7 @@ RendererSystemLighting::RendererSystemLighting(RendererInterface::ResourceOperat
     , m_ssao(std::move(ssao))
     , m_environment_lighting_resources(std::make_shared<EnvironmentLightingResources>())
     , m_directional_shadow_render_state(CreateDefaultDirectionalShadowRenderState())
+    , m_local_shadow_render_state(CreateDefaultLocalShadowRenderState())
 {
     m_lighting_module = std::make_shared<RendererModuleLighting>(resource_operator);
     m_modules.push_back(m_lighting_module);
@@ -389,6 +430,20 @@ bool RendererSystemLighting::SetDirectionalShadowDepthBias(const RendererInterfa
     return SetDirectionalShadowRenderState(render_state);
 }
 
+const DirectionalShadowCascades::CascadeConfig& RendererSystemLighting::GetDirectionalShadowCascadeConfig() const
+{
+    return m_cascade_config;
+}
+
+void RendererSystemLighting::SetDirectionalShadowCascadeConfig(const DirectionalShadowCascades::CascadeConfig& cascade_config)
+{
+    m_cascade_config = cascade_config;
+    m_cascade_config.cascade_count = DirectionalShadowCascades::ClampCascadeCount(m_cascade_config.cascade_count);
+    m_cascade_config.split_lambda = (std::max)(0.0f, (std::min)(m_cascade_config.split_lambda, 1.0f));
+    m_cascade_config.max_shadow_distance = (std::max)(m_cascade_config.max_shadow_distance, 1.0f);
+    m_cascade_config.blend_fraction = (std::max)(0.0f, (std::min)(m_cascade_config.blend_fraction, 0.5f));
+}
+
 RendererInterface::RenderTargetHandle RendererSystemLighting::GetLightingOutput() const
 {
     return GetOutputs().output;
@@ -423,6 +478,16 @@ RendererInterface::RenderStateDesc RendererSystemLighting::CreateDefaultDirectio
     return render_state;
 }
 
+RendererInterface::RenderStateDesc RendererSystemLighting::CreateDefaultLocalShadowRenderState()
+{
+    // Perspective depth is already dense near the light; the shader adds a texel-scaled bias on top.
+    RendererInterface::RenderStateDesc render_state{};
+    render_state.depth_bias.enabled = true;
+    render_state.depth_bias.constant_factor = 64.0f;
+    render_state.depth_bias.slope_factor = 1.5f;
+    return render_state;
+}
+
 bool RendererSystemLighting::Init(RendererInterface::ResourceOperator& resource_operator,
                                   RendererInterface::RenderGraph& graph)
 {
@@ -459,16 +524,23 @@ bool RendererSystemLighting::Init(RendererInterface::ResourceOperator& resource_
             continue;
         }
 
-        CreateDirectionalShadowPassResource(resource_operator, graph, i, light);
+        for (unsigned cascade_index = 0; cascade_index < m_cascade_config.cascade_count; ++cascade_index)
+        {
+            CreateDirectionalShadowPassResource(resource_operator, graph, i, cascade_index, light);
+        }
     }
 
     CreateLightingPassShadowInfoBuffers(resource_operator);
+    CreateLocalShadowResources(resource_operator);
+    // Cached atlas tiles are sampled in later frames without being rendered again.
+    graph.RegisterOutputSink(m_local_shadow_state.atlas);
     RETURN_IF_FALSE(RenderFeature::CreateRenderGraphNodeIfNeeded(
         resource_operator,
         graph,
         m_lighting_pass_state.node,
         BuildLightingPassSetupInfo(execution_plan)));
-    m_lighting_pass_state.light_topology_signature = ComputeLightTopologySignature(lights);
+    m_lighting_pass_state.light_topology_signature =
+        ComputeLightTopologySignature(lights, m_cascade_config.cascade_count);
     UploadGlobalParams(resource_operator);
 
     graph.RegisterRenderTargetToColorOutput(m_lighting_pass_state.output);
@@ -514,6 +586,7 @@ void RendererSystemLighting::ResetRuntimeResources(RendererInterface::ResourceOp
     m_modules.clear();
     m_modules.push_back(m_lighting_module);
     m_directional_shadow_state.Reset();
+    m_local_shadow_state.Reset();
     m_lighting_pass_state.Reset();
     m_lighting_global_params_handle = NULL_HANDLE;
     m_environment_lighting_resources = std::make_shared<EnvironmentLightingResources>();
@@ -532,12 +605,13 @@ bool RendererSystemLighting::Tick(RendererInterface::ResourceOperator& resource_
     execution_plan.compute_plan.ApplyDispatch(graph, m_lighting_pass_state.node);
     UploadGlobalParams(resource_operator);
 
+    const auto& binding_names = GetLightingBindingNames();
     const auto& light_buffer_handles = m_lighting_module->GetLightBufferHandles();
     if (!light_buffer_handles.empty())
     {
         graph.UpdateNodeBufferBinding(
             m_lighting_pass_state.node,
-            "g_lightInfos",
+            binding_names.light_infos,
             resource_operator.GetFrameBufferedBufferHandle(light_buffer_handles));
     }
     const auto& light_count_buffer_handles = m_lighting_module->GetLightCountBufferHandles();
@@ -545,26 +619,27 @@ bool RendererSystemLighting::Tick(RendererInterface::ResourceOperator& resource_
     {
         graph.UpdateNodeBufferBinding(
             m_lighting_pass_state.node,
-            "LightInfoConstantBuffer",
+            binding_names.light_info_constants,
             resource_operator.GetFrameBufferedBufferHandle(light_count_buffer_handles));
     }
+    RETURN_IF_FALSE(UpdateLightClusters(resource_operator, graph, execution_plan));
     if (!m_lighting_pass_state.shadow_infos_handles.empty())
     {
         graph.UpdateNodeBufferBinding(
             m_lighting_pass_state.node,
-            "g_shadowmap_infos",
+            binding_names.shadowmap_infos,
             resource_operator.GetFrameBufferedBufferHandle(m_lighting_pass_state.shadow_infos_handles));
     }
     graph.UpdateNodeRenderTargetTextureBinding(
         m_lighting_pass_state.node,
-        "ssaoTex",
+        binding_names.ssao_texture,
         ssao_outputs.output);
 
     std::vector<RendererInterface::RenderGraphNodeHandle> lighting_pass_dependencies;
     std::vector<RendererInterface::RenderTargetHandle> current_shadow_maps;
     if (CastShadow())
     {
-        UpdateDirectionalShadowResources(resource_operator);
+        UpdateDirectionalShadowResources(resource_operator, graph);
         current_shadow_maps = m_directional_shadow_state.SyncAndRegisterShadowPasses(
             resource_operator,
             graph,
@@ -577,7 +652,7 @@ bool RendererSystemLighting::Tick(RendererInterface::ResourceOperator& resource_
         m_directional_shadow_state.CollectFallbackLightIndexedShadowMaps(lights, current_shadow_maps);
         if (!lights.empty() && !m_lighting_pass_state.shadow_infos_handles.empty())
         {
-            const std::vector<ShadowMapInfo> disabled_shadow_infos(lights.size());
+            const std::vector<ShadowMapInfo> disabled_shadow_infos(lights.size() * DirectionalShadowCascades::MAX_CASCADE_COUNT);
             RendererInterface::BufferUploadDesc shadow_info_upload_desc{};
             shadow_info_upload_desc.data = disabled_shadow_infos.data();
             shadow_info_upload_desc.size = disabled_shadow_infos.size() * sizeof(ShadowMapInfo);
@@ -585,6 +660,23 @@ bool RendererSystemLighting::Tick(RendererInterface::ResourceOperator& resource_
         }
     }
 
+    UpdateLocalShadowResources(resource_operator, graph, execution_plan);
+    lighting_pass_dependencies.insert(
+        lighting_pass_dependencies.end(),
+        m_local_shadow_state.rendered_nodes.begin(),
+        m_local_shadow_state.rendered_nodes.end());
+    const std::pair<RendererInterface::BindingName, const std::vector<RendererInterface::BufferHandle>*> local_shadow_bindings[] = {
+        {binding_names.local_shadow_infos, &m_local_shadow_state.shadow_info_handles},
+        {binding_names.local_light_shadow_indices, &m_local_shadow_state.light_shadow_index_handles},
+    };
+    for (const auto& local_shadow_binding : local_shadow_bindings)
+    {
+        graph.UpdateNodeBufferBinding(
+            m_lighting_pass_state.node,
+            local_shadow_binding.first,
+            resource_operator.GetFrameBufferedBufferHandle(*local_shadow_binding.second));
+    }
+
     if (ssao_outputs.blur_node != NULL_HANDLE)
     {
         lighting_pass_dependencies.push_back(ssao_outputs.blur_node);
@@ -594,7 +686,7 @@ bool RendererSystemLighting::Tick(RendererInterface::ResourceOperator& resource_
     {
         graph.UpdateNodeRenderTargetTextureBinding(
             m_lighting_pass_state.node,
-            "bindless_shadowmap_textures",
+            binding_names.shadowmap_textures,
             current_shadow_maps);
     }
     
@@ -626,6 +718,18 @@ void RendererSystemLighting::DrawDebugUI()
         SetCastShadow(cast_shadow);
     }
 
+    DirectionalShadowCascades::CascadeConfig cascade_config = m_cascade_config;
+    int cascade_count = static_cast<int>(cascade_config.cascade_count);
+    bool cascade_dirty = ImGui::SliderInt("Shadow Cascades", &cascade_count, 1, static_cast<int>(DirectionalShadowCascades::MAX_CASCADE_COUNT));
+    cascade_dirty |= ImGui::SliderFloat("Cascade Split Lambda", &cascade_config.split_lambda, 0.0f, 1.0f, "%.2f");
+    cascade_dirty |= ImGui::SliderFloat("Shadow Distance", &cascade_config.max_shadow_distance, 1.0f, 1000.0f, "%.1f");
+    cascade_dirty |= ImGui::SliderFloat("Cascade Blend", &cascade_config.blend_fraction, 0.0f, 0.5f, "%.2f");
+    if (cascade_dirty)
+    {
+        cascade_config.cascade_count = static_cast<unsigned>(cascade_count);
+        SetDirectionalShadowCascadeConfig(cascade_config);
+    }
+
     bool global_dirty = false;
     bool environment_enabled = m_global_params.environment_control.w > 0.5f;
     if (ImGui::Checkbox("Enable Environment Lighting", &environment_enabled))
@@ -656,7 +760,39 @@ void RendererSystemLighting::DrawDebugUI()
     }
 
     ImGui::Text("Lights: %u", static_cast<unsigned>(m_lighting_module->GetLightInfos().size()));
+    const auto& cluster_result = m_lighting_module->GetLightClusterResult();
+    ImGui::Text("Light Clusters: %u x %u x %u",
+                cluster_result.constants.grid_size[0],
+                cluster_result.constants.grid_size[1],
+                cluster_result.constants.grid_size[2]);
+    ImGui::Text("Cluster Light Refs: %u (max/cluster %u, dropped %u, culled lights %u)",
+                cluster_result.assigned_light_reference_count,
+                cluster_result.max_cluster_light_count,
+                cluster_result.dropped_light_reference_count,
+                cluster_result.culled_light_count);
+    const auto& light_bvh_stats = m_lighting_module->GetLightBVH().GetStats();
+    ImGui::Text("Light BVH: %u nodes, depth %u, %u local + %u infinite lights (update %.3f ms)",
+                light_bvh_stats.node_count,
+                light_bvh_stats.max_depth,
+                light_bvh_stats.local_light_count,
+                light_bvh_stats.infinite_light_count,
+                m_lighting_module->GetLightBVHUpdateTimeMs());
     ImGui::Text("Directional Shadow Maps: %u", static_cast<unsigned>(m_directional_shadow_state.GetShadowPassCount()));
+    ImGui::Text("Point Shadow Lights: %u (tiles rendered %u, cached %u, atlas %.1f%%)",
+                m_local_shadow_state.shadowed_light_count,
+                m_local_shadow_state.rendered_tile_count,
+                m_local_shadow_state.cached_tile_count,
+                100.0f * static_cast<float>(m_local_shadow_state.packer.GetAllocatedTexelCount()) /
+                    static_cast<float>(LOCAL_SHADOW_ATLAS_SIZE * LOCAL_SHADOW_ATLAS_SIZE));
+    for (const auto& shadow_resource_pair : m_directional_shadow_state.GetResources())
+    {
+        const auto& cull_stats = shadow_resource_pair.second.m_caster_cull_stats;
+        ImGui::Text("  Light %u Cascade %u Casters: %u / %u",
+                    GetShadowSlotLightIndex(shadow_resource_pair.first),
+                    GetShadowSlotCascadeIndex(shadow_resource_pair.first),
+                    cull_stats.visible_caster_count,
+                    cull_stats.total_caster_count);
+    }
     const bool has_texture_source =
         m_environment_lighting_resources && m_environment_lighting_resources->HasTextureSource();
     const char* environment_source_label =
@@ -689,6 +825,42 @@ bool RendererSystemLighting::QueuePendingDirectionalShadowRenderStateUpdate(Rend
     return queued_all_shadow_passes;
 }
 
+bool RendererSystemLighting::UpdateLightClusters(
+    RendererInterface::ResourceOperator& resource_operator,
+    RendererInterface::RenderGraph& graph,
+    const LightingExecutionPlan& execution_plan)
+{
+    LightClusterAssignment::ViewDesc view_desc{};
+    glm::fvec4 projection_params{};
+    RETURN_IF_FALSE(execution_plan.camera_module->GetViewFrustumParams(view_desc.view_matrix, projection_params))
+    view_desc.tan_half_fov_x = projection_params.x;
+    view_desc.tan_half_fov_y = projection_params.y;
+    view_desc.near_z = projection_params.z;
+    view_desc.far_z = projection_params.w;
+    view_desc.viewport_width = execution_plan.compute_plan.frame_dimensions.width;
+    view_desc.viewport_height = execution_plan.compute_plan.frame_dimensions.height;
+    RETURN_IF_FALSE(m_lighting_module->UpdateLightClusters(resource_operator, view_desc))
+
+    const auto& binding_names = GetLightingBindingNames();
+    const std::pair<RendererInterface::BindingName, const std::vector<RendererInterface::BufferHandle>*> cluster_bindings[] = {
+        {binding_names.light_cluster_ranges, &m_lighting_module->GetLightClusterRangeBufferHandles()},
+        {binding_names.light_cluster_indices, &m_lighting_module->GetLightClusterIndexBufferHandles()},
+        {binding_names.light_cluster_constants, &m_lighting_module->GetLightClusterConstantBufferHandles()},
+    };
+    for (const auto& cluster_binding : cluster_bindings)
+    {
+        if (!cluster_binding.second->empty())
+        {
+            graph.UpdateNodeBufferBinding(
+                m_lighting_pass_state.node,
+                cluster_binding.first,
+                resource_operator.GetFrameBufferedBufferHandle(*cluster_binding.second));
+        }
+    }
+
+    return true;
+}
+
 void RendererSystemLighting::CreateLightingOutput(RendererInterface::ResourceOperator& resource_operator)
 {
     m_lighting_pass_state.output = resource_operator.CreateFrameBufferedWindowRelativeRenderTarget(
@@ -743,26 +915,28 @@ bool RendererSystemLighting::SyncLightingTopology(
     const LightingExecutionPlan& execution_plan)
 {
     const auto& lights = m_lighting_module->GetLightInfos();
-    const std::size_t topology_signature = ComputeLightTopologySignature(lights);
+    const std::size_t topology_signature = ComputeLightTopologySignature(lights, m_cascade_config.cascade_count);
     if (topology_signature == m_lighting_pass_state.light_topology_signature)
     {
         return true;
     }
 
     auto& shadow_resources = m_directional_shadow_state.GetResources();
-    std::vector<unsigned> retired_shadow_light_indices;
+    std::vector<unsigned> retired_shadow_slots;
     for (const auto& shadow_resource_pair : shadow_resources)
     {
-        const unsigned light_index = shadow_resource_pair.first;
-        if (light_index >= lights.size() || lights[light_index].type != LightType::Directional)
+        const unsigned light_index = GetShadowSlotLightIndex(shadow_resource_pair.first);
+        if (light_index >= lights.size() ||
+            lights[light_index].type != LightType::Directional ||
+            GetShadowSlotCascadeIndex(shadow_resource_pair.first) >= m_cascade_config.cascade_count)
         {
-            retired_shadow_light_indices.push_back(light_index);
+            retired_shadow_slots.push_back(shadow_resource_pair.first);
         }
     }
 
-    for (const unsigned light_index : retired_shadow_light_indices)
+    for (const unsigned shadow_slot : retired_shadow_slots)
     {
-        auto it = shadow_resources.find(light_index);
+        auto it = shadow_resources.find(shadow_slot);
         if (it == shadow_resources.end())
         {
             continue;
@@ -779,12 +953,18 @@ bool RendererSystemLighting::SyncLightingTopology(
 
     for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
     {
-        if (lights[light_index].type != LightType::Directional || shadow_resources.contains(light_index))
+        if (lights[light_index].type != LightType::Directional)
         {
             continue;
         }
 
-        CreateDirectionalShadowPassResource(resource_operator, graph, light_index, lights[light_index]);
+        for (unsigned cascade_index = 0; cascade_index < m_cascade_config.cascade_count; ++cascade_index)
+        {
+            if (!shadow_resources.contains(ComputeShadowSlot(light_index, cascade_index)))
+            {
+                CreateDirectionalShadowPassResource(resource_operator, graph, light_index, cascade_index, lights[light_index]);
+            }
+        }
     }
 
     CreateLightingPassShadowInfoBuffers(resource_operator);
@@ -801,10 +981,12 @@ RendererSystemLighting::ShadowPassResource& RendererSystemLighting::CreateDirect
     RendererInterface::ResourceOperator& resource_operator,
     RendererInterface::RenderGraph& graph,
     unsigned light_index,
+    unsigned cascade_index,
     const LightInfo& light_info)
 {
-    auto& shadow_pass_resource = m_directional_shadow_state.GetOrCreate(light_index);
-    const std::string shadowmap_name = std::format("directional_shadowmap_{}", light_index);
+    const unsigned shadow_slot = ComputeShadowSlot(light_index, cascade_index);
+    auto& shadow_pass_resource = m_directional_shadow_state.GetOrCreate(shadow_slot);
+    const std::string shadowmap_name = std::format("directional_shadowmap_{}_cascade_{}", light_index, cascade_index);
 
     const unsigned shadowmap_width = 1024;
     const unsigned shadowmap_height = 1024;
@@ -821,16 +1003,17 @@ RendererSystemLighting::ShadowPassResource& RendererSystemLighting::CreateDirect
         resource_operator.CreateFrameBufferedRenderTargets(shadowmap_desc, shadowmap_name);
     GLTF_CHECK(!shadow_pass_resource.m_shadow_maps.empty());
     shadow_pass_resource.m_bound_shadow_map = shadow_pass_resource.m_shadow_maps[0];
+    shadow_pass_resource.m_shadowmap_size = shadowmap_width;
 
-    ShadowPassResource::CalcDirectionalLightShadowMatrix(
+    DirectionalShadowCascades::CameraFrustumDesc shadow_camera{};
+    BuildShadowCameraFrustum(shadow_camera);
+    ShadowPassResource::CalcDirectionalCascadeShadowMatrix(
         light_info,
         m_scene->GetSceneMeshModule()->GetSceneBounds(),
-        0.0f,
-        0.0f,
-        1.0f,
-        1.0f,
+        shadow_camera,
+        m_cascade_config,
+        cascade_index,
         shadowmap_width,
-        shadowmap_height,
         shadow_pass_resource.m_shadow_map_view_buffer,
         shadow_pass_resource.m_shadow_map_info);
     RendererInterface::BufferDesc camera_buffer_desc{};
@@ -842,27 +1025,31 @@ RendererSystemLighting::ShadowPassResource& RendererSystemLighting::CreateDirect
     shadow_pass_resource.m_shadow_map_buffer_handles =
         resource_operator.CreateFrameBufferedBuffers(
             camera_buffer_desc,
-            std::format("ViewBuffer_shadow_{}", light_index));
+            std::format("ViewBuffer_shadow_{}_cascade_{}", light_index, cascade_index));
     shadow_pass_resource.m_shadow_map_view_buffers.assign(
         shadow_pass_resource.m_shadow_map_buffer_handles.size(),
         shadow_pass_resource.m_shadow_map_view_buffer);
 
     shadow_pass_resource.m_shadow_pass_node = graph.CreateRenderGraphNode(
         resource_operator,
-        BuildDirectionalShadowPassSetupInfo(shadow_pass_resource, light_index));
+        BuildDirectionalShadowPassSetupInfo(shadow_pass_resource, shadow_slot));
     GLTF_CHECK(!shadow_pass_resource.m_shadow_map_buffer_handles.empty());
     return shadow_pass_resource;
 }
 
 RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::BuildDirectionalShadowPassSetupInfo(
     const ShadowPassResource& shadow_pass_resource,
-    unsigned light_index) const
+    unsigned shadow_slot) const
 {
-    return RenderFeature::PassBuilder::Graphics("Lighting", std::format("Directional Shadow {}", light_index))
+    const std::string pass_name = std::format(
+        "Directional Shadow {} Cascade {}",
+        GetShadowSlotLightIndex(shadow_slot),
+        GetShadowSlotCascadeIndex(shadow_slot));
+    return RenderFeature::PassBuilder::Graphics("Lighting", pass_name)
         .SetRenderState(m_directional_shadow_render_state)
         .SetViewport(
-            static_cast<int>(shadow_pass_resource.m_shadow_map_info.shadowmap_size[0]),
-            static_cast<int>(shadow_pass_resource.m_shadow_map_info.shadowmap_size[1]))
+            static_cast<int>(shadow_pass_resource.m_shadowmap_size),
+            static_cast<int>(shadow_pass_resource.m_shadowmap_size))
         .AddModule(m_scene->GetSceneMeshModule())
         .AddShader(
             RendererInterface::ShaderType::VERTEX_SHADER,
@@ -883,6 +1070,357 @@ RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::Buil
         .Build();
 }
 
+void RendererSystemLighting::CreateLocalShadowResources(RendererInterface::ResourceOperator& resource_operator)
+{
+    auto& local_shadow_state = m_local_shadow_state;
+    if (local_shadow_state.atlas == NULL_HANDLE)
+    {
+        RendererInterface::RenderTargetDesc atlas_desc{};
+        atlas_desc.name = "local_shadow_atlas";
+        atlas_desc.format = RendererInterface::D32;
+        atlas_desc.width = LOCAL_SHADOW_ATLAS_SIZE;
+        atlas_desc.height = LOCAL_SHADOW_ATLAS_SIZE;
+        atlas_desc.clear = RendererInterface::default_clear_depth;
+        atlas_desc.usage = static_cast<RendererInterface::ResourceUsage>(
+            RendererInterface::ResourceUsage::DEPTH_STENCIL |
+            RendererInterface::ResourceUsage::SHADER_RESOURCE);
+        local_shadow_state.atlas = resource_operator.CreateRenderTarget(atlas_desc);
+        GLTF_CHECK(local_shadow_state.atlas != NULL_HANDLE);
+    }
+
+    if (local_shadow_state.shadow_info_handles.empty())
+    {
+        std::vector<LocalShadowInfo> empty_shadow_infos(LOCAL_SHADOW_FACE_SLOT_COUNT);
+        RendererInterface::BufferDesc shadow_info_buffer_desc{};
+        shadow_info_buffer_desc.name = "g_local_shadow_infos";
+        shadow_info_buffer_desc.type = RendererInterface::DEFAULT;
+        shadow_info_buffer_desc.usage = RendererInterface::USAGE_SRV;
+        shadow_info_buffer_desc.size = sizeof(LocalShadowInfo) * empty_shadow_infos.size();
+        shadow_info_buffer_desc.data = empty_shadow_infos.data();
+        local_shadow_state.shadow_info_handles =
+            resource_operator.CreateFrameBufferedBuffers(shadow_info_buffer_desc, "g_local_shadow_infos");
+    }
+
+    if (local_shadow_state.light_shadow_index_handles.empty())
+    {
+        std::vector<unsigned> empty_light_shadow_indices(RendererModuleLighting::MAX_LIGHT_COUNT, LOCAL_SHADOW_NONE);
+        RendererInterface::BufferDesc light_shadow_index_buffer_desc{};
+        light_shadow_index_buffer_desc.name = "g_local_light_shadow_indices";
+        light_shadow_index_buffer_desc.type = RendererInterface::DEFAULT;
+        light_shadow_index_buffer_desc.usage = RendererInterface::USAGE_SRV;
+        light_shadow_index_buffer_desc.size = sizeof(unsigned) * empty_light_shadow_indices.size();
+        light_shadow_index_buffer_desc.data = empty_light_shadow_indices.data();
+        local_shadow_state.light_shadow_index_handles =
+            resource_operator.CreateFrameBufferedBuffers(light_shadow_index_buffer_desc, "g_local_light_shadow_indices");
+    }
+}
+
+RendererSystemLighting::LocalShadowFacePass& RendererSystemLighting::GetOrCreateLocalShadowFacePass(
+    RendererInterface::ResourceOperator& resource_operator,
+    RendererInterface::RenderGraph& graph,
+    unsigned face_slot)
+{
+    GLTF_CHECK(face_slot < LOCAL_SHADOW_FACE_SLOT_COUNT);
+    auto& face_pass = m_local_shadow_state.face_passes[face_slot];
+    if (face_pass.node != NULL_HANDLE)
+    {
+        return face_pass;
+    }
+
+    ViewBuffer initial_view_buffer{};
+    RendererInterface::BufferDesc camera_buffer_desc{};
+    camera_buffer_desc.name = "ViewBuffer";
+    camera_buffer_desc.size = sizeof(ViewBuffer);
+    camera_buffer_desc.type = RendererInterface::DEFAULT;
+    camera_buffer_desc.usage = RendererInterface::USAGE_CBV;
+    camera_buffer_desc.data = &initial_view_buffer;
+    face_pass.view_buffer_handles = resource_operator.CreateFrameBufferedBuffers(
+        camera_buffer_desc,
+        std::format("ViewBuffer_local_shadow_{}", face_slot));
+    face_pass.view_buffers.assign(face_pass.view_buffer_handles.size(), initial_view_buffer);
+
+    face_pass.node = graph.CreateRenderGraphNode(
+        resource_operator,
+        BuildLocalShadowPassSetupInfo(face_pass, face_slot));
+    return face_pass;
+}
+
+RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::BuildLocalShadowPassSetupInfo(
+    const LocalShadowFacePass& face_pass,
+    unsigned face_slot) const
+{
+    const std::string pass_name = std::format(
+        "Point Shadow Slot {} Face {}",
+        face_slot / LocalShadowAtlas::CUBE_FACE_COUNT,
+        face_slot % LocalShadowAtlas::CUBE_FACE_COUNT);
+    // The node viewport rect is moved onto the allocated atlas tile every time the face is rendered;
+    // depth clears only touch that rect, so the other cached tiles are preserved.
+    return RenderFeature::PassBuilder::Graphics("Lighting", pass_name)
+        .SetRenderState(m_local_shadow_render_state)
+        .SetViewport(static_cast<int>(LOCAL_SHADOW_MAX_TILE_SIZE), static_cast<int>(LOCAL_SHADOW_MAX_TILE_SIZE))
+        .AddModule(m_scene->GetSceneMeshModule())
+        .AddShader(
+            RendererInterface::ShaderType::VERTEX_SHADER,
+            "MainVS",
+            "Resources/Shaders/ModelRenderingShader.hlsl")
+        .AddRenderTargets({
+            RenderFeature::MakeRenderTargetAttachment(
+                m_local_shadow_state.atlas,
+                RenderFeature::MakeDepthRenderTargetBinding(RendererInterface::D32, true))
+        })
+        .AddBuffers({
+            RenderFeature::MakeBufferBinding(
+                "ViewBuffer",
+                RenderFeature::MakeConstantBufferBinding(face_pass.view_buffer_handles[0]))
+        })
+        .ExcludeBufferBinding("g_material_infos")
+        .ExcludeTextureBinding("bindless_material_textures")
+        .Build();
+}
+
+void RendererSystemLighting::UpdateLocalShadowResources(
+    RendererInterface::ResourceOperator& resource_operator,
+    RendererInterface::RenderGraph& graph,
+    const LightingExecutionPlan& execution_plan)
+{
+    auto& local_shadow_state = m_local_shadow_state;
+    local_shadow_state.rendered_nodes.clear();
+    local_shadow_state.shadowed_light_count = 0;
+    local_shadow_state.rendered_tile_count = 0;
+    local_shadow_state.cached_tile_count = 0;
+
+    // Shadow the point lights with the largest screen coverage; ties keep light order so the
+    // selection does not flicker between frames.
+    const auto& lights = m_lighting_module->GetLightInfos();
+    std::vector<std::pair<float, unsigned>> candidates;
+    LocalShadowAtlas::CoverageViewDesc coverage_view{};
+    glm::fvec4 projection_params{};
+    if (CastShadow() && execution_plan.camera_module->GetViewFrustumParams(coverage_view.view_matrix, projection_params))
+    {
+        coverage_view.tan_half_fov_x = projection_params.x;
+        coverage_view.tan_half_fov_y = projection_params.y;
+        coverage_view.viewport_height = execution_plan.compute_plan.frame_dimensions.height;
+        for (unsigned light_index = 0; light_index < lights.size(); ++light_index)
+        {
+            const auto& light = lights[light_index];
+            if (light.type != LightType::Point)
+            {
+                continue;
+            }
+
+            const float coverage = LocalShadowAtlas::ComputeScreenCoverage(light.position, light.radius, coverage_view);
+            if (coverage > 0.0f)
+            {
+                candidates.emplace_back(coverage, light_index);
+            }
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.first > rhs.first;
+    });
+    if (candidates.size() > MAX_LOCAL_SHADOW_LIGHT_COUNT)
+    {
+        candidates.resize(MAX_LOCAL_SHADOW_LIGHT_COUNT);
+    }
+
+    std::map<unsigned, unsigned> requested_tile_sizes;
+    for (const auto& candidate : candidates)
+    {
+        requested_tile_sizes[candidate.second] = LocalShadowAtlas::ComputeTileSize(
+            candidate.first, LOCAL_SHADOW_MIN_TILE_SIZE, LOCAL_SHADOW_MAX_TILE_SIZE);
+    }
+
+    // Release lights that dropped out or need another tile size before packing new ones. Shrinking
+    // by a single level is tolerated so coverage hovering around a boundary does not thrash the cache.
+    for (auto& entry : local_shadow_state.entries)
+    {
+        if (!entry.active)
+        {
+            continue;
+        }
+
+        const auto requested_it = requested_tile_sizes.find(entry.light_index);
+        if (requested_it != requested_tile_sizes.end() &&
+            (requested_it->second == entry.requested_tile_size || requested_it->second * 2 == entry.requested_tile_size))
+        {
+            continue;
+        }
+
+        for (const auto& tile : entry.tiles)
+        {
+            local_shadow_state.packer.Free(tile);
+        }
+        entry = LocalShadowLightEntry{};
+    }
+
+    const auto allocate_cube_tiles = [&local_shadow_state](unsigned tile_size, LocalShadowLightEntry& entry)
+    {
+        for (unsigned face = 0; face < LocalShadowAtlas::CUBE_FACE_COUNT; ++face)
+        {
+            if (!local_shadow_state.packer.Allocate(tile_size, entry.tiles[face]))
+            {
+                for (unsigned allocated_face = 0; allocated_face < face; ++allocated_face)
+                {
+                    local_shadow_state.packer.Free(entry.tiles[allocated_face]);
+                    entry.tiles[allocated_face] = {};
+                }
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Largest requests are packed first; when the atlas is full a light falls back to smaller tiles.
+    for (const auto& candidate : candidates)
+    {
+        const unsigned light_index = candidate.second;
+        const auto entry_matches = [light_index](const LocalShadowLightEntry& entry)
+        {
+            return entry.active && entry.light_index == light_index;
+        };
+        if (std::any_of(local_shadow_state.entries.begin(), local_shadow_state.entries.end(), entry_matches))
+        {
+            continue;
+        }
+
+        const auto free_entry_it = std::find_if(local_shadow_state.entries.begin(), local_shadow_state.entries.end(),
+            [](const LocalShadowLightEntry& entry) { return !entry.active; });
+        GLTF_CHECK(free_entry_it != local_shadow_state.entries.end());
+
+        auto& entry = *free_entry_it;
+        const unsigned requested_tile_size = requested_tile_sizes.at(light_index);
+        for (unsigned tile_size = requested_tile_size; tile_size >= LOCAL_SHADOW_MIN_TILE_SIZE; tile_size >>= 1)
+        {
+            if (allocate_cube_tiles(tile_size, entry))
+            {
+                entry.active = true;
+                entry.light_index = light_index;
+                entry.requested_tile_size = requested_tile_size;
+                entry.tile_size = tile_size;
+                entry.cache_valid = false;
+                break;
+            }
+        }
+    }
+
+    const auto scene_mesh_module = m_scene->GetSceneMeshModule();
+    const auto& draw_commands = scene_mesh_module->GetDrawCommands();
+    const auto& draw_command_bounds = scene_mesh_module->GetDrawCommandBounds();
+    const unsigned draw_command_bounds_revision = scene_mesh_module->GetDrawCommandBoundsRevision();
+    const unsigned current_frame_slot_index = resource_operator.GetCurrentFrameSlotIndex();
+    std::vector<LocalShadowInfo> shadow_infos(LOCAL_SHADOW_FACE_SLOT_COUNT);
+    std::vector<unsigned> light_shadow_indices((std::max)(lights.size(), static_cast<size_t>(1)), LOCAL_SHADOW_NONE);
+    for (unsigned entry_slot = 0; entry_slot < MAX_LOCAL_SHADOW_LIGHT_COUNT; ++entry_slot)
+    {
+        auto& entry = local_shadow_state.entries[entry_slot];
+        if (!entry.active)
+        {
+            continue;
+        }
+
+        GLTF_CHECK(entry.light_index < lights.size());
+        const auto& light = lights[entry.light_index];
+        const bool light_unchanged = entry.cache_valid &&
+            entry.cached_position == light.position &&
+            entry.cached_radius == light.radius;
+        // Caster bounds only move when the scene changes, so the signature is rehashed only then.
+        bool cache_hit = light_unchanged && entry.cached_bounds_revision == draw_command_bounds_revision;
+        std::size_t caster_signature = entry.cached_caster_signature;
+        if (!cache_hit)
+        {
+            caster_signature = ShadowCasterCulling::ComputeCasterSignature(light.position, light.radius, draw_command_bounds);
+            cache_hit = light_unchanged && entry.cached_caster_signature == caster_signature;
+        }
+        const unsigned first_face_slot = entry_slot * LocalShadowAtlas::CUBE_FACE_COUNT;
+        if (cache_hit)
+        {
+            local_shadow_state.cached_tile_count += LocalShadowAtlas::CUBE_FACE_COUNT;
+        }
+        else
+        {
+            entry.near_z = (std::max)(0.05f, light.radius * 0.005f);
+            entry.face_view_projections = LocalShadowAtlas::ComputeCubeFaceViewProjections(
+                light.position, entry.near_z, light.radius, entry.tile_size, 1.5f);
+
+            for (unsigned face = 0; face < LocalShadowAtlas::CUBE_FACE_COUNT; ++face)
+            {
+                auto& face_pass = GetOrCreateLocalShadowFacePass(resource_operator, graph, first_face_slot + face);
+                const auto& tile = entry.tiles[face];
+                const glm::fmat4x4& view_projection = entry.face_view_projections[face];
+                ShadowCasterCulling::CullDrawCommands(
+                    view_projection,
+                    draw_commands,
+                    draw_command_bounds,
+                    face_pass.culled_draw_commands);
+
+                // A face re-rendered for a scene change or a moved tile keeps the view it already has bound;
+                // only a new view is uploaded to the current frame slot and rebound.
+                if (face_pass.bound_view_buffer == NULL_HANDLE || face_pass.bound_view_projection != view_projection)
+                {
+                    const unsigned frame_slot = current_frame_slot_index % static_cast<unsigned>(face_pass.view_buffer_handles.size());
+                    ViewBuffer& view_buffer = face_pass.view_buffers[frame_slot];
+                    view_buffer = ViewBuffer{};
+                    view_buffer.view_projection_matrix = view_projection;
+                    view_buffer.prev_view_projection_matrix = view_projection;
+                    view_buffer.inverse_view_projection_matrix = glm::inverse(view_projection);
+                    view_buffer.view_position = glm::fvec4(light.position, 1.0f);
+                    view_buffer.viewport_width = tile.size;
+                    view_buffer.viewport_height = tile.size;
+
+                    RendererInterface::BufferUploadDesc view_buffer_upload_desc{};
+                    view_buffer_upload_desc.data = &view_buffer;
+                    view_buffer_upload_desc.size = sizeof(ViewBuffer);
+                    resource_operator.UploadFrameBufferedBufferData(face_pass.view_buffer_handles, view_buffer_upload_desc);
+
+                    const auto view_buffer_handle = resource_operator.GetFrameBufferedBufferHandle(face_pass.view_buffer_handles);
+                    if (view_buffer_handle != face_pass.bound_view_buffer)
+                    {
+                        graph.UpdateNodeBufferBinding(face_pass.node, GetLightingBindingNames().view_buffer, view_buffer_handle);
+                        face_pass.bound_view_buffer = view_buffer_handle;
+                    }
+                    face_pass.bound_view_projection = view_projection;
+                }
+                graph.UpdateNodeViewportRect(face_pass.node, RendererInterface::RenderViewportRect{
+                    static_cast<int>(tile.x), static_cast<int>(tile.y), static_cast<int>(tile.size), static_cast<int>(tile.size)});
+                graph.UpdateNodeExecuteCommands(face_pass.node, face_pass.culled_draw_commands);
+                graph.RegisterRenderGraphNode(face_pass.node);
+                local_shadow_state.rendered_nodes.push_back(face_pass.node);
+            }
+
+            entry.cache_valid = true;
+            entry.cached_position = light.position;
+            entry.cached_radius = light.radius;
+            local_shadow_state.rendered_tile_count += LocalShadowAtlas::CUBE_FACE_COUNT;
+        }
+        entry.cached_caster_signature = caster_signature;
+        entry.cached_bounds_revision = draw_command_bounds_revision;
+
+        light_shadow_indices[entry.light_index] = first_face_slot;
+        for (unsigned face = 0; face < LocalShadowAtlas::CUBE_FACE_COUNT; ++face)
+        {
+            const auto& tile = entry.tiles[face];
+            auto& shadow_info = shadow_infos[first_face_slot + face];
+            shadow_info.view_projection_matrix = entry.face_view_projections[face];
+            shadow_info.atlas_rect = {
+                static_cast<float>(tile.x), static_cast<float>(tile.y),
+                static_cast<float>(tile.size), static_cast<float>(tile.size)};
+            shadow_info.depth_params = {entry.near_z, light.radius, 0.0f, 0.0f};
+        }
+        ++local_shadow_state.shadowed_light_count;
+    }
+
+    RendererInterface::BufferUploadDesc shadow_info_upload_desc{};
+    shadow_info_upload_desc.data = shadow_infos.data();
+    shadow_info_upload_desc.size = shadow_infos.size() * sizeof(LocalShadowInfo);
+    resource_operator.UploadFrameBufferedBufferData(local_shadow_state.shadow_info_handles, shadow_info_upload_desc);
+
+    RendererInterface::BufferUploadDesc light_shadow_index_upload_desc{};
+    light_shadow_index_upload_desc.data = light_shadow_indices.data();
+    light_shadow_index_upload_desc.size = light_shadow_indices.size() * sizeof(unsigned);
+    resource_operator.UploadFrameBufferedBufferData(local_shadow_state.light_shadow_index_handles, light_shadow_index_upload_desc);
+}
+
 RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::BuildLightingPassSetupInfo(
     const LightingExecutionPlan& execution_plan) const
 {
@@ -891,6 +1429,7 @@ RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::Buil
     std::vector<RendererInterface::RenderTargetHandle> initial_shadow_maps;
     m_directional_shadow_state.CollectLightIndexedShadowMaps(m_lighting_module->GetLightInfos(), initial_shadow_maps);
     GLTF_CHECK(!m_lighting_pass_state.shadow_infos_handles.empty());
+    GLTF_CHECK(m_local_shadow_state.atlas != NULL_HANDLE);
     GLTF_CHECK(ssao_outputs.output != NULL_HANDLE);
     GLTF_CHECK(m_environment_lighting_resources);
     GLTF_CHECK(m_environment_lighting_resources->IsReady());
@@ -918,6 +1457,10 @@ RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::Buil
                 "bindless_shadowmap_textures",
                 initial_shadow_maps,
                 RendererInterface::RenderTargetTextureBindingDesc::SRV),
+            RenderFeature::MakeSampledRenderTargetBinding(
+                "localShadowAtlasTex",
+                m_local_shadow_state.atlas,
+                RendererInterface::RenderTargetTextureBindingDesc::SRV),
             RenderFeature::MakeSampledRenderTargetBinding(
                 "Output",
                 m_lighting_pass_state.output,
@@ -930,7 +1473,21 @@ RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::Buil
                     m_lighting_pass_state.shadow_infos_handles.front(),
                     RendererInterface::BufferBindingDesc::SRV,
                     sizeof(ShadowMapInfo),
-                    static_cast<unsigned>(m_lighting_module->GetLightInfos().size()))),
+                    static_cast<unsigned>(initial_shadow_maps.size()))),
+            RenderFeature::MakeBufferBinding(
+                "g_local_shadow_infos",
+                RenderFeature::MakeStructuredBufferBinding(
+                    m_local_shadow_state.shadow_info_handles.front(),
+                    RendererInterface::BufferBindingDesc::SRV,
+                    sizeof(LocalShadowInfo),
+                    LOCAL_SHADOW_FACE_SLOT_COUNT)),
+            RenderFeature::MakeBufferBinding(
+                "g_local_light_shadow_indices",
+                RenderFeature::MakeStructuredBufferBinding(
+                    m_local_shadow_state.light_shadow_index_handles.front(),
+                    RendererInterface::BufferBindingDesc::SRV,
+                    sizeof(unsigned),
+                    RendererModuleLighting::MAX_LIGHT_COUNT)),
             RenderFeature::MakeBufferBinding(
                 "LightingGlobalBuffer",
                 RenderFeature::MakeConstantBufferBinding(m_lighting_global_params_handle))
@@ -946,7 +1503,7 @@ RendererInterface::RenderGraph::RenderPassSetupInfo RendererSystemLighting::Buil
     return builder.Build();
 }
 
-void RendererSystemLighting::UpdateDirectionalShadowResources(RendererInterface::ResourceOperator& resource_operator)
+void RendererSystemLighting::UpdateDirectionalShadowResources(RendererInterface::ResourceOperator& resource_operator, RendererInterface::RenderGraph& graph)
 {
     if (!m_directional_shadow_state.HasShadowPasses())
     {
@@ -957,29 +1514,44 @@ void RendererSystemLighting::UpdateDirectionalShadowResources(RendererInterface:
     const unsigned current_frame_slot_index = resource_operator.GetCurrentFrameSlotIndex();
 
     const auto& lights = m_lighting_module->GetLightInfos();
-    const auto scene_bounds = m_scene->GetSceneMeshModule()->GetSceneBounds();
+    const auto scene_mesh_module = m_scene->GetSceneMeshModule();
+    const auto scene_bounds = scene_mesh_module->GetSceneBounds();
+    DirectionalShadowCascades::CameraFrustumDesc shadow_camera{};
+    BuildShadowCameraFrustum(shadow_camera);
     for (auto& shadow_resource_pair : m_directional_shadow_state.GetResources())
     {
-        const unsigned light_index = shadow_resource_pair.first;
+        const unsigned light_index = GetShadowSlotLightIndex(shadow_resource_pair.first);
         auto& shadow_resource = shadow_resource_pair.second;
         GLTF_CHECK(light_index < lights.size());
 
         const auto& light_info = lights[light_index];
         GLTF_CHECK(light_info.type == LightType::Directional);
-        const unsigned shadowmap_width = shadow_resource.m_shadow_map_info.shadowmap_size[0];
-        const unsigned shadowmap_height = shadow_resource.m_shadow_map_info.shadowmap_size[1];
-        ShadowPassResource::CalcDirectionalLightShadowMatrix(
+        const bool has_shadow = ShadowPassResource::CalcDirectionalCascadeShadowMatrix(
             light_info,
             scene_bounds,
-            0.0f,
-            0.0f,
-            1.0f,
-            1.0f,
-            shadowmap_width,
-            shadowmap_height,
+            shadow_camera,
+            m_cascade_config,
+            GetShadowSlotCascadeIndex(shadow_resource_pair.first),
+            shadow_resource.m_shadowmap_size,
             shadow_resource.m_shadow_map_view_buffer,
             shadow_resource.m_shadow_map_info);
 
+        if (has_shadow)
+        {
+            shadow_resource.m_caster_cull_stats = ShadowCasterCulling::CullDrawCommands(
+                shadow_resource.m_shadow_map_view_buffer.view_projection_matrix,
+                scene_mesh_module->GetDrawCommands(),
+                scene_mesh_module->GetDrawCommandBounds(),
+                shadow_resource.m_culled_draw_commands);
+        }
+        else
+        {
+            // The lighting pass skips unshadowed slots, so the map is left with just its clear.
+            shadow_resource.m_caster_cull_stats = {};
+            shadow_resource.m_culled_draw_commands.clear();
+        }
+        graph.UpdateNodeExecuteCommands(shadow_resource.m_shadow_pass_node, shadow_resource.m_culled_draw_commands);
+
         if (!shadow_resource.m_shadow_map_buffer_handles.empty() &&
             shadow_resource.m_shadow_map_buffer_handles.size() == shadow_resource.m_shadow_map_view_buffers.size())
         {
@@ -1003,6 +1575,84 @@ void RendererSystemLighting::UpdateDirectionalShadowResources(RendererInterface:
     }
 }
 
+bool RendererSystemLighting::BuildShadowCameraFrustum(DirectionalShadowCascades::CameraFrustumDesc& out_camera) const
+{
+    const auto camera_module = m_scene->GetCameraModule();
+    glm::fvec4 projection_params{};
+    if (!camera_module || !camera_module->GetViewFrustumParams(out_camera.view_matrix, projection_params))
+    {
+        return false;
+    }
+
+    out_camera.tan_half_fov_x = projection_params.x;
+    out_camera.tan_half_fov_y = projection_params.y;
+    out_camera.near_z = projection_params.z;
+    out_camera.far_z = projection_params.w;
+    return true;
+}
+
+bool RendererSystemLighting::ShadowPassResource::CalcDirectionalCascadeShadowMatrix(
+    const LightInfo& directional_light_info, const RendererSceneAABB& scene_bounds,
+    const DirectionalShadowCascades::CameraFrustumDesc& camera,
+    const DirectionalShadowCascades::CascadeConfig& cascade_config,
+    unsigned cascade_index, unsigned shadowmap_size,
+    ViewBuffer& out_view_buffer, ShadowMapInfo& out_shadow_info)
+{
+    const unsigned cascade_count = DirectionalShadowCascades::ClampCascadeCount(cascade_config.cascade_count);
+    const float shadow_far = (std::min)(camera.far_z, cascade_config.max_shadow_distance);
+    std::array<float, DirectionalShadowCascades::MAX_CASCADE_COUNT + 1> splits{};
+    DirectionalShadowCascades::ComputeCascadeSplits(
+        camera.near_z,
+        shadow_far,
+        cascade_count,
+        cascade_config.split_lambda,
+        splits);
+
+    out_shadow_info.vsm_texture_id = -1;
+    out_shadow_info.cascade_count = cascade_count;
+    for (unsigned split_index = 0; split_index < DirectionalShadowCascades::MAX_CASCADE_COUNT; ++split_index)
+    {
+        out_shadow_info.cascade_far_depths[split_index] = splits[split_index + 1];
+    }
+    out_shadow_info.cascade_params = glm::fvec4(cascade_config.blend_fraction, 0.0f, 0.0f, 0.0f);
+
+    DirectionalShadowCascades::CascadeFitResult fit_result{};
+    const bool fitted = cascade_index < cascade_count &&
+        DirectionalShadowCascades::FitCascade(
+            directional_light_info.position,
+            camera,
+            splits[cascade_index],
+            splits[cascade_index + 1],
+            scene_bounds,
+            shadowmap_size,
+            fit_result);
+    if (!fitted)
+    {
+        out_shadow_info.view_matrix = glm::fmat4x4(1.0f);
+        out_shadow_info.projection_matrix = glm::fmat4x4(1.0f);
+        out_shadow_info.shadowmap_size[0] = 0;
+        out_shadow_info.shadowmap_size[1] = 0;
+        return false;
+    }
+
+    out_view_buffer.viewport_width = shadowmap_size;
+    out_view_buffer.viewport_height = shadowmap_size;
+    out_view_buffer.view_position = {fit_result.light_eye, 1.0f};
+    out_view_buffer.view_projection_matrix = fit_result.projection_matrix * fit_result.view_matrix;
+    out_view_buffer.prev_view_projection_matrix = out_view_buffer.view_projection_matrix;
+    out_view_buffer.inverse_view_projection_matrix = glm::inverse(out_view_buffer.view_projection_matrix);
+    out_view_buffer.view_matrix = fit_result.view_matrix;
+    out_view_buffer.projection_matrix = fit_result.projection_matrix;
+    out_view_buffer.inverse_projection_matrix = glm::inverse(fit_result.projection_matrix);
+    out_view_buffer.projection_params = glm::fvec4(0.0f);
+
+    out_shadow_info.view_matrix = fit_result.view_matrix;
+    out_shadow_info.projection_matrix = fit_result.projection_matrix;
+    out_shadow_info.shadowmap_size[0] = shadowmap_size;
+    out_shadow_info.shadowmap_size[1] = shadowmap_size;
+    return true;
+}
+
 bool RendererSystemLighting::ShadowPassResource::CalcDirectionalLightShadowMatrix(
     const LightInfo& directional_light_info, const RendererSceneAABB& scene_bounds, float ndc_min_x, float ndc_min_y,
     float ndc_width, float ndc_height, unsigned shadowmap_width, unsigned shadowmap_height,
@@ -1,10 +1,14 @@
 #pragma once
+#include "DirectionalShadowCascades.h"
 #include "EnvironmentLightingResources.h"
+#include "LocalShadowAtlas.h"
 #include "RendererSystemBase.h"
 #include "RenderPassSetupBuilder.h"
 #include "RendererSystemSceneRenderer.h"
+#include "ShadowCasterCulling.h"
 #include "RendererModule/RendererModuleLighting.h"
 #include "RendererModule/RendererModuleSceneMesh.h"
+#include <array>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -49,6 +53,8 @@ public:
     const RendererInterface::RenderStateDesc& GetDirectionalShadowRenderState() const;
     bool SetDirectionalShadowRenderState(const RendererInterface::RenderStateDesc& render_state);
     bool SetDirectionalShadowDepthBias(const RendererInterface::DepthBiasDesc& depth_bias);
+    const DirectionalShadowCascades::CascadeConfig& GetDirectionalShadowCascadeConfig() const;
+    void SetDirectionalShadowCascadeConfig(const DirectionalShadowCascades::CascadeConfig& cascade_config);
     LightingOutputs GetOutputs() const;
     RendererInterface::RenderTargetHandle GetLightingOutput() const;
     const LightingGlobalParams& GetGlobalParams() const;
@@ -64,6 +70,7 @@ public:
     
 protected:
     static RendererInterface::RenderStateDesc CreateDefaultDirectionalShadowRenderState();
+    static RendererInterface::RenderStateDesc CreateDefaultLocalShadowRenderState();
 
     struct LightingExecutionPlan
     {
@@ -71,19 +78,36 @@ protected:
         RenderFeature::ComputeExecutionPlan compute_plan{};
     };
 
+    // One entry per shadow slot (light_index * MAX_CASCADE_COUNT + cascade_index).
     struct ShadowMapInfo
     {
         glm::fmat4x4 view_matrix{1.0f};
         glm::fmat4x4 projection_matrix{1.0f};
         unsigned shadowmap_size[2];
         unsigned vsm_texture_id;
-        unsigned pad;    
+        unsigned cascade_count;
+        glm::fvec4 cascade_far_depths{0.0f};
+        // x: cascade blend fraction
+        glm::fvec4 cascade_params{0.0f};
     };
+    static_assert(sizeof(ShadowMapInfo) == 176, "ShadowMapInfo must match HLSL structured buffer layout.");
+
+    static unsigned ComputeShadowSlot(unsigned light_index, unsigned cascade_index);
+    static unsigned GetShadowSlotLightIndex(unsigned shadow_slot);
+    static unsigned GetShadowSlotCascadeIndex(unsigned shadow_slot);
     
     struct ShadowPassResource
     {
         static bool CalcDirectionalLightShadowMatrix(const LightInfo& directional_light_info, const RendererSceneAABB& scene_bounds, float ndc_min_x, float ndc_min_y, float ndc_width, float ndc_height, unsigned
                                                            shadowmap_width, unsigned shadowmap_height, ViewBuffer& out_view_buffer, ShadowMapInfo& out_shadow_info);
+        // Every slot carries the light's cascade count and splits, since the lighting pass reads them from the
+        // first one. False when no caster overlaps the cascade slice or it cannot be fitted (e.g. degenerate
+        // camera); the slot is then marked unshadowed with a zero shadowmap_size and needs no draws.
+        static bool CalcDirectionalCascadeShadowMatrix(const LightInfo& directional_light_info, const RendererSceneAABB& scene_bounds,
+                                                       const DirectionalShadowCascades::CameraFrustumDesc& camera,
+                                                       const DirectionalShadowCascades::CascadeConfig& cascade_config,
+                                                       unsigned cascade_index, unsigned shadowmap_size,
+                                                       ViewBuffer& out_view_buffer, ShadowMapInfo& out_shadow_info);
 
         bool HasInit() const;
         bool QueueRenderStateUpdate(RendererInterface::RenderGraph& graph, const RendererInterface::RenderStateDesc& render_state) const;
@@ -93,10 +117,15 @@ protected:
         RendererInterface::RenderGraphNodeHandle m_shadow_pass_node {NULL_HANDLE};
         std::vector<RendererInterface::RenderTargetHandle> m_shadow_maps;
         RendererInterface::RenderTargetHandle m_bound_shadow_map {NULL_HANDLE};
+        // Edge of the square shadow map in texels; m_shadow_map_info reports zero while the slot is unshadowed.
+        unsigned m_shadowmap_size {0};
         ViewBuffer m_shadow_map_view_buffer{};
         std::vector<ViewBuffer> m_shadow_map_view_buffers;
         ShadowMapInfo m_shadow_map_info{};
         std::vector<RendererInterface::BufferHandle> m_shadow_map_buffer_handles;
+        // Compacted caster list for this light/cascade, pushed to the pass node each frame.
+        std::vector<RendererInterface::RenderExecuteCommand> m_culled_draw_commands;
+        ShadowCasterCulling::CullStats m_caster_cull_stats{};
     };
 
     struct LightingPassRuntimeState
@@ -116,7 +145,7 @@ protected:
         bool HasShadowPasses() const;
         size_t GetShadowPassCount() const;
         void CreateFallbackShadowMap(RendererInterface::ResourceOperator& resource_operator);
-        ShadowPassResource& GetOrCreate(unsigned light_index);
+        ShadowPassResource& GetOrCreate(unsigned shadow_slot);
         std::map<unsigned, ShadowPassResource>& GetResources();
         const std::map<unsigned, ShadowPassResource>& GetResources() const;
         bool QueueRenderStateUpdates(RendererInterface::RenderGraph& graph, const RendererInterface::RenderStateDesc& render_state) const;
@@ -125,6 +154,7 @@ protected:
             RendererInterface::ResourceOperator& resource_operator,
             RendererInterface::RenderGraph& graph,
             const std::vector<LightInfo>& lights);
+        // Collect* outputs are indexed by shadow slot and sized lights.size() * MAX_CASCADE_COUNT.
         void CollectLightIndexedShadowMaps(
             const std::vector<LightInfo>& lights,
             std::vector<RendererInterface::RenderTargetHandle>& out_shadow_maps) const;
@@ -137,17 +167,92 @@ protected:
         void CollectDependencyNodes(std::vector<RendererInterface::RenderGraphNodeHandle>& out_dependency_nodes) const;
 
     private:
+        // Keyed by shadow slot.
         std::map<unsigned, ShadowPassResource> m_resources{};
         std::vector<RendererInterface::RenderTargetHandle> m_fallback_shadow_maps{};
         RendererInterface::RenderTargetHandle m_bound_fallback_shadow_map{NULL_HANDLE};
     };
 
+    // Point light shadows: six cube faces per light packed into one depth atlas. The atlas is not
+    // frame buffered so tiles of static lights survive across frames and are only re-rendered when
+    // the light, its tile or the casters around it change.
+    static constexpr unsigned LOCAL_SHADOW_ATLAS_SIZE = 4096;
+    static constexpr unsigned LOCAL_SHADOW_MIN_TILE_SIZE = 64;
+    static constexpr unsigned LOCAL_SHADOW_MAX_TILE_SIZE = 1024;
+    static constexpr unsigned MAX_LOCAL_SHADOW_LIGHT_COUNT = 32;
+    static constexpr unsigned LOCAL_SHADOW_FACE_SLOT_COUNT = MAX_LOCAL_SHADOW_LIGHT_COUNT * LocalShadowAtlas::CUBE_FACE_COUNT;
+    static constexpr unsigned LOCAL_SHADOW_NONE = 0xffffffffu;
+
+    // One entry per cube face; indexed by g_local_light_shadow_indices[light] + face.
+    struct LocalShadowInfo
+    {
+        glm::fmat4x4 view_projection_matrix{1.0f};
+        // xy: tile origin in texels, zw: tile size in texels
+        glm::fvec4 atlas_rect{0.0f};
+        // x: near plane, y: far plane
+        glm::fvec4 depth_params{0.0f};
+    };
+    static_assert(sizeof(LocalShadowInfo) == 96, "LocalShadowInfo must match HLSL structured buffer layout.");
+
+    struct LocalShadowFacePass
+    {
+        RendererInterface::RenderGraphNodeHandle node{NULL_HANDLE};
+        std::vector<RendererInterface::BufferHandle> view_buffer_handles;
+        std::vector<ViewBuffer> view_buffers;
+        std::vector<RendererInterface::RenderExecuteCommand> culled_draw_commands;
+        // View currently bound to the node, so an unchanged face skips the upload and rebind.
+        RendererInterface::BufferHandle bound_view_buffer{NULL_HANDLE};
+        glm::fmat4x4 bound_view_projection{1.0f};
+    };
+
+    struct LocalShadowLightEntry
+    {
+        bool active{false};
+        unsigned light_index{0};
+        unsigned requested_tile_size{0};
+        unsigned tile_size{0};
+        std::array<LocalShadowAtlas::Tile, LocalShadowAtlas::CUBE_FACE_COUNT> tiles{};
+        std::array<glm::fmat4x4, LocalShadowAtlas::CUBE_FACE_COUNT> face_view_projections{};
+        float near_z{0.0f};
+
+        // What the cached tiles were rendered with.
+        bool cache_valid{false};
+        glm::fvec3 cached_position{0.0f};
+        float cached_radius{0.0f};
+        std::size_t cached_caster_signature{0};
+        unsigned cached_bounds_revision{0};
+    };
+
+    struct LocalShadowRuntimeState
+    {
+        void Reset();
+
+        RendererInterface::RenderTargetHandle atlas{NULL_HANDLE};
+        LocalShadowAtlas::TilePacker packer{LOCAL_SHADOW_ATLAS_SIZE, LOCAL_SHADOW_MIN_TILE_SIZE};
+        // Face pass slot = entry slot * CUBE_FACE_COUNT + face.
+        std::array<LocalShadowLightEntry, MAX_LOCAL_SHADOW_LIGHT_COUNT> entries{};
+        std::array<LocalShadowFacePass, LOCAL_SHADOW_FACE_SLOT_COUNT> face_passes{};
+        std::vector<RendererInterface::BufferHandle> shadow_info_handles;
+        std::vector<RendererInterface::BufferHandle> light_shadow_index_handles;
+
+        // Per frame results.
+        std::vector<RendererInterface::RenderGraphNodeHandle> rendered_nodes;
+        unsigned shadowed_light_count{0};
+        unsigned rendered_tile_count{0};
+        unsigned cached_tile_count{0};
+    };
+
     bool QueuePendingDirectionalShadowRenderStateUpdate(RendererInterface::RenderGraph& graph);
     bool SyncLightingTopology(
         RendererInterface::ResourceOperator& resource_operator,
         RendererInterface::RenderGraph& graph,
         const LightingExecutionPlan& execution_plan);
-    void UpdateDirectionalShadowResources(RendererInterface::ResourceOperator& resource_operator);
+    bool UpdateLightClusters(
+        RendererInterface::ResourceOperator& resource_operator,
+        RendererInterface::RenderGraph& graph,
+        const LightingExecutionPlan& execution_plan);
+    bool BuildShadowCameraFrustum(DirectionalShadowCascades::CameraFrustumDesc& out_camera) const;
+    void UpdateDirectionalShadowResources(RendererInterface::ResourceOperator& resource_operator, RendererInterface::RenderGraph& graph);
     void CreateLightingOutput(RendererInterface::ResourceOperator& resource_operator);
     void UploadGlobalParams(RendererInterface::ResourceOperator& resource_operator);
     void CreateLightingPassShadowInfoBuffers(RendererInterface::ResourceOperator& resource_operator);
@@ -155,10 +260,23 @@ protected:
         RendererInterface::ResourceOperator& resource_operator,
         RendererInterface::RenderGraph& graph,
         unsigned light_index,
+        unsigned cascade_index,
         const LightInfo& light_info);
     RendererInterface::RenderGraph::RenderPassSetupInfo BuildDirectionalShadowPassSetupInfo(
         const ShadowPassResource& shadow_pass_resource,
-        unsigned light_index) const;
+        unsigned shadow_slot) const;
+    void CreateLocalShadowResources(RendererInterface::ResourceOperator& resource_operator);
+    LocalShadowFacePass& GetOrCreateLocalShadowFacePass(
+        RendererInterface::ResourceOperator& resource_operator,
+        RendererInterface::RenderGraph& graph,
+        unsigned face_slot);
+    RendererInterface::RenderGraph::RenderPassSetupInfo BuildLocalShadowPassSetupInfo(
+        const LocalShadowFacePass& face_pass,
+        unsigned face_slot) const;
+    void UpdateLocalShadowResources(
+        RendererInterface::ResourceOperator& resource_operator,
+        RendererInterface::RenderGraph& graph,
+        const LightingExecutionPlan& execution_plan);
     RendererInterface::RenderGraph::RenderPassSetupInfo BuildLightingPassSetupInfo(
         const LightingExecutionPlan& execution_plan) const;
     LightingExecutionPlan BuildLightingExecutionPlan() const;
@@ -169,9 +287,12 @@ protected:
     std::shared_ptr<RendererSystemSSAO> m_ssao;
     std::shared_ptr<RendererModuleLighting> m_lighting_module;
     RendererInterface::RenderStateDesc m_directional_shadow_render_state{};
+    DirectionalShadowCascades::CascadeConfig m_cascade_config{};
     std::optional<RendererInterface::RenderStateDesc> m_pending_directional_shadow_render_state{};
 
     DirectionalShadowRuntimeState m_directional_shadow_state{};
+    RendererInterface::RenderStateDesc m_local_shadow_render_state{};
+    LocalShadowRuntimeState m_local_shadow_state{};
     LightingPassRuntimeState m_lighting_pass_state{};
     RendererInterface::BufferHandle m_lighting_global_params_handle{NULL_HANDLE};
     std::shared_ptr<EnvironmentLightingResources> m_environment_lighting_resources{};
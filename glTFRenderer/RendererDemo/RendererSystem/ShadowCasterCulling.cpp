@@ -0,0 +1,102 @@
+#include "ShadowCasterCulling.h"
+#include "RendererSceneAABB.h"
+#include <algorithm>
+#include <functional>
+
+namespace ShadowCasterCulling
+{
+    bool IsCasterVisible(const glm::fmat4x4& light_view_projection, const RendererSceneAABB& caster_bounds)
+    {
+        if (caster_bounds.isNull())
+        {
+            return true;
+        }
+
+        const glm::vec3 bounds_min = caster_bounds.getMin();
+        const glm::vec3 bounds_max = caster_bounds.getMax();
+        // Outside when every corner lies beyond the same plane: -w <= x, y <= w, z <= w.
+        unsigned outside_masks = 0x1f;
+        for (unsigned corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec4 world_corner = {
+                (corner & 1) ? bounds_max.x : bounds_min.x,
+                (corner & 2) ? bounds_max.y : bounds_min.y,
+                (corner & 4) ? bounds_max.z : bounds_min.z,
+                1.0f};
+            const glm::vec4 clip_corner = light_view_projection * world_corner;
+            unsigned corner_mask = 0;
+            corner_mask |= clip_corner.x < -clip_corner.w ? 0x1 : 0;
+            corner_mask |= clip_corner.x > clip_corner.w ? 0x2 : 0;
+            corner_mask |= clip_corner.y < -clip_corner.w ? 0x4 : 0;
+            corner_mask |= clip_corner.y > clip_corner.w ? 0x8 : 0;
+            corner_mask |= clip_corner.z > clip_corner.w ? 0x10 : 0;
+            outside_masks &= corner_mask;
+        }
+
+        return outside_masks == 0;
+    }
+
+    CullStats CullDrawCommands(
+        const glm::fmat4x4& light_view_projection,
+        const std::vector<RendererInterface::RenderExecuteCommand>& draw_commands,
+        const std::vector<RendererSceneAABB>& draw_command_bounds,
+        std::vector<RendererInterface::RenderExecuteCommand>& out_commands)
+    {
+        CullStats stats{};
+        stats.total_caster_count = static_cast<unsigned>(draw_commands.size());
+        out_commands.clear();
+        out_commands.reserve(draw_commands.size());
+        for (std::size_t command_index = 0; command_index < draw_commands.size(); ++command_index)
+        {
+            if (command_index < draw_command_bounds.size() &&
+                !IsCasterVisible(light_view_projection, draw_command_bounds[command_index]))
+            {
+                continue;
+            }
+
+            out_commands.push_back(draw_commands[command_index]);
+        }
+        stats.visible_caster_count = static_cast<unsigned>(out_commands.size());
+        return stats;
+    }
+
+    std::size_t ComputeCasterSignature(
+        const glm::fvec3& light_position,
+        float light_radius,
+        const std::vector<RendererSceneAABB>& draw_command_bounds)
+    {
+        std::size_t signature = 1469598103934665603ULL;
+        auto hash_combine = [&signature](std::size_t value)
+        {
+            signature ^= value + 0x9e3779b97f4a7c15ULL + (signature << 6) + (signature >> 2);
+        };
+        auto hash_vec3 = [&hash_combine](const glm::vec3& value)
+        {
+            hash_combine(std::hash<float>{}(value.x));
+            hash_combine(std::hash<float>{}(value.y));
+            hash_combine(std::hash<float>{}(value.z));
+        };
+
+        for (std::size_t command_index = 0; command_index < draw_command_bounds.size(); ++command_index)
+        {
+            const auto& bounds = draw_command_bounds[command_index];
+            if (bounds.isNull())
+            {
+                continue;
+            }
+
+            const glm::vec3 closest = glm::clamp(light_position, bounds.getMin(), bounds.getMax());
+            const glm::vec3 delta = closest - light_position;
+            if (glm::dot(delta, delta) > light_radius * light_radius)
+            {
+                continue;
+            }
+
+            hash_combine(command_index);
+            hash_vec3(bounds.getMin());
+            hash_vec3(bounds.getMax());
+        }
+        hash_combine(draw_command_bounds.size());
+        return signature;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <vector>
+#include <glm/glm/glm.hpp>
+#include "Renderer.h"
+
+class RendererSceneAABB;
+
+// Per-light caster culling for shadow passes. Pure CPU logic over world space bounds.
+namespace ShadowCasterCulling
+{
+    struct CullStats
+    {
+        unsigned total_caster_count{0};
+        unsigned visible_caster_count{0};
+    };
+
+    // Tests the caster against the side and far planes of the light frustum in clip space. The near
+    // plane is ignored: casters between the light and the near plane still shadow receivers inside
+    // the frustum and are kept.
+    bool IsCasterVisible(const glm::fmat4x4& light_view_projection, const RendererSceneAABB& caster_bounds);
+
+    // Compacts draw_commands into out_commands. Commands without valid bounds are always kept.
+    CullStats CullDrawCommands(
+        const glm::fmat4x4& light_view_projection,
+        const std::vector<RendererInterface::RenderExecuteCommand>& draw_commands,
+        const std::vector<RendererSceneAABB>& draw_command_bounds,
+        std::vector<RendererInterface::RenderExecuteCommand>& out_commands);
+
+    // Hash over the casters overlapping a light's influence sphere. A change means a cached shadow
+    // of that light is stale.
+    std::size_t ComputeCasterSignature(
+        const glm::fvec3& light_position,
+        float light_radius,
+        const std::vector<RendererSceneAABB>& draw_command_bounds);
+}
@@ -4,18 +4,36 @@
 #include "../Math/BRDF.hlsl"
 #include "BindlessTextureDefine.hlsl"
 
+#define MAX_SHADOW_CASCADE_COUNT 4
+
+// Indexed by shadow slot: light_index * MAX_SHADOW_CASCADE_COUNT + cascade_index.
 struct ShadowMapInfo
 {
     float4x4 view_matrix;
     float4x4 projection_matrix;
     uint2 shadowmap_size;
     uint vsm_texture_id;
-    uint pad;
+    uint cascade_count;
+    float4 cascade_far_depths;
+    float4 cascade_params; // x: blend fraction
 };
 StructuredBuffer<ShadowMapInfo> g_shadowmap_infos;
 
 Texture2D<float> bindless_shadowmap_textures[] : register(t0, BINDLESS_TEXTURE_SPACE_SHADOW);
 
+// Point light shadows: six cube faces per shadowed light, packed into one depth atlas.
+// Face order +X, -X, +Y, -Y, +Z, -Z, indexed by g_local_light_shadow_indices[light_index] + face.
+#define LOCAL_SHADOW_NONE 0xffffffff
+struct LocalShadowInfo
+{
+    float4x4 view_projection_matrix;
+    float4 atlas_rect; // xy: tile origin in texels, zw: tile size in texels
+    float4 depth_params; // x: near plane, y: far plane
+};
+StructuredBuffer<LocalShadowInfo> g_local_shadow_infos;
+StructuredBuffer<uint> g_local_light_shadow_indices;
+Texture2D<float> localShadowAtlasTex;
+
 struct LightInfo
 {
     float3 position;
@@ -34,6 +52,8 @@ struct PixelLightingShadingInfo
 
     float3 albedo;
     bool backface;
+
+    float view_depth;
 };
 
 cbuffer LightInfoConstantBuffer
@@ -41,6 +61,25 @@ cbuffer LightInfoConstantBuffer
     int light_count;
 };
 StructuredBuffer<LightInfo> g_lightInfos;
+
+// Clustered light lists: the first light_cluster_global_light_count entries of g_light_cluster_indices
+// are unbounded (directional) lights shared by every cluster.
+struct LightClusterRange
+{
+    uint offset;
+    uint count;
+};
+StructuredBuffer<LightClusterRange> g_light_cluster_ranges;
+StructuredBuffer<uint> g_light_cluster_indices;
+
+cbuffer LightClusterConstantBuffer
+{
+    uint3 light_cluster_grid_size;
+    uint light_cluster_global_light_count;
+    uint2 light_cluster_viewport_size;
+    float light_cluster_depth_slice_scale;
+    float light_cluster_depth_slice_bias;
+};
 Texture2D<float4> environmentTex;
 Texture2D<float4> environmentIrradianceTex;
 Texture2D<float4> environmentPrefilterTex;
@@ -88,41 +127,161 @@ float SampleShadowMapPCF(Texture2D<float> shadowmap, uint2 shadowmap_extent, flo
     return visible_sum / 9.0f;
 }
 
-float CalcLightVisibleFactor(uint light_index, float3 scene_position, float3 scene_normal, float3 light_direction)
+float CalcShadowSlotVisibleFactor(uint shadow_slot, float3 scene_position, float3 scene_normal, float3 light_direction)
 {
-    if (g_lightInfos[light_index].type == 0)
+    ShadowMapInfo shadowmap_info = g_shadowmap_infos[shadow_slot];
+    // Cascade selection varies per pixel, so the descriptor index is not wave-uniform.
+    Texture2D<float> shadowmap = bindless_shadowmap_textures[NonUniformResourceIndex(shadow_slot)];
+    
+    float4 shadowmap_ndc = mul(shadowmap_info.projection_matrix, mul(shadowmap_info.view_matrix, float4(scene_position, 1.0)));
+    if (abs(shadowmap_ndc.w) < 1e-6f)
+    {
+        return 1.0;
+    }
+    shadowmap_ndc /= shadowmap_ndc.w;
+
+    if (shadowmap_ndc.x < -1.0f || shadowmap_ndc.x > 1.0f ||
+        shadowmap_ndc.y < -1.0f || shadowmap_ndc.y > 1.0f ||
+        shadowmap_ndc.z < 0.0f || shadowmap_ndc.z > 1.0f)
+    {
+        return 1.0;
+    }
+
+    uint2 shadowmap_extent = shadowmap_info.shadowmap_size;
+    if (shadowmap_extent.x == 0 || shadowmap_extent.y == 0)
+    {
+        return 1.0;
+    }
+    float2 shadowmap_uv = shadowmap_ndc.xy * float2(0.5f, -0.5f) + 0.5f;
+    if (shadowmap_uv.x < 0.0f || shadowmap_uv.x > 1.0f ||
+        shadowmap_uv.y < 0.0f || shadowmap_uv.y > 1.0f)
+    {
+        return 1.0;
+    }
+    const float depth_bias = ComputeDirectionalShadowDepthBias(shadowmap_extent, scene_normal, light_direction);
+    return SampleShadowMapPCF(shadowmap, shadowmap_extent, saturate(shadowmap_uv), shadowmap_ndc.z, depth_bias);
+}
+
+uint SelectCubeFace(float3 direction)
+{
+    const float3 abs_direction = abs(direction);
+    if (abs_direction.x >= abs_direction.y && abs_direction.x >= abs_direction.z)
+    {
+        return direction.x >= 0.0f ? 0 : 1;
+    }
+    if (abs_direction.y >= abs_direction.z)
+    {
+        return direction.y >= 0.0f ? 2 : 3;
+    }
+    return direction.z >= 0.0f ? 4 : 5;
+}
+
+// PCF restricted to one atlas tile so the kernel never reads a neighbouring light's depth.
+float SampleShadowAtlasPCF(float4 atlas_rect, float2 tile_uv, float shadow_depth, float depth_bias)
+{
+    const int2 tile_min_texel = int2(atlas_rect.xy);
+    const int2 tile_max_texel = tile_min_texel + int2(atlas_rect.zw) - 1;
+    const int2 center_texel = tile_min_texel + int2(floor(tile_uv * atlas_rect.zw));
+
+    float visible_sum = 0.0f;
+    [unroll]
+    for (int y = -1; y <= 1; ++y)
     {
-        // directional visible test
-        ShadowMapInfo shadowmap_info = g_shadowmap_infos[light_index];
-        Texture2D<float> shadowmap = bindless_shadowmap_textures[light_index]; 
-        
-        float4 shadowmap_ndc = mul(shadowmap_info.projection_matrix, mul(shadowmap_info.view_matrix, float4(scene_position, 1.0)));
-        if (abs(shadowmap_ndc.w) < 1e-6f)
+        [unroll]
+        for (int x = -1; x <= 1; ++x)
         {
-            return 1.0;
+            const int2 sample_texel = clamp(center_texel + int2(x, y), tile_min_texel, tile_max_texel);
+            const float compare_shadow_depth = localShadowAtlasTex.Load(int3(sample_texel, 0));
+            visible_sum += shadow_depth <= compare_shadow_depth + depth_bias ? 1.0f : 0.0f;
         }
-        shadowmap_ndc /= shadowmap_ndc.w;
+    }
+
+    return visible_sum / 9.0f;
+}
+
+float CalcLocalLightVisibleFactor(uint light_index, float3 scene_position, float3 scene_normal, float3 light_direction)
+{
+    const uint first_shadow_index = g_local_light_shadow_indices[light_index];
+    if (first_shadow_index == LOCAL_SHADOW_NONE)
+    {
+        return 1.0;
+    }
+
+    const float3 light_to_position = scene_position - g_lightInfos[light_index].position;
+    const LocalShadowInfo shadow_info = g_local_shadow_infos[first_shadow_index + SelectCubeFace(light_to_position)];
+    const float4 shadow_clip = mul(shadow_info.view_projection_matrix, float4(scene_position, 1.0));
+    if (shadow_clip.w < 1e-6f)
+    {
+        return 1.0;
+    }
+
+    const float3 shadow_ndc = shadow_clip.xyz / shadow_clip.w;
+    if (shadow_ndc.z < 0.0f || shadow_ndc.z > 1.0f)
+    {
+        return 1.0;
+    }
 
-        if (shadowmap_ndc.x < -1.0f || shadowmap_ndc.x > 1.0f ||
-            shadowmap_ndc.y < -1.0f || shadowmap_ndc.y > 1.0f ||
-            shadowmap_ndc.z < 0.0f || shadowmap_ndc.z > 1.0f)
+    // World-space bias of a few texels, converted to perspective depth at this distance.
+    const float near_z = shadow_info.depth_params.x;
+    const float far_z = shadow_info.depth_params.y;
+    const float view_z = shadow_clip.w;
+    const float ndotl = saturate(dot(normalize(scene_normal), normalize(light_direction)));
+    const float texel_world_size = 2.0f * view_z / max(shadow_info.atlas_rect.z, 1.0f);
+    const float world_bias = texel_world_size * (1.5f + 2.0f * (1.0f - ndotl));
+    const float depth_bias = world_bias * near_z * far_z / max((far_z - near_z) * view_z * view_z, 1e-6f);
+
+    const float2 tile_uv = saturate(shadow_ndc.xy * float2(0.5f, -0.5f) + 0.5f);
+    return SampleShadowAtlasPCF(shadow_info.atlas_rect, tile_uv, shadow_ndc.z, depth_bias);
+}
+
+float CalcLightVisibleFactor(uint light_index, float3 scene_position, float3 scene_normal, float3 light_direction, float view_depth)
+{
+    if (g_lightInfos[light_index].type == 0)
+    {
+        // directional visible test, cascade selected by view depth
+        const uint base_slot = light_index * MAX_SHADOW_CASCADE_COUNT;
+        const ShadowMapInfo cascade_info = g_shadowmap_infos[base_slot];
+        const uint cascade_count = min(cascade_info.cascade_count, MAX_SHADOW_CASCADE_COUNT);
+        if (cascade_count == 0)
         {
             return 1.0;
         }
 
-        uint2 shadowmap_extent = shadowmap_info.shadowmap_size;
-        if (shadowmap_extent.x == 0 || shadowmap_extent.y == 0)
+        const float cascade_far_depths[MAX_SHADOW_CASCADE_COUNT] = {
+            cascade_info.cascade_far_depths.x,
+            cascade_info.cascade_far_depths.y,
+            cascade_info.cascade_far_depths.z,
+            cascade_info.cascade_far_depths.w};
+        uint cascade_index = 0;
+        while (cascade_index < cascade_count && view_depth > cascade_far_depths[cascade_index])
         {
-            return 1.0;
+            ++cascade_index;
         }
-        float2 shadowmap_uv = shadowmap_ndc.xy * float2(0.5f, -0.5f) + 0.5f;
-        if (shadowmap_uv.x < 0.0f || shadowmap_uv.x > 1.0f ||
-            shadowmap_uv.y < 0.0f || shadowmap_uv.y > 1.0f)
+        if (cascade_index >= cascade_count)
         {
             return 1.0;
         }
-        const float depth_bias = ComputeDirectionalShadowDepthBias(shadowmap_extent, scene_normal, light_direction);
-        return SampleShadowMapPCF(shadowmap, shadowmap_extent, saturate(shadowmap_uv), shadowmap_ndc.z, depth_bias);
+
+        float visible_factor = CalcShadowSlotVisibleFactor(base_slot + cascade_index, scene_position, scene_normal, light_direction);
+
+        const float blend_fraction = cascade_info.cascade_params.x;
+        if (blend_fraction > 0.0f && cascade_index + 1 < cascade_count)
+        {
+            const float cascade_near = cascade_index == 0 ? 0.0f : cascade_far_depths[cascade_index - 1];
+            const float blend_range = max((cascade_far_depths[cascade_index] - cascade_near) * blend_fraction, 1e-4f);
+            const float blend_t = saturate((cascade_far_depths[cascade_index] - view_depth) / blend_range);
+            if (blend_t < 1.0f)
+            {
+                const float next_visible_factor = CalcShadowSlotVisibleFactor(base_slot + cascade_index + 1, scene_position, scene_normal, light_direction);
+                visible_factor = lerp(next_visible_factor, visible_factor, blend_t);
+            }
+        }
+
+        return visible_factor;
+    }
+    else if (g_lightInfos[light_index].type == 1)
+    {
+        return CalcLocalLightVisibleFactor(light_index, scene_position, scene_normal, light_direction);
     }
     return 1.0;
 }
@@ -327,7 +486,7 @@ float3 GetLightingByIndex(uint sample_light_index, PixelLightingShadingInfo shad
     float max_distance;
     if (GetLightDistanceVector(sample_light_index, shading_info.position, light_vector, max_distance))
     {
-        float visible_factor = CalcLightVisibleFactor(sample_light_index, shading_info.position, shading_info.normal, light_vector);
+        float visible_factor = CalcLightVisibleFactor(sample_light_index, shading_info.position, shading_info.normal, light_vector, shading_info.view_depth);
         float3 brdf = EvalCookTorranceBRDF(shading_info.normal, shading_info.albedo, shading_info.metallic, shading_info.roughness, view, light_vector);
         return visible_factor * brdf * GetLightIntensity(sample_light_index, shading_info.position) * max(dot(shading_info.normal, light_vector), 0.0);
     }
@@ -335,12 +494,32 @@ float3 GetLightingByIndex(uint sample_light_index, PixelLightingShadingInfo shad
     return 0.0;
 }
 
-float3 GetLighting(PixelLightingShadingInfo shading_info, float3 view)
+uint ComputeLightClusterIndex(uint2 pixel, float view_depth)
+{
+    const uint2 tile = min(pixel * light_cluster_grid_size.xy / max(light_cluster_viewport_size, uint2(1, 1)),
+        light_cluster_grid_size.xy - 1);
+    const float slice = log(max(view_depth, 1e-4f)) * light_cluster_depth_slice_scale - light_cluster_depth_slice_bias;
+    const uint depth_slice = min((uint)max(slice, 0.0f), light_cluster_grid_size.z - 1);
+    return (depth_slice * light_cluster_grid_size.y + tile.y) * light_cluster_grid_size.x + tile.x;
+}
+
+float3 GetLighting(PixelLightingShadingInfo shading_info, float3 view, uint cluster_index)
 {
     float3 result = 0.0;
-    for (uint i = 0; i < light_count; ++i)
+    if (light_count <= 0)
+    {
+        return result;
+    }
+
+    for (uint i = 0; i < light_cluster_global_light_count; ++i)
+    {
+        result += GetLightingByIndex(g_light_cluster_indices[i], shading_info, view);
+    }
+
+    const LightClusterRange cluster_range = g_light_cluster_ranges[cluster_index];
+    for (uint j = 0; j < cluster_range.count; ++j)
     {
-        result += GetLightingByIndex(i, shading_info, view);
+        result += GetLightingByIndex(g_light_cluster_indices[cluster_range.offset + j], shading_info, view);
     }
 
     return result;
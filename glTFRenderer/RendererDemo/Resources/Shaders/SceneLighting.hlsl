@@ -81,10 +81,12 @@ void main(int3 dispatchThreadID : SV_DispatchThreadID)
         shading_info.metallic = metallic;
         shading_info.roughness = roughness;
         shading_info.backface = false;
+        shading_info.view_depth = mul(view_matrix, float4(world_position, 1.0)).z;
     
         float3 view = normalize(view_position.xyz - world_position);
 
-        const float3 direct_lighting = GetLighting(shading_info, view);
+        const uint light_cluster_index = ComputeLightClusterIndex(dispatchThreadID.xy, shading_info.view_depth);
+        const float3 direct_lighting = GetLighting(shading_info, view, light_cluster_index);
         const float3 diffuse_indirect = GetEnvironmentDiffuseLighting(shading_info, ambient_occlusion);
         const float3 specular_indirect = GetEnvironmentSpecularLighting(shading_info, view);
         const float3 final_lighting = direct_lighting + diffuse_indirect + specular_indirect;
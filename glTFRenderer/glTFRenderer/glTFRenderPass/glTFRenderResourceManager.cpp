@@ -114,7 +114,7 @@ bool glTFRenderResourceManager::InitResourceManager(unsigned width, unsigned hei
     EXIT_WHEN_FALSE(m_device->InitDevice(*m_factory))
     
     m_command_queue = RHIResourceFactory::CreateRHIResource<IRHICommandQueue>();
-    EXIT_WHEN_FALSE(m_command_queue->InitCommandQueue(*m_device))
+    EXIT_WHEN_FALSE(m_command_queue->InitCommandQueue(*m_device, RHICommandQueueType::GRAPHICS))
     
     m_swap_chain = RHIResourceFactory::CreateRHIResource<IRHISwapChain>();
     RHITextureDesc swap_chain_texture_desc("swap_chain_back_buffer",
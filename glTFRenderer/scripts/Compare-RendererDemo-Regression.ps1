@@ -115,6 +115,13 @@ $metrics = @(
     'cpu_total_avg_ms',
     'gpu_total_avg_ms',
     'frame_total_avg_ms',
+    'cpu_total_p99_ms',
+    'gpu_total_p99_ms',
+    'frame_total_p50_ms',
+    'frame_total_p90_ms',
+    'frame_total_p99_ms',
+    'frame_total_max_ms',
+    'frame_total_stddev_ms',
     'execute_passes_avg_ms',
     'non_pass_cpu_avg_ms',
     'frame_wait_total_avg_ms',